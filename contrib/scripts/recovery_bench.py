@@ -0,0 +1,132 @@
+#!/usr/bin/python -u
+
+#
+# Restart recovery benchmark
+#
+# Loads rows into a table of an existing database, kills the server without
+# a checkpoint and restarts it, for every log volume and every number of
+# parallel redo threads given. The log volume of each run and the time taken
+# by the restart recovery are read from the server error log
+# (ER_LOG_RECOVERY_STARTED / ER_LOG_RECOVERY_FINISHED).
+#
+# The database must exist and its server must be stopped. Parameters are
+# given to the server through CUBRID_<PARAMETER> environment variables, so
+# cubrid.conf is left as it is.
+#
+
+import sys, os, time
+import re
+import glob
+import signal
+import subprocess
+from optparse import OptionParser
+
+usage = "usage: %prog [options] database_name"
+parser = OptionParser(usage=usage, version="%prog 1.0")
+parser.add_option("-r", "--rows", dest="rows", default='100000,400000,1600000', help="rows loaded before each crash, comma separated [default: %default]");
+parser.add_option("-t", "--threads", dest="threads", default='0,4,8', help="log_redo_parallel_threads values, comma separated [default: %default]");
+parser.add_option("-b", "--batch", dest="batch", type="int", default=10000, help="rows inserted by a statement [default: %default]");
+parser.add_option("-o", "--output", dest="output", default='-', help="csv output file [default: - (stdout)]");
+
+(options, args) = parser.parse_args()
+
+if len(args) != 1:
+	parser.print_help()
+	sys.exit(1)
+
+db = args[0]
+if not os.environ.get('CUBRID'):
+	print('CUBRID environment variable is not set')
+	sys.exit(1)
+
+err_dir = os.path.join(os.environ['CUBRID'], 'log', 'server')
+table = 'recovery_bench'
+
+re_time = re.compile('^Time: ([0-9/]+ [0-9:]+\.[0-9]+) - NOTIFICATION \*\*\* .*CODE = (-1128|-1129)', re.M)
+re_started = re.compile('Log recovery is started. The number of log records to be applied: ([0-9]+). Log page: ([0-9-]+) ~ ([0-9-]+)')
+
+
+def run(cmd, env=None):
+	p = subprocess.Popen(cmd, env=env, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+	out = p.communicate()[0]
+	if p.returncode != 0:
+		print(out)
+		raise Exception('failed: %s' % ' '.join(cmd))
+	return out
+
+def csql(stmt):
+	return run(['csql', '-u', 'dba', '-c', stmt, db])
+
+def server_env(threads):
+	env = dict(os.environ)
+	env['CUBRID_LOG_REDO_PARALLEL_THREADS'] = str(threads)
+	# keep the whole load in the redo range
+	env['CUBRID_CHECKPOINT_INTERVAL_IN_MINS'] = '100000'
+	env['CUBRID_CHECKPOINT_EVERY_NPAGES'] = '2147483647'
+	return env
+
+def server_pid():
+	out = subprocess.Popen(['pgrep', '-f', 'cub_server %s$' % db], stdout=subprocess.PIPE).communicate()[0]
+	pids = out.split()
+	if len(pids) != 1:
+		raise Exception('cannot find cub_server of %s' % db)
+	return int(pids[0])
+
+def last_error_log():
+	files = glob.glob(os.path.join(err_dir, '%s_*.err' % db))
+	if not files:
+		raise Exception('no error log of %s in %s' % (db, err_dir))
+	return max(files, key=os.path.getmtime)
+
+def parse_time(s):
+	# mm/dd/yy hh:mm:ss.msec
+	t, msec = s.split('.')
+	return time.mktime(time.strptime(t, '%m/%d/%y %H:%M:%S')) + int(msec) / 1000.0
+
+def recovery_stat(filename):
+	text = open(filename, 'r').read()
+	times = {}
+	for m in re_time.finditer(text):
+		times[m.group(2)] = parse_time(m.group(1))
+	m = re_started.search(text)
+	if not m or '-1128' not in times or '-1129' not in times:
+		raise Exception('no restart recovery in %s' % filename)
+	records = int(m.group(1))
+	pages = int(m.group(3)) - int(m.group(2)) + 1
+	return records, pages, times['-1129'] - times['-1128']
+
+def bench(rows, threads):
+	run(['cubrid', 'server', 'start', db], server_env(threads))
+	csql('drop table if exists %s; create table %s (id int, pad varchar(200));' % (table, table))
+
+	loaded = 0
+	while loaded < rows:
+		n = min(options.batch, rows - loaded)
+		csql("insert into %s select rownum + %d, repeat('x', 200) from db_root connect by level <= %d;"
+		     % (table, loaded, n))
+		loaded += n
+
+	# crash: dirty data pages are lost and must be redone from the log
+	os.kill(server_pid(), signal.SIGKILL)
+	time.sleep(1)
+
+	start = time.time()
+	run(['cubrid', 'server', 'start', db], server_env(threads))
+	elapsed = time.time() - start
+
+	records, pages, recovery = recovery_stat(last_error_log())
+	run(['cubrid', 'server', 'stop', db])
+	return records, pages, recovery, elapsed
+
+
+if options.output == '-':
+	out = sys.stdout
+else:
+	out = open(options.output, 'w')
+
+out.write('rows,redo_threads,log_records,log_pages,recovery_sec,restart_sec\n')
+for rows in [int(x) for x in options.rows.split(',')]:
+	for threads in [int(x) for x in options.threads.split(',')]:
+		records, pages, recovery, elapsed = bench(rows, threads)
+		out.write('%d,%d,%d,%d,%.3f,%.3f\n' % (rows, threads, records, pages, recovery, elapsed))
+		out.flush()
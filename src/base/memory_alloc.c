@@ -48,6 +48,13 @@ extern unsigned int db_on_server;
 HL_HEAPID private_heap_id = 0;
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+static void *db_arena_alloc_chunk (DB_ARENA * arena, size_t size);
+static DB_ARENA_CHUNK *db_arena_find_chunk (THREAD_ENTRY * thread_p, void *ptr, DB_ARENA ** arena_p);
+static void *db_arena_realloc (THREAD_ENTRY * thread_p, DB_ARENA * arena, char *ptr, size_t size,
+			       DB_ARENA_CHUNK * chunk);
+#endif /* SERVER_MODE */
+
 /*
  * ansisql_strcmp - String comparison according to ANSI SQL
  *   return: an integer value which is less than zero
@@ -510,6 +517,9 @@ db_private_realloc (void *thrd, void *ptr, size_t size)
   void *new_ptr = NULL;
 #if defined (SERVER_MODE)
   HL_HEAPID heap_id;
+  THREAD_ENTRY *thread_p;
+  DB_ARENA *arena;
+  DB_ARENA_CHUNK *chunk;
 #endif
 
 #if defined (CS_MODE)
@@ -520,7 +530,17 @@ db_private_realloc (void *thrd, void *ptr, size_t size)
       return NULL;
     }
 
-  heap_id = (thrd ? ((THREAD_ENTRY *) thrd)->private_heap_id : css_get_private_heap (NULL));
+  thread_p = (thrd ? (THREAD_ENTRY *) thrd : thread_get_thread_entry_info ());
+  if (ptr != NULL && thread_p->query_arena != NULL)
+    {
+      chunk = db_arena_find_chunk (thread_p, ptr, &arena);
+      if (chunk != NULL)
+	{
+	  return db_arena_realloc (thread_p, arena, (char *) ptr, size, chunk);
+	}
+    }
+
+  heap_id = thread_p->private_heap_id;
 
   if (heap_id)
     {
@@ -657,6 +677,8 @@ db_private_free_release (void *thrd, void *ptr, bool rc_track)
 {
 #if defined (SERVER_MODE)
   HL_HEAPID heap_id;
+  THREAD_ENTRY *thread_p;
+  DB_ARENA *arena;
 #endif
 
   if (ptr == NULL)
@@ -667,7 +689,21 @@ db_private_free_release (void *thrd, void *ptr, bool rc_track)
 #if defined (CS_MODE)
   db_ws_free (ptr);
 #elif defined (SERVER_MODE)
-  heap_id = (thrd ? ((THREAD_ENTRY *) thrd)->private_heap_id : css_get_private_heap (NULL));
+  thread_p = (thrd ? (THREAD_ENTRY *) thrd : thread_get_thread_entry_info ());
+  if (thread_p->query_arena != NULL && db_arena_find_chunk (thread_p, ptr, &arena) != NULL)
+    {
+      if (ptr == arena->last_alloc)
+	{
+	  /* the space of the last allocation can be reused */
+	  arena->free_ptr = arena->last_alloc;
+	  arena->last_alloc = NULL;
+	}
+
+      /* otherwise the memory is released with the arena */
+      return;
+    }
+
+  heap_id = thread_p->private_heap_id;
 
   if (heap_id)
     {
@@ -756,6 +792,228 @@ db_private_realloc_external (void *thrd, void *ptr, size_t size)
   return db_private_realloc (thrd, ptr, size);
 }
 
+/*
+ * db_arena_begin () - start the arena of a query
+ *   return:
+ *   thread_p(in):
+ *   arena(in/out): arena to start, allocations of the thread are made in it until db_arena_end
+ *
+ * Note: arenas of nested queries are stacked; the memory of an outer arena may still be freed in the inner one.
+ */
+void
+db_arena_begin (THREAD_ENTRY * thread_p, DB_ARENA * arena)
+{
+  arena->chunks = NULL;
+  arena->free_ptr = NULL;
+  arena->last_alloc = NULL;
+  arena->total_size = 0;
+  arena->outer = NULL;
+
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  arena->outer = thread_p->query_arena;
+  thread_p->query_arena = arena;
+#endif /* SERVER_MODE */
+}
+
+/*
+ * db_arena_end () - end the arena of a query and release all its memory
+ *   return:
+ *   thread_p(in):
+ *   arena(in/out): arena started by db_arena_begin
+ */
+void
+db_arena_end (THREAD_ENTRY * thread_p, DB_ARENA * arena)
+{
+#if defined (SERVER_MODE)
+  DB_ARENA_CHUNK *chunk;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  assert (thread_p->query_arena == arena);
+  thread_p->query_arena = arena->outer;
+
+  while (arena->chunks != NULL)
+    {
+      chunk = arena->chunks;
+      arena->chunks = chunk->next;
+      free (chunk);
+    }
+#endif /* SERVER_MODE */
+
+  arena->free_ptr = NULL;
+  arena->last_alloc = NULL;
+  arena->total_size = 0;
+  arena->outer = NULL;
+}
+
+/*
+ * db_arena_alloc () - allocate memory in the arena of the query
+ *   return: allocated memory pointer
+ *   thread_p(in):
+ *   size(in): size to allocate
+ *
+ * Note: the memory is allocated on the private heap if the thread has no arena or its arena is full. Either way it
+ *       is freed by db_private_free.
+ */
+void *
+db_arena_alloc (THREAD_ENTRY * thread_p, size_t size)
+{
+#if defined (SERVER_MODE)
+  DB_ARENA *arena;
+  char *ptr;
+  size_t aligned_size;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  arena = thread_p->query_arena;
+  if (arena != NULL && size > 0)
+    {
+      aligned_size = DB_ALIGN (size, MAX_ALIGNMENT);
+      if (arena->chunks != NULL && aligned_size <= (size_t) (arena->chunks->end - arena->free_ptr))
+	{
+	  ptr = arena->free_ptr;
+	  arena->free_ptr += aligned_size;
+	  arena->last_alloc = ptr;
+	  return ptr;
+	}
+
+      ptr = (char *) db_arena_alloc_chunk (arena, aligned_size);
+      if (ptr != NULL)
+	{
+	  return ptr;
+	}
+    }
+#endif /* SERVER_MODE */
+
+  return db_private_alloc (thread_p, size);
+}
+
+#if defined (SERVER_MODE)
+/*
+ * db_arena_alloc_chunk () - add a chunk to the arena and allocate in it
+ *   return: allocated memory pointer, or NULL if the arena is full
+ *   arena(in/out):
+ *   size(in): aligned size to allocate
+ *
+ * Note: chunks grow with the arena, from DB_ARENA_MIN_CHUNK_SIZE to DB_ARENA_MAX_CHUNK_SIZE. The free space left in
+ *       the current chunk is not used anymore.
+ */
+static void *
+db_arena_alloc_chunk (DB_ARENA * arena, size_t size)
+{
+  DB_ARENA_CHUNK *chunk;
+  size_t header_size, chunk_size;
+  char *ptr;
+
+  header_size = DB_ALIGN (sizeof (DB_ARENA_CHUNK), MAX_ALIGNMENT);
+  if (size > DB_ARENA_MAX_CHUNK_SIZE - header_size)
+    {
+      return NULL;
+    }
+
+  chunk_size = (arena->chunks == NULL) ? DB_ARENA_MIN_CHUNK_SIZE : MIN (arena->total_size, DB_ARENA_MAX_CHUNK_SIZE);
+  while (chunk_size - header_size < size)
+    {
+      chunk_size *= 2;
+    }
+
+  if (arena->total_size + chunk_size > DB_ARENA_MAX_SIZE)
+    {
+      return NULL;
+    }
+
+  chunk = (DB_ARENA_CHUNK *) malloc (chunk_size);
+  if (chunk == NULL)
+    {
+      return NULL;
+    }
+
+  chunk->next = arena->chunks;
+  chunk->end = (char *) chunk + chunk_size;
+  arena->chunks = chunk;
+  arena->total_size += chunk_size;
+
+  ptr = (char *) chunk + header_size;
+  arena->free_ptr = ptr + size;
+  arena->last_alloc = ptr;
+
+  return ptr;
+}
+
+/*
+ * db_arena_find_chunk () - find the arena chunk of memory
+ *   return: chunk, or NULL if ptr was not allocated in an arena of the thread
+ *   thread_p(in):
+ *   ptr(in): memory pointer
+ *   arena_p(out): arena of the chunk
+ */
+static DB_ARENA_CHUNK *
+db_arena_find_chunk (THREAD_ENTRY * thread_p, void *ptr, DB_ARENA ** arena_p)
+{
+  DB_ARENA *arena;
+  DB_ARENA_CHUNK *chunk;
+
+  for (arena = thread_p->query_arena; arena != NULL; arena = arena->outer)
+    {
+      for (chunk = arena->chunks; chunk != NULL; chunk = chunk->next)
+	{
+	  if ((char *) ptr > (char *) chunk && (char *) ptr < chunk->end)
+	    {
+	      *arena_p = arena;
+	      return chunk;
+	    }
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * db_arena_realloc () - reallocate memory of an arena
+ *   return: allocated memory pointer
+ *   thread_p(in):
+ *   arena(in/out): arena of ptr
+ *   ptr(in): memory pointer to reallocate
+ *   size(in): size to allocate
+ *   chunk(in): chunk of ptr
+ *
+ * Note: the last allocation is resized in place if the chunk has room for it.
+ */
+static void *
+db_arena_realloc (THREAD_ENTRY * thread_p, DB_ARENA * arena, char *ptr, size_t size, DB_ARENA_CHUNK * chunk)
+{
+  char *new_ptr;
+  size_t aligned_size;
+
+  aligned_size = DB_ALIGN (size, MAX_ALIGNMENT);
+  if (ptr == arena->last_alloc && aligned_size <= (size_t) (chunk->end - ptr))
+    {
+      arena->free_ptr = ptr + aligned_size;
+      return ptr;
+    }
+
+  new_ptr = (char *) db_arena_alloc (thread_p, size);
+  if (new_ptr != NULL)
+    {
+      /* the old size is not known, copy as much as the chunk has from ptr on */
+      memmove (new_ptr, ptr, MIN (size, (size_t) (chunk->end - ptr)));
+    }
+
+  return new_ptr;
+}
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 /*
  * os_malloc () -
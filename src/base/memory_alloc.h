@@ -236,6 +236,36 @@ extern void db_private_free_release (void *thrd, void *ptr, bool rc_track);
 extern void *db_private_realloc (void *thrd, void *ptr, size_t size);
 extern char *db_private_strdup (void *thrd, const char *s);
 
+/*
+ * Query arena: chunked bump pointer allocation of memory that is not needed after the query. Memory of the arena is
+ * given to db_private_free and db_private_realloc like private heap memory, but it is released at once when the
+ * arena ends. Arena memory is only reused when the last allocation is freed.
+ */
+#define DB_ARENA_MIN_CHUNK_SIZE		(16 * 1024)
+#define DB_ARENA_MAX_CHUNK_SIZE		(256 * 1024)
+#define DB_ARENA_MAX_SIZE		(4 * 1024 * 1024)	/* allocations above are made on the private heap */
+
+typedef struct db_arena_chunk DB_ARENA_CHUNK;
+struct db_arena_chunk
+{
+  DB_ARENA_CHUNK *next;		/* previous chunk */
+  char *end;			/* end of the chunk */
+};
+
+typedef struct db_arena DB_ARENA;
+struct db_arena
+{
+  DB_ARENA_CHUNK *chunks;	/* chunks of the arena, current chunk first */
+  char *free_ptr;		/* free space of the current chunk */
+  char *last_alloc;		/* last allocation, reused if it is freed */
+  size_t total_size;		/* size of all chunks */
+  DB_ARENA *outer;		/* arena of the outer query */
+};
+
+extern void db_arena_begin (THREAD_ENTRY * thread_p, DB_ARENA * arena);
+extern void db_arena_end (THREAD_ENTRY * thread_p, DB_ARENA * arena);
+extern void *db_arena_alloc (THREAD_ENTRY * thread_p, size_t size);
+
 /* for external package */
 extern void *db_private_alloc_external (void *thrd, size_t size);
 extern void db_private_free_external (void *thrd, void *ptr);
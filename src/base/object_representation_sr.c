@@ -201,9 +201,6 @@ orc_diskrep_from_record (THREAD_ENTRY * thread_p, RECDES * record)
   rep->n_fixed = 0;
   rep->n_variable = 0;
   rep->fixed_length = or_rep->fixed_length;
-#if 0				/* reserved for future use */
-  rep->repr_reserved_1 = 0;
-#endif
   rep->fixed = NULL;
   rep->variable = NULL;
 
@@ -276,6 +273,7 @@ orc_diskrep_from_record (THREAD_ENTRY * thread_p, RECDES * record)
       att->default_expr = or_att->default_value.default_expr;
       or_att->default_value.value = NULL;
       att->classoid = or_att->classoid;
+      att->histogram = NULL;
 
       /* initialize B+tree statisitcs information */
 
@@ -446,6 +444,11 @@ orc_free_diskrep (DISK_REPR * rep)
 		  free_and_init (rep->fixed[i].bt_stats);
 		  rep->fixed[i].bt_stats = NULL;
 		}
+
+	      if (rep->fixed[i].histogram != NULL)
+		{
+		  free_and_init (rep->fixed[i].histogram);
+		}
 	    }
 
 	  free_and_init (rep->fixed);
@@ -473,6 +476,11 @@ orc_free_diskrep (DISK_REPR * rep)
 		  free_and_init (rep->variable[i].bt_stats);
 		  rep->variable[i].bt_stats = NULL;
 		}
+
+	      if (rep->variable[i].histogram != NULL)
+		{
+		  free_and_init (rep->variable[i].histogram);
+		}
 	    }
 
 	  free_and_init (rep->variable);
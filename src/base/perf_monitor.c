@@ -359,6 +359,51 @@ static int rv;
     DIFF_METHOD (RES, NEW, OLD, vac_worker_process_log);		\
     DIFF_METHOD (RES, NEW, OLD, vac_worker_execute);			\
 									\
+    DIFF_METHOD (RES, NEW, OLD, pb_num_hash_lockfree_hits);		\
+    DIFF_METHOD (RES, NEW, OLD, pb_num_lru_mutex_waits);		\
+    DIFF_METHOD (RES, NEW, OLD, pb_num_lru_relocate_skips);		\
+    DIFF_METHOD (RES, NEW, OLD, pb_num_victim_lru_probes);		\
+									\
+    DIFF_METHOD (RES, NEW, OLD, log_gc_batch_1);			\
+    DIFF_METHOD (RES, NEW, OLD, log_gc_batch_2_3);			\
+    DIFF_METHOD (RES, NEW, OLD, log_gc_batch_4_7);			\
+    DIFF_METHOD (RES, NEW, OLD, log_gc_batch_8_15);			\
+    DIFF_METHOD (RES, NEW, OLD, log_gc_batch_16_31);			\
+    DIFF_METHOD (RES, NEW, OLD, log_gc_batch_32_over);			\
+    DIFF_METHOD (RES, NEW, OLD, log_gc_committers);			\
+    DIFF_METHOD (RES, NEW, OLD, log_commit_wait_under_100us);		\
+    DIFF_METHOD (RES, NEW, OLD, log_commit_wait_under_1ms);		\
+    DIFF_METHOD (RES, NEW, OLD, log_commit_wait_under_10ms);		\
+    DIFF_METHOD (RES, NEW, OLD, log_commit_wait_under_100ms);		\
+    DIFF_METHOD (RES, NEW, OLD, log_commit_wait_100ms_over);		\
+    DIFF_METHOD (RES, NEW, OLD, log_commit_wait_time);			\
+									\
+    DIFF_METHOD (RES, NEW, OLD, pb_numa_node0_hits);			\
+    DIFF_METHOD (RES, NEW, OLD, pb_numa_node0_misses);			\
+    DIFF_METHOD (RES, NEW, OLD, pb_numa_node1_hits);			\
+    DIFF_METHOD (RES, NEW, OLD, pb_numa_node1_misses);			\
+    DIFF_METHOD (RES, NEW, OLD, pb_numa_node2_hits);			\
+    DIFF_METHOD (RES, NEW, OLD, pb_numa_node2_misses);			\
+    DIFF_METHOD (RES, NEW, OLD, pb_numa_node3_hits);			\
+    DIFF_METHOD (RES, NEW, OLD, pb_numa_node3_misses);			\
+    DIFF_METHOD (RES, NEW, OLD, pb_numa_remote_fixes);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_csect_waits);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_csect_wait_time);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_rwlock_waits);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_rwlock_wait_time);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_rmutex_waits);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_rmutex_wait_time);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_latch_waits);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_latch_wait_time);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_lock_waits);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_lock_wait_time);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_wait_under_100us);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_wait_under_1ms);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_wait_under_10ms);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_wait_under_100ms);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_wait_under_1s);			\
+    DIFF_METHOD (RES, NEW, OLD, sync_wait_1s_over);			\
+									\
     DIFF_METHOD##_ARRAY (RES, NEW, OLD, pbx_fix_counters,		\
 			 PERF_PAGE_FIX_COUNTERS);			\
     DIFF_METHOD##_ARRAY (RES, NEW, OLD, pbx_promote_counters,		\
@@ -395,7 +440,6 @@ static void mnt_server_check_stats_threshold (int tran_index, MNT_SERVER_EXEC_ST
 
 static const char *perf_stat_module_name (const int module);
 static int perf_get_module_type (THREAD_ENTRY * thread_p);
-static const char *perf_stat_page_type_name (const int page_type);
 static const char *perf_stat_page_mode_name (const int page_mode);
 static const char *perf_stat_holder_latch_name (const int holder_latch);
 static const char *perf_stat_cond_type_name (const int cond_type);
@@ -1906,6 +1950,52 @@ static const char *mnt_Stats_name[MNT_SERVER_EXEC_STATS_COUNT] = {
   "Time_vacuum_worker_process_log",
   "Time_vacuum_worker_execute",
 
+  "Num_data_page_hash_lockfree_hits",
+  "Num_data_page_lru_mutex_waits",
+  "Num_data_page_lru_relocate_skips",
+  "Num_data_page_victim_lru_probes",
+
+  "Num_log_gc_batch_1",
+  "Num_log_gc_batch_2_3",
+  "Num_log_gc_batch_4_7",
+  "Num_log_gc_batch_8_15",
+  "Num_log_gc_batch_16_31",
+  "Num_log_gc_batch_32_over",
+  "Num_log_gc_committers",
+  "Num_log_commit_wait_under_100us",
+  "Num_log_commit_wait_under_1ms",
+  "Num_log_commit_wait_under_10ms",
+  "Num_log_commit_wait_under_100ms",
+  "Num_log_commit_wait_100ms_over",
+  "Time_log_commit_wait",
+
+  "Num_data_page_node0_hits",
+  "Num_data_page_node0_misses",
+  "Num_data_page_node1_hits",
+  "Num_data_page_node1_misses",
+  "Num_data_page_node2_hits",
+  "Num_data_page_node2_misses",
+  "Num_data_page_node3_hits",
+  "Num_data_page_node3_misses",
+  "Num_data_page_remote_node_fixes",
+
+  "Num_sync_csect_waits",
+  "Time_sync_csect_wait",
+  "Num_sync_rwlock_waits",
+  "Time_sync_rwlock_wait",
+  "Num_sync_rmutex_waits",
+  "Time_sync_rmutex_wait",
+  "Num_sync_page_latch_waits",
+  "Time_sync_page_latch_wait",
+  "Num_sync_lock_waits",
+  "Time_sync_lock_wait",
+  "Num_sync_wait_under_100us",
+  "Num_sync_wait_under_1ms",
+  "Num_sync_wait_under_10ms",
+  "Num_sync_wait_under_100ms",
+  "Num_sync_wait_under_1s",
+  "Num_sync_wait_1s_over",
+
   /* computed statistics */
   "Data_page_buffer_hit_ratio",
   "Log_page_buffer_hit_ratio",
@@ -2488,6 +2578,129 @@ mnt_x_pb_num_hash_anchor_waits (THREAD_ENTRY * thread_p, UINT64 time_amount)
     }
 }
 
+/*
+ * mnt_x_pb_hash_lockfree_hits - Increase counter of pages found without the hash anchor mutex
+ *   return: none
+ */
+void
+mnt_x_pb_hash_lockfree_hits (THREAD_ENTRY * thread_p)
+{
+  MNT_SERVER_EXEC_STATS *stats;
+
+  stats = mnt_server_get_stats (thread_p);
+  if (stats != NULL)
+    {
+      ADD_STATS (stats, pb_num_hash_lockfree_hits, 1);
+    }
+}
+
+/*
+ * mnt_x_pb_lru_mutex_waits - Increase counter of waits for an LRU list mutex
+ *   return: none
+ */
+void
+mnt_x_pb_lru_mutex_waits (THREAD_ENTRY * thread_p)
+{
+  MNT_SERVER_EXEC_STATS *stats;
+
+  stats = mnt_server_get_stats (thread_p);
+  if (stats != NULL)
+    {
+      ADD_STATS (stats, pb_num_lru_mutex_waits, 1);
+    }
+}
+
+/*
+ * mnt_x_pb_lru_relocate_skips - Increase counter of LRU relocations skipped under contention
+ *   return: none
+ */
+void
+mnt_x_pb_lru_relocate_skips (THREAD_ENTRY * thread_p)
+{
+  MNT_SERVER_EXEC_STATS *stats;
+
+  stats = mnt_server_get_stats (thread_p);
+  if (stats != NULL)
+    {
+      ADD_STATS (stats, pb_num_lru_relocate_skips, 1);
+    }
+}
+
+/*
+ * mnt_x_pb_victim_lru_probes - Increase counter of victims found in a neighbor LRU list
+ *   return: none
+ */
+void
+mnt_x_pb_victim_lru_probes (THREAD_ENTRY * thread_p)
+{
+  MNT_SERVER_EXEC_STATS *stats;
+
+  stats = mnt_server_get_stats (thread_p);
+  if (stats != NULL)
+    {
+      ADD_STATS (stats, pb_num_victim_lru_probes, 1);
+    }
+}
+
+/*
+ * mnt_x_pb_numa_fix - Count a page fix by the NUMA node of its buffer
+ *   return: none
+ *
+ *   node(in): node of the buffer
+ *   is_hit(in): true if the page was found in the buffer pool
+ *   is_remote(in): true if the fixing thread runs on another node
+ */
+void
+mnt_x_pb_numa_fix (THREAD_ENTRY * thread_p, int node, bool is_hit, bool is_remote)
+{
+  MNT_SERVER_EXEC_STATS *stats;
+
+  stats = mnt_server_get_stats (thread_p);
+  if (stats != NULL)
+    {
+      if (is_hit)
+	{
+	  switch (node)
+	    {
+	    case 0:
+	      ADD_STATS (stats, pb_numa_node0_hits, 1);
+	      break;
+	    case 1:
+	      ADD_STATS (stats, pb_numa_node1_hits, 1);
+	      break;
+	    case 2:
+	      ADD_STATS (stats, pb_numa_node2_hits, 1);
+	      break;
+	    default:
+	      ADD_STATS (stats, pb_numa_node3_hits, 1);
+	      break;
+	    }
+	}
+      else
+	{
+	  switch (node)
+	    {
+	    case 0:
+	      ADD_STATS (stats, pb_numa_node0_misses, 1);
+	      break;
+	    case 1:
+	      ADD_STATS (stats, pb_numa_node1_misses, 1);
+	      break;
+	    case 2:
+	      ADD_STATS (stats, pb_numa_node2_misses, 1);
+	      break;
+	    default:
+	      ADD_STATS (stats, pb_numa_node3_misses, 1);
+	      break;
+	    }
+	}
+      if (is_remote)
+	{
+	  ADD_STATS (stats, pb_numa_remote_fixes, 1);
+	}
+    }
+}
+
 /*
  * mnt_x_prior_lsa_list_size -
  *   return: none
@@ -2758,6 +2971,158 @@ mnt_x_log_replacements (THREAD_ENTRY * thread_p)
     }
 }
 
+/*
+ * mnt_x_log_group_commit_flush - Count a log flush in the histogram of the
+ *                                number of committers it served
+ *   return: none
+ *
+ *   num_committers(in): committers that waited for the flush
+ */
+void
+mnt_x_log_group_commit_flush (THREAD_ENTRY * thread_p, int num_committers)
+{
+  MNT_SERVER_EXEC_STATS *stats;
+
+  stats = mnt_server_get_stats (thread_p);
+  if (stats != NULL)
+    {
+      if (num_committers <= 1)
+	{
+	  ADD_STATS (stats, log_gc_batch_1, 1);
+	}
+      else if (num_committers < 4)
+	{
+	  ADD_STATS (stats, log_gc_batch_2_3, 1);
+	}
+      else if (num_committers < 8)
+	{
+	  ADD_STATS (stats, log_gc_batch_4_7, 1);
+	}
+      else if (num_committers < 16)
+	{
+	  ADD_STATS (stats, log_gc_batch_8_15, 1);
+	}
+      else if (num_committers < 32)
+	{
+	  ADD_STATS (stats, log_gc_batch_16_31, 1);
+	}
+      else
+	{
+	  ADD_STATS (stats, log_gc_batch_32_over, 1);
+	}
+      ADD_STATS (stats, log_gc_committers, num_committers);
+    }
+}
+
+/*
+ * mnt_x_log_commit_wait - Count a commit in the histogram of the time it
+ *                         waited for its log records to be flushed
+ *   return: none
+ *
+ *   time_usec(in): wait time in microseconds
+ */
+void
+mnt_x_log_commit_wait (THREAD_ENTRY * thread_p, UINT64 time_usec)
+{
+  MNT_SERVER_EXEC_STATS *stats;
+
+  stats = mnt_server_get_stats (thread_p);
+  if (stats != NULL)
+    {
+      if (time_usec < 100)
+	{
+	  ADD_STATS (stats, log_commit_wait_under_100us, 1);
+	}
+      else if (time_usec < 1000)
+	{
+	  ADD_STATS (stats, log_commit_wait_under_1ms, 1);
+	}
+      else if (time_usec < 10000)
+	{
+	  ADD_STATS (stats, log_commit_wait_under_10ms, 1);
+	}
+      else if (time_usec < 100000)
+	{
+	  ADD_STATS (stats, log_commit_wait_under_100ms, 1);
+	}
+      else
+	{
+	  ADD_STATS (stats, log_commit_wait_100ms_over, 1);
+	}
+      ADD_STATS (stats, log_commit_wait_time, time_usec);
+    }
+}
+
+/*
+ * mnt_x_sync_wait - Count a blocking wait on a synchronization primitive
+ *                   by wait class and in the histogram of wait times
+ *   return: none
+ *
+ *   wait_class(in): SYNC_WAIT_CLASS of the primitive
+ *   wait_usec(in): wait time in microseconds
+ */
+void
+mnt_x_sync_wait (THREAD_ENTRY * thread_p, int wait_class, UINT64 wait_usec)
+{
+  MNT_SERVER_EXEC_STATS *stats;
+
+  stats = mnt_server_get_stats (thread_p);
+  if (stats != NULL)
+    {
+      switch (wait_class)
+	{
+	case SYNC_WAIT_CSECT:
+	  ADD_STATS (stats, sync_csect_waits, 1);
+	  ADD_STATS (stats, sync_csect_wait_time, wait_usec);
+	  break;
+	case SYNC_WAIT_RWLOCK:
+	  ADD_STATS (stats, sync_rwlock_waits, 1);
+	  ADD_STATS (stats, sync_rwlock_wait_time, wait_usec);
+	  break;
+	case SYNC_WAIT_RMUTEX:
+	  ADD_STATS (stats, sync_rmutex_waits, 1);
+	  ADD_STATS (stats, sync_rmutex_wait_time, wait_usec);
+	  break;
+	case SYNC_WAIT_PGBUF_LATCH:
+	  ADD_STATS (stats, sync_latch_waits, 1);
+	  ADD_STATS (stats, sync_latch_wait_time, wait_usec);
+	  break;
+	case SYNC_WAIT_LOCK:
+	  ADD_STATS (stats, sync_lock_waits, 1);
+	  ADD_STATS (stats, sync_lock_wait_time, wait_usec);
+	  break;
+	default:
+	  assert (false);
+	  break;
+	}
+
+      if (wait_usec < 100)
+	{
+	  ADD_STATS (stats, sync_wait_under_100us, 1);
+	}
+      else if (wait_usec < 1000)
+	{
+	  ADD_STATS (stats, sync_wait_under_1ms, 1);
+	}
+      else if (wait_usec < 10000)
+	{
+	  ADD_STATS (stats, sync_wait_under_10ms, 1);
+	}
+      else if (wait_usec < 100000)
+	{
+	  ADD_STATS (stats, sync_wait_under_100ms, 1);
+	}
+      else if (wait_usec < 1000000)
+	{
+	  ADD_STATS (stats, sync_wait_under_1s, 1);
+	}
+      else
+	{
+	  ADD_STATS (stats, sync_wait_1s_over, 1);
+	}
+    }
+}
+
 
 /*
  * mnt_x_lk_acquired_on_pages - Increase lk_num_acquired_on_pages counter
@@ -5565,7 +5930,7 @@ perf_get_module_type (THREAD_ENTRY * thread_p)
 /*
  * perf_stat_page_type_name () -
  */
-static const char *
+const char *
 perf_stat_page_type_name (const int page_type)
 {
   switch (page_type)
@@ -590,6 +590,56 @@ struct mnt_server_exec_stats
   UINT64 vac_worker_process_log;
   UINT64 vac_worker_execute;
 
+  /* Page buffer contention counters */
+  UINT64 pb_num_hash_lockfree_hits;
+  UINT64 pb_num_lru_mutex_waits;
+  UINT64 pb_num_lru_relocate_skips;
+  UINT64 pb_num_victim_lru_probes;
+
+  /* Group commit: log flushes by number of committers served, commit waits by duration */
+  UINT64 log_gc_batch_1;
+  UINT64 log_gc_batch_2_3;
+  UINT64 log_gc_batch_4_7;
+  UINT64 log_gc_batch_8_15;
+  UINT64 log_gc_batch_16_31;
+  UINT64 log_gc_batch_32_over;
+  UINT64 log_gc_committers;
+  UINT64 log_commit_wait_under_100us;
+  UINT64 log_commit_wait_under_1ms;
+  UINT64 log_commit_wait_under_10ms;
+  UINT64 log_commit_wait_under_100ms;
+  UINT64 log_commit_wait_100ms_over;
+  UINT64 log_commit_wait_time;
+
+  /* Page buffer NUMA: fixes by node of the buffer (nodes above 3 are counted as node 3), fixes from other nodes */
+  UINT64 pb_numa_node0_hits;
+  UINT64 pb_numa_node0_misses;
+  UINT64 pb_numa_node1_hits;
+  UINT64 pb_numa_node1_misses;
+  UINT64 pb_numa_node2_hits;
+  UINT64 pb_numa_node2_misses;
+  UINT64 pb_numa_node3_hits;
+  UINT64 pb_numa_node3_misses;
+  UINT64 pb_numa_remote_fixes;
+
+  /* Blocking waits on synchronization primitives by wait class (time in usecs), and by wait time */
+  UINT64 sync_csect_waits;
+  UINT64 sync_csect_wait_time;
+  UINT64 sync_rwlock_waits;
+  UINT64 sync_rwlock_wait_time;
+  UINT64 sync_rmutex_waits;
+  UINT64 sync_rmutex_wait_time;
+  UINT64 sync_latch_waits;
+  UINT64 sync_latch_wait_time;
+  UINT64 sync_lock_waits;
+  UINT64 sync_lock_wait_time;
+  UINT64 sync_wait_under_100us;
+  UINT64 sync_wait_under_1ms;
+  UINT64 sync_wait_under_10ms;
+  UINT64 sync_wait_under_100ms;
+  UINT64 sync_wait_under_1s;
+  UINT64 sync_wait_1s_over;
+
   /* Other statistics (change MNT_COUNT_OF_SERVER_EXEC_CALC_STATS) */
   /* ((pb_num_fetches - pb_num_ioreads) x 100 / pb_num_fetches) x 100 */
   UINT64 pb_hit_ratio;
@@ -639,7 +689,7 @@ struct mnt_server_exec_stats
 };
 
 /* number of fields of MNT_SERVER_EXEC_STATS structure (includes computed stats) */
-#define MNT_COUNT_OF_SERVER_EXEC_SINGLE_STATS 203
+#define MNT_COUNT_OF_SERVER_EXEC_SINGLE_STATS 245
 
 /* number of array stats of MNT_SERVER_EXEC_STATS structure */
 #define MNT_COUNT_OF_SERVER_EXEC_ARRAY_STATS 14
@@ -709,6 +759,8 @@ extern void mnt_get_current_times (time_t * cpu_usr_time, time_t * cpu_sys_time,
 extern int mnt_calc_diff_stats (MNT_SERVER_EXEC_STATS * stats_diff, MNT_SERVER_EXEC_STATS * new_stats,
 				MNT_SERVER_EXEC_STATS * old_stats);
 
+extern const char *perf_stat_page_type_name (const int page_type);
+
 #if defined(CS_MODE) || defined(SA_MODE)
 /* Client execution statistic structure */
 typedef struct mnt_client_stat_info MNT_CLIENT_STAT_INFO;
@@ -936,6 +988,16 @@ extern int mnt_Num_tran_exec_stats;
 #define mnt_pb_num_hash_anchor_waits(thread_p, time_amount) \
   if (mnt_Num_tran_exec_stats > 0) mnt_x_pb_num_hash_anchor_waits(thread_p, \
 								  time_amount)
+#define mnt_pb_hash_lockfree_hits(thread_p) \
+  if (mnt_Num_tran_exec_stats > 0) mnt_x_pb_hash_lockfree_hits(thread_p)
+#define mnt_pb_lru_mutex_waits(thread_p) \
+  if (mnt_Num_tran_exec_stats > 0) mnt_x_pb_lru_mutex_waits(thread_p)
+#define mnt_pb_lru_relocate_skips(thread_p) \
+  if (mnt_Num_tran_exec_stats > 0) mnt_x_pb_lru_relocate_skips(thread_p)
+#define mnt_pb_victim_lru_probes(thread_p) \
+  if (mnt_Num_tran_exec_stats > 0) mnt_x_pb_victim_lru_probes(thread_p)
+#define mnt_pb_numa_fix(thread_p, node, is_hit, is_remote) \
+  if (mnt_Num_tran_exec_stats > 0) mnt_x_pb_numa_fix(thread_p, node, is_hit, is_remote)
 
 /*
  * Statistics at log level
@@ -960,6 +1022,17 @@ extern int mnt_Num_tran_exec_stats;
   if (mnt_Num_tran_exec_stats > 0) mnt_x_log_wals(thread_p)
 #define mnt_log_replacements(thread_p) \
   if (mnt_Num_tran_exec_stats > 0) mnt_x_log_replacements(thread_p)
+#define mnt_log_group_commit_flush(thread_p, num_committers) \
+  if (mnt_Num_tran_exec_stats > 0) mnt_x_log_group_commit_flush(thread_p, \
+								 num_committers)
+#define mnt_log_commit_wait(thread_p, time_usec) \
+  if (mnt_Num_tran_exec_stats > 0) mnt_x_log_commit_wait(thread_p, time_usec)
+
+/*
+ * Statistics at synchronization level
+ */
+#define mnt_sync_wait(thread_p, wait_class, wait_usec) \
+  if (mnt_Num_tran_exec_stats > 0) mnt_x_sync_wait(thread_p, wait_class, wait_usec)
 
 /*
  * Statistics at lock level
@@ -1382,6 +1455,11 @@ extern void mnt_x_pb_iowrites (THREAD_ENTRY * thread_p, int num_pages);
 extern void mnt_x_pb_victims (THREAD_ENTRY * thread_p);
 extern void mnt_x_pb_replacements (THREAD_ENTRY * thread_p);
 extern void mnt_x_pb_num_hash_anchor_waits (THREAD_ENTRY * thread_p, UINT64 time_amount);
+extern void mnt_x_pb_hash_lockfree_hits (THREAD_ENTRY * thread_p);
+extern void mnt_x_pb_lru_mutex_waits (THREAD_ENTRY * thread_p);
+extern void mnt_x_pb_lru_relocate_skips (THREAD_ENTRY * thread_p);
+extern void mnt_x_pb_victim_lru_probes (THREAD_ENTRY * thread_p);
+extern void mnt_x_pb_numa_fix (THREAD_ENTRY * thread_p, int node, bool is_hit, bool is_remote);
 extern void mnt_x_log_fetches (THREAD_ENTRY * thread_p);
 extern void mnt_x_log_fetch_ioreads (THREAD_ENTRY * thread_p);
 extern void mnt_x_log_ioreads (THREAD_ENTRY * thread_p);
@@ -1392,6 +1470,9 @@ extern void mnt_x_log_start_checkpoints (THREAD_ENTRY * thread_p);
 extern void mnt_x_log_end_checkpoints (THREAD_ENTRY * thread_p);
 extern void mnt_x_log_wals (THREAD_ENTRY * thread_p);
 extern void mnt_x_log_replacements (THREAD_ENTRY * thread_p);
+extern void mnt_x_log_group_commit_flush (THREAD_ENTRY * thread_p, int num_committers);
+extern void mnt_x_log_commit_wait (THREAD_ENTRY * thread_p, UINT64 time_usec);
+extern void mnt_x_sync_wait (THREAD_ENTRY * thread_p, int wait_class, UINT64 wait_usec);
 extern void mnt_x_lk_acquired_on_pages (THREAD_ENTRY * thread_p);
 extern void mnt_x_lk_acquired_on_objects (THREAD_ENTRY * thread_p);
 extern void mnt_x_lk_converted_on_pages (THREAD_ENTRY * thread_p);
@@ -1588,6 +1669,11 @@ extern void mnt_x_vac_worker_execute_time (THREAD_ENTRY * thread_p, UINT64 amoun
 #define mnt_pb_victims(thread_p)
 #define mnt_pb_replacements(thread_p)
 #define mnt_pb_num_hash_anchor_waits(thread_p, time_amount)
+#define mnt_pb_hash_lockfree_hits(thread_p)
+#define mnt_pb_lru_mutex_waits(thread_p)
+#define mnt_pb_lru_relocate_skips(thread_p)
+#define mnt_pb_victim_lru_probes(thread_p)
+#define mnt_pb_numa_fix(thread_p, node, is_hit, is_remote)
 
 #define mnt_log_fetches(thread_p)
 #define mnt_log_fetch_ioreads(thread_p)
@@ -1599,6 +1685,10 @@ extern void mnt_x_vac_worker_execute_time (THREAD_ENTRY * thread_p, UINT64 amoun
 #define mnt_log_end_checkpoints(thread_p)
 #define mnt_log_wals(thread_p)
 #define mnt_log_replacements(thread_p)
+#define mnt_log_group_commit_flush(thread_p, num_committers)
+#define mnt_log_commit_wait(thread_p, time_usec)
+
+#define mnt_sync_wait(thread_p, wait_class, wait_usec)
 
 #define mnt_lk_acquired_on_pages(thread_p)
 #define mnt_lk_acquired_on_objects(thread_p)
@@ -60,6 +60,12 @@
 #include <string.h>
 #endif
 
+#if defined (LINUX)
+#include <sched.h>
+#include <pthread.h>
+#include <sys/syscall.h>
+#endif
+
 #if defined(AIX) && !defined(DONT_HOOK_MALLOC)
 #undef malloc
 void *
@@ -1384,6 +1390,261 @@ os_send_signal (const int sig_no)
 #endif /* WINDOWS */
 }
 
+/*
+ * NUMA topology
+ */
+#if defined (LINUX)
+#define OS_NUMA_MAX_NODES 64
+#define OS_NUMA_MAX_CPUS CPU_SETSIZE
+#define OS_NUMA_MPOL_BIND 2	/* MPOL_BIND of numaif.h */
+#define OS_NUMA_MPOL_INTERLEAVE 3	/* MPOL_INTERLEAVE of numaif.h */
+#define OS_NUMA_BITS_PER_LONG (8 * (int) sizeof (unsigned long))
+
+static int os_Numa_num_nodes = 0;	/* 0 until topology is read */
+static short os_Numa_cpu_node[OS_NUMA_MAX_CPUS];	/* node of each cpu, as index in os_Numa_node_ids */
+static short os_Numa_node_ids[OS_NUMA_MAX_NODES];	/* kernel id of each node, which may be sparse */
+
+static int os_numa_read_id_list (const char *path, char *is_listed, int max_id);
+static void os_numa_read_topology (void);
+
+/*
+ * os_numa_read_id_list() - read a list of ids like "0-7,16-23" from a sysfs file
+ *   return: 0 on success, otherwise -1
+ *   path(in): sysfs file
+ *   is_listed(out): is_listed[id] is set to 1 for each id of the list, ids from max_id on are ignored
+ *   max_id(in): size of is_listed
+ */
+static int
+os_numa_read_id_list (const char *path, char *is_listed, int max_id)
+{
+  char list[4096];
+  char *p, *end;
+  FILE *fp;
+  int id, last_id;
+
+  memset (is_listed, 0, max_id);
+
+  fp = fopen (path, "r");
+  if (fp == NULL)
+    {
+      return -1;
+    }
+  if (fgets (list, sizeof (list), fp) == NULL)
+    {
+      list[0] = '\0';
+    }
+  fclose (fp);
+
+  p = list;
+  while (*p != '\0' && *p != '\n')
+    {
+      id = (int) strtol (p, &end, 10);
+      if (end == p || id < 0)
+	{
+	  break;
+	}
+      last_id = id;
+      if (*end == '-')
+	{
+	  p = end + 1;
+	  last_id = (int) strtol (p, &end, 10);
+	}
+      for (; id <= last_id && id < max_id; id++)
+	{
+	  is_listed[id] = 1;
+	}
+      p = (*end == ',') ? end + 1 : end;
+    }
+
+  return 0;
+}
+
+/*
+ * os_numa_read_topology() - read the nodes of cpus from sysfs
+ *   return: none
+ *
+ * Note: Without sysfs node information, the machine is considered as a single node.
+ *       Node ids of the kernel need not be contiguous (offline or hot-plugged nodes), so the online nodes are
+ *       numbered from 0 in the order of their ids; os_Numa_node_ids maps them back.
+ */
+static void
+os_numa_read_topology (void)
+{
+  char path[PATH_MAX];
+  char is_online[OS_NUMA_MAX_NODES];
+  char is_node_cpu[OS_NUMA_MAX_CPUS];
+  int node_id, node, cpu;
+
+  for (cpu = 0; cpu < OS_NUMA_MAX_CPUS; cpu++)
+    {
+      os_Numa_cpu_node[cpu] = 0;
+    }
+  os_Numa_node_ids[0] = 0;
+
+  if (os_numa_read_id_list ("/sys/devices/system/node/online", is_online, OS_NUMA_MAX_NODES) != 0)
+    {
+      os_Numa_num_nodes = 1;
+      return;
+    }
+
+  node = 0;
+  for (node_id = 0; node_id < OS_NUMA_MAX_NODES; node_id++)
+    {
+      if (!is_online[node_id])
+	{
+	  continue;
+	}
+
+      snprintf (path, sizeof (path), "/sys/devices/system/node/node%d/cpulist", node_id);
+      if (os_numa_read_id_list (path, is_node_cpu, OS_NUMA_MAX_CPUS) != 0)
+	{
+	  continue;
+	}
+
+      for (cpu = 0; cpu < OS_NUMA_MAX_CPUS; cpu++)
+	{
+	  if (is_node_cpu[cpu])
+	    {
+	      os_Numa_cpu_node[cpu] = (short) node;
+	    }
+	}
+      os_Numa_node_ids[node++] = (short) node_id;
+    }
+
+  os_Numa_num_nodes = MAX (node, 1);
+}
+#endif /* LINUX */
+
+/*
+ * os_numa_get_node_count() - get the number of NUMA nodes of the machine
+ *   return: number of nodes (1 if the machine is not NUMA or it is unknown)
+ */
+int
+os_numa_get_node_count (void)
+{
+#if defined (LINUX)
+  if (os_Numa_num_nodes == 0)
+    {
+      os_numa_read_topology ();
+    }
+  return os_Numa_num_nodes;
+#else /* LINUX */
+  return 1;
+#endif /* LINUX */
+}
+
+/*
+ * os_numa_get_current_node() - get the NUMA node of the cpu running the calling thread
+ *   return: node, or -1 if unknown
+ */
+int
+os_numa_get_current_node (void)
+{
+#if defined (LINUX)
+  int cpu;
+
+  if (os_numa_get_node_count () <= 1)
+    {
+      return 0;
+    }
+  cpu = sched_getcpu ();
+  if (cpu < 0 || cpu >= OS_NUMA_MAX_CPUS)
+    {
+      return -1;
+    }
+  return os_Numa_cpu_node[cpu];
+#else /* LINUX */
+  return 0;
+#endif /* LINUX */
+}
+
+/*
+ * os_numa_bind_current_thread() - run the calling thread only on the cpus of a NUMA node
+ *   return: 0 on success, otherwise -1
+ *   node(in): node
+ */
+int
+os_numa_bind_current_thread (int node)
+{
+#if defined (LINUX)
+  cpu_set_t cpu_set;
+  int cpu;
+
+  if (node < 0 || node >= os_numa_get_node_count ())
+    {
+      return -1;
+    }
+
+  CPU_ZERO (&cpu_set);
+  for (cpu = 0; cpu < OS_NUMA_MAX_CPUS; cpu++)
+    {
+      if (os_Numa_cpu_node[cpu] == node)
+	{
+	  CPU_SET (cpu, &cpu_set);
+	}
+    }
+  if (pthread_setaffinity_np (pthread_self (), sizeof (cpu_set), &cpu_set) != 0)
+    {
+      return -1;
+    }
+  return 0;
+#else /* LINUX */
+  return -1;
+#endif /* LINUX */
+}
+
+/*
+ * os_numa_bind_memory() - place the pages of a memory area on a NUMA node
+ *   return: 0 on success, otherwise -1
+ *   addr(in): start of memory area
+ *   size(in): size of memory area
+ *   node(in): node, or -1 to interleave the pages over all nodes
+ *
+ * Note: Only whole OS pages inside the area are bound, and the policy applies to pages not touched yet.
+ */
+int
+os_numa_bind_memory (void *addr, size_t size, int node)
+{
+#if defined (LINUX)
+  unsigned long node_mask[OS_NUMA_MAX_NODES / OS_NUMA_BITS_PER_LONG];
+  UINTPTR page_size, start, end;
+  int num_nodes, node_id, i;
+
+  num_nodes = os_numa_get_node_count ();
+  if (num_nodes <= 1 || node >= num_nodes)
+    {
+      return -1;
+    }
+
+  page_size = (UINTPTR) sysconf (_SC_PAGESIZE);
+  start = ((UINTPTR) addr + page_size - 1) & ~(page_size - 1);
+  end = ((UINTPTR) addr + size) & ~(page_size - 1);
+  if (start >= end)
+    {
+      return 0;
+    }
+
+  memset (node_mask, 0, sizeof (node_mask));
+  for (i = 0; i < num_nodes; i++)
+    {
+      if (node < 0 || i == node)
+	{
+	  node_id = os_Numa_node_ids[i];
+	  node_mask[node_id / OS_NUMA_BITS_PER_LONG] |= 1UL << (node_id % OS_NUMA_BITS_PER_LONG);
+	}
+    }
+
+  if (syscall (SYS_mbind, (void *) start, (unsigned long) (end - start),
+	       node < 0 ? OS_NUMA_MPOL_INTERLEAVE : OS_NUMA_MPOL_BIND, node_mask, OS_NUMA_MAX_NODES + 1, 0) != 0)
+    {
+      return -1;
+    }
+  return 0;
+#else /* LINUX */
+  return -1;
+#endif /* LINUX */
+}
+
 #if defined(WINDOWS)
 #if !defined(HAVE_STRSEP)
 char *
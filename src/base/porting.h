@@ -480,6 +480,11 @@ extern "C"
   extern SIGNAL_HANDLER_FUNCTION os_set_signal_handler (const int sig_no, SIGNAL_HANDLER_FUNCTION sig_handler);
   extern void os_send_signal (const int sig_no);
 
+  extern int os_numa_get_node_count (void);
+  extern int os_numa_get_current_node (void);
+  extern int os_numa_bind_current_thread (int node);
+  extern int os_numa_bind_memory (void *addr, size_t size, int node);
+
 #if defined (WINDOWS)
 #define atoll(a)	_atoi64((a))
 #define llabs(a)	_abs64((a))
@@ -616,6 +616,22 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_LOG_UNIQUE_STATS "log_unique_stats"
 
+#define PRM_NAME_OPTIMIZER_ENABLE_HASH_JOIN "optimizer_enable_hash_join"
+#define PRM_NAME_MAX_HASH_JOIN_SIZE "max_hash_join_size"
+#define PRM_NAME_CONNECTION_DISPATCHER_THREADS "connection_dispatcher_threads"
+#define PRM_NAME_PARALLEL_HEAP_SCAN_THREADS "parallel_heap_scan_threads"
+#define PRM_NAME_PARALLEL_HEAP_SCAN_MIN_PAGES "parallel_heap_scan_min_pages"
+#define PRM_NAME_SORT_PARALLEL_THREADS "sort_parallel_threads"
+#define PRM_NAME_INDEX_BUILD_PARALLEL_THREADS "index_build_parallel_threads"
+#define PRM_NAME_LOG_GROUP_COMMIT_ADAPTIVE "group_commit_adaptive"
+#define PRM_NAME_LOG_COMPRESS_METHOD "log_compress_method"
+#define PRM_NAME_LOG_REDO_PARALLEL_THREADS "log_redo_parallel_threads"
+#define PRM_NAME_SCAN_BATCH_SIZE "scan_batch_size"
+#define PRM_NAME_LIST_QUERY_CACHE_MIN_COST "query_cache_min_cost_per_page"
+#define PRM_NAME_BT_ADAPTIVE_HASH_INDEX_ENTRIES "btree_adaptive_hash_index_entries"
+#define PRM_NAME_PB_NUMA_AWARE "data_buffer_numa_aware"
+#define PRM_NAME_HA_APPLYLOGDB_PARALLEL_WORKERS "ha_applylogdb_parallel_workers"
+
 #define PRM_VALUE_DEFAULT "DEFAULT"
 
 /*
@@ -2010,6 +2026,88 @@ bool PRM_LOG_UNIQUE_STATS = false;
 static bool prm_log_unique_stats_default = false;
 static unsigned int prm_log_unique_stats_flag = 0;
 
+bool PRM_OPTIMIZER_ENABLE_HASH_JOIN = false;
+static bool prm_optimizer_enable_hash_join_default = false;
+static unsigned int prm_optimizer_enable_hash_join_flag = 0;
+
+UINT64 PRM_MAX_HASH_JOIN_SIZE = 8 * 1024 * 1024;	/* 8 MB */
+static UINT64 prm_max_hash_join_size_default = 8 * 1024 * 1024;	/* 8 MB */
+static UINT64 prm_max_hash_join_size_lower = 64 * 1024;	/* 64 KB */
+static UINT64 prm_max_hash_join_size_upper = 1024 * 1024 * 1024;	/* 1 GB */
+static unsigned int prm_max_hash_join_size_flag = 0;
+
+int PRM_CONNECTION_DISPATCHER_THREADS = 0;
+static int prm_connection_dispatcher_threads_default = 0;
+static int prm_connection_dispatcher_threads_upper = 64;
+static int prm_connection_dispatcher_threads_lower = 0;
+static unsigned int prm_connection_dispatcher_threads_flag = 0;
+
+int PRM_PARALLEL_HEAP_SCAN_THREADS = 0;
+static int prm_parallel_heap_scan_threads_default = 0;
+static int prm_parallel_heap_scan_threads_upper = 32;
+static int prm_parallel_heap_scan_threads_lower = 0;
+static unsigned int prm_parallel_heap_scan_threads_flag = 0;
+
+int PRM_PARALLEL_HEAP_SCAN_MIN_PAGES = 10000;
+static int prm_parallel_heap_scan_min_pages_default = 10000;
+static int prm_parallel_heap_scan_min_pages_lower = 1;
+static unsigned int prm_parallel_heap_scan_min_pages_flag = 0;
+
+int PRM_SORT_PARALLEL_THREADS = 0;
+static int prm_sort_parallel_threads_default = 0;
+static int prm_sort_parallel_threads_upper = 32;
+static int prm_sort_parallel_threads_lower = 0;
+static unsigned int prm_sort_parallel_threads_flag = 0;
+
+int PRM_INDEX_BUILD_PARALLEL_THREADS = 0;
+static int prm_index_build_parallel_threads_default = 0;
+static int prm_index_build_parallel_threads_upper = 32;
+static int prm_index_build_parallel_threads_lower = 0;
+static unsigned int prm_index_build_parallel_threads_flag = 0;
+
+bool PRM_LOG_GROUP_COMMIT_ADAPTIVE = true;
+static bool prm_log_group_commit_adaptive_default = true;
+static unsigned int prm_log_group_commit_adaptive_flag = 0;
+
+int PRM_LOG_COMPRESS_METHOD = LOG_COMPRESS_LZO1X_1;
+static int prm_log_compress_method_default = LOG_COMPRESS_LZO1X_1;
+static int prm_log_compress_method_upper = LOG_COMPRESS_LZO1X_999;
+static int prm_log_compress_method_lower = LOG_COMPRESS_LZO1X_1;
+static unsigned int prm_log_compress_method_flag = 0;
+
+int PRM_LOG_REDO_PARALLEL_THREADS = 0;
+static int prm_log_redo_parallel_threads_default = 0;
+static int prm_log_redo_parallel_threads_upper = 32;
+static int prm_log_redo_parallel_threads_lower = 0;
+static unsigned int prm_log_redo_parallel_threads_flag = 0;
+
+int PRM_SCAN_BATCH_SIZE = 256;
+static int prm_scan_batch_size_default = 256;
+static int prm_scan_batch_size_upper = 4096;
+static int prm_scan_batch_size_lower = 0;
+static unsigned int prm_scan_batch_size_flag = 0;
+
+int PRM_LIST_QUERY_CACHE_MIN_COST = 100;
+static int prm_list_query_cache_min_cost_default = 100;
+static int prm_list_query_cache_min_cost_lower = 0;
+static unsigned int prm_list_query_cache_min_cost_flag = 0;
+
+int PRM_BT_ADAPTIVE_HASH_INDEX_ENTRIES = 0;
+static int prm_bt_adaptive_hash_index_entries_default = 0;
+static int prm_bt_adaptive_hash_index_entries_upper = 16 * 1024 * 1024;
+static int prm_bt_adaptive_hash_index_entries_lower = 0;
+static unsigned int prm_bt_adaptive_hash_index_entries_flag = 0;
+
+bool PRM_PB_NUMA_AWARE = false;
+static bool prm_pb_numa_aware_default = false;
+static unsigned int prm_pb_numa_aware_flag = 0;
+
+int PRM_HA_APPLYLOGDB_PARALLEL_WORKERS = 0;
+static int prm_ha_applylogdb_parallel_workers_default = 0;
+static int prm_ha_applylogdb_parallel_workers_upper = 16;
+static int prm_ha_applylogdb_parallel_workers_lower = 0;
+static unsigned int prm_ha_applylogdb_parallel_workers_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -4864,6 +4962,168 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_OPTIMIZER_ENABLE_HASH_JOIN,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   (void *) &prm_optimizer_enable_hash_join_flag,
+   (void *) &prm_optimizer_enable_hash_join_default,
+   (void *) &PRM_OPTIMIZER_ENABLE_HASH_JOIN,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_MAX_HASH_JOIN_SIZE,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   (void *) &prm_max_hash_join_size_flag,
+   (void *) &prm_max_hash_join_size_default,
+   (void *) &PRM_MAX_HASH_JOIN_SIZE,
+   (void *) &prm_max_hash_join_size_upper,
+   (void *) &prm_max_hash_join_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_CONNECTION_DISPATCHER_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   (void *) &prm_connection_dispatcher_threads_flag,
+   (void *) &prm_connection_dispatcher_threads_default,
+   (void *) &PRM_CONNECTION_DISPATCHER_THREADS,
+   (void *) &prm_connection_dispatcher_threads_upper,
+   (void *) &prm_connection_dispatcher_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_PARALLEL_HEAP_SCAN_THREADS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   (void *) &prm_parallel_heap_scan_threads_flag,
+   (void *) &prm_parallel_heap_scan_threads_default,
+   (void *) &PRM_PARALLEL_HEAP_SCAN_THREADS,
+   (void *) &prm_parallel_heap_scan_threads_upper,
+   (void *) &prm_parallel_heap_scan_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_PARALLEL_HEAP_SCAN_MIN_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   (void *) &prm_parallel_heap_scan_min_pages_flag,
+   (void *) &prm_parallel_heap_scan_min_pages_default,
+   (void *) &PRM_PARALLEL_HEAP_SCAN_MIN_PAGES,
+   (void *) NULL,
+   (void *) &prm_parallel_heap_scan_min_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_SORT_PARALLEL_THREADS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   (void *) &prm_sort_parallel_threads_flag,
+   (void *) &prm_sort_parallel_threads_default,
+   (void *) &PRM_SORT_PARALLEL_THREADS,
+   (void *) &prm_sort_parallel_threads_upper,
+   (void *) &prm_sort_parallel_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_INDEX_BUILD_PARALLEL_THREADS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   (void *) &prm_index_build_parallel_threads_flag,
+   (void *) &prm_index_build_parallel_threads_default,
+   (void *) &PRM_INDEX_BUILD_PARALLEL_THREADS,
+   (void *) &prm_index_build_parallel_threads_upper,
+   (void *) &prm_index_build_parallel_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_LOG_GROUP_COMMIT_ADAPTIVE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   (void *) &prm_log_group_commit_adaptive_flag,
+   (void *) &prm_log_group_commit_adaptive_default,
+   (void *) &PRM_LOG_GROUP_COMMIT_ADAPTIVE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_LOG_COMPRESS_METHOD,
+   (PRM_FOR_SERVER),
+   PRM_KEYWORD,
+   (void *) &prm_log_compress_method_flag,
+   (void *) &prm_log_compress_method_default,
+   (void *) &PRM_LOG_COMPRESS_METHOD,
+   (void *) &prm_log_compress_method_upper,
+   (void *) &prm_log_compress_method_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_LOG_REDO_PARALLEL_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   (void *) &prm_log_redo_parallel_threads_flag,
+   (void *) &prm_log_redo_parallel_threads_default,
+   (void *) &PRM_LOG_REDO_PARALLEL_THREADS,
+   (void *) &prm_log_redo_parallel_threads_upper,
+   (void *) &prm_log_redo_parallel_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_SCAN_BATCH_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   (void *) &prm_scan_batch_size_flag,
+   (void *) &prm_scan_batch_size_default,
+   (void *) &PRM_SCAN_BATCH_SIZE,
+   (void *) &prm_scan_batch_size_upper,
+   (void *) &prm_scan_batch_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_LIST_QUERY_CACHE_MIN_COST,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   (void *) &prm_list_query_cache_min_cost_flag,
+   (void *) &prm_list_query_cache_min_cost_default,
+   (void *) &PRM_LIST_QUERY_CACHE_MIN_COST,
+   (void *) NULL,
+   (void *) &prm_list_query_cache_min_cost_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_BT_ADAPTIVE_HASH_INDEX_ENTRIES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   (void *) &prm_bt_adaptive_hash_index_entries_flag,
+   (void *) &prm_bt_adaptive_hash_index_entries_default,
+   (void *) &PRM_BT_ADAPTIVE_HASH_INDEX_ENTRIES,
+   (void *) &prm_bt_adaptive_hash_index_entries_upper,
+   (void *) &prm_bt_adaptive_hash_index_entries_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_PB_NUMA_AWARE,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   (void *) &prm_pb_numa_aware_flag,
+   (void *) &prm_pb_numa_aware_default,
+   (void *) &PRM_PB_NUMA_AWARE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_NAME_HA_APPLYLOGDB_PARALLEL_WORKERS,
+   (PRM_FOR_CLIENT | PRM_FOR_HA),
+   PRM_INTEGER,
+   (void *) &prm_ha_applylogdb_parallel_workers_flag,
+   (void *) &prm_ha_applylogdb_parallel_workers_default,
+   (void *) &PRM_HA_APPLYLOGDB_PARALLEL_WORKERS,
+   (void *) &prm_ha_applylogdb_parallel_workers_upper,
+   (void *) &prm_ha_applylogdb_parallel_workers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
 };
 
 #define NUM_PRM ((int)(sizeof(prm_Def)/sizeof(prm_Def[0])))
@@ -5031,6 +5291,11 @@ static KEYVAL ha_repl_filter_type_words[] = {
   {"exclude_table", REPL_FILTER_EXCLUDE_TBL}
 };
 
+static KEYVAL log_compress_method_words[] = {
+  {"lzo1x_1", LOG_COMPRESS_LZO1X_1},
+  {"lzo1x_999", LOG_COMPRESS_LZO1X_999}
+};
+
 static const char *compat_mode_values_PRM_ANSI_QUOTES[COMPAT_ORACLE + 2] = {
   NULL,				/* COMPAT_CUBRID */
   "no",				/* COMPAT_MYSQL */
@@ -6999,6 +7264,11 @@ prm_print (const SYSPRM_PARAM * prm, char *buf, size_t len, PRM_PRINT_MODE print
 	  keyvalp =
 	    prm_keyword (PRM_GET_INT (prm->value), NULL, ha_repl_filter_type_words, DIM (ha_repl_filter_type_words));
 	}
+      else if (intl_mbs_casecmp (prm->name, PRM_NAME_LOG_COMPRESS_METHOD) == 0)
+	{
+	  keyvalp =
+	    prm_keyword (PRM_GET_INT (prm->value), NULL, log_compress_method_words, DIM (log_compress_method_words));
+	}
       else
 	{
 	  assert (false);
@@ -7295,6 +7565,10 @@ sysprm_print_sysprm_value (PARAM_ID prm_id, SYSPRM_VALUE value, char *buf, size_
 	{
 	  keyvalp = prm_keyword (value.i, NULL, ha_repl_filter_type_words, DIM (ha_repl_filter_type_words));
 	}
+      else if (intl_mbs_casecmp (prm->name, PRM_NAME_LOG_COMPRESS_METHOD) == 0)
+	{
+	  keyvalp = prm_keyword (value.i, NULL, log_compress_method_words, DIM (log_compress_method_words));
+	}
       else
 	{
 	  assert (false);
@@ -8416,6 +8690,10 @@ sysprm_generate_new_value (SYSPRM_PARAM * prm, const char *value, bool check, bo
 	  {
 	    keyvalp = prm_keyword (-1, value, ha_repl_filter_type_words, DIM (ha_repl_filter_type_words));
 	  }
+	else if (intl_mbs_casecmp (prm->name, PRM_NAME_LOG_COMPRESS_METHOD) == 0)
+	  {
+	    keyvalp = prm_keyword (-1, value, log_compress_method_words, DIM (log_compress_method_words));
+	  }
 	else
 	  {
 	    assert (false);
@@ -9160,13 +9438,6 @@ prm_tune_parameters (void)
   test_mode_prm = prm_find (PRM_NAME_TEST_MODE, NULL);
   tz_leap_second_support_prm = prm_find (PRM_NAME_TZ_LEAP_SECOND_SUPPORT, NULL);
 
-  /* temporarily modifies the query result cache feature to be disabled in RB-8.2.2. because it is not verified on 64
-   * bit environment. */
-  if (query_cache_mode_prm != NULL)
-    {
-      prm_set (query_cache_mode_prm, "0", false);
-    }
-
   ha_mode_prm = prm_find (PRM_NAME_HA_MODE, NULL);
   ha_server_state_prm = prm_find (PRM_NAME_HA_SERVER_STATE, NULL);
   auto_restart_server_prm = prm_find (PRM_NAME_AUTO_RESTART_SERVER, NULL);
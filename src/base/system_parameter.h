@@ -87,6 +87,13 @@ enum query_trace_format
   QUERY_TRACE_JSON
 };
 
+typedef enum log_compress_method LOG_COMPRESS_METHOD;
+enum log_compress_method
+{
+  LOG_COMPRESS_LZO1X_1 = 0,	/* best speed */
+  LOG_COMPRESS_LZO1X_999	/* best compression ratio */
+};
+
 /* NOTE:
  * System parameter ids must respect the order in prm_Def array
  */
@@ -389,8 +396,24 @@ enum param_id
 
   PRM_ID_LOG_UNIQUE_STATS,
 
+  PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN,
+  PRM_ID_MAX_HASH_JOIN_SIZE,
+  PRM_ID_CONNECTION_DISPATCHER_THREADS,
+  PRM_ID_PARALLEL_HEAP_SCAN_THREADS,
+  PRM_ID_PARALLEL_HEAP_SCAN_MIN_PAGES,
+  PRM_ID_SORT_PARALLEL_THREADS,
+  PRM_ID_INDEX_BUILD_PARALLEL_THREADS,
+  PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE,
+  PRM_ID_LOG_COMPRESS_METHOD,
+  PRM_ID_LOG_REDO_PARALLEL_THREADS,
+  PRM_ID_SCAN_BATCH_SIZE,
+  PRM_ID_LIST_QUERY_CACHE_MIN_COST,
+  PRM_ID_BT_ADAPTIVE_HASH_INDEX_ENTRIES,
+  PRM_ID_PB_NUMA_AWARE,
+  PRM_ID_HA_APPLYLOGDB_PARALLEL_WORKERS,
+
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_LOG_UNIQUE_STATS
+  PRM_LAST_ID = PRM_ID_HA_APPLYLOGDB_PARALLEL_WORKERS
 };
 
 /*
@@ -193,8 +193,8 @@ extern int xehash_destroy (THREAD_ENTRY * thread_p, EHID * ehid);
 
 extern char *xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id, unsigned int timestamp,
 						int *length);
-extern int xstats_update_statistics (THREAD_ENTRY * thread_p, OID * classoid, bool with_fullscan);
-extern int xstats_update_all_statistics (THREAD_ENTRY * thread_p, bool with_fullscan);
+extern int xstats_update_statistics (THREAD_ENTRY * thread_p, OID * classoid, int sampling_percent);
+extern int xstats_update_all_statistics (THREAD_ENTRY * thread_p, int sampling_percent);
 
 extern DKNPAGES xdisk_get_total_numpages (THREAD_ENTRY * thread_p, VOLID volid);
 extern DKNPAGES xdisk_get_free_numpages (THREAD_ENTRY * thread_p, VOLID volid);
@@ -273,7 +273,11 @@ extern int xsession_get_last_insert_id (THREAD_ENTRY * thread_p, DB_VALUE * valu
 extern int xsession_reset_cur_insert_id (THREAD_ENTRY * thread_p);
 
 extern int xsession_create_prepared_statement (THREAD_ENTRY * thread_p, OID user, char *name, char *alias_print,
+					       const char *sql_text, int parse_flags, unsigned int schema_version,
 					       char *info, int info_len);
+extern int xsession_bind_shared_prepared_statement (THREAD_ENTRY * thread_p, OID user, const char *name,
+						    const char *sql_text, int parse_flags, bool * found,
+						    unsigned int *schema_version);
 extern int xsession_get_prepared_statement (THREAD_ENTRY * thread_p, const char *name, char **info, int *info_len,
 					    XASL_ID * xasl_id, XASL_NODE_HEADER * xasl_header_p);
 extern int xsession_delete_prepared_statement (THREAD_ENTRY * thread_p, const char *name);
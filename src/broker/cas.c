@@ -812,6 +812,9 @@ cas_main (void)
   cas_bi_set_dbms_type (CAS_DBMS_ORACLE);
 #elif defined(CAS_FOR_MYSQL)
   cas_bi_set_dbms_type (CAS_DBMS_MYSQL);
+#else /* CAS_FOR_MYSQL */
+  /* fetch_result () can send column-oriented batches */
+  cas_bi_set_columnar_fetch (true);
 #endif /* CAS_FOR_MYSQL */
 
 #if defined(WINDOWS)
@@ -70,8 +70,14 @@
 
 #include "dbi.h"
 
+#include "lzoconf.h"
+#include "lzo1x.h"
+
 #define QUERY_BUFFER_MAX                4096
 
+/* rows of a column-oriented fetch batch are encoded until this size is reached */
+#define COLUMNAR_FETCH_BUF_SIZE         (256 * NET_BUF_KBYTE)
+
 #define FK_INFO_SORT_BY_PKTABLE_NAME	1
 #define FK_INFO_SORT_BY_FKTABLE_NAME	2
 
@@ -206,6 +212,12 @@ static void set_column_info (T_NET_BUF * net_buf, char ut, short scale, int prec
 	    int result_set_idx, T_NET_BUF *);
 */
 static int fetch_result (T_SRV_HANDLE *, int, int, char, int, T_NET_BUF *, T_REQ_INFO *);
+static int fetch_tuple_oid (DB_QUERY_RESULT * result, T_OBJECT * tuple_obj, DB_OBJECT ** db_obj);
+static int fetch_result_columnar (T_SRV_HANDLE * srv_handle, T_QUERY_RESULT * q_result, int *cursor_pos,
+				  char sensitive_flag, bool compress, T_NET_BUF * net_buf, T_REQ_INFO * req_info,
+				  int *num_tuple, char *fetch_end_flag);
+static int fetch_batch_add_column (T_NET_BUF * net_buf, char **values, int num_tuple, int num_cols);
+static int fetch_batch_compress (T_NET_BUF * net_buf, char *batch, int batch_size);
 static int fetch_class (T_SRV_HANDLE *, int, int, char, int, T_NET_BUF *, T_REQ_INFO *);
 static int fetch_attribute (T_SRV_HANDLE *, int, int, char, int, T_NET_BUF *, T_REQ_INFO *);
 static int fetch_method (T_SRV_HANDLE *, int, int, char, int, T_NET_BUF *, T_REQ_INFO *);
@@ -5398,6 +5410,19 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
       net_buf_size = NET_BUF_SIZE;
     }
 
+  if (fetch_flag & CAS_FETCH_FLAG_COLUMNAR)
+    {
+      err_code =
+	fetch_result_columnar (srv_handle, q_result, &cursor_pos, sensitive_flag,
+			       (fetch_flag & CAS_FETCH_FLAG_COMPRESS) != 0, net_buf, req_info, &num_tuple,
+			       &fetch_end_flag);
+      if (err_code < 0)
+	{
+	  return err_code;
+	}
+      goto fetch_end;
+    }
+
   num_tuple = 0;
   while (CHECK_NET_BUF_SIZE (net_buf, net_buf_size))
     {				/* currently, don't check fetch_count */
@@ -5409,30 +5434,10 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
 
       if (q_result->include_oid)
 	{
-	  DB_VALUE oid_val;
-
-	  er_clear ();
-
-	  if (db_query_get_tuple_oid (result, &oid_val) >= 0)
+	  err_code = fetch_tuple_oid (result, &tuple_obj, &db_obj);
+	  if (err_code < 0)
 	    {
-	      if (db_value_type (&oid_val) == DB_TYPE_OBJECT)
-		{
-		  db_obj = db_get_object (&oid_val);
-		  if (db_is_instance (db_obj) > 0)
-		    {
-		      dbobj_to_casobj (db_obj, &tuple_obj);
-		    }
-		  else if (db_error_code () == 0 || db_error_code () == -48)
-		    {
-		      memset ((char *) &tuple_obj, 0xff, sizeof (T_OBJECT));
-		      db_obj = NULL;
-		    }
-		  else
-		    {
-		      return ERROR_INFO_SET (db_error_code (), DBMS_ERROR_INDICATOR);
-		    }
-		}
-	      db_value_clear (&oid_val);
+	      return err_code;
 	    }
 	}
 
@@ -5477,6 +5482,7 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
 	}
     }
 
+fetch_end:
   if (DOES_CLIENT_UNDERSTAND_THE_PROTOCOL (client_version, PROTOCOL_V5))
     {
       net_buf_cp_byte (net_buf, fetch_end_flag);
@@ -5490,6 +5496,346 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
   return 0;
 }
 
+/*
+ * fetch_tuple_oid () - get the OID of the current tuple of a query result
+ *   return: error code or 0
+ *   result(in):
+ *   tuple_obj(out): OID of the tuple; all bits set if the instance was deleted
+ *   db_obj(out): the instance or NULL
+ */
+static int
+fetch_tuple_oid (DB_QUERY_RESULT * result, T_OBJECT * tuple_obj, DB_OBJECT ** db_obj)
+{
+  DB_VALUE oid_val;
+
+  er_clear ();
+
+  if (db_query_get_tuple_oid (result, &oid_val) >= 0)
+    {
+      if (db_value_type (&oid_val) == DB_TYPE_OBJECT)
+	{
+	  *db_obj = db_get_object (&oid_val);
+	  if (db_is_instance (*db_obj) > 0)
+	    {
+	      dbobj_to_casobj (*db_obj, tuple_obj);
+	    }
+	  else if (db_error_code () == 0 || db_error_code () == -48)
+	    {
+	      memset ((char *) tuple_obj, 0xff, sizeof (T_OBJECT));
+	      *db_obj = NULL;
+	    }
+	  else
+	    {
+	      return ERROR_INFO_SET (db_error_code (), DBMS_ERROR_INDICATOR);
+	    }
+	}
+      db_value_clear (&oid_val);
+    }
+
+  return 0;
+}
+
+/*
+ * fetch_result_columnar () - fetch tuples of a query result as one column-oriented batch
+ *   return: error code or 0
+ *   srv_handle(in):
+ *   q_result(in): query result positioned on *cursor_pos
+ *   cursor_pos(in/out): position of the first tuple; the position next to the last fetched tuple on return
+ *   sensitive_flag(in):
+ *   compress(in): compress the batch with LZO
+ *   net_buf(out):
+ *   req_info(in):
+ *   num_tuple(out): number of fetched tuples
+ *   fetch_end_flag(out): 1 if the end of the result is reached
+ *
+ * Note: The batch consists of
+ *         byte encoding : CAS_FETCH_BATCH_PLAIN or CAS_FETCH_BATCH_LZO
+ *         int raw size, int compressed size : only for CAS_FETCH_BATCH_LZO
+ *         int cursor position of the first tuple
+ *         byte include oid, followed by an OID for each tuple if set
+ *         for each column
+ *           byte layout : CAS_FETCH_COLUMN_FIXED or CAS_FETCH_COLUMN_VAR
+ *           null bitmap : (num_tuple + 7) / 8 bytes, bit set for NULL
+ *           CAS_FETCH_COLUMN_FIXED : int width, values of width bytes
+ *           CAS_FETCH_COLUMN_VAR : int offsets[num_tuple + 1], values
+ *       A value is what dbval_to_net_buf () makes without the size prefix.
+ *       The values of a column are fixed width if all of its non-null values
+ *       have the same size; a NULL takes zeroed width bytes or an empty range.
+ */
+static int
+fetch_result_columnar (T_SRV_HANDLE * srv_handle, T_QUERY_RESULT * q_result, int *cursor_pos, char sensitive_flag,
+		       bool compress, T_NET_BUF * net_buf, T_REQ_INFO * req_info, int *num_tuple, char *fetch_end_flag)
+{
+  DB_QUERY_RESULT *result = (DB_QUERY_RESULT *) q_result->result;
+  T_NET_BUF row_buf, oid_buf, batch_buf;
+  T_OBJECT tuple_obj;
+  DB_OBJECT *db_obj;
+  char **values = NULL;
+  char *p;
+  int first_cursor_pos = *cursor_pos;
+  int num_cols, i, j, size;
+  int err_code = 0;
+
+  net_buf_init (&row_buf, net_buf->client_version);
+  net_buf_init (&oid_buf, net_buf->client_version);
+  net_buf_init (&batch_buf, net_buf->client_version);
+
+  num_cols = db_query_column_count (result);
+  *num_tuple = 0;
+
+  /* encode the tuples as usual and transpose them afterwards */
+  while (row_buf.data_size < COLUMNAR_FETCH_BUF_SIZE)
+    {
+      memset ((char *) &tuple_obj, 0, sizeof (T_OBJECT));
+      db_obj = NULL;
+
+      if (q_result->include_oid)
+	{
+	  err_code = fetch_tuple_oid (result, &tuple_obj, &db_obj);
+	  if (err_code < 0)
+	    {
+	      goto exit;
+	    }
+	  net_buf_cp_object (&oid_buf, &tuple_obj);
+	}
+
+      err_code = cur_tuple (q_result, srv_handle->max_col_size, sensitive_flag, db_obj, &row_buf);
+      if (err_code < 0)
+	{
+	  goto exit;
+	}
+
+      (*num_tuple)++;
+      (*cursor_pos)++;
+      if (srv_handle->max_row > 0 && *cursor_pos > srv_handle->max_row)
+	{
+	  if (check_auto_commit_after_fetch_done (srv_handle) == true)
+	    {
+	      ux_cursor_close (srv_handle);
+	      req_info->need_auto_commit = TRAN_AUTOCOMMIT;
+	    }
+	  break;
+	}
+
+      err_code = db_query_next_tuple (result);
+      if (err_code == DB_CURSOR_END)
+	{
+	  *fetch_end_flag = 1;
+
+	  if (check_auto_commit_after_fetch_done (srv_handle) == true)
+	    {
+	      ux_cursor_close (srv_handle);
+	      req_info->need_auto_commit = TRAN_AUTOCOMMIT;
+	    }
+	  break;
+	}
+      else if (err_code != DB_CURSOR_SUCCESS)
+	{
+	  err_code = ERROR_INFO_SET (err_code, DBMS_ERROR_INDICATOR);
+	  goto exit;
+	}
+    }
+  err_code = 0;
+
+  if (row_buf.err_code < 0 || oid_buf.err_code < 0)
+    {
+      err_code = ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
+      goto exit;
+    }
+
+  values = (char **) MALLOC (sizeof (char *) * (*num_tuple) * num_cols);
+  if (values == NULL)
+    {
+      err_code = ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
+      goto exit;
+    }
+
+  /* values[i * num_cols + j] points the size prefix of column j of tuple i */
+  p = row_buf.data + NET_BUF_HEADER_SIZE;
+  for (i = 0; i < *num_tuple * num_cols; i++)
+    {
+      values[i] = p;
+      net_arg_get_size (&size, p);
+      p += NET_SIZE_INT + MAX (size, 0);
+    }
+
+  net_buf_cp_int (&batch_buf, first_cursor_pos, NULL);
+  net_buf_cp_byte (&batch_buf, q_result->include_oid ? 1 : 0);
+  if (q_result->include_oid)
+    {
+      net_buf_cp_str (&batch_buf, oid_buf.data + NET_BUF_HEADER_SIZE, oid_buf.data_size);
+    }
+
+  for (j = 0; j < num_cols; j++)
+    {
+      fetch_batch_add_column (&batch_buf, values + j, *num_tuple, num_cols);
+    }
+
+  if (batch_buf.err_code < 0)
+    {
+      err_code = ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
+      goto exit;
+    }
+
+  if (compress)
+    {
+      err_code = fetch_batch_compress (net_buf, batch_buf.data + NET_BUF_HEADER_SIZE, batch_buf.data_size);
+    }
+  else
+    {
+      net_buf_cp_byte (net_buf, CAS_FETCH_BATCH_PLAIN);
+      net_buf_cp_str (net_buf, batch_buf.data + NET_BUF_HEADER_SIZE, batch_buf.data_size);
+    }
+
+exit:
+  FREE_MEM (values);
+  net_buf_destroy (&row_buf);
+  net_buf_destroy (&oid_buf);
+  net_buf_destroy (&batch_buf);
+
+  return err_code;
+}
+
+/*
+ * fetch_batch_add_column () - append a column of a column-oriented fetch batch
+ *   return: error code or 0
+ *   net_buf(out):
+ *   values(in): size prefixed values; the value of tuple i is values[i * num_cols]
+ *   num_tuple(in):
+ *   num_cols(in):
+ */
+static int
+fetch_batch_add_column (T_NET_BUF * net_buf, char **values, int num_tuple, int num_cols)
+{
+  int i, k, size, width = -1, offset;
+  bool is_fixed = true;
+  char bits;
+
+  for (i = 0; i < num_tuple && is_fixed; i++)
+    {
+      net_arg_get_size (&size, values[i * num_cols]);
+      if (size <= 0)
+	{
+	  continue;
+	}
+
+      if (width < 0)
+	{
+	  width = size;
+	}
+      else if (width != size)
+	{
+	  is_fixed = false;
+	}
+    }
+
+  net_buf_cp_byte (net_buf, is_fixed ? CAS_FETCH_COLUMN_FIXED : CAS_FETCH_COLUMN_VAR);
+
+  for (i = 0; i < num_tuple; i += 8)
+    {
+      bits = 0;
+      for (k = 0; k < 8 && i + k < num_tuple; k++)
+	{
+	  net_arg_get_size (&size, values[(i + k) * num_cols]);
+	  if (size <= 0)
+	    {
+	      bits |= (char) (1 << k);
+	    }
+	}
+      net_buf_cp_byte (net_buf, bits);
+    }
+
+  if (is_fixed)
+    {
+      width = MAX (width, 0);
+      net_buf_cp_int (net_buf, width, NULL);
+
+      for (i = 0; i < num_tuple; i++)
+	{
+	  net_arg_get_size (&size, values[i * num_cols]);
+	  if (size > 0)
+	    {
+	      net_buf_cp_str (net_buf, values[i * num_cols] + NET_SIZE_INT, size);
+	    }
+	  else
+	    {
+	      for (k = 0; k < width; k++)
+		{
+		  net_buf_cp_byte (net_buf, 0);
+		}
+	    }
+	}
+    }
+  else
+    {
+      offset = 0;
+      net_buf_cp_int (net_buf, offset, NULL);
+      for (i = 0; i < num_tuple; i++)
+	{
+	  net_arg_get_size (&size, values[i * num_cols]);
+	  offset += MAX (size, 0);
+	  net_buf_cp_int (net_buf, offset, NULL);
+	}
+
+      for (i = 0; i < num_tuple; i++)
+	{
+	  net_arg_get_size (&size, values[i * num_cols]);
+	  net_buf_cp_str (net_buf, values[i * num_cols] + NET_SIZE_INT, size);
+	}
+    }
+
+  return net_buf->err_code;
+}
+
+/*
+ * fetch_batch_compress () - append a column-oriented fetch batch compressed with LZO1X-1
+ *   return: error code or 0
+ *   net_buf(out):
+ *   batch(in):
+ *   batch_size(in):
+ *
+ * Note: The batch is sent as it is if it does not get smaller.
+ */
+static int
+fetch_batch_compress (T_NET_BUF * net_buf, char *batch, int batch_size)
+{
+  static lzo_voidp wrkmem = NULL;
+  lzo_bytep zip_buf;
+  lzo_uint zip_size;
+  int rc;
+
+  if (wrkmem == NULL)
+    {
+      wrkmem = (lzo_voidp) MALLOC (LZO1X_1_MEM_COMPRESS);
+    }
+
+  /* worst case expansion of LZO1X */
+  zip_buf = (lzo_bytep) MALLOC (batch_size + batch_size / 16 + 64 + 3);
+  if (wrkmem == NULL || zip_buf == NULL)
+    {
+      FREE_MEM (zip_buf);
+      return ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
+    }
+
+  rc = lzo1x_1_compress ((lzo_bytep) batch, (lzo_uint) batch_size, zip_buf, &zip_size, wrkmem);
+  if (rc == LZO_E_OK && zip_size < (lzo_uint) batch_size)
+    {
+      net_buf_cp_byte (net_buf, CAS_FETCH_BATCH_LZO);
+      net_buf_cp_int (net_buf, batch_size, NULL);
+      net_buf_cp_int (net_buf, (int) zip_size, NULL);
+      net_buf_cp_str (net_buf, (char *) zip_buf, (int) zip_size);
+    }
+  else
+    {
+      net_buf_cp_byte (net_buf, CAS_FETCH_BATCH_PLAIN);
+      net_buf_cp_str (net_buf, batch, batch_size);
+    }
+
+  FREE_MEM (zip_buf);
+
+  return 0;
+}
+
 static int
 fetch_class (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char fetch_flag, int result_set_idx,
 	     T_NET_BUF * net_buf, T_REQ_INFO * req_info)
@@ -46,7 +46,8 @@ static char broker_info[BROKER_INFO_SIZE] = {
 typedef enum
 {
   BI_FUNC_ERROR_CODE,
-  BI_FUNC_SUPPORT_HOLDABLE_RESULT
+  BI_FUNC_SUPPORT_HOLDABLE_RESULT,
+  BI_FUNC_SUPPORT_COLUMNAR_FETCH
 } BI_FUNCTION_CODE;
 
 const char *
@@ -144,6 +145,9 @@ cas_bi_set_function_enable (BI_FUNCTION_CODE function_code)
     case BI_FUNC_SUPPORT_HOLDABLE_RESULT:
       SET_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_HOLDABLE_RESULT);
       break;
+    case BI_FUNC_SUPPORT_COLUMNAR_FETCH:
+      SET_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_COLUMNAR_FETCH);
+      break;
     default:
       assert (false);
       break;
@@ -161,6 +165,9 @@ cas_bi_set_function_disable (BI_FUNCTION_CODE function_code)
     case BI_FUNC_SUPPORT_HOLDABLE_RESULT:
       CLEAR_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_HOLDABLE_RESULT);
       break;
+    case BI_FUNC_SUPPORT_COLUMNAR_FETCH:
+      CLEAR_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_COLUMNAR_FETCH);
+      break;
     default:
       assert (false);
       break;
@@ -176,6 +183,8 @@ cas_bi_is_enabled_function (BI_FUNCTION_CODE function_code)
       return IS_SET_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_RENEWED_ERROR_CODE);
     case BI_FUNC_SUPPORT_HOLDABLE_RESULT:
       return IS_SET_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_HOLDABLE_RESULT);
+    case BI_FUNC_SUPPORT_COLUMNAR_FETCH:
+      return IS_SET_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_COLUMNAR_FETCH);
     default:
       return 0;
     }
@@ -200,6 +209,25 @@ cas_bi_get_renewed_error_code (void)
   return cas_bi_is_enabled_function (BI_FUNC_ERROR_CODE);
 }
 
+void
+cas_bi_set_columnar_fetch (const bool columnar_fetch)
+{
+  if (columnar_fetch)
+    {
+      cas_bi_set_function_enable (BI_FUNC_SUPPORT_COLUMNAR_FETCH);
+    }
+  else
+    {
+      cas_bi_set_function_disable (BI_FUNC_SUPPORT_COLUMNAR_FETCH);
+    }
+}
+
+bool
+cas_bi_get_columnar_fetch (void)
+{
+  return cas_bi_is_enabled_function (BI_FUNC_SUPPORT_COLUMNAR_FETCH);
+}
+
 bool
 cas_di_understand_renewed_error_code (const char *driver_info)
 {
@@ -114,6 +114,7 @@ extern "C"
 #define BROKER_SUPPORT_HOLDABLE_RESULT          0x40
 /* Do not remove or rename BROKER_RECONNECT_WHEN_SERVER_DOWN */
 #define BROKER_RECONNECT_WHEN_SERVER_DOWN       0x20
+#define BROKER_SUPPORT_COLUMNAR_FETCH           0x10
 
 /* For backward compatibility */
 #define BROKER_INFO_MAJOR_VERSION               (BROKER_INFO_PROTO_VERSION)
@@ -145,6 +146,18 @@ extern "C"
 #define CAS_REQ_HEADER_OLEDB	"OLEDB"
 #define CAS_REQ_HEADER_CCI	"CCI"
 
+/* fetch flags; the low bit is CCI_FETCH_SENSITIVE */
+#define CAS_FETCH_FLAG_COLUMNAR                 0x10
+#define CAS_FETCH_FLAG_COMPRESS                 0x20
+
+/* encoding of a column-oriented fetch batch */
+#define CAS_FETCH_BATCH_PLAIN                   0
+#define CAS_FETCH_BATCH_LZO                     1
+
+/* layout of a column in a column-oriented fetch batch */
+#define CAS_FETCH_COLUMN_FIXED                  0
+#define CAS_FETCH_COLUMN_VAR                    1
+
 #define SHARD_ID_INVALID 		(-1)
 #define SHARD_ID_UNSUPPORTED	(-2)
 
@@ -347,6 +360,8 @@ extern "C"
   extern char cas_bi_get_protocol_version (void);
   extern void cas_bi_set_renewed_error_code (const bool renewed_error_code);
   extern bool cas_bi_get_renewed_error_code (void);
+  extern void cas_bi_set_columnar_fetch (const bool columnar_fetch);
+  extern bool cas_bi_get_columnar_fetch (void);
   extern bool cas_di_understand_renewed_error_code (const char *driver_info);
   extern void cas_bi_make_broker_info (char *broker_info, char dbms_type, char statement_pooling, char cci_pconnect);
 #ifdef __cplusplus
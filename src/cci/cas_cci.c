@@ -2369,6 +2369,52 @@ cci_get_data (int mapped_stmt_id, int col_no, int a_type, void *value, int *indi
   return error;
 }
 
+/*
+ * cci_get_data_array () - get a column of the fetched tuples from the cursor position on
+ *   return: number of tuples read or error code
+ *   mapped_stmt_id(in):
+ *   col_no(in):
+ *   a_type(in):
+ *   values(out): array of num_rows values
+ *   indicators(out): array of num_rows indicators
+ *   num_rows(in):
+ *
+ * Note: Reads at most up to the last tuple fetched by cci_fetch () and does
+ *       not move the cursor. It pays off with the columnarFetch connection
+ *       property, which makes the broker send the values column by column.
+ */
+int
+cci_get_data_array (int mapped_stmt_id, int col_no, int a_type, void *values, int *indicators, int num_rows)
+{
+  T_REQ_HANDLE *req_handle = NULL;
+  T_CON_HANDLE *con_handle = NULL;
+  int error = 0;
+
+#ifdef CCI_FULL_DEBUG
+  CCI_DEBUG_PRINT (print_debug_msg
+		   ("(%d:%d)cci_get_data_array: %d %s %d", CON_ID (mapped_stmt_id), REQ_ID (mapped_stmt_id), col_no,
+		    dbg_a_type_str (a_type), num_rows));
+#endif
+
+  if (indicators == NULL || values == NULL || num_rows < 0)
+    {
+      return CCI_ER_INVALID_ARGS;
+    }
+
+  error = hm_get_statement (mapped_stmt_id, &con_handle, &req_handle);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      return error;
+    }
+  reset_error_buffer (&(con_handle->err_buf));
+
+  error = qe_get_data_array (con_handle, req_handle, col_no, a_type, values, indicators, num_rows);
+
+  con_handle->used = false;
+
+  return error;
+}
+
 static int
 cci_schema_info_internal (int mapped_conn_id, T_CCI_SCH_TYPE type, char *arg1, char *arg2, char flag, int shard_id,
 			  T_CCI_ERROR * err_buf)
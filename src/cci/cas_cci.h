@@ -830,6 +830,7 @@ extern "C"
   extern int cci_fetch_size (int req_handle, int fetch_size);
   extern int cci_fetch (int req_handle, T_CCI_ERROR * err_buf);
   extern int cci_get_data (int req_handle, int col_no, int type, void *value, int *indicator);
+  extern int cci_get_data_array (int req_handle, int col_no, int type, void *values, int *indicators, int num_rows);
   extern int cci_schema_info (int con_handle, T_CCI_SCH_TYPE type, char *arg1, char *arg2, char flag,
 			      T_CCI_ERROR * err_buf);
   extern int cci_get_cur_oid (int req_handle, char *oid_str_buf);
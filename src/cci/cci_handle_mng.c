@@ -833,7 +833,7 @@ hm_req_handle_fetch_buf_free (T_REQ_HANDLE * req_handle)
       for (i = 0; i < fetched_tuple; i++)
 	{
 #if defined(WINDOWS)
-	  for (j = 0; j < req_handle->num_col_info; j++)
+	  for (j = 0; req_handle->tuple_value[i].decoded_ptr != NULL && j < req_handle->num_col_info; j++)
 	    {
 	      FREE_MEM (req_handle->tuple_value[i].decoded_ptr[j]);
 	    }
@@ -844,6 +844,12 @@ hm_req_handle_fetch_buf_free (T_REQ_HANDLE * req_handle)
 	}
       FREE_MEM (req_handle->tuple_value);
     }
+  if (req_handle->column_batch)
+    {
+      FREE_MEM (req_handle->column_batch->unzip_buf);
+      FREE_MEM (req_handle->column_batch->columns);
+      FREE_MEM (req_handle->column_batch);
+    }
   FREE_MEM (req_handle->msg_buf);
   req_handle->fetched_tuple_begin = req_handle->fetched_tuple_end = 0;
   req_handle->cur_fetch_tuple_index = -1;
@@ -1160,6 +1166,14 @@ hm_broker_reconnect_when_server_down (T_CON_HANDLE * con_handle)
   return (f & BROKER_RECONNECT_WHEN_SERVER_DOWN) == BROKER_RECONNECT_WHEN_SERVER_DOWN;
 }
 
+bool
+hm_broker_support_columnar_fetch (T_CON_HANDLE * con_handle)
+{
+  char f = con_handle->broker_info[BROKER_INFO_FUNCTION_FLAG];
+
+  return (f & BROKER_SUPPORT_COLUMNAR_FETCH) == BROKER_SUPPORT_COLUMNAR_FETCH;
+}
+
 void
 hm_check_rc_time (T_CON_HANDLE * con_handle)
 {
@@ -1313,6 +1327,8 @@ init_con_handle (T_CON_HANDLE * con_handle, char *ip_str, int port, char *db_nam
   con_handle->slow_query_threshold_millis = 60000;
   con_handle->log_trace_api = false;
   con_handle->log_trace_network = false;
+  con_handle->columnar_fetch = false;
+  con_handle->fetch_compression = false;
 
   con_handle->deferred_max_close_handle_count = DEFERRED_CLOSE_HANDLE_ALLOC_SIZE;
   con_handle->deferred_close_handle_list = (int *) MALLOC (sizeof (int) * con_handle->deferred_max_close_handle_count);
@@ -125,6 +125,21 @@ extern "C"
     char **decoded_ptr;
   } T_TUPLE_VALUE;
 
+  typedef struct
+  {
+    char layout;		/* CAS_FETCH_COLUMN_FIXED or CAS_FETCH_COLUMN_VAR */
+    int width;			/* value size of a fixed width column */
+    char *null_bitmap;
+    char *offsets;		/* int offsets[num_tuple + 1] of a variable width column */
+    char *data;
+  } T_COLUMN_VECTOR;
+
+  typedef struct
+  {
+    char *unzip_buf;		/* decompressed batch; NULL if the batch was not compressed */
+    T_COLUMN_VECTOR *columns;
+  } T_COLUMN_BATCH;
+
   typedef struct
   {
     T_CCI_U_TYPE u_type;	/* primary type (without any collection flags) */
@@ -168,6 +183,7 @@ extern "C"
     int fetched_tuple_end;
     int cur_fetch_tuple_index;
     T_TUPLE_VALUE *tuple_value;
+    T_COLUMN_BATCH *column_batch;	/* column values of a column-oriented fetch; NULL for row fetch */
     T_VALUE_BUF conv_value_buffer;
     T_CCI_QUERY_RESULT *qr;
     int num_query_res;
@@ -253,6 +269,8 @@ extern "C"
     int slow_query_threshold_millis;
     char log_trace_api;
     char log_trace_network;
+    char columnar_fetch;
+    char fetch_compression;
 
     /* to check timeout */
     struct timeval start_time;	/* function start time to check timeout */
@@ -313,6 +331,7 @@ extern "C"
 
   extern bool hm_broker_support_holdable_result (T_CON_HANDLE * con_handle);
   extern bool hm_broker_reconnect_when_server_down (T_CON_HANDLE * con_handle);
+  extern bool hm_broker_support_columnar_fetch (T_CON_HANDLE * con_handle);
 
   extern void hm_set_con_handle_holdable (T_CON_HANDLE * con_handle, int holdable);
   extern int hm_get_con_handle_holdable (T_CON_HANDLE * con_handle);
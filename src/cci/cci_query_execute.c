@@ -69,6 +69,11 @@
 #include "cci_t_lob.h"
 #include "cci_map.h"
 
+#if defined (HAVE_LZO2)
+#include "lzoconf.h"
+#include "lzo1x.h"
+#endif /* HAVE_LZO2 */
+
 /************************************************************************
  * PRIVATE DEFINITIONS							*
  ************************************************************************/
@@ -176,6 +181,9 @@ static int out_rs_info_decode (char *buf, int *size, T_REQ_HANDLE * req_handle);
 static int get_cursor_pos (T_REQ_HANDLE * req_handle, int offset, char origin);
 static int fetch_info_decode (char *buf, int size, int num_cols, T_TUPLE_VALUE ** tuple_value, T_FETCH_TYPE fetch_type,
 			      T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle);
+static int fetch_batch_decode (char *buf, int size, int num_cols, T_REQ_HANDLE * req_handle,
+			       T_CON_HANDLE * con_handle);
+static char *get_fetched_value (T_REQ_HANDLE * req_handle, int tuple_index, int col_index, int *data_size);
 static void stream_to_obj (char *buf, T_OBJECT * obj);
 
 static int get_data_set (T_CCI_U_EXT_TYPE u_ext_type, char *col_value_p, T_SET ** value, int data_size);
@@ -198,7 +206,7 @@ static int execute_array_info_decode (char *buf, int size, char flag, T_CCI_QUER
 static T_CCI_U_TYPE get_basic_utype (T_CCI_U_EXT_TYPE u_ext_type);
 static int parameter_info_decode (char *buf, int size, int num_param, T_CCI_PARAM_INFO ** res_param);
 static int decode_fetch_result (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, char *result_msg_org,
-				char *result_msg_start, int result_msg_size);
+				char *result_msg_start, int result_msg_size, bool is_columnar);
 static int qe_close_req_handle_internal (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, bool force_close);
 static int qe_send_close_handle_msg (T_CON_HANDLE * con_handle, int server_handle_id);
 #if defined(WINDOWS)
@@ -767,7 +775,7 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
       req_handle->cursor_pos = 1;
       num_tuple =
 	decode_fetch_result (con_handle, req_handle, result_msg, result_msg + (result_msg_size - remain_msg_size) + 4,
-			     remain_msg_size - 4);
+			     remain_msg_size - 4, false);
       req_handle->cursor_pos = 0;
       if (num_tuple < 0)
 	{
@@ -1034,7 +1042,7 @@ qe_prepare_and_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, ch
       req_handle->cursor_pos = 1;
       num_tuple =
 	decode_fetch_result (con_handle, req_handle, result_msg_org,
-			     result_msg + (result_msg_size - remain_msg_size) + 4, remain_msg_size - 4);
+			     result_msg + (result_msg_size - remain_msg_size) + 4, remain_msg_size - 4, false);
       req_handle->cursor_pos = 0;
       if (num_tuple < 0)
 	{
@@ -1604,6 +1612,7 @@ qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int r
   char *result_msg = NULL;
   int result_msg_size;
   int num_tuple;
+  char fetch_flag = flag;
 
   if (req_handle->cursor_pos <= 0)
     {
@@ -1631,12 +1640,27 @@ qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int r
 
   hm_req_handle_fetch_buf_free (req_handle);
 
+  /* query results are fetched as column-oriented batches if the connection asks for it and the broker can */
+  if (con_handle->columnar_fetch && hm_broker_support_columnar_fetch (con_handle)
+      && req_handle->handle_type == HANDLE_PREPARE && req_handle->stmt_type != CUBRID_STMT_CALL_SP
+      && con_handle->charset == NULL)
+    {
+      fetch_flag |= CAS_FETCH_FLAG_COLUMNAR;
+#if defined (HAVE_LZO2)
+      /* without LZO (e.g. --with-cci-only) the batches are always asked for uncompressed */
+      if (con_handle->fetch_compression)
+	{
+	  fetch_flag |= CAS_FETCH_FLAG_COMPRESS;
+	}
+#endif /* HAVE_LZO2 */
+    }
+
   net_buf_init (&net_buf);
   net_buf_cp_str (&net_buf, &func_code, 1);
   ADD_ARG_INT (&net_buf, req_handle->server_handle_id);
   ADD_ARG_INT (&net_buf, req_handle->cursor_pos);
   ADD_ARG_INT (&net_buf, req_handle->fetch_size);
-  ADD_ARG_BYTES (&net_buf, &flag, 1);
+  ADD_ARG_BYTES (&net_buf, &fetch_flag, 1);
   ADD_ARG_INT (&net_buf, result_set_index);
 
   if (net_buf.err_code < 0)
@@ -1657,7 +1681,9 @@ qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int r
       return err_code;
     }
 
-  num_tuple = decode_fetch_result (con_handle, req_handle, result_msg, result_msg + 4, result_msg_size - 4);
+  num_tuple =
+    decode_fetch_result (con_handle, req_handle, result_msg, result_msg + 4, result_msg_size - 4,
+			 (fetch_flag & CAS_FETCH_FLAG_COLUMNAR) != 0);
   if (num_tuple < 0)
     {
       FREE_MEM (result_msg);
@@ -1721,7 +1747,7 @@ qe_get_data (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, int col_no, i
       return CCI_ER_INVALID_CURSOR_POS;
     }
 
-  col_value_p = req_handle->tuple_value[req_handle->cur_fetch_tuple_index].column_ptr[col_no - 1];
+  col_value_p = get_fetched_value (req_handle, req_handle->cur_fetch_tuple_index, col_no - 1, &data_size);
 
   if (req_handle->stmt_type == CUBRID_STMT_CALL_SP)
     {
@@ -1732,7 +1758,6 @@ qe_get_data (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, int col_no, i
       u_ext_type = CCI_GET_RESULT_INFO_TYPE (req_handle->col_info, col_no);
     }
 
-  NET_STR_TO_INT (data_size, col_value_p);
   if (data_size <= 0)
     {
       *indicator = -1;
@@ -1744,7 +1769,6 @@ qe_get_data (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, int col_no, i
       return 0;
     }
 
-  col_value_p += NET_SIZE_INT;
   if (u_ext_type == CCI_U_TYPE_NULL)
     {
       char basic_type, set_type;
@@ -1846,6 +1870,151 @@ qe_get_data (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, int col_no, i
   return err_code;
 }
 
+/*
+ * qe_get_data_array () - get the values of a column of consecutive fetched tuples
+ *   return: number of tuples read or error code
+ *   con_handle(in):
+ *   req_handle(in):
+ *   col_no(in): column number starting from 1
+ *   a_type(in): CCI_A_TYPE_INT, UINT, BIGINT, UBIGINT, FLOAT, DOUBLE or STR
+ *   values(out): array of num_rows values of a_type
+ *   indicators(out): array of num_rows indicators
+ *   num_rows(in): maximum number of tuples to read
+ *
+ * Note: Tuples are read from the cursor position up to the end of the fetched
+ *       tuples; the cursor does not move. CCI_A_TYPE_STR is only allowed for
+ *       string columns, whose values are returned without being copied.
+ */
+int
+qe_get_data_array (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, int col_no, int a_type, void *values,
+		   int *indicators, int num_rows)
+{
+  char *col_value_p;
+  T_CCI_U_EXT_TYPE u_ext_type;
+  T_CCI_U_TYPE u_type = CCI_U_TYPE_NULL;
+  int data_size, elem_size;
+  int err_code = 0;
+  int cur_index, num_fetched, i;
+  bool is_typed;
+
+  if (req_handle->is_closed)
+    {
+      return CCI_ER_RESULT_SET_CLOSED;
+    }
+
+  if (req_handle->cur_fetch_tuple_index < 0)
+    {
+      return CCI_ER_INVALID_CURSOR_POS;
+    }
+
+  switch (a_type)
+    {
+    case CCI_A_TYPE_INT:
+    case CCI_A_TYPE_UINT:
+      elem_size = sizeof (int);
+      break;
+    case CCI_A_TYPE_BIGINT:
+    case CCI_A_TYPE_UBIGINT:
+      elem_size = sizeof (INT64);
+      break;
+    case CCI_A_TYPE_FLOAT:
+      elem_size = sizeof (float);
+      break;
+    case CCI_A_TYPE_DOUBLE:
+      elem_size = sizeof (double);
+      break;
+    case CCI_A_TYPE_STR:
+      elem_size = sizeof (char *);
+      break;
+    default:
+      return CCI_ER_ATYPE;
+    }
+
+  cur_index = req_handle->cur_fetch_tuple_index;
+  num_fetched = req_handle->fetched_tuple_end - req_handle->fetched_tuple_begin + 1;
+  num_rows = MIN (num_rows, num_fetched - cur_index);
+
+  is_typed = (req_handle->handle_type == HANDLE_PREPARE && req_handle->stmt_type != CUBRID_STMT_CALL_SP
+	      && col_no > 0 && col_no <= req_handle->num_col_info);
+  if (is_typed)
+    {
+      u_ext_type = CCI_GET_RESULT_INFO_TYPE (req_handle->col_info, col_no);
+      is_typed = (u_ext_type != CCI_U_TYPE_NULL);
+      u_type = get_basic_utype (u_ext_type);
+    }
+
+  if (a_type == CCI_A_TYPE_STR
+      && (!is_typed
+	  || (u_type != CCI_U_TYPE_CHAR && u_type != CCI_U_TYPE_STRING && u_type != CCI_U_TYPE_NCHAR
+	      && u_type != CCI_U_TYPE_VARNCHAR && u_type != CCI_U_TYPE_NUMERIC && u_type != CCI_U_TYPE_ENUM)))
+    {
+      /* the values would share the conversion buffer */
+      return CCI_ER_TYPE_CONVERSION;
+    }
+
+  if (!is_typed)
+    {
+      /* the type of each value comes with the value */
+      for (i = 0; i < num_rows && err_code >= 0; i++)
+	{
+	  req_handle->cur_fetch_tuple_index = cur_index + i;
+	  err_code =
+	    qe_get_data (con_handle, req_handle, col_no, a_type, (char *) values + i * elem_size, &indicators[i]);
+	}
+      req_handle->cur_fetch_tuple_index = cur_index;
+
+      return (err_code < 0) ? err_code : num_rows;
+    }
+
+  for (i = 0; i < num_rows && err_code >= 0; i++)
+    {
+      col_value_p = get_fetched_value (req_handle, cur_index + i, col_no - 1, &data_size);
+      if (data_size <= 0)
+	{
+	  indicators[i] = -1;
+	  if (a_type == CCI_A_TYPE_STR)
+	    {
+	      ((char **) values)[i] = NULL;
+	    }
+	  continue;
+	}
+
+      indicators[i] = 0;
+
+      switch (a_type)
+	{
+	case CCI_A_TYPE_STR:
+	  err_code =
+	    qe_get_data_str (&(req_handle->conv_value_buffer), u_type, col_value_p, data_size, (char **) values + i,
+			     &indicators[i]);
+	  break;
+	case CCI_A_TYPE_BIGINT:
+	  err_code = qe_get_data_bigint (u_type, col_value_p, (INT64 *) values + i);
+	  break;
+	case CCI_A_TYPE_UBIGINT:
+	  err_code = qe_get_data_ubigint (u_type, col_value_p, (UINT64 *) values + i);
+	  break;
+	case CCI_A_TYPE_INT:
+	  err_code = qe_get_data_int (u_type, col_value_p, (int *) values + i);
+	  break;
+	case CCI_A_TYPE_UINT:
+	  err_code = qe_get_data_uint (u_type, col_value_p, (unsigned int *) values + i);
+	  break;
+	case CCI_A_TYPE_FLOAT:
+	  err_code = qe_get_data_float (u_type, col_value_p, (float *) values + i);
+	  break;
+	case CCI_A_TYPE_DOUBLE:
+	  err_code = qe_get_data_double (u_type, col_value_p, (double *) values + i);
+	  break;
+	default:
+	  assert (false);
+	  break;
+	}
+    }
+
+  return (err_code < 0) ? err_code : num_rows;
+}
+
 int
 qe_get_cur_oid (T_REQ_HANDLE * req_handle, char *oid_str_buf)
 {
@@ -5169,6 +5338,288 @@ fetch_info_decode_error:
   return err_code;
 }
 
+/*
+ * fetch_batch_decode () - decode a column-oriented fetch batch
+ *   return: number of tuples or error code
+ *   buf(in): fetch result
+ *   size(in): size of buf
+ *   num_cols(in):
+ *   req_handle(in/out): tuple_value and column_batch are set
+ *   con_handle(in):
+ *
+ * Note: See fetch_result_columnar () of the CAS for the layout. The values
+ *       point into the result message or into the decompressed batch.
+ */
+static int
+fetch_batch_decode (char *buf, int size, int num_cols, T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle)
+{
+  int remain_size = size;
+  char *cur_p = buf;
+  int batch_remain;
+  char *batch_p;
+  int num_tuple, first_index, i, j;
+  int bitmap_size, data_size;
+  int offset, prev_offset;
+  char encoding, include_oid;
+  T_TUPLE_VALUE *tmp_tuple_value = NULL;
+  T_COLUMN_BATCH *batch = NULL;
+  T_COLUMN_VECTOR *column;
+  int err_code = CCI_ER_COMMUNICATION;
+
+  if (remain_size < NET_SIZE_INT)
+    {
+      return CCI_ER_COMMUNICATION;
+    }
+
+  NET_STR_TO_INT (num_tuple, cur_p);
+  if (num_tuple <= 0)
+    {
+      /* nothing but the end of the result */
+      return fetch_info_decode (buf, size, num_cols, &(req_handle->tuple_value), FETCH_FETCH, req_handle, con_handle);
+    }
+  remain_size -= NET_SIZE_INT;
+  cur_p += NET_SIZE_INT;
+
+  batch = (T_COLUMN_BATCH *) MALLOC (sizeof (T_COLUMN_BATCH));
+  if (batch == NULL)
+    {
+      return CCI_ER_NO_MORE_MEMORY;
+    }
+  memset (batch, 0, sizeof (T_COLUMN_BATCH));
+
+  batch->columns = (T_COLUMN_VECTOR *) MALLOC (sizeof (T_COLUMN_VECTOR) * num_cols);
+  tmp_tuple_value = (T_TUPLE_VALUE *) MALLOC (sizeof (T_TUPLE_VALUE) * num_tuple);
+  if (batch->columns == NULL || tmp_tuple_value == NULL)
+    {
+      err_code = CCI_ER_NO_MORE_MEMORY;
+      goto fetch_batch_decode_error;
+    }
+  memset (tmp_tuple_value, 0, sizeof (T_TUPLE_VALUE) * num_tuple);
+
+  if (remain_size < NET_SIZE_BYTE)
+    {
+      goto fetch_batch_decode_error;
+    }
+  NET_STR_TO_BYTE (encoding, cur_p);
+  remain_size -= NET_SIZE_BYTE;
+  cur_p += NET_SIZE_BYTE;
+
+#if defined (HAVE_LZO2)
+  if (encoding == CAS_FETCH_BATCH_LZO)
+    {
+      int raw_size, zip_size;
+      lzo_uint unzip_size;
+
+      if (remain_size < NET_SIZE_INT * 2)
+	{
+	  goto fetch_batch_decode_error;
+	}
+      NET_STR_TO_INT (raw_size, cur_p);
+      NET_STR_TO_INT (zip_size, cur_p + NET_SIZE_INT);
+      remain_size -= NET_SIZE_INT * 2;
+      cur_p += NET_SIZE_INT * 2;
+
+      if (raw_size <= 0 || zip_size <= 0 || remain_size < zip_size)
+	{
+	  goto fetch_batch_decode_error;
+	}
+
+      batch->unzip_buf = (char *) MALLOC (raw_size);
+      if (batch->unzip_buf == NULL)
+	{
+	  err_code = CCI_ER_NO_MORE_MEMORY;
+	  goto fetch_batch_decode_error;
+	}
+
+      unzip_size = (lzo_uint) raw_size;
+      if (lzo1x_decompress_safe ((lzo_bytep) cur_p, (lzo_uint) zip_size, (lzo_bytep) batch->unzip_buf, &unzip_size,
+				 NULL) != LZO_E_OK || unzip_size != (lzo_uint) raw_size)
+	{
+	  goto fetch_batch_decode_error;
+	}
+      remain_size -= zip_size;
+      cur_p += zip_size;
+
+      batch_p = batch->unzip_buf;
+      batch_remain = raw_size;
+    }
+  else
+#endif /* HAVE_LZO2 */
+  if (encoding == CAS_FETCH_BATCH_PLAIN)
+    {
+      batch_p = cur_p;
+      batch_remain = remain_size;
+    }
+  else
+    {
+      goto fetch_batch_decode_error;
+    }
+
+  if (batch_remain < NET_SIZE_INT + NET_SIZE_BYTE)
+    {
+      goto fetch_batch_decode_error;
+    }
+  NET_STR_TO_INT (first_index, batch_p);
+  NET_STR_TO_BYTE (include_oid, batch_p + NET_SIZE_INT);
+  batch_remain -= NET_SIZE_INT + NET_SIZE_BYTE;
+  batch_p += NET_SIZE_INT + NET_SIZE_BYTE;
+
+  if (include_oid && batch_remain / NET_SIZE_OBJECT < num_tuple)
+    {
+      goto fetch_batch_decode_error;
+    }
+
+  for (i = 0; i < num_tuple; i++)
+    {
+      tmp_tuple_value[i].tuple_index = first_index + i;
+      if (include_oid)
+	{
+	  stream_to_obj (batch_p, &(tmp_tuple_value[i].tuple_oid));
+	  batch_remain -= NET_SIZE_OBJECT;
+	  batch_p += NET_SIZE_OBJECT;
+	}
+    }
+
+  bitmap_size = (num_tuple + 7) / 8;
+  for (j = 0; j < num_cols; j++)
+    {
+      column = &(batch->columns[j]);
+
+      if (batch_remain < NET_SIZE_BYTE + bitmap_size + NET_SIZE_INT)
+	{
+	  goto fetch_batch_decode_error;
+	}
+      NET_STR_TO_BYTE (column->layout, batch_p);
+      column->null_bitmap = batch_p + NET_SIZE_BYTE;
+      batch_remain -= NET_SIZE_BYTE + bitmap_size;
+      batch_p += NET_SIZE_BYTE + bitmap_size;
+
+      if (column->layout == CAS_FETCH_COLUMN_FIXED)
+	{
+	  NET_STR_TO_INT (column->width, batch_p);
+	  batch_remain -= NET_SIZE_INT;
+	  batch_p += NET_SIZE_INT;
+
+	  if (column->width < 0 || (column->width > 0 && (batch_remain / column->width) < num_tuple))
+	    {
+	      goto fetch_batch_decode_error;
+	    }
+	  column->offsets = NULL;
+	  data_size = column->width * num_tuple;
+	}
+      else if (column->layout == CAS_FETCH_COLUMN_VAR)
+	{
+	  if ((batch_remain / NET_SIZE_INT) - 1 < num_tuple)
+	    {
+	      goto fetch_batch_decode_error;
+	    }
+	  column->width = 0;
+	  column->offsets = batch_p;
+	  NET_STR_TO_INT (data_size, batch_p + num_tuple * NET_SIZE_INT);
+
+	  /* get_fetched_value () trusts the offsets; they must not run backwards or past the data */
+	  prev_offset = 0;
+	  for (i = 0; i <= num_tuple; i++)
+	    {
+	      NET_STR_TO_INT (offset, batch_p + i * NET_SIZE_INT);
+	      if (offset < prev_offset || offset > data_size)
+		{
+		  goto fetch_batch_decode_error;
+		}
+	      prev_offset = offset;
+	    }
+
+	  batch_remain -= (num_tuple + 1) * NET_SIZE_INT;
+	  batch_p += (num_tuple + 1) * NET_SIZE_INT;
+	}
+      else
+	{
+	  goto fetch_batch_decode_error;
+	}
+
+      if (data_size < 0 || batch_remain < data_size)
+	{
+	  goto fetch_batch_decode_error;
+	}
+      column->data = batch_p;
+      batch_remain -= data_size;
+      batch_p += data_size;
+    }
+
+  if (encoding == CAS_FETCH_BATCH_PLAIN)
+    {
+      remain_size = batch_remain;
+      cur_p = batch_p;
+    }
+
+  if (hm_get_broker_version (con_handle) >= CAS_PROTO_MAKE_VER (PROTOCOL_V5))
+    {
+      if (remain_size < NET_SIZE_BYTE)
+	{
+	  goto fetch_batch_decode_error;
+	}
+
+      NET_STR_TO_BYTE (req_handle->is_fetch_completed, cur_p);
+    }
+
+  req_handle->tuple_value = tmp_tuple_value;
+  req_handle->column_batch = batch;
+
+  return num_tuple;
+
+fetch_batch_decode_error:
+  FREE_MEM (tmp_tuple_value);
+  FREE_MEM (batch->unzip_buf);
+  FREE_MEM (batch->columns);
+  FREE_MEM (batch);
+
+  return err_code;
+}
+
+/*
+ * get_fetched_value () - get a value of a fetched tuple
+ *   return: pointer to the value
+ *   req_handle(in):
+ *   tuple_index(in): index of the tuple among the fetched tuples
+ *   col_index(in): column index starting from 0
+ *   data_size(out): size of the value; 0 or less for NULL
+ */
+static char *
+get_fetched_value (T_REQ_HANDLE * req_handle, int tuple_index, int col_index, int *data_size)
+{
+  T_COLUMN_VECTOR *column;
+  char *col_value_p;
+  int begin, end;
+
+  if (req_handle->column_batch == NULL)
+    {
+      col_value_p = req_handle->tuple_value[tuple_index].column_ptr[col_index];
+      NET_STR_TO_INT (*data_size, col_value_p);
+
+      return col_value_p + NET_SIZE_INT;
+    }
+
+  column = &(req_handle->column_batch->columns[col_index]);
+
+  if (column->null_bitmap[tuple_index / 8] & (1 << (tuple_index % 8)))
+    {
+      *data_size = -1;
+      return NULL;
+    }
+
+  if (column->layout == CAS_FETCH_COLUMN_FIXED)
+    {
+      *data_size = column->width;
+      return column->data + tuple_index * column->width;
+    }
+
+  NET_STR_TO_INT (begin, column->offsets + tuple_index * NET_SIZE_INT);
+  NET_STR_TO_INT (end, column->offsets + (tuple_index + 1) * NET_SIZE_INT);
+  *data_size = end - begin;
+
+  return column->data + begin;
+}
+
 static void
 stream_to_obj (char *buf, T_OBJECT * obj)
 {
@@ -7083,7 +7534,7 @@ param_decode_error:
 
 static int
 decode_fetch_result (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, char *result_msg_org, char *result_msg_start,
-		     int result_msg_size)
+		     int result_msg_size, bool is_columnar)
 {
   int num_cols;
   int num_tuple;
@@ -7097,9 +7548,16 @@ decode_fetch_result (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, char
       num_cols = req_handle->num_col_info;
     }
 
-  num_tuple =
-    fetch_info_decode (result_msg_start, result_msg_size, num_cols, &(req_handle->tuple_value), FETCH_FETCH, req_handle,
-		       con_handle);
+  if (is_columnar)
+    {
+      num_tuple = fetch_batch_decode (result_msg_start, result_msg_size, num_cols, req_handle, con_handle);
+    }
+  else
+    {
+      num_tuple =
+	fetch_info_decode (result_msg_start, result_msg_size, num_cols, &(req_handle->tuple_value), FETCH_FETCH,
+			   req_handle, con_handle);
+    }
   if (num_tuple < 0)
     {
       return num_tuple;
@@ -422,6 +422,8 @@ extern int qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char
 		     T_CCI_ERROR * err_buf);
 extern int qe_get_data (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, int col_no, int a_type, void *value,
 			int *indicator);
+extern int qe_get_data_array (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, int col_no, int a_type,
+			      void *values, int *indicators, int num_rows);
 extern int qe_get_cur_oid (T_REQ_HANDLE * req_handle, char *oid_str_buf);
 extern int qe_schema_info (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, int type, char *arg1, char *arg2,
 			   char flag, int shard_id, T_CCI_ERROR * err_buf);
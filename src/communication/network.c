@@ -443,6 +443,93 @@ net_pack_stats (char *buf, MNT_SERVER_EXEC_STATS * stats)
   OR_PUT_INT64 (ptr, &(stats->vac_worker_execute));
   ptr += OR_INT64_SIZE;
 
+  OR_PUT_INT64 (ptr, &(stats->pb_num_hash_lockfree_hits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_num_lru_mutex_waits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_num_lru_relocate_skips));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_num_victim_lru_probes));
+  ptr += OR_INT64_SIZE;
+
+  OR_PUT_INT64 (ptr, &(stats->log_gc_batch_1));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_gc_batch_2_3));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_gc_batch_4_7));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_gc_batch_8_15));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_gc_batch_16_31));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_gc_batch_32_over));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_gc_committers));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_commit_wait_under_100us));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_commit_wait_under_1ms));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_commit_wait_under_10ms));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_commit_wait_under_100ms));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_commit_wait_100ms_over));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->log_commit_wait_time));
+  ptr += OR_INT64_SIZE;
+
+  OR_PUT_INT64 (ptr, &(stats->pb_numa_node0_hits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_numa_node0_misses));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_numa_node1_hits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_numa_node1_misses));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_numa_node2_hits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_numa_node2_misses));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_numa_node3_hits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_numa_node3_misses));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->pb_numa_remote_fixes));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_csect_waits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_csect_wait_time));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_rwlock_waits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_rwlock_wait_time));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_rmutex_waits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_rmutex_wait_time));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_latch_waits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_latch_wait_time));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_lock_waits));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_lock_wait_time));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_wait_under_100us));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_wait_under_1ms));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_wait_under_10ms));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_wait_under_100ms));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_wait_under_1s));
+  ptr += OR_INT64_SIZE;
+  OR_PUT_INT64 (ptr, &(stats->sync_wait_1s_over));
+  ptr += OR_INT64_SIZE;
+
   OR_PUT_INT64 (ptr, &(stats->pb_hit_ratio));
   ptr += OR_INT64_SIZE;
   OR_PUT_INT64 (ptr, &(stats->log_hit_ratio));
@@ -967,6 +1054,93 @@ net_unpack_stats (char *buf, MNT_SERVER_EXEC_STATS * stats)
   OR_GET_INT64 (ptr, &(stats->vac_worker_execute));
   ptr += OR_INT64_SIZE;
 
+  OR_GET_INT64 (ptr, &(stats->pb_num_hash_lockfree_hits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_num_lru_mutex_waits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_num_lru_relocate_skips));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_num_victim_lru_probes));
+  ptr += OR_INT64_SIZE;
+
+  OR_GET_INT64 (ptr, &(stats->log_gc_batch_1));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_gc_batch_2_3));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_gc_batch_4_7));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_gc_batch_8_15));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_gc_batch_16_31));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_gc_batch_32_over));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_gc_committers));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_commit_wait_under_100us));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_commit_wait_under_1ms));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_commit_wait_under_10ms));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_commit_wait_under_100ms));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_commit_wait_100ms_over));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->log_commit_wait_time));
+  ptr += OR_INT64_SIZE;
+
+  OR_GET_INT64 (ptr, &(stats->pb_numa_node0_hits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_numa_node0_misses));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_numa_node1_hits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_numa_node1_misses));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_numa_node2_hits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_numa_node2_misses));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_numa_node3_hits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_numa_node3_misses));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->pb_numa_remote_fixes));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_csect_waits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_csect_wait_time));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_rwlock_waits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_rwlock_wait_time));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_rmutex_waits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_rmutex_wait_time));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_latch_waits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_latch_wait_time));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_lock_waits));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_lock_wait_time));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_wait_under_100us));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_wait_under_1ms));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_wait_under_10ms));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_wait_under_100ms));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_wait_under_1s));
+  ptr += OR_INT64_SIZE;
+  OR_GET_INT64 (ptr, &(stats->sync_wait_1s_over));
+  ptr += OR_INT64_SIZE;
+
   OR_GET_INT64 (ptr, &(stats->pb_hit_ratio));
   ptr += OR_INT64_SIZE;
   OR_GET_INT64 (ptr, &(stats->log_hit_ratio));
@@ -253,6 +253,7 @@ enum net_server_request
 
   /* Followings are not grouped because they are appended after the above. It is necessary to rearrange with changing
    * network compatibility. */
+  NET_SERVER_SES_BIND_SHARED_PREPARED_STATEMENT,
 
   /* 
    * This is the last entry. It is also used for the end of an
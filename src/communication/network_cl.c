@@ -649,6 +649,8 @@ net_histo_setup_names (void)
   net_Req_buffer[NET_SERVER_SES_CREATE_PREPARED_STATEMENT].name = "NET_SERVER_SES_CREATE_PREPARED_STATEMENT";
   net_Req_buffer[NET_SERVER_SES_GET_PREPARED_STATEMENT].name = "NET_SERVER_SES_GET_PREPARED_STATEMENT";
   net_Req_buffer[NET_SERVER_SES_DELETE_PREPARED_STATEMENT].name = "NET_SERVER_SES_DELETE_PREPARED_STATEMENT";
+  net_Req_buffer[NET_SERVER_SES_BIND_SHARED_PREPARED_STATEMENT].name =
+    "NET_SERVER_SES_BIND_SHARED_PREPARED_STATEMENT";
   net_Req_buffer[NET_SERVER_SES_SET_SESSION_VARIABLES].name = "NET_SERVER_SES_SET_SESSION_VARIABLES";
   net_Req_buffer[NET_SERVER_SES_GET_SESSION_VARIABLE].name = "NET_SERVER_SES_GET_SESSION_VARIABLE";
   net_Req_buffer[NET_SERVER_SES_DROP_SESSION_VARIABLES].name = "NET_SERVER_SES_DROP_SESSION_VARIABLES";
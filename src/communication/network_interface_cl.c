@@ -4803,11 +4803,16 @@ csession_reset_cur_insert_id (void)
  * return	  : error code or NO_ERROR
  * name (in)	  : the name of the prepared statement
  * alias_print(in): the compiled statement string
+ * sql_text (in)  : normalized statement text used to share the statement
+ *		    with other sessions, or NULL
+ * parse_flags(in): settings the statement was compiled under
+ * schema_version(in): shared statement version read before compiling
  * stmt_info (in) : serialized prepared statement information
  * info_length(in): the size of the serialized buffer
  */
 int
-csession_create_prepared_statement (const char *name, const char *alias_print, char *stmt_info, int info_length)
+csession_create_prepared_statement (const char *name, const char *alias_print, const char *sql_text, int parse_flags,
+				    unsigned int schema_version, char *stmt_info, int info_length)
 {
 #if defined (CS_MODE)
   int req_error;
@@ -4815,7 +4820,7 @@ csession_create_prepared_statement (const char *name, const char *alias_print, c
   char *request = NULL;
   char *reply = NULL;
   char *ptr = NULL;
-  int req_size = 0, name_len = 0, alias_print_len = 0;
+  int req_size = 0, name_len = 0, alias_print_len = 0, sql_text_len = 0;
 
   reply = OR_ALIGNED_BUF_START (a_reply);
 
@@ -4825,6 +4830,10 @@ csession_create_prepared_statement (const char *name, const char *alias_print, c
   req_size += length_const_string (name, &name_len);
   /* packed size for alias_print */
   req_size += length_const_string (alias_print, &alias_print_len);
+  /* packed size for sql_text */
+  req_size += length_const_string (sql_text, &sql_text_len);
+  /* parse_flags and schema_version */
+  req_size += OR_INT_SIZE * 2;
   /* data_size */
   req_size += OR_INT_SIZE;
 
@@ -4842,6 +4851,12 @@ csession_create_prepared_statement (const char *name, const char *alias_print, c
   ptr = pack_const_string_with_length (ptr, name, name_len);
   /* alias_print */
   ptr = pack_const_string_with_length (ptr, alias_print, alias_print_len);
+  /* sql_text */
+  ptr = pack_const_string_with_length (ptr, sql_text, sql_text_len);
+  /* parse_flags */
+  ptr = or_pack_int (ptr, parse_flags);
+  /* schema_version */
+  ptr = or_pack_int (ptr, (int) schema_version);
   /* data size */
   or_pack_int (ptr, info_length);
 
@@ -4917,7 +4932,8 @@ cleanup:
     }
 
   result =
-    xsession_create_prepared_statement (NULL, *user, local_name, local_alias_print, local_stmt_info, info_length);
+    xsession_create_prepared_statement (NULL, *user, local_name, local_alias_print, sql_text, parse_flags,
+					schema_version, local_stmt_info, info_length);
   if (result != NO_ERROR)
     {
       goto error;
@@ -5109,6 +5125,89 @@ csession_delete_prepared_statement (const char *name)
 #endif
 }
 
+/*
+ * csession_bind_shared_prepared_statement () - create a prepared session
+ *						 statement from one compiled
+ *						 by another session
+ * return	  : error code or NO_ERROR
+ * name (in)	  : the name of the prepared statement
+ * sql_text (in)  : normalized statement text
+ * parse_flags(in): settings the statement is compiled under
+ * found (out)	  : true if a shared statement was bound to name
+ * schema_version(out): shared statement version; must be passed back when
+ *			the statement is compiled and created
+ */
+int
+csession_bind_shared_prepared_statement (const char *name, const char *sql_text, int parse_flags, bool * found,
+					 unsigned int *schema_version)
+{
+#if defined (CS_MODE)
+  int req_error;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 3) a_reply;
+  char *reply = NULL;
+  char *request = NULL;
+  char *ptr = NULL;
+  int name_len, sql_text_len, req_len;
+  int found_int = 0, version = 0;
+
+  *found = false;
+  *schema_version = 0;
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  req_len = OR_OID_SIZE;
+  req_len += length_const_string (name, &name_len);
+  req_len += length_const_string (sql_text, &sql_text_len);
+  req_len += OR_INT_SIZE;
+
+  request = (char *) malloc (req_len);
+  if (request == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) req_len);
+      return ER_FAILED;
+    }
+
+  ptr = or_pack_oid (request, ws_identifier (db_get_user ()));
+  ptr = pack_const_string_with_length (ptr, name, name_len);
+  ptr = pack_const_string_with_length (ptr, sql_text, sql_text_len);
+  or_pack_int (ptr, parse_flags);
+
+  req_error =
+    net_client_request (NET_SERVER_SES_BIND_SHARED_PREPARED_STATEMENT, request, req_len, reply,
+			OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0, NULL, 0);
+  if (request != NULL)
+    {
+      free_and_init (request);
+    }
+
+  if (req_error != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  ptr = or_unpack_int (reply, &req_error);
+  ptr = or_unpack_int (ptr, &found_int);
+  ptr = or_unpack_int (ptr, &version);
+
+  *found = (found_int != 0);
+  *schema_version = (unsigned int) version;
+
+  return req_error;
+#else
+  int result = NO_ERROR;
+  OID *user;
+
+  user = ws_identifier (db_get_user ());
+
+  ENTER_SERVER ();
+
+  result = xsession_bind_shared_prepared_statement (NULL, *user, name, sql_text, parse_flags, found, schema_version);
+
+  EXIT_SERVER ();
+
+  return result;
+#endif
+}
+
 /*
  * clogin_user () - login user
  * return	  : error code or NO_ERROR
@@ -6118,12 +6217,12 @@ stats_get_statistics_from_server (OID * classoid, unsigned int timestamp, int *l
  * return:
  *
  *   classoid(in):
- *   with_fullscan(in):
+ *   sampling_percent(in): percentage of the pages to sample
  *
  * NOTE:
  */
 int
-stats_update_statistics (OID * classoid, int with_fullscan)
+stats_update_statistics (OID * classoid, int sampling_percent)
 {
 #if defined(CS_MODE)
   int error = ER_NET_CLIENT_DATA_RECEIVE;
@@ -6138,7 +6237,7 @@ stats_update_statistics (OID * classoid, int with_fullscan)
   reply = OR_ALIGNED_BUF_START (a_reply);
 
   ptr = or_pack_oid (request, classoid);
-  ptr = or_pack_int (ptr, with_fullscan);
+  ptr = or_pack_int (ptr, sampling_percent);
 
   req_error =
     net_client_request (NET_SERVER_QST_UPDATE_STATISTICS, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
@@ -6154,7 +6253,7 @@ stats_update_statistics (OID * classoid, int with_fullscan)
 
   ENTER_SERVER ();
 
-  success = xstats_update_statistics (NULL, classoid, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING));
+  success = xstats_update_statistics (NULL, classoid, sampling_percent);
 
   EXIT_SERVER ();
 
@@ -6166,12 +6265,12 @@ stats_update_statistics (OID * classoid, int with_fullscan)
  * stats_update_all_statistics -
  *
  * return:
- *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sampling_percent(in): percentage of the pages to sample
  *
  * NOTE:
  */
 int
-stats_update_all_statistics (int with_fullscan)
+stats_update_all_statistics (int sampling_percent)
 {
 #if defined(CS_MODE)
   int error = ER_NET_CLIENT_DATA_RECEIVE;
@@ -6185,7 +6284,7 @@ stats_update_all_statistics (int with_fullscan)
   request = OR_ALIGNED_BUF_START (a_request);
   reply = OR_ALIGNED_BUF_START (a_reply);
 
-  ptr = or_pack_int (request, with_fullscan);
+  ptr = or_pack_int (request, sampling_percent);
 
   req_error =
     net_client_request (NET_SERVER_QST_UPDATE_ALL_STATISTICS, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
@@ -6201,7 +6300,7 @@ stats_update_all_statistics (int with_fullscan)
 
   ENTER_SERVER ();
 
-  success = xstats_update_all_statistics (NULL, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING));
+  success = xstats_update_all_statistics (NULL, sampling_percent);
 
   EXIT_SERVER ();
 
@@ -199,8 +199,8 @@ extern INT64 largeobjmgr_truncate (LOID * loid, INT64 offset);
 extern int largeobjmgr_compress (LOID * loid);
 extern INT64 largeobjmgr_length (LOID * loid);
 extern char *stats_get_statistics_from_server (OID * classoid, unsigned int timestamp, int *length_ptr);
-extern int stats_update_statistics (OID * classoid, int with_fullscan);
-extern int stats_update_all_statistics (int with_fullscan);
+extern int stats_update_statistics (OID * classoid, int sampling_percent);
+extern int stats_update_all_statistics (int sampling_percent);
 
 extern int btree_add_index (BTID * btid, TP_DOMAIN * key_type, OID * class_oid, int attr_id, int unique_pk);
 extern int btree_load_index (BTID * btid, const char *bt_name, TP_DOMAIN * key_type, OID * class_oids, int n_classes,
@@ -384,12 +384,15 @@ extern int csession_set_row_count (int rows);
 extern int csession_get_row_count (int *rows);
 extern int csession_get_last_insert_id (DB_VALUE * value, bool update_last_insert_id);
 extern int csession_reset_cur_insert_id (void);
-extern int csession_create_prepared_statement (const char *name, const char *alias_print, char *stmt_info,
+extern int csession_create_prepared_statement (const char *name, const char *alias_print, const char *sql_text,
+					       int parse_flags, unsigned int schema_version, char *stmt_info,
 					       int info_length);
 extern int csession_get_prepared_statement (const char *name, XASL_ID * xasl_id, char **stmt_info,
 					    XASL_NODE_HEADER * xasl_header_p);
 
 extern int csession_delete_prepared_statement (const char *name);
+extern int csession_bind_shared_prepared_statement (const char *name, const char *sql_text, int parse_flags,
+						    bool * found, unsigned int *schema_version);
 
 extern int clogin_user (const char *username);
 
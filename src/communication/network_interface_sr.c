@@ -4133,16 +4133,16 @@ slargeobjmgr_length (THREAD_ENTRY * thread_p, unsigned int rid, char *request, i
 void
 sqst_update_statistics (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
 {
-  int error, with_fullscan;
+  int error, sampling_percent;
   OID classoid;
   char *ptr;
   OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
 
   ptr = or_unpack_oid (request, &classoid);
-  ptr = or_unpack_int (ptr, &with_fullscan);
+  ptr = or_unpack_int (ptr, &sampling_percent);
 
-  error = xstats_update_statistics (thread_p, &classoid, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING));
+  error = xstats_update_statistics (thread_p, &classoid, sampling_percent);
   if (error != NO_ERROR)
     {
       return_error_to_client (thread_p, rid);
@@ -4166,14 +4166,14 @@ sqst_update_statistics (THREAD_ENTRY * thread_p, unsigned int rid, char *request
 void
 sqst_update_all_statistics (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
 {
-  int error, with_fullscan;
+  int error, sampling_percent;
   char *ptr;
   OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
 
-  ptr = or_unpack_int (request, &with_fullscan);
+  ptr = or_unpack_int (request, &sampling_percent);
 
-  error = xstats_update_all_statistics (thread_p, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING));
+  error = xstats_update_all_statistics (thread_p, sampling_percent);
   if (error != NO_ERROR)
     {
       return_error_to_client (thread_p, rid);
@@ -9112,11 +9112,12 @@ void
 ssession_create_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
 {
   /* request data */
-  char *name = NULL, *alias_print = NULL;
+  char *name = NULL, *alias_print = NULL, *sql_text = NULL;
   char *reply = NULL, *ptr = NULL;
   char *data_request = NULL;
   OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
   int data_size = 0, err = 0, i = 0;
+  int parse_flags = 0, schema_version = 0;
   OID user;
   char *info = NULL;
 
@@ -9128,8 +9129,14 @@ ssession_create_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, c
   ptr = or_unpack_string_alloc (ptr, &name);
   /* alias_print */
   ptr = or_unpack_string_alloc (ptr, &alias_print);
+  /* sql_text; NULL if the statement is not shared */
+  ptr = or_unpack_string_nocopy (ptr, &sql_text);
+  /* parse_flags */
+  ptr = or_unpack_int (ptr, &parse_flags);
+  /* schema_version */
+  ptr = or_unpack_int (ptr, &schema_version);
   /* data_size */
-  ptr = or_unpack_int (request, &data_size);
+  ptr = or_unpack_int (ptr, &data_size);
   if (data_size <= 0)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
@@ -9156,7 +9163,9 @@ ssession_create_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, c
     }
   memcpy (info, data_request, data_size);
 
-  err = xsession_create_prepared_statement (thread_p, user, name, alias_print, info, data_size);
+  err =
+    xsession_create_prepared_statement (thread_p, user, name, alias_print, sql_text, parse_flags,
+					(unsigned int) schema_version, info, data_size);
 
   if (err != NO_ERROR)
     {
@@ -9335,6 +9344,49 @@ ssession_delete_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, c
   css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
 }
 
+/*
+ * ssession_bind_shared_prepared_statement - create a prepared statement from
+ *					     one shared by another session
+ * return: error code or NO_ERROR
+ *   rid(in):
+ *   request(in):
+ *   reqlen(in):
+ */
+void
+ssession_bind_shared_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
+{
+  int err = NO_ERROR;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 3) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+  char *ptr = NULL;
+  char *name = NULL, *sql_text = NULL;
+  int parse_flags = 0;
+  bool found = false;
+  unsigned int schema_version = 0;
+  OID user;
+
+  /* user */
+  ptr = or_unpack_oid (request, &user);
+  /* name */
+  ptr = or_unpack_string_nocopy (ptr, &name);
+  /* sql_text */
+  ptr = or_unpack_string_nocopy (ptr, &sql_text);
+  /* parse_flags */
+  ptr = or_unpack_int (ptr, &parse_flags);
+
+  err = xsession_bind_shared_prepared_statement (thread_p, user, name, sql_text, parse_flags, &found, &schema_version);
+  if (err != NO_ERROR)
+    {
+      return_error_to_client (thread_p, rid);
+    }
+
+  ptr = or_pack_int (reply, err);
+  ptr = or_pack_int (ptr, found ? 1 : 0);
+  ptr = or_pack_int (ptr, (int) schema_version);
+
+  css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
+}
+
 /*
  * slogin_user - login user
  * return: error code or NO_ERROR
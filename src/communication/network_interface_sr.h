@@ -218,6 +218,8 @@ extern void ssession_reset_cur_insert_id (THREAD_ENTRY * thread_p, unsigned int
 extern void ssession_create_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void ssession_get_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void ssession_delete_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
+extern void ssession_bind_shared_prepared_statement (THREAD_ENTRY * thread_p, unsigned int rid, char *request,
+						     int reqlen);
 extern void slogin_user (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void ssession_set_session_variables (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void ssession_get_session_variable (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
@@ -848,6 +848,10 @@ net_server_init (void)
   req_p->processing_function = ssession_delete_prepared_statement;
   req_p->name = "NET_SERVER_SES_DELETE_PREPARED_STATEMENT";
 
+  req_p = &net_Requests[NET_SERVER_SES_BIND_SHARED_PREPARED_STATEMENT];
+  req_p->processing_function = ssession_bind_shared_prepared_statement;
+  req_p->name = "NET_SERVER_SES_BIND_SHARED_PREPARED_STATEMENT";
+
   req_p = &net_Requests[NET_SERVER_SES_SET_SESSION_VARIABLES];
   req_p->processing_function = ssession_set_session_variables;
   req_p->name = "NET_SERVER_SES_SET_SESSION_VARIABLES";
@@ -80,6 +80,8 @@ static void copy_execution_values (EXECUTION_STATE_VALUES * source, EXECUTION_ST
 static int values_list_to_values_array (PARSER_CONTEXT * parser, PT_NODE * values_list, DB_VALUE_ARRAY * values_array);
 static int set_prepare_info_into_list (DB_PREPARE_INFO * prepare_info, PT_NODE * statement);
 static PT_NODE *char_array_to_name_list (PARSER_CONTEXT * parser, char **names, int length);
+static char *db_normalize_shared_statement_text (const char *text);
+static int db_get_shared_statement_parse_flags (DB_SESSION * session);
 static int do_process_prepare_statement (DB_SESSION * session, PT_NODE * statement);
 static int do_get_prepared_statement_info (DB_SESSION * session, int stmt_idx);
 static int do_set_user_host_variables (DB_SESSION * session, PT_NODE * using_list);
@@ -2208,6 +2210,151 @@ char_array_to_name_list (PARSER_CONTEXT * parser, char **names, int length)
   return list;
 }
 
+/*
+ * db_normalize_shared_statement_text () - normalize the text of a prepared
+ *					   statement so that it can be shared
+ *					   between sessions
+ * return: allocated normalized text or NULL if the statement is not shared
+ * text (in) : statement text
+ *
+ * Note: Runs of white space outside of quotes and [bracketed] identifiers
+ *	 are collapsed to a single space and leading and trailing blanks and
+ *	 semicolons are removed.
+ *	 Statements holding comments are not shared, since collapsing a new
+ *	 line may change what a comment covers.
+ */
+static char *
+db_normalize_shared_statement_text (const char *text)
+{
+  char *normalized, *q;
+  const char *p;
+  char quote = 0;		/* the character closing the quote */
+  bool backslash_escapes = !prm_get_bool_value (PRM_ID_NO_BACKSLASH_ESCAPES);
+  bool pending_space = false;
+
+  normalized = (char *) malloc (strlen (text) + 1);
+  if (normalized == NULL)
+    {
+      return NULL;
+    }
+
+  q = normalized;
+  for (p = text; *p != '\0'; p++)
+    {
+      if (quote != 0)
+	{
+	  *q++ = *p;
+	  if (*p == '\\' && backslash_escapes && (quote == '\'' || quote == '"') && p[1] != '\0')
+	    {
+	      *q++ = *++p;
+	    }
+	  else if (*p == quote)
+	    {
+	      quote = 0;
+	    }
+	  continue;
+	}
+
+      if (char_isspace (*p))
+	{
+	  pending_space = (q != normalized);
+	  continue;
+	}
+
+      if ((p[0] == '-' && p[1] == '-') || (p[0] == '/' && (p[1] == '/' || p[1] == '*')))
+	{
+	  free_and_init (normalized);
+	  return NULL;
+	}
+
+      if (pending_space)
+	{
+	  *q++ = ' ';
+	  pending_space = false;
+	}
+
+      if (*p == '\'' || *p == '"' || *p == '`')
+	{
+	  quote = *p;
+	}
+      else if (*p == '[')
+	{
+	  quote = ']';
+	}
+      *q++ = *p;
+    }
+
+  if (quote != 0)
+    {
+      /* unterminated quote; let the parser report it */
+      free_and_init (normalized);
+      return NULL;
+    }
+
+  while (q > normalized && (q[-1] == ';' || q[-1] == ' '))
+    {
+      q--;
+    }
+  *q = '\0';
+
+  return normalized;
+}
+
+/*
+ * db_get_shared_statement_parse_flags () - get the settings a prepared
+ *					    statement is compiled under
+ * return: parse flags
+ * session (in) : client session
+ *
+ * Note: A shared prepared statement is only reused by sessions which would
+ *	 compile its text to the same statement.
+ */
+static int
+db_get_shared_statement_parse_flags (DB_SESSION * session)
+{
+  int flags = 0;
+
+  if (session->include_oid)
+    {
+      flags |= 0x01;
+    }
+  if (prm_get_bool_value (PRM_ID_ANSI_QUOTES))
+    {
+      flags |= 0x02;
+    }
+  if (prm_get_bool_value (PRM_ID_PIPES_AS_CONCAT))
+    {
+      flags |= 0x04;
+    }
+  if (prm_get_bool_value (PRM_ID_NO_BACKSLASH_ESCAPES))
+    {
+      flags |= 0x08;
+    }
+  if (prm_get_bool_value (PRM_ID_PLUS_AS_CONCAT))
+    {
+      flags |= 0x10;
+    }
+  if (prm_get_bool_value (PRM_ID_ORACLE_STYLE_EMPTY_STRING))
+    {
+      flags |= 0x20;
+    }
+  if (prm_get_bool_value (PRM_ID_ORACLE_STYLE_OUTERJOIN))
+    {
+      flags |= 0x40;
+    }
+  if (prm_get_bool_value (PRM_ID_REQUIRE_LIKE_ESCAPE_CHARACTER))
+    {
+      flags |= 0x80;
+    }
+  if (prm_get_bool_value (PRM_ID_COMPAT_NUMERIC_DIVISION_SCALE))
+    {
+      flags |= 0x100;
+    }
+  flags |= (prm_get_integer_value (PRM_ID_COMPAT_MODE) & 0xff) << 16;
+
+  return flags;
+}
+
 /*
  * do_process_prepare_statement () - execute a 'PREPARE STMT FROM ...'
  *				     statement
@@ -2228,9 +2375,28 @@ do_process_prepare_statement (DB_SESSION * session, PT_NODE * statement)
   int err = NO_ERROR;
   char *stmt_info = NULL;
   int info_len = 0;
+  char *shared_text = NULL;
+  int parse_flags = 0;
+  bool found = false;
+  unsigned int schema_version = 0;
   assert (statement->node_type == PT_PREPARE_STATEMENT);
   db_init_prepare_info (&prepare_info);
 
+  /* another session may already have compiled the same statement */
+  if (prm_get_integer_value (PRM_ID_XASL_MAX_PLAN_CACHE_ENTRIES) > 0)
+    {
+      shared_text = db_normalize_shared_statement_text (statement_literal);
+    }
+  if (shared_text != NULL)
+    {
+      parse_flags = db_get_shared_statement_parse_flags (session);
+      err = csession_bind_shared_prepared_statement (name, shared_text, parse_flags, &found, &schema_version);
+      if (err != NO_ERROR || found)
+	{
+	  goto cleanup;
+	}
+    }
+
   prepared_session = db_open_buffer_local (statement_literal);
   if (prepared_session == NULL)
     {
@@ -2312,7 +2478,9 @@ do_process_prepare_statement (DB_SESSION * session, PT_NODE * statement)
     }
   info_len = err;
 
-  err = csession_create_prepared_statement (name, prepared_stmt->alias_print, stmt_info, info_len);
+  err =
+    csession_create_prepared_statement (name, prepared_stmt->alias_print, shared_text, parse_flags, schema_version,
+					stmt_info, info_len);
 
 cleanup:
   if (err < 0 && name != NULL)
@@ -2328,6 +2496,11 @@ cleanup:
       free_and_init (stmt_info);
     }
 
+  if (shared_text != NULL)
+    {
+      free_and_init (shared_text);
+    }
+
   if (prepared_session)
     {
       db_close_session_local (prepared_session);
@@ -426,6 +426,17 @@ struct css_queue_entry
 };
 #if defined(SERVER_MODE)
 struct session_state;
+
+/*
+ * The pieces of a packet read from a non-blocking socket
+ */
+enum css_read_phase
+{
+  CSS_READ_HEADER_SIZE = 0,	/* nothing read yet, or reading the size of the header */
+  CSS_READ_HEADER,
+  CSS_READ_DATA_SIZE,		/* the header of a data or error packet is followed by the data */
+  CSS_READ_DATA
+};
 #endif
 /*
  * This data structure is the interface between the client and the
@@ -451,6 +462,14 @@ struct css_conn_entry
   bool stop_talk;		/* block and stop this connection */
   bool ignore_repl_delay;	/* don't do reset_on_commit by the delay of replication */
   unsigned short stop_phase;
+  int dispatcher_index;		/* connection dispatcher watching this socket, -1 if none */
+
+  /* packet read in pieces from the non-blocking socket; see css_read_and_queue_nonblocking () */
+  int read_phase;		/* enum css_read_phase */
+  int read_offset;		/* bytes of the current piece read so far */
+  int read_length;		/* length of the data being read */
+  NET_HEADER read_header;
+  char *read_data;
 
   char *version_string;		/* client version string */
 
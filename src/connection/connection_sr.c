@@ -40,6 +40,7 @@
 #include <sys/uio.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <poll.h>
 #endif /* WINDOWS */
 
 #if defined(_AIX)
@@ -170,10 +171,12 @@ static int css_return_queued_data_timeout (CSS_CONN_ENTRY * conn, unsigned short
 					   int *rc, int waitsec);
 
 static void css_queue_data_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const NET_HEADER * header,
-				   THREAD_ENTRY ** wait_thrd);
-static void css_queue_error_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const NET_HEADER * header);
+				   const char *data, int data_size, THREAD_ENTRY ** wait_thrd);
+static void css_queue_error_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const NET_HEADER * header,
+				    const char *data, int data_size);
 static void css_queue_command_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const NET_HEADER * header,
-				      int size);
+				      int size, int data_size);
+static int css_copy_packet_data (char *buffer, int *size, const char *data, int data_size);
 #if defined (ENABLE_UNUSED_FUNCTION)
 static char *css_return_oob_buffer (int size);
 #endif
@@ -181,7 +184,10 @@ static bool css_is_valid_request_id (CSS_CONN_ENTRY * conn, unsigned short reque
 static void css_remove_unexpected_packets (CSS_CONN_ENTRY * conn, unsigned short request_id);
 
 static void css_queue_packet (CSS_CONN_ENTRY * conn, int type, unsigned short request_id, const NET_HEADER * header,
-			      int size);
+			      int size, const char *data, int data_size);
+#if !defined (WINDOWS)
+static int css_recv_piece (SOCKET fd, char *buffer, int length, int *offset);
+#endif /* !WINDOWS */
 static int css_remove_and_free_queue_entry (void *data, void *arg);
 static int css_remove_and_free_wait_queue_entry (void *data, void *arg);
 
@@ -267,6 +273,11 @@ css_initialize_conn (CSS_CONN_ENTRY * conn, SOCKET fd)
   conn->stop_talk = false;
   conn->ignore_repl_delay = false;
   conn->stop_phase = THREAD_STOP_WORKERS_EXCEPT_LOGWR;
+  conn->dispatcher_index = -1;
+  conn->read_phase = CSS_READ_HEADER_SIZE;
+  conn->read_offset = 0;
+  conn->read_length = 0;
+  conn->read_data = NULL;
   conn->version_string = NULL;
   conn->prefetcher_thread_count = 0;
   /* ignore connection handler thread */
@@ -1501,12 +1512,36 @@ css_read_and_queue (CSS_CONN_ENTRY * conn, int *type)
 {
   int rc;
   NET_HEADER header = DEFAULT_HEADER_DATA;
+#if !defined (WINDOWS)
+  struct pollfd po[1] = { {0, 0, 0} };
+#endif /* !WINDOWS */
 
   if (!conn || conn->status != CONN_OPEN)
     {
       return (ERROR_ON_READ);
     }
 
+#if !defined (WINDOWS)
+  /* finish the packet a connection dispatcher has begun to read */
+  while (conn->read_phase != CSS_READ_HEADER_SIZE || conn->read_offset > 0)
+    {
+      rc = css_read_and_queue_nonblocking (conn, type);
+      if (rc != NO_DATA_AVAILABLE)
+	{
+	  return rc;
+	}
+
+      po[0].fd = conn->fd;
+      po[0].events = POLLIN;
+      po[0].revents = 0;
+      if (poll (po, 1, -1) < 0 && errno != EINTR)
+	{
+	  css_clear_read_state (conn);
+	  return ERROR_ON_READ;
+	}
+    }
+#endif /* !WINDOWS */
+
   rc = css_read_header (conn, &header);
 
   if (conn->stop_talk == true)
@@ -1521,10 +1556,192 @@ css_read_and_queue (CSS_CONN_ENTRY * conn, int *type)
 
   *type = ntohl (header.type);
   css_queue_packet (conn, (int) ntohl (header.type), (unsigned short) ntohl (header.request_id), &header,
-		    sizeof (NET_HEADER));
+		    sizeof (NET_HEADER), NULL, -1);
   return (rc);
 }
 
+#if !defined (WINDOWS)
+/*
+ * css_read_and_queue_nonblocking() - read a packet from a non-blocking socket
+ *                                    as far as it has arrived, and queue it
+ *                                    once it is complete
+ *   return: NO_ERRORS if a packet was queued, NO_DATA_AVAILABLE if more of
+ *           it is to arrive, or error code
+ *   conn(in): connection entry
+ *   type(out): packet type
+ *
+ * Note: The pieces read so far are kept in the connection entry, so a
+ *       connection dispatcher never waits for a client. The data packet of
+ *       a command is read as the next packet.
+ */
+int
+css_read_and_queue_nonblocking (CSS_CONN_ENTRY * conn, int *type)
+{
+  int rc;
+
+  if (!conn || conn->status != CONN_OPEN)
+    {
+      return (ERROR_ON_READ);
+    }
+
+  if (conn->stop_talk == true)
+    {
+      rc = CONNECTION_CLOSED;
+      goto end;
+    }
+
+  if (conn->read_phase == CSS_READ_HEADER_SIZE)
+    {
+      rc = css_recv_piece (conn->fd, (char *) &conn->read_length, sizeof (int), &conn->read_offset);
+      if (rc != NO_ERRORS)
+	{
+	  goto end;
+	}
+
+      if ((int) ntohl (conn->read_length) != sizeof (NET_HEADER))
+	{
+	  rc = ERROR_WHEN_READING_SIZE;
+	  goto end;
+	}
+      conn->read_phase = CSS_READ_HEADER;
+      conn->read_offset = 0;
+    }
+
+  if (conn->read_phase == CSS_READ_HEADER)
+    {
+      rc = css_recv_piece (conn->fd, (char *) &conn->read_header, sizeof (NET_HEADER), &conn->read_offset);
+      if (rc != NO_ERRORS)
+	{
+	  goto end;
+	}
+
+      *type = (int) ntohl (conn->read_header.type);
+      if (*type == CLOSE_TYPE)
+	{
+	  rc = CONNECTION_CLOSED;
+	  goto end;
+	}
+
+      if (*type != DATA_TYPE && *type != ERROR_TYPE)
+	{
+	  css_queue_packet (conn, *type, (unsigned short) ntohl (conn->read_header.request_id), &conn->read_header,
+			    sizeof (NET_HEADER), NULL, 0);
+	  goto end;
+	}
+      conn->read_phase = CSS_READ_DATA_SIZE;
+      conn->read_offset = 0;
+    }
+
+  if (conn->read_phase == CSS_READ_DATA_SIZE)
+    {
+      rc = css_recv_piece (conn->fd, (char *) &conn->read_length, sizeof (int), &conn->read_offset);
+      if (rc != NO_ERRORS)
+	{
+	  goto end;
+	}
+
+      conn->read_length = (int) ntohl (conn->read_length);
+      if (conn->read_length < 0)
+	{
+	  rc = ERROR_WHEN_READING_SIZE;
+	  goto end;
+	}
+
+      /* without a buffer the data is read and thrown away, as css_read_remaining_bytes () does */
+      conn->read_data = (conn->read_length > 0) ? (char *) malloc (conn->read_length) : NULL;
+      conn->read_phase = CSS_READ_DATA;
+      conn->read_offset = 0;
+    }
+
+  assert (conn->read_phase == CSS_READ_DATA);
+
+  rc = css_recv_piece (conn->fd, conn->read_data, conn->read_length, &conn->read_offset);
+  if (rc != NO_ERRORS)
+    {
+      goto end;
+    }
+
+  *type = (int) ntohl (conn->read_header.type);
+  css_queue_packet (conn, *type, (unsigned short) ntohl (conn->read_header.request_id), &conn->read_header,
+		    sizeof (NET_HEADER), conn->read_data, conn->read_length);
+
+end:
+  if (rc != NO_DATA_AVAILABLE)
+    {
+      css_clear_read_state (conn);
+    }
+
+  return rc;
+}
+
+/*
+ * css_recv_piece() - read a piece of a packet from a non-blocking socket
+ *   return: NO_ERRORS if the piece is complete, NO_DATA_AVAILABLE if the
+ *           rest of it has not arrived yet, or ERROR_ON_READ
+ *   fd(in): socket descripter
+ *   buffer(out): buffer for the piece, NULL to throw it away
+ *   length(in): length of the piece
+ *   offset(in/out): bytes of the piece read so far
+ */
+static int
+css_recv_piece (SOCKET fd, char *buffer, int length, int *offset)
+{
+  char temp_buffer[512];
+  int n;
+
+  while (*offset < length)
+    {
+      if (buffer != NULL)
+	{
+	  n = recv (fd, buffer + *offset, length - *offset, 0);
+	}
+      else
+	{
+	  n = recv (fd, temp_buffer, MIN (length - *offset, SSIZEOF (temp_buffer)), 0);
+	}
+
+      if (n == 0)
+	{
+	  /* closed by the peer */
+	  return ERROR_ON_READ;
+	}
+      else if (n < 0)
+	{
+	  if (errno == EINTR)
+	    {
+	      continue;
+	    }
+	  if (errno == EAGAIN || errno == EWOULDBLOCK)
+	    {
+	      return NO_DATA_AVAILABLE;
+	    }
+	  return ERROR_ON_READ;
+	}
+
+      *offset += n;
+    }
+
+  return NO_ERRORS;
+}
+
+/*
+ * css_clear_read_state() - forget the packet being read from a non-blocking socket
+ *   return: void
+ *   conn(in): connection entry
+ */
+void
+css_clear_read_state (CSS_CONN_ENTRY * conn)
+{
+  if (conn->read_data != NULL)
+    {
+      free_and_init (conn->read_data);
+    }
+  conn->read_phase = CSS_READ_HEADER_SIZE;
+  conn->read_offset = 0;
+  conn->read_length = 0;
+}
+#endif /* !WINDOWS */
+
 /*
  * css_receive_data() - receive a data for an associated request.
  *   return: 0 if success, or error code
@@ -1890,9 +2107,12 @@ css_find_and_remove_wait_queue_entry (CSS_LIST * list, unsigned int key)
  *   request_id(in): request id
  *   header(in): network header
  *   size(in): packet size
+ *   data(in): data following the header, already read from the socket
+ *   data_size(in): size of data, or -1 to read the data from the socket
  */
 static void
-css_queue_packet (CSS_CONN_ENTRY * conn, int type, unsigned short request_id, const NET_HEADER * header, int size)
+css_queue_packet (CSS_CONN_ENTRY * conn, int type, unsigned short request_id, const NET_HEADER * header, int size,
+		  const char *data, int data_size)
 {
   THREAD_ENTRY *wait_thrd = NULL, *p, *next;
   unsigned short flags = 0;
@@ -1917,13 +2137,13 @@ css_queue_packet (CSS_CONN_ENTRY * conn, int type, unsigned short request_id, co
       css_process_abort_packet (conn, request_id);
       break;
     case DATA_TYPE:
-      css_queue_data_packet (conn, request_id, header, &wait_thrd);
+      css_queue_data_packet (conn, request_id, header, data, data_size, &wait_thrd);
       break;
     case ERROR_TYPE:
-      css_queue_error_packet (conn, request_id, header);
+      css_queue_error_packet (conn, request_id, header, data, data_size);
       break;
     case COMMAND_TYPE:
-      css_queue_command_packet (conn, request_id, header, size);
+      css_queue_command_packet (conn, request_id, header, size, data_size);
       break;
     default:
       CSS_TRACE2 ("Asked to queue an unknown packet id = %d.\n", type);
@@ -2010,11 +2230,13 @@ css_process_abort_packet (CSS_CONN_ENTRY * conn, unsigned short request_id)
  *   conn(in): connection entry
  *   request_id(in): request id
  *   header(in): network header
+ *   data(in): data already read from the socket
+ *   data_size(in): size of data, or -1 to read the data from the socket
  *   wake_thrd(out): thread that wake up
  */
 static void
 css_queue_data_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const NET_HEADER * header,
-		       THREAD_ENTRY ** wake_thrd)
+		       const char *data, int data_size, THREAD_ENTRY ** wake_thrd)
 {
   THREAD_ENTRY *thrd = NULL, *last = NULL;
   CSS_QUEUE_ENTRY *buffer_entry;
@@ -2081,7 +2303,14 @@ css_queue_data_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const N
   /* receive data into buffer and queue data if there's no waiting thread */
   if (buffer != NULL)
     {
-      rc = css_net_recv (conn->fd, buffer, &size, -1);
+      if (data_size < 0)
+	{
+	  rc = css_net_recv (conn->fd, buffer, &size, -1);
+	}
+      else
+	{
+	  rc = css_copy_packet_data (buffer, &size, data, data_size);
+	}
       if (rc == NO_ERRORS || rc == RECORD_TRUNCATED)
 	{
 	  if (!css_is_request_aborted (conn, request_id))
@@ -2110,7 +2339,10 @@ css_queue_data_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const N
   else
     {
       rc = CANT_ALLOC_BUFFER;
-      css_read_remaining_bytes (conn->fd, sizeof (int) + size);
+      if (data_size < 0)
+	{
+	  css_read_remaining_bytes (conn->fd, sizeof (int) + size);
+	}
       if (!css_is_request_aborted (conn, request_id))
 	{
 	  if (data_wait == NULL)
@@ -2137,9 +2369,12 @@ css_queue_data_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const N
  *   conn(in): connection entry
  *   request_id(in): request id
  *   header(in): network header
+ *   data(in): data already read from the socket
+ *   data_size(in): size of data, or -1 to read the data from the socket
  */
 static void
-css_queue_error_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const NET_HEADER * header)
+css_queue_error_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const NET_HEADER * header,
+			const char *data, int data_size)
 {
   char *buffer;
   int rc;
@@ -2150,7 +2385,14 @@ css_queue_error_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const
 
   if (buffer != NULL)
     {
-      rc = css_net_recv (conn->fd, buffer, &size, -1);
+      if (data_size < 0)
+	{
+	  rc = css_net_recv (conn->fd, buffer, &size, -1);
+	}
+      else
+	{
+	  rc = css_copy_packet_data (buffer, &size, data, data_size);
+	}
       if (rc == NO_ERRORS || rc == RECORD_TRUNCATED)
 	{
 	  if (!css_is_request_aborted (conn, request_id))
@@ -2165,7 +2407,10 @@ css_queue_error_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const
   else
     {
       rc = CANT_ALLOC_BUFFER;
-      css_read_remaining_bytes (conn->fd, sizeof (int) + size);
+      if (data_size < 0)
+	{
+	  css_read_remaining_bytes (conn->fd, sizeof (int) + size);
+	}
       if (!css_is_request_aborted (conn, request_id))
 	{
 	  css_add_queue_entry (conn, &conn->error_queue, request_id, NULL, 0, rc, conn->transaction_id,
@@ -2181,9 +2426,14 @@ css_queue_error_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const
  *   request_id(in): request id
  *   header(in): network header
  *   size(in): packet size
+ *   data_size(in): -1 to read the data packet of the command from the socket
+ *
+ * Note: A reader of a non-blocking socket reads the data packet of the
+ *       command as the next packet.
  */
 static void
-css_queue_command_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const NET_HEADER * header, int size)
+css_queue_command_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, const NET_HEADER * header, int size,
+			  int data_size)
 {
   NET_HEADER *p;
   NET_HEADER data_header = DEFAULT_HEADER_DATA;
@@ -2209,15 +2459,48 @@ css_queue_command_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, cons
       memcpy ((char *) p, (char *) header, sizeof (NET_HEADER));
       css_add_queue_entry (conn, &conn->request_queue, request_id, (char *) p, size, NO_ERRORS, conn->transaction_id,
 			   conn->invalidate_snapshot, conn->db_error);
-      if (ntohl (header->buffer_size) > 0)
+      if (ntohl (header->buffer_size) > 0 && data_size < 0)
 	{
 	  css_read_header (conn, &data_header);
 	  css_queue_packet (conn, (int) ntohl (data_header.type), (unsigned short) ntohl (data_header.request_id),
-			    &data_header, sizeof (NET_HEADER));
+			    &data_header, sizeof (NET_HEADER), NULL, -1);
 	}
     }
 }
 
+/*
+ * css_copy_packet_data() - copy the data of a packet read from the socket
+ *                          into the buffer of its request
+ *   return: NO_ERRORS, RECORD_TRUNCATED or READ_LENGTH_MISMATCH as
+ *           css_net_recv () returns, or CANT_ALLOC_BUFFER
+ *   buffer(out): buffer of the request
+ *   size(in/out): size of buffer; size of the data copied
+ *   data(in): data read from the socket, NULL if it could not be allocated
+ *   data_size(in): size of data
+ */
+static int
+css_copy_packet_data (char *buffer, int *size, const char *data, int data_size)
+{
+  if (data == NULL && data_size > 0)
+    {
+      return CANT_ALLOC_BUFFER;
+    }
+
+  if (data_size > *size)
+    {
+      memcpy (buffer, data, *size);
+      return RECORD_TRUNCATED;
+    }
+
+  if (data_size < *size)
+    {
+      return READ_LENGTH_MISMATCH;
+    }
+
+  memcpy (buffer, data, data_size);
+  return NO_ERRORS;
+}
+
 /*
  * css_request_aborted() - check request is aborted
  *   return: true if aborted, or false
@@ -39,6 +39,9 @@
 #include <fcntl.h>
 #include <netinet/in.h>
 #endif /* !WINDOWS */
+#if defined(LINUX)
+#include <sys/epoll.h>
+#endif /* LINUX */
 #include <assert.h>
 
 #include "porting.h"
@@ -104,6 +107,25 @@ static bool ha_Repl_delay_detected = false;
 
 static int ha_Server_num_of_hosts = 0;
 
+#if defined(LINUX)
+/* connection dispatchers; see css_connection_dispatcher_thread () */
+#define CSS_DISPATCHER_MAX_EVENTS	64
+#define CSS_DISPATCHER_WAIT_TIMEOUT	100	/* msec */
+#define CSS_DISPATCHER_CHECK_INTERVAL	5	/* sec */
+
+typedef struct css_conn_dispatcher CSS_CONN_DISPATCHER;
+struct css_conn_dispatcher
+{
+  int index;
+  int epoll_fd;			/* epoll instance watching the client sockets */
+  int num_conns;		/* number of connections being watched */
+};
+
+static CSS_CONN_DISPATCHER *css_Conn_dispatchers = NULL;
+static int css_Num_conn_dispatchers = 0;
+static bool css_Stop_conn_dispatchers = false;
+#endif /* LINUX */
+
 typedef struct job_queue JOB_QUEUE;
 struct job_queue
 {
@@ -217,6 +239,18 @@ static void css_close_connection_to_master (void);
 static int css_reestablish_connection_to_master (void);
 static void dummy_sigurg_handler (int sig);
 static int css_connection_handler_thread (THREAD_ENTRY * thrd, CSS_CONN_ENTRY * conn);
+static void css_wait_log_prefetcher_threads (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn);
+#if defined(LINUX)
+static int css_start_connection_dispatchers (void);
+static void css_stop_connection_dispatchers (void);
+static bool css_dispatch_connection (CSS_CONN_ENTRY * conn);
+static void css_release_dispatched_connection (CSS_CONN_DISPATCHER * dispatcher, CSS_CONN_ENTRY * conn, int status);
+static int css_dispatch_connection_event (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn, unsigned int events);
+static void css_check_dispatched_connections (THREAD_ENTRY * thread_p, CSS_CONN_DISPATCHER * dispatcher,
+					      bool is_stopping);
+static int css_connection_dispatcher_thread (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
+static int css_connection_down_handler (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
+#endif /* LINUX */
 static int css_internal_connection_handler (CSS_CONN_ENTRY * conn);
 static int css_internal_request_handler (THREAD_ENTRY * thrd, CSS_THREAD_ARG arg);
 static int css_test_for_client_errors (CSS_CONN_ENTRY * conn, unsigned int eid);
@@ -593,6 +627,14 @@ css_get_new_job (void)
   return job_entry_p;
 }
 
+#if defined(LINUX)
+#define CSS_IS_CONNECTION_JOB(job_func) \
+  ((job_func) == (CSS_THREAD_FN) css_connection_handler_thread \
+   || (job_func) == (CSS_THREAD_FN) css_connection_dispatcher_thread)
+#else /* LINUX */
+#define CSS_IS_CONNECTION_JOB(job_func) ((job_func) == (CSS_THREAD_FN) css_connection_handler_thread)
+#endif /* LINUX */
+
 /*
  * css_incr_job_queue_counter() - Increase the counter of job queue.
  *   return: void
@@ -607,7 +649,7 @@ css_incr_job_queue_counter (int jobq_index, CSS_THREAD_FN job_func)
 #if defined(HAVE_ATOMIC_BUILTINS)
   ATOMIC_INC_32 (&jobq->num_busy_workers, 1);
 
-  if (job_func == (CSS_THREAD_FN) css_connection_handler_thread)
+  if (CSS_IS_CONNECTION_JOB (job_func))
     {
       ATOMIC_INC_32 (&jobq->num_conn_workers, 1);
     }
@@ -616,7 +658,7 @@ css_incr_job_queue_counter (int jobq_index, CSS_THREAD_FN job_func)
 
   jobq->num_busy_workers++;
 
-  if (job_func == (CSS_THREAD_FN) css_connection_handler_thread)
+  if (CSS_IS_CONNECTION_JOB (job_func))
     {
       jobq->num_conn_workers++;
     }
@@ -639,7 +681,7 @@ css_decr_job_queue_counter (int jobq_index, CSS_THREAD_FN job_func)
 #if defined(HAVE_ATOMIC_BUILTINS)
   ATOMIC_INC_32 (&jobq->num_busy_workers, -1);
 
-  if (job_func == (CSS_THREAD_FN) css_connection_handler_thread)
+  if (CSS_IS_CONNECTION_JOB (job_func))
     {
       ATOMIC_INC_32 (&jobq->num_conn_workers, -1);
     }
@@ -648,7 +690,7 @@ css_decr_job_queue_counter (int jobq_index, CSS_THREAD_FN job_func)
 
   jobq->num_busy_workers--;
 
-  if (job_func == (CSS_THREAD_FN) css_connection_handler_thread)
+  if (CSS_IS_CONNECTION_JOB (job_func))
     {
       jobq->num_conn_workers--;
     }
@@ -1439,7 +1481,6 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
   int n, type, rv, status;
   int css_peer_alive_timeout, poll_timeout;
   int max_num_loop, num_loop;
-  int prefetchlogdb_max_thread_count = 0;
   SOCKET fd;
   struct pollfd po[1] = { {0, 0, 0} };
 
@@ -1454,8 +1495,6 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
 
   thread_p->type = TT_SERVER;	/* server thread */
 
-  prefetchlogdb_max_thread_count = prm_get_integer_value (PRM_ID_HA_PREFETCHLOGDB_MAX_THREAD_COUNT);
-
   css_peer_alive_timeout = 5000;
   poll_timeout = 100;
   max_num_loop = css_peer_alive_timeout / poll_timeout;
@@ -1545,19 +1584,6 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
 	      /* if new command request has arrived, make new job and add it to job queue */
 	      if (type == COMMAND_TYPE)
 		{
-		  do
-		    {
-		      if (conn->client_type == BOOT_CLIENT_LOG_PREFETCHER && (prefetchlogdb_max_thread_count > 0)
-			  && (conn->prefetcher_thread_count >= prefetchlogdb_max_thread_count))
-			{
-			  thread_sleep (10);	/* 10 msec */
-			  continue;
-			}
-
-		      break;
-		    }
-		  while (thread_p->shutdown == false && conn->stop_talk == false);
-
 		  job = css_make_job_entry (conn, css_Request_handler, (CSS_THREAD_ARG) conn, -1);
 		  if (job)
 		    {
@@ -1588,6 +1614,449 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
   return 0;
 }
 
+#if defined(LINUX)
+/*
+ * css_start_connection_dispatchers () - create the epoll instances and start
+ *                                       the connection dispatchers
+ *   return: NO_ERROR, or ER_code
+ *
+ * Note: Each dispatcher runs as a long-lived job on a worker thread, the
+ *       same way css_connection_handler_thread does, so it owns a thread
+ *       entry and can use the job queues and the error manager. If the
+ *       dispatchers cannot be set up, the server falls back to one handler
+ *       thread per connection.
+ */
+static int
+css_start_connection_dispatchers (void)
+{
+  CSS_JOB_ENTRY *job;
+  int num_dispatchers, i;
+
+  num_dispatchers = prm_get_integer_value (PRM_ID_CONNECTION_DISPATCHER_THREADS);
+  if (num_dispatchers <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  css_Conn_dispatchers = (CSS_CONN_DISPATCHER *) malloc (num_dispatchers * sizeof (CSS_CONN_DISPATCHER));
+  if (css_Conn_dispatchers == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      num_dispatchers * sizeof (CSS_CONN_DISPATCHER));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (i = 0; i < num_dispatchers; i++)
+    {
+      css_Conn_dispatchers[i].index = i;
+      css_Conn_dispatchers[i].num_conns = 0;
+      css_Conn_dispatchers[i].epoll_fd = epoll_create (CSS_DISPATCHER_MAX_EVENTS);
+      if (css_Conn_dispatchers[i].epoll_fd < 0)
+	{
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	  css_Num_conn_dispatchers = i;
+	  css_stop_connection_dispatchers ();
+	  return ER_GENERIC_ERROR;
+	}
+    }
+  css_Num_conn_dispatchers = num_dispatchers;
+  css_Stop_conn_dispatchers = false;
+
+  for (i = 0; i < num_dispatchers; i++)
+    {
+      job = css_make_job_entry (NULL, (CSS_THREAD_FN) css_connection_dispatcher_thread,
+				(CSS_THREAD_ARG) & css_Conn_dispatchers[i], i);
+      if (job == NULL)
+	{
+	  /* the dispatchers already started will stop as soon as they see the flag */
+	  css_Stop_conn_dispatchers = true;
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      css_add_to_job_queue (job);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * css_stop_connection_dispatchers () - close the epoll instances
+ *   return:
+ *
+ * Note: Call this after all worker threads were stopped.
+ */
+static void
+css_stop_connection_dispatchers (void)
+{
+  int i;
+
+  if (css_Conn_dispatchers == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < css_Num_conn_dispatchers; i++)
+    {
+      if (css_Conn_dispatchers[i].epoll_fd >= 0)
+	{
+	  close (css_Conn_dispatchers[i].epoll_fd);
+	}
+    }
+
+  css_Num_conn_dispatchers = 0;
+  free_and_init (css_Conn_dispatchers);
+}
+
+/*
+ * css_dispatch_connection () - hand a new connection to a dispatcher
+ *   return: true if a dispatcher watches the connection from now on
+ *   conn(in): connection entry
+ */
+static bool
+css_dispatch_connection (CSS_CONN_ENTRY * conn)
+{
+  CSS_CONN_DISPATCHER *dispatcher;
+  struct epoll_event ev;
+  int flags;
+
+  if (css_Num_conn_dispatchers <= 0 || css_Stop_conn_dispatchers)
+    {
+      return false;
+    }
+
+  /* the other readers and the writers of the socket poll it and retry on EAGAIN */
+  flags = fcntl (conn->fd, F_GETFL);
+  if (flags < 0 || fcntl (conn->fd, F_SETFL, flags | O_NONBLOCK) < 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_dispatch_connection: fcntl() error %d\n", errno);
+      return false;
+    }
+
+  dispatcher = &css_Conn_dispatchers[conn->idx % css_Num_conn_dispatchers];
+  conn->dispatcher_index = dispatcher->index;
+
+  memset (&ev, 0, sizeof (ev));
+  ev.events = EPOLLIN;
+  ev.data.ptr = conn;
+  if (epoll_ctl (dispatcher->epoll_fd, EPOLL_CTL_ADD, conn->fd, &ev) < 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_dispatch_connection: epoll_ctl() error %d\n", errno);
+      conn->dispatcher_index = -1;
+      return false;
+    }
+
+  ATOMIC_INC_32 (&dispatcher->num_conns, 1);
+
+  return true;
+}
+
+/*
+ * css_release_dispatched_connection () - stop watching a connection
+ *   return:
+ *   dispatcher(in): dispatcher watching the connection
+ *   conn(in): connection entry
+ *   status(in): why the connection is released
+ *
+ * Note: Like at the end of css_connection_handler_thread, the connection
+ *       error handler is called unless the connection was just asked to stop
+ *       talking. The handler waits for the threads of the transaction, so it
+ *       runs on a worker thread of its own instead of blocking the dispatcher.
+ */
+static void
+css_release_dispatched_connection (CSS_CONN_DISPATCHER * dispatcher, CSS_CONN_ENTRY * conn, int status)
+{
+  CSS_JOB_ENTRY *job;
+  struct epoll_event ev;
+
+  /* a non-NULL event pointer keeps old kernels happy */
+  memset (&ev, 0, sizeof (ev));
+  (void) epoll_ctl (dispatcher->epoll_fd, EPOLL_CTL_DEL, conn->fd, &ev);
+  conn->dispatcher_index = -1;
+  ATOMIC_INC_32 (&dispatcher->num_conns, -1);
+  css_clear_read_state (conn);
+
+  if (status != NO_ERRORS || css_check_conn (conn) != NO_ERROR)
+    {
+      er_log_debug (ARG_FILE_LINE,
+		    "css_release_dispatched_connection: status %d conn { status %d transaction_id %d "
+		    "db_error %d stop_talk %d stop_phase %d }\n", status, conn->status, conn->transaction_id,
+		    conn->db_error, conn->stop_talk, conn->stop_phase);
+
+      job = css_make_job_entry (conn, (CSS_THREAD_FN) css_connection_down_handler, (CSS_THREAD_ARG) conn, -1);
+      if (job != NULL)
+	{
+	  css_add_to_job_queue (job);
+	}
+    }
+}
+
+/*
+ * css_dispatch_connection_event () - process an event on a connection socket
+ *   return: NO_ERRORS if the connection stays with the dispatcher
+ *   thread_p(in): dispatcher thread entry
+ *   conn(in): connection entry
+ *   events(in): epoll events of the socket
+ *
+ * Note: This is the body of the css_connection_handler_thread loop for one
+ *       readable socket. The socket is non-blocking and the part of a packet
+ *       which has not arrived yet is read on a later event, so a slow client
+ *       does not hold up the other connections of the dispatcher.
+ */
+static int
+css_dispatch_connection_event (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn, unsigned int events)
+{
+  CSS_JOB_ENTRY *job;
+  int status, type;
+
+  if (conn->status != CONN_OPEN)
+    {
+      return CONNECTION_CLOSED;
+    }
+
+  if (events & (EPOLLERR | EPOLLHUP))
+    {
+      return ERROR_ON_READ;
+    }
+
+  /* read as much of a request as has arrived, and enqueue it to appr. queue once it is complete */
+  status = css_read_and_queue_nonblocking (conn, &type);
+  if (status == NO_DATA_AVAILABLE)
+    {
+      return NO_ERRORS;
+    }
+  if (status != NO_ERRORS)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_dispatch_connection_event: css_read_and_queue_nonblocking() error\n");
+      return status;
+    }
+
+  /* if new command request has arrived, make new job and add it to job queue */
+  if (type == COMMAND_TYPE)
+    {
+      job = css_make_job_entry (conn, css_Request_handler, (CSS_THREAD_ARG) conn, -1);
+      if (job)
+	{
+	  css_add_to_job_queue (job);
+	}
+    }
+
+  return NO_ERRORS;
+}
+
+/*
+ * css_check_dispatched_connections () - periodic check of the connections of
+ *                                       a dispatcher
+ *   return:
+ *   thread_p(in): dispatcher thread entry
+ *   dispatcher(in): dispatcher
+ *   is_stopping(in): true if the dispatcher is about to stop
+ *
+ * Note: Connections are released when they were asked to stop talking or
+ *       when the server is going to standby, the same cases in which
+ *       css_connection_handler_thread gives up its connection when it is
+ *       idle. A stopping dispatcher hands its remaining connections (e.g.
+ *       the ones of log writers, which are stopped last during shutdown)
+ *       over to css_connection_handler_thread.
+ */
+static void
+css_check_dispatched_connections (THREAD_ENTRY * thread_p, CSS_CONN_DISPATCHER * dispatcher, bool is_stopping)
+{
+  CSS_CONN_ENTRY *conn, *next;
+  CSS_JOB_ENTRY *job;
+  int status;
+
+  if (dispatcher->num_conns == 0)
+    {
+      return;
+    }
+
+  csect_enter_as_reader (thread_p, CSECT_CONN_ACTIVE, INF_WAIT);
+
+  for (conn = css_Active_conn_anchor; conn != NULL; conn = next)
+    {
+      next = conn->next;
+
+      if (conn->dispatcher_index != dispatcher->index)
+	{
+	  continue;
+	}
+
+      if (conn->stop_talk == true)
+	{
+	  status = NO_ERRORS;
+	}
+      else if (conn->status != CONN_OPEN)
+	{
+	  status = CONNECTION_CLOSED;
+	}
+      else if (ha_Server_state == HA_SERVER_STATE_TO_BE_STANDBY && conn->in_transaction == false
+	       && thread_has_threads (thread_p, conn->transaction_id, conn->client_id) == 0)
+	{
+	  status = REQUEST_REFUSED;
+	}
+      else if (is_stopping)
+	{
+	  /* give the connection back to a handler thread of its own */
+	  struct epoll_event ev;
+
+	  memset (&ev, 0, sizeof (ev));
+	  (void) epoll_ctl (dispatcher->epoll_fd, EPOLL_CTL_DEL, conn->fd, &ev);
+	  conn->dispatcher_index = -1;
+	  ATOMIC_INC_32 (&dispatcher->num_conns, -1);
+
+	  job = css_make_job_entry (conn, (CSS_THREAD_FN) css_connection_handler_thread, (CSS_THREAD_ARG) conn, -1);
+	  if (job != NULL)
+	    {
+	      css_add_to_job_queue (job);
+	    }
+	  continue;
+	}
+      else
+	{
+	  continue;
+	}
+
+      css_release_dispatched_connection (dispatcher, conn, status);
+    }
+
+  csect_exit (thread_p, CSECT_CONN_ACTIVE);
+}
+
+/*
+ * css_connection_dispatcher_thread () - watch the sockets of many clients
+ *   return:
+ *   thread_p(in): thread entry
+ *   arg(in): dispatcher
+ *
+ * Note: A dispatcher waits on its epoll instance and, for every readable
+ *       socket, reads what has arrived of the next packet without blocking
+ *       and hands new requests to the job queues, so the number of
+ *       connections no longer determines the number of threads blocked on
+ *       client sockets.
+ */
+static int
+css_connection_dispatcher_thread (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg)
+{
+  CSS_CONN_DISPATCHER *dispatcher = (CSS_CONN_DISPATCHER *) arg;
+  struct epoll_event events[CSS_DISPATCHER_MAX_EVENTS];
+  CSS_CONN_ENTRY *conn;
+  time_t last_check_time, now;
+  int n, i, status;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  pthread_mutex_unlock (&thread_p->tran_index_lock);
+
+  thread_p->type = TT_SERVER;	/* server thread */
+
+  last_check_time = time (NULL);
+
+  while (thread_p->shutdown == false && css_Stop_conn_dispatchers == false)
+    {
+      n = epoll_wait (dispatcher->epoll_fd, events, CSS_DISPATCHER_MAX_EVENTS, CSS_DISPATCHER_WAIT_TIMEOUT);
+      if (n < 0)
+	{
+	  if (errno != EINTR)
+	    {
+	      er_log_debug (ARG_FILE_LINE, "css_connection_dispatcher_thread: epoll_wait() error %d\n", errno);
+	      thread_sleep (CSS_DISPATCHER_WAIT_TIMEOUT);
+	    }
+	  continue;
+	}
+
+      for (i = 0; i < n; i++)
+	{
+	  conn = (CSS_CONN_ENTRY *) events[i].data.ptr;
+	  if (conn->dispatcher_index != dispatcher->index)
+	    {
+	      /* already released */
+	      continue;
+	    }
+
+	  if (conn->stop_talk == true)
+	    {
+	      css_release_dispatched_connection (dispatcher, conn, NO_ERRORS);
+	      continue;
+	    }
+
+	  status = css_dispatch_connection_event (thread_p, conn, events[i].events);
+	  if (status != NO_ERRORS)
+	    {
+	      css_release_dispatched_connection (dispatcher, conn, status);
+	    }
+	}
+
+      now = time (NULL);
+      if (now - last_check_time >= CSS_DISPATCHER_CHECK_INTERVAL)
+	{
+	  css_check_dispatched_connections (thread_p, dispatcher, false);
+	  last_check_time = now;
+	}
+    }
+
+  css_check_dispatched_connections (thread_p, dispatcher, true);
+
+  thread_p->type = TT_WORKER;
+
+  return 0;
+}
+/*
+ * css_connection_down_handler () - call the connection error handler
+ *   return:
+ *   thread_p(in): thread entry
+ *   arg(in): connection entry
+ *
+ * Note: Used when the connection was not watched by a handler thread of its
+ *       own, see css_release_dispatched_connection.
+ */
+static int
+css_connection_down_handler (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg)
+{
+  CSS_CONN_ENTRY *conn = (CSS_CONN_ENTRY *) arg;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  /* the job is started with tran_index_lock held, as the error handler expects */
+  (*css_Connection_error_handler) (thread_p, conn);
+
+  return 0;
+}
+#endif /* LINUX */
+
+/*
+ * css_wait_log_prefetcher_threads () - throttle the requests of a log
+ *                                      prefetcher client
+ *   return:
+ *   thread_p(in): thread entry
+ *   conn(in): connection entry
+ *
+ * Note: Called by the worker of a request, so that the thread reading the
+ *       socket never sleeps for a prefetcher.
+ */
+static void
+css_wait_log_prefetcher_threads (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
+{
+  int prefetchlogdb_max_thread_count = prm_get_integer_value (PRM_ID_HA_PREFETCHLOGDB_MAX_THREAD_COUNT);
+
+  do
+    {
+      if (conn->client_type == BOOT_CLIENT_LOG_PREFETCHER && (prefetchlogdb_max_thread_count > 0)
+	  && (conn->prefetcher_thread_count >= prefetchlogdb_max_thread_count))
+	{
+	  thread_sleep (10);	/* 10 msec */
+	  continue;
+	}
+
+      break;
+    }
+  while (thread_p->shutdown == false && conn->stop_talk == false);
+}
+
 #if defined(WINDOWS)
 /*
  * ctrl_sig_handler () -
@@ -1681,6 +2150,14 @@ css_block_all_active_conn (unsigned short stop_phase)
 {
   CSS_CONN_ENTRY *conn;
 
+#if defined(LINUX)
+  if (stop_phase == THREAD_STOP_WORKERS_EXCEPT_LOGWR)
+    {
+      /* dispatchers must not keep worker threads busy during shutdown */
+      css_Stop_conn_dispatchers = true;
+    }
+#endif /* LINUX */
+
   csect_enter (NULL, CSECT_CONN_ACTIVE, INF_WAIT);
 
   for (conn = css_Active_conn_anchor; conn != NULL; conn = conn->next)
@@ -1725,6 +2202,13 @@ css_internal_connection_handler (CSS_CONN_ENTRY * conn)
 
   css_insert_into_active_conn_list (conn);
 
+#if defined(LINUX)
+  if (css_dispatch_connection (conn))
+    {
+      return 1;
+    }
+#endif /* LINUX */
+
   job = css_make_job_entry (conn, (CSS_THREAD_FN) css_connection_handler_thread, (CSS_THREAD_ARG) conn,
 			    -1 /* implicit: DEFAULT */ );
   assert (job != NULL);
@@ -1779,6 +2263,8 @@ css_internal_request_handler (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg)
 
       pthread_mutex_unlock (&thread_p->tran_index_lock);
 
+      css_wait_log_prefetcher_threads (thread_p, conn);
+
       if (size)
 	{
 	  rc = css_receive_data (conn, rid, &buffer, &size, -1);
@@ -1885,6 +2371,14 @@ css_init (char *server_name, int name_length, int port_id)
       /* insert conn into active conn list */
       css_insert_into_active_conn_list (conn);
 
+#if defined(LINUX)
+      if (css_start_connection_dispatchers () != NO_ERROR)
+	{
+	  /* serve the clients with one handler thread per connection */
+	  er_log_debug (ARG_FILE_LINE, "css_init: cannot start connection dispatchers\n");
+	}
+#endif /* LINUX */
+
       css_Master_server_name = strdup (server_name);
       css_Master_port_id = port_id;
       css_Pipe_to_master = conn->fd;
@@ -1950,6 +2444,10 @@ shutdown:
 
   thread_stop_active_workers (THREAD_STOP_LOGWR);
 
+#if defined(LINUX)
+  css_stop_connection_dispatchers ();
+#endif /* LINUX */
+
   if (prm_get_integer_value (PRM_ID_HA_MODE) != HA_MODE_OFF)
     {
       css_close_connection_to_master ();
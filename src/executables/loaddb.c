@@ -26,13 +26,17 @@
 #include "config.h"
 
 #include <stdio.h>
+#include <errno.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <stdarg.h>
 
 #if !defined (WINDOWS)
 #include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
 #include <sys/param.h>
+#include <sys/wait.h>
 #endif
 #include "porting.h"
 #include "db.h"
@@ -65,6 +69,28 @@ extern void do_loader_parse (FILE * fp);
 #define LOAD_INDEX_MIN_SORT_BUFFER_PAGES 8192
 #define LOAD_INDEX_MIN_SORT_BUFFER_PAGES_STRING "8192"
 
+#define LOAD_PARALLEL_MAX_WORKERS 64
+
+/* a range of the object file loaded by one worker of a parallel load */
+typedef struct ldr_object_chunk LDR_OBJECT_CHUNK;
+struct ldr_object_chunk
+{
+  INT64 start;			/* offset of the first byte */
+  INT64 end;			/* offset after the last byte */
+  char *header;			/* %id and %class lines in effect at start */
+};
+
+/* scanner states of ldr_split_object_file () */
+typedef enum
+{
+  LDR_SCAN_DEFAULT,
+  LDR_SCAN_SQS,			/* 'string' */
+  LDR_SCAN_DQS,			/* "string" or "identifier" */
+  LDR_SCAN_BRACKET,		/* [identifier] */
+  LDR_SCAN_COMMENT,		/* C comment */
+  LDR_SCAN_LINE_COMMENT		/* C++ or SQL comment */
+} LDR_SCAN_STATE;
+
 static const char *Volume = "";
 static const char *Input_file = "";
 static const char *Schema_file = "";
@@ -93,6 +119,13 @@ static int Interrupt_type = LDR_NO_INTERRUPT;
 static int schema_file_start_line = 1;
 static int index_file_start_line = 1;
 static int compare_Storage_order = 0;
+static int Parallel_workers = 0;
+/* the part of the object file loaded by this process, NULL for the whole file */
+static LDR_OBJECT_CHUNK *Object_chunk = NULL;
+#if defined (CS_MODE) && !defined (WINDOWS)
+/* the child process writing the chunk into the object file pipe, -1 if none */
+static pid_t Object_chunk_writer = -1;
+#endif /* CS_MODE && !WINDOWS */
 
 #define LOADDB_LOG_FILENAME "loaddb.log"
 static FILE *loaddb_log_file;
@@ -123,6 +156,18 @@ static int get_ignore_class_list (const char *filename);
 static void free_ignoreclasslist (void);
 static int ldr_compare_attribute_with_meta (char *table_name, char *meta, DB_ATTRIBUTE * attribute);
 static int ldr_compare_storage_order (FILE * schema_file);
+static int loaddb_login (UTIL_FUNCTION_ARG * arg, int dba_mode);
+static FILE *ldr_open_object_file (void);
+static int ldr_close_object_file (FILE * object_file);
+#if defined (CS_MODE) && !defined (WINDOWS)
+static int ldr_split_object_file (FILE * fp, int count, LDR_OBJECT_CHUNK ** chunks, char ***class_names,
+				  int *num_class_names);
+static int ldr_add_class_name (const char *class_line, char ***class_names, int *num_class_names);
+static int ldr_append_text (char **buf, int *length, int *size, const char *text, int text_length);
+static int ldr_write_buffer (int fd, const char *buf, size_t size);
+static int ldr_write_object_chunk (int fd);
+static int ldr_load_parallel (UTIL_FUNCTION_ARG * arg, int dba_mode, FILE ** object_file);
+#endif /* CS_MODE && !WINDOWS */
 
 /*
  * print_log_msg - print log message
@@ -558,6 +603,816 @@ compare_end:
   return error;
 }
 
+/*
+ * loaddb_login - log in to the database
+ *    return: NO_ERROR if successful, error code otherwise
+ *    arg(in): utility arguments
+ *    dba_mode(in):
+ *
+ * Note: a password entered at the prompt is kept in Password, so that the
+ *       processes of a parallel load can log in again without prompting.
+ */
+static int
+loaddb_login (UTIL_FUNCTION_ARG * arg, int dba_mode)
+{
+  int error = NO_ERROR;
+  char *passwd;
+
+  if (User_name != NULL || !dba_mode)
+    {
+      (void) db_login (User_name, Password);
+      error = db_restart (arg->command_name, true, Volume);
+      if (error != NO_ERROR)
+	{
+	  if (error == ER_AU_INVALID_PASSWORD)
+	    {
+	      /* prompt for password and try again */
+	      error = NO_ERROR;
+	      passwd =
+		getpass (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_LOADDB, LOADDB_MSG_PASSWORD_PROMPT));
+	      if (!strlen (passwd))
+		{
+		  passwd = NULL;
+		}
+	      else
+		{
+		  passwd = strdup (passwd);
+		}
+	      Password = passwd;
+	      (void) db_login (User_name, passwd);
+	      error = db_restart (arg->command_name, true, Volume);
+	    }
+	}
+    }
+  else
+    {
+      /* if we're in the protected DBA mode, just login without authorization */
+      AU_DISABLE_PASSWORDS ();
+      db_set_client_type (DB_CLIENT_TYPE_ADMIN_UTILITY);
+      (void) db_login ("DBA", NULL);
+      error = db_restart (arg->command_name, true, Volume);
+    }
+
+  return error;
+}
+
+#if defined (CS_MODE) && !defined (WINDOWS)
+/*
+ * ldr_write_buffer - write a whole buffer to a file descriptor
+ *    return: NO_ERROR if successful, ER_FAILED otherwise
+ *    fd(in): file descriptor
+ *    buf(in): buffer
+ *    size(in): number of bytes to write
+ */
+static int
+ldr_write_buffer (int fd, const char *buf, size_t size)
+{
+  ssize_t nwritten;
+
+  while (size > 0)
+    {
+      nwritten = write (fd, buf, size);
+      if (nwritten < 0)
+	{
+	  if (errno == EINTR)
+	    {
+	      continue;
+	    }
+	  return ER_FAILED;
+	}
+      buf += nwritten;
+      size -= nwritten;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * ldr_write_object_chunk - write the chunk of this process to a file descriptor
+ *    return: NO_ERROR if successful, ER_FAILED otherwise
+ *    fd(in): file descriptor
+ */
+static int
+ldr_write_object_chunk (int fd)
+{
+  char buf[64 * ONE_K];
+  int in_fd;
+  INT64 remain;
+  ssize_t nread;
+
+  if (ldr_write_buffer (fd, Object_chunk->header, strlen (Object_chunk->header)) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  in_fd = open (Object_file, O_RDONLY);
+  if (in_fd < 0)
+    {
+      return ER_FAILED;
+    }
+  if (lseek (in_fd, (off_t) Object_chunk->start, SEEK_SET) < 0)
+    {
+      close (in_fd);
+      return ER_FAILED;
+    }
+
+  remain = Object_chunk->end - Object_chunk->start;
+  while (remain > 0)
+    {
+      nread = read (in_fd, buf, (size_t) MIN (remain, (INT64) sizeof (buf)));
+      if (nread < 0 && errno == EINTR)
+	{
+	  continue;
+	}
+      if (nread <= 0 || ldr_write_buffer (fd, buf, nread) != NO_ERROR)
+	{
+	  break;
+	}
+      remain -= nread;
+    }
+  close (in_fd);
+
+  return (remain == 0) ? NO_ERROR : ER_FAILED;
+}
+#endif /* CS_MODE && !WINDOWS */
+
+/*
+ * ldr_open_object_file - open the object file, or the chunk of it loaded by
+ *                        this process
+ *    return: FILE pointer, NULL on error
+ *
+ * Note: a chunk is read through a pipe that a child process fills with the
+ *       chunk header and the chunk's range of the object file, so the
+ *       loader sees an ordinary object file.
+ */
+static FILE *
+ldr_open_object_file (void)
+{
+#if defined (CS_MODE) && !defined (WINDOWS)
+  int fds[2];
+  pid_t pid;
+
+  if (Object_chunk != NULL)
+    {
+      if (pipe (fds) != 0)
+	{
+	  return NULL;
+	}
+
+      pid = fork ();
+      if (pid < 0)
+	{
+	  close (fds[0]);
+	  close (fds[1]);
+	  return NULL;
+	}
+      else if (pid == 0)
+	{
+	  close (fds[0]);
+	  _exit ((ldr_write_object_chunk (fds[1]) == NO_ERROR) ? 0 : 1);
+	}
+
+      close (fds[1]);
+      Object_chunk_writer = pid;
+      return fdopen (fds[0], "rb");
+    }
+#endif /* CS_MODE && !WINDOWS */
+
+  return fopen_ex (Object_file, "rb");	/* keep out ^Z */
+}
+
+/*
+ * ldr_close_object_file - close the object file and reap the child process
+ *                         writing its chunk, if any
+ *    return: NO_ERROR if successful, ER_FAILED if the chunk was not written
+ *            completely
+ *    object_file(in): object file opened by ldr_open_object_file ()
+ */
+static int
+ldr_close_object_file (FILE * object_file)
+{
+  int error = NO_ERROR;
+#if defined (CS_MODE) && !defined (WINDOWS)
+  int wait_status;
+#endif /* CS_MODE && !WINDOWS */
+
+  fclose (object_file);
+
+#if defined (CS_MODE) && !defined (WINDOWS)
+  if (Object_chunk_writer > 0)
+    {
+      while (waitpid (Object_chunk_writer, &wait_status, 0) < 0)
+	{
+	  if (errno != EINTR)
+	    {
+	      wait_status = -1;
+	      break;
+	    }
+	}
+      Object_chunk_writer = -1;
+
+      if (wait_status == -1 || !WIFEXITED (wait_status) || WEXITSTATUS (wait_status) != 0)
+	{
+	  print_log_msg (1, "Reading of data file from offset %lld to %lld failed.\n", (long long) Object_chunk->start,
+			 (long long) Object_chunk->end);
+	  error = ER_FAILED;
+	}
+    }
+#endif /* CS_MODE && !WINDOWS */
+
+  return error;
+}
+
+#if defined (CS_MODE) && !defined (WINDOWS)
+/*
+ * ldr_append_text - append text to a growing buffer
+ *    return: NO_ERROR if successful, ER_FAILED otherwise
+ *    buf(in/out): buffer, reallocated as needed
+ *    length(in/out): length of the text in the buffer
+ *    size(in/out): allocated size of the buffer
+ *    text(in): text to append
+ *    text_length(in): length of the text
+ */
+static int
+ldr_append_text (char **buf, int *length, int *size, const char *text, int text_length)
+{
+  char *new_buf;
+  int new_size;
+
+  if (*length + text_length + 1 > *size)
+    {
+      new_size = MAX (*size * 2, *length + text_length + 1);
+      new_buf = (char *) realloc (*buf, new_size);
+      if (new_buf == NULL)
+	{
+	  return ER_FAILED;
+	}
+      *buf = new_buf;
+      *size = new_size;
+    }
+
+  memcpy (*buf + *length, text, text_length);
+  *length += text_length;
+  (*buf)[*length] = '\0';
+
+  return NO_ERROR;
+}
+
+/*
+ * ldr_add_class_name - remember the class name of a %class line
+ *    return: NO_ERROR if successful, ER_FAILED otherwise
+ *    class_line(in): %class line
+ *    class_names(in/out): class names
+ *    num_class_names(in/out): number of class names
+ */
+static int
+ldr_add_class_name (const char *class_line, char ***class_names, int *num_class_names)
+{
+  const char *p, *end;
+  char *name, **names;
+  int i;
+
+  for (p = class_line + strlen ("%class"); char_isspace (*p); p++)
+    {
+      ;
+    }
+
+  if (*p == '"' || *p == '[')
+    {
+      end = strchr (p + 1, (*p == '"') ? '"' : ']');
+      p++;
+    }
+  else
+    {
+      for (end = p; *end != '\0' && *end != '(' && !char_isspace (*end); end++)
+	{
+	  ;
+	}
+    }
+  if (end == NULL || end == p)
+    {
+      return NO_ERROR;
+    }
+
+  name = (char *) malloc (end - p + 1);
+  if (name == NULL)
+    {
+      return ER_FAILED;
+    }
+  memcpy (name, p, end - p);
+  name[end - p] = '\0';
+
+  for (i = 0; i < *num_class_names; i++)
+    {
+      if (strcmp ((*class_names)[i], name) == 0)
+	{
+	  free (name);
+	  return NO_ERROR;
+	}
+    }
+
+  names = (char **) realloc (*class_names, (*num_class_names + 1) * sizeof (char *));
+  if (names == NULL)
+    {
+      free (name);
+      return ER_FAILED;
+    }
+  names[(*num_class_names)++] = name;
+  *class_names = names;
+
+  return NO_ERROR;
+}
+
+/*
+ * ldr_split_object_file - split the object file into chunks at object
+ *                         boundaries
+ *    return: number of chunks, 0 if the file cannot be split, -1 on error
+ *    fp(in): object file
+ *    count(in): number of chunks wanted
+ *    chunks(out): chunks
+ *    class_names(out): names of the classes of the %class lines
+ *    num_class_names(out): number of class names
+ *
+ * Note: the file is read once by a small state machine that follows the
+ *       quoting and comment rules of the loader lexer. A chunk ends at a
+ *       newline outside of strings and comments that does not continue the
+ *       line with '+' or '\'. Each chunk starts with the %id lines read so
+ *       far and the %class line in effect, so it can be loaded on its own.
+ *       A file that references objects with '@' cannot be split, since the
+ *       references are resolved by a single loader.
+ */
+static int
+ldr_split_object_file (FILE * fp, int count, LDR_OBJECT_CHUNK ** chunks, char ***class_names, int *num_class_names)
+{
+  LDR_SCAN_STATE state = LDR_SCAN_DEFAULT;
+  LDR_OBJECT_CHUNK *chunk_array = NULL;
+  struct stat stat_buf;
+  INT64 total_size, pos = 0;
+  char *line = NULL, *ids = NULL, *class_line = NULL;
+  int line_length = 0, line_size = 0, ids_length = 0, ids_size = 0;
+  int num_chunks = 0, c, prev = '\0', last = '\0';
+  bool line_started = false, is_command = false, line_continues = false;
+  char ch;
+
+  *chunks = NULL;
+  *class_names = NULL;
+  *num_class_names = 0;
+
+  if (fstat (fileno (fp), &stat_buf) != 0)
+    {
+      return -1;
+    }
+  total_size = stat_buf.st_size;
+
+  chunk_array = (LDR_OBJECT_CHUNK *) calloc (count, sizeof (LDR_OBJECT_CHUNK));
+  if (chunk_array == NULL || ldr_append_text (&ids, &ids_length, &ids_size, "", 0) != NO_ERROR)
+    {
+      goto error_exit;
+    }
+  chunk_array[0].header = strdup ("");
+  if (chunk_array[0].header == NULL)
+    {
+      goto error_exit;
+    }
+
+  while ((c = getc (fp)) != EOF)
+    {
+      pos++;
+
+      switch (state)
+	{
+	case LDR_SCAN_DEFAULT:
+	  if (c == '\'')
+	    {
+	      state = LDR_SCAN_SQS;
+	    }
+	  else if (c == '"')
+	    {
+	      state = LDR_SCAN_DQS;
+	    }
+	  else if (c == '[')
+	    {
+	      state = LDR_SCAN_BRACKET;
+	    }
+	  else if (prev == '/' && c == '*')
+	    {
+	      state = LDR_SCAN_COMMENT;
+	      line_length -= (is_command && line_length > 0) ? 1 : 0;
+	      c = '\0';
+	    }
+	  else if ((prev == '/' && c == '/') || (prev == '-' && c == '-'))
+	    {
+	      state = LDR_SCAN_LINE_COMMENT;
+	      line_length -= (is_command && line_length > 0) ? 1 : 0;
+	    }
+	  else if (c == '@' && !is_command)
+	    {
+	      /* object reference */
+	      num_chunks = 0;
+	      goto end;
+	    }
+	  break;
+
+	case LDR_SCAN_SQS:
+	  if (c == '\'')
+	    {
+	      state = LDR_SCAN_DEFAULT;
+	    }
+	  break;
+
+	case LDR_SCAN_DQS:
+	  if (c == '\\')
+	    {
+	      /* escaped character */
+	      c = getc (fp);
+	      if (c == EOF)
+		{
+		  continue;
+		}
+	      pos++;
+	      c = '\0';
+	    }
+	  else if (c == '"')
+	    {
+	      state = LDR_SCAN_DEFAULT;
+	    }
+	  break;
+
+	case LDR_SCAN_BRACKET:
+	  if (c == ']')
+	    {
+	      state = LDR_SCAN_DEFAULT;
+	    }
+	  break;
+
+	case LDR_SCAN_COMMENT:
+	  if (prev == '*' && c == '/')
+	    {
+	      state = LDR_SCAN_DEFAULT;
+	      c = '\0';
+	    }
+	  break;
+
+	case LDR_SCAN_LINE_COMMENT:
+	  if (c == '\n')
+	    {
+	      state = LDR_SCAN_DEFAULT;
+	      /* the lexer takes the newline as a part of the comment, so the line goes on */
+	      line_continues = true;
+	    }
+	  break;
+	}
+
+      if (c == '\n' && state == LDR_SCAN_DEFAULT)
+	{
+	  if (is_command)
+	    {
+	      if (line != NULL && strncasecmp (line, "%class", strlen ("%class")) == 0)
+		{
+		  free_and_init (class_line);
+		  class_line = strdup (line);
+		  if (class_line == NULL || ldr_add_class_name (line, class_names, num_class_names) != NO_ERROR)
+		    {
+		      goto error_exit;
+		    }
+		}
+	      else if (ldr_append_text (&ids, &ids_length, &ids_size, line, line_length) != NO_ERROR
+		       || ldr_append_text (&ids, &ids_length, &ids_size, "\n", 1) != NO_ERROR)
+		{
+		  goto error_exit;
+		}
+	    }
+
+	  if (!line_continues && last != '+' && last != '\\' && num_chunks + 1 < count
+	      && pos * count >= total_size * (num_chunks + 1))
+	    {
+	      chunk_array[num_chunks].end = pos;
+	      num_chunks++;
+	      chunk_array[num_chunks].start = pos;
+	      chunk_array[num_chunks].header = (char *) malloc (ids_length + (class_line ? strlen (class_line) : 0) + 2);
+	      if (chunk_array[num_chunks].header == NULL)
+		{
+		  goto error_exit;
+		}
+	      sprintf (chunk_array[num_chunks].header, "%s%s%s", ids, class_line ? class_line : "",
+		       class_line ? "\n" : "");
+	    }
+
+	  line_started = false;
+	  is_command = false;
+	  line_length = 0;
+	  line_continues = false;
+	  last = '\0';
+	  prev = '\0';
+	  continue;
+	}
+
+      if (state != LDR_SCAN_COMMENT && state != LDR_SCAN_LINE_COMMENT && !char_isspace (c) && c != '\0')
+	{
+	  if (!line_started)
+	    {
+	      line_started = true;
+	      is_command = (c == '%');
+	    }
+	  last = c;
+	}
+
+      if (is_command && state != LDR_SCAN_COMMENT && state != LDR_SCAN_LINE_COMMENT && c != '\r' && c != '\0')
+	{
+	  ch = (char) c;
+	  if (ldr_append_text (&line, &line_length, &line_size, &ch, 1) != NO_ERROR)
+	    {
+	      goto error_exit;
+	    }
+	}
+
+      prev = c;
+    }
+
+  chunk_array[num_chunks].end = pos;
+  num_chunks++;
+
+end:
+  *chunks = chunk_array;
+  free_and_init (line);
+  free_and_init (ids);
+  free_and_init (class_line);
+  return num_chunks;
+
+error_exit:
+  num_chunks = -1;
+  goto end;
+}
+
+/*
+ * ldr_load_parallel - load the object file with several processes
+ *    return: 0 if successful, 3 if a process failed, -1 if this process
+ *            could not log in again
+ *    arg(in): utility arguments
+ *    dba_mode(in):
+ *    object_file(in/out): object file
+ *
+ * Note: the whole object file is checked first, as the serial load does,
+ *       and nothing is loaded if it has errors. Then it is split into
+ *       Parallel_workers chunks and the client logs out, then forks a
+ *       worker per chunk. A worker logs in, opens its chunk in object_file
+ *       and returns 0, to go on with the object loading of loaddb_internal.
+ *       The parent waits for the workers, logs in again and updates the
+ *       statistics of the loaded classes; object_file is closed so that the
+ *       parent goes on with index loading only.
+ *       Each worker commits its own chunk. When a worker fails, the others
+ *       are interrupted and roll back what they have not committed yet, and
+ *       the chunks committed are reported: those of the workers that
+ *       finished, and with periodic commits, a part of the others.
+ *       When the file cannot be split, object_file is rewound and left for
+ *       the serial load.
+ */
+static int
+ldr_load_parallel (UTIL_FUNCTION_ARG * arg, int dba_mode, FILE ** object_file)
+{
+  LDR_OBJECT_CHUNK *chunks = NULL;
+  char **class_names = NULL;
+  int num_chunks, num_class_names = 0, num_started = 0, num_running, num_failed = 0;
+  pid_t pids[LOAD_PARALLEL_MAX_WORKERS], pid;
+  bool committed[LOAD_PARALLEL_MAX_WORKERS];
+  int wait_status, status = 0, i, j;
+  int errors = 0, objects = 0, defaults = 0, lastcommit = 0, fails = 0;
+  int init_error = NO_ERROR;
+  SIGNAL_HANDLER_FUNCTION old_handler;
+  DB_OBJECT *class_mop;
+
+  if (!Load_only)
+    {
+      /* a chunk must not be committed when another one has errors */
+      print_log_msg ((int) Verbose, msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_LOADDB, LOADDB_MSG_CHECKING));
+      ldr_init (Verbose);
+      if (Table_name[0] != '\0')
+	{
+	  init_error = ldr_init_class_spec (Table_name);
+	}
+      do_loader_parse (*object_file);
+      ldr_stats (&errors, &objects, &defaults, &lastcommit, &fails);
+      ldr_final ();
+
+      if (errors || init_error != NO_ERROR)
+	{
+	  if (errors)
+	    {
+	      print_log_msg (1, msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_LOADDB, LOADDB_MSG_ERROR_COUNT),
+			     errors);
+	    }
+	  fclose (*object_file);
+	  *object_file = NULL;
+	  goto end;
+	}
+      rewind (*object_file);
+    }
+
+  num_chunks = ldr_split_object_file (*object_file, Parallel_workers, &chunks, &class_names, &num_class_names);
+  if (num_chunks <= 1)
+    {
+      if (num_chunks == 0)
+	{
+	  print_log_msg (1, "\nThe data file has object references and cannot be loaded in parallel. "
+			 "Loading objects serially.\n");
+	}
+      else if (num_chunks < 0)
+	{
+	  print_log_msg (1, "\nCannot split the data file. Loading objects serially.\n");
+	}
+      rewind (*object_file);
+      goto end;
+    }
+
+  fclose (*object_file);
+  *object_file = NULL;
+
+  print_log_msg (1, "\nStart object loading with %d processes.\n", num_chunks);
+  (void) db_commit_transaction ();
+  (void) db_shutdown ();
+  fflush (stdout);
+
+  for (i = 0; i < num_chunks; i++)
+    {
+      pids[i] = fork ();
+      if (pids[i] < 0)
+	{
+	  print_log_msg (1, "Cannot create a process for loading: %s\n", strerror (errno));
+	  break;
+	}
+      else if (pids[i] == 0)
+	{
+	  Object_chunk = &chunks[i];
+	  Disable_statistics = true;
+	  /* the whole file has been checked */
+	  Load_only = true;
+
+	  if (loaddb_login (arg, dba_mode) != NO_ERROR)
+	    {
+	      print_log_msg (1, "%s\n", db_error_string (3));
+	      exit (3);
+	    }
+	  db_disable_trigger ();
+	  if (Ignore_logging != 0 && locator_log_force_nologging () != NO_ERROR)
+	    {
+	      print_log_msg (1, "%s\n", db_error_string (3));
+	      (void) db_shutdown ();
+	      exit (3);
+	    }
+
+	  *object_file = ldr_open_object_file ();
+	  if (*object_file == NULL)
+	    {
+	      print_log_msg (1, msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_LOADDB, LOADDB_MSG_BAD_INFILE),
+			     Object_file);
+	      (void) db_shutdown ();
+	      exit (2);
+	    }
+	  return 0;
+	}
+      committed[i] = false;
+      num_started++;
+    }
+
+  /* an interrupt is handled by each worker, which aborts what it has not committed */
+  old_handler = os_set_signal_handler (SIGINT, SIG_IGN);
+  if (num_started < num_chunks)
+    {
+      for (i = 0; i < num_started; i++)
+	{
+	  (void) kill (pids[i], SIGINT);
+	}
+    }
+
+  num_running = num_started;
+  while (num_running > 0)
+    {
+      pid = waitpid (-1, &wait_status, 0);
+      if (pid < 0)
+	{
+	  if (errno == EINTR)
+	    {
+	      continue;
+	    }
+	  break;
+	}
+
+      for (i = 0; i < num_started && pids[i] != pid; i++)
+	{
+	  ;
+	}
+      if (i == num_started)
+	{
+	  continue;
+	}
+      pids[i] = -1;
+      num_running--;
+
+      if (WIFEXITED (wait_status) && WEXITSTATUS (wait_status) == 0)
+	{
+	  committed[i] = true;
+	  continue;
+	}
+
+      print_log_msg (1, "Loading of data file from offset %lld to %lld failed.\n", (long long) chunks[i].start,
+		     (long long) chunks[i].end);
+      if (num_failed++ == 0)
+	{
+	  /* stop the others at the first failure */
+	  for (j = 0; j < num_started; j++)
+	    {
+	      if (pids[j] > 0)
+		{
+		  (void) kill (pids[j], SIGINT);
+		}
+	    }
+	}
+    }
+  (void) os_set_signal_handler (SIGINT, old_handler);
+  num_failed = num_chunks;
+  for (i = 0; i < num_started; i++)
+    {
+      num_failed -= committed[i] ? 1 : 0;
+    }
+
+  if (loaddb_login (arg, dba_mode) != NO_ERROR)
+    {
+      print_log_msg (1, "%s\n", db_error_string (3));
+      util_log_write_errstr ("%s\n", db_error_string (3));
+      status = -1;
+      goto end;
+    }
+  db_disable_trigger ();
+
+  if (num_failed > 0)
+    {
+      print_log_msg (1, "\n%d of %d processes failed to load objects.\n", num_failed, num_chunks);
+      util_log_write_errstr ("%d of %d processes failed to load objects.\n", num_failed, num_chunks);
+      for (i = 0; i < num_chunks; i++)
+	{
+	  if (i < num_started && committed[i])
+	    {
+	      print_log_msg (1, "Objects of data file from offset %lld to %lld have been committed.\n",
+			     (long long) chunks[i].start, (long long) chunks[i].end);
+	    }
+	  else if (i < num_started && Periodic_commit > 0)
+	    {
+	      print_log_msg (1, "Objects of data file from offset %lld to %lld have been committed up to "
+			     "the last committed line reported by its process.\n", (long long) chunks[i].start,
+			     (long long) chunks[i].end);
+	    }
+	  else
+	    {
+	      print_log_msg (1, "Objects of data file from offset %lld to %lld have not been loaded.\n",
+			     (long long) chunks[i].start, (long long) chunks[i].end);
+	    }
+	}
+      status = 3;
+      goto end;
+    }
+
+  if (!Disable_statistics)
+    {
+      print_log_msg ((int) Verbose,
+		     msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_LOADDB, LOADDB_MSG_UPDATING_STATISTICS));
+      for (i = 0; i < num_class_names; i++)
+	{
+	  class_mop = db_find_class (class_names[i]);
+	  if (class_mop != NULL)
+	    {
+	      (void) sm_update_statistics (class_mop, STATS_WITH_SAMPLING);
+	    }
+	}
+      if (num_class_names == 0 && Table_name[0] != '\0')
+	{
+	  class_mop = db_find_class (Table_name);
+	  if (class_mop != NULL)
+	    {
+	      (void) sm_update_statistics (class_mop, STATS_WITH_SAMPLING);
+	    }
+	}
+      (void) db_commit_transaction ();
+    }
+
+end:
+  if (chunks != NULL)
+    {
+      for (i = 0; i < Parallel_workers; i++)
+	{
+	  free_and_init (chunks[i].header);
+	}
+      free_and_init (chunks);
+    }
+  for (i = 0; i < num_class_names; i++)
+    {
+      free_and_init (class_names[i]);
+    }
+  free_and_init (class_names);
+
+  return status;
+}
+#endif /* CS_MODE && !WINDOWS */
+
 /*
  * loaddb_internal - internal main loaddb function
  *    return: NO_ERROR if successful, error code otherwise
@@ -583,7 +1438,6 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
 
   int ldr_init_ret = NO_ERROR;
   int lastcommit = 0;
-  char *passwd;
   /* set to static to avoid copiler warning (clobbered by longjump) */
   static int interrupted = false;
   int au_save = 0;
@@ -615,6 +1469,7 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
 
   Ignore_class_file = utility_get_option_string_value (arg_map, LOAD_IGNORE_CLASS_S, 0);
   compare_Storage_order = utility_get_option_bool_value (arg_map, LOAD_COMPARE_STORAGE_ORDER_S);
+  Parallel_workers = utility_get_option_int_value (arg_map, LOAD_PARALLEL_S);
 
   Input_file = Input_file ? Input_file : "";
   Schema_file = Schema_file ? Schema_file : "";
@@ -629,6 +1484,16 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
       goto error_return;
     }
 
+#if defined (CS_MODE) && !defined (WINDOWS)
+  if (Parallel_workers > 1 && Ignore_logging)
+    {
+      /* an interrupted worker would commit its chunk, so a failed parallel load could not be rolled back */
+      PRINT_AND_LOG_ERR_MSG ("Parallel loading cannot be used with --%s.\n", LOAD_IGNORE_LOGGING_L);
+      status = 1;
+      goto error_return;
+    }
+#endif /* CS_MODE && !WINDOWS */
+
   /* error message log file */
   sprintf (log_file_name, "%s_%s.err", Volume, arg->command_name);
   er_init (log_file_name, ER_NEVER_EXIT);
@@ -641,35 +1506,7 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
   sysprm_set_force (prm_get_name (PRM_ID_JAVA_STORED_PROCEDURE), "no");
 
   /* login */
-  if (User_name != NULL || !dba_mode)
-    {
-      (void) db_login (User_name, Password);
-      error = db_restart (arg->command_name, true, Volume);
-      if (error != NO_ERROR)
-	{
-	  if (error == ER_AU_INVALID_PASSWORD)
-	    {
-	      /* prompt for password and try again */
-	      error = NO_ERROR;
-	      passwd =
-		getpass (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_LOADDB, LOADDB_MSG_PASSWORD_PROMPT));
-	      if (!strlen (passwd))
-		{
-		  passwd = NULL;
-		}
-	      (void) db_login (User_name, passwd);
-	      error = db_restart (arg->command_name, true, Volume);
-	    }
-	}
-    }
-  else
-    {
-      /* if we're in the protected DBA mode, just login without authorization */
-      AU_DISABLE_PASSWORDS ();
-      db_set_client_type (DB_CLIENT_TYPE_ADMIN_UTILITY);
-      (void) db_login ("DBA", NULL);
-      error = db_restart (arg->command_name, true, Volume);
-    }
+  error = loaddb_login (arg, dba_mode);
 
   /* disable trigger actions to be fired */
   db_disable_trigger ();
@@ -713,7 +1550,7 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
     }
   if (Object_file[0] != 0)
     {
-      object_file = fopen_ex (Object_file, "rb");	/* keep out ^Z */
+      object_file = ldr_open_object_file ();
 
       if (object_file == NULL)
 	{
@@ -747,6 +1584,15 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
       goto error_return;
     }
 
+  if (Parallel_workers < 0 || Parallel_workers > LOAD_PARALLEL_MAX_WORKERS)
+    {
+      msg_format = "The number of processes for --" LOAD_PARALLEL_L " should be between 1 and %d.\n";
+      print_log_msg (1, msg_format, LOAD_PARALLEL_MAX_WORKERS);
+      util_log_write_errstr (msg_format, LOAD_PARALLEL_MAX_WORKERS);
+      status = 1;
+      goto error_return;
+    }
+
   if (Error_file[0] != 0)
     {
       if (Syntax_check)
@@ -838,6 +1684,26 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
       schema_file = NULL;
     }
 
+  if (object_file != NULL && Parallel_workers > 1 && !Syntax_check)
+    {
+#if defined (CS_MODE) && !defined (WINDOWS)
+
+      /* on return, a worker process goes on to load its chunk below */
+      status = ldr_load_parallel (arg, dba_mode, &object_file);
+      if (status < 0)
+	{
+	  status = 3;
+	  goto error_return;
+	}
+      else if (status != 0)
+	{
+	  /* do not build indexes on a partially loaded database */
+	  interrupted = true;
+	}
+#else /* CS_MODE && !WINDOWS */
+      print_log_msg (1, "\nParallel loading is not supported in this mode. Loading objects serially.\n");
+#endif /* CS_MODE && !WINDOWS */
+    }
 
   /* if index file is specified, do index creation */
 
@@ -894,8 +1760,15 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
 	{
 	  /* now do it for real if there were no errors and we aren't doing a simple syntax check */
 	  ldr_start (Periodic_commit);
-	  fclose (object_file);
-	  object_file = fopen_ex (Object_file, "rb");	/* keep out ^Z */
+	  if (ldr_close_object_file (object_file) != NO_ERROR)
+	    {
+	      status = 3;
+	      object_file = NULL;
+	    }
+	  else
+	    {
+	      object_file = ldr_open_object_file ();
+	    }
 	  if (object_file != NULL)
 	    {
 	      print_log_msg ((int) Verbose,
@@ -936,6 +1809,15 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
 		    }
 		  do_loader_parse (object_file);
 		  ldr_stats (&errors, &objects, &defaults, &lastcommit, &fails);
+
+		  /* reap the chunk writer before committing, a truncated chunk must not be committed */
+		  if (ldr_close_object_file (object_file) != NO_ERROR)
+		    {
+		      errors++;
+		      status = 3;
+		    }
+		  object_file = NULL;
+
 		  if (errors)
 		    {
 		      if (lastcommit > 0)
@@ -1007,9 +1889,21 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
       ldr_final ();
       if (object_file != NULL)
 	{
-	  fclose (object_file);
+	  if (ldr_close_object_file (object_file) != NO_ERROR)
+	    {
+	      status = 3;
+	    }
 	  object_file = NULL;
 	}
+
+#if defined (CS_MODE) && !defined (WINDOWS)
+      if (Object_chunk != NULL)
+	{
+	  /* a worker of a parallel load ends here, the parent builds indexes */
+	  (void) db_shutdown ();
+	  exit ((errors || ldr_init_ret != NO_ERROR || status != 0) ? 3 : 0);
+	}
+#endif /* CS_MODE && !WINDOWS */
     }
 
   /* create index */
@@ -1051,7 +1945,7 @@ error_return:
     }
   if (object_file != NULL)
     {
-      fclose (object_file);
+      (void) ldr_close_object_file (object_file);
     }
   if (index_file != NULL)
     {
@@ -33,6 +33,10 @@
 #include <ctype.h>
 
 #include <sys/stat.h>
+#if !defined(WINDOWS)
+#include <unistd.h>
+#include <sys/wait.h>
+#endif /* !WINDOWS */
 #if defined(WINDOWS)
 #include <sys/timeb.h>
 #include <time.h>
@@ -98,6 +102,16 @@ static char *class_processed = NULL;
 
 static OID null_oid;
 
+/* read end of the class queue of a worker of a parallel unload */
+static int class_queue_fd = -1;
+
+typedef struct unload_class_size UNLOAD_CLASS_SIZE;
+struct unload_class_size
+{
+  OID class_oid;
+  int est_objects;
+};
+
 static const char *prohibited_classes[] = {
   "db_authorizations",		/* old name for db_root */
   "db_root",
@@ -172,6 +186,14 @@ static void extractobjects_term_handler (int sig);
 static bool mark_referenced_domain (SM_CLASS * class_ptr, int *num_set);
 static void gauge_alarm_handler (int sig);
 static int process_class (int cl_no);
+static int unload_class (int cl_no);
+#if defined (CS_MODE) && !defined (WINDOWS)
+static int get_queued_class (void);
+static int compare_class_size (const void *a, const void *b);
+static int get_class_unload_order (OID ** class_oids, int *num_classes);
+static bool has_object_reference (const char **class_name);
+static int extractobjects_worker (const char *exec_name, const char *user, const char *password);
+#endif /* CS_MODE && !WINDOWS */
 static int process_object (DESC_OBJ * desc_obj, OID * obj_oid, int referenced_class);
 static int process_set (DB_SET * set);
 static int process_value (DB_VALUE * value);
@@ -874,63 +896,50 @@ extractobjects (const char *exec_name)
    */
   total_approximate_class_objects = est_objects;
   snprintf (unloadlog_filename, sizeof (unloadlog_filename) - 1, "%s_unloaddb.log", output_prefix);
-  unloadlog_file = fopen (unloadlog_filename, "w+");
-  if (unloadlog_file != NULL)
+  if (class_queue_fd >= 0)
     {
-      fprintf (unloadlog_file, HEADER_FORMAT, "Class Name", "Total Instances");
+      /* a worker of a parallel unload, the parent has written the header */
+      unloadlog_file = fopen (unloadlog_filename, "a");
+      if (unloadlog_file != NULL)
+	{
+	  setvbuf (unloadlog_file, NULL, _IOLBF, 0);
+	}
     }
-  if (verbose_flag)
+  else
     {
-      fprintf (stdout, HEADER_FORMAT, "Class Name", "Total Instances");
+      unloadlog_file = fopen (unloadlog_filename, "w+");
+      if (unloadlog_file != NULL)
+	{
+	  fprintf (unloadlog_file, HEADER_FORMAT, "Class Name", "Total Instances");
+	}
+      if (verbose_flag)
+	{
+	  fprintf (stdout, HEADER_FORMAT, "Class Name", "Total Instances");
+	}
     }
 
-  do
+#if defined (CS_MODE) && !defined (WINDOWS)
+  if (class_queue_fd >= 0)
     {
-      for (i = 0; i < class_table->num; i++)
+      while ((i = get_queued_class ()) >= 0)
 	{
-	  if (!WS_IS_DELETED (class_table->mops[i]) && class_table->mops[i] != sm_Root_class_mop)
+	  if (unload_class (i) != 0)
 	    {
-	      int ret_val;
-
-	      if (datafile_per_class && IS_CLASS_REQUESTED (i))
-		{
-		  char outfile[PATH_MAX];
-
-		  ws_find (class_table->mops[i], (MOBJ *) (&class_ptr));
-		  if (class_ptr == NULL)
-		    {
-		      status = 1;
-		      goto end;
-		    }
-
-		  snprintf (outfile, PATH_MAX - 1, "%s/%s_%s%s", output_dirname, output_prefix,
-			    sm_ch_name ((MOBJ) class_ptr), OBJECT_SUFFIX);
-
-		  obj_out->fp = fopen_ex (outfile, "wb");
-		  if (obj_out->fp == NULL)
-		    {
-		      status = 1;
-		      goto end;
-		    }
-		}
-
-	      ret_val = process_class (i);
-
-	      if (datafile_per_class && IS_CLASS_REQUESTED (i))
-		{
-		  if (text_print_flush (obj_out) != NO_ERROR)
-		    {
-		      status = 1;
-		      goto end;
-		    }
-
-		  fclose (obj_out->fp);
-		  obj_out->fp = NULL;
-		}
-
-	      if (ret_val != NO_ERROR)
+	      status = 1;
+	      goto end;
+	    }
+	}
+    }
+  else
+#endif /* CS_MODE && !WINDOWS */
+    {
+      do
+	{
+	  for (i = 0; i < class_table->num; i++)
+	    {
+	      if (!WS_IS_DELETED (class_table->mops[i]) && class_table->mops[i] != sm_Root_class_mop)
 		{
-		  if (!ignore_err_flag)
+		  if (unload_class (i) != 0)
 		    {
 		      status = 1;
 		      goto end;
@@ -938,8 +947,8 @@ extractobjects (const char *exec_name)
 		}
 	    }
 	}
+      while (!all_classes_processed ());
     }
-  while (!all_classes_processed ());
 
   if (failed_objects != 0)
     {
@@ -999,6 +1008,449 @@ end:
   return (status);
 }
 
+/*
+ * unload_class - dump one class, into a file of its own if datafile_per_class
+ *    return: 0 to go on, 1 if the unload should stop
+ *    cl_no(in): class object index for class_table
+ */
+static int
+unload_class (int cl_no)
+{
+  SM_CLASS *class_ptr;
+  char outfile[PATH_MAX];
+  int ret_val;
+
+  if (datafile_per_class && IS_CLASS_REQUESTED (cl_no))
+    {
+      ws_find (class_table->mops[cl_no], (MOBJ *) (&class_ptr));
+      if (class_ptr == NULL)
+	{
+	  return 1;
+	}
+
+      snprintf (outfile, PATH_MAX - 1, "%s/%s_%s%s", output_dirname, output_prefix, sm_ch_name ((MOBJ) class_ptr),
+		OBJECT_SUFFIX);
+
+      obj_out->fp = fopen_ex (outfile, "wb");
+      if (obj_out->fp == NULL)
+	{
+	  return 1;
+	}
+    }
+
+  ret_val = process_class (cl_no);
+
+  if (datafile_per_class && IS_CLASS_REQUESTED (cl_no))
+    {
+      if (text_print_flush (obj_out) != NO_ERROR)
+	{
+	  return 1;
+	}
+
+      fclose (obj_out->fp);
+      obj_out->fp = NULL;
+    }
+
+  if (ret_val != NO_ERROR && !ignore_err_flag)
+    {
+      return 1;
+    }
+
+  return 0;
+}
+
+#if defined (CS_MODE) && !defined (WINDOWS)
+/*
+ * get_queued_class - read the next class to dump from the parent of a
+ *                    parallel unload
+ *    return: class object index for class_table, -1 if no class is left
+ *
+ * Note: classes this process does not dump, like the prohibited ones, are
+ *       skipped.
+ */
+static int
+get_queued_class (void)
+{
+  OID class_oid;
+  int *cls_no_ptr;
+  ssize_t nread;
+
+  while (true)
+    {
+      nread = read (class_queue_fd, &class_oid, sizeof (OID));
+      if (nread < 0 && errno == EINTR)
+	{
+	  continue;
+	}
+      if (nread != sizeof (OID))
+	{
+	  return -1;
+	}
+
+      if (fh_get (cl_table, &class_oid, (FH_DATA *) (&cls_no_ptr)) == NO_ERROR && cls_no_ptr != NULL
+	  && !WS_IS_DELETED (class_table->mops[*cls_no_ptr]))
+	{
+	  return *cls_no_ptr;
+	}
+    }
+}
+
+/*
+ * compare_class_size - compare two classes by estimated number of objects,
+ *                      larger first
+ *    return: negative if the first class is larger
+ *    a(in): UNLOAD_CLASS_SIZE
+ *    b(in): UNLOAD_CLASS_SIZE
+ */
+static int
+compare_class_size (const void *a, const void *b)
+{
+  const UNLOAD_CLASS_SIZE *a_size = (const UNLOAD_CLASS_SIZE *) a;
+  const UNLOAD_CLASS_SIZE *b_size = (const UNLOAD_CLASS_SIZE *) b;
+
+  if (a_size->est_objects != b_size->est_objects)
+    {
+      return (a_size->est_objects > b_size->est_objects) ? -1 : 1;
+    }
+  return 0;
+}
+
+/*
+ * get_class_unload_order - get the classes to dump, largest first
+ *    return: NO_ERROR if successful, ER_FAILED otherwise
+ *    class_oids(out): class OIDs, allocated
+ *    num_classes(out): number of classes
+ */
+static int
+get_class_unload_order (OID ** class_oids, int *num_classes)
+{
+  UNLOAD_CLASS_SIZE *sizes;
+  SM_CLASS *class_ptr;
+  HFID *hfid;
+  int i, n = 0;
+
+  *class_oids = NULL;
+  *num_classes = 0;
+
+  sizes = (UNLOAD_CLASS_SIZE *) malloc (DB_SIZEOF (UNLOAD_CLASS_SIZE) * (class_table->num + 1));
+  if (sizes == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  for (i = 0; i < class_table->num; i++)
+    {
+      if (WS_IS_DELETED (class_table->mops[i]) || class_table->mops[i] == sm_Root_class_mop)
+	{
+	  continue;
+	}
+      if (au_fetch_class (class_table->mops[i], &class_ptr, AU_FETCH_READ, AU_SELECT) != NO_ERROR)
+	{
+	  continue;
+	}
+
+      COPY_OID (&sizes[n].class_oid, ws_oid (class_table->mops[i]));
+      sizes[n].est_objects = 0;
+      hfid = sm_ch_heap ((MOBJ) class_ptr);
+      if (!HFID_IS_NULL (hfid))
+	{
+	  (void) get_estimated_objs (hfid, &sizes[n].est_objects);
+	}
+      n++;
+    }
+
+  qsort (sizes, n, sizeof (UNLOAD_CLASS_SIZE), compare_class_size);
+
+  *class_oids = (OID *) malloc (DB_SIZEOF (OID) * (n + 1));
+  if (*class_oids == NULL)
+    {
+      free_and_init (sizes);
+      return ER_FAILED;
+    }
+  for (i = 0; i < n; i++)
+    {
+      COPY_OID (&(*class_oids)[i], &sizes[i].class_oid);
+    }
+  *num_classes = n;
+
+  free_and_init (sizes);
+  return NO_ERROR;
+}
+
+/*
+ * has_object_reference - find a class to dump that has an attribute
+ *                        referencing objects
+ *    return: true if found
+ *    class_name(out): name of the class
+ */
+static bool
+has_object_reference (const char **class_name)
+{
+  SM_CLASS *class_ptr;
+  SM_ATTRIBUTE *attribute;
+  const char **cptr;
+  int num_cls_ref, i;
+  bool found;
+
+  for (i = 0; i < class_table->num; i++)
+    {
+      if (WS_IS_DELETED (class_table->mops[i]) || class_table->mops[i] == sm_Root_class_mop)
+	{
+	  continue;
+	}
+      if (au_fetch_class (class_table->mops[i], &class_ptr, AU_FETCH_READ, AU_SELECT) != NO_ERROR)
+	{
+	  continue;
+	}
+
+      for (cptr = prohibited_classes; *cptr; ++cptr)
+	{
+	  if (strcmp (*cptr, sm_ch_name ((MOBJ) class_ptr)) == 0)
+	    {
+	      break;
+	    }
+	}
+      if (*cptr != NULL)
+	{
+	  continue;
+	}
+
+      if (input_filename && !is_req_class (class_table->mops[i])
+	  && (required_class_only || sm_is_system_class (class_table->mops[i]) <= 0))
+	{
+	  continue;
+	}
+
+      found = false;
+      num_cls_ref = 0;
+      for (attribute = class_ptr->shared; attribute != NULL && !found;
+	   attribute = (SM_ATTRIBUTE *) attribute->header.next)
+	{
+	  found = check_referenced_domain (attribute->domain, false, &num_cls_ref);
+	}
+      for (attribute = class_ptr->class_attributes; attribute != NULL && !found;
+	   attribute = (SM_ATTRIBUTE *) attribute->header.next)
+	{
+	  found = check_referenced_domain (attribute->domain, false, &num_cls_ref);
+	}
+      for (attribute = class_ptr->ordered_attributes; attribute != NULL && !found; attribute = attribute->order_link)
+	{
+	  if (attribute->header.name_space == ID_ATTRIBUTE)
+	    {
+	      found = check_referenced_domain (attribute->domain, false, &num_cls_ref);
+	    }
+	}
+
+      if (found || num_cls_ref > 0)
+	{
+	  *class_name = sm_ch_name ((MOBJ) class_ptr);
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * extractobjects_worker - dump the classes handed out by the parent of a
+ *                         parallel unload
+ *    return: 0 for success. 1 for error
+ *    exec_name(in): utility name
+ *    user(in): user name
+ *    password(in): password
+ */
+static int
+extractobjects_worker (const char *exec_name, const char *user, const char *password)
+{
+  int au_save;
+  int status = 1;
+
+  if (db_restart_ex (exec_name, database_name, user, password, NULL, DB_CLIENT_TYPE_ADMIN_UTILITY) != NO_ERROR)
+    {
+      fprintf (stderr, "%s: %s\n", exec_name, db_error_string (3));
+      return 1;
+    }
+  db_set_lock_timeout (prm_get_integer_value (PRM_ID_UNLOADDB_LOCK_TIMEOUT));
+
+  /* the class table of the parent went away with its workspace */
+  locator_free_list_mops (class_table);
+  free_and_init (req_class_table);
+
+  class_table = locator_get_all_mops (sm_Root_class_mop, DB_FETCH_READ, NULL);
+  if (class_table != NULL)
+    {
+      req_class_table = (DB_OBJECT **) calloc (class_table->num + 1, DB_SIZEOF (void *));
+      if (req_class_table != NULL && get_requested_classes (input_filename, req_class_table) == 0)
+	{
+	  AU_SAVE_AND_ENABLE (au_save);
+	  status = extractobjects (exec_name);
+	  AU_RESTORE (au_save);
+	}
+    }
+
+  if (status != 0 && db_error_code () != NO_ERROR)
+    {
+      fprintf (stderr, "%s: %s\n", exec_name, db_error_string (3));
+    }
+
+  (void) db_shutdown ();
+  return status;
+}
+#endif /* CS_MODE && !WINDOWS */
+
+/*
+ * extractobjects_parallel - dump the database in loader format with several
+ *                           processes
+ *    return: 0 for success. 1 for error
+ *    exec_name(in): utility name
+ *    user(in): user name to log in again with
+ *    password(in): password
+ *
+ * Note: worker_count processes log in on their own and dump, each into a
+ *       file per class, the classes handed out by this process through a
+ *       pipe, largest first. A class is dumped by a single worker, in the
+ *       snapshot of the worker's transaction. This client logs out while
+ *       the workers run and logs in again when they are done.
+ *       A file per class has no object references, so unless they are
+ *       given up with --datafile-per-class, classes with object reference
+ *       attributes are dumped by this process alone.
+ */
+int
+extractobjects_parallel (const char *exec_name, const char *user, const char *password)
+{
+#if defined (CS_MODE) && !defined (WINDOWS)
+  OID *class_oids = NULL;
+  int num_classes = 0;
+  int fds[2];
+  pid_t pids[UNLOAD_MAX_WORKERS];
+  int num_started = 0, num_failed = 0;
+  int wait_status, i;
+  int status = 0;
+  void (*prev_intr_handler) (int sig);
+  void (*prev_pipe_handler) (int sig);
+  char unloadlog_filename[PATH_MAX];
+  FILE *log_fp;
+  const char *class_name;
+
+  if (!datafile_per_class && has_object_reference (&class_name))
+    {
+      fprintf (stdout, "warning: class %s has object references, which '--%s' cannot dump. "
+	       "Dumping objects with one process.\n", class_name, UNLOAD_PARALLEL_L);
+      fflush (stdout);
+
+      return extractobjects (exec_name);
+    }
+
+  /* each class is dumped by one process into a file of its own */
+  datafile_per_class = true;
+
+  if (get_class_unload_order (&class_oids, &num_classes) != NO_ERROR)
+    {
+      return 1;
+    }
+
+  if (pipe (fds) != 0)
+    {
+      fprintf (stderr, "%s: %s.\n\n", exec_name, strerror (errno));
+      free_and_init (class_oids);
+      return 1;
+    }
+
+  /* the workers append to the log */
+  snprintf (unloadlog_filename, sizeof (unloadlog_filename) - 1, "%s_unloaddb.log", output_prefix);
+  log_fp = fopen (unloadlog_filename, "w+");
+  if (log_fp != NULL)
+    {
+      fprintf (log_fp, HEADER_FORMAT, "Class Name", "Total Instances");
+      fclose (log_fp);
+    }
+  if (verbose_flag)
+    {
+      fprintf (stdout, HEADER_FORMAT, "Class Name", "Total Instances");
+    }
+
+  (void) db_shutdown ();
+  fflush (stdout);
+
+  for (i = 0; i < worker_count; i++)
+    {
+      pids[i] = fork ();
+      if (pids[i] < 0)
+	{
+	  fprintf (stderr, "%s: %s.\n\n", exec_name, strerror (errno));
+	  break;
+	}
+      else if (pids[i] == 0)
+	{
+	  close (fds[1]);
+	  class_queue_fd = fds[0];
+	  exit (extractobjects_worker (exec_name, user, password));
+	}
+      num_started++;
+    }
+  close (fds[0]);
+
+  /* an interrupt stops the workers, which fail the unload */
+  prev_intr_handler = os_set_signal_handler (SIGINT, SIG_IGN);
+  prev_pipe_handler = os_set_signal_handler (SIGPIPE, SIG_IGN);
+
+  /* one OID a write, so that it is read in one piece */
+  for (i = 0; i < num_classes && num_started > 0; i++)
+    {
+      if (write (fds[1], &class_oids[i], sizeof (OID)) != sizeof (OID))
+	{
+	  if (errno == EINTR)
+	    {
+	      i--;
+	      continue;
+	    }
+	  break;
+	}
+    }
+  close (fds[1]);
+  free_and_init (class_oids);
+
+  for (i = 0; i < num_started; i++)
+    {
+      while (waitpid (pids[i], &wait_status, 0) < 0)
+	{
+	  if (errno != EINTR)
+	    {
+	      wait_status = -1;
+	      break;
+	    }
+	}
+      if (wait_status == -1 || !WIFEXITED (wait_status) || WEXITSTATUS (wait_status) != 0)
+	{
+	  num_failed++;
+	}
+    }
+  num_failed += worker_count - num_started;
+
+  (void) os_set_signal_handler (SIGINT, prev_intr_handler);
+  (void) os_set_signal_handler (SIGPIPE, prev_pipe_handler);
+
+  if (num_failed > 0)
+    {
+      fprintf (stderr, "%s: %d of %d processes failed to dump objects.\n", exec_name, num_failed, worker_count);
+      status = 1;
+    }
+
+  if (db_restart_ex (exec_name, database_name, user, password, NULL, DB_CLIENT_TYPE_ADMIN_UTILITY) != NO_ERROR)
+    {
+      fprintf (stderr, "%s: %s\n", exec_name, db_error_string (3));
+      status = 1;
+    }
+
+  return status;
+#else /* CS_MODE && !WINDOWS */
+  fprintf (stdout, "warning: '--%s' option is ignored.\n", UNLOAD_PARALLEL_L);
+  fflush (stdout);
+
+  return extractobjects (exec_name);
+#endif /* CS_MODE && !WINDOWS */
+}
+
 
 /*
  * gauge_alarm_handler - signal handler
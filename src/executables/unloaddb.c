@@ -59,6 +59,7 @@ LIST_MOPS *class_table = NULL;
 DB_OBJECT **req_class_table = NULL;
 
 int lo_count = 0;
+int worker_count = 0;
 
 char *output_prefix = NULL;
 bool do_schema = false;
@@ -118,6 +119,7 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
   hash_filename = utility_get_option_string_value (arg_map, UNLOAD_HASH_FILE_S, 0);
   verbose_flag = utility_get_option_bool_value (arg_map, UNLOAD_VERBOSE_S);
   database_name = utility_get_option_string_value (arg_map, OPTION_STRING_TABLE, 0);
+  worker_count = utility_get_option_int_value (arg_map, UNLOAD_PARALLEL_S);
   user = utility_get_option_string_value (arg_map, UNLOAD_USER_S, 0);
   password = utility_get_option_string_value (arg_map, UNLOAD_PASSWORD_S, 0);
   if (utility_get_option_bool_value (arg_map, UNLOAD_KEEP_STORAGE_ORDER_S))
@@ -146,6 +148,11 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
       output_prefix = database_name;
     }
 
+  if (worker_count < 0 || worker_count > UNLOAD_MAX_WORKERS)
+    {
+      unload_usage (arg->argv0);
+      return -1;
+    }
   /* error message log file */
   snprintf (er_msg_file, sizeof (er_msg_file) - 1, "%s_%s.err", database_name, exec_name);
   er_init (er_msg_file, ER_NEVER_EXIT);
@@ -282,7 +289,14 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
   AU_SAVE_AND_ENABLE (au_save);
   if (!status && (do_objects || !do_schema))
     {
-      if (extractobjects (exec_name))
+      if (worker_count > 1)
+	{
+	  if (extractobjects_parallel (exec_name, user, password))
+	    {
+	      status = 1;
+	    }
+	}
+      else if (extractobjects (exec_name))
 	{
 	  status = 1;
 	}
@@ -59,11 +59,16 @@ extern int is_req_class (DB_OBJECT * class_);
 extern int get_requested_classes (const char *input_filename, DB_OBJECT * class_list[]);
 
 extern int lo_count;
+extern int worker_count;
+
+/* maximum number of processes of a parallel unload */
+#define UNLOAD_MAX_WORKERS 64
 
 #define PRINT_IDENTIFIER(s) "[", (s), "]"
 #define PRINT_FUNCTION_INDEX_NAME(s) "\"", (s), "\""
 
 extern int extractschema (const char *exec_name, int do_auth, EMIT_STORAGE_ORDER emit_storage_order);
 extern int extractobjects (const char *exec_name);
+extern int extractobjects_parallel (const char *exec_name, const char *user, const char *password);
 
 #endif /* _UNLOADDB_H_ */
@@ -492,6 +492,7 @@ static UTIL_ARG_MAP ua_Load_Option_Map[] = {
   {LOAD_SA_MODE_S, {ARG_BOOLEAN}, {1}},
   {LOAD_TABLE_NAME_S, {ARG_STRING}, {0}},
   {LOAD_COMPARE_STORAGE_ORDER_S, {ARG_BOOLEAN}, {0}},
+  {LOAD_PARALLEL_S, {ARG_INTEGER}, {0}},
   {0, {0}, {0}}
 };
 
@@ -515,6 +516,7 @@ static GETOPT_LONG ua_Load_Option[] = {
   {LOAD_SA_MODE_L, 0, 0, LOAD_SA_MODE_S},
   {LOAD_TABLE_NAME_L, 1, 0, LOAD_TABLE_NAME_S},
   {LOAD_COMPARE_STORAGE_ORDER_L, 0, 0, LOAD_COMPARE_STORAGE_ORDER_S},
+  {LOAD_PARALLEL_L, 1, 0, LOAD_PARALLEL_S},
   {0, 0, 0, 0}
 };
 
@@ -539,6 +541,7 @@ static UTIL_ARG_MAP ua_Unload_Option_Map[] = {
   {UNLOAD_USER_S, {ARG_STRING}, {0}},
   {UNLOAD_PASSWORD_S, {ARG_STRING}, {0}},
   {UNLOAD_KEEP_STORAGE_ORDER_S, {ARG_BOOLEAN}, {0}},
+  {UNLOAD_PARALLEL_S, {ARG_INTEGER}, {0}},
   {0, {0}, {0}}
 };
 
@@ -562,6 +565,7 @@ static GETOPT_LONG ua_Unload_Option[] = {
   {UNLOAD_USER_L, 1, 0, LOAD_USER_S},
   {UNLOAD_PASSWORD_L, 1, 0, LOAD_PASSWORD_S},
   {UNLOAD_KEEP_STORAGE_ORDER_L, 0, 0, UNLOAD_KEEP_STORAGE_ORDER_S},
+  {UNLOAD_PARALLEL_L, 1, 0, UNLOAD_PARALLEL_S},
   {0, 0, 0, 0}
 };
 
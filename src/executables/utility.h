@@ -1240,6 +1240,8 @@ typedef struct _ha_config
 #define LOAD_TABLE_NAME_L                       "table"
 #define LOAD_COMPARE_STORAGE_ORDER_S		11817
 #define LOAD_COMPARE_STORAGE_ORDER_L		"compare-storage-order"
+#define LOAD_PARALLEL_S				11818
+#define LOAD_PARALLEL_L				"parallel"
 
 /* unloaddb option list */
 #define UNLOAD_INPUT_CLASS_FILE_S               'i'
@@ -1280,6 +1282,8 @@ typedef struct _ha_config
 #define UNLOAD_PASSWORD_L                       "password"
 #define UNLOAD_KEEP_STORAGE_ORDER_S		11918
 #define UNLOAD_KEEP_STORAGE_ORDER_L		"keep-storage-order"
+#define UNLOAD_PARALLEL_S			11919
+#define UNLOAD_PARALLEL_L			"parallel"
 
 /* compactdb option list */
 #define COMPACT_VERBOSE_S                       'v'
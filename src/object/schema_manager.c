@@ -3800,14 +3800,14 @@ sm_get_statistics_force (MOP classop)
  *    cache them with the class.
  *   return: NO_ERROR on success, non-zero for ERROR
  *   classop(in): class object
- *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sampling_percent(in): percentage of the pages to sample (see STATS_WITH_FULLSCAN)
  *
  * NOTE: We will delay updating statistics until a transaction is committed
  *       when it is requested during other processing, such as
  *       "alter table ..." or "create index ...".
  */
 int
-sm_update_statistics (MOP classop, bool with_fullscan)
+sm_update_statistics (MOP classop, int sampling_percent)
 {
   int error = NO_ERROR, is_class = 0;
   SM_CLASS *class_;
@@ -3835,7 +3835,7 @@ sm_update_statistics (MOP classop, bool with_fullscan)
 	  return er_errid ();
 	}
 
-      error = stats_update_statistics (WS_OID (classop), (with_fullscan ? 1 : 0));
+      error = stats_update_statistics (WS_OID (classop), sampling_percent);
       if (error == NO_ERROR)
 	{
 	  /* only recache if the class itself is cached */
@@ -3873,12 +3873,12 @@ sm_update_statistics (MOP classop, bool with_fullscan)
 /*
  * sm_update_all_statistics() - Update the statistics for all classes
  * 			        in the database.
- *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sampling_percent(in): percentage of the pages to sample (see STATS_WITH_FULLSCAN)
  *   return: NO_ERROR on success, non-zero for ERROR
  */
 
 int
-sm_update_all_statistics (bool with_fullscan)
+sm_update_all_statistics (int sampling_percent)
 {
   int error = NO_ERROR;
   DB_OBJLIST *cl;
@@ -3891,7 +3891,7 @@ sm_update_all_statistics (bool with_fullscan)
       return er_errid ();
     }
 
-  error = stats_update_all_statistics ((with_fullscan ? 1 : 0));
+  error = stats_update_all_statistics (sampling_percent);
   if (error == NO_ERROR)
     {
       /* Need to reset the statistics cache for all resident classes */
@@ -3926,11 +3926,11 @@ sm_update_all_statistics (bool with_fullscan)
 /*
  * sm_update_all_catalog_statistics()
  *   return: NO_ERROR on success, non-zero for ERROR
- *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sampling_percent(in): percentage of the pages to sample (see STATS_WITH_FULLSCAN)
  */
 
 int
-sm_update_all_catalog_statistics (bool with_fullscan)
+sm_update_all_catalog_statistics (int sampling_percent)
 {
   int error = NO_ERROR;
   int i;
@@ -3945,7 +3945,7 @@ sm_update_all_catalog_statistics (bool with_fullscan)
 
   for (i = 0; classes[i] != NULL && error == NO_ERROR; i++)
     {
-      error = sm_update_catalog_statistics (classes[i], with_fullscan);
+      error = sm_update_catalog_statistics (classes[i], sampling_percent);
     }
 
   return error;
@@ -3955,11 +3955,11 @@ sm_update_all_catalog_statistics (bool with_fullscan)
  * sm_update_catalog_statistics()
  *   return: NO_ERROR on success, non-zero for ERROR
  *   class_name(in):
- *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sampling_percent(in): percentage of the pages to sample (see STATS_WITH_FULLSCAN)
  */
 
 int
-sm_update_catalog_statistics (const char *class_name, bool with_fullscan)
+sm_update_catalog_statistics (const char *class_name, int sampling_percent)
 {
   int error = NO_ERROR;
   DB_OBJECT *obj;
@@ -3967,7 +3967,7 @@ sm_update_catalog_statistics (const char *class_name, bool with_fullscan)
   obj = db_find_class (class_name);
   if (obj != NULL)
     {
-      error = sm_update_statistics (obj, with_fullscan);
+      error = sm_update_statistics (obj, sampling_percent);
     }
   else
     {
@@ -124,6 +124,7 @@ typedef struct
   int pkeys_size;		/* pkeys array size */
   int *pkeys;			/* partial keys info for example: index (a, b, ..., x) pkeys[0] -> # of {a} pkeys[1] -> 
 				 * # of {a, b} ... pkeys[key_size-1] -> # of {a, b, ..., x} */
+  STATS_HISTOGRAM *histogram;	/* value distribution of the attribute; NULL if unknown or the node spans classes */
   bool valid_limits;
   bool is_indexed;
 } QO_ATTR_CUM_STATS;
@@ -151,7 +151,8 @@ make_fetch_proc (QO_ENV * env, QO_PLAN * plan)
  *   return: XASL_NODE *
  *   env(in): The optimizer environment
  *   plan(in): The (sub)plan to generate code for merge
- *   left(in): The XASL node that should build a sorted outer result
+ *   left(in): The XASL node that should build a sorted (or, for hash joins,
+ *             unsorted) outer result
  *   left_list(in): The expr, name list used to create the left XASL node
  *   left_exprs(in): The join terms bitset of left expr segs
  *   left_elist(in): The join terms expr list of left expr segs
@@ -204,6 +205,16 @@ make_mergelist_proc (QO_ENV * env, QO_PLAN * plan, XASL_NODE * left, PT_NODE * l
 
   ls_merge->join_type = plan->plan_un.join.join_type;
 
+  /* hash joins do not need their inputs sorted; they are planned for inner joins only */
+  if (plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN && ls_merge->join_type == JOIN_INNER)
+    {
+      ls_merge->join_method = QFILE_JOIN_HASH;
+    }
+  else
+    {
+      ls_merge->join_method = QFILE_JOIN_SORT_MERGE;
+    }
+
   ncols = ls_merge->ls_column_cnt = bitset_cardinality (&(plan->plan_un.join.join_terms));
   assert (ncols > 0);
 
@@ -298,6 +309,13 @@ make_mergelist_proc (QO_ENV * env, QO_PLAN * plan, XASL_NODE * left, PT_NODE * l
 	}
       ls_merge->ls_inner_unique[cnt] = false;	/* currently, unused */
 
+      if (ls_merge->join_method == QFILE_JOIN_HASH)
+	{
+	  /* no order entries are needed to hash the join columns */
+	  cnt++;
+	  continue;
+	}
+
       /* set outer list order entry */
       prev_order = NULL;
       for (order = left->orderby_list; order; order = order->next)
@@ -920,7 +938,8 @@ add_sort_spec (QO_ENV * env, XASL_NODE * xasl, QO_PLAN * plan, DB_VALUE * ordby_
   if (instnum_flag)
     {
       if (xasl && subplan->plan_type == QO_PLANTYPE_JOIN
-	  && subplan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN)
+	  && (subplan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN
+	      || subplan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN))
 	{
 	  PT_NODE *instnum_pred;
 
@@ -1807,6 +1826,7 @@ gen_outer (QO_ENV * env, QO_PLAN * plan, BITSET * subqueries, XASL_NODE * inner_
 	  break;
 
 	case QO_JOINMETHOD_MERGE_JOIN:
+	case QO_JOINMETHOD_HASH_JOIN:
 	  /* 
 	   * The optimizer isn't supposed to produce plans in which a
 	   * merge join isn't "shielded" by a sort (temp file) plan,
@@ -4080,7 +4100,8 @@ qo_check_join_for_multi_range_opt (QO_PLAN * plan)
 
   /* verify that this is a valid join for multi range optimization */
   if (plan == NULL || plan->plan_type != QO_PLANTYPE_JOIN || plan->plan_un.join.join_type != JOIN_INNER
-      || plan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN)
+      || plan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN
+      || plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN)
     {
       return false;
     }
@@ -4799,6 +4799,7 @@ qo_get_attr_info_func_index (QO_ENV * env, QO_SEGMENT * seg, const char *expr_st
   cum_statsp->key_type = NULL;
   cum_statsp->pkeys_size = 0;
   cum_statsp->pkeys = NULL;
+  cum_statsp->histogram = NULL;
 
   /* set the statistics from the class information(QO_CLASS_INFO_ENTRY) */
   for (i = 0; i < n; class_info_entryp++, i++)
@@ -4961,6 +4962,7 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
       cum_statsp->key_type = NULL;
       cum_statsp->pkeys_size = 0;
       cum_statsp->pkeys = NULL;
+      cum_statsp->histogram = NULL;
 
       return attr_infop;
     }
@@ -4974,6 +4976,7 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
   cum_statsp->key_type = NULL;
   cum_statsp->pkeys_size = 0;
   cum_statsp->pkeys = NULL;
+  cum_statsp->histogram = NULL;
 
   /* set the statistics from the class information(QO_CLASS_INFO_ENTRY) */
   for (i = 0; i < n; class_info_entryp++, i++)
@@ -5025,6 +5028,12 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
 	  cum_statsp->valid_limits = true;
 	}
 
+      if (n == 1)
+	{
+	  /* the distribution is only meaningful for a single class */
+	  cum_statsp->histogram = attr_statsp->histogram;
+	}
+
       n_func_indexes = 0;
       for (j = 0; j < attr_statsp->n_btstats; j++)
 	{
@@ -140,6 +140,7 @@ static void qo_sscan_cost (QO_PLAN *);
 static void qo_iscan_cost (QO_PLAN *);
 static void qo_sort_cost (QO_PLAN *);
 static void qo_mjoin_cost (QO_PLAN *);
+static void qo_hjoin_cost (QO_PLAN *);
 static void qo_follow_cost (QO_PLAN *);
 static void qo_worst_cost (QO_PLAN *);
 static void qo_zero_cost (QO_PLAN *);
@@ -177,6 +178,8 @@ static int qo_examine_nl_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSE
 			       BITSET *, int);
 static int qo_examine_merge_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *, BITSET *,
 				  BITSET *);
+static int qo_examine_hash_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *);
+static bool qo_is_hash_join_term (QO_TERM *);
 static int qo_examine_correlated_index (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *);
 static int qo_examine_follow (QO_INFO *, QO_TERM *, QO_INFO *, BITSET *, BITSET *);
 static void qo_compute_projected_segs (QO_PLANNER *, BITSET *, BITSET *, BITSET *);
@@ -321,6 +324,17 @@ static QO_PLAN_VTBL qo_merge_join_plan_vtbl = {
   "Merge join"
 };
 
+static QO_PLAN_VTBL qo_hash_join_plan_vtbl = {
+  "h-join",
+  qo_join_fprint,
+  qo_join_walk,
+  qo_join_free,
+  qo_hjoin_cost,
+  qo_hjoin_cost,
+  qo_join_info,
+  "Hash join"
+};
+
 static QO_PLAN_VTBL qo_follow_plan_vtbl = {
   "follow",
   qo_follow_fprint,
@@ -361,6 +375,7 @@ QO_PLAN_VTBL *all_vtbls[] = {
   &qo_nl_join_plan_vtbl,
   &qo_idx_join_plan_vtbl,
   &qo_merge_join_plan_vtbl,
+  &qo_hash_join_plan_vtbl,
   &qo_follow_plan_vtbl,
   &qo_set_follow_plan_vtbl,
   &qo_worst_plan_vtbl
@@ -456,6 +471,15 @@ static PRED_CLASS qo_classify (PT_NODE * attr);
 
 static int qo_index_cardinality (QO_ENV * env, PT_NODE * attr);
 
+static STATS_HISTOGRAM *qo_attr_histogram (QO_ENV * env, PT_NODE * attr, DB_TYPE * type);
+
+static bool qo_histogram_key (QO_ENV * env, PT_NODE * value, DB_TYPE type, double *key);
+
+static double qo_histogram_equal_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * value, int icard);
+
+static double qo_histogram_range_selectivity (QO_ENV * env, PT_NODE * attr, PT_OP_TYPE op, PT_NODE * arg1,
+					      PT_NODE * arg2);
+
 /*
  * log3 () -
  *   return:
@@ -2748,6 +2772,27 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
 	}
 
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+
+      plan->vtbl = &qo_hash_join_plan_vtbl;
+
+      /* The probe order is lost once tuples are spread over the hash buckets (and the partitions, if the build input
+       * has to be spilled), so the hash join result is never ordered.
+       */
+      plan->order = QO_UNORDERED;
+
+      /* Like merge joins, hash joins work on two list files. */
+      if (outer->plan_type != QO_PLANTYPE_SORT)
+	{
+	  outer = qo_sort_new (outer, QO_UNORDERED, SORT_TEMP);
+	}
+      if (inner->plan_type != QO_PLANTYPE_SORT)
+	{
+	  inner = qo_sort_new (inner, QO_UNORDERED, SORT_TEMP);
+	}
+
+      break;
     }
 
   assert (inner != NULL && outer != NULL);
@@ -2846,7 +2891,7 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
    * not storing them into a listfile. We could push the cost into the merge plan itself, I suppose, but a rational
    * implementation wouldn't impose this cost, and so I have hope that one day we'll be able to eliminate it. 
    */
-  if (join_method == QO_JOINMETHOD_MERGE_JOIN)
+  if (join_method == QO_JOINMETHOD_MERGE_JOIN || join_method == QO_JOINMETHOD_HASH_JOIN)
     {
       plan = qo_sort_new (plan, plan->order, SORT_TEMP);
     }
@@ -3243,6 +3288,60 @@ qo_mjoin_cost (QO_PLAN * planp)
   planp->variable_io_cost = outer->variable_io_cost + inner->variable_io_cost;
 }
 
+/*
+ * qo_hjoin_cost () -
+ *   return:
+ *   planp(in):
+ *
+ * Note: A hash join reads both inputs once: the smaller one is loaded into
+ *       an in-memory hash table and the other one probes it. When the build
+ *       input does not fit in max_hash_join_size, both inputs are written
+ *       once more into partition list files and read back (grace hash join).
+ */
+static void
+qo_hjoin_cost (QO_PLAN * planp)
+{
+  QO_PLAN *inner;
+  QO_PLAN *outer;
+  double outer_cardinality, inner_cardinality;
+  double outer_pages, inner_pages, build_size;
+
+  inner = planp->plan_un.join.inner;
+  outer = planp->plan_un.join.outer;
+
+  /* for worst cost */
+  if (inner->fixed_cpu_cost == QO_INFINITY || inner->fixed_io_cost == QO_INFINITY
+      || inner->variable_cpu_cost == QO_INFINITY || inner->variable_io_cost == QO_INFINITY
+      || outer->fixed_cpu_cost == QO_INFINITY || outer->fixed_io_cost == QO_INFINITY
+      || outer->variable_cpu_cost == QO_INFINITY || outer->variable_io_cost == QO_INFINITY)
+    {
+      qo_worst_cost (planp);
+      return;
+    }
+
+  outer_cardinality = outer->info->cardinality;
+  inner_cardinality = inner->info->cardinality;
+
+  outer_pages = (outer_cardinality * (double) outer->info->projected_size) / (double) IO_PAGESIZE;
+  inner_pages = (inner_cardinality * (double) inner->info->projected_size) / (double) IO_PAGESIZE;
+
+  /* CPU and IO costs which are fixed against join */
+  planp->fixed_cpu_cost = outer->fixed_cpu_cost + inner->fixed_cpu_cost;
+  planp->fixed_io_cost = outer->fixed_io_cost + inner->fixed_io_cost;
+  /* CPU and IO costs which are variable according to the join plan */
+  planp->variable_cpu_cost = outer->variable_cpu_cost + inner->variable_cpu_cost;
+  /* build + probe cost */
+  planp->variable_cpu_cost += (outer_cardinality + inner_cardinality) * (double) QO_CPU_WEIGHT;
+  planp->variable_io_cost = outer->variable_io_cost + inner->variable_io_cost;
+
+  build_size = MIN (outer_pages, inner_pages) * (double) IO_PAGESIZE;
+  if (build_size > (double) prm_get_bigint_value (PRM_ID_MAX_HASH_JOIN_SIZE))
+    {
+      /* partitioning cost: write and read back both inputs */
+      planp->variable_io_cost += 2.0 * (outer_pages + inner_pages);
+    }
+}
+
 /*
  * qo_follow_new () -
  *   return:
@@ -5982,6 +6081,160 @@ exit:
   return n;
 }
 
+/*
+ * qo_is_hash_join_term () - check whether a join term can be evaluated by
+ *			     hashing the values of both of its sides
+ *   return: true if the term can be used as a hash join key
+ *   term(in):
+ *
+ * Note: Values that compare equal must also hash equal. This holds when both
+ *	 sides have the same type and that type has a single representation
+ *	 for every value. Approximate numerics (-0.0 and 0.0) and numerics
+ *	 with different scales do not, so they are left to the other joins.
+ *	 The executor checks the actual list file domains once more and
+ *	 falls back to a sort-merge if they still differ.
+ */
+static bool
+qo_is_hash_join_term (QO_TERM * term)
+{
+  PT_NODE *pt_expr, *lhs, *rhs;
+
+  pt_expr = QO_TERM_PT_EXPR (term);
+  if (pt_expr == NULL || pt_expr->node_type != PT_EXPR || pt_expr->info.expr.op != PT_EQ)
+    {
+      return false;
+    }
+
+  lhs = pt_expr->info.expr.arg1;
+  rhs = pt_expr->info.expr.arg2;
+  if (lhs == NULL || rhs == NULL || lhs->type_enum != rhs->type_enum)
+    {
+      return false;
+    }
+
+  switch (lhs->type_enum)
+    {
+    case PT_TYPE_INTEGER:
+    case PT_TYPE_SMALLINT:
+    case PT_TYPE_BIGINT:
+    case PT_TYPE_DATE:
+    case PT_TYPE_TIME:
+    case PT_TYPE_TIMESTAMP:
+    case PT_TYPE_DATETIME:
+    case PT_TYPE_CHAR:
+    case PT_TYPE_VARCHAR:
+    case PT_TYPE_NCHAR:
+    case PT_TYPE_VARNCHAR:
+    case PT_TYPE_OBJECT:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * qo_examine_hash_join () -
+ *   return: int
+ *   info(in): The info node to be corresponding to the join being investigated
+ *   join_type(in):
+ *   outer(in): The info node for the outer join operand
+ *   inner(in): The info node for the inner join operand
+ *   sm_join_terms(in): The equi-join terms being used to join the operands
+ *   sarged_terms(in): The residual terms to be evaluated at this level of
+ *		       the plan tree
+ *   pinned_subqueries(in): The subqueries to be pinned to plans at this node
+ *
+ * Note: Check whether we can build a hash join of the two operands. Unlike
+ *	 a merge join, a hash join does not care about the order of its
+ *	 inputs, so the best unordered plans are used for both sides. Only
+ *	 inner joins are considered.
+ */
+static int
+qo_examine_hash_join (QO_INFO * info, JOIN_TYPE join_type, QO_INFO * outer, QO_INFO * inner, BITSET * sm_join_terms,
+		      BITSET * sarged_terms, BITSET * pinned_subqueries)
+{
+  int n = 0;
+  QO_PLAN *outer_plan, *inner_plan;
+  QO_NODE *inner_node;
+  int t;
+  BITSET_ITERATOR iter;
+  BITSET empty_terms;
+
+  bitset_init (&empty_terms, info->env);
+
+  if (join_type != JOIN_INNER)
+    {
+      goto exit;
+    }
+
+  /* fake terms have the same timing requirements as with merge joins */
+  if (bitset_intersects (sarged_terms, &(info->env->fake_terms)))
+    {
+      goto exit;
+    }
+
+  for (t = bitset_iterate (sm_join_terms, &iter); t != -1; t = bitset_next_member (&iter))
+    {
+      if (!qo_is_hash_join_term (QO_ENV_TERM (info->env, t)))
+	{
+	  goto exit;
+	}
+    }
+
+  /* At here, inner is single class spec */
+  inner_node = QO_ENV_NODE (inner->env, bitset_first_member (&(inner->nodes)));
+
+  if (QO_NODE_HINT (inner_node) & (PT_HINT_USE_NL | PT_HINT_USE_IDX | PT_HINT_USE_MERGE))
+    {
+      /* join hint: force another join method */
+      goto exit;
+    }
+  else if (!prm_get_bool_value (PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN))
+    {
+      /* optimizer prm: keep out h-join; */
+      goto exit;
+    }
+
+  outer_plan = qo_find_best_plan_on_info (outer, QO_UNORDERED, 1.0);
+  if (outer_plan == NULL)
+    {
+      goto exit;
+    }
+
+  inner_plan = qo_find_best_plan_on_info (inner, QO_UNORDERED, 1.0);
+  if (inner_plan == NULL)
+    {
+      goto exit;
+    }
+
+#ifdef CHAINS_ONLY
+  if (inner_plan->plan_type != QO_PLANTYPE_SCAN)
+    {
+      if (inner_plan->plan_type == QO_PLANTYPE_SORT && inner_plan->order == QO_UNORDERED)
+	{
+	  /* inner has temporary list file plan; it's ok */
+	  ;
+	}
+      else
+	{
+	  goto exit;
+	}
+    }
+#endif /* CHAINS_ONLY */
+
+  n =
+    qo_check_plan_on_info (info,
+			   qo_join_new (info, join_type, QO_JOINMETHOD_HASH_JOIN, outer_plan, inner_plan,
+					sm_join_terms, &empty_terms, &empty_terms, sarged_terms, pinned_subqueries));
+
+exit:
+
+  bitset_delset (&empty_terms);
+
+  return n;
+}
+
 /*
  * qo_examine_correlated_index () -
  *   return: int
@@ -7104,6 +7357,14 @@ planner_visit_node (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
 				     &sarged_terms, &pinned_subqueries);
 	  }
 #endif /* MERGE_JOINS */
+
+	/* STEP 5-5: examine hash-join */
+	if (!bitset_is_empty (&sm_join_terms))
+	  {
+	    kept +=
+	      qo_examine_hash_join (new_info, join_type, head_info, tail_info, &sm_join_terms, &sarged_terms,
+				    &pinned_subqueries);
+	  }
       }
 
     /* At this point, kept indicates the number of worthwhile plans generated by examine_joins (i.e., plans that where
@@ -9213,7 +9474,7 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
   PT_NODE *lhs, *rhs;
   PRED_CLASS pc_lhs, pc_rhs;
   int lhs_icard, rhs_icard, icard;
-  double selectivity;
+  double selectivity, hist_selectivity;
 
   lhs = pt_expr->info.expr.arg1;
   rhs = pt_expr->info.expr.arg2;
@@ -9267,6 +9528,16 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	      selectivity = DEFAULT_EQUAL_SELECTIVITY;
 	    }
 
+	  if (pc_rhs == PC_CONST)
+	    {
+	      /* a skewed value may be far more (or less) frequent than the average one */
+	      hist_selectivity = qo_histogram_equal_selectivity (env, lhs, rhs, lhs_icard);
+	      if (hist_selectivity >= 0.0)
+		{
+		  selectivity = hist_selectivity;
+		}
+	    }
+
 	  break;
 	}
 
@@ -9294,6 +9565,15 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	      selectivity = DEFAULT_EQUAL_SELECTIVITY;
 	    }
 
+	  if (pc_lhs == PC_CONST)
+	    {
+	      hist_selectivity = qo_histogram_equal_selectivity (env, rhs, lhs, rhs_icard);
+	      if (hist_selectivity >= 0.0)
+		{
+		  selectivity = hist_selectivity;
+		}
+	    }
+
 	  break;
 
 	case PC_CONST:
@@ -9319,12 +9599,35 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
  *   env(in): Pointer to an environment structure
  *   pt_expr(in): comparison expression
  *
- * Note: This uses the System R algorithm
+ * Note: This uses the System R algorithm unless the attribute compared with a constant has a histogram
  */
 static double
 qo_comp_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
-  return DEFAULT_COMP_SELECTIVITY;
+  PT_NODE *lhs, *rhs;
+  PT_OP_TYPE op;
+  double selectivity = -1.0;
+
+  lhs = pt_expr->info.expr.arg1;
+  rhs = pt_expr->info.expr.arg2;
+  op = pt_expr->info.expr.op;
+
+  if (qo_classify (lhs) == PC_ATTR && qo_classify (rhs) == PC_CONST)
+    {
+      /* attr op const */
+      op = (op == PT_LT ? PT_BETWEEN_INF_LT : op == PT_LE ? PT_BETWEEN_INF_LE
+	    : op == PT_GT ? PT_BETWEEN_GT_INF : PT_BETWEEN_GE_INF);
+      selectivity = qo_histogram_range_selectivity (env, lhs, op, rhs, NULL);
+    }
+  else if (qo_classify (lhs) == PC_CONST && qo_classify (rhs) == PC_ATTR)
+    {
+      /* const op attr */
+      op = (op == PT_LT ? PT_BETWEEN_GT_INF : op == PT_LE ? PT_BETWEEN_GE_INF
+	    : op == PT_GT ? PT_BETWEEN_INF_LT : PT_BETWEEN_INF_LE);
+      selectivity = qo_histogram_range_selectivity (env, rhs, op, lhs, NULL);
+    }
+
+  return (selectivity >= 0.0) ? selectivity : DEFAULT_COMP_SELECTIVITY;
 }
 
 /*
@@ -9339,13 +9642,21 @@ static double
 qo_between_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
   PT_NODE *and_node;
+  double selectivity = -1.0;
 
   and_node = pt_expr->info.expr.arg2;
 
   QO_ASSERT (env, and_node->node_type == PT_EXPR);
   QO_ASSERT (env, pt_is_between_range_op (and_node->info.expr.op));
 
-  return DEFAULT_BETWEEN_SELECTIVITY;
+  if (qo_classify (pt_expr->info.expr.arg1) == PC_ATTR)
+    {
+      selectivity =
+	qo_histogram_range_selectivity (env, pt_expr->info.expr.arg1, and_node->info.expr.op,
+					and_node->info.expr.arg1, and_node->info.expr.arg2);
+    }
+
+  return (selectivity >= 0.0) ? selectivity : DEFAULT_BETWEEN_SELECTIVITY;
 }
 
 /*
@@ -9359,7 +9670,7 @@ qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
   PT_NODE *lhs, *arg1, *arg2;
   PRED_CLASS pc1;
-  double total_selectivity, selectivity;
+  double total_selectivity, selectivity, hist_selectivity;
   int lhs_icard, rhs_icard, icard;
   PT_NODE *range_node;
   PT_OP_TYPE op_type;
@@ -9396,7 +9707,11 @@ qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr)
       if (op_type == PT_BETWEEN_GE_LE || op_type == PT_BETWEEN_GE_LT || op_type == PT_BETWEEN_GT_LE
 	  || op_type == PT_BETWEEN_GT_LT)
 	{
-	  selectivity = DEFAULT_BETWEEN_SELECTIVITY;
+	  selectivity = qo_histogram_range_selectivity (env, lhs, op_type, arg1, arg2);
+	  if (selectivity < 0.0)
+	    {
+	      selectivity = DEFAULT_BETWEEN_SELECTIVITY;
+	    }
 	}
       else if (op_type == PT_BETWEEN_EQ_NA)
 	{
@@ -9430,13 +9745,26 @@ qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 		{
 		  selectivity = DEFAULT_EQUAL_SELECTIVITY;
 		}
+
+	      if (pc1 == PC_CONST)
+		{
+		  hist_selectivity = qo_histogram_equal_selectivity (env, lhs, arg1, lhs_icard);
+		  if (hist_selectivity >= 0.0)
+		    {
+		      selectivity = hist_selectivity;
+		    }
+		}
 	    }
 	}
       else
 	{
 	  /* PT_BETWEEN_INF_LE, PT_BETWEEN_INF_LT, PT_BETWEEN_GE_INF, and PT_BETWEEN_GT_INF have only one argument */
 
-	  selectivity = DEFAULT_COMP_SELECTIVITY;
+	  selectivity = qo_histogram_range_selectivity (env, lhs, op_type, arg1, NULL);
+	  if (selectivity < 0.0)
+	    {
+	      selectivity = DEFAULT_COMP_SELECTIVITY;
+	    }
 	}
 
       selectivity = MAX (selectivity, 0.0);
@@ -9463,7 +9791,8 @@ qo_all_some_in_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
   PRED_CLASS pc_lhs, pc_rhs;
   int list_card = 0, icard;
-  double equal_selectivity, in_selectivity;
+  double equal_selectivity, in_selectivity, hist_selectivity;
+  PT_NODE *elem;
 
   /* determine the class of each side of the range */
   pc_lhs = qo_classify (pt_expr->info.expr.arg1);
@@ -9484,6 +9813,30 @@ qo_all_some_in_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	  equal_selectivity = DEFAULT_EQUAL_SELECTIVITY;
 	}
 
+      if (pc_rhs == PC_SET && (pt_expr->info.expr.op == PT_IS_IN || pt_expr->info.expr.op == PT_EQ_SOME))
+	{
+	  /* add up the frequencies of the listed values when the attribute has a histogram */
+	  in_selectivity = 0.0;
+	  for (elem = pt_expr->info.expr.arg2->info.value.data_value.set; elem != NULL; elem = elem->next)
+	    {
+	      hist_selectivity = -1.0;
+	      if (qo_classify (elem) == PC_CONST)
+		{
+		  hist_selectivity = qo_histogram_equal_selectivity (env, pt_expr->info.expr.arg1, elem, icard);
+		}
+	      if (hist_selectivity < 0.0)
+		{
+		  break;
+		}
+	      in_selectivity += hist_selectivity;
+	    }
+
+	  if (elem == NULL)
+	    {
+	      return MIN (in_selectivity, 1.0);
+	    }
+	}
+
       /* determine cardinality of set or subquery */
       if (pc_rhs == PC_SET)
 	{
@@ -9609,6 +9962,275 @@ qo_index_cardinality (QO_ENV * env, PT_NODE * attr)
   return info->cum_stats.pkeys[0];
 }
 
+/*
+ * qo_attr_histogram () - Get the histogram of an attribute
+ *   return: histogram of the attribute, or NULL if none was collected
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ *   type(out): data type of the histogram keys
+ */
+static STATS_HISTOGRAM *
+qo_attr_histogram (QO_ENV * env, PT_NODE * attr, DB_TYPE * type)
+{
+  PT_NODE *dummy;
+  QO_NODE *nodep;
+  QO_SEGMENT *segp;
+  QO_ATTR_INFO *info;
+
+  if (attr->node_type == PT_DOT_)
+    {
+      attr = attr->info.dot.arg2;
+    }
+
+  if (attr->node_type != PT_NAME || attr->info.name.meta_class == PT_RESERVED)
+    {
+      return NULL;
+    }
+
+  nodep = lookup_node (attr, env, &dummy);
+  if (nodep == NULL)
+    {
+      return NULL;
+    }
+
+  segp = lookup_seg (nodep, attr, env);
+  if (segp == NULL)
+    {
+      return NULL;
+    }
+
+  info = QO_SEG_INFO (segp);
+  if (info == NULL || info->cum_stats.histogram == NULL || info->cum_stats.histogram->sample_rows <= 0)
+    {
+      return NULL;
+    }
+
+  *type = info->cum_stats.type;
+  return info->cum_stats.histogram;
+}
+
+/*
+ * qo_histogram_key () - Map a constant to the key domain of a histogram
+ *   return: false if the constant cannot be mapped
+ *   env(in): optimizer environment
+ *   value(in): PT_VALUE node
+ *   type(in): data type of the attribute the histogram was built on
+ *   key(out):
+ */
+static bool
+qo_histogram_key (QO_ENV * env, PT_NODE * value, DB_TYPE type, double *key)
+{
+  DB_VALUE *db_value;
+  DB_VALUE coerced;
+  DB_TYPE target_type;
+  bool success;
+
+  db_value = pt_value_to_db (QO_ENV_PARSER (env), value);
+  if (db_value == NULL || DB_IS_NULL (db_value))
+    {
+      return false;
+    }
+
+  /* all the numeric types share the same keys; other constants are coerced to the attribute type */
+  if (TP_IS_NUMERIC_TYPE (type) && TP_IS_NUMERIC_TYPE (DB_VALUE_DOMAIN_TYPE (db_value)))
+    {
+      return stats_histogram_key (db_value, key);
+    }
+
+  target_type = TP_IS_NUMERIC_TYPE (type) ? DB_TYPE_DOUBLE : type;
+  if (DB_VALUE_DOMAIN_TYPE (db_value) == target_type)
+    {
+      return stats_histogram_key (db_value, key);
+    }
+
+  db_make_null (&coerced);
+  if (tp_value_coerce (db_value, &coerced, tp_domain_resolve_default (target_type)) != DOMAIN_COMPATIBLE)
+    {
+      pr_clear_value (&coerced);
+      return false;
+    }
+
+  success = stats_histogram_key (&coerced, key);
+  pr_clear_value (&coerced);
+
+  return success;
+}
+
+/*
+ * qo_histogram_equal_selectivity () - Estimate 'attr = const' from the histogram of the attribute
+ *   return: selectivity, or -1.0 if the attribute has no usable histogram
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ *   value(in): PT_VALUE node compared with the attribute
+ *   icard(in): cardinality of the index on the attribute or 0
+ *
+ * Note: The most frequent values have their own frequencies. The other values share what is left; the index
+ *       cardinality, when known, counts the distinct values better than the sample does.
+ */
+static double
+qo_histogram_equal_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * value, int icard)
+{
+  STATS_HISTOGRAM *histogram;
+  DB_TYPE type;
+  double key, rest, min_selectivity;
+  int i;
+
+  histogram = qo_attr_histogram (env, attr, &type);
+  if (histogram == NULL || !qo_histogram_key (env, value, type, &key))
+    {
+      return -1.0;
+    }
+
+  /* a value missed by the sample is rarer than one row of the sample */
+  min_selectivity = 0.5 / histogram->sample_rows;
+
+  rest = 1.0 - histogram->null_freq;
+  for (i = 0; i < histogram->n_topn; i++)
+    {
+      if (histogram->topn_values[i] == key)
+	{
+	  return histogram->topn_freqs[i];
+	}
+      rest -= histogram->topn_freqs[i];
+    }
+  rest = MAX (rest, 0.0);
+
+  if (histogram->n_buckets == 0 || key < histogram->bounds[0] || key > histogram->bounds[histogram->n_buckets])
+    {
+      return min_selectivity;
+    }
+
+  if (icard > histogram->n_topn)
+    {
+      return MAX (rest / (icard - histogram->n_topn), min_selectivity);
+    }
+
+  for (i = 0; i < histogram->n_buckets - 1; i++)
+    {
+      if (key <= histogram->bounds[i + 1])
+	{
+	  break;
+	}
+    }
+
+  if (histogram->bucket_ndv[i] <= 0.0)
+    {
+      return min_selectivity;
+    }
+
+  return MAX (histogram->bucket_freqs[i] / histogram->bucket_ndv[i], min_selectivity);
+}
+
+/*
+ * qo_histogram_range_selectivity () - Estimate a range of an attribute from its histogram
+ *   return: selectivity, or -1.0 if the attribute has no usable histogram
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ *   op(in): PT_BETWEEN_AND or one of the PT_BETWEEN_xx_yy range operators
+ *   arg1(in): lower bound, or upper bound of PT_BETWEEN_INF_LE/PT_BETWEEN_INF_LT
+ *   arg2(in): upper bound of the two bounds operators
+ *
+ * Note: The most frequent values inside the range are added up exactly; the buckets are assumed to be uniformly
+ *       spread between their bounds.
+ */
+static double
+qo_histogram_range_selectivity (QO_ENV * env, PT_NODE * attr, PT_OP_TYPE op, PT_NODE * arg1, PT_NODE * arg2)
+{
+  STATS_HISTOGRAM *histogram;
+  DB_TYPE type;
+  double lower = 0.0, upper = 0.0;
+  bool has_lower = true, has_upper = true;
+  bool lower_incl = true, upper_incl = true;
+  double bucket_lower, bucket_upper, overlap_lower, overlap_upper;
+  double selectivity, value;
+  int i;
+
+  histogram = qo_attr_histogram (env, attr, &type);
+  if (histogram == NULL)
+    {
+      return -1.0;
+    }
+
+  switch (op)
+    {
+    case PT_BETWEEN_AND:
+    case PT_BETWEEN_GE_LE:
+      break;
+    case PT_BETWEEN_GE_LT:
+      upper_incl = false;
+      break;
+    case PT_BETWEEN_GT_LE:
+      lower_incl = false;
+      break;
+    case PT_BETWEEN_GT_LT:
+      lower_incl = upper_incl = false;
+      break;
+    case PT_BETWEEN_INF_LE:
+    case PT_BETWEEN_INF_LT:
+      /* the only argument is the upper bound */
+      has_lower = false;
+      upper_incl = (op == PT_BETWEEN_INF_LE);
+      arg2 = arg1;
+      arg1 = NULL;
+      break;
+    case PT_BETWEEN_GE_INF:
+    case PT_BETWEEN_GT_INF:
+      has_upper = false;
+      lower_incl = (op == PT_BETWEEN_GE_INF);
+      arg2 = NULL;
+      break;
+    default:
+      return -1.0;
+    }
+
+  if (has_lower && (arg1 == NULL || qo_classify (arg1) != PC_CONST || !qo_histogram_key (env, arg1, type, &lower)))
+    {
+      return -1.0;
+    }
+  if (has_upper && (arg2 == NULL || qo_classify (arg2) != PC_CONST || !qo_histogram_key (env, arg2, type, &upper)))
+    {
+      return -1.0;
+    }
+
+  selectivity = 0.0;
+
+  for (i = 0; i < histogram->n_topn; i++)
+    {
+      value = histogram->topn_values[i];
+      if ((!has_lower || value > lower || (lower_incl && value == lower))
+	  && (!has_upper || value < upper || (upper_incl && value == upper)))
+	{
+	  selectivity += histogram->topn_freqs[i];
+	}
+    }
+
+  for (i = 0; i < histogram->n_buckets; i++)
+    {
+      bucket_lower = histogram->bounds[i];
+      bucket_upper = histogram->bounds[i + 1];
+
+      overlap_lower = has_lower ? MAX (lower, bucket_lower) : bucket_lower;
+      overlap_upper = has_upper ? MIN (upper, bucket_upper) : bucket_upper;
+      if (overlap_lower > overlap_upper)
+	{
+	  continue;
+	}
+
+      if (bucket_upper > bucket_lower)
+	{
+	  selectivity += histogram->bucket_freqs[i] * (overlap_upper - overlap_lower) / (bucket_upper - bucket_lower);
+	}
+      else if ((!has_lower || lower_incl || bucket_lower > lower) && (!has_upper || upper_incl || bucket_upper < upper))
+	{
+	  /* the bucket holds a single value */
+	  selectivity += histogram->bucket_freqs[i];
+	}
+    }
+
+  selectivity = MAX (selectivity, 0.5 / histogram->sample_rows);
+  return MIN (selectivity, 1.0);
+}
+
 /*
  * qo_is_all_unique_index_columns_are_equi_terms () -
  *   check if the current plan uses and
@@ -10525,7 +11147,7 @@ qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_i
 	    }
 	  else
 	    {
-	      /* QO_JOINMETHOD_MERGE_JOIN */
+	      /* QO_JOINMETHOD_MERGE_JOIN, QO_JOINMETHOD_HASH_JOIN */
 	      plan = NULL;
 	    }
 	  break;
@@ -11069,6 +11691,10 @@ qo_plan_join_print_json (QO_PLAN * plan)
     case QO_JOINMETHOD_MERGE_JOIN:
       method = "MERGE JOIN";
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+      method = "HASH JOIN";
+      break;
     }
 
   switch (plan->plan_un.join.join_type)
@@ -11380,6 +12006,10 @@ qo_plan_join_print_text (FILE * fp, QO_PLAN * plan, int indent)
     case QO_JOINMETHOD_MERGE_JOIN:
       method = "MERGE JOIN";
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+      method = "HASH JOIN";
+      break;
     }
 
   switch (plan->plan_un.join.join_type)
@@ -1,13 +1,13 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Skeleton interface for Bison GLR parsers in C
 
-   Copyright (C) 2002, 2003, 2004, 2005, 2006 Free Software Foundation, Inc.
+   Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -15,9 +15,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -32,571 +30,17 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     ABSOLUTE_ = 258,
-     ACTION = 259,
-     ADD = 260,
-     ADD_MONTHS = 261,
-     AFTER = 262,
-     ALL = 263,
-     ALLOCATE = 264,
-     ALTER = 265,
-     AND = 266,
-     ANY = 267,
-     ARE = 268,
-     AS = 269,
-     ASC = 270,
-     ASSERTION = 271,
-     ASYNC = 272,
-     AT = 273,
-     ATTACH = 274,
-     ATTRIBUTE = 275,
-     AVG = 276,
-     BEFORE = 277,
-     BEGIN_ = 278,
-     BETWEEN = 279,
-     BIGINT = 280,
-     BINARY = 281,
-     BIT = 282,
-     BIT_LENGTH = 283,
-     BITSHIFT_LEFT = 284,
-     BITSHIFT_RIGHT = 285,
-     BLOB_ = 286,
-     BOOLEAN_ = 287,
-     BOTH_ = 288,
-     BREADTH = 289,
-     BY = 290,
-     CALL = 291,
-     CASCADE = 292,
-     CASCADED = 293,
-     CASE = 294,
-     CAST = 295,
-     CATALOG = 296,
-     CHANGE = 297,
-     CHAR_ = 298,
-     CHECK = 299,
-     CLASS = 300,
-     CLASSES = 301,
-     CLOB_ = 302,
-     CLOSE = 303,
-     COALESCE = 304,
-     COLLATE = 305,
-     COLUMN = 306,
-     COMMIT = 307,
-     COMP_NULLSAFE_EQ = 308,
-     CONNECT = 309,
-     CONNECT_BY_ISCYCLE = 310,
-     CONNECT_BY_ISLEAF = 311,
-     CONNECT_BY_ROOT = 312,
-     CONNECTION = 313,
-     CONSTRAINT = 314,
-     CONSTRAINTS = 315,
-     CONTINUE = 316,
-     CONVERT = 317,
-     CORRESPONDING = 318,
-     COUNT = 319,
-     CREATE = 320,
-     CROSS = 321,
-     CURRENT = 322,
-     CURRENT_DATE = 323,
-     CURRENT_DATETIME = 324,
-     CURRENT_TIME = 325,
-     CURRENT_TIMESTAMP = 326,
-     CURRENT_USER = 327,
-     CURSOR = 328,
-     CYCLE = 329,
-     DATA = 330,
-     DATABASE = 331,
-     DATA_TYPE_ = 332,
-     Date = 333,
-     DATETIME = 334,
-     DATETIMETZ = 335,
-     DATETIMELTZ = 336,
-     DAY_ = 337,
-     DAY_MILLISECOND = 338,
-     DAY_SECOND = 339,
-     DAY_MINUTE = 340,
-     DAY_HOUR = 341,
-     DB_TIMEZONE = 342,
-     DEALLOCATE = 343,
-     DECLARE = 344,
-     DEFAULT = 345,
-     DEFERRABLE = 346,
-     DEFERRED = 347,
-     DELETE_ = 348,
-     DEPTH = 349,
-     DESC = 350,
-     DESCRIBE = 351,
-     DESCRIPTOR = 352,
-     DIAGNOSTICS = 353,
-     DIFFERENCE_ = 354,
-     DISCONNECT = 355,
-     DISTINCT = 356,
-     DIV = 357,
-     DO = 358,
-     Domain = 359,
-     Double = 360,
-     DROP = 361,
-     DUPLICATE_ = 362,
-     EACH = 363,
-     ELSE = 364,
-     ELSEIF = 365,
-     END = 366,
-     ENUM = 367,
-     EQUALS = 368,
-     ESCAPE = 369,
-     EVALUATE = 370,
-     EXCEPT = 371,
-     EXCEPTION = 372,
-     EXEC = 373,
-     EXECUTE = 374,
-     EXISTS = 375,
-     EXTERNAL = 376,
-     EXTRACT = 377,
-     False = 378,
-     FETCH = 379,
-     File = 380,
-     FIRST = 381,
-     FLOAT_ = 382,
-     For = 383,
-     FORCE = 384,
-     FOREIGN = 385,
-     FOUND = 386,
-     FROM = 387,
-     FULL = 388,
-     FUNCTION = 389,
-     GENERAL = 390,
-     GET = 391,
-     GLOBAL = 392,
-     GO = 393,
-     GOTO = 394,
-     GRANT = 395,
-     GROUP_ = 396,
-     HAVING = 397,
-     HOUR_ = 398,
-     HOUR_MILLISECOND = 399,
-     HOUR_SECOND = 400,
-     HOUR_MINUTE = 401,
-     IDENTITY = 402,
-     IF = 403,
-     IGNORE_ = 404,
-     IMMEDIATE = 405,
-     IN_ = 406,
-     INDEX = 407,
-     INDICATOR = 408,
-     INHERIT = 409,
-     INITIALLY = 410,
-     INNER = 411,
-     INOUT = 412,
-     INPUT_ = 413,
-     INSERT = 414,
-     INTEGER = 415,
-     INTERNAL = 416,
-     INTERSECT = 417,
-     INTERSECTION = 418,
-     INTERVAL = 419,
-     INTO = 420,
-     IS = 421,
-     ISOLATION = 422,
-     JOIN = 423,
-     KEY = 424,
-     KEYLIMIT = 425,
-     LANGUAGE = 426,
-     LAST = 427,
-     LEADING_ = 428,
-     LEAVE = 429,
-     LEFT = 430,
-     LESS = 431,
-     LEVEL = 432,
-     LIKE = 433,
-     LIMIT = 434,
-     LIST = 435,
-     LOCAL = 436,
-     LOCAL_TRANSACTION_ID = 437,
-     LOCALTIME = 438,
-     LOCALTIMESTAMP = 439,
-     LOOP = 440,
-     LOWER = 441,
-     MATCH = 442,
-     MATCHED = 443,
-     Max = 444,
-     MERGE = 445,
-     METHOD = 446,
-     MILLISECOND_ = 447,
-     Min = 448,
-     MINUTE_ = 449,
-     MINUTE_MILLISECOND = 450,
-     MINUTE_SECOND = 451,
-     MOD = 452,
-     MODIFY = 453,
-     MODULE = 454,
-     Monetary = 455,
-     MONTH_ = 456,
-     MULTISET = 457,
-     MULTISET_OF = 458,
-     NA = 459,
-     NAMES = 460,
-     NATIONAL = 461,
-     NATURAL = 462,
-     NCHAR = 463,
-     NEXT = 464,
-     NO = 465,
-     NOT = 466,
-     Null = 467,
-     NULLIF = 468,
-     NUMERIC = 469,
-     OBJECT = 470,
-     OCTET_LENGTH = 471,
-     OF = 472,
-     OFF_ = 473,
-     ON_ = 474,
-     ONLY = 475,
-     OPEN = 476,
-     OPTIMIZATION = 477,
-     OPTION = 478,
-     OR = 479,
-     ORDER = 480,
-     OUT_ = 481,
-     OUTER = 482,
-     OUTPUT = 483,
-     OVER = 484,
-     OVERLAPS = 485,
-     PARAMETERS = 486,
-     PARTIAL = 487,
-     PARTITION = 488,
-     POSITION = 489,
-     PRECISION = 490,
-     PREPARE = 491,
-     PRESERVE = 492,
-     PRIMARY = 493,
-     PRIOR = 494,
-     PRIVILEGES = 495,
-     PROCEDURE = 496,
-     PROMOTE = 497,
-     QUERY = 498,
-     READ = 499,
-     REBUILD = 500,
-     RECURSIVE = 501,
-     REF = 502,
-     REFERENCES = 503,
-     REFERENCING = 504,
-     REGEXP = 505,
-     RELATIVE_ = 506,
-     RENAME = 507,
-     REPLACE = 508,
-     RESIGNAL = 509,
-     RESTRICT = 510,
-     RETURN = 511,
-     RETURNS = 512,
-     REVOKE = 513,
-     RIGHT = 514,
-     RLIKE = 515,
-     ROLE = 516,
-     ROLLBACK = 517,
-     ROLLUP = 518,
-     ROUTINE = 519,
-     ROW = 520,
-     ROWNUM = 521,
-     ROWS = 522,
-     SAVEPOINT = 523,
-     SCHEMA = 524,
-     SCOPE = 525,
-     SCROLL = 526,
-     SEARCH = 527,
-     SECOND_ = 528,
-     SECOND_MILLISECOND = 529,
-     SECTION = 530,
-     SELECT = 531,
-     SENSITIVE = 532,
-     SEQUENCE = 533,
-     SEQUENCE_OF = 534,
-     SERIALIZABLE = 535,
-     SESSION = 536,
-     SESSION_TIMEZONE = 537,
-     SESSION_USER = 538,
-     SET = 539,
-     SET_OF = 540,
-     SETEQ = 541,
-     SETNEQ = 542,
-     SHARED = 543,
-     SIBLINGS = 544,
-     SIGNAL = 545,
-     SIMILAR = 546,
-     SIZE_ = 547,
-     SmallInt = 548,
-     SOME = 549,
-     SQL = 550,
-     SQLCODE = 551,
-     SQLERROR = 552,
-     SQLEXCEPTION = 553,
-     SQLSTATE = 554,
-     SQLWARNING = 555,
-     STATISTICS = 556,
-     String = 557,
-     SUBCLASS = 558,
-     SUBSET = 559,
-     SUBSETEQ = 560,
-     SUBSTRING_ = 561,
-     SUM = 562,
-     SUPERCLASS = 563,
-     SUPERSET = 564,
-     SUPERSETEQ = 565,
-     SYS_CONNECT_BY_PATH = 566,
-     SYS_DATE = 567,
-     SYS_DATETIME = 568,
-     SYS_TIME_ = 569,
-     SYS_TIMESTAMP = 570,
-     SYSTEM_USER = 571,
-     TABLE = 572,
-     TEMPORARY = 573,
-     THEN = 574,
-     Time = 575,
-     TIMESTAMP = 576,
-     TIMESTAMPTZ = 577,
-     TIMESTAMPLTZ = 578,
-     TIMEZONE = 579,
-     TIMEZONE_HOUR = 580,
-     TIMEZONE_MINUTE = 581,
-     TO = 582,
-     TRAILING_ = 583,
-     TRANSACTION = 584,
-     TRANSLATE = 585,
-     TRANSLATION = 586,
-     TRIGGER = 587,
-     TRIM = 588,
-     True = 589,
-     TRUNCATE = 590,
-     UNDER = 591,
-     Union = 592,
-     UNIQUE = 593,
-     UNKNOWN = 594,
-     UNTERMINATED_STRING = 595,
-     UNTERMINATED_IDENTIFIER = 596,
-     UPDATE = 597,
-     UPPER = 598,
-     USAGE = 599,
-     USE = 600,
-     USER = 601,
-     USING = 602,
-     Utime = 603,
-     VACUUM = 604,
-     VALUE = 605,
-     VALUES = 606,
-     VAR_ASSIGN = 607,
-     VARCHAR = 608,
-     VARIABLE_ = 609,
-     VARYING = 610,
-     VCLASS = 611,
-     VIEW = 612,
-     WHEN = 613,
-     WHENEVER = 614,
-     WHERE = 615,
-     WHILE = 616,
-     WITH = 617,
-     WITHOUT = 618,
-     WORK = 619,
-     WRITE = 620,
-     XOR = 621,
-     YEAR_ = 622,
-     YEAR_MONTH = 623,
-     ZONE = 624,
-     YEN_SIGN = 625,
-     DOLLAR_SIGN = 626,
-     WON_SIGN = 627,
-     TURKISH_LIRA_SIGN = 628,
-     BRITISH_POUND_SIGN = 629,
-     CAMBODIAN_RIEL_SIGN = 630,
-     CHINESE_RENMINBI_SIGN = 631,
-     INDIAN_RUPEE_SIGN = 632,
-     RUSSIAN_RUBLE_SIGN = 633,
-     AUSTRALIAN_DOLLAR_SIGN = 634,
-     CANADIAN_DOLLAR_SIGN = 635,
-     BRASILIAN_REAL_SIGN = 636,
-     ROMANIAN_LEU_SIGN = 637,
-     EURO_SIGN = 638,
-     SWISS_FRANC_SIGN = 639,
-     DANISH_KRONE_SIGN = 640,
-     NORWEGIAN_KRONE_SIGN = 641,
-     BULGARIAN_LEV_SIGN = 642,
-     VIETNAMESE_DONG_SIGN = 643,
-     CZECH_KORUNA_SIGN = 644,
-     POLISH_ZLOTY_SIGN = 645,
-     SWEDISH_KRONA_SIGN = 646,
-     CROATIAN_KUNA_SIGN = 647,
-     SERBIAN_DINAR_SIGN = 648,
-     DOT = 649,
-     RIGHT_ARROW = 650,
-     STRCAT = 651,
-     COMP_NOT_EQ = 652,
-     COMP_GE = 653,
-     COMP_LE = 654,
-     PARAM_HEADER = 655,
-     ACCESS = 656,
-     ACTIVE = 657,
-     ADDDATE = 658,
-     ANALYZE = 659,
-     ARCHIVE = 660,
-     AUTO_INCREMENT = 661,
-     BIT_AND = 662,
-     BIT_OR = 663,
-     BIT_XOR = 664,
-     CACHE = 665,
-     CAPACITY = 666,
-     CHARACTER_SET_ = 667,
-     CHARSET = 668,
-     CHR = 669,
-     CLOB_TO_CHAR = 670,
-     COLLATION = 671,
-     COLUMNS = 672,
-     COMMENT = 673,
-     COMMITTED = 674,
-     COST = 675,
-     CRITICAL = 676,
-     CUME_DIST = 677,
-     DATE_ADD = 678,
-     DATE_SUB = 679,
-     DECREMENT = 680,
-     DENSE_RANK = 681,
-     ELT = 682,
-     EXPLAIN = 683,
-     FIRST_VALUE = 684,
-     FULLSCAN = 685,
-     GE_INF_ = 686,
-     GE_LE_ = 687,
-     GE_LT_ = 688,
-     GRANTS = 689,
-     GROUP_CONCAT = 690,
-     GROUPS = 691,
-     GT_INF_ = 692,
-     GT_LE_ = 693,
-     GT_LT_ = 694,
-     HASH = 695,
-     HEADER = 696,
-     HEAP = 697,
-     IFNULL = 698,
-     INACTIVE = 699,
-     INCREMENT = 700,
-     INDEXES = 701,
-     INDEX_PREFIX = 702,
-     INF_LE_ = 703,
-     INF_LT_ = 704,
-     INFINITE_ = 705,
-     INSTANCES = 706,
-     INVALIDATE = 707,
-     ISNULL = 708,
-     KEYS = 709,
-     KILL = 710,
-     JAVA = 711,
-     JOB = 712,
-     JSON = 713,
-     LAG = 714,
-     LAST_VALUE = 715,
-     LCASE = 716,
-     LEAD = 717,
-     LOCK_ = 718,
-     LOG = 719,
-     MAXIMUM = 720,
-     MAXVALUE = 721,
-     MEDIAN = 722,
-     MEMBERS = 723,
-     MINVALUE = 724,
-     NAME = 725,
-     NOCYCLE = 726,
-     NOCACHE = 727,
-     NOMAXVALUE = 728,
-     NOMINVALUE = 729,
-     NONE = 730,
-     NTH_VALUE = 731,
-     NTILE = 732,
-     NULLS = 733,
-     OFFSET = 734,
-     OWNER = 735,
-     PAGE = 736,
-     PARTITIONING = 737,
-     PARTITIONS = 738,
-     PASSWORD = 739,
-     PERCENT_RANK = 740,
-     PERCENTILE_CONT = 741,
-     PERCENTILE_DISC = 742,
-     PRINT = 743,
-     PRIORITY = 744,
-     QUARTER = 745,
-     QUEUES = 746,
-     RANGE_ = 747,
-     RANK = 748,
-     REJECT_ = 749,
-     REMOVE = 750,
-     REORGANIZE = 751,
-     REPEATABLE = 752,
-     RESPECT = 753,
-     RETAIN = 754,
-     REUSE_OID = 755,
-     REVERSE = 756,
-     ROW_NUMBER = 757,
-     SECTIONS = 758,
-     SEPARATOR = 759,
-     SERIAL = 760,
-     SHOW = 761,
-     SLEEP = 762,
-     SLOTS = 763,
-     SLOTTED = 764,
-     STABILITY = 765,
-     START_ = 766,
-     STATEMENT = 767,
-     STATUS = 768,
-     STDDEV = 769,
-     STDDEV_POP = 770,
-     STDDEV_SAMP = 771,
-     STR_TO_DATE = 772,
-     SUBDATE = 773,
-     SYSTEM = 774,
-     TABLES = 775,
-     TEXT = 776,
-     THAN = 777,
-     THREADS = 778,
-     TIMEOUT = 779,
-     TRACE = 780,
-     TRAN = 781,
-     TRIGGERS = 782,
-     UCASE = 783,
-     UNCOMMITTED = 784,
-     VAR_POP = 785,
-     VAR_SAMP = 786,
-     VARIANCE = 787,
-     VOLUME = 788,
-     WEEK = 789,
-     WITHIN = 790,
-     WORKSPACE = 791,
-     TIMEZONES = 792,
-     IdName = 793,
-     BracketDelimitedIdName = 794,
-     BacktickDelimitedIdName = 795,
-     DelimitedIdName = 796,
-     UNSIGNED_INTEGER = 797,
-     UNSIGNED_REAL = 798,
-     CHAR_STRING = 799,
-     NCHAR_STRING = 800,
-     BIT_STRING = 801,
-     HEX_STRING = 802,
-     CPP_STYLE_HINT = 803,
-     C_STYLE_HINT = 804,
-     SQL_STYLE_HINT = 805,
-     BINARY_STRING = 806,
-     EUCKR_STRING = 807,
-     ISO_STRING = 808,
-     UTF8_STRING = 809
-   };
+#ifndef YY_CSQL_YY_CSQL_GRAMMAR_H_INCLUDED
+# define YY_CSQL_YY_CSQL_GRAMMAR_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
 #endif
+#if YYDEBUG
+extern int csql_yydebug;
+#endif
+/* "%code requires" blocks.  */
 
-
-/* Copy the first part of user declarations.  */
-#line 26 "../../src/parser/csql_grammar.y"
-/*%CODE_REQUIRES_START%*/
 #include "parser.h"
 
 /* 
@@ -656,513 +100,578 @@ void csql_yyerror (const char *s);
 extern int g_msg[1024];
 extern int msg_ptr;
 extern int yybuffer_pos;
-/*%CODE_END%*/#line 88 "../../src/parser/csql_grammar.y"
-
-#define YYMAXDEPTH	1000000
-
-/* #define PARSER_DEBUG */
-
-#include "config.h"
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <ctype.h>
-#include <math.h>
-#include <errno.h>
-
-#include "chartype.h"
-#include "parser.h"
-#include "parser_message.h"
-#include "dbdef.h"
-#include "language_support.h"
-#include "unicode_support.h"
-#include "environment_variable.h"
-#include "transaction_cl.h"
-#include "csql_grammar_scan.h"
-#include "system_parameter.h"
-#define JP_MAXNAME 256
-#if defined(WINDOWS)
-#define snprintf _sprintf_p
-#endif /* WINDOWS */
-#include "memory_alloc.h"
-#include "db_elo.h"
-
-/* Bit mask to be used to check constraints of a column.
- * COLUMN_CONSTRAINT_SHARED_DEFAULT_AI is special-purpose mask
- * to identify duplication of SHARED, DEFAULT and AUTO_INCREMENT.
- */
-#define COLUMN_CONSTRAINT_UNIQUE		(0x01)
-#define COLUMN_CONSTRAINT_PRIMARY_KEY		(0x02)
-#define COLUMN_CONSTRAINT_NULL			(0x04)
-#define COLUMN_CONSTRAINT_OTHERS		(0x08)
-#define COLUMN_CONSTRAINT_SHARED		(0x10)
-#define COLUMN_CONSTRAINT_DEFAULT		(0x20)
-#define COLUMN_CONSTRAINT_AUTO_INCREMENT	(0x40)
-#define COLUMN_CONSTRAINT_SHARED_DEFAULT_AI	(0x70)
-#define COLUMN_CONSTRAINT_COMMENT       (0x80)
-
-#ifdef PARSER_DEBUG
-#define DBG_PRINT printf("rule matched at line: %d\n", __LINE__);
-#define PRINT_(a) printf(a)
-#define PRINT_1(a, b) printf(a, b)
-#define PRINT_2(a, b, c) printf(a, b, c)
-#else
-#define DBG_PRINT
-#define PRINT_(a)
-#define PRINT_1(a, b)
-#define PRINT_2(a, b, c)
-#endif
-
-#define STACK_SIZE	128
-
-typedef struct function_map FUNCTION_MAP;
-struct function_map
-{
-  const char *keyword;
-  PT_OP_TYPE op;
-};
-
-
-static FUNCTION_MAP functions[] = {
-  {"abs", PT_ABS},
-  {"acos", PT_ACOS},
-  {"addtime", PT_ADDTIME}, 
-  {"asin", PT_ASIN},
-  {"atan", PT_ATAN},
-  {"atan2", PT_ATAN2},
-  {"bin", PT_BIN},
-  {"bit_count", PT_BIT_COUNT},
-  {"bit_to_blob", PT_BIT_TO_BLOB},
-  {"blob_from_file", PT_BLOB_FROM_FILE},
-  {"blob_length", PT_BLOB_LENGTH},
-  {"blob_to_bit", PT_BLOB_TO_BIT},
-  {"ceil", PT_CEIL},
-  {"ceiling", PT_CEIL},
-  {"char_length", PT_CHAR_LENGTH},
-  {"char_to_blob", PT_CHAR_TO_BLOB},
-  {"char_to_clob", PT_CHAR_TO_CLOB},
-  {"character_length", PT_CHAR_LENGTH},
-  {"clob_from_file", PT_CLOB_FROM_FILE},
-  {"clob_length", PT_CLOB_LENGTH},
-  {"concat", PT_CONCAT},
-  {"concat_ws", PT_CONCAT_WS},
-  {"cos", PT_COS},
-  {"cot", PT_COT},
-  {"cume_dist", PT_CUME_DIST},
-  {"curtime", PT_CURRENT_TIME},
-  {"curdate", PT_CURRENT_DATE},
-  {"utc_time", PT_UTC_TIME},
-  {"utc_date", PT_UTC_DATE},
-  {"datediff", PT_DATEDIFF},
-  {"timediff",PT_TIMEDIFF},
-  {"date_format", PT_DATE_FORMAT},
-  {"dayofmonth", PT_DAYOFMONTH},
-  {"dayofyear", PT_DAYOFYEAR},
-  {"decode", PT_DECODE},
-  {"decr", PT_DECR},
-  {"degrees", PT_DEGREES},
-  {"drand", PT_DRAND},
-  {"drandom", PT_DRANDOM},
-  {"exec_stats", PT_EXEC_STATS},
-  {"exp", PT_EXP},
-  {"field", PT_FIELD},
-  {"floor", PT_FLOOR},
-  {"from_days", PT_FROMDAYS},
-  {"greatest", PT_GREATEST},
-  {"groupby_num", PT_GROUPBY_NUM},
-  {"incr", PT_INCR},
-  {"index_cardinality", PT_INDEX_CARDINALITY},
-  {"inst_num", PT_INST_NUM},
-  {"instr", PT_INSTR},
-  {"instrb", PT_INSTR},
-  {"last_day", PT_LAST_DAY},
-  {"length", PT_CHAR_LENGTH},
-  {"lengthb", PT_CHAR_LENGTH},
-  {"least", PT_LEAST},
-  {"like_match_lower_bound", PT_LIKE_LOWER_BOUND},
-  {"like_match_upper_bound", PT_LIKE_UPPER_BOUND},
-  {"list_dbs", PT_LIST_DBS},
-  {"locate", PT_LOCATE},
-  {"ln", PT_LN},
-  {"log2", PT_LOG2},
-  {"log10", PT_LOG10},
-  {"log", PT_LOG},
-  {"lpad", PT_LPAD},
-  {"ltrim", PT_LTRIM},
-  {"makedate", PT_MAKEDATE},
-  {"maketime", PT_MAKETIME},
-  {"mid", PT_MID},
-  {"months_between", PT_MONTHS_BETWEEN},
-  {"new_time", PT_NEW_TIME},
-  {"format", PT_FORMAT},
-  {"now", PT_CURRENT_DATETIME},
-  {"nvl", PT_NVL},
-  {"nvl2", PT_NVL2},
-  {"orderby_num", PT_ORDERBY_NUM},
-  {"percent_rank", PT_PERCENT_RANK},
-  {"power", PT_POWER},
-  {"pow", PT_POWER},
-  {"pi", PT_PI},
-  {"radians", PT_RADIANS},
-  {"rand", PT_RAND},
-  {"random", PT_RANDOM},
-  {"repeat", PT_REPEAT},
-  {"space", PT_SPACE},
-  {"reverse", PT_REVERSE},
-  {"round", PT_ROUND},
-  {"row_count", PT_ROW_COUNT},
-  {"last_insert_id", PT_LAST_INSERT_ID},
-  {"rpad", PT_RPAD},
-  {"rtrim", PT_RTRIM},
-  {"sec_to_time", PT_SECTOTIME},
-  {"serial_current_value", PT_CURRENT_VALUE},
-  {"serial_next_value", PT_NEXT_VALUE},
-  {"sign", PT_SIGN},
-  {"sin", PT_SIN},
-  {"sqrt", PT_SQRT},
-  {"strcmp", PT_STRCMP},
-  {"substr", PT_SUBSTRING},
-  {"substring_index", PT_SUBSTRING_INDEX},
-  {"find_in_set", PT_FINDINSET},
-  {"md5", PT_MD5},
-/*
- * temporarily block aes_encrypt and aes_decrypt functions until binary string charset is available.
- *
- *  {"aes_encrypt", PT_AES_ENCRYPT},
- *  {"aes_decrypt", PT_AES_DECRYPT},
- */	
-  {"sha1", PT_SHA_ONE},	
-  {"sha2", PT_SHA_TWO},	
-  {"substrb", PT_SUBSTRING},
-  {"tan", PT_TAN},
-  {"time_format", PT_TIME_FORMAT},
-  {"to_char", PT_TO_CHAR},
-  {"to_date", PT_TO_DATE},
-  {"to_datetime", PT_TO_DATETIME},
-  {"to_days", PT_TODAYS},
-  {"time_to_sec", PT_TIMETOSEC},
-  {"to_number", PT_TO_NUMBER},
-  {"to_time", PT_TO_TIME},
-  {"to_timestamp", PT_TO_TIMESTAMP},
-  {"trunc", PT_TRUNC},
-  {"tz_offset", PT_TZ_OFFSET},
-  {"unix_timestamp", PT_UNIX_TIMESTAMP},
-  {"typeof", PT_TYPEOF},
-  {"from_unixtime", PT_FROM_UNIXTIME},
-  {"from_tz", PT_FROM_TZ},
-  {"weekday", PT_WEEKDAY},
-  {"dayofweek", PT_DAYOFWEEK},
-  {"version", PT_VERSION},
-  {"quarter", PT_QUARTERF},
-  {"week", PT_WEEKF},
-  {"hex", PT_HEX},
-  {"ascii", PT_ASCII},
-  {"conv", PT_CONV},
-  {"inet_aton", PT_INET_ATON},
-  {"inet_ntoa", PT_INET_NTOA},
-  {"coercibility", PT_COERCIBILITY},
-  {"width_bucket", PT_WIDTH_BUCKET},
-  {"trace_stats", PT_TRACE_STATS},
-  {"str_to_date", PT_STR_TO_DATE},
-  {"to_base64", PT_TO_BASE64},
-  {"from_base64", PT_FROM_BASE64},
-  {"sys_guid", PT_SYS_GUID},
-  {"sleep", PT_SLEEP},
-  {"to_datetime_tz", PT_TO_DATETIME_TZ},
-  {"to_timestamp_tz", PT_TO_TIMESTAMP_TZ},
-  {"utc_timestamp", PT_UTC_TIMESTAMP},
-  {"crc32", PT_CRC32},
-  {"schema_def", PT_SCHEMA_DEF}
-};
-
-
-static int parser_groupby_exception = 0;
-
-
-
 
-/* xxxnum_check: 0 not allowed, no compatibility check
-		 1 allowed, compatibility check (search_condition)
-		 2 allowed, no compatibility check (select_list) */
-static int parser_instnum_check = 0;
-static int parser_groupbynum_check = 0;
-static int parser_orderbynum_check = 0;
-static int parser_within_join_condition = 0;
 
-/* xxx_check: 0 not allowed
-              1 allowed */
-static int parser_sysconnectbypath_check = 0;
-static int parser_prior_check = 0;
-static int parser_connectbyroot_check = 0;
-static int parser_serial_check = 1;
-static int parser_pseudocolumn_check = 1;
-static int parser_subquery_check = 1;
-static int parser_hostvar_check = 1;
-
-/* check Oracle style outer-join operator: '(+)' */
-static bool parser_found_Oracle_outer = false;
-
-/* check sys_date, sys_time, sys_timestamp, sys_datetime local_transaction_id */
-static bool parser_si_datetime = false;
-static bool parser_si_tran_id = false;
-
-/* check the condition that the statment is not able to be prepared */
-static bool parser_cannot_prepare = false;
-
-/* check the condition that the result of a query is not able to be cached */
-static bool parser_cannot_cache = false;
-
-/* check if INCR is used legally */
-static int parser_select_level = -1;
-
-/* handle inner increment exprs in select list */
-static PT_NODE *parser_hidden_incr_list = NULL;
-
-/* for opt_over_analytic_partition_by */
-static bool is_analytic_function = false;
-
-#define PT_EMPTY INT_MAX
-
-#if defined(WINDOWS)
-#define inline
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ABSOLUTE_ = 258,               /* ABSOLUTE_  */
+    ACTION = 259,                  /* ACTION  */
+    ADD = 260,                     /* ADD  */
+    ADD_MONTHS = 261,              /* ADD_MONTHS  */
+    AFTER = 262,                   /* AFTER  */
+    ALL = 263,                     /* ALL  */
+    ALLOCATE = 264,                /* ALLOCATE  */
+    ALTER = 265,                   /* ALTER  */
+    AND = 266,                     /* AND  */
+    ANY = 267,                     /* ANY  */
+    ARE = 268,                     /* ARE  */
+    AS = 269,                      /* AS  */
+    ASC = 270,                     /* ASC  */
+    ASSERTION = 271,               /* ASSERTION  */
+    ASYNC = 272,                   /* ASYNC  */
+    AT = 273,                      /* AT  */
+    ATTACH = 274,                  /* ATTACH  */
+    ATTRIBUTE = 275,               /* ATTRIBUTE  */
+    AVG = 276,                     /* AVG  */
+    BEFORE = 277,                  /* BEFORE  */
+    BEGIN_ = 278,                  /* BEGIN_  */
+    BETWEEN = 279,                 /* BETWEEN  */
+    BIGINT = 280,                  /* BIGINT  */
+    BINARY = 281,                  /* BINARY  */
+    BIT = 282,                     /* BIT  */
+    BIT_LENGTH = 283,              /* BIT_LENGTH  */
+    BITSHIFT_LEFT = 284,           /* BITSHIFT_LEFT  */
+    BITSHIFT_RIGHT = 285,          /* BITSHIFT_RIGHT  */
+    BLOB_ = 286,                   /* BLOB_  */
+    BOOLEAN_ = 287,                /* BOOLEAN_  */
+    BOTH_ = 288,                   /* BOTH_  */
+    BREADTH = 289,                 /* BREADTH  */
+    BY = 290,                      /* BY  */
+    CALL = 291,                    /* CALL  */
+    CASCADE = 292,                 /* CASCADE  */
+    CASCADED = 293,                /* CASCADED  */
+    CASE = 294,                    /* CASE  */
+    CAST = 295,                    /* CAST  */
+    CATALOG = 296,                 /* CATALOG  */
+    CHANGE = 297,                  /* CHANGE  */
+    CHAR_ = 298,                   /* CHAR_  */
+    CHECK = 299,                   /* CHECK  */
+    CLASS = 300,                   /* CLASS  */
+    CLASSES = 301,                 /* CLASSES  */
+    CLOB_ = 302,                   /* CLOB_  */
+    CLOSE = 303,                   /* CLOSE  */
+    COALESCE = 304,                /* COALESCE  */
+    COLLATE = 305,                 /* COLLATE  */
+    COLUMN = 306,                  /* COLUMN  */
+    COMMIT = 307,                  /* COMMIT  */
+    COMP_NULLSAFE_EQ = 308,        /* COMP_NULLSAFE_EQ  */
+    CONNECT = 309,                 /* CONNECT  */
+    CONNECT_BY_ISCYCLE = 310,      /* CONNECT_BY_ISCYCLE  */
+    CONNECT_BY_ISLEAF = 311,       /* CONNECT_BY_ISLEAF  */
+    CONNECT_BY_ROOT = 312,         /* CONNECT_BY_ROOT  */
+    CONNECTION = 313,              /* CONNECTION  */
+    CONSTRAINT = 314,              /* CONSTRAINT  */
+    CONSTRAINTS = 315,             /* CONSTRAINTS  */
+    CONTINUE = 316,                /* CONTINUE  */
+    CONVERT = 317,                 /* CONVERT  */
+    CORRESPONDING = 318,           /* CORRESPONDING  */
+    COUNT = 319,                   /* COUNT  */
+    CREATE = 320,                  /* CREATE  */
+    CROSS = 321,                   /* CROSS  */
+    CURRENT = 322,                 /* CURRENT  */
+    CURRENT_DATE = 323,            /* CURRENT_DATE  */
+    CURRENT_DATETIME = 324,        /* CURRENT_DATETIME  */
+    CURRENT_TIME = 325,            /* CURRENT_TIME  */
+    CURRENT_TIMESTAMP = 326,       /* CURRENT_TIMESTAMP  */
+    CURRENT_USER = 327,            /* CURRENT_USER  */
+    CURSOR = 328,                  /* CURSOR  */
+    CYCLE = 329,                   /* CYCLE  */
+    DATA = 330,                    /* DATA  */
+    DATABASE = 331,                /* DATABASE  */
+    DATA_TYPE_ = 332,              /* DATA_TYPE_  */
+    Date = 333,                    /* Date  */
+    DATETIME = 334,                /* DATETIME  */
+    DATETIMETZ = 335,              /* DATETIMETZ  */
+    DATETIMELTZ = 336,             /* DATETIMELTZ  */
+    DAY_ = 337,                    /* DAY_  */
+    DAY_MILLISECOND = 338,         /* DAY_MILLISECOND  */
+    DAY_SECOND = 339,              /* DAY_SECOND  */
+    DAY_MINUTE = 340,              /* DAY_MINUTE  */
+    DAY_HOUR = 341,                /* DAY_HOUR  */
+    DB_TIMEZONE = 342,             /* DB_TIMEZONE  */
+    DEALLOCATE = 343,              /* DEALLOCATE  */
+    DECLARE = 344,                 /* DECLARE  */
+    DEFAULT = 345,                 /* DEFAULT  */
+    DEFERRABLE = 346,              /* DEFERRABLE  */
+    DEFERRED = 347,                /* DEFERRED  */
+    DELETE_ = 348,                 /* DELETE_  */
+    DEPTH = 349,                   /* DEPTH  */
+    DESC = 350,                    /* DESC  */
+    DESCRIBE = 351,                /* DESCRIBE  */
+    DESCRIPTOR = 352,              /* DESCRIPTOR  */
+    DIAGNOSTICS = 353,             /* DIAGNOSTICS  */
+    DIFFERENCE_ = 354,             /* DIFFERENCE_  */
+    DISCONNECT = 355,              /* DISCONNECT  */
+    DISTINCT = 356,                /* DISTINCT  */
+    DIV = 357,                     /* DIV  */
+    DO = 358,                      /* DO  */
+    Domain = 359,                  /* Domain  */
+    Double = 360,                  /* Double  */
+    DROP = 361,                    /* DROP  */
+    DUPLICATE_ = 362,              /* DUPLICATE_  */
+    EACH = 363,                    /* EACH  */
+    ELSE = 364,                    /* ELSE  */
+    ELSEIF = 365,                  /* ELSEIF  */
+    END = 366,                     /* END  */
+    ENUM = 367,                    /* ENUM  */
+    EQUALS = 368,                  /* EQUALS  */
+    ESCAPE = 369,                  /* ESCAPE  */
+    EVALUATE = 370,                /* EVALUATE  */
+    EXCEPT = 371,                  /* EXCEPT  */
+    EXCEPTION = 372,               /* EXCEPTION  */
+    EXEC = 373,                    /* EXEC  */
+    EXECUTE = 374,                 /* EXECUTE  */
+    EXISTS = 375,                  /* EXISTS  */
+    EXTERNAL = 376,                /* EXTERNAL  */
+    EXTRACT = 377,                 /* EXTRACT  */
+    False = 378,                   /* False  */
+    FETCH = 379,                   /* FETCH  */
+    File = 380,                    /* File  */
+    FIRST = 381,                   /* FIRST  */
+    FLOAT_ = 382,                  /* FLOAT_  */
+    For = 383,                     /* For  */
+    FORCE = 384,                   /* FORCE  */
+    FOREIGN = 385,                 /* FOREIGN  */
+    FOUND = 386,                   /* FOUND  */
+    FROM = 387,                    /* FROM  */
+    FULL = 388,                    /* FULL  */
+    FUNCTION = 389,                /* FUNCTION  */
+    GENERAL = 390,                 /* GENERAL  */
+    GET = 391,                     /* GET  */
+    GLOBAL = 392,                  /* GLOBAL  */
+    GO = 393,                      /* GO  */
+    GOTO = 394,                    /* GOTO  */
+    GRANT = 395,                   /* GRANT  */
+    GROUP_ = 396,                  /* GROUP_  */
+    HAVING = 397,                  /* HAVING  */
+    HOUR_ = 398,                   /* HOUR_  */
+    HOUR_MILLISECOND = 399,        /* HOUR_MILLISECOND  */
+    HOUR_SECOND = 400,             /* HOUR_SECOND  */
+    HOUR_MINUTE = 401,             /* HOUR_MINUTE  */
+    IDENTITY = 402,                /* IDENTITY  */
+    IF = 403,                      /* IF  */
+    IGNORE_ = 404,                 /* IGNORE_  */
+    IMMEDIATE = 405,               /* IMMEDIATE  */
+    IN_ = 406,                     /* IN_  */
+    INDEX = 407,                   /* INDEX  */
+    INDICATOR = 408,               /* INDICATOR  */
+    INHERIT = 409,                 /* INHERIT  */
+    INITIALLY = 410,               /* INITIALLY  */
+    INNER = 411,                   /* INNER  */
+    INOUT = 412,                   /* INOUT  */
+    INPUT_ = 413,                  /* INPUT_  */
+    INSERT = 414,                  /* INSERT  */
+    INTEGER = 415,                 /* INTEGER  */
+    INTERNAL = 416,                /* INTERNAL  */
+    INTERSECT = 417,               /* INTERSECT  */
+    INTERSECTION = 418,            /* INTERSECTION  */
+    INTERVAL = 419,                /* INTERVAL  */
+    INTO = 420,                    /* INTO  */
+    IS = 421,                      /* IS  */
+    ISOLATION = 422,               /* ISOLATION  */
+    JOIN = 423,                    /* JOIN  */
+    KEY = 424,                     /* KEY  */
+    KEYLIMIT = 425,                /* KEYLIMIT  */
+    LANGUAGE = 426,                /* LANGUAGE  */
+    LAST = 427,                    /* LAST  */
+    LEADING_ = 428,                /* LEADING_  */
+    LEAVE = 429,                   /* LEAVE  */
+    LEFT = 430,                    /* LEFT  */
+    LESS = 431,                    /* LESS  */
+    LEVEL = 432,                   /* LEVEL  */
+    LIKE = 433,                    /* LIKE  */
+    LIMIT = 434,                   /* LIMIT  */
+    LIST = 435,                    /* LIST  */
+    LOCAL = 436,                   /* LOCAL  */
+    LOCAL_TRANSACTION_ID = 437,    /* LOCAL_TRANSACTION_ID  */
+    LOCALTIME = 438,               /* LOCALTIME  */
+    LOCALTIMESTAMP = 439,          /* LOCALTIMESTAMP  */
+    LOOP = 440,                    /* LOOP  */
+    LOWER = 441,                   /* LOWER  */
+    MATCH = 442,                   /* MATCH  */
+    MATCHED = 443,                 /* MATCHED  */
+    Max = 444,                     /* Max  */
+    MERGE = 445,                   /* MERGE  */
+    METHOD = 446,                  /* METHOD  */
+    MILLISECOND_ = 447,            /* MILLISECOND_  */
+    Min = 448,                     /* Min  */
+    MINUTE_ = 449,                 /* MINUTE_  */
+    MINUTE_MILLISECOND = 450,      /* MINUTE_MILLISECOND  */
+    MINUTE_SECOND = 451,           /* MINUTE_SECOND  */
+    MOD = 452,                     /* MOD  */
+    MODIFY = 453,                  /* MODIFY  */
+    MODULE = 454,                  /* MODULE  */
+    Monetary = 455,                /* Monetary  */
+    MONTH_ = 456,                  /* MONTH_  */
+    MULTISET = 457,                /* MULTISET  */
+    MULTISET_OF = 458,             /* MULTISET_OF  */
+    NA = 459,                      /* NA  */
+    NAMES = 460,                   /* NAMES  */
+    NATIONAL = 461,                /* NATIONAL  */
+    NATURAL = 462,                 /* NATURAL  */
+    NCHAR = 463,                   /* NCHAR  */
+    NEXT = 464,                    /* NEXT  */
+    NO = 465,                      /* NO  */
+    NOT = 466,                     /* NOT  */
+    Null = 467,                    /* Null  */
+    NULLIF = 468,                  /* NULLIF  */
+    NUMERIC = 469,                 /* NUMERIC  */
+    OBJECT = 470,                  /* OBJECT  */
+    OCTET_LENGTH = 471,            /* OCTET_LENGTH  */
+    OF = 472,                      /* OF  */
+    OFF_ = 473,                    /* OFF_  */
+    ON_ = 474,                     /* ON_  */
+    ONLY = 475,                    /* ONLY  */
+    OPEN = 476,                    /* OPEN  */
+    OPTIMIZATION = 477,            /* OPTIMIZATION  */
+    OPTION = 478,                  /* OPTION  */
+    OR = 479,                      /* OR  */
+    ORDER = 480,                   /* ORDER  */
+    OUT_ = 481,                    /* OUT_  */
+    OUTER = 482,                   /* OUTER  */
+    OUTPUT = 483,                  /* OUTPUT  */
+    OVER = 484,                    /* OVER  */
+    OVERLAPS = 485,                /* OVERLAPS  */
+    PARAMETERS = 486,              /* PARAMETERS  */
+    PARTIAL = 487,                 /* PARTIAL  */
+    PARTITION = 488,               /* PARTITION  */
+    POSITION = 489,                /* POSITION  */
+    PRECISION = 490,               /* PRECISION  */
+    PREPARE = 491,                 /* PREPARE  */
+    PRESERVE = 492,                /* PRESERVE  */
+    PRIMARY = 493,                 /* PRIMARY  */
+    PRIOR = 494,                   /* PRIOR  */
+    PRIVILEGES = 495,              /* PRIVILEGES  */
+    PROCEDURE = 496,               /* PROCEDURE  */
+    PROMOTE = 497,                 /* PROMOTE  */
+    QUERY = 498,                   /* QUERY  */
+    READ = 499,                    /* READ  */
+    REBUILD = 500,                 /* REBUILD  */
+    RECURSIVE = 501,               /* RECURSIVE  */
+    REF = 502,                     /* REF  */
+    REFERENCES = 503,              /* REFERENCES  */
+    REFERENCING = 504,             /* REFERENCING  */
+    REGEXP = 505,                  /* REGEXP  */
+    RELATIVE_ = 506,               /* RELATIVE_  */
+    RENAME = 507,                  /* RENAME  */
+    REPLACE = 508,                 /* REPLACE  */
+    RESIGNAL = 509,                /* RESIGNAL  */
+    RESTRICT = 510,                /* RESTRICT  */
+    RETURN = 511,                  /* RETURN  */
+    RETURNS = 512,                 /* RETURNS  */
+    REVOKE = 513,                  /* REVOKE  */
+    RIGHT = 514,                   /* RIGHT  */
+    RLIKE = 515,                   /* RLIKE  */
+    ROLE = 516,                    /* ROLE  */
+    ROLLBACK = 517,                /* ROLLBACK  */
+    ROLLUP = 518,                  /* ROLLUP  */
+    ROUTINE = 519,                 /* ROUTINE  */
+    ROW = 520,                     /* ROW  */
+    ROWNUM = 521,                  /* ROWNUM  */
+    ROWS = 522,                    /* ROWS  */
+    SAVEPOINT = 523,               /* SAVEPOINT  */
+    SCHEMA = 524,                  /* SCHEMA  */
+    SCOPE = 525,                   /* SCOPE  */
+    SCROLL = 526,                  /* SCROLL  */
+    SEARCH = 527,                  /* SEARCH  */
+    SECOND_ = 528,                 /* SECOND_  */
+    SECOND_MILLISECOND = 529,      /* SECOND_MILLISECOND  */
+    SECTION = 530,                 /* SECTION  */
+    SELECT = 531,                  /* SELECT  */
+    SENSITIVE = 532,               /* SENSITIVE  */
+    SEQUENCE = 533,                /* SEQUENCE  */
+    SEQUENCE_OF = 534,             /* SEQUENCE_OF  */
+    SERIALIZABLE = 535,            /* SERIALIZABLE  */
+    SESSION = 536,                 /* SESSION  */
+    SESSION_TIMEZONE = 537,        /* SESSION_TIMEZONE  */
+    SESSION_USER = 538,            /* SESSION_USER  */
+    SET = 539,                     /* SET  */
+    SET_OF = 540,                  /* SET_OF  */
+    SETEQ = 541,                   /* SETEQ  */
+    SETNEQ = 542,                  /* SETNEQ  */
+    SHARED = 543,                  /* SHARED  */
+    SIBLINGS = 544,                /* SIBLINGS  */
+    SIGNAL = 545,                  /* SIGNAL  */
+    SIMILAR = 546,                 /* SIMILAR  */
+    SIZE_ = 547,                   /* SIZE_  */
+    SmallInt = 548,                /* SmallInt  */
+    SOME = 549,                    /* SOME  */
+    SQL = 550,                     /* SQL  */
+    SQLCODE = 551,                 /* SQLCODE  */
+    SQLERROR = 552,                /* SQLERROR  */
+    SQLEXCEPTION = 553,            /* SQLEXCEPTION  */
+    SQLSTATE = 554,                /* SQLSTATE  */
+    SQLWARNING = 555,              /* SQLWARNING  */
+    STATISTICS = 556,              /* STATISTICS  */
+    String = 557,                  /* String  */
+    SUBCLASS = 558,                /* SUBCLASS  */
+    SUBSET = 559,                  /* SUBSET  */
+    SUBSETEQ = 560,                /* SUBSETEQ  */
+    SUBSTRING_ = 561,              /* SUBSTRING_  */
+    SUM = 562,                     /* SUM  */
+    SUPERCLASS = 563,              /* SUPERCLASS  */
+    SUPERSET = 564,                /* SUPERSET  */
+    SUPERSETEQ = 565,              /* SUPERSETEQ  */
+    SYS_CONNECT_BY_PATH = 566,     /* SYS_CONNECT_BY_PATH  */
+    SYS_DATE = 567,                /* SYS_DATE  */
+    SYS_DATETIME = 568,            /* SYS_DATETIME  */
+    SYS_TIME_ = 569,               /* SYS_TIME_  */
+    SYS_TIMESTAMP = 570,           /* SYS_TIMESTAMP  */
+    SYSTEM_USER = 571,             /* SYSTEM_USER  */
+    TABLE = 572,                   /* TABLE  */
+    TEMPORARY = 573,               /* TEMPORARY  */
+    THEN = 574,                    /* THEN  */
+    Time = 575,                    /* Time  */
+    TIMESTAMP = 576,               /* TIMESTAMP  */
+    TIMESTAMPTZ = 577,             /* TIMESTAMPTZ  */
+    TIMESTAMPLTZ = 578,            /* TIMESTAMPLTZ  */
+    TIMEZONE = 579,                /* TIMEZONE  */
+    TIMEZONE_HOUR = 580,           /* TIMEZONE_HOUR  */
+    TIMEZONE_MINUTE = 581,         /* TIMEZONE_MINUTE  */
+    TO = 582,                      /* TO  */
+    TRAILING_ = 583,               /* TRAILING_  */
+    TRANSACTION = 584,             /* TRANSACTION  */
+    TRANSLATE = 585,               /* TRANSLATE  */
+    TRANSLATION = 586,             /* TRANSLATION  */
+    TRIGGER = 587,                 /* TRIGGER  */
+    TRIM = 588,                    /* TRIM  */
+    True = 589,                    /* True  */
+    TRUNCATE = 590,                /* TRUNCATE  */
+    UNDER = 591,                   /* UNDER  */
+    Union = 592,                   /* Union  */
+    UNIQUE = 593,                  /* UNIQUE  */
+    UNKNOWN = 594,                 /* UNKNOWN  */
+    UNTERMINATED_STRING = 595,     /* UNTERMINATED_STRING  */
+    UNTERMINATED_IDENTIFIER = 596, /* UNTERMINATED_IDENTIFIER  */
+    UPDATE = 597,                  /* UPDATE  */
+    UPPER = 598,                   /* UPPER  */
+    USAGE = 599,                   /* USAGE  */
+    USE = 600,                     /* USE  */
+    USER = 601,                    /* USER  */
+    USING = 602,                   /* USING  */
+    Utime = 603,                   /* Utime  */
+    VACUUM = 604,                  /* VACUUM  */
+    VALUE = 605,                   /* VALUE  */
+    VALUES = 606,                  /* VALUES  */
+    VAR_ASSIGN = 607,              /* VAR_ASSIGN  */
+    VARCHAR = 608,                 /* VARCHAR  */
+    VARIABLE_ = 609,               /* VARIABLE_  */
+    VARYING = 610,                 /* VARYING  */
+    VCLASS = 611,                  /* VCLASS  */
+    VIEW = 612,                    /* VIEW  */
+    WHEN = 613,                    /* WHEN  */
+    WHENEVER = 614,                /* WHENEVER  */
+    WHERE = 615,                   /* WHERE  */
+    WHILE = 616,                   /* WHILE  */
+    WITH = 617,                    /* WITH  */
+    WITHOUT = 618,                 /* WITHOUT  */
+    WORK = 619,                    /* WORK  */
+    WRITE = 620,                   /* WRITE  */
+    XOR = 621,                     /* XOR  */
+    YEAR_ = 622,                   /* YEAR_  */
+    YEAR_MONTH = 623,              /* YEAR_MONTH  */
+    ZONE = 624,                    /* ZONE  */
+    YEN_SIGN = 625,                /* YEN_SIGN  */
+    DOLLAR_SIGN = 626,             /* DOLLAR_SIGN  */
+    WON_SIGN = 627,                /* WON_SIGN  */
+    TURKISH_LIRA_SIGN = 628,       /* TURKISH_LIRA_SIGN  */
+    BRITISH_POUND_SIGN = 629,      /* BRITISH_POUND_SIGN  */
+    CAMBODIAN_RIEL_SIGN = 630,     /* CAMBODIAN_RIEL_SIGN  */
+    CHINESE_RENMINBI_SIGN = 631,   /* CHINESE_RENMINBI_SIGN  */
+    INDIAN_RUPEE_SIGN = 632,       /* INDIAN_RUPEE_SIGN  */
+    RUSSIAN_RUBLE_SIGN = 633,      /* RUSSIAN_RUBLE_SIGN  */
+    AUSTRALIAN_DOLLAR_SIGN = 634,  /* AUSTRALIAN_DOLLAR_SIGN  */
+    CANADIAN_DOLLAR_SIGN = 635,    /* CANADIAN_DOLLAR_SIGN  */
+    BRASILIAN_REAL_SIGN = 636,     /* BRASILIAN_REAL_SIGN  */
+    ROMANIAN_LEU_SIGN = 637,       /* ROMANIAN_LEU_SIGN  */
+    EURO_SIGN = 638,               /* EURO_SIGN  */
+    SWISS_FRANC_SIGN = 639,        /* SWISS_FRANC_SIGN  */
+    DANISH_KRONE_SIGN = 640,       /* DANISH_KRONE_SIGN  */
+    NORWEGIAN_KRONE_SIGN = 641,    /* NORWEGIAN_KRONE_SIGN  */
+    BULGARIAN_LEV_SIGN = 642,      /* BULGARIAN_LEV_SIGN  */
+    VIETNAMESE_DONG_SIGN = 643,    /* VIETNAMESE_DONG_SIGN  */
+    CZECH_KORUNA_SIGN = 644,       /* CZECH_KORUNA_SIGN  */
+    POLISH_ZLOTY_SIGN = 645,       /* POLISH_ZLOTY_SIGN  */
+    SWEDISH_KRONA_SIGN = 646,      /* SWEDISH_KRONA_SIGN  */
+    CROATIAN_KUNA_SIGN = 647,      /* CROATIAN_KUNA_SIGN  */
+    SERBIAN_DINAR_SIGN = 648,      /* SERBIAN_DINAR_SIGN  */
+    DOT = 649,                     /* DOT  */
+    RIGHT_ARROW = 650,             /* RIGHT_ARROW  */
+    STRCAT = 651,                  /* STRCAT  */
+    COMP_NOT_EQ = 652,             /* COMP_NOT_EQ  */
+    COMP_GE = 653,                 /* COMP_GE  */
+    COMP_LE = 654,                 /* COMP_LE  */
+    PARAM_HEADER = 655,            /* PARAM_HEADER  */
+    ACCESS = 656,                  /* ACCESS  */
+    ACTIVE = 657,                  /* ACTIVE  */
+    ADDDATE = 658,                 /* ADDDATE  */
+    ANALYZE = 659,                 /* ANALYZE  */
+    ARCHIVE = 660,                 /* ARCHIVE  */
+    AUTO_INCREMENT = 661,          /* AUTO_INCREMENT  */
+    BIT_AND = 662,                 /* BIT_AND  */
+    BIT_OR = 663,                  /* BIT_OR  */
+    BIT_XOR = 664,                 /* BIT_XOR  */
+    CACHE = 665,                   /* CACHE  */
+    CAPACITY = 666,                /* CAPACITY  */
+    CHARACTER_SET_ = 667,          /* CHARACTER_SET_  */
+    CHARSET = 668,                 /* CHARSET  */
+    CHR = 669,                     /* CHR  */
+    CLOB_TO_CHAR = 670,            /* CLOB_TO_CHAR  */
+    COLLATION = 671,               /* COLLATION  */
+    COLUMNS = 672,                 /* COLUMNS  */
+    COMMENT = 673,                 /* COMMENT  */
+    COMMITTED = 674,               /* COMMITTED  */
+    COST = 675,                    /* COST  */
+    CRITICAL = 676,                /* CRITICAL  */
+    CUME_DIST = 677,               /* CUME_DIST  */
+    DATE_ADD = 678,                /* DATE_ADD  */
+    DATE_SUB = 679,                /* DATE_SUB  */
+    DECREMENT = 680,               /* DECREMENT  */
+    DENSE_RANK = 681,              /* DENSE_RANK  */
+    ELT = 682,                     /* ELT  */
+    EXPLAIN = 683,                 /* EXPLAIN  */
+    FIRST_VALUE = 684,             /* FIRST_VALUE  */
+    FULLSCAN = 685,                /* FULLSCAN  */
+    GE_INF_ = 686,                 /* GE_INF_  */
+    GE_LE_ = 687,                  /* GE_LE_  */
+    GE_LT_ = 688,                  /* GE_LT_  */
+    GRANTS = 689,                  /* GRANTS  */
+    GROUP_CONCAT = 690,            /* GROUP_CONCAT  */
+    GROUPS = 691,                  /* GROUPS  */
+    GT_INF_ = 692,                 /* GT_INF_  */
+    GT_LE_ = 693,                  /* GT_LE_  */
+    GT_LT_ = 694,                  /* GT_LT_  */
+    HASH = 695,                    /* HASH  */
+    HEADER = 696,                  /* HEADER  */
+    HEAP = 697,                    /* HEAP  */
+    IFNULL = 698,                  /* IFNULL  */
+    INACTIVE = 699,                /* INACTIVE  */
+    INCREMENT = 700,               /* INCREMENT  */
+    INDEXES = 701,                 /* INDEXES  */
+    INDEX_PREFIX = 702,            /* INDEX_PREFIX  */
+    INF_LE_ = 703,                 /* INF_LE_  */
+    INF_LT_ = 704,                 /* INF_LT_  */
+    INFINITE_ = 705,               /* INFINITE_  */
+    INSTANCES = 706,               /* INSTANCES  */
+    INVALIDATE = 707,              /* INVALIDATE  */
+    ISNULL = 708,                  /* ISNULL  */
+    KEYS = 709,                    /* KEYS  */
+    KILL = 710,                    /* KILL  */
+    JAVA = 711,                    /* JAVA  */
+    JOB = 712,                     /* JOB  */
+    JSON = 713,                    /* JSON  */
+    LAG = 714,                     /* LAG  */
+    LAST_VALUE = 715,              /* LAST_VALUE  */
+    LCASE = 716,                   /* LCASE  */
+    LEAD = 717,                    /* LEAD  */
+    LOCK_ = 718,                   /* LOCK_  */
+    LOG = 719,                     /* LOG  */
+    MAXIMUM = 720,                 /* MAXIMUM  */
+    MAXVALUE = 721,                /* MAXVALUE  */
+    MEDIAN = 722,                  /* MEDIAN  */
+    MEMBERS = 723,                 /* MEMBERS  */
+    MINVALUE = 724,                /* MINVALUE  */
+    NAME = 725,                    /* NAME  */
+    NOCYCLE = 726,                 /* NOCYCLE  */
+    NOCACHE = 727,                 /* NOCACHE  */
+    NOMAXVALUE = 728,              /* NOMAXVALUE  */
+    NOMINVALUE = 729,              /* NOMINVALUE  */
+    NONE = 730,                    /* NONE  */
+    NTH_VALUE = 731,               /* NTH_VALUE  */
+    NTILE = 732,                   /* NTILE  */
+    NULLS = 733,                   /* NULLS  */
+    OFFSET = 734,                  /* OFFSET  */
+    OWNER = 735,                   /* OWNER  */
+    PAGE = 736,                    /* PAGE  */
+    PARTITIONING = 737,            /* PARTITIONING  */
+    PARTITIONS = 738,              /* PARTITIONS  */
+    PASSWORD = 739,                /* PASSWORD  */
+    PERCENT_RANK = 740,            /* PERCENT_RANK  */
+    PERCENTILE_CONT = 741,         /* PERCENTILE_CONT  */
+    PERCENTILE_DISC = 742,         /* PERCENTILE_DISC  */
+    PRINT = 743,                   /* PRINT  */
+    PRIORITY = 744,                /* PRIORITY  */
+    QUARTER = 745,                 /* QUARTER  */
+    QUEUES = 746,                  /* QUEUES  */
+    RANGE_ = 747,                  /* RANGE_  */
+    RANK = 748,                    /* RANK  */
+    REJECT_ = 749,                 /* REJECT_  */
+    REMOVE = 750,                  /* REMOVE  */
+    REORGANIZE = 751,              /* REORGANIZE  */
+    REPEATABLE = 752,              /* REPEATABLE  */
+    RESPECT = 753,                 /* RESPECT  */
+    RETAIN = 754,                  /* RETAIN  */
+    REUSE_OID = 755,               /* REUSE_OID  */
+    REVERSE = 756,                 /* REVERSE  */
+    ROW_NUMBER = 757,              /* ROW_NUMBER  */
+    SECTIONS = 758,                /* SECTIONS  */
+    SEPARATOR = 759,               /* SEPARATOR  */
+    SERIAL = 760,                  /* SERIAL  */
+    SHOW = 761,                    /* SHOW  */
+    SLEEP = 762,                   /* SLEEP  */
+    SLOTS = 763,                   /* SLOTS  */
+    SLOTTED = 764,                 /* SLOTTED  */
+    STABILITY = 765,               /* STABILITY  */
+    START_ = 766,                  /* START_  */
+    STATEMENT = 767,               /* STATEMENT  */
+    STATUS = 768,                  /* STATUS  */
+    STDDEV = 769,                  /* STDDEV  */
+    STDDEV_POP = 770,              /* STDDEV_POP  */
+    STDDEV_SAMP = 771,             /* STDDEV_SAMP  */
+    STR_TO_DATE = 772,             /* STR_TO_DATE  */
+    SUBDATE = 773,                 /* SUBDATE  */
+    SYSTEM = 774,                  /* SYSTEM  */
+    TABLES = 775,                  /* TABLES  */
+    TEXT = 776,                    /* TEXT  */
+    THAN = 777,                    /* THAN  */
+    THREADS = 778,                 /* THREADS  */
+    TIMEOUT = 779,                 /* TIMEOUT  */
+    TRACE = 780,                   /* TRACE  */
+    TRAN = 781,                    /* TRAN  */
+    TRIGGERS = 782,                /* TRIGGERS  */
+    UCASE = 783,                   /* UCASE  */
+    UNCOMMITTED = 784,             /* UNCOMMITTED  */
+    VAR_POP = 785,                 /* VAR_POP  */
+    VAR_SAMP = 786,                /* VAR_SAMP  */
+    VARIANCE = 787,                /* VARIANCE  */
+    VOLUME = 788,                  /* VOLUME  */
+    WEEK = 789,                    /* WEEK  */
+    WITHIN = 790,                  /* WITHIN  */
+    WORKSPACE = 791,               /* WORKSPACE  */
+    TIMEZONES = 792,               /* TIMEZONES  */
+    IdName = 793,                  /* IdName  */
+    BracketDelimitedIdName = 794,  /* BracketDelimitedIdName  */
+    BacktickDelimitedIdName = 795, /* BacktickDelimitedIdName  */
+    DelimitedIdName = 796,         /* DelimitedIdName  */
+    UNSIGNED_INTEGER = 797,        /* UNSIGNED_INTEGER  */
+    UNSIGNED_REAL = 798,           /* UNSIGNED_REAL  */
+    CHAR_STRING = 799,             /* CHAR_STRING  */
+    NCHAR_STRING = 800,            /* NCHAR_STRING  */
+    BIT_STRING = 801,              /* BIT_STRING  */
+    HEX_STRING = 802,              /* HEX_STRING  */
+    CPP_STYLE_HINT = 803,          /* CPP_STYLE_HINT  */
+    C_STYLE_HINT = 804,            /* C_STYLE_HINT  */
+    SQL_STYLE_HINT = 805,          /* SQL_STYLE_HINT  */
+    BINARY_STRING = 806,           /* BINARY_STRING  */
+    EUCKR_STRING = 807,            /* EUCKR_STRING  */
+    ISO_STRING = 808,              /* ISO_STRING  */
+    UTF8_STRING = 809              /* UTF8_STRING  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
-
-#define TO_NUMBER(a)			((UINTPTR)(a))
-#define FROM_NUMBER(a)			((PT_NODE*)(UINTPTR)(a))
-
-
-#define SET_CONTAINER_2(a, i, j)		a.c1 = i, a.c2 = j
-#define SET_CONTAINER_3(a, i, j, k)		a.c1 = i, a.c2 = j, a.c3 = k
-#define SET_CONTAINER_4(a, i, j, k, l)		a.c1 = i, a.c2 = j, a.c3 = k, a.c4 = l
-
-#define CONTAINER_AT_0(a)			(a).c1
-#define CONTAINER_AT_1(a)			(a).c2
-#define CONTAINER_AT_2(a)			(a).c3
-#define CONTAINER_AT_3(a)			(a).c4
-#define CONTAINER_AT_4(a)			(a).c5
-#define CONTAINER_AT_5(a)			(a).c6
-#define CONTAINER_AT_6(a)			(a).c7
-#define CONTAINER_AT_7(a)			(a).c8
-#define CONTAINER_AT_8(a)			(a).c9
-#define CONTAINER_AT_9(a)			(a).c10
-
-#define YEN_SIGN_TEXT           "(\0xa1\0xef)"
-#define DOLLAR_SIGN_TEXT        "$"
-#define WON_SIGN_TEXT           "\\"
-#define TURKISH_LIRA_TEXT       "TL"
-#define BRITISH_POUND_TEXT      "GBP"
-#define CAMBODIAN_RIEL_TEXT     "KHR"
-#define CHINESE_RENMINBI_TEXT   "CNY"
-#define INDIAN_RUPEE_TEXT       "INR"
-#define RUSSIAN_RUBLE_TEXT      "RUB"
-#define AUSTRALIAN_DOLLAR_TEXT  "AUD"
-#define CANADIAN_DOLLAR_TEXT    "CAD"
-#define BRASILIAN_REAL_TEXT     "BRL"
-#define ROMANIAN_LEU_TEXT       "RON"
-#define EURO_TEXT               "EUR"
-#define SWISS_FRANC_TEXT        "CHF"
-#define DANISH_KRONE_TEXT       "DKK"
-#define NORWEGIAN_KRONE_TEXT    "NOK"
-#define BULGARIAN_LEV_TEXT      "BGN"
-#define VIETNAMESE_DONG_TEXT    "VND"
-#define CZECH_KORUNA_TEXT       "CZK"
-#define POLISH_ZLOTY_TEXT       "PLN"
-#define SWEDISH_KRONA_TEXT      "SEK"
-#define CROATIAN_KUNA_TEXT      "HRK"
-#define SERBIAN_DINAR_TEXT      "RSD"
-
-#define PARSER_SAVE_ERR_CONTEXT(node, context) \
-  if ((node) && (node)->buffer_pos == -1) \
-    { \
-     (node)->buffer_pos = context; \
-    }
-
-typedef enum
-{
-  SERIAL_START,
-  SERIAL_INC,
-  SERIAL_MAX,
-  SERIAL_MIN,
-  SERIAL_CYCLE,
-  SERIAL_CACHE,
-} SERIAL_DEFINE;
-
-FUNCTION_MAP *keyword_offset (const char *name);
-
-static PT_NODE *parser_make_expr_with_func (PARSER_CONTEXT * parser,
-					    FUNC_TYPE func_code,
-					    PT_NODE * args_list);
-static PT_NODE *parser_make_link (PT_NODE * list, PT_NODE * node);
-static PT_NODE *parser_make_link_or (PT_NODE * list, PT_NODE * node);
-
-
-
-static void parser_save_and_set_cannot_cache (bool value);
-static void parser_restore_cannot_cache (void);
-
-static void parser_save_and_set_si_datetime (int value);
-static void parser_restore_si_datetime (void);
-
-static void parser_save_and_set_si_tran_id (int value);
-static void parser_restore_si_tran_id (void);
-
-static void parser_save_and_set_cannot_prepare (bool value);
-static void parser_restore_cannot_prepare (void);
-
-static void parser_save_and_set_wjc (int value);
-static void parser_restore_wjc (void);
-
-static void parser_save_and_set_ic (int value);
-static void parser_restore_ic (void);
-
-static void parser_save_and_set_gc (int value);
-static void parser_restore_gc (void);
-
-static void parser_save_and_set_oc (int value);
-static void parser_restore_oc (void);
-
-static void parser_save_and_set_sysc (int value);
-static void parser_restore_sysc (void);
-
-static void parser_save_and_set_prc (int value);
-static void parser_restore_prc (void);
-
-static void parser_save_and_set_cbrc (int value);
-static void parser_restore_cbrc (void);
-
-static void parser_save_and_set_serc (int value);
-static void parser_restore_serc (void);
-
-static void parser_save_and_set_pseudoc (int value);
-static void parser_restore_pseudoc (void);
-
-static void parser_save_and_set_sqc (int value);
-static void parser_restore_sqc (void);
-
-static void parser_save_and_set_hvar (int value);
-static void parser_restore_hvar (void);
-
-static void parser_save_found_Oracle_outer (void);
-static void parser_restore_found_Oracle_outer (void);
-
-static void parser_save_alter_node (PT_NODE * node);
-static PT_NODE *parser_get_alter_node (void);
-
-static void parser_save_attr_def_one (PT_NODE * node);
-static PT_NODE *parser_get_attr_def_one (void);
-
-static void parser_push_orderby_node (PT_NODE * node);
-static PT_NODE *parser_top_orderby_node (void);
-static PT_NODE *parser_pop_orderby_node (void);
-
-static void parser_push_select_stmt_node (PT_NODE * node);
-static PT_NODE *parser_top_select_stmt_node (void);
-static PT_NODE *parser_pop_select_stmt_node (void);
-static bool parser_is_select_stmt_node_empty (void);
-
-static void parser_push_hint_node (PT_NODE * node);
-static PT_NODE *parser_top_hint_node (void);
-static PT_NODE *parser_pop_hint_node (void);
-static bool parser_is_hint_node_empty (void);
-
-static void parser_push_join_type (int v);
-static int parser_top_join_type (void);
-static int parser_pop_join_type (void);
-
-static void parser_save_is_reverse (bool v);
-static bool parser_get_is_reverse (void);
-
-static void parser_initialize_parser_context (void);
-static PT_NODE *parser_make_date_lang (int arg_cnt, PT_NODE * arg3);
-static PT_NODE *parser_make_number_lang (const int argc);
-static void parser_remove_dummy_select (PT_NODE ** node);
-static int parser_count_list (PT_NODE * list);
-static int parser_count_prefix_columns (PT_NODE * list, int * arg_count);
-
-static void resolve_alias_in_expr_node (PT_NODE * node, PT_NODE * list);
-static void resolve_alias_in_name_node (PT_NODE ** node, PT_NODE * list);
-static char * pt_check_identifier (PARSER_CONTEXT *parser, PT_NODE *p,
-				   const char *str, const int str_size);
-static PT_NODE * pt_create_char_string_literal (PARSER_CONTEXT *parser,
-						const PT_TYPE_ENUM char_type,
-						const char *str,
-						const INTL_CODESET codeset);
-static PT_NODE * pt_create_date_value (PARSER_CONTEXT *parser,
-				       const PT_TYPE_ENUM type,
-				       const char *str);
-static void pt_value_set_charset_coll (PARSER_CONTEXT *parser,
-				       PT_NODE *node,
-				       const int codeset_id,
-				       const int collation_id, bool force);
-static void pt_value_set_collation_info (PARSER_CONTEXT *parser,
-					 PT_NODE *node,
-					 PT_NODE *coll_node);
-static void pt_value_set_monetary (PARSER_CONTEXT *parser, PT_NODE *node,
-                   const char *str, const char *txt, DB_CURRENCY type);
-static PT_MISC_TYPE parser_attr_type;
-
-static bool allow_attribute_ordering;
-
-int parse_one_statement (int state);
-static PT_NODE *pt_set_collation_modifier (PARSER_CONTEXT *parser,
-					   PT_NODE *node, PT_NODE *coll_node);
-
-
-#define push_msg(a) _push_msg(a, __LINE__)
-
-void _push_msg (int code, int line);
-void pop_msg (void);
-
-char *g_query_string;
-int g_query_string_len;
-int g_original_buffer_len;
-
-
-/*
- * The behavior of location propagation when a rule is matched must
- * take into account the context information. The left-side symbol in a rule
- * will have the same context information as the last symbol from its 
- * right side
- */
-#define YYLLOC_DEFAULT(Current, Rhs, N)				        \
-    do									\
-      if (YYID (N))							\
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	  (Current).buffer_pos   = YYRHSLOC (Rhs, N).buffer_pos;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	  (Current).buffer_pos   = YYRHSLOC (Rhs, 0).buffer_pos;	\
-	}								\
-    while (YYID (0))
-
-/* 
- * YY_LOCATION_PRINT -- Print the location on the stream.
- * This macro was not mandated originally: define only if we know
- * we won't break user code: when these are the locations we know.  
- */
-
-#define YY_LOCATION_PRINT(File, Loc)			\
-    fprintf (File, "%d.%d-%d.%d",			\
-	     (Loc).first_line, (Loc).first_column,	\
-	     (Loc).last_line,  (Loc).last_column)
-
-
-
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE 
-#line 597 "../../src/parser/csql_grammar.y"
+union YYSTYPE
 {
+
   int number;
   bool boolean;
   PT_NODE *node;
@@ -1171,31 +680,31 @@ typedef union YYSTYPE
   container_3 c3;
   container_4 c4;
   container_10 c10;
-}
-/* Line 2604 of glr.c.  */
-#line 1177 "../../src/parser/csql_grammar.h"
-	YYSTYPE;
-# define YYSTYPE_IS_DECLARED 1
+
+
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
 #endif
 
+/* Location type.  */
 #if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
 {
-
   int first_line;
   int first_column;
   int last_line;
   int last_column;
-
-} YYLTYPE;
+};
 # define YYLTYPE_IS_DECLARED 1
 # define YYLTYPE_IS_TRIVIAL 1
 #endif
 
 
 extern YYSTYPE csql_yylval;
-
 extern YYLTYPE csql_yylloc;
+int csql_yyparse (void);
 
-
+#endif /* !YY_CSQL_YY_CSQL_GRAMMAR_H_INCLUDED  */
@@ -548,6 +548,11 @@ int g_query_string_len;
 int g_original_buffer_len;
 
 
+/* YYID is not defined by the skeletons of bison 3 */
+#if !defined (YYID)
+#define YYID(n) (n)
+#endif
+
 /*
  * The behavior of location propagation when a rule is matched must
  * take into account the context information. The left-side symbol in a rule
@@ -631,7 +636,7 @@ int g_original_buffer_len;
 %type <number> of_leading_trailing_both
 %type <number> datetime_field
 %type <number> opt_paren_plus
-%type <number> opt_with_fullscan
+%type <number> opt_with_sampling
 %type <number> comp_op
 %type <number> opt_of_all_some_any
 %type <number> set_op
@@ -4066,7 +4071,7 @@ index_column_name_list
 	;
 
 update_statistics_stmt
-	: UPDATE STATISTICS ON_ only_class_name_list opt_with_fullscan
+	: UPDATE STATISTICS ON_ only_class_name_list opt_with_sampling
 		{{
 
 			PT_NODE *ups = parser_new_node (this_parser, PT_UPDATE_STATS);
@@ -4074,13 +4079,13 @@ update_statistics_stmt
 			  {
 			    ups->info.update_stats.class_list = $4;
 			    ups->info.update_stats.all_classes = 0;
-			    ups->info.update_stats.with_fullscan = $5;
+			    ups->info.update_stats.sampling_percent = $5;
 			  }
 			$$ = ups;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
 		DBG_PRINT}}
-	| UPDATE STATISTICS ON_ ALL CLASSES opt_with_fullscan
+	| UPDATE STATISTICS ON_ ALL CLASSES opt_with_sampling
 		{{
 
 			PT_NODE *ups = parser_new_node (this_parser, PT_UPDATE_STATS);
@@ -4088,13 +4093,13 @@ update_statistics_stmt
 			  {
 			    ups->info.update_stats.class_list = NULL;
 			    ups->info.update_stats.all_classes = 1;
-			    ups->info.update_stats.with_fullscan = $6;
+			    ups->info.update_stats.sampling_percent = $6;
 			  }
 			$$ = ups;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
 		DBG_PRINT}}
-	| UPDATE STATISTICS ON_ CATALOG CLASSES opt_with_fullscan
+	| UPDATE STATISTICS ON_ CATALOG CLASSES opt_with_sampling
 		{{
 
 			PT_NODE *ups = parser_new_node (this_parser, PT_UPDATE_STATS);
@@ -4102,7 +4107,7 @@ update_statistics_stmt
 			  {
 			    ups->info.update_stats.class_list = NULL;
 			    ups->info.update_stats.all_classes = -1;
-			    ups->info.update_stats.with_fullscan = $6;
+			    ups->info.update_stats.sampling_percent = $6;
 			  }
 			$$ = ups;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
@@ -4127,7 +4132,7 @@ only_class_name_list
 		DBG_PRINT}}
 	;
 
-opt_with_fullscan
+opt_with_sampling
         : /* empty */
                 {{
 
@@ -4137,7 +4142,28 @@ opt_with_fullscan
         | WITH FULLSCAN
                 {{
 
-                        $$ = 1;
+                        $$ = 100;
+
+                DBG_PRINT}}
+        | WITH IdName UNSIGNED_INTEGER IdName
+                {{
+
+                        /* SAMPLING and PERCENT are not keywords, so that they stay usable as names */
+                        int percent = atoi ($3);
+
+                        if (intl_identifier_casecmp ($2, "sampling") != 0
+                            || intl_identifier_casecmp ($4, "percent") != 0)
+                          {
+                            PT_ERRORf3 (this_parser, pt_top(this_parser),
+                                        "expected WITH SAMPLING n PERCENT, not WITH %s %s %s", $2, $3, $4);
+                          }
+                        else if (percent < 1 || percent > 100)
+                          {
+                            PT_ERRORf (this_parser, pt_top(this_parser),
+                                       "sampling percent must be between 1 and 100, not %s", $3);
+                          }
+
+                        $$ = percent;
 
                 DBG_PRINT}}
         ;
@@ -6805,6 +6831,19 @@ show_type
 		{{
 			$$ = SHOWSTMT_THREADS;
 		}}
+	| STATEMENT CACHE
+		{{
+			$$ = SHOWSTMT_STATEMENT_CACHE;
+		}}
+	| IdName STATISTICS
+		{{
+			/* CONTENTION is not a keyword, so that it stays usable as a name */
+			if (intl_identifier_casecmp ($1, "contention") != 0)
+			  {
+			    PT_ERRORf (this_parser, pt_top(this_parser), "unknown SHOW %s STATISTICS statement", $1);
+			  }
+			$$ = SHOWSTMT_CONTENTION_STATISTICS;
+		}}
 	;
 
 show_type_of_like
@@ -6847,6 +6886,19 @@ show_type_of_where
 		{{
 			$$ = SHOWSTMT_THREADS;
 		}}
+	| STATEMENT CACHE
+		{{
+			$$ = SHOWSTMT_STATEMENT_CACHE;
+		}}
+	| IdName STATISTICS
+		{{
+			/* CONTENTION is not a keyword, so that it stays usable as a name */
+			if (intl_identifier_casecmp ($1, "contention") != 0)
+			  {
+			    PT_ERRORf (this_parser, pt_top(this_parser), "unknown SHOW %s STATISTICS statement", $1);
+			  }
+			$$ = SHOWSTMT_CONTENTION_STATISTICS;
+		}}
 	;
 
 show_type_arg1
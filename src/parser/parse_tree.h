@@ -2887,7 +2887,7 @@ struct pt_update_stats_info
 {
   PT_NODE *class_list;		/* PT_NAME */
   int all_classes;		/* 1 iff ALL CLASSES */
-  int with_fullscan;		/* 1 iff WITH FULLSCAN */
+  int sampling_percent;		/* 0: default sample, 1~99: WITH SAMPLING n PERCENT, 100: WITH FULLSCAN */
 };
 
 /* GET STATISTICS INFO */
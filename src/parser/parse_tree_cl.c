@@ -15619,6 +15619,7 @@ static PARSER_VARCHAR *
 pt_print_update_stats (PARSER_CONTEXT * parser, PT_NODE * p)
 {
   PARSER_VARCHAR *b = 0, *r1;
+  char s[64];
 
   b = pt_append_nulstring (parser, b, "update statistics on ");
   if (p->info.update_stats.all_classes > 0)
@@ -15635,11 +15636,15 @@ pt_print_update_stats (PARSER_CONTEXT * parser, PT_NODE * p)
       b = pt_append_varchar (parser, b, r1);
     }
 
-  if (p->info.update_stats.with_fullscan > 0)
+  if (p->info.update_stats.sampling_percent >= 100)
     {
-      assert (p->info.update_stats.with_fullscan == 1);
       b = pt_append_nulstring (parser, b, " with fullscan");
     }
+  else if (p->info.update_stats.sampling_percent > 0)
+    {
+      sprintf (s, " with sampling %d percent", p->info.update_stats.sampling_percent);
+      b = pt_append_nulstring (parser, b, s);
+    }
 
   return b;
 }
@@ -87,6 +87,8 @@ static SHOWSTMT_METADATA *metadata_of_timezones (void);
 static SHOWSTMT_METADATA *metadata_of_full_timezones (void);
 static SHOWSTMT_METADATA *metadata_of_tran_tables (void);
 static SHOWSTMT_METADATA *metadata_of_threads (void);
+static SHOWSTMT_METADATA *metadata_of_statement_cache (void);
+static SHOWSTMT_METADATA *metadata_of_contention_statistics (void);
 
 static SHOWSTMT_METADATA *
 metadata_of_volume_header (void)
@@ -117,7 +119,9 @@ metadata_of_volume_header (void)
     {"Full_name", "varchar(255)"},
     {"Next_volume_id", "int"},
     {"Next_vol_full_name", "varchar(255)"},
-    {"Remarks", "varchar(64)"}
+    {"Remarks", "varchar(64)"},
+    {"Num_free_extents", "int"},
+    {"Max_free_extent_size_in_pages", "int"}
   };
 
   static const SHOWSTMT_NAMED_ARG args[] = {
@@ -707,6 +711,61 @@ metadata_of_threads (void)
   return &md;
 }
 
+/* statement (XASL) cache */
+static SHOWSTMT_METADATA *
+metadata_of_statement_cache (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Sql_id", "varchar(13)"},
+    {"Sql_user_text", "string"},
+    {"Xasl_id", "varchar(64)"},
+    {"Num_classes", "int"},
+    {"Num_fixed_tran", "int"},
+    {"Hit_count", "int"},
+    {"Miss_count", "int"},
+    {"Recompile_count", "int"},
+    {"Referenced", "int"},
+    {"Dbval_cnt", "int"},
+    {"Create_time", "datetime"},
+    {"Last_used_time", "datetime"}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_STATEMENT_CACHE, "show statement cache",
+    cols, DIM (cols), NULL, 0, NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
+/* blocking waits on synchronization primitives, by wait point */
+static SHOWSTMT_METADATA *
+metadata_of_contention_statistics (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Wait_class", "varchar(16)"},
+    {"Name", "varchar(64)"},
+    {"Holder_site", "varchar(256)"},
+    {"Num_waits", "bigint"},
+    {"Num_waiting_threads", "int"},
+    {"Total_wait_msecs", "numeric(20,3)"},
+    {"Avg_wait_msecs", "numeric(20,3)"},
+    {"Max_wait_msecs", "numeric(20,3)"},
+    {"Wait_histogram", "string"},
+    {"Top_waiter_thread_index", "int"},
+    {"Top_waiter_wait_msecs", "numeric(20,3)"}
+  };
+
+  static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
+    {6, ORDER_DESC}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_CONTENTION_STATISTICS, "show contention statistics",
+    cols, DIM (cols), orderby, DIM (orderby), NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
 /*
  * showstmt_get_metadata() -  return show statement column infos
  *   return:-
@@ -947,6 +1006,8 @@ showstmt_metadata_init (void)
   show_Metas[SHOWSTMT_FULL_TIMEZONES] = metadata_of_full_timezones ();
   show_Metas[SHOWSTMT_TRAN_TABLES] = metadata_of_tran_tables ();
   show_Metas[SHOWSTMT_THREADS] = metadata_of_threads ();
+  show_Metas[SHOWSTMT_STATEMENT_CACHE] = metadata_of_statement_cache ();
+  show_Metas[SHOWSTMT_CONTENTION_STATISTICS] = metadata_of_contention_statistics ();
 
   for (i = 0; i < DIM (show_Metas); i++)
     {
@@ -3885,29 +3885,11 @@ do_update_stats (PARSER_CONTEXT * parser, PT_NODE * statement)
 
   if (statement->info.update_stats.all_classes > 0)
     {
-      if (statement->info.update_stats.with_fullscan)
-	{
-	  assert (statement->info.update_stats.with_fullscan == 1);
-	  error = sm_update_all_statistics (STATS_WITH_FULLSCAN);
-	}
-      else
-	{
-	  assert (statement->info.update_stats.with_fullscan == 0);
-	  error = sm_update_all_statistics (STATS_WITH_SAMPLING);
-	}
+      error = sm_update_all_statistics (statement->info.update_stats.sampling_percent);
     }
   else if (statement->info.update_stats.all_classes < 0)
     {
-      if (statement->info.update_stats.with_fullscan)
-	{
-	  assert (statement->info.update_stats.with_fullscan == 1);
-	  error = sm_update_all_catalog_statistics (STATS_WITH_FULLSCAN);
-	}
-      else
-	{
-	  assert (statement->info.update_stats.with_fullscan == 0);
-	  error = sm_update_all_catalog_statistics (STATS_WITH_SAMPLING);
-	}
+      error = sm_update_all_catalog_statistics (statement->info.update_stats.sampling_percent);
     }
   else
     {
@@ -3925,16 +3907,7 @@ do_update_stats (PARSER_CONTEXT * parser, PT_NODE * statement)
 	      return er_errid ();
 	    }
 
-	  if (statement->info.update_stats.with_fullscan)
-	    {
-	      assert (statement->info.update_stats.with_fullscan == 1);
-	      error = sm_update_statistics (obj, STATS_WITH_FULLSCAN);
-	    }
-	  else
-	    {
-	      assert (statement->info.update_stats.with_fullscan == 0);
-	      error = sm_update_statistics (obj, STATS_WITH_SAMPLING);
-	    }
+	  error = sm_update_statistics (obj, statement->info.update_stats.sampling_percent);
 	}			/* for (cls = ...) */
     }
 
@@ -112,6 +112,7 @@ struct qfile_list_cache
   unsigned int hit_counter;	/* counter of cache hit */
   unsigned int miss_counter;	/* counter of cache miss */
   unsigned int full_counter;	/* counter of cache full & replacement */
+  unsigned int reject_counter;	/* counter of results not admitted to the cache */
 };
 
 typedef struct qfile_list_cache_candidate QFILE_LIST_CACHE_CANDIDATE;
@@ -167,7 +168,7 @@ struct qfile_list_cache_entry_pool
  */
 
 /* list cache and related information */
-static QFILE_LIST_CACHE qfile_List_cache = { NULL, NULL, 0, 0, NULL, 0, 0, 0, 0, 0, 0 };
+static QFILE_LIST_CACHE qfile_List_cache = { NULL, NULL, 0, 0, NULL, 0, 0, 0, 0, 0, 0, 0 };
 
 /* information of candidates to be removed from XASL cache */
 static QFILE_LIST_CACHE_CANDIDATE qfile_List_cache_candidate = { 0, 0, 0, 0, NULL, NULL, NULL, 0, 0, false };
@@ -286,6 +287,9 @@ static int qfile_end_use_of_list_cache_entry_local (THREAD_ENTRY * thread_p, voi
 static bool qfile_is_early_time (struct timeval *a, struct timeval *b);
 
 static int qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args);
+static double qfile_get_list_cache_entry_benefit (const QFILE_LIST_CACHE_ENTRY * lent);
+static bool qfile_is_list_cache_admissible (const QFILE_LIST_ID * list_id, INT64 exec_time);
+static bool qfile_is_list_cache_over_budget (int more_pages);
 
 static int qfile_get_list_cache_entry_size_for_allocate (int nparam);
 #if defined(SERVER_MODE)
@@ -5504,6 +5508,7 @@ qfile_print_list_cache_entry (FILE * fp, const void *key, void *data, void *args
       (void) strftime (str, sizeof (str), "%x %X", c_time_struct);
       fprintf (fp, "  time_last_used = %s.%d\n", str, (int) ent->time_last_used.tv_usec);
 
+      fprintf (fp, "  exec_time = %lld usec\n", (long long) ent->exec_time);
       fprintf (fp, "  ref_count = %d\n", ent->ref_count);
       fprintf (fp, "  deletion_marker = %s\n", (ent->deletion_marker) ? "true" : "false");
       fprintf (fp, "}\n");
@@ -5534,10 +5539,10 @@ qfile_dump_list_cache_internal (THREAD_ENTRY * thread_p, FILE * fp)
 
   fprintf (fp,
 	   "LIST_CACHE {\n  n_hts %d\n  n_entries %d  n_pages %d\n"
-	   "  lookup_counter %d\n  hit_counter %d\n  miss_counter %d\n  full_counter %d\n}\n",
+	   "  lookup_counter %d\n  hit_counter %d\n  miss_counter %d\n  full_counter %d\n  reject_counter %d\n}\n",
 	   qfile_List_cache.n_hts, qfile_List_cache.n_entries, qfile_List_cache.n_pages,
 	   qfile_List_cache.lookup_counter, qfile_List_cache.hit_counter, qfile_List_cache.miss_counter,
-	   qfile_List_cache.full_counter);
+	   qfile_List_cache.full_counter, qfile_List_cache.reject_counter);
 
   for (i = 0; i < qfile_List_cache.n_hts; i++)
     {
@@ -5915,6 +5920,62 @@ qfile_is_early_time (struct timeval *a, struct timeval *b)
     }
 }
 
+/*
+ * qfile_get_list_cache_entry_benefit () - Get what keeping the entry in the
+ *					    cache saves per page it occupies
+ *   return: benefit of the entry
+ *   lent(in)   :
+ *
+ * Note: The time taken to make the result is saved every time the entry is
+ *       used, so cheap, rarely used or big results are replaced first.
+ */
+static double
+qfile_get_list_cache_entry_benefit (const QFILE_LIST_CACHE_ENTRY * lent)
+{
+  return ((double) (lent->ref_count + 1) * (double) lent->exec_time / (double) MAX (lent->list_id.page_cnt, 1));
+}
+
+/*
+ * qfile_is_list_cache_admissible () - Check if a query result is worth
+ *				       being cached
+ *   return: true if the result may be put into the list cache
+ *   list_id(in)        : query result
+ *   exec_time(in)      : how long it took to make the result, in microseconds
+ *
+ * Note: A result is admitted if it fits in the cache at all and making it
+ *       again would cost more than query_cache_min_cost_per_page
+ *       microseconds for every page the cached copy occupies. Cheap results
+ *       are faster to compute again than to keep.
+ */
+static bool
+qfile_is_list_cache_admissible (const QFILE_LIST_ID * list_id, INT64 exec_time)
+{
+  int max_pages = prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES);
+  INT64 min_cost = prm_get_integer_value (PRM_ID_LIST_QUERY_CACHE_MIN_COST);
+
+  if (max_pages > 0 && list_id->page_cnt > max_pages)
+    {
+      return false;
+    }
+
+  return exec_time >= min_cost * MAX (list_id->page_cnt, 1);
+}
+
+/*
+ * qfile_is_list_cache_over_budget () - Check if the cached results would use
+ *					more than query_cache_size_in_pages
+ *   return: true if the page budget would be exceeded
+ *   more_pages(in)     : pages to be added to the cache
+ */
+static bool
+qfile_is_list_cache_over_budget (int more_pages)
+{
+  /* this function should be called within CSECT_QPROC_LIST_CACHE */
+  int max_pages = prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES);
+
+  return (max_pages > 0 && qfile_List_cache.n_pages + more_pages > max_pages);
+}
+
 /*
  * qfile_select_list_cache_entry () - Select candidates to remove from the list cache
  *                               Will be used by mht_map_no_key() function
@@ -5969,7 +6030,7 @@ qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
 	  p++;
 	}
 
-      if (q && lent->ref_count < (*q)->ref_count)
+      if (q && qfile_get_list_cache_entry_benefit (lent) < qfile_get_list_cache_entry_benefit (*q))
 	{
 	  if (info->c_idx < info->num_candidates)
 	    {
@@ -6024,15 +6085,18 @@ qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
  *   params(in) :
  *   list_id(in)        :
  *   query_string(in)   :
+ *   exec_time(in)      : how long it took to make the result, in microseconds
  *
  * Note: Put the query result into the proper hash table with the key of
  *       the parameter values (DB_VALUE array) and the data of LIST ID.
  *       If there already exists the entry with the same key, update its data.
  *       As a side effect, the given 'list_hash_no' will be change if it was -1.
+ *       A new result is not cached if it is too cheap for its size, or if
+ *       it does not fit in query_cache_size_in_pages after replacement.
  */
 QFILE_LIST_CACHE_ENTRY *
 qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, const DB_VALUE_ARRAY * params,
-			       const QFILE_LIST_ID * list_id, const char *query_string)
+			       const QFILE_LIST_ID * list_id, const char *query_string, INT64 exec_time)
 {
   QFILE_LIST_CACHE_ENTRY *lent, *old, **p, **q, **r;
   MHT_TABLE *ht;
@@ -6159,10 +6223,16 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
       goto end;
     }
 
-  /* check the number of list cache entries */
+  if (!qfile_is_list_cache_admissible (list_id, exec_time))
+    {
+      qfile_List_cache.reject_counter++;	/* counter */
+      goto end;
+    }
+
+  /* check the number of list cache entries and the pages they use */
   if ((int) mht_count (ht) >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES)
       || qfile_List_cache.n_entries >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES)
-      || qfile_List_cache.n_pages >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES))
+      || qfile_is_list_cache_over_budget (list_id->page_cnt))
     {
 
       qfile_List_cache.full_counter++;	/* counter */
@@ -6267,6 +6337,13 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
 	  (void) qfile_delete_list_cache_entry (thread_p, old, &tran_index);
 	}
       qfile_List_cache_candidate.v_idx = 0;
+
+      /* entries in use are only marked to be deleted; do not go beyond the page budget */
+      if (qfile_is_list_cache_over_budget (list_id->page_cnt))
+	{
+	  qfile_List_cache.reject_counter++;	/* counter */
+	  goto end;
+	}
     }
 
   /* make new QFILE_LIST_CACHE_ENTRY */
@@ -6314,6 +6391,7 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
   lent->query_string = query_string;
   (void) gettimeofday (&lent->time_created, NULL);
   (void) gettimeofday (&lent->time_last_used, NULL);
+  lent->exec_time = exec_time;
   lent->ref_count = 0;
   lent->deletion_marker = false;
 
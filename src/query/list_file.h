@@ -86,6 +86,7 @@ struct qfile_list_cache_entry
   const char *query_string;	/* query string; information purpose only */
   struct timeval time_created;	/* when this entry created */
   struct timeval time_last_used;	/* when this entry used lastly */
+  INT64 exec_time;		/* how long it took to make this result, in microseconds */
   int ref_count;		/* how many times this query used */
   bool deletion_marker;		/* this entry will be deleted if marker set */
 };
@@ -154,7 +155,7 @@ QFILE_LIST_CACHE_ENTRY *qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p,
 						       const DB_VALUE_ARRAY * params);
 QFILE_LIST_CACHE_ENTRY *qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr,
 						       const DB_VALUE_ARRAY * params, const QFILE_LIST_ID * list_id,
-						       const char *query_string);
+						       const char *query_string, INT64 exec_time);
 int qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent, bool marker);
 
 /* Scan related routines */
@@ -924,7 +924,7 @@ eval_sub_sort_list_to_multi_set (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_i
   tplrec.size = 0;
   tplrec.tpl = NULL;
   p_tplrec.size = DB_PAGESIZE;
-  p_tplrec.tpl = (QFILE_TUPLE) db_private_alloc (thread_p, DB_PAGESIZE);
+  p_tplrec.tpl = (QFILE_TUPLE) db_arena_alloc (thread_p, DB_PAGESIZE);
   if (p_tplrec.tpl == NULL)
     {
       return V_ERROR;
@@ -988,7 +988,7 @@ eval_sub_sort_list_to_multi_set (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_i
 		  pr_clear_value (&list_val);
 		  pr_clear_value (&list_val2);
 		  qfile_close_scan (thread_p, &s_id);
-		  free_and_init (p_tplrec.tpl);
+		  db_private_free_and_init (thread_p, p_tplrec.tpl);
 		  return V_FALSE;
 		}
 	      card1 = 0;
@@ -1113,7 +1113,7 @@ eval_sub_sort_list_to_sort_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_i
   tplrec.size = 0;
   tplrec.tpl = NULL;
   p_tplrec.size = DB_PAGESIZE;
-  p_tplrec.tpl = (QFILE_TUPLE) db_private_alloc (thread_p, DB_PAGESIZE);
+  p_tplrec.tpl = (QFILE_TUPLE) db_arena_alloc (thread_p, DB_PAGESIZE);
   if (p_tplrec.tpl == NULL)
     {
       return V_ERROR;
@@ -126,6 +126,8 @@ typedef enum
   SHOWSTMT_FULL_TIMEZONES,
   SHOWSTMT_TRAN_TABLES,
   SHOWSTMT_THREADS,
+  SHOWSTMT_STATEMENT_CACHE,
+  SHOWSTMT_CONTENTION_STATISTICS,
 
   /* append the new show statement types in here */
 
@@ -53,6 +53,7 @@
 #if defined(SERVER_MODE)
 #include "connection_error.h"
 #include "thread.h"
+#include "job_queue.h"
 #endif /* SERVER_MODE */
 
 #include "query_manager.h"
@@ -75,6 +76,7 @@
 #include "partition.h"
 #include "tsc_timer.h"
 #include "xasl_generation.h"
+#include "show_scan.h"
 
 #if defined(ENABLE_SYSTEMTAP)
 #include "probes.h"
@@ -347,6 +349,79 @@ struct parent_pos_info
   PARENT_POS_INFO *stack;
 };
 
+/* hash join of two list files; see qexec_hash_join_list () */
+#define QEXEC_HASH_JOIN_HASH_RANGE      0x7fffffff
+#define QEXEC_HASH_JOIN_MAX_BUCKETS     (1 << 20)
+#define QEXEC_HASH_JOIN_MAX_PARTITIONS  64
+#define QEXEC_HASH_JOIN_MAX_LEVEL       3
+
+#define QEXEC_HASH_JOIN_PVALS(tpl, indp, valp, nvals) \
+  do \
+    { \
+      int _v; \
+      for (_v = 0; _v < (nvals); _v++) \
+	{ \
+	  QFILE_GET_TUPLE_VALUE_HEADER_POSITION ((tpl), (indp)[_v], (valp)[_v]); \
+	} \
+    } \
+  while (0)
+
+typedef struct qexec_hash_join_entry QEXEC_HASH_JOIN_ENTRY;
+struct qexec_hash_join_entry
+{
+  QEXEC_HASH_JOIN_ENTRY *next;	/* next entry in the same bucket */
+  unsigned int hash;		/* hash value of the join columns */
+  QFILE_TUPLE tpl;		/* copy of the build tuple; follows the entry */
+};
+
+typedef struct qexec_hash_join_context QEXEC_HASH_JOIN_CONTEXT;
+struct qexec_hash_join_context
+{
+  QFILE_LIST_ID *list_idp;	/* result list file */
+  QFILE_LIST_MERGE_INFO *merge_infop;
+  QFILE_TUPLE_RECORD merge_tplrec;	/* area to store the merged tuple */
+  int nvals;			/* join column count */
+  int *outer_indp;
+  int *inner_indp;
+  TP_DOMAIN **outer_domp;
+  TP_DOMAIN **inner_domp;
+  char **outer_valp;
+  char **inner_valp;
+  UINT64 max_size;		/* max_hash_join_size */
+  INT64 partitioned_pages;	/* list file pages written to partitions */
+};
+
+#if defined(SERVER_MODE)
+/* parallel heap scan of an aggregate query */
+typedef struct qexec_px_scan QEXEC_PX_SCAN;
+
+typedef struct qexec_px_worker QEXEC_PX_WORKER;
+struct qexec_px_worker
+{
+  QEXEC_PX_SCAN *px;
+  char *agg_area;		/* packed accumulators of the helper */
+  int error;
+  bool has_er_area;
+  char er_area[1024];		/* error of the helper, see er_get_area_error */
+};
+
+struct qexec_px_scan
+{
+  HEAP_PARALLEL_SCAN heap_scan;	/* page cursor shared by all the scanners */
+  XASL_ID xasl_id;		/* stream the helpers unpack their XASL tree from */
+  VAL_DESCR vd;			/* host variables and system values of the query */
+  QUERY_ID query_id;
+  int tran_index;
+  pthread_mutex_t mutex;	/* protects the members below */
+  pthread_cond_t cond;		/* signaled when a helper is done */
+  int ref_count;		/* calling thread + queued helpers */
+  int num_running;		/* helpers still scanning */
+  bool is_closed;		/* no more helpers may start scanning */
+  int num_workers;
+  QEXEC_PX_WORKER *workers;
+};
+#endif /* SERVER_MODE */
+
 /* XASL cache related things */
 
 /* RWLOCK for XASL cache */
@@ -354,14 +429,39 @@ SYNC_RWLOCK qexec_Rwlock_xasl_cache;
 #define QEXEC_RWLOCK_XASL_CACHE (&qexec_Rwlock_xasl_cache)
 #define QEXEC_RWLOCK_XASL_CACHE_NAME "QEXEC_RWLOCK_XASL_CACHE"
 
+/* Lookups by query string or XASL ID do not change the hash tables; they share the lock with each other and update
+ * the counters and the entry statistics atomically. Without atomic builtins they hold the lock exclusively. */
+#if defined (HAVE_ATOMIC_BUILTINS)
+#define XASL_CACHE_LOOKUP_LOCK() rwlock_read_lock (QEXEC_RWLOCK_XASL_CACHE)
+#define XASL_CACHE_LOOKUP_UNLOCK() rwlock_read_unlock (QEXEC_RWLOCK_XASL_CACHE)
+#define XASL_CACHE_STAT_INC(cnt) ATOMIC_INC_32 (&(cnt), 1)
+#else
+#define XASL_CACHE_LOOKUP_LOCK() rwlock_write_lock (QEXEC_RWLOCK_XASL_CACHE)
+#define XASL_CACHE_LOOKUP_UNLOCK() rwlock_write_unlock (QEXEC_RWLOCK_XASL_CACHE)
+#define XASL_CACHE_STAT_INC(cnt) ((cnt)++)
+#endif
+
 /* counters */
 typedef struct xasl_cache_counter XASL_CACHE_COUNTER;
 struct xasl_cache_counter
 {
-  unsigned int lookup;		/* counter of cache lookup */
-  unsigned int hit;		/* counter of cache hit */
-  unsigned int miss;		/* counter of cache miss */
-  unsigned int full;		/* counter of cache full */
+  int lookup;			/* counter of cache lookup */
+  int hit;			/* counter of cache hit */
+  int miss;			/* counter of cache miss */
+  int full;			/* counter of cache full */
+  int recompile;		/* counter of entries deleted by the recompilation threshold */
+};
+
+/* Recompile counts of the entries deleted by the recompilation threshold. The entry made by the recompilation of the
+ * same query takes over the count from here. Slots are indexed by the hash of the query string key and overwritten
+ * on collision. */
+#define XASL_CACHE_RECOMPILE_HISTORY_SIZE 64
+
+typedef struct xasl_cache_recompile_history XASL_CACHE_RECOMPILE_HISTORY;
+struct xasl_cache_recompile_history
+{
+  unsigned int hash;		/* hash of the query string key */
+  int count;			/* recompile count; 0 if the slot is empty */
 };
 
 typedef struct xasl_cache_ent_mark_deleted_list XASL_CACHE_MARK_DELETED_LIST;
@@ -501,7 +601,8 @@ static XASL_CACHE_ENT_INFO xasl_ent_cache = {
   {0,				/* lookup */
    0,				/* hit */
    0,				/* miss */
-   0 /* full */ },		/* counter */
+   0,				/* full */
+   0 /* recompile */ },		/* counter */
   NULL,				/* qstr_ht */
   NULL,				/* xid_ht */
   NULL				/* oid_ht */
@@ -523,7 +624,8 @@ static XASL_CACHE_ENT_INFO filter_pred_ent_cache = {
   {0,				/* lookup */
    0,				/* hit */
    0,				/* miss */
-   0 /* full */ },		/* counter */
+   0,				/* full */
+   0 /* recompile */ },		/* counter */
   NULL,				/* qstr_ht */
   NULL,				/* xid_ht */
   NULL				/* oid_ht */
@@ -538,6 +640,8 @@ static XASL_CACHE_ENT_INFO filter_pred_ent_cache = {
 #endif
 };
 
+static XASL_CACHE_RECOMPILE_HISTORY xasl_cache_recompile_history[XASL_CACHE_RECOMPILE_HISTORY_SIZE];
+
 #if defined (ENABLE_UNUSED_FUNCTION)
 /* XASL clone cache and related information */
 static XASL_CACHE_CLO_INFO xasl_clo_cache = {
@@ -546,7 +650,8 @@ static XASL_CACHE_CLO_INFO xasl_clo_cache = {
   {0,				/* lookup */
    0,				/* hit */
    0,				/* miss */
-   0 /* full */ },		/* counter */
+   0,				/* full */
+   0 /* recompile */ },		/* counter */
   NULL,				/* head */
   NULL,				/* tail */
   NULL,				/* free_list */
@@ -561,7 +666,8 @@ static XASL_CACHE_CLO_INFO filter_pred_clo_cache = {
   {0,				/* lookup */
    0,				/* hit */
    0,				/* miss */
-   0 /* full */ },		/* counter */
+   0,				/* full */
+   0 /* recompile */ },		/* counter */
   NULL,				/* head */
   NULL,				/* tail */
   NULL,				/* free_list */
@@ -772,6 +878,23 @@ static QFILE_LIST_ID *qexec_merge_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID *
 static QFILE_LIST_ID *qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID * inner_sid,
 					      QFILE_LIST_MERGE_INFO * merge_infop, PRED_EXPR * other_outer_join_pred,
 					      XASL_STATE * xasl_state, int ls_flag);
+static bool qexec_hash_join_is_hashable (TP_DOMAIN ** outer_domp, TP_DOMAIN ** inner_domp, int nvals);
+static int qexec_hash_join_hash_tuple (QFILE_TUPLE tpl, int *indp, TP_DOMAIN ** domp, int nvals, char **valp,
+				       unsigned int *hash_p, bool * is_null_p);
+static int qexec_hash_join_partition_of (unsigned int hash, int level, int npart);
+static void qexec_hash_join_destroy_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_idp);
+static int qexec_hash_join_partition (THREAD_ENTRY * thread_p, QFILE_LIST_ID * src_list_idp, bool is_outer,
+				      QEXEC_HASH_JOIN_CONTEXT * hjctx, int level, int npart,
+				      QFILE_LIST_ID ** part_list_idp);
+static int qexec_hash_join_build_probe (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp,
+					QFILE_LIST_ID * inner_list_idp, QEXEC_HASH_JOIN_CONTEXT * hjctx);
+static int qexec_hash_join_lists (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp,
+				  QFILE_LIST_ID * inner_list_idp, QEXEC_HASH_JOIN_CONTEXT * hjctx, int level);
+static int qexec_hash_join_sort_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_idp, int *indp,
+				      TP_DOMAIN ** domp, int nvals);
+static QFILE_LIST_ID *qexec_hash_join_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp,
+					    QFILE_LIST_ID * inner_list_idp, QFILE_LIST_MERGE_INFO * merge_infop,
+					    int ls_flag);
 static int qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 static int qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
 			    bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
@@ -841,6 +964,17 @@ static void qexec_free_delete_lob_info_list (THREAD_ENTRY * thread_p, DEL_LOB_IN
 static const char *qexec_schema_get_type_name_from_id (DB_TYPE id);
 static int qexec_schema_get_type_desc (DB_TYPE id, TP_DOMAIN * domain, DB_VALUE * result);
 static int qexec_execute_build_columns (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
+static void qexec_resolve_buildvalue_output_domains (XASL_NODE * xasl);
+#if defined(SERVER_MODE)
+static bool qexec_can_scan_in_parallel (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
+static QEXEC_PX_SCAN *qexec_start_parallel_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
+static int qexec_end_parallel_scan (THREAD_ENTRY * thread_p, QEXEC_PX_SCAN * px, XASL_NODE * xasl, bool is_scan_done);
+static void qexec_release_parallel_scan (QEXEC_PX_SCAN * px);
+static int qexec_parallel_scan_worker (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
+static int qexec_execute_parallel_scan (THREAD_ENTRY * thread_p, QEXEC_PX_WORKER * worker);
+static char *qexec_pack_parallel_aggregates (AGGREGATE_TYPE * agg_list);
+static int qexec_merge_parallel_aggregates (THREAD_ENTRY * thread_p, AGGREGATE_TYPE * agg_list, char *area);
+#endif /* SERVER_MODE */
 
 #if defined(SERVER_MODE)
 #if defined (ENABLE_UNUSED_FUNCTION)
@@ -867,6 +1001,8 @@ static int qexec_remove_my_tran_id_in_xasl_entry_internal (THREAD_ENTRY * thread
 static int qexec_free_filter_pred_cache_ent (THREAD_ENTRY * thread_p, void *data, void *args);
 static int qexec_select_xasl_cache_ent (THREAD_ENTRY * thread_p, void *data, void *args);
 static int qexec_delete_xasl_cache_ent (THREAD_ENTRY * thread_p, void *data, void *args);
+static bool qexec_xasl_cache_ent_is_timed_out (const XASL_CACHE_ENTRY * ent);
+static XASL_CACHE_RECOMPILE_HISTORY *qexec_get_xasl_cache_recompile_history (const XASL_QSTR_HT_KEY * key);
 static int qexec_delete_xasl_cache_ent_by_volume (THREAD_ENTRY * thread_p, void *data, void *args);
 static int qexec_delete_filter_pred_cache_ent (THREAD_ENTRY * thread_p, void *data, void *args);
 #if defined(SERVER_MODE)
@@ -1513,7 +1649,7 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
 	    {
 	      /* allocate tuple descriptor */
 	      tplrec->size = DB_PAGESIZE;
-	      tplrec->tpl = (QFILE_TUPLE) db_private_alloc (thread_p, DB_PAGESIZE);
+	      tplrec->tpl = (QFILE_TUPLE) db_arena_alloc (thread_p, DB_PAGESIZE);
 	      if (tplrec->tpl == NULL)
 		{
 		  GOTO_EXIT_ON_ERROR;
@@ -1549,9 +1685,6 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
     {
       if (xasl->proc.buildvalue.agg_list != NULL)
 	{
-	  AGGREGATE_TYPE *agg_node = NULL;
-	  REGU_VARIABLE_LIST out_list_val = NULL;
-
 	  if (xasl->proc.buildvalue.agg_list != NULL && !xasl->proc.buildvalue.agg_domains_resolved)
 	    {
 	      if (qexec_resolve_domains_for_aggregation (thread_p, xasl->proc.buildvalue.agg_list, xasl_state, tplrec,
@@ -1568,31 +1701,7 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
 	    }
 
 	  /* resolve domains for aggregates */
-	  for (out_list_val = xasl->outptr_list->valptrp; out_list_val != NULL; out_list_val = out_list_val->next)
-	    {
-	      assert (out_list_val->value.domain != NULL);
-
-	      /* aggregates corresponds to CONSTANT regu vars in outptr_list */
-	      if (out_list_val->value.type != TYPE_CONSTANT
-		  || (TP_DOMAIN_TYPE (out_list_val->value.domain) != DB_TYPE_VARIABLE
-		      && TP_DOMAIN_COLLATION_FLAG (out_list_val->value.domain) == TP_DOMAIN_COLL_NORMAL))
-		{
-		  continue;
-		}
-
-	      /* search in aggregate list by comparing DB_VALUE pointers */
-	      for (agg_node = xasl->proc.buildvalue.agg_list; agg_node != NULL; agg_node = agg_node->next)
-		{
-		  if (out_list_val->value.value.dbvalptr == agg_node->accumulator.value
-		      && TP_DOMAIN_TYPE (agg_node->domain) != DB_TYPE_NULL)
-		    {
-		      assert (agg_node->domain != NULL);
-		      assert (TP_DOMAIN_COLLATION_FLAG (agg_node->domain) == TP_DOMAIN_COLL_NORMAL);
-		      out_list_val->value.domain = agg_node->domain;
-		    }
-		}
-
-	    }
+	  qexec_resolve_buildvalue_output_domains (xasl);
 	}
     }
 
@@ -6247,3267 +6356,3044 @@ exit_on_error:
 }
 
 /*
- * qexec_merge_listfiles () -
+ * qexec_hash_join_is_hashable () - check whether the join columns of the
+ *                                  two list files can be hash joined
+ *   return: true if values that compare equal are guaranteed to hash equal
+ *   outer_domp(in)     : outer join column domains
+ *   inner_domp(in)     : inner join column domains
+ *   nvals(in)  : join column count
+ */
+static bool
+qexec_hash_join_is_hashable (TP_DOMAIN ** outer_domp, TP_DOMAIN ** inner_domp, int nvals)
+{
+  int k;
+
+  for (k = 0; k < nvals; k++)
+    {
+      if (TP_DOMAIN_TYPE (outer_domp[k]) != TP_DOMAIN_TYPE (inner_domp[k]))
+	{
+	  return false;
+	}
+
+      switch (TP_DOMAIN_TYPE (outer_domp[k]))
+	{
+	case DB_TYPE_INTEGER:
+	case DB_TYPE_SHORT:
+	case DB_TYPE_BIGINT:
+	case DB_TYPE_DATE:
+	case DB_TYPE_TIME:
+	case DB_TYPE_UTIME:
+	case DB_TYPE_DATETIME:
+	case DB_TYPE_OID:
+	case DB_TYPE_OBJECT:
+	  break;
+
+	case DB_TYPE_CHAR:
+	case DB_TYPE_VARCHAR:
+	case DB_TYPE_NCHAR:
+	case DB_TYPE_VARNCHAR:
+	  if (TP_DOMAIN_COLLATION (outer_domp[k]) != TP_DOMAIN_COLLATION (inner_domp[k]))
+	    {
+	      return false;
+	    }
+	  break;
+
+	default:
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * qexec_hash_join_hash_tuple () - compute the hash value of the join columns
  *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     :
- *
- * Note: This function is used for a direct merge of two LIST files
- * during XASL tree interpretation.
- *
- * Note: For a direct list file merge, currently the outer and inner columns
- * should have the same data type.
+ *   tpl(in)    : list file tuple
+ *   indp(in)   : join column positions
+ *   domp(in)   : join column domains
+ *   nvals(in)  : join column count
+ *   valp(out)  : join column value pointers
+ *   hash_p(out): hash value
+ *   is_null_p(out): true if any join column is NULL; such tuples never join
  */
 static int
-qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
+qexec_hash_join_hash_tuple (QFILE_TUPLE tpl, int *indp, TP_DOMAIN ** domp, int nvals, char **valp,
+			    unsigned int *hash_p, bool * is_null_p)
 {
-  QFILE_LIST_ID *list_id = NULL;
-  ACCESS_SPEC_TYPE *outer_spec = NULL;	/* left */
-  ACCESS_SPEC_TYPE *inner_spec = NULL;	/* right */
-  QFILE_LIST_MERGE_INFO *merge_infop = &(xasl->proc.mergelist.ls_merge);
-  XASL_NODE *outer_xasl, *inner_xasl;
-  int ls_flag = 0;
-
-  outer_xasl = xasl->proc.mergelist.outer_xasl;
-  inner_xasl = xasl->proc.mergelist.inner_xasl;
+  OR_BUF buf;
+  DB_VALUE dbval;
+  int k, len;
 
-  /* open the empty list file if not already open */
+  *hash_p = 0;
+  *is_null_p = false;
 
-  if (outer_xasl->list_id->type_list.type_cnt == 0)
+  for (k = 0; k < nvals; k++)
     {
-      /* start main block iterations */
-      if (qexec_start_mainblock_iterations (thread_p, outer_xasl, xasl_state) != NO_ERROR)
+      QFILE_GET_TUPLE_VALUE_HEADER_POSITION (tpl, indp[k], valp[k]);
+      len = QFILE_GET_TUPLE_VALUE_LENGTH (valp[k]);
+      if (QFILE_GET_TUPLE_VALUE_FLAG (valp[k]) == V_UNBOUND || len == 0)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  *is_null_p = true;
+	  return NO_ERROR;
 	}
-    }
-  if (inner_xasl->list_id->type_list.type_cnt == 0)
-    {
-      /* start main block iterations */
-      if (qexec_start_mainblock_iterations (thread_p, inner_xasl, xasl_state) != NO_ERROR)
+
+      or_init (&buf, (char *) (valp[k] + QFILE_TUPLE_VALUE_HEADER_SIZE), len);
+      /* Do not copy the string--just use the pointer. */
+      if ((*(domp[k]->type->data_readval)) (&buf, &dbval, domp[k], -1, false, NULL, 0) != NO_ERROR)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  return ER_FAILED;
+	}
+      if (DB_IS_NULL (&dbval))
+	{
+	  *is_null_p = true;
+	  return NO_ERROR;
 	}
+
+      *hash_p = *hash_p * 31 + mht_get_hash_number (QEXEC_HASH_JOIN_HASH_RANGE, &dbval);
+      pr_clear_value (&dbval);
     }
 
-  /* If MERGELIST_PROC does not have 'order by' (xasl->orderby_list), then the list file to be open at here will be the 
-   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
-   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the 
-   * last result file. */
+  return NO_ERROR;
+}
 
-  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
-  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
-      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
+/*
+ * qexec_hash_join_partition_of () - map a hash value to a partition
+ *   return: partition number
+ *   hash(in)   : hash value of the join columns
+ *   level(in)  : partitioning level
+ *   npart(in)  : partition count
+ *
+ * Note: Each partitioning level scrambles the hash value differently, so
+ *       that a partition which is still too large can be split again. The
+ *       bucket number (hash % nbuckets) is kept independent as well.
+ */
+static int
+qexec_hash_join_partition_of (unsigned int hash, int level, int npart)
+{
+  unsigned int x = hash ^ (0x9e3779b9U * (unsigned int) (level + 1));
+
+  x ^= x >> 16;
+  x *= 0x85ebca6bU;
+  x ^= x >> 13;
+  x *= 0xc2b2ae35U;
+  x ^= x >> 16;
+
+  return (int) (x % (unsigned int) npart);
+}
+
+/*
+ * qexec_hash_join_destroy_list () - destroy a temporary partition list file
+ *   return:
+ *   list_idp(in)       :
+ */
+static void
+qexec_hash_join_destroy_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_idp)
+{
+  if (list_idp != NULL)
     {
-      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+      qfile_close_list (thread_p, list_idp);
+      qfile_destroy_list (thread_p, list_idp);
+      QFILE_FREE_AND_INIT_LIST_ID (list_idp);
     }
+}
+
+/*
+ * qexec_hash_join_partition () - split a list file into partitions on the
+ *                                hash value of its join columns
+ *   return: NO_ERROR, or ER_code
+ *   src_list_idp(in)   : list file to be split
+ *   is_outer(in)       : true if src_list_idp is the outer list file
+ *   hjctx(in)  : hash join context
+ *   level(in)  : partitioning level
+ *   npart(in)  : partition count
+ *   part_list_idp(out) : partition list files
+ *
+ * Note: Tuples with NULL join columns are dropped, since an inner join can
+ *       never return them.
+ */
+static int
+qexec_hash_join_partition (THREAD_ENTRY * thread_p, QFILE_LIST_ID * src_list_idp, bool is_outer,
+			   QEXEC_HASH_JOIN_CONTEXT * hjctx, int level, int npart, QFILE_LIST_ID ** part_list_idp)
+{
+  QFILE_LIST_SCAN_ID sid;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_CODE scan;
+  unsigned int hash;
+  bool is_null;
+  int i, part;
+  int *indp = is_outer ? hjctx->outer_indp : hjctx->inner_indp;
+  TP_DOMAIN **domp = is_outer ? hjctx->outer_domp : hjctx->inner_domp;
+  char **valp = is_outer ? hjctx->outer_valp : hjctx->inner_valp;
 
-  if (merge_infop->join_type == JOIN_INNER)
+  sid.status = S_CLOSED;
+
+  for (i = 0; i < npart; i++)
     {
-      /* call list file merge routine */
-      list_id = qexec_merge_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
+      part_list_idp[i] =
+	qfile_open_list (thread_p, &src_list_idp->type_list, NULL, src_list_idp->query_id, QFILE_FLAG_ALL);
+      if (part_list_idp[i] == NULL)
+	{
+	  goto exit_on_error;
+	}
     }
-  else
+
+  if (qfile_open_list_scan (src_list_idp, &sid) != NO_ERROR)
     {
-      outer_spec = xasl->proc.mergelist.outer_spec_list;
-      inner_spec = xasl->proc.mergelist.inner_spec_list;
+      goto exit_on_error;
+    }
 
-      assert (xasl->scan_op_type == S_SELECT);
-      if (qexec_open_scan (thread_p, outer_spec, xasl->proc.mergelist.outer_val_list, &xasl_state->vd, false,
-			   outer_spec->fixed_scan, outer_spec->grouped_scan, true, &outer_spec->s_id,
-			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+  while ((scan = qfile_scan_list_next (thread_p, &sid, &tplrec, PEEK)) == S_SUCCESS)
+    {
+      if (qexec_hash_join_hash_tuple (tplrec.tpl, indp, domp, hjctx->nvals, valp, &hash, &is_null) != NO_ERROR)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  goto exit_on_error;
 	}
-
-      if (qexec_open_scan (thread_p, inner_spec, xasl->proc.mergelist.inner_val_list, &xasl_state->vd, false,
-			   inner_spec->fixed_scan, inner_spec->grouped_scan, true, &inner_spec->s_id,
-			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+      if (is_null)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  continue;
 	}
 
-      /* call outer join merge routine */
-      list_id =
-	qexec_merge_list_outer (thread_p, &outer_spec->s_id, &inner_spec->s_id, merge_infop, xasl->after_join_pred,
-				xasl_state, ls_flag);
-
-      qexec_close_scan (thread_p, outer_spec);
-      outer_spec = NULL;
+      part = qexec_hash_join_partition_of (hash, level, npart);
+      if (qfile_add_tuple_to_list (thread_p, part_list_idp[part], tplrec.tpl) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+    }
 
-      qexec_close_scan (thread_p, inner_spec);
-      inner_spec = NULL;
+  if (scan == S_ERROR)
+    {
+      goto exit_on_error;
     }
 
-  if (list_id == NULL)
+  qfile_close_scan (thread_p, &sid);
+
+  for (i = 0; i < npart; i++)
     {
-      GOTO_EXIT_ON_ERROR;
+      qfile_close_list (thread_p, part_list_idp[i]);
     }
 
-  /* make this the resultant list file */
-  qfile_copy_list_id (xasl->list_id, list_id, true);
-  QFILE_FREE_AND_INIT_LIST_ID (list_id);
+  hjctx->partitioned_pages += src_list_idp->page_cnt;
 
   return NO_ERROR;
 
 exit_on_error:
+  qfile_close_scan (thread_p, &sid);
 
-  if (outer_spec)
-    {
-      qexec_close_scan (thread_p, outer_spec);
-    }
-  if (inner_spec)
+  for (i = 0; i < npart; i++)
     {
-      qexec_close_scan (thread_p, inner_spec);
+      qexec_hash_join_destroy_list (thread_p, part_list_idp[i]);
+      part_list_idp[i] = NULL;
     }
 
   return ER_FAILED;
 }
 
 /*
- * Interpreter routines
- */
-
-/*
- * qexec_open_scan () -
+ * qexec_hash_join_build_probe () - join two list files in memory
  *   return: NO_ERROR, or ER_code
- *   curr_spec(in)      : Access Specification Node
- *   val_list(in)       : Value list pointer
- *   vd(in)     : Value descriptor
- *   force_select_lock(in)  :
- *   fixed(in)  : Fixed scan flag
- *   grouped(in)        : Grouped scan flag
- *   iscan_oid_order(in)       :
- *   s_id(out)   : Set to the scan identifier
- *   p_mvcc_select_lock_needed(out): true, whether instance lock needed at select 
+ *   outer_list_idp(in) : outer list file
+ *   inner_list_idp(in) : inner list file
+ *   hjctx(in)  : hash join context
  *
- * Note: This routine is used to open a scan on an access specification
- * node. A scan identifier is created with the given parameters.
+ * Note: The smaller list file is loaded into a chained hash table, the other
+ *       one is scanned once and probes it. Hash collisions are resolved by
+ *       comparing the join columns with qexec_cmp_tpl_vals_merge, the same
+ *       comparison the merge join uses.
  */
 static int
-qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
-		 bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
-		 QUERY_ID query_id, SCAN_OPERATION_TYPE scan_op_type, bool scan_immediately_stop,
-		 bool * p_mvcc_select_lock_needed)
+qexec_hash_join_build_probe (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp, QFILE_LIST_ID * inner_list_idp,
+			     QEXEC_HASH_JOIN_CONTEXT * hjctx)
 {
-  SCAN_TYPE scan_type;
-  INDX_INFO *indx_info;
-  bool mvcc_select_lock_needed = false;
+  QFILE_LIST_ID *build_list_idp, *probe_list_idp;
+  QFILE_LIST_SCAN_ID sid;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  QFILE_TUPLE_RECORD build_tplrec = { NULL, 0 };
+  QEXEC_HASH_JOIN_ENTRY **buckets = NULL;
+  QEXEC_HASH_JOIN_ENTRY *entry, *next;
+  SCAN_CODE scan;
+  DB_VALUE_COMPARE_RESULT val_cmp;
+  unsigned int hash, nbuckets, b;
+  bool is_null, build_is_inner;
+  int tpl_len;
+  int *build_indp, *probe_indp;
+  TP_DOMAIN **build_domp, **probe_domp;
+  char **build_valp, **probe_valp;
+  int error = NO_ERROR;
 
-  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && !curr_spec->pruned)
+  /* build on the smaller list file */
+  build_is_inner = (inner_list_idp->page_cnt <= outer_list_idp->page_cnt);
+  if (build_is_inner)
     {
-      if (qexec_prune_spec (thread_p, curr_spec, vd, scan_op_type) != NO_ERROR)
-	{
-	  goto exit_on_error;
-	}
+      build_list_idp = inner_list_idp;
+      probe_list_idp = outer_list_idp;
+      build_indp = hjctx->inner_indp;
+      build_domp = hjctx->inner_domp;
+      build_valp = hjctx->inner_valp;
+      probe_indp = hjctx->outer_indp;
+      probe_domp = hjctx->outer_domp;
+      probe_valp = hjctx->outer_valp;
     }
-
-  if (curr_spec->type == TARGET_CLASS && heap_is_mvcc_disabled_for_class (&ACCESS_SPEC_CLS_OID (curr_spec)))
+  else
     {
-      assert (!force_select_lock);
-
-      /* We expect to update or delete a non MVCC objects via a scan are only db_serial, db_ha_apply_info and
-       * _db_collation objects. */
-      assert ((scan_op_type != S_DELETE && scan_op_type != S_UPDATE) || oid_is_serial (&ACCESS_SPEC_CLS_OID (curr_spec))
-	      || (oid_check_cached_class_oid (OID_CACHE_HA_APPLY_INFO_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec)))
-	      || (oid_check_cached_class_oid (OID_CACHE_COLLATION_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec))));
+      build_list_idp = outer_list_idp;
+      probe_list_idp = inner_list_idp;
+      build_indp = hjctx->outer_indp;
+      build_domp = hjctx->outer_domp;
+      build_valp = hjctx->outer_valp;
+      probe_indp = hjctx->inner_indp;
+      probe_domp = hjctx->inner_domp;
+      probe_valp = hjctx->inner_valp;
     }
-  else
+
+  if (build_list_idp->tuple_cnt == 0 || probe_list_idp->tuple_cnt == 0)
     {
-      if (force_select_lock)
-	{
-	  mvcc_select_lock_needed = true;
-	}
-      else
-	{
-	  mvcc_select_lock_needed = (curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE);
-	}
+      return NO_ERROR;
     }
 
-  switch (curr_spec->type)
+  nbuckets = (unsigned int) MIN (build_list_idp->tuple_cnt, QEXEC_HASH_JOIN_MAX_BUCKETS);
+  nbuckets = MAX (nbuckets, 1) | 1;
+  buckets = (QEXEC_HASH_JOIN_ENTRY **) db_private_alloc (thread_p, nbuckets * sizeof (QEXEC_HASH_JOIN_ENTRY *));
+  if (buckets == NULL)
     {
-    case TARGET_CLASS:
-      if (curr_spec->access == SEQUENTIAL)
-	{
-	  /* open a sequential heap file scan */
-	  scan_type = S_HEAP_SCAN;
-	  indx_info = NULL;
-	}
-      else if (curr_spec->access == SEQUENTIAL_RECORD_INFO)
-	{
-	  /* open a sequential heap file scan that reads record info */
-	  scan_type = S_HEAP_SCAN_RECORD_INFO;
-	  indx_info = NULL;
-	}
-      else if (curr_spec->access == SEQUENTIAL_PAGE_SCAN)
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (buckets, 0, nbuckets * sizeof (QEXEC_HASH_JOIN_ENTRY *));
+
+  /* build phase */
+  sid.status = S_CLOSED;
+  if (qfile_open_list_scan (build_list_idp, &sid) != NO_ERROR)
+    {
+      error = ER_FAILED;
+      goto end;
+    }
+
+  while ((scan = qfile_scan_list_next (thread_p, &sid, &tplrec, PEEK)) == S_SUCCESS)
+    {
+      if (qexec_hash_join_hash_tuple (tplrec.tpl, build_indp, build_domp, hjctx->nvals, build_valp, &hash, &is_null)
+	  != NO_ERROR)
 	{
-	  /* open a sequential heap file scan that reads page info */
-	  scan_type = S_HEAP_PAGE_SCAN;
-	  indx_info = NULL;
+	  error = ER_FAILED;
+	  goto end;
 	}
-      else if (curr_spec->access == INDEX)
+      if (is_null)
 	{
-	  /* open an indexed heap file scan */
-	  scan_type = S_INDX_SCAN;
-	  indx_info = curr_spec->indexptr;
+	  continue;
 	}
-      else if (curr_spec->access == INDEX_KEY_INFO)
+
+      tpl_len = QFILE_GET_TUPLE_LENGTH (tplrec.tpl);
+      entry = (QEXEC_HASH_JOIN_ENTRY *) db_private_alloc (thread_p, sizeof (QEXEC_HASH_JOIN_ENTRY) + tpl_len);
+      if (entry == NULL)
 	{
-	  scan_type = S_INDX_KEY_INFO_SCAN;
-	  indx_info = curr_spec->indexptr;
+	  error = ER_OUT_OF_VIRTUAL_MEMORY;
+	  goto end;
 	}
-      else if (curr_spec->access == INDEX_NODE_INFO)
+      entry->hash = hash;
+      entry->tpl = (QFILE_TUPLE) (entry + 1);
+      memcpy (entry->tpl, tplrec.tpl, tpl_len);
+
+      b = hash % nbuckets;
+      entry->next = buckets[b];
+      buckets[b] = entry;
+    }
+  qfile_close_scan (thread_p, &sid);
+
+  if (scan == S_ERROR)
+    {
+      error = ER_FAILED;
+      goto end;
+    }
+
+  /* probe phase */
+  if (qfile_open_list_scan (probe_list_idp, &sid) != NO_ERROR)
+    {
+      error = ER_FAILED;
+      goto end;
+    }
+
+  while ((scan = qfile_scan_list_next (thread_p, &sid, &tplrec, PEEK)) == S_SUCCESS)
+    {
+      if (qexec_hash_join_hash_tuple (tplrec.tpl, probe_indp, probe_domp, hjctx->nvals, probe_valp, &hash, &is_null)
+	  != NO_ERROR)
 	{
-	  scan_type = S_INDX_NODE_INFO_SCAN;
-	  indx_info = curr_spec->indexptr;
+	  error = ER_FAILED;
+	  goto end;
 	}
-      else
-	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-	  return ER_FAILED;
-	}			/* if */
-      if (scan_type == S_HEAP_SCAN || scan_type == S_HEAP_SCAN_RECORD_INFO)
+      if (is_null)
 	{
-	  if (scan_open_heap_scan (thread_p, s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
-				   curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-				   &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
-				   curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
-				   curr_spec->s.cls_node.cls_regu_list_rest,
-				   curr_spec->s.cls_node.num_attrs_pred,
-				   curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
-				   curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
-				   curr_spec->s.cls_node.cache_rest, scan_type, curr_spec->s.cls_node.cache_reserved,
-				   curr_spec->s.cls_node.cls_regu_list_reserved) != NO_ERROR)
-	    {
-	      goto exit_on_error;
-	    }
+	  continue;
 	}
-      else if (scan_type == S_HEAP_PAGE_SCAN)
+
+      for (entry = buckets[hash % nbuckets]; entry != NULL; entry = entry->next)
 	{
-	  if (scan_open_heap_page_scan (thread_p, s_id, val_list, vd, &ACCESS_SPEC_CLS_OID (curr_spec),
-					&ACCESS_SPEC_HFID (curr_spec), curr_spec->where_pred, scan_type,
-					curr_spec->s.cls_node.cache_reserved,
-					curr_spec->s.cls_node.cls_regu_list_reserved) != NO_ERROR)
+	  if (entry->hash != hash)
 	    {
-	      goto exit_on_error;
+	      continue;
 	    }
-	}
-      else if (scan_type == S_INDX_KEY_INFO_SCAN)
-	{
-	  if (scan_open_index_key_info_scan (thread_p, s_id, val_list, vd, indx_info, &ACCESS_SPEC_CLS_OID (curr_spec),
-					     &ACCESS_SPEC_HFID (curr_spec), curr_spec->where_pred,
-					     curr_spec->s.cls_node.cls_output_val_list, iscan_oid_order, query_id,
-					     curr_spec->s.cls_node.cache_reserved,
-					     curr_spec->s.cls_node.cls_regu_list_reserved) != NO_ERROR)
+
+	  QEXEC_HASH_JOIN_PVALS (entry->tpl, build_indp, build_valp, hjctx->nvals);
+	  val_cmp = qexec_cmp_tpl_vals_merge (hjctx->outer_valp, hjctx->outer_domp, hjctx->inner_valp,
+					      hjctx->inner_domp, hjctx->nvals);
+	  if (val_cmp == DB_UNK)
 	    {
-	      goto exit_on_error;
+	      error = ER_FAILED;
+	      goto end;
 	    }
-	  /* monitor */
-	  mnt_qm_iscans (thread_p);
-	}
-      else if (scan_type == S_INDX_NODE_INFO_SCAN)
-	{
-	  if (scan_open_index_node_info_scan (thread_p, s_id, val_list, vd, indx_info, curr_spec->where_pred,
-					      curr_spec->s.cls_node.cache_reserved,
-					      curr_spec->s.cls_node.cls_regu_list_reserved) != NO_ERROR)
+	  if (val_cmp != DB_EQ)
 	    {
-	      goto exit_on_error;
+	      continue;
 	    }
-	  /* monitor */
-	  mnt_qm_iscans (thread_p);
-	}
-      else			/* S_INDX_SCAN */
-	{
-	  if (scan_open_index_scan (thread_p, s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
-				    curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd, indx_info,
-				    &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
-				    curr_spec->s.cls_node.cls_regu_list_key, curr_spec->where_key,
-				    curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
-				    curr_spec->s.cls_node.cls_regu_list_rest, curr_spec->where_range,
-				    curr_spec->s.cls_node.cls_regu_list_range,
-				    curr_spec->s.cls_node.cls_output_val_list, curr_spec->s.cls_node.cls_regu_val_list,
-				    curr_spec->s.cls_node.num_attrs_key, curr_spec->s.cls_node.attrids_key,
-				    curr_spec->s.cls_node.cache_key, curr_spec->s.cls_node.num_attrs_pred,
-				    curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
-				    curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
-				    curr_spec->s.cls_node.cache_rest, curr_spec->s.cls_node.num_attrs_range,
-				    curr_spec->s.cls_node.attrids_range, curr_spec->s.cls_node.cache_range,
-				    iscan_oid_order, query_id) != NO_ERROR)
 
+	  build_tplrec.tpl = entry->tpl;
+	  build_tplrec.size = QFILE_GET_TUPLE_LENGTH (entry->tpl);
+	  error =
+	    qexec_merge_tuple_add_list (thread_p, hjctx->list_idp, build_is_inner ? &tplrec : &build_tplrec,
+					build_is_inner ? &build_tplrec : &tplrec, hjctx->merge_infop,
+					&hjctx->merge_tplrec);
+	  if (error != NO_ERROR)
 	    {
-	      goto exit_on_error;
+	      goto end;
 	    }
-	  /* monitor */
-	  mnt_qm_iscans (thread_p);
 	}
-      break;
+    }
 
-    case TARGET_CLASS_ATTR:
-      if (scan_open_class_attr_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-				     &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
-				     curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
-				     curr_spec->s.cls_node.cls_regu_list_rest, curr_spec->s.cls_node.num_attrs_pred,
-				     curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
-				     curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
-				     curr_spec->s.cls_node.cache_rest) != NO_ERROR)
-	{
-	  goto exit_on_error;
-	}
-      break;
+  if (scan == S_ERROR)
+    {
+      error = ER_FAILED;
+    }
 
-    case TARGET_LIST:
-      /* open a list file scan */
-      if (scan_open_list_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-			       ACCESS_SPEC_LIST_ID (curr_spec), curr_spec->s.list_node.list_regu_list_pred,
-			       curr_spec->where_pred, curr_spec->s.list_node.list_regu_list_rest) != NO_ERROR)
-	{
-	  goto exit_on_error;
-	}
-      break;
+end:
+  qfile_close_scan (thread_p, &sid);
 
-    case TARGET_SHOWSTMT:
-      /* open a showstmt scan */
-      if (scan_open_showstmt_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-				   curr_spec->where_pred, curr_spec->s.showstmt_node.show_type,
-				   curr_spec->s.showstmt_node.arg_list) != NO_ERROR)
+  for (b = 0; b < nbuckets; b++)
+    {
+      for (entry = buckets[b]; entry != NULL; entry = next)
 	{
-	  goto exit_on_error;
+	  next = entry->next;
+	  db_private_free (thread_p, entry);
 	}
-      break;
+    }
+  db_private_free_and_init (thread_p, buckets);
 
-    case TARGET_REGUVAL_LIST:
-      /* open a regu value list scan */
-      if (scan_open_values_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-				 ACCESS_SPEC_RLIST_VALPTR_LIST (curr_spec)) != NO_ERROR)
-	{
-	  goto exit_on_error;
-	}
-      break;
+  return error;
+}
 
-    case TARGET_SET:
-      /* open a set based derived table scan */
-      if (scan_open_set_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-			      ACCESS_SPEC_SET_PTR (curr_spec), ACCESS_SPEC_SET_REGU_LIST (curr_spec),
-			      curr_spec->where_pred) != NO_ERROR)
-	{
-	  goto exit_on_error;
-	}
-      break;
+/*
+ * qexec_hash_join_lists () - hash join two list files
+ *   return: NO_ERROR, or ER_code
+ *   outer_list_idp(in) : outer list file
+ *   inner_list_idp(in) : inner list file
+ *   hjctx(in)  : hash join context
+ *   level(in)  : partitioning level; 0 for the original list files
+ *
+ * Note: If the smaller list file does not fit in max_hash_join_size, both
+ *       list files are split into partitions on the hash value of their
+ *       join columns and each pair of partitions is joined separately
+ *       (grace hash join). Partitions that are still too large are split
+ *       again, up to QEXEC_HASH_JOIN_MAX_LEVEL times; past that point they
+ *       are joined in memory regardless of their size.
+ */
+static int
+qexec_hash_join_lists (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp, QFILE_LIST_ID * inner_list_idp,
+		       QEXEC_HASH_JOIN_CONTEXT * hjctx, int level)
+{
+  QFILE_LIST_ID *outer_part[QEXEC_HASH_JOIN_MAX_PARTITIONS];
+  QFILE_LIST_ID *inner_part[QEXEC_HASH_JOIN_MAX_PARTITIONS];
+  UINT64 build_size;
+  int npart, i;
+  int error = NO_ERROR;
 
-    case TARGET_METHOD:
-      if (scan_open_method_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-				 ACCESS_SPEC_METHOD_LIST_ID (curr_spec),
-				 ACCESS_SPEC_METHOD_SIG_LIST (curr_spec)) != NO_ERROR)
-	{
-	  goto exit_on_error;
-	}
-      break;
+  if (outer_list_idp->tuple_cnt == 0 || inner_list_idp->tuple_cnt == 0)
+    {
+      return NO_ERROR;
+    }
 
-    default:
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-      goto exit_on_error;
-    }				/* switch */
+  build_size = (UINT64) MIN (outer_list_idp->page_cnt, inner_list_idp->page_cnt) * DB_PAGESIZE;
+  if (build_size <= hjctx->max_size || level >= QEXEC_HASH_JOIN_MAX_LEVEL)
+    {
+      return qexec_hash_join_build_probe (thread_p, outer_list_idp, inner_list_idp, hjctx);
+    }
 
-  s_id->scan_immediately_stop = scan_immediately_stop;
+  npart = (int) (build_size / hjctx->max_size) + 1;
+  npart = MIN (MAX (npart, 2), QEXEC_HASH_JOIN_MAX_PARTITIONS);
 
-  if (p_mvcc_select_lock_needed)
+  for (i = 0; i < npart; i++)
     {
-      *p_mvcc_select_lock_needed = mvcc_select_lock_needed;
+      outer_part[i] = inner_part[i] = NULL;
     }
 
-  return NO_ERROR;
+  error = qexec_hash_join_partition (thread_p, outer_list_idp, true, hjctx, level, npart, outer_part);
+  if (error != NO_ERROR)
+    {
+      goto end;
+    }
 
-exit_on_error:
+  error = qexec_hash_join_partition (thread_p, inner_list_idp, false, hjctx, level, npart, inner_part);
+  if (error != NO_ERROR)
+    {
+      goto end;
+    }
 
-  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && curr_spec->parts != NULL)
+  for (i = 0; i < npart; i++)
     {
-      /* reset pruning info */
-      db_private_free (thread_p, curr_spec->parts);
-      curr_spec->parts = NULL;
-      curr_spec->curent = NULL;
-      curr_spec->pruned = false;
+      error = qexec_hash_join_lists (thread_p, outer_part[i], inner_part[i], hjctx, level + 1);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      /* release the partition pages as soon as they are joined */
+      qexec_hash_join_destroy_list (thread_p, outer_part[i]);
+      outer_part[i] = NULL;
+      qexec_hash_join_destroy_list (thread_p, inner_part[i]);
+      inner_part[i] = NULL;
     }
 
-  return ER_FAILED;
+end:
+  for (i = 0; i < npart; i++)
+    {
+      qexec_hash_join_destroy_list (thread_p, outer_part[i]);
+      qexec_hash_join_destroy_list (thread_p, inner_part[i]);
+    }
+
+  return error;
 }
 
 /*
- * qexec_close_scan () -
- *   return:
- *   curr_spec(in)      : Access Specification Node
- *
- * Note: This routine is used to close the access specification node scan.
+ * qexec_hash_join_sort_list () - sort a list file on its join columns
+ *   return: NO_ERROR, or ER_code
+ *   list_idp(in/out)   : list file; replaced by its sorted version
+ *   indp(in)   : join column positions
+ *   domp(in)   : join column domains
+ *   nvals(in)  : join column count
  */
-static void
-qexec_close_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
+static int
+qexec_hash_join_sort_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_idp, int *indp, TP_DOMAIN ** domp,
+			   int nvals)
 {
-  if (curr_spec)
-    {
-      /* monitoring */
-      switch (curr_spec->type)
-	{
-	case TARGET_CLASS:
-	  if (curr_spec->access == SEQUENTIAL || curr_spec->access == SEQUENTIAL_RECORD_INFO
-	      || curr_spec->access == SEQUENTIAL_PAGE_SCAN)
-	    {
-	      mnt_qm_sscans (thread_p);
-	    }
-	  else if (IS_ANY_INDEX_ACCESS (curr_spec->access))
-	    {
-	      mnt_qm_iscans (thread_p);
-	    }
-	  if (curr_spec->parts != NULL)
-	    {
-	      /* reset pruning info */
-	      db_private_free (thread_p, curr_spec->parts);
-	      curr_spec->parts = NULL;
-	      curr_spec->curent = NULL;
-	      curr_spec->pruned = false;
-	    }
-	  break;
-	case TARGET_CLASS_ATTR:
-	  break;
-	case TARGET_LIST:
-	  mnt_qm_lscans (thread_p);
-	  break;
-	case TARGET_SHOWSTMT:
-	  /* do nothing */
-	  break;
-	case TARGET_REGUVAL_LIST:
-	  /* currently do nothing */
-	  break;
-	case TARGET_SET:
-	  mnt_qm_setscans (thread_p);
-	  break;
-	case TARGET_METHOD:
-	  mnt_qm_methscans (thread_p);
-	  break;
-	}
-      scan_close_scan (thread_p, &curr_spec->s_id);
+  SORT_LIST *sort_list;
+  int k;
+
+  sort_list = (SORT_LIST *) db_private_alloc (thread_p, nvals * sizeof (SORT_LIST));
+  if (sort_list == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  memset (sort_list, 0, nvals * sizeof (SORT_LIST));
+  for (k = 0; k < nvals; k++)
+    {
+      sort_list[k].next = (k + 1 < nvals) ? &sort_list[k + 1] : NULL;
+      sort_list[k].pos_descr.pos_no = indp[k];
+      sort_list[k].pos_descr.dom = domp[k];
+      sort_list[k].s_order = S_ASC;
+      sort_list[k].s_nulls = S_NULLS_FIRST;
     }
+
+  list_idp = qfile_sort_list (thread_p, list_idp, sort_list, Q_ALL, true);
+
+  db_private_free_and_init (thread_p, sort_list);
+
+  return (list_idp != NULL) ? NO_ERROR : ER_FAILED;
 }
 
 /*
- * qexec_end_scan () -
- *   return:
- *   curr_spec(in)      : Access Specification Node
+ * qexec_hash_join_list () -
+ *   return: QFILE_LIST_ID *, or NULL
+ *   outer_list_idp(in) : First (left) list file to be joined
+ *   inner_list_idp(in) : Second (right) list file to be joined
+ *   merge_infop(in)    : List file merge information
+ *   ls_flag(in)        :
  *
- * Note: This routine is used to end the access specification node scan.
+ * Note: This routine inner joins the given two unsorted list files by
+ * hashing their join columns and returns the result list file identifier.
+ * The result tuples have the same layout as the ones of qexec_merge_list.
  *
- * Note: This routine is called for ERROR CASE scan end operation.
+ * Note: If the join columns of the two list files have different domains,
+ * equal values might not hash to the same bucket. The optimizer does not
+ * pick hash joins for such columns, but in case it happens both list files
+ * are sorted here and merged by qexec_merge_list instead.
  */
-static void
-qexec_end_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
+static QFILE_LIST_ID *
+qexec_hash_join_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp, QFILE_LIST_ID * inner_list_idp,
+		      QFILE_LIST_MERGE_INFO * merge_infop, int ls_flag)
 {
-  if (curr_spec)
+  QEXEC_HASH_JOIN_CONTEXT hjctx;
+  QFILE_TUPLE_VALUE_TYPE_LIST type_list;
+  QFILE_LIST_ID *list_idp = NULL;
+  int nvals, k;
+
+  memset (&hjctx, 0, sizeof (hjctx));
+  type_list.domp = NULL;
+
+  nvals = merge_infop->ls_column_cnt;
+  hjctx.nvals = nvals;
+  hjctx.merge_infop = merge_infop;
+  hjctx.outer_indp = merge_infop->ls_outer_column;
+  hjctx.inner_indp = merge_infop->ls_inner_column;
+  hjctx.max_size = prm_get_bigint_value (PRM_ID_MAX_HASH_JOIN_SIZE);
+
+  hjctx.outer_domp = (TP_DOMAIN **) db_private_alloc (thread_p, nvals * sizeof (TP_DOMAIN *));
+  hjctx.inner_domp = (TP_DOMAIN **) db_private_alloc (thread_p, nvals * sizeof (TP_DOMAIN *));
+  hjctx.outer_valp = (char **) db_private_alloc (thread_p, nvals * sizeof (char *));
+  hjctx.inner_valp = (char **) db_private_alloc (thread_p, nvals * sizeof (char *));
+  if (hjctx.outer_domp == NULL || hjctx.inner_domp == NULL || hjctx.outer_valp == NULL || hjctx.inner_valp == NULL)
     {
-      scan_end_scan (thread_p, &curr_spec->s_id);
+      goto exit_on_error;
     }
-}
-
-/*
- * qexec_next_merge_block () -
- *   return:
- *   spec(in)   :
- */
-static SCAN_CODE
-qexec_next_merge_block (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE ** spec)
-{
-  SCAN_CODE sb_scan;
 
-  if (scan_start_scan (thread_p, &(*spec)->s_id) != NO_ERROR)
+  for (k = 0; k < nvals; k++)
     {
-      return S_ERROR;
+      hjctx.outer_domp[k] = outer_list_idp->type_list.domp[hjctx.outer_indp[k]];
+      hjctx.inner_domp[k] = inner_list_idp->type_list.domp[hjctx.inner_indp[k]];
     }
 
-  do
+  if (!qexec_hash_join_is_hashable (hjctx.outer_domp, hjctx.inner_domp, nvals))
     {
-      sb_scan = scan_next_scan_block (thread_p, &(*spec)->s_id);
-      if (sb_scan == S_SUCCESS)
+      if (qexec_hash_join_sort_list (thread_p, outer_list_idp, hjctx.outer_indp, hjctx.outer_domp, nvals) != NO_ERROR
+	  || qexec_hash_join_sort_list (thread_p, inner_list_idp, hjctx.inner_indp, hjctx.inner_domp,
+					nvals) != NO_ERROR)
 	{
-	  return S_SUCCESS;
+	  goto exit_on_error;
 	}
-      else if (sb_scan == S_END)
-	{
-	  /* close old scan */
-	  scan_end_scan (thread_p, &(*spec)->s_id);
 
-	  /* move to the following access specifications left */
-	  *spec = (*spec)->next;
+      list_idp = qexec_merge_list (thread_p, outer_list_idp, inner_list_idp, merge_infop, ls_flag);
+      goto exit_on_end;
+    }
 
-	  /* check for and skip the case of empty heap files */
-	  while (*spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (*spec))
-	    {
-	      *spec = (*spec)->next;
-	    }
+  /* form the typelist for the resultant list file */
+  type_list.type_cnt = merge_infop->ls_pos_cnt;
+  type_list.domp = (TP_DOMAIN **) malloc (type_list.type_cnt * sizeof (TP_DOMAIN *));
+  if (type_list.domp == NULL)
+    {
+      goto exit_on_error;
+    }
 
-	  if (*spec == NULL)
-	    {
-	      return S_END;
-	    }
+  for (k = 0; k < type_list.type_cnt; k++)
+    {
+      type_list.domp[k] = ((merge_infop->ls_outer_inner_list[k] == QFILE_OUTER_LIST)
+			   ? outer_list_idp->type_list.domp[merge_infop->ls_pos_list[k]]
+			   : inner_list_idp->type_list.domp[merge_infop->ls_pos_list[k]]);
+    }
 
-	  /* initialize scan */
-	  if (scan_start_scan (thread_p, &(*spec)->s_id) != NO_ERROR)
-	    {
-	      return S_ERROR;
-	    }
-	}
-      else
-	{
-	  return S_ERROR;
-	}
+  /* open the result list file; same query id with outer(inner) list file */
+  list_idp = qfile_open_list (thread_p, &type_list, NULL, outer_list_idp->query_id, ls_flag);
+  if (list_idp == NULL)
+    {
+      goto exit_on_error;
+    }
+  hjctx.list_idp = list_idp;
 
+  /* allocate the area to store the merged tuple */
+  if (qfile_reallocate_tuple (&hjctx.merge_tplrec, DB_PAGESIZE) != NO_ERROR)
+    {
+      goto exit_on_error;
     }
-  while (1);
+
+  if (qexec_hash_join_lists (thread_p, outer_list_idp, inner_list_idp, &hjctx, 0) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  if (hjctx.partitioned_pages > 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "qexec_hash_join_list: %lld list file pages were spilled into partitions\n",
+		    (long long) hjctx.partitioned_pages);
+    }
+
+  qfile_close_list (thread_p, list_idp);
+
+exit_on_end:
+  if (type_list.domp)
+    {
+      free_and_init (type_list.domp);
+    }
+  if (hjctx.merge_tplrec.tpl)
+    {
+      db_private_free_and_init (thread_p, hjctx.merge_tplrec.tpl);
+    }
+  if (hjctx.outer_domp)
+    {
+      db_private_free_and_init (thread_p, hjctx.outer_domp);
+    }
+  if (hjctx.inner_domp)
+    {
+      db_private_free_and_init (thread_p, hjctx.inner_domp);
+    }
+  if (hjctx.outer_valp)
+    {
+      db_private_free_and_init (thread_p, hjctx.outer_valp);
+    }
+  if (hjctx.inner_valp)
+    {
+      db_private_free_and_init (thread_p, hjctx.inner_valp);
+    }
+
+  return list_idp;
+
+exit_on_error:
+  if (list_idp)
+    {
+      qfile_close_list (thread_p, list_idp);
+      qfile_destroy_list (thread_p, list_idp);
+      QFILE_FREE_AND_INIT_LIST_ID (list_idp);
+    }
+
+  list_idp = NULL;
+  goto exit_on_end;
 }
 
 /*
- * qexec_next_scan_block () -
- *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ * qexec_merge_listfiles () -
+ *   return: NO_ERROR, or ER_code
  *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     :
  *
- * Note: This function is used to move the current access specification
- * node scan identifier for the given XASL block to the next
- * scan block. If there are no more scan blocks for the current
- * access specfication node, it moves to the next access
- * specification, if any, and starts the new scan block for that
- * node. If there are no more access specification nodes left,
- * it returns S_END.
+ * Note: This function is used for a direct merge of two LIST files
+ * during XASL tree interpretation.
+ *
+ * Note: For a direct list file merge, currently the outer and inner columns
+ * should have the same data type.
  */
-static SCAN_CODE
-qexec_next_scan_block (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+static int
+qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
 {
-  SCAN_CODE sb_scan;
-  OID *class_oid;
-  HFID *class_hfid;
+  QFILE_LIST_ID *list_id = NULL;
+  ACCESS_SPEC_TYPE *outer_spec = NULL;	/* left */
+  ACCESS_SPEC_TYPE *inner_spec = NULL;	/* right */
+  QFILE_LIST_MERGE_INFO *merge_infop = &(xasl->proc.mergelist.ls_merge);
+  XASL_NODE *outer_xasl, *inner_xasl;
+  int ls_flag = 0;
 
-  if (xasl->curr_spec == NULL)
-    {
-      /* initialize scan id */
-      xasl->curr_spec = xasl->spec_list;
+  outer_xasl = xasl->proc.mergelist.outer_xasl;
+  inner_xasl = xasl->proc.mergelist.inner_xasl;
 
-      /* check for and skip the case of empty heap file cases */
-      while (xasl->curr_spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (xasl->curr_spec))
+  /* open the empty list file if not already open */
+
+  if (outer_xasl->list_id->type_list.type_cnt == 0)
+    {
+      /* start main block iterations */
+      if (qexec_start_mainblock_iterations (thread_p, outer_xasl, xasl_state) != NO_ERROR)
 	{
-	  xasl->curr_spec = xasl->curr_spec->next;
+	  GOTO_EXIT_ON_ERROR;
 	}
-
-      if (xasl->curr_spec == NULL)
+    }
+  if (inner_xasl->list_id->type_list.type_cnt == 0)
+    {
+      /* start main block iterations */
+      if (qexec_start_mainblock_iterations (thread_p, inner_xasl, xasl_state) != NO_ERROR)
 	{
-	  return S_END;
+	  GOTO_EXIT_ON_ERROR;
 	}
+    }
 
-      assert (xasl->curr_spec != NULL);
+  /* If MERGELIST_PROC does not have 'order by' (xasl->orderby_list), then the list file to be open at here will be the 
+   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
+   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the 
+   * last result file. */
 
-      /* initialize scan */
-      if ((xasl->curr_spec->type == TARGET_CLASS || xasl->curr_spec->type == TARGET_CLASS_ATTR)
-	  && xasl->curr_spec->parts != NULL && xasl->curr_spec->curent == NULL
-	  && xasl->curr_spec->access != INDEX_NODE_INFO)
-	{
-	  /* initialize the scan_id for partitioned classes */
-	  if (xasl->curr_spec->access == SEQUENTIAL || xasl->curr_spec->access == SEQUENTIAL_RECORD_INFO)
-	    {
-	      class_oid = &xasl->curr_spec->s_id.s.hsid.cls_oid;
-	      class_hfid = &xasl->curr_spec->s_id.s.hsid.hfid;
-	    }
-	  else if (xasl->curr_spec->access == SEQUENTIAL_PAGE_SCAN)
-	    {
-	      class_oid = &xasl->curr_spec->s_id.s.hpsid.cls_oid;
-	      class_hfid = &xasl->curr_spec->s_id.s.hpsid.hfid;
-	    }
-	  else if (xasl->curr_spec->access == INDEX || xasl->curr_spec->access == INDEX_KEY_INFO)
-	    {
-	      class_oid = &xasl->curr_spec->s_id.s.isid.cls_oid;
-	      class_hfid = &xasl->curr_spec->s_id.s.isid.hfid;
-	    }
-	  else
-	    {
-	      assert (false);
-	      return S_ERROR;
-	    }
+  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
+      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
+    {
+      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+    }
 
-	  COPY_OID (class_oid, &ACCESS_SPEC_CLS_OID (xasl->curr_spec));
-	  HFID_COPY (class_hfid, &ACCESS_SPEC_HFID (xasl->curr_spec));
-	}
+  if (merge_infop->join_type == JOIN_INNER && merge_infop->join_method == QFILE_JOIN_HASH)
+    {
+      /* call list file hash join routine; the list files are not sorted */
+      list_id = qexec_hash_join_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
+    }
+  else if (merge_infop->join_type == JOIN_INNER)
+    {
+      /* call list file merge routine */
+      list_id = qexec_merge_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
+    }
+  else
+    {
+      outer_spec = xasl->proc.mergelist.outer_spec_list;
+      inner_spec = xasl->proc.mergelist.inner_spec_list;
 
-      if (scan_start_scan (thread_p, &xasl->curr_spec->s_id) != NO_ERROR)
+      assert (xasl->scan_op_type == S_SELECT);
+      if (qexec_open_scan (thread_p, outer_spec, xasl->proc.mergelist.outer_val_list, &xasl_state->vd, false,
+			   outer_spec->fixed_scan, outer_spec->grouped_scan, true, &outer_spec->s_id,
+			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
 	{
-	  return S_ERROR;
+	  GOTO_EXIT_ON_ERROR;
 	}
-    }
 
-  do
-    {
-      sb_scan = scan_next_scan_block (thread_p, &xasl->curr_spec->s_id);
-      if (sb_scan == S_SUCCESS)
+      if (qexec_open_scan (thread_p, inner_spec, xasl->proc.mergelist.inner_val_list, &xasl_state->vd, false,
+			   inner_spec->fixed_scan, inner_spec->grouped_scan, true, &inner_spec->s_id,
+			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
 	{
-	  return S_SUCCESS;
+	  GOTO_EXIT_ON_ERROR;
 	}
-      else if (sb_scan == S_END)
-	{
-	  /* if curr_spec is a partitioned class, do not move to the next spec unless we went through all partitions */
-	  SCAN_CODE s_parts = qexec_init_next_partition (thread_p, xasl->curr_spec);
-	  if (s_parts == S_SUCCESS)
-	    {
-	      /* successfully moved to the next partition */
-	      continue;
-	    }
-	  else if (s_parts == S_ERROR)
-	    {
-	      return S_ERROR;
-	    }
 
-	  /* close old scan */
-	  scan_end_scan (thread_p, &xasl->curr_spec->s_id);
+      /* call outer join merge routine */
+      list_id =
+	qexec_merge_list_outer (thread_p, &outer_spec->s_id, &inner_spec->s_id, merge_infop, xasl->after_join_pred,
+				xasl_state, ls_flag);
 
-	  /* move to the following access specifications left */
-	  xasl->curr_spec = xasl->curr_spec->next;
+      qexec_close_scan (thread_p, outer_spec);
+      outer_spec = NULL;
 
-	  /* check for and skip the case of empty heap files */
-	  while (xasl->curr_spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (xasl->curr_spec))
-	    {
-	      xasl->curr_spec = xasl->curr_spec->next;
-	    }
+      qexec_close_scan (thread_p, inner_spec);
+      inner_spec = NULL;
+    }
 
-	  if (xasl->curr_spec == NULL)
-	    {
-	      return S_END;
-	    }
+  if (list_id == NULL)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
 
-	  /* initialize scan */
-	  if (scan_start_scan (thread_p, &xasl->curr_spec->s_id) != NO_ERROR)
-	    {
-	      return S_ERROR;
-	    }
-	}
-      else
-	{
-	  return S_ERROR;
-	}
+  /* make this the resultant list file */
+  qfile_copy_list_id (xasl->list_id, list_id, true);
+  QFILE_FREE_AND_INIT_LIST_ID (list_id);
+
+  return NO_ERROR;
+
+exit_on_error:
+
+  if (outer_spec)
+    {
+      qexec_close_scan (thread_p, outer_spec);
+    }
+  if (inner_spec)
+    {
+      qexec_close_scan (thread_p, inner_spec);
     }
-  while (1);
 
+  return ER_FAILED;
 }
 
 /*
- * qexec_next_scan_block_iterations () -
- *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
- *   xasl(in)   : XASL Tree pointer
+ * Interpreter routines
+ */
+
+/*
+ * qexec_open_scan () -
+ *   return: NO_ERROR, or ER_code
+ *   curr_spec(in)      : Access Specification Node
+ *   val_list(in)       : Value list pointer
+ *   vd(in)     : Value descriptor
+ *   force_select_lock(in)  :
+ *   fixed(in)  : Fixed scan flag
+ *   grouped(in)        : Grouped scan flag
+ *   iscan_oid_order(in)       :
+ *   s_id(out)   : Set to the scan identifier
+ *   p_mvcc_select_lock_needed(out): true, whether instance lock needed at select 
  *
+ * Note: This routine is used to open a scan on an access specification
+ * node. A scan identifier is created with the given parameters.
  */
-static SCAN_CODE
-qexec_next_scan_block_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+static int
+qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
+		 bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
+		 QUERY_ID query_id, SCAN_OPERATION_TYPE scan_op_type, bool scan_immediately_stop,
+		 bool * p_mvcc_select_lock_needed)
 {
-  SCAN_CODE sb_next;
-  SCAN_CODE xs_scan;
-  SCAN_CODE xs_scan2;
-  XASL_NODE *last_xptr;
-  XASL_NODE *prev_xptr;
-  XASL_NODE *xptr2, *xptr3;
+  SCAN_TYPE scan_type;
+  INDX_INFO *indx_info;
+  bool mvcc_select_lock_needed = false;
 
-  /* first find the last scan block to be moved */
-  for (last_xptr = xasl; last_xptr->scan_ptr; last_xptr = last_xptr->scan_ptr)
+  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && !curr_spec->pruned)
     {
-      if (!last_xptr->next_scan_block_on
-	  || (last_xptr->curr_spec && last_xptr->curr_spec->s_id.status == S_STARTED
-	      && !last_xptr->curr_spec->s_id.qualified_block))
+      if (qexec_prune_spec (thread_p, curr_spec, vd, scan_op_type) != NO_ERROR)
 	{
-	  break;
+	  goto exit_on_error;
 	}
     }
 
-  /* move the last scan block and reset further scans */
+  if (curr_spec->type == TARGET_CLASS && heap_is_mvcc_disabled_for_class (&ACCESS_SPEC_CLS_OID (curr_spec)))
+    {
+      assert (!force_select_lock);
 
-  /* if there are no qualified items in the current scan block, this scan block will make no contribution with other
-   * possible scan block combinations from following classes. Thus, directly move to the next scan block in this class. */
-  if (last_xptr->curr_spec && last_xptr->curr_spec->s_id.status == S_STARTED
-      && !last_xptr->curr_spec->s_id.qualified_block)
+      /* We expect to update or delete a non MVCC objects via a scan are only db_serial, db_ha_apply_info and
+       * _db_collation objects. */
+      assert ((scan_op_type != S_DELETE && scan_op_type != S_UPDATE) || oid_is_serial (&ACCESS_SPEC_CLS_OID (curr_spec))
+	      || (oid_check_cached_class_oid (OID_CACHE_HA_APPLY_INFO_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec)))
+	      || (oid_check_cached_class_oid (OID_CACHE_COLLATION_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec))));
+    }
+  else
     {
-      if ((xs_scan = qexec_next_scan_block (thread_p, last_xptr)) == S_END)
-	{
-	  /* close following scan procedures if they are still active */
-	  for (xptr2 = last_xptr; xptr2; xptr2 = xptr2->scan_ptr)
-	    {
-	      if (xptr2->scan_ptr && xptr2->next_scan_block_on)
-		{
-		  if (xptr2->scan_ptr->curr_spec)
-		    {
-		      scan_end_scan (thread_p, &xptr2->scan_ptr->curr_spec->s_id);
-		    }
-		  xptr2->scan_ptr->curr_spec->curent = NULL;
-		  xptr2->scan_ptr->curr_spec = NULL;
-		  xptr2->next_scan_block_on = false;
-		}
-	    }
-	}
-      else if (xs_scan == S_ERROR)
+      if (force_select_lock)
 	{
-	  return S_ERROR;
+	  mvcc_select_lock_needed = true;
 	}
-    }
-  else if ((xs_scan = qexec_next_scan_block (thread_p, last_xptr)) == S_SUCCESS)
-    {				/* reset all the futher scans */
-      for (xptr2 = last_xptr; xptr2; xptr2 = xptr2->scan_ptr)
+      else
 	{
-	  if (xptr2->scan_ptr)
-	    {
-	      sb_next = qexec_next_scan_block (thread_p, xptr2->scan_ptr);
-	      if (sb_next == S_SUCCESS)
-		{
-		  xptr2->next_scan_block_on = true;
-		}
-	      else if (sb_next == S_END)
-		{
-		  /* close all preceding scan procedures and return */
-		  for (xptr3 = xasl; xptr3 && xptr3 != xptr2->scan_ptr; xptr3 = xptr3->scan_ptr)
-		    {
-		      if (xptr3->curr_spec)
-			{
-			  scan_end_scan (thread_p, &xptr3->curr_spec->s_id);
-			}
-		      xptr3->curr_spec->curent = NULL;
-		      xptr3->curr_spec = NULL;
-		      xptr3->next_scan_block_on = false;
-		    }
-		  return S_END;
-		}
-	      else
-		{
-		  return S_ERROR;
-		}
-	    }
+	  mvcc_select_lock_needed = (curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE);
 	}
     }
-  else if (xs_scan == S_ERROR)
-    {
-      return S_ERROR;
-    }
 
-  /* now move backwards, resetting all the previous scans */
-  while (last_xptr != xasl)
+  switch (curr_spec->type)
     {
-
-      /* find the previous to last xptr */
-      for (prev_xptr = xasl; prev_xptr->scan_ptr != last_xptr; prev_xptr = prev_xptr->scan_ptr)
-	;
-
-      /* set previous scan according to the last scan status */
-      if (last_xptr->curr_spec == NULL)
-	{			/* last scan ended */
-	  prev_xptr->next_scan_block_on = false;
-
-	  /* move the scan block of the previous scan */
-	  xs_scan2 = qexec_next_scan_block (thread_p, prev_xptr);
-	  if (xs_scan2 == S_SUCCESS)
-	    {
-	      /* move all the further scan blocks */
-	      for (xptr2 = prev_xptr; xptr2; xptr2 = xptr2->scan_ptr)
-		{
-		  if (xptr2->scan_ptr)
-		    {
-		      sb_next = qexec_next_scan_block (thread_p, xptr2->scan_ptr);
-		      if (sb_next == S_SUCCESS)
-			{
-			  xptr2->next_scan_block_on = true;
-			}
-		      else if (sb_next == S_END)
-			{
-			  /* close all preceding scan procedures and return */
-			  for (xptr3 = xasl; xptr3 && xptr3 != xptr2->scan_ptr; xptr3 = xptr3->scan_ptr)
-			    {
-			      if (xptr3->curr_spec)
-				{
-				  scan_end_scan (thread_p, &xptr3->curr_spec->s_id);
-				}
-			      xptr3->curr_spec->curent = NULL;
-			      xptr3->curr_spec = NULL;
-			      xptr3->next_scan_block_on = false;
-			    }
-			  return S_END;
-			}
-		      else
-			{
-			  return S_ERROR;
-			}
-		    }
-		}
-	    }
-	  else if (xs_scan2 == S_ERROR)
-	    {
-	      return S_ERROR;
-	    }
-
+    case TARGET_CLASS:
+      if (curr_spec->access == SEQUENTIAL)
+	{
+	  /* open a sequential heap file scan */
+	  scan_type = S_HEAP_SCAN;
+	  indx_info = NULL;
 	}
-      else			/* last scan successfully moved */
+      else if (curr_spec->access == SEQUENTIAL_RECORD_INFO)
 	{
-	  if (scan_reset_scan_block (thread_p, &prev_xptr->curr_spec->s_id) == S_ERROR)
-	    {
-	      return S_ERROR;
-	    }
+	  /* open a sequential heap file scan that reads record info */
+	  scan_type = S_HEAP_SCAN_RECORD_INFO;
+	  indx_info = NULL;
 	}
-
-      /* make previous scan the last scan ptr */
-      last_xptr = prev_xptr;
-    }				/* while */
-
-  /* return the status of the first XASL block */
-  return (xasl->curr_spec) ? S_SUCCESS : S_END;
-}
-
-/*
- * qexec_execute_scan () -
- *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
- *   xasl(in)   : XASL Tree block
- *   xasl_state(in)     : XASL tree state information
- *   next_scan_fnc(in)  : Function to interpret following scan block
- *
- * Note: This routine executes one iteration on a scan operation on
- * the given XASL tree block. If end_of_scan is reached, it
- * return S_END. If an error occurs, it returns
- * S_ERROR. Each scan procedure block may have its own scan
- * procedures forming a path of scan procedure blocks. Thus, for
- * each scan procedure block interpretation, if there are already
- * active scan procedures started from that block, first their
- * execution is requested. Only if all of the following scan
- * procedures come to an end returning S_END, then the
- * current scan procedure scan item is advanced. When this scan
- * procedure too come to an end, it returns S_END to the
- * caller, indicating that there are no more scan items in the
- * path of the scan procedure blocks.
- *
- * Note: This function is the general scan block interpretation function.
- */
-static SCAN_CODE
-qexec_execute_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * ignore,
-		    XASL_SCAN_FNC_PTR next_scan_fnc)
-{
-  XASL_NODE *xptr;
-  SCAN_CODE sc_scan;
-  SCAN_CODE xs_scan;
-  DB_LOGICAL ev_res;
-  int qualified;
-  SCAN_OPERATION_TYPE scan_operation_type;
-
-  /* check if further scan procedure are still active */
-  if (xasl->scan_ptr && xasl->next_scan_on)
-    {
-      xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, ignore, next_scan_fnc + 1);
-      if (xs_scan != S_END)
+      else if (curr_spec->access == SEQUENTIAL_PAGE_SCAN)
 	{
-	  return xs_scan;
+	  /* open a sequential heap file scan that reads page info */
+	  scan_type = S_HEAP_PAGE_SCAN;
+	  indx_info = NULL;
 	}
-
-      xasl->next_scan_on = false;
-    }
-
-  do
-    {
-      sc_scan = scan_next_scan (thread_p, &xasl->curr_spec->s_id);
-      if (sc_scan != S_SUCCESS)
+      else if (curr_spec->access == INDEX)
 	{
-	  return sc_scan;
+	  /* open an indexed heap file scan */
+	  scan_type = S_INDX_SCAN;
+	  indx_info = curr_spec->indexptr;
 	}
-
-      /* set scan item as qualified */
-      qualified = true;
-
-      if (qualified)
+      else if (curr_spec->access == INDEX_KEY_INFO)
 	{
-	  /* clear bptr subquery list files */
-	  if (xasl->bptr_list)
+	  scan_type = S_INDX_KEY_INFO_SCAN;
+	  indx_info = curr_spec->indexptr;
+	}
+      else if (curr_spec->access == INDEX_NODE_INFO)
+	{
+	  scan_type = S_INDX_NODE_INFO_SCAN;
+	  indx_info = curr_spec->indexptr;
+	}
+      else
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+	  return ER_FAILED;
+	}			/* if */
+      if (scan_type == S_HEAP_SCAN || scan_type == S_HEAP_SCAN_RECORD_INFO)
+	{
+	  if (scan_open_heap_scan (thread_p, s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
+				   curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+				   &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
+				   curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
+				   curr_spec->s.cls_node.cls_regu_list_rest,
+				   curr_spec->s.cls_node.num_attrs_pred,
+				   curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
+				   curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
+				   curr_spec->s.cls_node.cache_rest, scan_type, curr_spec->s.cls_node.cache_reserved,
+				   curr_spec->s.cls_node.cls_regu_list_reserved) != NO_ERROR)
 	    {
-	      qexec_clear_head_lists (thread_p, xasl->bptr_list);
-	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
-		{
-		  scan_operation_type = S_UPDATE;
-		}
-	      else
-		{
-		  scan_operation_type = S_SELECT;
-		}
+	      goto exit_on_error;
 	    }
-	  /* evaluate bptr list */
-	  for (xptr = xasl->bptr_list; qualified && xptr != NULL; xptr = xptr->next)
+	}
+      else if (scan_type == S_HEAP_PAGE_SCAN)
+	{
+	  if (scan_open_heap_page_scan (thread_p, s_id, val_list, vd, &ACCESS_SPEC_CLS_OID (curr_spec),
+					&ACCESS_SPEC_HFID (curr_spec), curr_spec->where_pred, scan_type,
+					curr_spec->s.cls_node.cache_reserved,
+					curr_spec->s.cls_node.cls_regu_list_reserved) != NO_ERROR)
 	    {
-	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
-		{
-		  return S_ERROR;
-		}
-	      else if (xptr->proc.fetch.fetch_res == false)
-		{
-		  qualified = false;
-		}
+	      goto exit_on_error;
 	    }
-	}			/* if (qualified) */
-
-      if (qualified)
+	}
+      else if (scan_type == S_INDX_KEY_INFO_SCAN)
 	{
-	  /* evaluate dptr list */
-	  for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
+	  if (scan_open_index_key_info_scan (thread_p, s_id, val_list, vd, indx_info, &ACCESS_SPEC_CLS_OID (curr_spec),
+					     &ACCESS_SPEC_HFID (curr_spec), curr_spec->where_pred,
+					     curr_spec->s.cls_node.cls_output_val_list, iscan_oid_order, query_id,
+					     curr_spec->s.cls_node.cache_reserved,
+					     curr_spec->s.cls_node.cls_regu_list_reserved) != NO_ERROR)
 	    {
-	      /* clear correlated subquery list files */
-	      qexec_clear_head_lists (thread_p, xptr);
-	      if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
-		{
-		  /* skip if linked to regu var */
-		  continue;
-		}
-	      if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
-		{
-		  return S_ERROR;
-		}
+	      goto exit_on_error;
 	    }
-	}			/* if (qualified) */
-
-      if (qualified)
+	  /* monitor */
+	  mnt_qm_iscans (thread_p);
+	}
+      else if (scan_type == S_INDX_NODE_INFO_SCAN)
 	{
-	  /* evaluate after join predicate */
-	  ev_res = V_UNKNOWN;
-	  if (xasl->after_join_pred != NULL)
+	  if (scan_open_index_node_info_scan (thread_p, s_id, val_list, vd, indx_info, curr_spec->where_pred,
+					      curr_spec->s.cls_node.cache_reserved,
+					      curr_spec->s.cls_node.cls_regu_list_reserved) != NO_ERROR)
 	    {
-	      ev_res = eval_pred (thread_p, xasl->after_join_pred, &xasl_state->vd, NULL);
-	      if (ev_res == V_ERROR)
-		{
-		  return S_ERROR;
-		}
+	      goto exit_on_error;
 	    }
-	  qualified = (xasl->after_join_pred == NULL || ev_res == V_TRUE);
-	}			/* if (qualified) */
-
-      if (qualified)
+	  /* monitor */
+	  mnt_qm_iscans (thread_p);
+	}
+      else			/* S_INDX_SCAN */
 	{
-	  /* evaluate if predicate */
-	  ev_res = V_UNKNOWN;
-	  if (xasl->if_pred != NULL)
+	  if (scan_open_index_scan (thread_p, s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
+				    curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd, indx_info,
+				    &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
+				    curr_spec->s.cls_node.cls_regu_list_key, curr_spec->where_key,
+				    curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
+				    curr_spec->s.cls_node.cls_regu_list_rest, curr_spec->where_range,
+				    curr_spec->s.cls_node.cls_regu_list_range,
+				    curr_spec->s.cls_node.cls_output_val_list, curr_spec->s.cls_node.cls_regu_val_list,
+				    curr_spec->s.cls_node.num_attrs_key, curr_spec->s.cls_node.attrids_key,
+				    curr_spec->s.cls_node.cache_key, curr_spec->s.cls_node.num_attrs_pred,
+				    curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
+				    curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
+				    curr_spec->s.cls_node.cache_rest, curr_spec->s.cls_node.num_attrs_range,
+				    curr_spec->s.cls_node.attrids_range, curr_spec->s.cls_node.cache_range,
+				    iscan_oid_order, query_id) != NO_ERROR)
+
 	    {
-	      ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
-	      if (ev_res == V_ERROR)
-		{
-		  return S_ERROR;
-		}
+	      goto exit_on_error;
 	    }
-	  qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
-	}			/* if (qualified) */
+	  /* monitor */
+	  mnt_qm_iscans (thread_p);
+	}
+      break;
 
-      if (qualified)
-	{
-	  /* clear fptr subquery list files */
-	  if (xasl->fptr_list)
-	    {
-	      qexec_clear_head_lists (thread_p, xasl->fptr_list);
-	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
-		{
-		  scan_operation_type = S_UPDATE;
-		}
-	      else
-		{
-		  scan_operation_type = S_SELECT;
-		}
-	    }
-	  /* evaluate fptr list */
-	  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
-	    {
-	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
-		{
-		  return S_ERROR;
-		}
-	      else if (xptr->proc.fetch.fetch_res == false)
-		{
-		  qualified = false;
-		}
-	    }
-	}			/* if (qualified) */
+    case TARGET_CLASS_ATTR:
+      if (scan_open_class_attr_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+				     &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
+				     curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
+				     curr_spec->s.cls_node.cls_regu_list_rest, curr_spec->s.cls_node.num_attrs_pred,
+				     curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
+				     curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
+				     curr_spec->s.cls_node.cache_rest) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      break;
 
-      if (qualified)
+    case TARGET_LIST:
+      /* open a list file scan */
+      if (scan_open_list_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+			       ACCESS_SPEC_LIST_ID (curr_spec), curr_spec->s.list_node.list_regu_list_pred,
+			       curr_spec->where_pred, curr_spec->s.list_node.list_regu_list_rest) != NO_ERROR)
 	{
-	  if (!xasl->scan_ptr)
-	    {
-	      /* no scan procedure block */
-	      return S_SUCCESS;
-	    }
-	  else
-	    {
-	      /* current scan block has at least one qualified item */
-	      xasl->curr_spec->s_id.qualified_block = true;
+	  goto exit_on_error;
+	}
+      break;
 
-	      /* start following scan procedure */
-	      xasl->scan_ptr->next_scan_on = false;
-	      if (scan_reset_scan_block (thread_p, &xasl->scan_ptr->curr_spec->s_id) == S_ERROR)
-		{
-		  return S_ERROR;
-		}
+    case TARGET_SHOWSTMT:
+      /* open a showstmt scan */
+      if (scan_open_showstmt_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+				   curr_spec->where_pred, curr_spec->s.showstmt_node.show_type,
+				   curr_spec->s.showstmt_node.arg_list) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      break;
 
-	      xasl->next_scan_on = true;
+    case TARGET_REGUVAL_LIST:
+      /* open a regu value list scan */
+      if (scan_open_values_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+				 ACCESS_SPEC_RLIST_VALPTR_LIST (curr_spec)) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      break;
 
-	      /* execute following scan procedure */
-	      xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, ignore, next_scan_fnc + 1);
-	      if (xs_scan == S_END)
-		{
-		  xasl->next_scan_on = false;
-		}
-	      else
-		{
-		  return xs_scan;
-		}
-	    }
-	}			/* if (qualified) */
+    case TARGET_SET:
+      /* open a set based derived table scan */
+      if (scan_open_set_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+			      ACCESS_SPEC_SET_PTR (curr_spec), ACCESS_SPEC_SET_REGU_LIST (curr_spec),
+			      curr_spec->where_pred) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      break;
+
+    case TARGET_METHOD:
+      if (scan_open_method_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+				 ACCESS_SPEC_METHOD_LIST_ID (curr_spec),
+				 ACCESS_SPEC_METHOD_SIG_LIST (curr_spec)) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      break;
 
+    default:
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+      goto exit_on_error;
+    }				/* switch */
+
+  s_id->scan_immediately_stop = scan_immediately_stop;
+
+  if (p_mvcc_select_lock_needed)
+    {
+      *p_mvcc_select_lock_needed = mvcc_select_lock_needed;
     }
-  while (1);
 
-}
+  return NO_ERROR;
 
-/*
- * qexec_reset_regu_variable_list () - reset value cache for a list of regu
- *				       variables
- * return : void
- * list (in) : regu variable list
- */
-static void
-qexec_reset_regu_variable_list (REGU_VARIABLE_LIST list)
-{
-  REGU_VARIABLE_LIST var = list;
+exit_on_error:
 
-  while (var != NULL)
+  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && curr_spec->parts != NULL)
     {
-      qexec_reset_regu_variable (&var->value);
-      var = var->next;
+      /* reset pruning info */
+      db_private_free (thread_p, curr_spec->parts);
+      curr_spec->parts = NULL;
+      curr_spec->curent = NULL;
+      curr_spec->pruned = false;
     }
+
+  return ER_FAILED;
 }
 
 /*
- * qexec_reset_pred_expr () - reset value cache for a pred expr
- * return : void
- * pred (in) : pred expr
+ * qexec_close_scan () -
+ *   return:
+ *   curr_spec(in)      : Access Specification Node
+ *
+ * Note: This routine is used to close the access specification node scan.
  */
 static void
-qexec_reset_pred_expr (PRED_EXPR * pred)
+qexec_close_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
 {
-  if (pred == NULL)
-    {
-      return;
-    }
-  switch (pred->type)
+  if (curr_spec)
     {
-    case T_PRED:
-      qexec_reset_pred_expr (pred->pe.pred.lhs);
-      qexec_reset_pred_expr (pred->pe.pred.rhs);
-      break;
-    case T_EVAL_TERM:
-      switch (pred->pe.eval_term.et_type)
+      /* monitoring */
+      switch (curr_spec->type)
 	{
-	case T_COMP_EVAL_TERM:
-	  {
-	    COMP_EVAL_TERM *et_comp = &pred->pe.eval_term.et.et_comp;
-
-	    qexec_reset_regu_variable (et_comp->lhs);
-	    qexec_reset_regu_variable (et_comp->rhs);
-	  }
+	case TARGET_CLASS:
+	  if (curr_spec->access == SEQUENTIAL || curr_spec->access == SEQUENTIAL_RECORD_INFO
+	      || curr_spec->access == SEQUENTIAL_PAGE_SCAN)
+	    {
+	      mnt_qm_sscans (thread_p);
+	    }
+	  else if (IS_ANY_INDEX_ACCESS (curr_spec->access))
+	    {
+	      mnt_qm_iscans (thread_p);
+	    }
+	  if (curr_spec->parts != NULL)
+	    {
+	      /* reset pruning info */
+	      db_private_free (thread_p, curr_spec->parts);
+	      curr_spec->parts = NULL;
+	      curr_spec->curent = NULL;
+	      curr_spec->pruned = false;
+	    }
 	  break;
-	case T_ALSM_EVAL_TERM:
-	  {
-	    ALSM_EVAL_TERM *et_alsm = &pred->pe.eval_term.et.et_alsm;
-
-	    qexec_reset_regu_variable (et_alsm->elem);
-	    qexec_reset_regu_variable (et_alsm->elemset);
-	  }
+	case TARGET_CLASS_ATTR:
 	  break;
-	case T_LIKE_EVAL_TERM:
-	  {
-	    LIKE_EVAL_TERM *et_like = &pred->pe.eval_term.et.et_like;
-
-	    qexec_reset_regu_variable (et_like->src);
-	    qexec_reset_regu_variable (et_like->pattern);
-	    qexec_reset_regu_variable (et_like->esc_char);
-	  }
+	case TARGET_LIST:
+	  mnt_qm_lscans (thread_p);
+	  break;
+	case TARGET_SHOWSTMT:
+	  /* do nothing */
+	  break;
+	case TARGET_REGUVAL_LIST:
+	  /* currently do nothing */
+	  break;
+	case TARGET_SET:
+	  mnt_qm_setscans (thread_p);
+	  break;
+	case TARGET_METHOD:
+	  mnt_qm_methscans (thread_p);
 	  break;
-	case T_RLIKE_EVAL_TERM:
-	  {
-	    RLIKE_EVAL_TERM *et_rlike = &pred->pe.eval_term.et.et_rlike;
-	    qexec_reset_regu_variable (et_rlike->case_sensitive);
-	    qexec_reset_regu_variable (et_rlike->pattern);
-	    qexec_reset_regu_variable (et_rlike->src);
-	  }
 	}
-      break;
-    case T_NOT_TERM:
-      qexec_reset_pred_expr (pred->pe.not_term);
-      break;
+      scan_close_scan (thread_p, &curr_spec->s_id);
     }
 }
 
 /*
- * qexec_reset_regu_variable () - reset the cache for a regu variable
- * return : void
- * var (in) : regu variable
+ * qexec_end_scan () -
+ *   return:
+ *   curr_spec(in)      : Access Specification Node
+ *
+ * Note: This routine is used to end the access specification node scan.
+ *
+ * Note: This routine is called for ERROR CASE scan end operation.
  */
 static void
-qexec_reset_regu_variable (REGU_VARIABLE * var)
+qexec_end_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
 {
-  if (var == NULL)
+  if (curr_spec)
     {
-      return;
+      scan_end_scan (thread_p, &curr_spec->s_id);
     }
-
-  switch (var->type)
-    {
-    case TYPE_ATTR_ID:
-    case TYPE_SHARED_ATTR_ID:
-    case TYPE_CLASS_ATTR_ID:
-      var->value.attr_descr.cache_dbvalp = NULL;
-      break;
-    case TYPE_INARITH:
-    case TYPE_OUTARITH:
-      qexec_reset_regu_variable (var->value.arithptr->leftptr);
-      qexec_reset_regu_variable (var->value.arithptr->rightptr);
-      qexec_reset_regu_variable (var->value.arithptr->thirdptr);
-      /* use arithptr */
-      break;
-    case TYPE_FUNC:
-      /* use funcp */
-      qexec_reset_regu_variable_list (var->value.funcp->operand);
-      break;
-    default:
-      break;
-    }
-}
+}
 
 /*
- * qexec_prune_spec () - perform partition pruning on an access spec
- * return : error code or NO_ERROR
- * thread_p (in) :
- * spec (in) :
- * vd (in) :
- * scan_op_type (in) :
+ * qexec_next_merge_block () -
+ *   return:
+ *   spec(in)   :
  */
-static int
-qexec_prune_spec (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec, VAL_DESCR * vd, SCAN_OPERATION_TYPE scan_op_type)
+static SCAN_CODE
+qexec_next_merge_block (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE ** spec)
 {
-  PARTITION_SPEC_TYPE *partition_spec = NULL;
-  LOCK lock = NULL_LOCK;
-  int granted;
-  int error = NO_ERROR;
+  SCAN_CODE sb_scan;
 
-  if (spec == NULL || spec->pruned)
-    {
-      return NO_ERROR;
-    }
-  else if (spec->pruning_type != DB_PARTITIONED_CLASS)
+  if (scan_start_scan (thread_p, &(*spec)->s_id) != NO_ERROR)
     {
-      spec->pruned = true;
-      return NO_ERROR;
+      return S_ERROR;
     }
 
-  error = partition_prune_spec (thread_p, vd, spec);
-  if (error != NO_ERROR)
+  do
     {
-      return error;
-    }
+      sb_scan = scan_next_scan_block (thread_p, &(*spec)->s_id);
+      if (sb_scan == S_SUCCESS)
+	{
+	  return S_SUCCESS;
+	}
+      else if (sb_scan == S_END)
+	{
+	  /* close old scan */
+	  scan_end_scan (thread_p, &(*spec)->s_id);
 
-  if (!COMPOSITE_LOCK (scan_op_type) && !(spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE))
-    {
-      lock = IS_LOCK;
-    }
-  else
-    {
-      /* MVCC use IX_LOCK on class at update/delete */
-      lock = IX_LOCK;
-    }
+	  /* move to the following access specifications left */
+	  *spec = (*spec)->next;
 
-  for (partition_spec = spec->parts; partition_spec != NULL; partition_spec = partition_spec->next)
-    {
-      granted = lock_subclass (thread_p, &partition_spec->oid, &ACCESS_SPEC_CLS_OID (spec), lock, LK_UNCOND_LOCK);
-      if (granted != LK_GRANTED)
+	  /* check for and skip the case of empty heap files */
+	  while (*spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (*spec))
+	    {
+	      *spec = (*spec)->next;
+	    }
+
+	  if (*spec == NULL)
+	    {
+	      return S_END;
+	    }
+
+	  /* initialize scan */
+	  if (scan_start_scan (thread_p, &(*spec)->s_id) != NO_ERROR)
+	    {
+	      return S_ERROR;
+	    }
+	}
+      else
 	{
-	  assert (er_errid () != NO_ERROR);
-	  error = er_errid ();
-	  return ((error != NO_ERROR) ? error : ER_FAILED);
+	  return S_ERROR;
 	}
-    }
 
-  return NO_ERROR;
+    }
+  while (1);
 }
 
 /*
- * qexec_init_next_partition () - move to the next partition in the list
- * return : S_END if there are no more partitions, S_SUCCESS on success,
- *	    S_ERROR on error
- * thread_p (in) :
- * spec (in)	 : spec for which to move to the next partition
+ * qexec_next_scan_block () -
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   xasl(in)   : XASL Tree pointer
+ *
+ * Note: This function is used to move the current access specification
+ * node scan identifier for the given XASL block to the next
+ * scan block. If there are no more scan blocks for the current
+ * access specfication node, it moves to the next access
+ * specification, if any, and starts the new scan block for that
+ * node. If there are no more access specification nodes left,
+ * it returns S_END.
  */
 static SCAN_CODE
-qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
+qexec_next_scan_block (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
 {
-  SCAN_CODE scode = S_END;
-  int error = NO_ERROR;
-  SCAN_OPERATION_TYPE scan_op_type = spec->s_id.scan_op_type;
-  int mvcc_select_lock_needed = spec->s_id.mvcc_select_lock_needed;
-  int fixed = spec->s_id.fixed;
-  int grouped = spec->s_id.grouped;
-  QPROC_SINGLE_FETCH single_fetch = spec->s_id.single_fetch;
-  VAL_LIST *val_list = spec->s_id.val_list;
-  VAL_DESCR *vd = spec->s_id.vd;
-  bool iscan_oid_order = spec->s_id.s.isid.iscan_oid_order;
-  INDX_INFO *idxptr = NULL;
-  QUERY_ID query_id = spec->s_id.s.isid.indx_cov.query_id;
-  OID class_oid;
-  HFID class_hfid;
-  INDX_ID index_id;
-
-  if (spec->type != TARGET_CLASS && spec->type != TARGET_CLASS_ATTR)
-    {
-      return S_END;
-    }
+  SCAN_CODE sb_scan;
+  OID *class_oid;
+  HFID *class_hfid;
 
-  if (spec->parts == NULL)
+  if (xasl->curr_spec == NULL)
     {
-      return S_END;
-    }
+      /* initialize scan id */
+      xasl->curr_spec = xasl->spec_list;
 
-  if (spec->curent == NULL)
-    {
-      spec->curent = spec->parts;
-    }
-  else
-    {
-      if (spec->curent->next == NULL)
+      /* check for and skip the case of empty heap file cases */
+      while (xasl->curr_spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (xasl->curr_spec))
 	{
-	  /* no more partitions */
-	  spec->curent = NULL;
+	  xasl->curr_spec = xasl->curr_spec->next;
 	}
-      else
+
+      if (xasl->curr_spec == NULL)
 	{
-	  spec->curent = spec->curent->next;
+	  return S_END;
 	}
-    }
-  /* close current scan and open a new one on the next partition */
-  scan_end_scan (thread_p, &spec->s_id);
-  scan_close_scan (thread_p, &spec->s_id);
 
-  /* we also need to reset caches for attributes */
-  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_pred);
-  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_rest);
-  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_key);
-  qexec_reset_pred_expr (spec->where_pred);
-  qexec_reset_pred_expr (spec->where_key);
+      assert (xasl->curr_spec != NULL);
 
-  if (spec->curent == NULL)
-    {
-      /* reset back to root class */
-      COPY_OID (&class_oid, &ACCESS_SPEC_CLS_OID (spec));
-      HFID_COPY (&class_hfid, &ACCESS_SPEC_HFID (spec));
-      if (IS_ANY_INDEX_ACCESS (spec->access))
+      /* initialize scan */
+      if ((xasl->curr_spec->type == TARGET_CLASS || xasl->curr_spec->type == TARGET_CLASS_ATTR)
+	  && xasl->curr_spec->parts != NULL && xasl->curr_spec->curent == NULL
+	  && xasl->curr_spec->access != INDEX_NODE_INFO)
 	{
-	  index_id = spec->indx_id;
+	  /* initialize the scan_id for partitioned classes */
+	  if (xasl->curr_spec->access == SEQUENTIAL || xasl->curr_spec->access == SEQUENTIAL_RECORD_INFO)
+	    {
+	      class_oid = &xasl->curr_spec->s_id.s.hsid.cls_oid;
+	      class_hfid = &xasl->curr_spec->s_id.s.hsid.hfid;
+	    }
+	  else if (xasl->curr_spec->access == SEQUENTIAL_PAGE_SCAN)
+	    {
+	      class_oid = &xasl->curr_spec->s_id.s.hpsid.cls_oid;
+	      class_hfid = &xasl->curr_spec->s_id.s.hpsid.hfid;
+	    }
+	  else if (xasl->curr_spec->access == INDEX || xasl->curr_spec->access == INDEX_KEY_INFO)
+	    {
+	      class_oid = &xasl->curr_spec->s_id.s.isid.cls_oid;
+	      class_hfid = &xasl->curr_spec->s_id.s.isid.hfid;
+	    }
+	  else
+	    {
+	      assert (false);
+	      return S_ERROR;
+	    }
+
+	  COPY_OID (class_oid, &ACCESS_SPEC_CLS_OID (xasl->curr_spec));
+	  HFID_COPY (class_hfid, &ACCESS_SPEC_HFID (xasl->curr_spec));
 	}
-    }
-  else
-    {
-      COPY_OID (&class_oid, &spec->curent->oid);
-      HFID_COPY (&class_hfid, &spec->curent->hfid);
-      if (IS_ANY_INDEX_ACCESS (spec->access))
+
+      if (scan_start_scan (thread_p, &xasl->curr_spec->s_id) != NO_ERROR)
 	{
-	  index_id = spec->curent->indx_id;
+	  return S_ERROR;
 	}
     }
-  if (spec->type == TARGET_CLASS && (spec->access == SEQUENTIAL || spec->access == SEQUENTIAL_RECORD_INFO))
+
+  do
     {
-      HEAP_SCAN_ID *hsidp = &spec->s_id.s.hsid;
-      SCAN_TYPE scan_type = (spec->access == SEQUENTIAL) ? S_HEAP_SCAN : S_HEAP_SCAN_RECORD_INFO;
-      int i = 0;
-      if (hsidp->caches_inited)
+      sb_scan = scan_next_scan_block (thread_p, &xasl->curr_spec->s_id);
+      if (sb_scan == S_SUCCESS)
 	{
-	  heap_attrinfo_end (thread_p, hsidp->pred_attrs.attr_cache);
-	  heap_attrinfo_end (thread_p, hsidp->rest_attrs.attr_cache);
-	  if (hsidp->cache_recordinfo != NULL)
+	  return S_SUCCESS;
+	}
+      else if (sb_scan == S_END)
+	{
+	  /* if curr_spec is a partitioned class, do not move to the next spec unless we went through all partitions */
+	  SCAN_CODE s_parts = qexec_init_next_partition (thread_p, xasl->curr_spec);
+	  if (s_parts == S_SUCCESS)
 	    {
-	      for (i = 0; i < HEAP_RECORD_INFO_COUNT; i++)
-		{
-		  db_value_clear (hsidp->cache_recordinfo[i]);
-		}
+	      /* successfully moved to the next partition */
+	      continue;
+	    }
+	  else if (s_parts == S_ERROR)
+	    {
+	      return S_ERROR;
 	    }
-	  hsidp->caches_inited = false;
-	}
-      hsidp->scancache_inited = false;
 
-      error =
-	scan_open_heap_scan (thread_p, &spec->s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped, single_fetch,
-			     spec->s_dbval, val_list, vd, &class_oid, &class_hfid, spec->s.cls_node.cls_regu_list_pred,
-			     spec->where_pred, spec->s.cls_node.cls_regu_list_rest,
-			     spec->s.cls_node.num_attrs_pred, spec->s.cls_node.attrids_pred,
-			     spec->s.cls_node.cache_pred, spec->s.cls_node.num_attrs_rest,
-			     spec->s.cls_node.attrids_rest, spec->s.cls_node.cache_rest,
-			     scan_type, spec->s.cls_node.cache_reserved, spec->s.cls_node.cls_regu_list_reserved);
-    }
-  else if (spec->type == TARGET_CLASS && spec->access == SEQUENTIAL_PAGE_SCAN)
-    {
-      HEAP_PAGE_SCAN_ID *hpsidp = &spec->s_id.s.hpsid;
-      SCAN_TYPE scan_type = S_HEAP_PAGE_SCAN;
-      int i = 0;
+	  /* close old scan */
+	  scan_end_scan (thread_p, &xasl->curr_spec->s_id);
 
-      if (hpsidp->cache_page_info != NULL)
-	{
-	  for (i = 0; i < HEAP_PAGE_INFO_COUNT; i++)
+	  /* move to the following access specifications left */
+	  xasl->curr_spec = xasl->curr_spec->next;
+
+	  /* check for and skip the case of empty heap files */
+	  while (xasl->curr_spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (xasl->curr_spec))
 	    {
-	      db_value_clear (hpsidp->cache_page_info[i]);
+	      xasl->curr_spec = xasl->curr_spec->next;
 	    }
-	}
-      error =
-	scan_open_heap_page_scan (thread_p, &spec->s_id, val_list, vd, &class_oid, &class_hfid, spec->where_pred,
-				  scan_type, spec->s.cls_node.cache_reserved, spec->s.cls_node.cls_regu_list_reserved);
-    }
-  else if (spec->type == TARGET_CLASS && spec->access == INDEX)
-    {
-      INDX_SCAN_ID *isidp = &spec->s_id.s.isid;
-      if (isidp->caches_inited)
-	{
-	  if (isidp->range_pred.regu_list)
+
+	  if (xasl->curr_spec == NULL)
 	    {
-	      heap_attrinfo_end (thread_p, isidp->range_attrs.attr_cache);
+	      return S_END;
 	    }
-	  if (isidp->key_pred.regu_list)
+
+	  /* initialize scan */
+	  if (scan_start_scan (thread_p, &xasl->curr_spec->s_id) != NO_ERROR)
 	    {
-	      heap_attrinfo_end (thread_p, isidp->key_attrs.attr_cache);
+	      return S_ERROR;
 	    }
-	  heap_attrinfo_end (thread_p, isidp->pred_attrs.attr_cache);
-	  heap_attrinfo_end (thread_p, isidp->rest_attrs.attr_cache);
-	  isidp->caches_inited = false;
 	}
-      idxptr = spec->indexptr;
-      idxptr->indx_id = index_id;
-      spec->s_id.s.isid.scancache_inited = false;
-      spec->s_id.s.isid.caches_inited = false;
-
-      error =
-	scan_open_index_scan (thread_p, &spec->s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
-			      single_fetch, spec->s_dbval, val_list, vd, idxptr, &class_oid, &class_hfid,
-			      spec->s.cls_node.cls_regu_list_key, spec->where_key, spec->s.cls_node.cls_regu_list_pred,
-			      spec->where_pred, spec->s.cls_node.cls_regu_list_rest, spec->where_range,
-			      spec->s.cls_node.cls_regu_list_range,
-			      spec->s.cls_node.cls_output_val_list, spec->s.cls_node.cls_regu_val_list,
-			      spec->s.cls_node.num_attrs_key, spec->s.cls_node.attrids_key, spec->s.cls_node.cache_key,
-			      spec->s.cls_node.num_attrs_pred, spec->s.cls_node.attrids_pred,
-			      spec->s.cls_node.cache_pred, spec->s.cls_node.num_attrs_rest,
-			      spec->s.cls_node.attrids_rest, spec->s.cls_node.cache_rest,
-			      spec->s.cls_node.num_attrs_range, spec->s.cls_node.attrids_range,
-			      spec->s.cls_node.cache_range, iscan_oid_order, query_id);
-
-    }
-  else if (spec->type == TARGET_CLASS_ATTR)
-    {
-      if (spec->s_id.s.hsid.caches_inited)
+      else
 	{
-	  heap_attrinfo_end (thread_p, spec->s_id.s.hsid.pred_attrs.attr_cache);
-	  heap_attrinfo_end (thread_p, spec->s_id.s.hsid.rest_attrs.attr_cache);
-	  spec->s_id.s.hsid.caches_inited = false;
+	  return S_ERROR;
 	}
-
-      error =
-	scan_open_class_attr_scan (thread_p, &spec->s_id, grouped, spec->single_fetch, spec->s_dbval, val_list, vd,
-				   &class_oid, &class_hfid, spec->s.cls_node.cls_regu_list_pred, spec->where_pred,
-				   spec->s.cls_node.cls_regu_list_rest, spec->s.cls_node.num_attrs_pred,
-				   spec->s.cls_node.attrids_pred, spec->s.cls_node.cache_pred,
-				   spec->s.cls_node.num_attrs_rest, spec->s.cls_node.attrids_rest,
-				   spec->s.cls_node.cache_rest);
-    }
-  if (error != NO_ERROR)
-    {
-      return S_ERROR;
-    }
-
-  if (spec->curent == NULL)
-    {
-      return S_END;
     }
+  while (1);
 
-  error = scan_start_scan (thread_p, &spec->s_id);
-  if (error != NO_ERROR)
-    {
-      return S_ERROR;
-    }
-  return S_SUCCESS;
 }
 
 /*
- * qexec_intprt_fnc () -
- *   return: scan code
+ * qexec_next_scan_block_iterations () -
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
  *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL Tree state information
- *   tplrec(out) : Tuple record descriptor to store result tuples
- *   next_scan_fnc(in)  : Function to interpret following XASL scan block
  *
- * Note: This function is the main function used to interpret an XASL
- * tree block. That is, it assumes a general format XASL block
- * with all possible representations.
  */
 static SCAN_CODE
-qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * tplrec,
-		  XASL_SCAN_FNC_PTR next_scan_fnc)
+qexec_next_scan_block_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
 {
-  XASL_NODE *xptr;
+  SCAN_CODE sb_next;
   SCAN_CODE xs_scan;
-  SCAN_CODE xb_scan;
-  SCAN_CODE ls_scan;
-  DB_LOGICAL ev_res;
-  int qualified;
-  AGGREGATE_TYPE *agg_ptr;
-  bool count_star_with_iscan_opt = false;
-  SCAN_OPERATION_TYPE scan_operation_type;
+  SCAN_CODE xs_scan2;
+  XASL_NODE *last_xptr;
+  XASL_NODE *prev_xptr;
+  XASL_NODE *xptr2, *xptr3;
 
-  if (xasl->type == BUILDVALUE_PROC)
+  /* first find the last scan block to be moved */
+  for (last_xptr = xasl; last_xptr->scan_ptr; last_xptr = last_xptr->scan_ptr)
     {
-      BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
-      if (buildvalue->agg_list != NULL)
+      if (!last_xptr->next_scan_block_on
+	  || (last_xptr->curr_spec && last_xptr->curr_spec->s_id.status == S_STARTED
+	      && !last_xptr->curr_spec->s_id.qualified_block))
 	{
-	  int error = NO_ERROR;
-	  bool is_scan_needed = false;
-	  if (!buildvalue->is_always_false)
-	    {
-	      error =
-		qexec_evaluate_aggregates_optimize (thread_p, buildvalue->agg_list, xasl->spec_list, &is_scan_needed);
-	      if (error != NO_ERROR)
-		{
-		  is_scan_needed = true;
-		}
-	    }
-
-	  if (prm_get_bool_value (PRM_ID_OPTIMIZER_ENABLE_AGGREGATE_OPTIMIZATION) == false)
-	    {
-	      is_scan_needed = true;
-	    }
+	  break;
+	}
+    }
 
-	  if (!is_scan_needed)
-	    {
-	      return S_SUCCESS;
-	    }
+  /* move the last scan block and reset further scans */
 
-	  agg_ptr = buildvalue->agg_list;
-	  if (!xasl->scan_ptr	/* no scan procedure */
-	      && !xasl->fptr_list	/* no path expressions */
-	      && !xasl->if_pred	/* no if predicates */
-	      && !xasl->instnum_pred	/* no instnum predicate */
-	      && agg_ptr->next == NULL	/* no other aggregate functions */
-	      && agg_ptr->function == PT_COUNT_STAR)
+  /* if there are no qualified items in the current scan block, this scan block will make no contribution with other
+   * possible scan block combinations from following classes. Thus, directly move to the next scan block in this class. */
+  if (last_xptr->curr_spec && last_xptr->curr_spec->s_id.status == S_STARTED
+      && !last_xptr->curr_spec->s_id.qualified_block)
+    {
+      if ((xs_scan = qexec_next_scan_block (thread_p, last_xptr)) == S_END)
+	{
+	  /* close following scan procedures if they are still active */
+	  for (xptr2 = last_xptr; xptr2; xptr2 = xptr2->scan_ptr)
 	    {
-	      /* only one count(*) function */
-	      ACCESS_SPEC_TYPE *specp = xasl->spec_list;
-	      if (specp->next == NULL && specp->access == INDEX && specp->s.cls_node.cls_regu_list_pred == NULL
-		  && specp->where_pred == NULL && !specp->indexptr->use_iss && !SCAN_IS_INDEX_MRO (&specp->s_id.s.isid)
-		  && !SCAN_IS_INDEX_COVERED (&specp->s_id.s.isid))
+	      if (xptr2->scan_ptr && xptr2->next_scan_block_on)
 		{
-		  /* count(*) query will scan an index but does not have a data-filter */
-		  specp->s_id.s.isid.need_count_only = true;
-		  count_star_with_iscan_opt = true;
+		  if (xptr2->scan_ptr->curr_spec)
+		    {
+		      scan_end_scan (thread_p, &xptr2->scan_ptr->curr_spec->s_id);
+		    }
+		  xptr2->scan_ptr->curr_spec->curent = NULL;
+		  xptr2->scan_ptr->curr_spec = NULL;
+		  xptr2->next_scan_block_on = false;
 		}
 	    }
 	}
-    }
-  else if (xasl->type == BUILDLIST_PROC)
-    {
-      /* If it is BUILDLIST, do not optimize aggregation */
-      if (xasl->proc.buildlist.g_agg_list != NULL)
+      else if (xs_scan == S_ERROR)
 	{
-	  for (agg_ptr = xasl->proc.buildlist.g_agg_list; agg_ptr; agg_ptr = agg_ptr->next)
-	    {
-	      agg_ptr->flag_agg_optimize = false;
-	    }
+	  return S_ERROR;
 	}
     }
-
-  while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
-    {
-      while ((ls_scan = scan_next_scan (thread_p, &xasl->curr_spec->s_id)) == S_SUCCESS)
+  else if ((xs_scan = qexec_next_scan_block (thread_p, last_xptr)) == S_SUCCESS)
+    {				/* reset all the futher scans */
+      for (xptr2 = last_xptr; xptr2; xptr2 = xptr2->scan_ptr)
 	{
-	  if (count_star_with_iscan_opt)
-	    {
-	      xasl->proc.buildvalue.agg_list->accumulator.curr_cnt += (&xasl->curr_spec->s_id)->s.isid.oids_count;
-	      /* may have more scan ranges */
-	      continue;
-	    }
-	  /* set scan item as qualified */
-	  qualified = true;
-
-	  if (xasl->bptr_list)
+	  if (xptr2->scan_ptr)
 	    {
-	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
+	      sb_next = qexec_next_scan_block (thread_p, xptr2->scan_ptr);
+	      if (sb_next == S_SUCCESS)
 		{
-		  scan_operation_type = S_UPDATE;
+		  xptr2->next_scan_block_on = true;
 		}
-	      else
+	      else if (sb_next == S_END)
 		{
-		  scan_operation_type = S_SELECT;
+		  /* close all preceding scan procedures and return */
+		  for (xptr3 = xasl; xptr3 && xptr3 != xptr2->scan_ptr; xptr3 = xptr3->scan_ptr)
+		    {
+		      if (xptr3->curr_spec)
+			{
+			  scan_end_scan (thread_p, &xptr3->curr_spec->s_id);
+			}
+		      xptr3->curr_spec->curent = NULL;
+		      xptr3->curr_spec = NULL;
+		      xptr3->next_scan_block_on = false;
+		    }
+		  return S_END;
 		}
-	    }
-
-	  /* evaluate bptr list */
-	  /* if path expression fetch fails, this instance disqualifies */
-	  for (xptr = xasl->bptr_list; qualified && xptr != NULL; xptr = xptr->next)
-	    {
-	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
+	      else
 		{
 		  return S_ERROR;
 		}
-	      else if (xptr->proc.fetch.fetch_res == false)
-		{
-		  qualified = false;
-		}
 	    }
+	}
+    }
+  else if (xs_scan == S_ERROR)
+    {
+      return S_ERROR;
+    }
 
-	  if (qualified)
-	    {
-	      /* evaluate dptr list */
-	      for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
-		{
-		  /* clear correlated subquery list files */
-		  qexec_clear_head_lists (thread_p, xptr);
-		  if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
-		    {
-		      /* skip if linked to regu var */
-		      continue;
-		    }
-		  if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
-		    {
-		      return S_ERROR;
-		    }
-		}
+  /* now move backwards, resetting all the previous scans */
+  while (last_xptr != xasl)
+    {
 
-	      /* evaluate after join predicate */
-	      ev_res = V_UNKNOWN;
-	      if (xasl->after_join_pred != NULL)
-		{
-		  ev_res = eval_pred (thread_p, xasl->after_join_pred, &xasl_state->vd, NULL);
-		  if (ev_res == V_ERROR)
-		    {
-		      return S_ERROR;
-		    }
-		}
-	      qualified = (xasl->after_join_pred == NULL || ev_res == V_TRUE);
+      /* find the previous to last xptr */
+      for (prev_xptr = xasl; prev_xptr->scan_ptr != last_xptr; prev_xptr = prev_xptr->scan_ptr)
+	;
 
-	      if (qualified)
-		{
-		  /* evaluate if predicate */
-		  ev_res = V_UNKNOWN;
-		  if (xasl->if_pred != NULL)
-		    {
-		      ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
-		      if (ev_res == V_ERROR)
-			{
-			  return S_ERROR;
-			}
-		    }
-		  qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
-		}
+      /* set previous scan according to the last scan status */
+      if (last_xptr->curr_spec == NULL)
+	{			/* last scan ended */
+	  prev_xptr->next_scan_block_on = false;
 
-	      if (qualified)
+	  /* move the scan block of the previous scan */
+	  xs_scan2 = qexec_next_scan_block (thread_p, prev_xptr);
+	  if (xs_scan2 == S_SUCCESS)
+	    {
+	      /* move all the further scan blocks */
+	      for (xptr2 = prev_xptr; xptr2; xptr2 = xptr2->scan_ptr)
 		{
-		  /* evaluate fptr list */
-		  if (xasl->fptr_list)
-		    {
-		      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
-			{
-			  scan_operation_type = S_UPDATE;
-			}
-		      else
-			{
-			  scan_operation_type = S_SELECT;
-			}
-		    }
-
-		  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
+		  if (xptr2->scan_ptr)
 		    {
-		      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
+		      sb_next = qexec_next_scan_block (thread_p, xptr2->scan_ptr);
+		      if (sb_next == S_SUCCESS)
 			{
-			  return S_ERROR;
+			  xptr2->next_scan_block_on = true;
 			}
-		      else if (xptr->proc.fetch.fetch_res == false)
+		      else if (sb_next == S_END)
 			{
-			  qualified = false;
-			}
-		    }
-
-		  if (qualified)
-		    {
-
-		      if (!xasl->scan_ptr)
-			{	/* no scan procedure block */
-
-			  /* if hierarchical query do special processing */
-			  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
-			    {
-			      if (qexec_update_connect_by_lists (thread_p, xasl->connect_by_ptr, xasl_state, tplrec) !=
-				  NO_ERROR)
-				{
-				  return S_ERROR;
-				}
-			    }
-			  else
+			  /* close all preceding scan procedures and return */
+			  for (xptr3 = xasl; xptr3 && xptr3 != xptr2->scan_ptr; xptr3 = xptr3->scan_ptr)
 			    {
-			      /* evaluate inst_num predicate */
-			      if (xasl->instnum_val)
-				{
-				  ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
-				  if (ev_res == V_ERROR)
-				    {
-				      return S_ERROR;
-				    }
-
-
-				  if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_LAST_STOP))
-				    {
-				      if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
-					{
-					  return S_ERROR;
-					}
-
-				      return S_SUCCESS;
-				    }
-
-				  if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP))
-				    {
-				      return S_SUCCESS;
-				    }
-				}
-			      qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
-			      if (qualified
-				  && (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR))
+			      if (xptr3->curr_spec)
 				{
-				  return S_ERROR;
+				  scan_end_scan (thread_p, &xptr3->curr_spec->s_id);
 				}
+			      xptr3->curr_spec->curent = NULL;
+			      xptr3->curr_spec = NULL;
+			      xptr3->next_scan_block_on = false;
 			    }
-
+			  return S_END;
 			}
 		      else
-			{	/* handle the scan procedure */
-			  /* current scan block has at least one qualified item */
-			  xasl->curr_spec->s_id.qualified_block = true;
-
-			  /* handle the scan procedure */
-			  xasl->scan_ptr->next_scan_on = false;
-			  if (scan_reset_scan_block (thread_p, &xasl->scan_ptr->curr_spec->s_id) == S_ERROR)
-			    {
-			      return S_ERROR;
-			    }
-
-			  xasl->next_scan_on = true;
-
-
-			  while ((xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, tplrec,
-							      next_scan_fnc + 1)) == S_SUCCESS)
-			    {
-
-			      /* if hierarchical query do special processing */
-			      if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
-				{
-				  if (qexec_update_connect_by_lists (thread_p, xasl->connect_by_ptr, xasl_state, tplrec)
-				      != NO_ERROR)
-				    {
-				      return S_ERROR;
-				    }
-				}
-			      else
-				{
-				  /* evaluate inst_num predicate */
-				  if (xasl->instnum_val)
-				    {
-				      ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
-				      if (ev_res == V_ERROR)
-					{
-					  return S_ERROR;
-					}
-
-				      if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_LAST_STOP))
-					{
-					  if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
-					    {
-					      return S_ERROR;
-					    }
-
-					  return S_SUCCESS;
-					}
-
-				      if (xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP)
-					{
-					  return S_SUCCESS;
-					}
-				    }
-				  qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
-
-				  if (qualified
-				      /* one iteration successfully completed */
-				      && qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
-				    {
-				      return S_ERROR;
-				    }
-				}
-
-			    }
-
-			  if (xs_scan != S_END)	/* an error happened */
-			    {
-			      return S_ERROR;
-			    }
+			{
+			  return S_ERROR;
 			}
 		    }
 		}
 	    }
+	  else if (xs_scan2 == S_ERROR)
+	    {
+	      return S_ERROR;
+	    }
 
-	  qexec_clear_all_lists (thread_p, xasl);
 	}
-
-      if (ls_scan != S_END)	/* an error happened */
+      else			/* last scan successfully moved */
 	{
-	  return S_ERROR;
+	  if (scan_reset_scan_block (thread_p, &prev_xptr->curr_spec->s_id) == S_ERROR)
+	    {
+	      return S_ERROR;
+	    }
 	}
-    }
 
-  if (xb_scan != S_END)		/* an error happened */
-    {
-      return S_ERROR;
-    }
+      /* make previous scan the last scan ptr */
+      last_xptr = prev_xptr;
+    }				/* while */
 
-  return S_SUCCESS;
+  /* return the status of the first XASL block */
+  return (xasl->curr_spec) ? S_SUCCESS : S_END;
 }
 
 /*
- * qexec_merge_fnc () -
- *   return: scan code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL Tree state information
- *   tplrec(out) : Tuple record descriptor to store result tuples
+ * qexec_execute_scan () -
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   xasl(in)   : XASL Tree block
+ *   xasl_state(in)     : XASL tree state information
+ *   next_scan_fnc(in)  : Function to interpret following scan block
  *
- * Note: This function is used to interpret an XASL merge command
- * tree block. It assumes a general format XASL block
- * with all possible representations.
- */
-static SCAN_CODE
-qexec_merge_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * tplrec,
-		 XASL_SCAN_FNC_PTR ignore)
-{
-  XASL_NODE *xptr;
-  DB_LOGICAL ev_res;
-  int qualified;
-  SCAN_CODE ls_scan1;		/* first list file scan counter */
-  SCAN_CODE ls_scan2;		/* second list file scan counter */
-  SCAN_ID *s_id1;		/* first list file scan identifier */
-  SCAN_ID *s_id2;		/* second list file scan identifier */
-  ACCESS_SPEC_TYPE *spec;
-
-  /* set first scan parameters */
-  s_id1 = &xasl->spec_list->s_id;
-  /* set second scan parameters */
-  s_id2 = &xasl->merge_spec->s_id;
-
-  if ((!s_id1)
-      || ((s_id1->type == S_LIST_SCAN)
-	  && ((!s_id1->s.llsid.list_id) || (s_id1->s.llsid.list_id->type_list.type_cnt == 0))))
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
+ * Note: This routine executes one iteration on a scan operation on
+ * the given XASL tree block. If end_of_scan is reached, it
+ * return S_END. If an error occurs, it returns
+ * S_ERROR. Each scan procedure block may have its own scan
+ * procedures forming a path of scan procedure blocks. Thus, for
+ * each scan procedure block interpretation, if there are already
+ * active scan procedures started from that block, first their
+ * execution is requested. Only if all of the following scan
+ * procedures come to an end returning S_END, then the
+ * current scan procedure scan item is advanced. When this scan
+ * procedure too come to an end, it returns S_END to the
+ * caller, indicating that there are no more scan items in the
+ * path of the scan procedure blocks.
+ *
+ * Note: This function is the general scan block interpretation function.
+ */
+static SCAN_CODE
+qexec_execute_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * ignore,
+		    XASL_SCAN_FNC_PTR next_scan_fnc)
+{
+  XASL_NODE *xptr;
+  SCAN_CODE sc_scan;
+  SCAN_CODE xs_scan;
+  DB_LOGICAL ev_res;
+  int qualified;
+  SCAN_OPERATION_TYPE scan_operation_type;
 
-  if ((!s_id2)
-      || ((s_id2->type == S_LIST_SCAN)
-	  && ((!s_id2->s.llsid.list_id) || (s_id2->s.llsid.list_id->type_list.type_cnt == 0))))
+  /* check if further scan procedure are still active */
+  if (xasl->scan_ptr && xasl->next_scan_on)
     {
-      GOTO_EXIT_ON_ERROR;
-    }
+      xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, ignore, next_scan_fnc + 1);
+      if (xs_scan != S_END)
+	{
+	  return xs_scan;
+	}
 
-  spec = xasl->merge_spec;
-  if (qexec_next_merge_block (thread_p, &spec) != S_SUCCESS)
-    {
-      GOTO_EXIT_ON_ERROR;
+      xasl->next_scan_on = false;
     }
 
-  while ((ls_scan1 = qexec_next_scan_block (thread_p, xasl)) == S_SUCCESS)
+  do
     {
-      while ((ls_scan1 = scan_next_scan (thread_p, s_id1)) == S_SUCCESS)
+      sc_scan = scan_next_scan (thread_p, &xasl->curr_spec->s_id);
+      if (sc_scan != S_SUCCESS)
 	{
-	  ls_scan2 = scan_next_scan (thread_p, s_id2);
-	  if (ls_scan2 == S_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
+	  return sc_scan;
+	}
 
-	  if (ls_scan2 == S_END)
+      /* set scan item as qualified */
+      qualified = true;
+
+      if (qualified)
+	{
+	  /* clear bptr subquery list files */
+	  if (xasl->bptr_list)
 	    {
-	      if (qexec_next_merge_block (thread_p, &spec) != S_SUCCESS)
+	      qexec_clear_head_lists (thread_p, xasl->bptr_list);
+	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  scan_operation_type = S_UPDATE;
 		}
-
-	      ls_scan2 = scan_next_scan (thread_p, s_id2);
-	      if (ls_scan2 == S_ERROR)
+	      else
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  scan_operation_type = S_SELECT;
 		}
 	    }
-
-	  /* set scan item as qualified */
-	  qualified = true;
-
 	  /* evaluate bptr list */
-	  /* if path expression fetch fails, this instance disqualifies */
 	  for (xptr = xasl->bptr_list; qualified && xptr != NULL; xptr = xptr->next)
 	    {
-	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, S_SELECT) != NO_ERROR)
+	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  return S_ERROR;
 		}
 	      else if (xptr->proc.fetch.fetch_res == false)
 		{
 		  qualified = false;
 		}
 	    }
+	}			/* if (qualified) */
 
-	  if (qualified)
+      if (qualified)
+	{
+	  /* evaluate dptr list */
+	  for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
 	    {
-	      /* evaluate dptr list */
-	      for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
+	      /* clear correlated subquery list files */
+	      qexec_clear_head_lists (thread_p, xptr);
+	      if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
 		{
-		  /* clear correlated subquery list files */
-		  qexec_clear_head_lists (thread_p, xptr);
-		  if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
-		    {
-		      /* skip if linked to regu var */
-		      continue;
-		    }
-		  if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
+		  /* skip if linked to regu var */
+		  continue;
 		}
-
-	      /* evaluate if predicate */
-	      ev_res = V_UNKNOWN;
-	      if (xasl->if_pred != NULL)
+	      if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
 		{
-		  ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
-		  if (ev_res == V_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
+		  return S_ERROR;
 		}
+	    }
+	}			/* if (qualified) */
 
-	      qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
-	      if (qualified)
+      if (qualified)
+	{
+	  /* evaluate after join predicate */
+	  ev_res = V_UNKNOWN;
+	  if (xasl->after_join_pred != NULL)
+	    {
+	      ev_res = eval_pred (thread_p, xasl->after_join_pred, &xasl_state->vd, NULL);
+	      if (ev_res == V_ERROR)
 		{
-		  /* evaluate fptr list */
-		  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
-		    {
-		      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, S_SELECT) != NO_ERROR)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
-		      else if (xptr->proc.fetch.fetch_res == false)
-			{
-			  qualified = false;
-			}
-		    }
+		  return S_ERROR;
+		}
+	    }
+	  qualified = (xasl->after_join_pred == NULL || ev_res == V_TRUE);
+	}			/* if (qualified) */
 
-		  if (qualified)
-		    {
-		      if (!xasl->scan_ptr)
-			{	/* no scan procedure block */
-			  /* evaluate inst_num predicate */
-			  if (xasl->instnum_val)
-			    {
-			      ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
-			      if (ev_res == V_ERROR)
-				{
-				  return S_ERROR;
-				}
-			      if (xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP)
-				{
-				  scan_end_scan (thread_p, s_id1);
-				  scan_end_scan (thread_p, s_id2);
-				  return S_SUCCESS;
-				}
-			    }	/* if (xasl->instnum_val) */
-			  qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
+      if (qualified)
+	{
+	  /* evaluate if predicate */
+	  ev_res = V_UNKNOWN;
+	  if (xasl->if_pred != NULL)
+	    {
+	      ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
+	      if (ev_res == V_ERROR)
+		{
+		  return S_ERROR;
+		}
+	    }
+	  qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
+	}			/* if (qualified) */
 
-			  if (qualified && qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
-			    {
-			      return S_ERROR;
-			    }
-			}	/* handle the scan procedure */
-		    }
+      if (qualified)
+	{
+	  /* clear fptr subquery list files */
+	  if (xasl->fptr_list)
+	    {
+	      qexec_clear_head_lists (thread_p, xasl->fptr_list);
+	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
+		{
+		  scan_operation_type = S_UPDATE;
+		}
+	      else
+		{
+		  scan_operation_type = S_SELECT;
 		}
 	    }
-	}
+	  /* evaluate fptr list */
+	  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
+	    {
+	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
+		{
+		  return S_ERROR;
+		}
+	      else if (xptr->proc.fetch.fetch_res == false)
+		{
+		  qualified = false;
+		}
+	    }
+	}			/* if (qualified) */
 
-      if (ls_scan1 == S_ERROR)
+      if (qualified)
 	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-    }
+	  if (!xasl->scan_ptr)
+	    {
+	      /* no scan procedure block */
+	      return S_SUCCESS;
+	    }
+	  else
+	    {
+	      /* current scan block has at least one qualified item */
+	      xasl->curr_spec->s_id.qualified_block = true;
 
-  if (ls_scan1 == S_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
+	      /* start following scan procedure */
+	      xasl->scan_ptr->next_scan_on = false;
+	      if (scan_reset_scan_block (thread_p, &xasl->scan_ptr->curr_spec->s_id) == S_ERROR)
+		{
+		  return S_ERROR;
+		}
 
-  scan_end_scan (thread_p, s_id1);
-  scan_end_scan (thread_p, s_id2);
-  return S_SUCCESS;
+	      xasl->next_scan_on = true;
+
+	      /* execute following scan procedure */
+	      xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, ignore, next_scan_fnc + 1);
+	      if (xs_scan == S_END)
+		{
+		  xasl->next_scan_on = false;
+		}
+	      else
+		{
+		  return xs_scan;
+		}
+	    }
+	}			/* if (qualified) */
+
+    }
+  while (1);
 
-exit_on_error:
-  scan_end_scan (thread_p, s_id1);
-  scan_end_scan (thread_p, s_id2);
-  scan_close_scan (thread_p, s_id1);
-  scan_close_scan (thread_p, s_id2);
-  return S_ERROR;
 }
 
 /*
- * qexec_setup_list_id () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree block
- *
- * Note: This routine is used by update/delete/insert to set up a
- * type_list. Copying a list_id structure fails unless it has a type list.
+ * qexec_reset_regu_variable_list () - reset value cache for a list of regu
+ *				       variables
+ * return : void
+ * list (in) : regu variable list
  */
-static int
-qexec_setup_list_id (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+static void
+qexec_reset_regu_variable_list (REGU_VARIABLE_LIST list)
 {
-  QFILE_LIST_ID *list_id;
-
-  list_id = xasl->list_id;
-  list_id->tuple_cnt = 0;
-  list_id->page_cnt = 0;
+  REGU_VARIABLE_LIST var = list;
 
-  /* For streaming queries, set last_pgptr->next_vpid to NULL */
-  if (list_id->last_pgptr != NULL)
+  while (var != NULL)
     {
-      QFILE_PUT_NEXT_VPID_NULL (list_id->last_pgptr);
+      qexec_reset_regu_variable (&var->value);
+      var = var->next;
     }
+}
 
-  list_id->last_pgptr = NULL;	/* don't want qfile_close_list() to free this bogus listid */
-  list_id->type_list.type_cnt = 1;
-  list_id->type_list.domp = (TP_DOMAIN **) malloc (list_id->type_list.type_cnt * sizeof (TP_DOMAIN *));
-  if (list_id->type_list.domp == NULL)
+/*
+ * qexec_reset_pred_expr () - reset value cache for a pred expr
+ * return : void
+ * pred (in) : pred expr
+ */
+static void
+qexec_reset_pred_expr (PRED_EXPR * pred)
+{
+  if (pred == NULL)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
-	      list_id->type_list.type_cnt * sizeof (TP_DOMAIN *));
-      return ER_OUT_OF_VIRTUAL_MEMORY;
+      return;
     }
-  /* set up to return object domains in case we want to return the updated/inserted/deleted oid's */
-  list_id->type_list.domp[0] = &tp_Object_domain;
-
-  if (xasl->type == INSERT_PROC && XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS))
+  switch (pred->type)
     {
-      list_id->tfile_vfid = qmgr_create_new_temp_file (thread_p, list_id->query_id, TEMP_FILE_MEMBUF_NORMAL);
-      if (list_id->tfile_vfid == NULL)
+    case T_PRED:
+      qexec_reset_pred_expr (pred->pe.pred.lhs);
+      qexec_reset_pred_expr (pred->pe.pred.rhs);
+      break;
+    case T_EVAL_TERM:
+      switch (pred->pe.eval_term.et_type)
 	{
-	  return ER_FAILED;
+	case T_COMP_EVAL_TERM:
+	  {
+	    COMP_EVAL_TERM *et_comp = &pred->pe.eval_term.et.et_comp;
+
+	    qexec_reset_regu_variable (et_comp->lhs);
+	    qexec_reset_regu_variable (et_comp->rhs);
+	  }
+	  break;
+	case T_ALSM_EVAL_TERM:
+	  {
+	    ALSM_EVAL_TERM *et_alsm = &pred->pe.eval_term.et.et_alsm;
+
+	    qexec_reset_regu_variable (et_alsm->elem);
+	    qexec_reset_regu_variable (et_alsm->elemset);
+	  }
+	  break;
+	case T_LIKE_EVAL_TERM:
+	  {
+	    LIKE_EVAL_TERM *et_like = &pred->pe.eval_term.et.et_like;
+
+	    qexec_reset_regu_variable (et_like->src);
+	    qexec_reset_regu_variable (et_like->pattern);
+	    qexec_reset_regu_variable (et_like->esc_char);
+	  }
+	  break;
+	case T_RLIKE_EVAL_TERM:
+	  {
+	    RLIKE_EVAL_TERM *et_rlike = &pred->pe.eval_term.et.et_rlike;
+	    qexec_reset_regu_variable (et_rlike->case_sensitive);
+	    qexec_reset_regu_variable (et_rlike->pattern);
+	    qexec_reset_regu_variable (et_rlike->src);
+	  }
 	}
-      VFID_COPY (&(list_id->temp_vfid), &(list_id->tfile_vfid->temp_vfid));
+      break;
+    case T_NOT_TERM:
+      qexec_reset_pred_expr (pred->pe.not_term);
+      break;
     }
+}
 
-#if !defined (NDEBUG)
-  assert (list_id->type_list.type_cnt == 1);
-  if (list_id->type_list.type_cnt != 0)
+/*
+ * qexec_reset_regu_variable () - reset the cache for a regu variable
+ * return : void
+ * var (in) : regu variable
+ */
+static void
+qexec_reset_regu_variable (REGU_VARIABLE * var)
+{
+  if (var == NULL)
     {
-      thread_rc_track_meter (thread_p, __FILE__, __LINE__, 1, list_id, RC_QLIST, MGR_DEF);
+      return;
     }
-#endif /* NDEBUG */
 
-  return NO_ERROR;
+  switch (var->type)
+    {
+    case TYPE_ATTR_ID:
+    case TYPE_SHARED_ATTR_ID:
+    case TYPE_CLASS_ATTR_ID:
+      var->value.attr_descr.cache_dbvalp = NULL;
+      break;
+    case TYPE_INARITH:
+    case TYPE_OUTARITH:
+      qexec_reset_regu_variable (var->value.arithptr->leftptr);
+      qexec_reset_regu_variable (var->value.arithptr->rightptr);
+      qexec_reset_regu_variable (var->value.arithptr->thirdptr);
+      /* use arithptr */
+      break;
+    case TYPE_FUNC:
+      /* use funcp */
+      qexec_reset_regu_variable_list (var->value.funcp->operand);
+      break;
+    default:
+      break;
+    }
 }
 
 /*
- * qexec_init_upddel_ehash_files () - Initializes the hash files used for
- *				       duplicate OIDs elimination.
- *   return: NO_ERROR, or ER_code
- *   thread_p(in):
- *   buildlist(in): BUILDLIST_PROC XASL
- *
- * Note: The function is used only for SELECT statement generated for
- *	 UPDATE/DELETE. The case of SINGLE-UPDATE/SINGLE-DELETE is skipped.
+ * qexec_prune_spec () - perform partition pruning on an access spec
+ * return : error code or NO_ERROR
+ * thread_p (in) :
+ * spec (in) :
+ * vd (in) :
+ * scan_op_type (in) :
  */
 static int
-qexec_init_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
+qexec_prune_spec (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec, VAL_DESCR * vd, SCAN_OPERATION_TYPE scan_op_type)
 {
-  int idx;
-  EHID *hash_list = NULL;
+  PARTITION_SPEC_TYPE *partition_spec = NULL;
+  LOCK lock = NULL_LOCK;
+  int granted;
+  int error = NO_ERROR;
 
-  if (buildlist == NULL || buildlist->type != BUILDLIST_PROC)
+  if (spec == NULL || spec->pruned)
     {
       return NO_ERROR;
     }
-
-  hash_list = db_private_alloc (thread_p, buildlist->upd_del_class_cnt * sizeof (EHID));
-  if (hash_list == NULL)
+  else if (spec->pruning_type != DB_PARTITIONED_CLASS)
     {
-      goto exit_on_error;
+      spec->pruned = true;
+      return NO_ERROR;
     }
 
-  for (idx = 0; idx < buildlist->upd_del_class_cnt; idx++)
+  error = partition_prune_spec (thread_p, vd, spec);
+  if (error != NO_ERROR)
     {
-      hash_list[idx].vfid.volid = LOG_DBFIRST_VOLID;
-      if (xehash_create (thread_p, &hash_list[idx], DB_TYPE_OBJECT, -1, NULL, 0, true) == NULL)
-	{
-	  goto exit_on_error;
-	}
+      return error;
     }
-  buildlist->proc.buildlist.upddel_oid_locator_ehids = hash_list;
 
-  return NO_ERROR;
+  if (!COMPOSITE_LOCK (scan_op_type) && !(spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE))
+    {
+      lock = IS_LOCK;
+    }
+  else
+    {
+      /* MVCC use IX_LOCK on class at update/delete */
+      lock = IX_LOCK;
+    }
 
-exit_on_error:
-  if (hash_list != NULL)
+  for (partition_spec = spec->parts; partition_spec != NULL; partition_spec = partition_spec->next)
     {
-      for (--idx; idx >= 0; idx--)
+      granted = lock_subclass (thread_p, &partition_spec->oid, &ACCESS_SPEC_CLS_OID (spec), lock, LK_UNCOND_LOCK);
+      if (granted != LK_GRANTED)
 	{
-	  xehash_destroy (thread_p, &hash_list[idx]);
+	  assert (er_errid () != NO_ERROR);
+	  error = er_errid ();
+	  return ((error != NO_ERROR) ? error : ER_FAILED);
 	}
-      db_private_free (thread_p, hash_list);
     }
 
-  return ER_FAILED;
+  return NO_ERROR;
 }
 
 /*
- * qexec_destroy_upddel_ehash_files () - Destroys the hash files used for
- *					 duplicate rows elimination in
- *					 UPDATE/DELETE.
- *   return: void
- *   thread_p(in):
- *   buildlist(in): BUILDLIST_PROC XASL
- *
- * Note: The function is used only for SELECT statement generated for
- *	 UPDATE/DELETE.
+ * qexec_init_next_partition () - move to the next partition in the list
+ * return : S_END if there are no more partitions, S_SUCCESS on success,
+ *	    S_ERROR on error
+ * thread_p (in) :
+ * spec (in)	 : spec for which to move to the next partition
  */
-static void
-qexec_destroy_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
+static SCAN_CODE
+qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
 {
-  int idx;
-  EHID *hash_list = buildlist->proc.buildlist.upddel_oid_locator_ehids;
+  SCAN_CODE scode = S_END;
+  int error = NO_ERROR;
+  SCAN_OPERATION_TYPE scan_op_type = spec->s_id.scan_op_type;
+  int mvcc_select_lock_needed = spec->s_id.mvcc_select_lock_needed;
+  int fixed = spec->s_id.fixed;
+  int grouped = spec->s_id.grouped;
+  QPROC_SINGLE_FETCH single_fetch = spec->s_id.single_fetch;
+  VAL_LIST *val_list = spec->s_id.val_list;
+  VAL_DESCR *vd = spec->s_id.vd;
+  bool iscan_oid_order = spec->s_id.s.isid.iscan_oid_order;
+  INDX_INFO *idxptr = NULL;
+  QUERY_ID query_id = spec->s_id.s.isid.indx_cov.query_id;
+  OID class_oid;
+  HFID class_hfid;
+  INDX_ID index_id;
 
-  for (idx = 0; idx < buildlist->upd_del_class_cnt; idx++)
+  if (spec->type != TARGET_CLASS && spec->type != TARGET_CLASS_ATTR)
     {
-      xehash_destroy (thread_p, &hash_list[idx]);
+      return S_END;
     }
-  db_private_free (thread_p, hash_list);
-  buildlist->proc.buildlist.upddel_oid_locator_ehids = NULL;
-}
-
-/*
- * qexec_mvcc_cond_reev_set_scan_order () - link classes for condition
- *					    reevaluation in scan order (from
- *					    outer to inner)
- *   return: list head
- *   aptr(in): XASL for generated SELECT statement for UPDATE
- *   buildlist(in): BUILDLIST_PROC XASL
- *   reev_classes(in): array of classes for reevaluation
- *   no_reev_classes(in): no of classes for reevaluation
- *   classes(in): classes to be updated
- *   no_classes(in): no of classes to be updated
- */
-static UPDDEL_MVCC_COND_REEVAL *
-qexec_mvcc_cond_reev_set_scan_order (XASL_NODE * aptr, UPDDEL_MVCC_COND_REEVAL * reev_classes, int no_reev_classes,
-				     UPDDEL_CLASS_INFO * classes, int no_classes)
-{
-  int idx, idx2, idx3;
-  ACCESS_SPEC_TYPE *access_spec = NULL;
-  UPDDEL_MVCC_COND_REEVAL *scan_elem = NULL, *scan_start = NULL;
-  int *mvcc_extra_assign_reev = NULL;
 
-  if (reev_classes == NULL || no_reev_classes <= 0)
-    {
-      return NULL;
-    }
-  for (; aptr != NULL; aptr = aptr->scan_ptr)
+  if (spec->parts == NULL)
     {
-      for (access_spec = aptr->spec_list; access_spec != NULL; access_spec = access_spec->next)
-	{
-	  for (idx = no_reev_classes - 1; idx >= 0; idx--)
-	    {
-	      if (OID_EQ (&access_spec->s.cls_node.cls_oid, &reev_classes[idx].cls_oid))
-		{
-		  /* check that this class is not an assignment reevaluation class */
-		  for (idx2 = 0; idx2 < no_classes; idx2++)
-		    {
-		      mvcc_extra_assign_reev = classes[idx2].mvcc_extra_assign_reev;
-		      for (idx3 = classes[idx2].no_extra_assign_reev - 1; idx3 >= 0; idx3--)
-			{
-			  if (mvcc_extra_assign_reev[idx3] == reev_classes[idx].class_index)
-			    {
-			      break;
-			    }
-			}
-		      if (idx3 >= 0)
-			{
-			  break;
-			}
-		    }
-		  if (idx2 < no_classes)
-		    {
-		      continue;
-		    }
-
-		  /* if this class is not an assignment reevaluation class then add to the list */
-		  if (scan_elem == NULL)
-		    {
-		      scan_elem = scan_start = &reev_classes[idx];
-		    }
-		  else
-		    {
-		      scan_elem->next = &reev_classes[idx];
-		      scan_elem = scan_elem->next;
-		    }
-		  break;
-		}
-	    }
-	  if (idx >= 0)
-	    {
-	      break;
-	    }
-	}
+      return S_END;
     }
 
-  return scan_start;
-}
-
-/*
- * prepare_mvcc_reev_data () - create and initialize structures for MVCC
- *			       condition and assignments reevaluation
- * return : error code or NO_ERROR
- * thread_p (in) :
- * aptr (in): XASL for generated SELECT statement for UPDATE
- * no_reev_classes (in): no of indexes for classes used in reevaluation
- * mvcc_reev_indexes (in) : array of indexes for classes used in reevaluation
- * reev_data (in) : MVCC reevaluation data for a specific class
- * no_classes (in) : no. of assignments 'classes' elements
- * classes(in): array of classes to be updated
- * internal_classes (in) : array of information for each class that will be
- *			   updated
- * cons_pred(in): NOT NULL contraints predicate
- * mvcc_reev_classes(in/out): array of classes information used in MVCC
- *			      reevaluation
- * mvcc_reev_assigns(in/out): array of assignments information used in
- *			      reevaluation
- * has_delete (in):
- */
-static int
-prepare_mvcc_reev_data (THREAD_ENTRY * thread_p, XASL_NODE * aptr, XASL_STATE * xasl_state, int no_reev_classes,
-			int *mvcc_reev_indexes, MVCC_UPDDEL_REEV_DATA * reev_data, int no_classes,
-			UPDDEL_CLASS_INFO * classes, UPDDEL_CLASS_INFO_INTERNAL * internal_classes, int no_assigns,
-			UPDATE_ASSIGNMENT * assigns, PRED_EXPR * cons_pred,
-			UPDDEL_MVCC_COND_REEVAL ** mvcc_reev_classes, UPDATE_MVCC_REEV_ASSIGNMENT ** mvcc_reev_assigns,
-			bool has_delete)
-{
-  UPDDEL_MVCC_COND_REEVAL *cond_reev_classes = NULL, *cond_reev_class = NULL;
-  UPDDEL_CLASS_INFO *cls = NULL;
-  UPDDEL_CLASS_INFO_INTERNAL *int_cls = NULL;
-  int idx, idx2, idx3;
-
-  if (reev_data == NULL)
+  if (spec->curent == NULL)
     {
-      assert (0);
-      return ER_FAILED;
+      spec->curent = spec->parts;
     }
-
-  /* Make sure reev data is initialized, or else it will crash later */
-  memset (reev_data, 0, sizeof (MVCC_UPDDEL_REEV_DATA));
-
-  if (no_reev_classes == 0)
+  else
     {
-      return NO_ERROR;
+      if (spec->curent->next == NULL)
+	{
+	  /* no more partitions */
+	  spec->curent = NULL;
+	}
+      else
+	{
+	  spec->curent = spec->curent->next;
+	}
     }
+  /* close current scan and open a new one on the next partition */
+  scan_end_scan (thread_p, &spec->s_id);
+  scan_close_scan (thread_p, &spec->s_id);
 
-  if (mvcc_reev_classes == NULL)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
+  /* we also need to reset caches for attributes */
+  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_pred);
+  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_rest);
+  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_key);
+  qexec_reset_pred_expr (spec->where_pred);
+  qexec_reset_pred_expr (spec->where_key);
 
-  /* allocate and initialize classes for reevaluation */
-  cond_reev_classes = db_private_alloc (thread_p, sizeof (UPDDEL_MVCC_COND_REEVAL) * no_reev_classes);
-  if (cond_reev_classes == NULL)
+  if (spec->curent == NULL)
     {
-      GOTO_EXIT_ON_ERROR;
+      /* reset back to root class */
+      COPY_OID (&class_oid, &ACCESS_SPEC_CLS_OID (spec));
+      HFID_COPY (&class_hfid, &ACCESS_SPEC_HFID (spec));
+      if (IS_ANY_INDEX_ACCESS (spec->access))
+	{
+	  index_id = spec->indx_id;
+	}
     }
-  /* init information for reevaluation */
-  for (idx = 0; idx < no_reev_classes; idx++)
+  else
     {
-      cond_reev_class = &cond_reev_classes[idx];
-      cond_reev_class->class_index = mvcc_reev_indexes[idx];
-      OID_SET_NULL (&cond_reev_class->cls_oid);
-      cond_reev_class->inst_oid = NULL;
-      cond_reev_class->rest_attrs = NULL;
-      cond_reev_class->rest_regu_list = NULL;
-      cond_reev_class->next = NULL;
+      COPY_OID (&class_oid, &spec->curent->oid);
+      HFID_COPY (&class_hfid, &spec->curent->hfid);
+      if (IS_ANY_INDEX_ACCESS (spec->access))
+	{
+	  index_id = spec->curent->indx_id;
+	}
     }
-  for (idx = 0; idx < no_classes; idx++)
+  if (spec->type == TARGET_CLASS && (spec->access == SEQUENTIAL || spec->access == SEQUENTIAL_RECORD_INFO))
     {
-      cls = &classes[idx];
-      int_cls = &internal_classes[idx];
-      if (cls->no_extra_assign_reev > 0)
+      HEAP_SCAN_ID *hsidp = &spec->s_id.s.hsid;
+      SCAN_TYPE scan_type = (spec->access == SEQUENTIAL) ? S_HEAP_SCAN : S_HEAP_SCAN_RECORD_INFO;
+      int i = 0;
+      if (hsidp->caches_inited)
 	{
-	  int_cls->mvcc_extra_assign_reev =
-	    db_private_alloc (thread_p, cls->no_extra_assign_reev * sizeof (UPDDEL_MVCC_COND_REEVAL *));
-	  if (int_cls->mvcc_extra_assign_reev == NULL)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	  for (idx2 = cls->no_extra_assign_reev - 1; idx2 >= 0; idx2--)
+	  heap_attrinfo_end (thread_p, hsidp->pred_attrs.attr_cache);
+	  heap_attrinfo_end (thread_p, hsidp->rest_attrs.attr_cache);
+	  if (hsidp->cache_recordinfo != NULL)
 	    {
-	      for (idx3 = 0; idx3 < no_reev_classes; idx3++)
+	      for (i = 0; i < HEAP_RECORD_INFO_COUNT; i++)
 		{
-		  if (cond_reev_classes[idx3].class_index == cls->mvcc_extra_assign_reev[idx2])
-		    {
-		      int_cls->mvcc_extra_assign_reev[idx2] = &cond_reev_classes[idx3];
-		      break;
-		    }
+		  db_value_clear (hsidp->cache_recordinfo[i]);
 		}
 	    }
-	  int_cls->extra_assign_reev_cnt = cls->no_extra_assign_reev;
+	  hsidp->caches_inited = false;
 	}
-    }
-  reev_data->mvcc_cond_reev_list = NULL;
-  reev_data->curr_extra_assign_cnt = 0;
-  reev_data->curr_extra_assign_reev = NULL;
-  reev_data->curr_assigns = NULL;
-  reev_data->curr_attrinfo = NULL;
-  reev_data->copyarea = NULL;
-  reev_data->cons_pred = cons_pred;
-  reev_data->vd = &xasl_state->vd;
-
-  if (qexec_create_mvcc_reev_assignments (thread_p, aptr, has_delete, internal_classes, no_classes, no_assigns, assigns,
-					  mvcc_reev_assigns) != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
-
-  *mvcc_reev_classes = cond_reev_classes;
-  return NO_ERROR;
-
-exit_on_error:
+      hsidp->scancache_inited = false;
 
-  if (cond_reev_classes != NULL)
-    {
-      db_private_free (thread_p, cond_reev_classes);
+      error =
+	scan_open_heap_scan (thread_p, &spec->s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped, single_fetch,
+			     spec->s_dbval, val_list, vd, &class_oid, &class_hfid, spec->s.cls_node.cls_regu_list_pred,
+			     spec->where_pred, spec->s.cls_node.cls_regu_list_rest,
+			     spec->s.cls_node.num_attrs_pred, spec->s.cls_node.attrids_pred,
+			     spec->s.cls_node.cache_pred, spec->s.cls_node.num_attrs_rest,
+			     spec->s.cls_node.attrids_rest, spec->s.cls_node.cache_rest,
+			     scan_type, spec->s.cls_node.cache_reserved, spec->s.cls_node.cls_regu_list_reserved);
     }
-  for (idx = 0; idx < no_classes; idx++)
+  else if (spec->type == TARGET_CLASS && spec->access == SEQUENTIAL_PAGE_SCAN)
     {
-      int_cls = &internal_classes[idx];
-      if (int_cls->mvcc_extra_assign_reev != NULL)
+      HEAP_PAGE_SCAN_ID *hpsidp = &spec->s_id.s.hpsid;
+      SCAN_TYPE scan_type = S_HEAP_PAGE_SCAN;
+      int i = 0;
+
+      if (hpsidp->cache_page_info != NULL)
 	{
-	  db_private_free_and_init (thread_p, int_cls->mvcc_extra_assign_reev);
+	  for (i = 0; i < HEAP_PAGE_INFO_COUNT; i++)
+	    {
+	      db_value_clear (hpsidp->cache_page_info[i]);
+	    }
 	}
+      error =
+	scan_open_heap_page_scan (thread_p, &spec->s_id, val_list, vd, &class_oid, &class_hfid, spec->where_pred,
+				  scan_type, spec->s.cls_node.cache_reserved, spec->s.cls_node.cls_regu_list_reserved);
     }
-  *mvcc_reev_classes = NULL;
-
-  return ER_FAILED;
-}
-
-/*
- * qexec_execute_update () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in): XASL Tree block
- *   has_delete(in): update/delete
- *   xasl_state(in):
- */
-static int
-qexec_execute_update (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool has_delete, XASL_STATE * xasl_state)
-{
-  UPDATE_PROC_NODE *update = &xasl->proc.update;
-  UPDDEL_CLASS_INFO *upd_cls = NULL;
-  UPDATE_ASSIGNMENT *assign = NULL;
-  SCAN_CODE xb_scan;
-  SCAN_CODE ls_scan;
-  XASL_NODE *aptr = NULL, *scan_ptr = NULL;
-  DB_VALUE *valp = NULL;
-  QPROC_DB_VALUE_LIST vallist;
-  int assign_idx = 0;
-  int rc;
-  int attr_id;
-  OID *oid = NULL;
-  OID *class_oid = NULL;
-  UPDDEL_CLASS_INFO_INTERNAL *internal_classes = NULL, *internal_class = NULL;
-  ACCESS_SPEC_TYPE *specp = NULL;
-  SCAN_ID *s_id = NULL;
-  LOG_LSA lsa;
-  int savepoint_used = 0;
-  int satisfies_constraints;
-  int force_count;
-  int op_type = SINGLE_ROW_UPDATE;
-  int s = 0, t = 0;
-  int malloc_size = 0;
-  REGU_VARIABLE *rvsave = NULL;
-  OID prev_oid = { 0, 0, 0 };
-  REPR_ID new_reprid = 0;
-  int tuple_cnt, error = NO_ERROR;
-  REPL_INFO_TYPE repl_info;
-  int class_oid_cnt = 0, class_oid_idx = 0;
-  int mvcc_reev_class_cnt = 0, mvcc_reev_class_idx = 0;
-  bool scan_open = false;
-  bool should_delete = false;
-  int current_op_type = SINGLE_ROW_UPDATE;
-  PRUNING_CONTEXT *pcontext = NULL;
-  DEL_LOB_INFO *del_lob_info_list = NULL;
-  RECDES recdes;
-  MVCC_UPDDEL_REEV_DATA mvcc_upddel_reev_data;
-  MVCC_REEV_DATA mvcc_reev_data;
-  UPDDEL_MVCC_COND_REEVAL *mvcc_reev_classes = NULL, *mvcc_reev_class = NULL;
-  UPDATE_MVCC_REEV_ASSIGNMENT *mvcc_reev_assigns = NULL;
-  bool need_locking;
-  UPDDEL_CLASS_INSTANCE_LOCK_INFO class_instance_lock_info, *p_class_instance_lock_info = NULL;
-
-  /* get the snapshot, before acquiring locks, since the transaction may be blocked and we need the snapshot when
-   * update starts, not later */
-  (void) logtb_get_mvcc_snapshot (thread_p);
-
-  mvcc_upddel_reev_data.copyarea = NULL;
-  SET_MVCC_UPDATE_REEV_DATA (&mvcc_reev_data, &mvcc_upddel_reev_data, V_TRUE);
-  class_oid_cnt = update->no_classes;
-  mvcc_reev_class_cnt = update->no_reev_classes;
-
-  /* Allocate memory for oids, hfids and attributes cache info of all classes used in update */
-  error = qexec_create_internal_classes (thread_p, update->classes, class_oid_cnt, &internal_classes);
-  if (error != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
-
-  /* lock classes which this query will update */
-  aptr = xasl->aptr_list;
-  error = qexec_set_class_locks (thread_p, aptr, update->classes, update->no_classes, internal_classes);
-  if (error != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
-
-  error =
-    prepare_mvcc_reev_data (thread_p, aptr, xasl_state, mvcc_reev_class_cnt, update->mvcc_reev_classes,
-			    &mvcc_upddel_reev_data, update->no_classes, update->classes, internal_classes,
-			    update->no_assigns, update->assigns, update->cons_pred, &mvcc_reev_classes,
-			    &mvcc_reev_assigns, has_delete);
-  if (error != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
-
-  if (class_oid_cnt == 1 && update->classes->no_subclasses == 1)
-    {
-      /* We update instances of only one class. We expect to lock the instances at select phase. However this not
-       * happens in all situations. The qexec_execute_mainblock function will set instances_locked of
-       * p_class_instance_lock_info to true in case that current class instances are locked at select phase. */
-      COPY_OID (&class_instance_lock_info.class_oid, (*((*update).classes)).class_oid);
-      class_instance_lock_info.instances_locked = false;
-      p_class_instance_lock_info = &class_instance_lock_info;
-    }
-
-  if (qexec_execute_mainblock (thread_p, aptr, xasl_state, p_class_instance_lock_info) != NO_ERROR)
+  else if (spec->type == TARGET_CLASS && spec->access == INDEX)
     {
-      GOTO_EXIT_ON_ERROR;
-    }
+      INDX_SCAN_ID *isidp = &spec->s_id.s.isid;
+      if (isidp->caches_inited)
+	{
+	  if (isidp->range_pred.regu_list)
+	    {
+	      heap_attrinfo_end (thread_p, isidp->range_attrs.attr_cache);
+	    }
+	  if (isidp->key_pred.regu_list)
+	    {
+	      heap_attrinfo_end (thread_p, isidp->key_attrs.attr_cache);
+	    }
+	  heap_attrinfo_end (thread_p, isidp->pred_attrs.attr_cache);
+	  heap_attrinfo_end (thread_p, isidp->rest_attrs.attr_cache);
+	  isidp->caches_inited = false;
+	}
+      idxptr = spec->indexptr;
+      idxptr->indx_id = index_id;
+      spec->s_id.s.isid.scancache_inited = false;
+      spec->s_id.s.isid.caches_inited = false;
 
+      error =
+	scan_open_index_scan (thread_p, &spec->s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
+			      single_fetch, spec->s_dbval, val_list, vd, idxptr, &class_oid, &class_hfid,
+			      spec->s.cls_node.cls_regu_list_key, spec->where_key, spec->s.cls_node.cls_regu_list_pred,
+			      spec->where_pred, spec->s.cls_node.cls_regu_list_rest, spec->where_range,
+			      spec->s.cls_node.cls_regu_list_range,
+			      spec->s.cls_node.cls_output_val_list, spec->s.cls_node.cls_regu_val_list,
+			      spec->s.cls_node.num_attrs_key, spec->s.cls_node.attrids_key, spec->s.cls_node.cache_key,
+			      spec->s.cls_node.num_attrs_pred, spec->s.cls_node.attrids_pred,
+			      spec->s.cls_node.cache_pred, spec->s.cls_node.num_attrs_rest,
+			      spec->s.cls_node.attrids_rest, spec->s.cls_node.cache_rest,
+			      spec->s.cls_node.num_attrs_range, spec->s.cls_node.attrids_range,
+			      spec->s.cls_node.cache_range, iscan_oid_order, query_id);
 
-  if (p_class_instance_lock_info && p_class_instance_lock_info->instances_locked)
-    {
-      /* already locked in select phase. Avoid locking again the same instances at update phase */
-      need_locking = false;
     }
-  else
+  else if (spec->type == TARGET_CLASS_ATTR)
     {
-      /* not locked in select phase, need locking at update phase */
-      need_locking = true;
-    }
+      if (spec->s_id.s.hsid.caches_inited)
+	{
+	  heap_attrinfo_end (thread_p, spec->s_id.s.hsid.pred_attrs.attr_cache);
+	  heap_attrinfo_end (thread_p, spec->s_id.s.hsid.rest_attrs.attr_cache);
+	  spec->s_id.s.hsid.caches_inited = false;
+	}
 
-  /* This guarantees that the result list file will have a type list. Copying a list_id structure fails unless it has a 
-   * type list. */
-  if (qexec_setup_list_id (thread_p, xasl) != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
+      error =
+	scan_open_class_attr_scan (thread_p, &spec->s_id, grouped, spec->single_fetch, spec->s_dbval, val_list, vd,
+				   &class_oid, &class_hfid, spec->s.cls_node.cls_regu_list_pred, spec->where_pred,
+				   spec->s.cls_node.cls_regu_list_rest, spec->s.cls_node.num_attrs_pred,
+				   spec->s.cls_node.attrids_pred, spec->s.cls_node.cache_pred,
+				   spec->s.cls_node.num_attrs_rest, spec->s.cls_node.attrids_rest,
+				   spec->s.cls_node.cache_rest);
     }
-
-  if (aptr->list_id->tuple_cnt > 1)
+  if (error != NO_ERROR)
     {
-      /* When multiple instances are updated, statement level uniqueness checking should be performed. In this case,
-       * uniqueness checking is performed by using statistical information generated by the execution of UPDATE
-       * statement. */
-      op_type = MULTI_ROW_UPDATE;
-    }
-  else
-    {				/* tuple_cnt <= 1 */
-      /* When single instance is updated, instance level uniqueness checking is performed. In this case, uniqueness
-       * checking is performed by the server when the key of the instance is inserted into an unique index. */
-      op_type = SINGLE_ROW_UPDATE;
+      return S_ERROR;
     }
 
-  /* need to start a topop to ensure statement atomicity. One update statement might update several disk images. For
-   * example, one row update might update zero or more index keys, one heap record, and other things. So, the update
-   * statement must be performed atomically. */
-  if (xtran_server_start_topop (thread_p, &lsa) != NO_ERROR)
+  if (spec->curent == NULL)
     {
-      GOTO_EXIT_ON_ERROR;
+      return S_END;
     }
-  savepoint_used = 1;
 
-  specp = xasl->spec_list;
-  /* force_select_lock = false */
-  assert (xasl->scan_op_type == S_SELECT);
-  if (qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state->vd, false, specp->fixed_scan, specp->grouped_scan,
-		       true, &specp->s_id, xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+  error = scan_start_scan (thread_p, &spec->s_id);
+  if (error != NO_ERROR)
     {
-      if (savepoint_used)
-	{
-	  xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
-	}
-
-      GOTO_EXIT_ON_ERROR;
+      return S_ERROR;
     }
+  return S_SUCCESS;
+}
 
-  scan_open = true;
+/*
+ * qexec_intprt_fnc () -
+ *   return: scan code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL Tree state information
+ *   tplrec(out) : Tuple record descriptor to store result tuples
+ *   next_scan_fnc(in)  : Function to interpret following XASL scan block
+ *
+ * Note: This function is the main function used to interpret an XASL
+ * tree block. That is, it assumes a general format XASL block
+ * with all possible representations.
+ */
+static SCAN_CODE
+qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * tplrec,
+		  XASL_SCAN_FNC_PTR next_scan_fnc)
+{
+  XASL_NODE *xptr;
+  SCAN_CODE xs_scan;
+  SCAN_CODE xb_scan;
+  SCAN_CODE ls_scan;
+  DB_LOGICAL ev_res;
+  int qualified;
+  AGGREGATE_TYPE *agg_ptr;
+  bool count_star_with_iscan_opt = false;
+  SCAN_OPERATION_TYPE scan_operation_type;
 
-  tuple_cnt = 1;
-  while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
+  if (xasl->type == BUILDVALUE_PROC)
     {
-      s_id = &xasl->curr_spec->s_id;
-      while ((ls_scan = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
+      BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
+      if (buildvalue->agg_list != NULL)
 	{
-	  if (op_type == MULTI_ROW_UPDATE)
+	  int error = NO_ERROR;
+	  bool is_scan_needed = false;
+	  if (!buildvalue->is_always_false)
 	    {
-	      if (tuple_cnt == 1)
-		{
-		  repl_info = REPL_INFO_TYPE_RBR_START;
-		}
-	      else if (tuple_cnt == aptr->list_id->tuple_cnt)
-		{
-		  repl_info = REPL_INFO_TYPE_RBR_END;
-		}
-	      else
+	      error =
+		qexec_evaluate_aggregates_optimize (thread_p, buildvalue->agg_list, xasl->spec_list, &is_scan_needed);
+	      if (error != NO_ERROR)
 		{
-		  repl_info = REPL_INFO_TYPE_RBR_NORMAL;
+		  is_scan_needed = true;
 		}
 	    }
-	  else
+
+	  if (prm_get_bool_value (PRM_ID_OPTIMIZER_ENABLE_AGGREGATE_OPTIMIZATION) == false)
 	    {
-	      repl_info = REPL_INFO_TYPE_RBR_NORMAL;
+	      is_scan_needed = true;
 	    }
-	  tuple_cnt++;
 
-	  /* evaluate constraint predicate */
-	  satisfies_constraints = V_UNKNOWN;
-	  if (update->cons_pred != NULL)
+	  if (!is_scan_needed)
 	    {
-	      satisfies_constraints = eval_pred (thread_p, update->cons_pred, &xasl_state->vd, NULL);
-	      if (satisfies_constraints == V_ERROR)
+	      return S_SUCCESS;
+	    }
+
+	  agg_ptr = buildvalue->agg_list;
+	  if (!xasl->scan_ptr	/* no scan procedure */
+	      && !xasl->fptr_list	/* no path expressions */
+	      && !xasl->if_pred	/* no if predicates */
+	      && !xasl->instnum_pred	/* no instnum predicate */
+	      && agg_ptr->next == NULL	/* no other aggregate functions */
+	      && agg_ptr->function == PT_COUNT_STAR)
+	    {
+	      /* only one count(*) function */
+	      ACCESS_SPEC_TYPE *specp = xasl->spec_list;
+	      if (specp->next == NULL && specp->access == INDEX && specp->s.cls_node.cls_regu_list_pred == NULL
+		  && specp->where_pred == NULL && !specp->indexptr->use_iss && !SCAN_IS_INDEX_MRO (&specp->s_id.s.isid)
+		  && !SCAN_IS_INDEX_COVERED (&specp->s_id.s.isid))
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  /* count(*) query will scan an index but does not have a data-filter */
+		  specp->s_id.s.isid.need_count_only = true;
+		  count_star_with_iscan_opt = true;
 		}
 	    }
+	}
+    }
+  else if (xasl->type == BUILDLIST_PROC)
+    {
+      /* If it is BUILDLIST, do not optimize aggregation */
+      if (xasl->proc.buildlist.g_agg_list != NULL)
+	{
+	  for (agg_ptr = xasl->proc.buildlist.g_agg_list; agg_ptr; agg_ptr = agg_ptr->next)
+	    {
+	      agg_ptr->flag_agg_optimize = false;
+	    }
+	}
+    }
 
-	  if (update->cons_pred != NULL && satisfies_constraints != V_TRUE)
+  while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
+    {
+      while ((ls_scan = scan_next_scan (thread_p, &xasl->curr_spec->s_id)) == S_SUCCESS)
+	{
+	  if (count_star_with_iscan_opt)
 	    {
-	      /* currently there are only NOT NULL constraints */
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
-	      GOTO_EXIT_ON_ERROR;
+	      xasl->proc.buildvalue.agg_list->accumulator.curr_cnt += (&xasl->curr_spec->s_id)->s.isid.oids_count;
+	      /* may have more scan ranges */
+	      continue;
 	    }
+	  /* set scan item as qualified */
+	  qualified = true;
 
-	  /* should delete? */
-	  current_op_type = op_type;
-	  if (has_delete)
+	  if (xasl->bptr_list)
 	    {
-	      vallist = s_id->val_list->valp;
-	      for (class_oid_idx = 0; class_oid_idx < class_oid_cnt; vallist = vallist->next->next, class_oid_idx++)
+	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
 		{
-		  ;		/* advance */
+		  scan_operation_type = S_UPDATE;
 		}
-	      valp = vallist->val;
-	      if (valp == NULL)
+	      else
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  scan_operation_type = S_SELECT;
 		}
+	    }
 
-	      /* We may get NULL as an expr value. See pt_to_merge_update_query(...). */
-	      if (DB_IS_NULL (valp))
+	  /* evaluate bptr list */
+	  /* if path expression fetch fails, this instance disqualifies */
+	  for (xptr = xasl->bptr_list; qualified && xptr != NULL; xptr = xptr->next)
+	    {
+	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
 		{
-		  should_delete = false;
+		  return S_ERROR;
 		}
-	      else
+	      else if (xptr->proc.fetch.fetch_res == false)
 		{
-		  should_delete = DB_GET_INT (valp);
+		  qualified = false;
 		}
+	    }
 
-	      if (should_delete)
+	  if (qualified)
+	    {
+	      /* evaluate dptr list */
+	      for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
 		{
-		  if (op_type == SINGLE_ROW_UPDATE)
+		  /* clear correlated subquery list files */
+		  qexec_clear_head_lists (thread_p, xptr);
+		  if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
 		    {
-		      current_op_type = SINGLE_ROW_DELETE;
+		      /* skip if linked to regu var */
+		      continue;
 		    }
-		  else
+		  if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
 		    {
-		      current_op_type = MULTI_ROW_DELETE;
+		      return S_ERROR;
 		    }
 		}
-	    }
-
-	  /* for each class calc. OID, HFID, attributes cache info and statistical information only if class has
-	   * changed */
-	  vallist = s_id->val_list->valp;
-	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0; class_oid_idx < class_oid_cnt;
-	       vallist = vallist->next->next, class_oid_idx++)
-	    {
-	      upd_cls = &update->classes[class_oid_idx];
-	      internal_class = &internal_classes[class_oid_idx];
-
-	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
-		{
-		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
-		}
-	      else
-		{
-		  mvcc_reev_class = NULL;
-		}
-
-	      /* instance OID */
-	      valp = vallist->val;
-	      if (valp == NULL)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      if (DB_IS_NULL (valp))
-		{
-		  internal_class->oid = NULL;
-		  continue;
-		}
-	      internal_class->oid = DB_GET_OID (valp);
-	      if (mvcc_reev_class != NULL)
-		{
-		  mvcc_reev_class->inst_oid = internal_class->oid;
-		}
-
-	      /* class OID */
-	      valp = vallist->next->val;
-	      if (valp == NULL)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      if (DB_IS_NULL (valp))
-		{
-		  continue;
-		}
-	      class_oid = DB_GET_OID (valp);
 
-	      /* class has changed to a new subclass */
-	      if (class_oid
-		  && (!OID_EQ (&internal_class->prev_class_oid, class_oid)
-		      || (!should_delete && BTREE_IS_MULTI_ROW_OP (op_type) && upd_cls->has_uniques
-			  && internal_class->scan_cache != NULL
-			  && internal_class->scan_cache->index_stat_info == NULL)))
+	      /* evaluate after join predicate */
+	      ev_res = V_UNKNOWN;
+	      if (xasl->after_join_pred != NULL)
 		{
-		  /* Load internal_class object with information for class_oid */
-		  error =
-		    qexec_upddel_setup_current_class (thread_p, upd_cls, internal_class, current_op_type, class_oid);
-		  if (error != NO_ERROR || internal_class->class_hfid == NULL)
+		  ev_res = eval_pred (thread_p, xasl->after_join_pred, &xasl_state->vd, NULL);
+		  if (ev_res == V_ERROR)
 		    {
-		      /* matching class oid does not exist... error */
-		      er_log_debug (ARG_FILE_LINE, "qexec_execute_update: class OID is not correct\n");
-		      GOTO_EXIT_ON_ERROR;
+		      return S_ERROR;
 		    }
+		}
+	      qualified = (xasl->after_join_pred == NULL || ev_res == V_TRUE);
 
-		  /* temporary disable set filters when needs prunning */
-		  if (mvcc_reev_class != NULL)
+	      if (qualified)
+		{
+		  /* evaluate if predicate */
+		  ev_res = V_UNKNOWN;
+		  if (xasl->if_pred != NULL)
 		    {
-		      error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
-		      if (error != NO_ERROR)
+		      ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
+		      if (ev_res == V_ERROR)
 			{
-			  GOTO_EXIT_ON_ERROR;
+			  return S_ERROR;
 			}
 		    }
+		  qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
+		}
 
-		  /* clear attribute cache information if valid old subclass */
-		  if (!OID_ISNULL (&internal_class->prev_class_oid) && internal_class->is_attr_info_inited)
-		    {
-		      (void) heap_attrinfo_end (thread_p, &internal_class->attr_info);
-		      internal_class->is_attr_info_inited = false;
-		    }
-		  /* start attribute cache information for new subclass */
-		  if (heap_attrinfo_start (thread_p, class_oid, -1, NULL, &internal_class->attr_info) != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		  internal_class->is_attr_info_inited = true;
-
-		  if (should_delete)
+	      if (qualified)
+		{
+		  /* evaluate fptr list */
+		  if (xasl->fptr_list)
 		    {
-		      if (internal_class->no_lob_attrs)
+		      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
 			{
-			  internal_class->crt_del_lob_info =
-			    qexec_change_delete_lob_info (thread_p, xasl_state, internal_class, &del_lob_info_list);
-			  if (internal_class->crt_del_lob_info == NULL)
-			    {
-			      GOTO_EXIT_ON_ERROR;
-			    }
+			  scan_operation_type = S_UPDATE;
 			}
 		      else
 			{
-			  internal_class->crt_del_lob_info = NULL;
+			  scan_operation_type = S_SELECT;
 			}
 		    }
-		}
 
-	      /* don't update, just delete */
-	      if (should_delete)
-		{
-		  /* handle lobs first */
-		  if (internal_class->crt_del_lob_info)
+		  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
 		    {
-		      /* delete lob files */
-		      DEL_LOB_INFO *crt_del_lob_info = internal_class->crt_del_lob_info;
-		      SCAN_CODE scan_code;
-		      int error;
-		      int i;
-
-		      /* read lob attributes */
-		      scan_code = heap_get (thread_p, oid, &recdes, internal_class->scan_cache, 1, NULL_CHN);
-		      if (scan_code == S_ERROR)
+		      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
 			{
-			  GOTO_EXIT_ON_ERROR;
+			  return S_ERROR;
 			}
-		      if (scan_code == S_SUCCESS)
+		      else if (xptr->proc.fetch.fetch_res == false)
 			{
-			  error =
-			    heap_attrinfo_read_dbvalues (thread_p, oid, &recdes, NULL, &crt_del_lob_info->attr_info);
-			  if (error != NO_ERROR)
+			  qualified = false;
+			}
+		    }
+
+		  if (qualified)
+		    {
+
+		      if (!xasl->scan_ptr)
+			{	/* no scan procedure block */
+
+			  /* if hierarchical query do special processing */
+			  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
 			    {
-			      GOTO_EXIT_ON_ERROR;
+			      if (qexec_update_connect_by_lists (thread_p, xasl->connect_by_ptr, xasl_state, tplrec) !=
+				  NO_ERROR)
+				{
+				  return S_ERROR;
+				}
 			    }
-			  for (i = 0; i < internal_class->no_lob_attrs; i++)
+			  else
 			    {
-			      DB_VALUE *attr_valp = &crt_del_lob_info->attr_info.values[i].dbvalue;
-			      if (!db_value_is_null (attr_valp))
+			      /* evaluate inst_num predicate */
+			      if (xasl->instnum_val)
 				{
-				  DB_ELO *elo;
-				  error = NO_ERROR;
+				  ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
+				  if (ev_res == V_ERROR)
+				    {
+				      return S_ERROR;
+				    }
 
-				  assert (db_value_type (attr_valp) == DB_TYPE_BLOB
-					  || db_value_type (attr_valp) == DB_TYPE_CLOB);
-				  elo = db_get_elo (attr_valp);
-				  if (elo)
+
+				  if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_LAST_STOP))
 				    {
-				      error = db_elo_delete (elo);
+				      if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
+					{
+					  return S_ERROR;
+					}
+
+				      return S_SUCCESS;
 				    }
-				  if (error != NO_ERROR)
+
+				  if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP))
 				    {
-				      GOTO_EXIT_ON_ERROR;
+				      return S_SUCCESS;
 				    }
 				}
+			      qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
+			      if (qualified
+				  && (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR))
+				{
+				  return S_ERROR;
+				}
 			    }
+
 			}
-		    }
+		      else
+			{	/* handle the scan procedure */
+			  /* current scan block has at least one qualified item */
+			  xasl->curr_spec->s_id.qualified_block = true;
 
-		  force_count = 0;
-		  error =
-		    locator_attribute_info_force (thread_p, internal_class->class_hfid, internal_class->oid, NULL, NULL,
-						  0, LC_FLUSH_DELETE, current_op_type, internal_class->scan_cache,
-						  &force_count, false, REPL_INFO_TYPE_RBR_NORMAL,
-						  DB_NOT_PARTITIONED_CLASS, NULL, NULL, &mvcc_reev_data,
-						  UPDATE_INPLACE_NONE, NULL, need_locking);
+			  /* handle the scan procedure */
+			  xasl->scan_ptr->next_scan_on = false;
+			  if (scan_reset_scan_block (thread_p, &xasl->scan_ptr->curr_spec->s_id) == S_ERROR)
+			    {
+			      return S_ERROR;
+			    }
 
-		  if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
-		    {
-		      error = NO_ERROR;
-		    }
-		  else if (error != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		  else if (force_count)
-		    {
-		      xasl->list_id->tuple_cnt++;
+			  xasl->next_scan_on = true;
+
+
+			  while ((xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, tplrec,
+							      next_scan_fnc + 1)) == S_SUCCESS)
+			    {
+
+			      /* if hierarchical query do special processing */
+			      if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
+				{
+				  if (qexec_update_connect_by_lists (thread_p, xasl->connect_by_ptr, xasl_state, tplrec)
+				      != NO_ERROR)
+				    {
+				      return S_ERROR;
+				    }
+				}
+			      else
+				{
+				  /* evaluate inst_num predicate */
+				  if (xasl->instnum_val)
+				    {
+				      ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
+				      if (ev_res == V_ERROR)
+					{
+					  return S_ERROR;
+					}
+
+				      if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_LAST_STOP))
+					{
+					  if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
+					    {
+					      return S_ERROR;
+					    }
+
+					  return S_SUCCESS;
+					}
+
+				      if (xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP)
+					{
+					  return S_SUCCESS;
+					}
+				    }
+				  qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
+
+				  if (qualified
+				      /* one iteration successfully completed */
+				      && qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
+				    {
+				      return S_ERROR;
+				    }
+				}
+
+			    }
+
+			  if (xs_scan != S_END)	/* an error happened */
+			    {
+			      return S_ERROR;
+			    }
+			}
 		    }
 		}
+	    }
 
-	      if (heap_attrinfo_clear_dbvalues (&internal_class->attr_info) != NO_ERROR)
+	  qexec_clear_all_lists (thread_p, xasl);
+	}
+
+      if (ls_scan != S_END)	/* an error happened */
+	{
+	  return S_ERROR;
+	}
+    }
+
+  if (xb_scan != S_END)		/* an error happened */
+    {
+      return S_ERROR;
+    }
+
+  return S_SUCCESS;
+}
+
+/*
+ * qexec_merge_fnc () -
+ *   return: scan code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL Tree state information
+ *   tplrec(out) : Tuple record descriptor to store result tuples
+ *
+ * Note: This function is used to interpret an XASL merge command
+ * tree block. It assumes a general format XASL block
+ * with all possible representations.
+ */
+static SCAN_CODE
+qexec_merge_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * tplrec,
+		 XASL_SCAN_FNC_PTR ignore)
+{
+  XASL_NODE *xptr;
+  DB_LOGICAL ev_res;
+  int qualified;
+  SCAN_CODE ls_scan1;		/* first list file scan counter */
+  SCAN_CODE ls_scan2;		/* second list file scan counter */
+  SCAN_ID *s_id1;		/* first list file scan identifier */
+  SCAN_ID *s_id2;		/* second list file scan identifier */
+  ACCESS_SPEC_TYPE *spec;
+
+  /* set first scan parameters */
+  s_id1 = &xasl->spec_list->s_id;
+  /* set second scan parameters */
+  s_id2 = &xasl->merge_spec->s_id;
+
+  if ((!s_id1)
+      || ((s_id1->type == S_LIST_SCAN)
+	  && ((!s_id1->s.llsid.list_id) || (s_id1->s.llsid.list_id->type_list.type_cnt == 0))))
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  if ((!s_id2)
+      || ((s_id2->type == S_LIST_SCAN)
+	  && ((!s_id2->s.llsid.list_id) || (s_id2->s.llsid.list_id->type_list.type_cnt == 0))))
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  spec = xasl->merge_spec;
+  if (qexec_next_merge_block (thread_p, &spec) != S_SUCCESS)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  while ((ls_scan1 = qexec_next_scan_block (thread_p, xasl)) == S_SUCCESS)
+    {
+      while ((ls_scan1 = scan_next_scan (thread_p, s_id1)) == S_SUCCESS)
+	{
+	  ls_scan2 = scan_next_scan (thread_p, s_id2);
+	  if (ls_scan2 == S_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  if (ls_scan2 == S_END)
+	    {
+	      if (qexec_next_merge_block (thread_p, &spec) != S_SUCCESS)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
 
-	      if (should_delete)
+	      ls_scan2 = scan_next_scan (thread_p, s_id2);
+	      if (ls_scan2 == S_ERROR)
 		{
-		  goto continue_scan;
+		  GOTO_EXIT_ON_ERROR;
 		}
 	    }
 
-	  /* Get info for MVCC condition reevaluation */
-	  for (; mvcc_reev_class_idx < mvcc_reev_class_cnt; mvcc_reev_class_idx++)
-	    {
-	      mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx];
+	  /* set scan item as qualified */
+	  qualified = true;
 
-	      /* instance OID */
-	      valp = vallist->val;
-	      if (valp == NULL)
+	  /* evaluate bptr list */
+	  /* if path expression fetch fails, this instance disqualifies */
+	  for (xptr = xasl->bptr_list; qualified && xptr != NULL; xptr = xptr->next)
+	    {
+	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, S_SELECT) != NO_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
-	      mvcc_reev_class->inst_oid = DB_GET_OID (valp);
-
-	      /* class OID */
-	      valp = vallist->next->val;
-	      if (valp == NULL)
+	      else if (xptr->proc.fetch.fetch_res == false)
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  qualified = false;
 		}
-	      class_oid = DB_GET_OID (valp);
+	    }
 
-	      /* class has changed to a new subclass */
-	      if (class_oid && !OID_EQ (&mvcc_reev_class->cls_oid, class_oid))
+	  if (qualified)
+	    {
+	      /* evaluate dptr list */
+	      for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
 		{
-		  error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
-		  if (error != NO_ERROR)
+		  /* clear correlated subquery list files */
+		  qexec_clear_head_lists (thread_p, xptr);
+		  if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
+		    {
+		      /* skip if linked to regu var */
+		      continue;
+		    }
+		  if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
 		    {
 		      GOTO_EXIT_ON_ERROR;
 		    }
 		}
-	      vallist = vallist->next->next;
-	    }
 
-	  if (mvcc_upddel_reev_data.mvcc_cond_reev_list == NULL && mvcc_reev_class_cnt > 0)
-	    {
-	      /* If scan order was not set then do it. This operation must be run only once. We do it here and not at
-	       * the beginning of this function because the class OIDs must be set for classes involved in reevaluation 
-	       * (in mvcc_reev_classes) prior to this operation */
-	      mvcc_upddel_reev_data.mvcc_cond_reev_list =
-		qexec_mvcc_cond_reev_set_scan_order (aptr, mvcc_reev_classes, mvcc_reev_class_cnt, update->classes,
-						     update->no_classes);
-	    }
-	  if (has_delete)
-	    {
-	      vallist = vallist->next;	/* skip should_delete */
-	    }
-
-	  /* perform assignments */
-	  for (assign_idx = 0; assign_idx < update->no_assigns; assign_idx++)
-	    {
-	      HEAP_CACHE_ATTRINFO *attr_info;
-
-	      assign = &update->assigns[assign_idx];
-	      class_oid_idx = assign->cls_idx;
-	      internal_class = &internal_classes[class_oid_idx];
-	      attr_info = &internal_class->attr_info;
-	      upd_cls = &update->classes[class_oid_idx];
-	      oid = internal_class->oid;
-	      if (oid == NULL)
+	      /* evaluate if predicate */
+	      ev_res = V_UNKNOWN;
+	      if (xasl->if_pred != NULL)
 		{
-		  /* nothing to update */
-		  if (assign->constant == NULL)
+		  ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
+		  if (ev_res == V_ERROR)
 		    {
-		      vallist = vallist->next;
+		      GOTO_EXIT_ON_ERROR;
 		    }
-		  continue;
-		}
-	      attr_id = upd_cls->att_id[internal_class->subclass_idx * upd_cls->no_attrs + assign->att_idx];
-	      if (mvcc_reev_assigns != NULL)
-		{
-		  mvcc_reev_assigns[assign_idx].att_id = attr_id;
-		}
-
-	      if (assign->constant != NULL)
-		{
-		  rc = heap_attrinfo_set (oid, attr_id, assign->constant, attr_info);
-		}
-	      else
-		{
-		  rc = heap_attrinfo_set (oid, attr_id, vallist->val, attr_info);
-		  vallist = vallist->next;
-		}
-	      if (rc != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	    }
-
-	  /* Flush new values for each class. The class list was built from right to left during XASL generation, so in 
-	   * order to maintain the correct update order specified in the query, we must iterate from right to left as
-	   * well; this makes a difference only when we update the same attribute of the same class more than once. */
-	  for (class_oid_idx = class_oid_cnt - 1, mvcc_reev_class_idx = mvcc_reev_class_cnt - 1; class_oid_idx >= 0;
-	       class_oid_idx--)
-	    {
-	      internal_class = &internal_classes[class_oid_idx];
-	      upd_cls = &update->classes[class_oid_idx];
-
-	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
-		{
-		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
-		}
-	      else
-		{
-		  mvcc_reev_class = NULL;
-		}
-	      mvcc_upddel_reev_data.curr_upddel = mvcc_reev_class;
-
-	      force_count = 0;
-	      oid = internal_class->oid;
-	      if (oid == NULL)
-		{
-		  continue;
 		}
 
-	      if (upd_cls->needs_pruning)
-		{
-		  pcontext = &internal_class->context;
-		}
-	      else
+	      qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
+	      if (qualified)
 		{
-		  pcontext = NULL;
-		}
+		  /* evaluate fptr list */
+		  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
+		    {
+		      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, S_SELECT) != NO_ERROR)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+		      else if (xptr->proc.fetch.fetch_res == false)
+			{
+			  qualified = false;
+			}
+		    }
 
-	      mvcc_upddel_reev_data.curr_extra_assign_reev = internal_class->mvcc_extra_assign_reev;
-	      mvcc_upddel_reev_data.curr_extra_assign_cnt = internal_class->extra_assign_reev_cnt;
-	      mvcc_upddel_reev_data.curr_assigns = internal_class->mvcc_reev_assigns;
-	      mvcc_upddel_reev_data.curr_attrinfo = &internal_class->attr_info;
-	      error =
-		locator_attribute_info_force (thread_p, internal_class->class_hfid, oid, &internal_class->attr_info,
-					      &upd_cls->att_id[internal_class->subclass_idx * upd_cls->no_attrs],
-					      upd_cls->no_attrs, LC_FLUSH_UPDATE, op_type, internal_class->scan_cache,
-					      &force_count, false, repl_info, internal_class->needs_pruning, pcontext,
-					      NULL, &mvcc_reev_data, UPDATE_INPLACE_NONE, NULL, need_locking);
-	      if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
-		{
-		  error = NO_ERROR;
-		}
-	      else if (error == ER_HEAP_UNKNOWN_OBJECT)
-		{
-		  /* TODO: This is a very dangerous. A different way of handling it must be found.
-		   *       This may not even be necessary. I guess this is legacy code from READ COMMITTED
-		   *       re-evaluation made under locator_attribute_info_force. I think currently locking object
-		   *       is done on select phase. However, I am not removing this code yet until more investigation
-		   *       is done.
-		   */
-		  er_clear ();
-		  error = NO_ERROR;
-		}
-	      else if (error != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      else
-		{
-		  /* Successful update. */
-		  force_count = 1;
-		}
+		  if (qualified)
+		    {
+		      if (!xasl->scan_ptr)
+			{	/* no scan procedure block */
+			  /* evaluate inst_num predicate */
+			  if (xasl->instnum_val)
+			    {
+			      ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
+			      if (ev_res == V_ERROR)
+				{
+				  return S_ERROR;
+				}
+			      if (xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP)
+				{
+				  scan_end_scan (thread_p, s_id1);
+				  scan_end_scan (thread_p, s_id2);
+				  return S_SUCCESS;
+				}
+			    }	/* if (xasl->instnum_val) */
+			  qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
 
-	      /* Instances are not put into the result list file, but are counted. */
-	      if (force_count)
-		{
-		  xasl->list_id->tuple_cnt++;
+			  if (qualified && qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
+			    {
+			      return S_ERROR;
+			    }
+			}	/* handle the scan procedure */
+		    }
 		}
 	    }
-	continue_scan:;
 	}
-      if (ls_scan != S_END)
+
+      if (ls_scan1 == S_ERROR)
 	{
 	  GOTO_EXIT_ON_ERROR;
 	}
     }
-  if (xb_scan != S_END)
+
+  if (ls_scan1 == S_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
 
-  for (s = 0; s < class_oid_cnt; s++)
-    {
-      internal_class = &internal_classes[s];
-      upd_cls = &update->classes[s];
+  scan_end_scan (thread_p, s_id1);
+  scan_end_scan (thread_p, s_id2);
+  return S_SUCCESS;
 
-      if (upd_cls->has_uniques)
-	{
-	  if (internal_class->needs_pruning)
-	    {
-	      error = qexec_process_partition_unique_stats (thread_p, &internal_class->context);
-	    }
-	  else
-	    {
-	      error = qexec_process_unique_stats (thread_p, upd_cls->class_oid, internal_class);
-	    }
-	  if (error != NO_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	}
-    }
+exit_on_error:
+  scan_end_scan (thread_p, s_id1);
+  scan_end_scan (thread_p, s_id2);
+  scan_close_scan (thread_p, s_id1);
+  scan_close_scan (thread_p, s_id2);
+  return S_ERROR;
+}
 
-  qexec_close_scan (thread_p, specp);
+/*
+ * qexec_setup_list_id () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree block
+ *
+ * Note: This routine is used by update/delete/insert to set up a
+ * type_list. Copying a list_id structure fails unless it has a type list.
+ */
+static int
+qexec_setup_list_id (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  QFILE_LIST_ID *list_id;
 
-  if (has_delete)
-    {
-      qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
-    }
+  list_id = xasl->list_id;
+  list_id->tuple_cnt = 0;
+  list_id->page_cnt = 0;
 
-  if (internal_classes)
+  /* For streaming queries, set last_pgptr->next_vpid to NULL */
+  if (list_id->last_pgptr != NULL)
     {
-      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
-      db_private_free_and_init (thread_p, internal_classes);
+      QFILE_PUT_NEXT_VPID_NULL (list_id->last_pgptr);
     }
 
-  if (mvcc_reev_classes != NULL)
-    {
-      db_private_free (thread_p, mvcc_reev_classes);
-      mvcc_reev_classes = NULL;
-    }
-  if (mvcc_reev_assigns != NULL)
-    {
-      db_private_free (thread_p, mvcc_reev_assigns);
-      mvcc_reev_assigns = NULL;
-    }
-  if (mvcc_upddel_reev_data.copyarea != NULL)
+  list_id->last_pgptr = NULL;	/* don't want qfile_close_list() to free this bogus listid */
+  list_id->type_list.type_cnt = 1;
+  list_id->type_list.domp = (TP_DOMAIN **) malloc (list_id->type_list.type_cnt * sizeof (TP_DOMAIN *));
+  if (list_id->type_list.domp == NULL)
     {
-      locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
-      mvcc_upddel_reev_data.copyarea = NULL;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      list_id->type_list.type_cnt * sizeof (TP_DOMAIN *));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
     }
+  /* set up to return object domains in case we want to return the updated/inserted/deleted oid's */
+  list_id->type_list.domp[0] = &tp_Object_domain;
 
-  if (savepoint_used)
+  if (xasl->type == INSERT_PROC && XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS))
     {
-      if (xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ATTACH_TO_OUTER, &lsa) != TRAN_ACTIVE)
+      list_id->tfile_vfid = qmgr_create_new_temp_file (thread_p, list_id->query_id, TEMP_FILE_MEMBUF_NORMAL);
+      if (list_id->tfile_vfid == NULL)
 	{
-	  qexec_failure_line (__LINE__, xasl_state);
 	  return ER_FAILED;
 	}
+      VFID_COPY (&(list_id->temp_vfid), &(list_id->tfile_vfid->temp_vfid));
     }
 
-#if 0				/* yaw */
-  /* remove query result cache entries which are relevant with this class */
-  class_oid = update->class_oid;
-  if (!QFILE_IS_LIST_CACHE_DISABLED && class_oid)
+#if !defined (NDEBUG)
+  assert (list_id->type_list.type_cnt == 1);
+  if (list_id->type_list.type_cnt != 0)
     {
-      for (s = 0; s < update->no_classes; s++, class_oid++)
-	{
-	  if (qexec_clear_list_cache_by_class (class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "qexec_execute_update: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    class_oid->pageid, class_oid->slotid, class_oid->volid);
-	    }
-	}
-      qmgr_add_modified_class (class_oid);
+      thread_rc_track_meter (thread_p, __FILE__, __LINE__, 1, list_id, RC_QLIST, MGR_DEF);
     }
-#endif
+#endif /* NDEBUG */
 
   return NO_ERROR;
+}
 
-exit_on_error:
+/*
+ * qexec_init_upddel_ehash_files () - Initializes the hash files used for
+ *				       duplicate OIDs elimination.
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in):
+ *   buildlist(in): BUILDLIST_PROC XASL
+ *
+ * Note: The function is used only for SELECT statement generated for
+ *	 UPDATE/DELETE. The case of SINGLE-UPDATE/SINGLE-DELETE is skipped.
+ */
+static int
+qexec_init_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
+{
+  int idx;
+  EHID *hash_list = NULL;
 
-  if (scan_open)
+  if (buildlist == NULL || buildlist->type != BUILDLIST_PROC)
     {
-      qexec_end_scan (thread_p, specp);
-      qexec_close_scan (thread_p, specp);
+      return NO_ERROR;
     }
 
-  if (mvcc_reev_classes != NULL)
-    {
-      db_private_free (thread_p, mvcc_reev_classes);
-      mvcc_reev_classes = NULL;
-    }
-  if (mvcc_reev_assigns != NULL)
-    {
-      db_private_free (thread_p, mvcc_reev_assigns);
-      mvcc_reev_assigns = NULL;
-    }
-  if (mvcc_upddel_reev_data.copyarea != NULL)
+  hash_list = db_private_alloc (thread_p, buildlist->upd_del_class_cnt * sizeof (EHID));
+  if (hash_list == NULL)
     {
-      locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
-      mvcc_upddel_reev_data.copyarea = NULL;
+      goto exit_on_error;
     }
 
-  if (savepoint_used)
+  for (idx = 0; idx < buildlist->upd_del_class_cnt; idx++)
     {
-      xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
+      hash_list[idx].vfid.volid = LOG_DBFIRST_VOLID;
+      if (xehash_create (thread_p, &hash_list[idx], DB_TYPE_OBJECT, -1, NULL, 0, true) == NULL)
+	{
+	  goto exit_on_error;
+	}
     }
+  buildlist->proc.buildlist.upddel_oid_locator_ehids = hash_list;
 
-  if (internal_classes)
+  return NO_ERROR;
+
+exit_on_error:
+  if (hash_list != NULL)
     {
-      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
-      db_private_free_and_init (thread_p, internal_classes);
+      for (--idx; idx >= 0; idx--)
+	{
+	  xehash_destroy (thread_p, &hash_list[idx]);
+	}
+      db_private_free (thread_p, hash_list);
     }
 
   return ER_FAILED;
 }
 
 /*
- * qexec_update_btree_unique_stats_info () - updates statistical information
- *	structure
- *   return: NO_ERROR or ER_code
- *   thread_p(in)   :
- *   info(in)     : structure to update
+ * qexec_destroy_upddel_ehash_files () - Destroys the hash files used for
+ *					 duplicate rows elimination in
+ *					 UPDATE/DELETE.
+ *   return: void
+ *   thread_p(in):
+ *   buildlist(in): BUILDLIST_PROC XASL
+ *
+ * Note: The function is used only for SELECT statement generated for
+ *	 UPDATE/DELETE.
  */
-static int
-qexec_update_btree_unique_stats_info (THREAD_ENTRY * thread_p, BTREE_UNIQUE_STATS_UPDATE_INFO * info)
+static void
+qexec_destroy_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
 {
-  int s, t;
-  BTREE_UNIQUE_STATS *temp_info = NULL;
-  int malloc_size;
-  char *ptr;
-  BTREE_UNIQUE_STATS *unique_stat_info = info->unique_stat_info;
-  HEAP_SCANCACHE *scan_cache = &info->scan_cache;
-  int num_unique_btrees = info->num_unique_btrees;
-  int max_unique_btrees = info->max_unique_btrees;
+  int idx;
+  EHID *hash_list = buildlist->proc.buildlist.upddel_oid_locator_ehids;
 
-  for (s = 0; s < scan_cache->num_btids; s++)
+  for (idx = 0; idx < buildlist->upd_del_class_cnt; idx++)
     {
-      temp_info = &(scan_cache->index_stat_info[s]);
-      if (temp_info->num_nulls == 0 && temp_info->num_keys == 0 && temp_info->num_oids == 0)
-	{
-	  continue;
-	}
-      /* non-unique index would be filtered out at above statement. */
+      xehash_destroy (thread_p, &hash_list[idx]);
+    }
+  db_private_free (thread_p, hash_list);
+  buildlist->proc.buildlist.upddel_oid_locator_ehids = NULL;
+}
 
-      for (t = 0; t < num_unique_btrees; t++)
-	{
-	  if (BTID_IS_EQUAL (&temp_info->btid, &unique_stat_info[t].btid))
-	    {
-	      break;
-	    }
-	}
-      if (t < num_unique_btrees)
-	{
-	  /* The same unique index has been found */
-	  unique_stat_info[t].num_nulls += temp_info->num_nulls;
-	  unique_stat_info[t].num_keys += temp_info->num_keys;
-	  unique_stat_info[t].num_oids += temp_info->num_oids;
-	}
-      else
+/*
+ * qexec_mvcc_cond_reev_set_scan_order () - link classes for condition
+ *					    reevaluation in scan order (from
+ *					    outer to inner)
+ *   return: list head
+ *   aptr(in): XASL for generated SELECT statement for UPDATE
+ *   buildlist(in): BUILDLIST_PROC XASL
+ *   reev_classes(in): array of classes for reevaluation
+ *   no_reev_classes(in): no of classes for reevaluation
+ *   classes(in): classes to be updated
+ *   no_classes(in): no of classes to be updated
+ */
+static UPDDEL_MVCC_COND_REEVAL *
+qexec_mvcc_cond_reev_set_scan_order (XASL_NODE * aptr, UPDDEL_MVCC_COND_REEVAL * reev_classes, int no_reev_classes,
+				     UPDDEL_CLASS_INFO * classes, int no_classes)
+{
+  int idx, idx2, idx3;
+  ACCESS_SPEC_TYPE *access_spec = NULL;
+  UPDDEL_MVCC_COND_REEVAL *scan_elem = NULL, *scan_start = NULL;
+  int *mvcc_extra_assign_reev = NULL;
+
+  if (reev_classes == NULL || no_reev_classes <= 0)
+    {
+      return NULL;
+    }
+  for (; aptr != NULL; aptr = aptr->scan_ptr)
+    {
+      for (access_spec = aptr->spec_list; access_spec != NULL; access_spec = access_spec->next)
 	{
-	  /* The same unique index has not been found */
-	  if (num_unique_btrees == max_unique_btrees)
+	  for (idx = no_reev_classes - 1; idx >= 0; idx--)
 	    {
-	      /* need more space for storing the local stat info */
-	      max_unique_btrees += UNIQUE_STAT_INFO_INCREMENT;
-	      malloc_size = sizeof (BTREE_UNIQUE_STATS) * max_unique_btrees;
-	      ptr = (char *) db_private_realloc (thread_p, unique_stat_info, malloc_size);
-	      if (ptr == NULL)
+	      if (OID_EQ (&access_spec->s.cls_node.cls_oid, &reev_classes[idx].cls_oid))
 		{
-		  info->num_unique_btrees = num_unique_btrees;
-		  return ER_FAILED;
+		  /* check that this class is not an assignment reevaluation class */
+		  for (idx2 = 0; idx2 < no_classes; idx2++)
+		    {
+		      mvcc_extra_assign_reev = classes[idx2].mvcc_extra_assign_reev;
+		      for (idx3 = classes[idx2].no_extra_assign_reev - 1; idx3 >= 0; idx3--)
+			{
+			  if (mvcc_extra_assign_reev[idx3] == reev_classes[idx].class_index)
+			    {
+			      break;
+			    }
+			}
+		      if (idx3 >= 0)
+			{
+			  break;
+			}
+		    }
+		  if (idx2 < no_classes)
+		    {
+		      continue;
+		    }
+
+		  /* if this class is not an assignment reevaluation class then add to the list */
+		  if (scan_elem == NULL)
+		    {
+		      scan_elem = scan_start = &reev_classes[idx];
+		    }
+		  else
+		    {
+		      scan_elem->next = &reev_classes[idx];
+		      scan_elem = scan_elem->next;
+		    }
+		  break;
 		}
-	      unique_stat_info = (BTREE_UNIQUE_STATS *) ptr;
-	      info->unique_stat_info = unique_stat_info;
-	      info->max_unique_btrees = max_unique_btrees;
 	    }
-	  t = num_unique_btrees;
-	  BTID_COPY (&unique_stat_info[t].btid, &temp_info->btid);
-	  unique_stat_info[t].num_nulls = temp_info->num_nulls;
-	  unique_stat_info[t].num_keys = temp_info->num_keys;
-	  unique_stat_info[t].num_oids = temp_info->num_oids;
-	  num_unique_btrees++;	/* increment */
+	  if (idx >= 0)
+	    {
+	      break;
+	    }
 	}
-    }				/* for */
-  info->num_unique_btrees = num_unique_btrees;
-  return NO_ERROR;
-}
+    }
 
+  return scan_start;
+}
 
 /*
- * qexec_process_unique_stats () - verify unique statistic information for
- *				   a class hierarchy and update index
+ * prepare_mvcc_reev_data () - create and initialize structures for MVCC
+ *			       condition and assignments reevaluation
  * return : error code or NO_ERROR
  * thread_p (in) :
- * class_oid (in) :
- * internal_class (in) :
+ * aptr (in): XASL for generated SELECT statement for UPDATE
+ * no_reev_classes (in): no of indexes for classes used in reevaluation
+ * mvcc_reev_indexes (in) : array of indexes for classes used in reevaluation
+ * reev_data (in) : MVCC reevaluation data for a specific class
+ * no_classes (in) : no. of assignments 'classes' elements
+ * classes(in): array of classes to be updated
+ * internal_classes (in) : array of information for each class that will be
+ *			   updated
+ * cons_pred(in): NOT NULL contraints predicate
+ * mvcc_reev_classes(in/out): array of classes information used in MVCC
+ *			      reevaluation
+ * mvcc_reev_assigns(in/out): array of assignments information used in
+ *			      reevaluation
+ * has_delete (in):
  */
 static int
-qexec_process_unique_stats (THREAD_ENTRY * thread_p, OID * class_oid, UPDDEL_CLASS_INFO_INTERNAL * internal_class)
+prepare_mvcc_reev_data (THREAD_ENTRY * thread_p, XASL_NODE * aptr, XASL_STATE * xasl_state, int no_reev_classes,
+			int *mvcc_reev_indexes, MVCC_UPDDEL_REEV_DATA * reev_data, int no_classes,
+			UPDDEL_CLASS_INFO * classes, UPDDEL_CLASS_INFO_INTERNAL * internal_classes, int no_assigns,
+			UPDATE_ASSIGNMENT * assigns, PRED_EXPR * cons_pred,
+			UPDDEL_MVCC_COND_REEVAL ** mvcc_reev_classes, UPDATE_MVCC_REEV_ASSIGNMENT ** mvcc_reev_assigns,
+			bool has_delete)
 {
-  BTREE_UNIQUE_STATS *unique_stat_info, *unique_stat1 = NULL;
-  int error = NO_ERROR, i;
+  UPDDEL_MVCC_COND_REEVAL *cond_reev_classes = NULL, *cond_reev_class = NULL;
+  UPDDEL_CLASS_INFO *cls = NULL;
+  UPDDEL_CLASS_INFO_INTERNAL *int_cls = NULL;
+  int idx, idx2, idx3;
 
-  if (internal_class->unique_stats.scan_cache_inited)
+  if (reev_data == NULL)
     {
-      /* Accumulate current statistics */
-      error = qexec_update_btree_unique_stats_info (thread_p, &internal_class->unique_stats);
-      if (error != NO_ERROR)
-	{
-	  return error;
-	}
+      assert (0);
+      return ER_FAILED;
     }
 
-  unique_stat_info = internal_class->unique_stats.unique_stat_info;
+  /* Make sure reev data is initialized, or else it will crash later */
+  memset (reev_data, 0, sizeof (MVCC_UPDDEL_REEV_DATA));
 
-  /* When uniqueness checking based on each local statistical information turns out as valid, the local statistical
-   * information must be reflected into the global statistical information kept in the root page of corresponding
-   * unique index. */
-  for (i = 0; i < internal_class->unique_stats.num_unique_btrees; i++)
+  if (no_reev_classes == 0)
     {
-      unique_stat1 = &unique_stat_info[i];
-      /* If local statistical information is not valid, skip it. */
-      if (unique_stat1->num_nulls == 0 && unique_stat1->num_keys == 0 && unique_stat1->num_oids == 0)
-	{
-	  /* no modification : non-unique index */
-	  continue;
-	}
-      /* uniqueness checking based on local statistical information */
-      if ((unique_stat1->num_nulls + unique_stat1->num_keys) != unique_stat1->num_oids)
-	{
-	  BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, NULL, NULL, class_oid, &unique_stat1->btid, NULL);
-	  return ER_FAILED;
-	}
-
-      /* In MVCC, at this point, we will update only in-memory statistics */
-      error =
-	logtb_tran_update_unique_stats (thread_p, &unique_stat1->btid, unique_stat1->num_keys, unique_stat1->num_oids,
-					unique_stat1->num_nulls, true);
-      if (error != NO_ERROR)
-	{
-	  return error;
-	}
+      return NO_ERROR;
     }
-  return NO_ERROR;
-}
 
-/*
- * qexec_process_partition_unique_stats () - process unique statistics on a
- *					     partitioned class
- * return : error code or NO_ERROR
- * thread_p (in) :
- * pcontext (in) :
- *
- * Note: Since unique indexes for partitioned classes are either local or
- *    global, it's to expensive to use the validation made on normal class
- *    hierarchies. This function just reflects the unique statistics to the
- *    index header
- */
-static int
-qexec_process_partition_unique_stats (THREAD_ENTRY * thread_p, PRUNING_CONTEXT * pcontext)
-{
-  PRUNING_SCAN_CACHE *scan_cache = NULL;
-  SCANCACHE_LIST *node = NULL;
-  BTREE_UNIQUE_STATS *unique_stat_info, *unique_stat = NULL;
-  int error = NO_ERROR, i;
+  if (mvcc_reev_classes == NULL)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
 
-  for (node = pcontext->scan_cache_list; node != NULL; node = node->next)
+  /* allocate and initialize classes for reevaluation */
+  cond_reev_classes = db_private_alloc (thread_p, sizeof (UPDDEL_MVCC_COND_REEVAL) * no_reev_classes);
+  if (cond_reev_classes == NULL)
     {
-      scan_cache = &node->scan_cache;
-      if (!scan_cache->is_scan_cache_started)
-	{
-	  continue;
-	}
-      unique_stat_info = scan_cache->scan_cache.index_stat_info;
-      if (unique_stat_info != NULL)
+      GOTO_EXIT_ON_ERROR;
+    }
+  /* init information for reevaluation */
+  for (idx = 0; idx < no_reev_classes; idx++)
+    {
+      cond_reev_class = &cond_reev_classes[idx];
+      cond_reev_class->class_index = mvcc_reev_indexes[idx];
+      OID_SET_NULL (&cond_reev_class->cls_oid);
+      cond_reev_class->inst_oid = NULL;
+      cond_reev_class->rest_attrs = NULL;
+      cond_reev_class->rest_regu_list = NULL;
+      cond_reev_class->next = NULL;
+    }
+  for (idx = 0; idx < no_classes; idx++)
+    {
+      cls = &classes[idx];
+      int_cls = &internal_classes[idx];
+      if (cls->no_extra_assign_reev > 0)
 	{
-	  for (i = 0; i < scan_cache->scan_cache.num_btids; i++)
+	  int_cls->mvcc_extra_assign_reev =
+	    db_private_alloc (thread_p, cls->no_extra_assign_reev * sizeof (UPDDEL_MVCC_COND_REEVAL *));
+	  if (int_cls->mvcc_extra_assign_reev == NULL)
 	    {
-	      unique_stat = &unique_stat_info[i];
-	      if (unique_stat->num_keys == 0 && unique_stat->num_nulls == 0 && unique_stat->num_oids == 0)
-		{
-		  continue;
-		}
-	      if ((unique_stat->num_nulls + unique_stat->num_keys) != unique_stat->num_oids)
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	  for (idx2 = cls->no_extra_assign_reev - 1; idx2 >= 0; idx2--)
+	    {
+	      for (idx3 = 0; idx3 < no_reev_classes; idx3++)
 		{
-		  char *index_name = NULL;
-		  error =
-		    heap_get_indexinfo_of_btid (thread_p, &scan_cache->scan_cache.node.class_oid, &unique_stat->btid,
-						NULL, NULL, NULL, NULL, &index_name, NULL);
-		  if (error != NO_ERROR)
-		    {
-		      return error;
-		    }
-
-		  BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, NULL, NULL, &scan_cache->scan_cache.node.class_oid,
-						    &unique_stat->btid, index_name);
-
-		  if (index_name)
+		  if (cond_reev_classes[idx3].class_index == cls->mvcc_extra_assign_reev[idx2])
 		    {
-		      free_and_init (index_name);
+		      int_cls->mvcc_extra_assign_reev[idx2] = &cond_reev_classes[idx3];
+		      break;
 		    }
-		  return ER_FAILED;
-		}
-
-	      error =
-		logtb_tran_update_unique_stats (thread_p, &unique_stat->btid, unique_stat->num_keys,
-						unique_stat->num_oids, unique_stat->num_nulls, true);
-	      if (error != NO_ERROR)
-		{
-		  return error;
 		}
 	    }
+	  int_cls->extra_assign_reev_cnt = cls->no_extra_assign_reev;
 	}
     }
+  reev_data->mvcc_cond_reev_list = NULL;
+  reev_data->curr_extra_assign_cnt = 0;
+  reev_data->curr_extra_assign_reev = NULL;
+  reev_data->curr_assigns = NULL;
+  reev_data->curr_attrinfo = NULL;
+  reev_data->copyarea = NULL;
+  reev_data->cons_pred = cons_pred;
+  reev_data->vd = &xasl_state->vd;
+
+  if (qexec_create_mvcc_reev_assignments (thread_p, aptr, has_delete, internal_classes, no_classes, no_assigns, assigns,
+					  mvcc_reev_assigns) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  *mvcc_reev_classes = cond_reev_classes;
   return NO_ERROR;
+
+exit_on_error:
+
+  if (cond_reev_classes != NULL)
+    {
+      db_private_free (thread_p, cond_reev_classes);
+    }
+  for (idx = 0; idx < no_classes; idx++)
+    {
+      int_cls = &internal_classes[idx];
+      if (int_cls->mvcc_extra_assign_reev != NULL)
+	{
+	  db_private_free_and_init (thread_p, int_cls->mvcc_extra_assign_reev);
+	}
+    }
+  *mvcc_reev_classes = NULL;
+
+  return ER_FAILED;
 }
 
 /*
- * qexec_execute_delete () -
- *   return: NO_ERROR or ER_code
- *   xasl(in)   : XASL Tree block
- *   xasl_state(in)     :
+ * qexec_execute_update () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in): XASL Tree block
+ *   has_delete(in): update/delete
+ *   xasl_state(in):
  */
 static int
-qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
+qexec_execute_update (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool has_delete, XASL_STATE * xasl_state)
 {
-#define MIN_NUM_ROWS_FOR_MULTI_DELETE   20
-
-  DELETE_PROC_NODE *delete_ = &xasl->proc.delete_;
-  SCAN_CODE xb_scan = S_END;
-  SCAN_CODE ls_scan = S_END;
-  XASL_NODE *aptr = NULL;
+  UPDATE_PROC_NODE *update = &xasl->proc.update;
+  UPDDEL_CLASS_INFO *upd_cls = NULL;
+  UPDATE_ASSIGNMENT *assign = NULL;
+  SCAN_CODE xb_scan;
+  SCAN_CODE ls_scan;
+  XASL_NODE *aptr = NULL, *scan_ptr = NULL;
   DB_VALUE *valp = NULL;
+  QPROC_DB_VALUE_LIST vallist;
+  int assign_idx = 0;
+  int rc;
+  int attr_id;
   OID *oid = NULL;
   OID *class_oid = NULL;
+  UPDDEL_CLASS_INFO_INTERNAL *internal_classes = NULL, *internal_class = NULL;
   ACCESS_SPEC_TYPE *specp = NULL;
   SCAN_ID *s_id = NULL;
   LOG_LSA lsa;
   int savepoint_used = 0;
-  int class_oid_cnt = 0, class_oid_idx = 0;
-  int cl_index = 0;
-  int force_count = 0;
-  int op_type = SINGLE_ROW_DELETE;
-  int s = 0, t = 0, error = NO_ERROR;
+  int satisfies_constraints;
+  int force_count;
+  int op_type = SINGLE_ROW_UPDATE;
+  int s = 0, t = 0;
   int malloc_size = 0;
+  REGU_VARIABLE *rvsave = NULL;
+  OID prev_oid = { 0, 0, 0 };
+  REPR_ID new_reprid = 0;
+  int tuple_cnt, error = NO_ERROR;
+  REPL_INFO_TYPE repl_info;
+  int class_oid_cnt = 0, class_oid_idx = 0;
   int mvcc_reev_class_cnt = 0, mvcc_reev_class_idx = 0;
-  QPROC_DB_VALUE_LIST val_list = NULL;
   bool scan_open = false;
-  UPDDEL_CLASS_INFO *query_class = NULL;
-  UPDDEL_CLASS_INFO_INTERNAL *internal_classes = NULL, *internal_class = NULL;
+  bool should_delete = false;
+  int current_op_type = SINGLE_ROW_UPDATE;
+  PRUNING_CONTEXT *pcontext = NULL;
   DEL_LOB_INFO *del_lob_info_list = NULL;
   RECDES recdes;
-  bool btid_dup_key_locked = false;
-  MVCC_REEV_DATA mvcc_reev_data;
   MVCC_UPDDEL_REEV_DATA mvcc_upddel_reev_data;
+  MVCC_REEV_DATA mvcc_reev_data;
   UPDDEL_MVCC_COND_REEVAL *mvcc_reev_classes = NULL, *mvcc_reev_class = NULL;
+  UPDATE_MVCC_REEV_ASSIGNMENT *mvcc_reev_assigns = NULL;
   bool need_locking;
   UPDDEL_CLASS_INSTANCE_LOCK_INFO class_instance_lock_info, *p_class_instance_lock_info = NULL;
 
   /* get the snapshot, before acquiring locks, since the transaction may be blocked and we need the snapshot when
-   * delete starts, not later */
+   * update starts, not later */
   (void) logtb_get_mvcc_snapshot (thread_p);
 
-  class_oid_cnt = delete_->no_classes;
-  mvcc_reev_class_cnt = delete_->no_reev_classes;
-  SET_MVCC_UPDATE_REEV_DATA (&mvcc_reev_data, &mvcc_upddel_reev_data, V_TRUE);
-
   mvcc_upddel_reev_data.copyarea = NULL;
+  SET_MVCC_UPDATE_REEV_DATA (&mvcc_reev_data, &mvcc_upddel_reev_data, V_TRUE);
+  class_oid_cnt = update->no_classes;
+  mvcc_reev_class_cnt = update->no_reev_classes;
 
   /* Allocate memory for oids, hfids and attributes cache info of all classes used in update */
-  error = qexec_create_internal_classes (thread_p, delete_->classes, class_oid_cnt, &internal_classes);
+  error = qexec_create_internal_classes (thread_p, update->classes, class_oid_cnt, &internal_classes);
   if (error != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
 
-  /* lock classes from which this query will delete */
-  error = qexec_set_class_locks (thread_p, xasl->aptr_list, delete_->classes, delete_->no_classes, internal_classes);
+  /* lock classes which this query will update */
+  aptr = xasl->aptr_list;
+  error = qexec_set_class_locks (thread_p, aptr, update->classes, update->no_classes, internal_classes);
   if (error != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
 
-  aptr = xasl->aptr_list;
-
   error =
-    prepare_mvcc_reev_data (thread_p, aptr, xasl_state, mvcc_reev_class_cnt, delete_->mvcc_reev_classes,
-			    &mvcc_upddel_reev_data, delete_->no_classes, delete_->classes, internal_classes, 0, NULL,
-			    NULL, &mvcc_reev_classes, NULL, 0);
+    prepare_mvcc_reev_data (thread_p, aptr, xasl_state, mvcc_reev_class_cnt, update->mvcc_reev_classes,
+			    &mvcc_upddel_reev_data, update->no_classes, update->classes, internal_classes,
+			    update->no_assigns, update->assigns, update->cons_pred, &mvcc_reev_classes,
+			    &mvcc_reev_assigns, has_delete);
   if (error != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
 
-  if (class_oid_cnt == 1 && delete_->classes->no_subclasses == 1)
+  if (class_oid_cnt == 1 && update->classes->no_subclasses == 1)
     {
-      /* We delete instances of only one class. We expect to lock the instances at select phase. However this not
+      /* We update instances of only one class. We expect to lock the instances at select phase. However this not
        * happens in all situations. The qexec_execute_mainblock function will set instances_locked of
        * p_class_instance_lock_info to true in case that current class instances are locked at select phase. */
-      COPY_OID (&class_instance_lock_info.class_oid, (*((*delete_).classes)).class_oid);
+      COPY_OID (&class_instance_lock_info.class_oid, (*((*update).classes)).class_oid);
       class_instance_lock_info.instances_locked = false;
       p_class_instance_lock_info = &class_instance_lock_info;
     }
@@ -9517,9 +9403,10 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
       GOTO_EXIT_ON_ERROR;
     }
 
+
   if (p_class_instance_lock_info && p_class_instance_lock_info->instances_locked)
     {
-      /* already locked in select phase. Avoid locking again the same instances at delete phase. */
+      /* already locked in select phase. Avoid locking again the same instances at update phase */
       need_locking = false;
     }
   else
@@ -9530,60 +9417,143 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 
   /* This guarantees that the result list file will have a type list. Copying a list_id structure fails unless it has a 
    * type list. */
-  if ((qexec_setup_list_id (thread_p, xasl) != NO_ERROR)
-      /* it can be > 2 || (aptr->list_id->type_list.type_cnt != 2) */ )
+  if (qexec_setup_list_id (thread_p, xasl) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
 
-
-  /* Allocate and init structures for statistical information */
-  if (aptr->list_id->tuple_cnt > MIN_NUM_ROWS_FOR_MULTI_DELETE)
+  if (aptr->list_id->tuple_cnt > 1)
     {
-      op_type = MULTI_ROW_DELETE;
+      /* When multiple instances are updated, statement level uniqueness checking should be performed. In this case,
+       * uniqueness checking is performed by using statistical information generated by the execution of UPDATE
+       * statement. */
+      op_type = MULTI_ROW_UPDATE;
     }
   else
-    {
-      /* When the number of instances to be deleted is small, SINGLE_ROW_DELETE operation would be better, I guess.. */
-      op_type = SINGLE_ROW_DELETE;
+    {				/* tuple_cnt <= 1 */
+      /* When single instance is updated, instance level uniqueness checking is performed. In this case, uniqueness
+       * checking is performed by the server when the key of the instance is inserted into an unique index. */
+      op_type = SINGLE_ROW_UPDATE;
     }
 
-  /* need to start a topop to ensure statement atomicity. One delete statement might update several disk images. For
-   * example, one row delete might update zero or more index keys, one heap record, catalog info of object count, and
-   * other things. So, the delete statement must be performed atomically. */
+  /* need to start a topop to ensure statement atomicity. One update statement might update several disk images. For
+   * example, one row update might update zero or more index keys, one heap record, and other things. So, the update
+   * statement must be performed atomically. */
   if (xtran_server_start_topop (thread_p, &lsa) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
-
   savepoint_used = 1;
 
   specp = xasl->spec_list;
-  assert (xasl->scan_op_type == S_SELECT);
   /* force_select_lock = false */
+  assert (xasl->scan_op_type == S_SELECT);
   if (qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state->vd, false, specp->fixed_scan, specp->grouped_scan,
 		       true, &specp->s_id, xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
     {
+      if (savepoint_used)
+	{
+	  xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
+	}
+
       GOTO_EXIT_ON_ERROR;
     }
 
   scan_open = true;
 
+  tuple_cnt = 1;
   while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
     {
       s_id = &xasl->curr_spec->s_id;
-
       while ((ls_scan = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
 	{
-	  val_list = s_id->val_list->valp;
+	  if (op_type == MULTI_ROW_UPDATE)
+	    {
+	      if (tuple_cnt == 1)
+		{
+		  repl_info = REPL_INFO_TYPE_RBR_START;
+		}
+	      else if (tuple_cnt == aptr->list_id->tuple_cnt)
+		{
+		  repl_info = REPL_INFO_TYPE_RBR_END;
+		}
+	      else
+		{
+		  repl_info = REPL_INFO_TYPE_RBR_NORMAL;
+		}
+	    }
+	  else
+	    {
+	      repl_info = REPL_INFO_TYPE_RBR_NORMAL;
+	    }
+	  tuple_cnt++;
 
-	  /* Get info for MVCC condition reevaluation */
-	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0;
-	       class_oid_idx < class_oid_cnt || mvcc_reev_class_idx < mvcc_reev_class_cnt;
-	       val_list = val_list->next->next, class_oid_idx++)
+	  /* evaluate constraint predicate */
+	  satisfies_constraints = V_UNKNOWN;
+	  if (update->cons_pred != NULL)
 	    {
-	      if (mvcc_reev_class_idx < mvcc_reev_class_cnt
-		  && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
+	      satisfies_constraints = eval_pred (thread_p, update->cons_pred, &xasl_state->vd, NULL);
+	      if (satisfies_constraints == V_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+
+	  if (update->cons_pred != NULL && satisfies_constraints != V_TRUE)
+	    {
+	      /* currently there are only NOT NULL constraints */
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  /* should delete? */
+	  current_op_type = op_type;
+	  if (has_delete)
+	    {
+	      vallist = s_id->val_list->valp;
+	      for (class_oid_idx = 0; class_oid_idx < class_oid_cnt; vallist = vallist->next->next, class_oid_idx++)
+		{
+		  ;		/* advance */
+		}
+	      valp = vallist->val;
+	      if (valp == NULL)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      /* We may get NULL as an expr value. See pt_to_merge_update_query(...). */
+	      if (DB_IS_NULL (valp))
+		{
+		  should_delete = false;
+		}
+	      else
+		{
+		  should_delete = DB_GET_INT (valp);
+		}
+
+	      if (should_delete)
+		{
+		  if (op_type == SINGLE_ROW_UPDATE)
+		    {
+		      current_op_type = SINGLE_ROW_DELETE;
+		    }
+		  else
+		    {
+		      current_op_type = MULTI_ROW_DELETE;
+		    }
+		}
+	    }
+
+	  /* for each class calc. OID, HFID, attributes cache info and statistical information only if class has
+	   * changed */
+	  vallist = s_id->val_list->valp;
+	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0; class_oid_idx < class_oid_cnt;
+	       vallist = vallist->next->next, class_oid_idx++)
+	    {
+	      upd_cls = &update->classes[class_oid_idx];
+	      internal_class = &internal_classes[class_oid_idx];
+
+	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
 		{
 		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
 		}
@@ -9592,60 +9562,77 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 		  mvcc_reev_class = NULL;
 		}
 
-	      valp = val_list->val;
+	      /* instance OID */
+	      valp = vallist->val;
 	      if (valp == NULL)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
 	      if (DB_IS_NULL (valp))
 		{
-		  if (class_oid_idx < class_oid_cnt)
-		    {
-		      internal_class = &internal_classes[class_oid_idx];
-		      internal_class->class_oid = NULL;
-		      internal_class->oid = NULL;
-		    }
+		  internal_class->oid = NULL;
 		  continue;
 		}
-	      oid = DB_GET_OID (valp);
+	      internal_class->oid = DB_GET_OID (valp);
+	      if (mvcc_reev_class != NULL)
+		{
+		  mvcc_reev_class->inst_oid = internal_class->oid;
+		}
 
 	      /* class OID */
-	      valp = val_list->next->val;
+	      valp = vallist->next->val;
 	      if (valp == NULL)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
 	      if (DB_IS_NULL (valp))
 		{
-		  if (class_oid_idx < class_oid_cnt)
-		    {
-		      internal_classes[class_oid_idx].class_oid = NULL;
-		    }
 		  continue;
 		}
 	      class_oid = DB_GET_OID (valp);
 
-	      if (class_oid_idx < class_oid_cnt)
+	      /* class has changed to a new subclass */
+	      if (class_oid
+		  && (!OID_EQ (&internal_class->prev_class_oid, class_oid)
+		      || (!should_delete && BTREE_IS_MULTI_ROW_OP (op_type) && upd_cls->has_uniques
+			  && internal_class->scan_cache != NULL
+			  && internal_class->scan_cache->index_stat_info == NULL)))
 		{
-		  internal_class = &internal_classes[class_oid_idx];
-
-		  internal_class->oid = oid;
-
-		  if (class_oid
-		      && (internal_class->class_oid == NULL || !OID_EQ (internal_class->class_oid, class_oid)))
+		  /* Load internal_class object with information for class_oid */
+		  error =
+		    qexec_upddel_setup_current_class (thread_p, upd_cls, internal_class, current_op_type, class_oid);
+		  if (error != NO_ERROR || internal_class->class_hfid == NULL)
 		    {
-		      query_class = &delete_->classes[class_oid_idx];
+		      /* matching class oid does not exist... error */
+		      er_log_debug (ARG_FILE_LINE, "qexec_execute_update: class OID is not correct\n");
+		      GOTO_EXIT_ON_ERROR;
+		    }
 
-		      /* find class HFID */
-		      error =
-			qexec_upddel_setup_current_class (thread_p, query_class, internal_class, op_type, class_oid);
+		  /* temporary disable set filters when needs prunning */
+		  if (mvcc_reev_class != NULL)
+		    {
+		      error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
 		      if (error != NO_ERROR)
 			{
-			  /* matching class oid does not exist... error */
-			  er_log_debug (ARG_FILE_LINE, "qexec_execute_delete: class OID is not correct\n");
 			  GOTO_EXIT_ON_ERROR;
 			}
+		    }
+
+		  /* clear attribute cache information if valid old subclass */
+		  if (!OID_ISNULL (&internal_class->prev_class_oid) && internal_class->is_attr_info_inited)
+		    {
+		      (void) heap_attrinfo_end (thread_p, &internal_class->attr_info);
+		      internal_class->is_attr_info_inited = false;
+		    }
+		  /* start attribute cache information for new subclass */
+		  if (heap_attrinfo_start (thread_p, class_oid, -1, NULL, &internal_class->attr_info) != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		  internal_class->is_attr_info_inited = true;
 
+		  if (should_delete)
+		    {
 		      if (internal_class->no_lob_attrs)
 			{
 			  internal_class->crt_del_lob_info =
@@ -9662,35 +9649,185 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 		    }
 		}
 
-	      if (mvcc_reev_class != NULL)
+	      /* don't update, just delete */
+	      if (should_delete)
 		{
-		  /* class has changed to a new subclass */
-		  if (class_oid && !OID_EQ (&mvcc_reev_class->cls_oid, class_oid))
+		  /* handle lobs first */
+		  if (internal_class->crt_del_lob_info)
 		    {
-		      error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
-		      if (error != NO_ERROR)
+		      /* delete lob files */
+		      DEL_LOB_INFO *crt_del_lob_info = internal_class->crt_del_lob_info;
+		      SCAN_CODE scan_code;
+		      int error;
+		      int i;
+
+		      /* read lob attributes */
+		      scan_code = heap_get (thread_p, oid, &recdes, internal_class->scan_cache, 1, NULL_CHN);
+		      if (scan_code == S_ERROR)
 			{
 			  GOTO_EXIT_ON_ERROR;
 			}
+		      if (scan_code == S_SUCCESS)
+			{
+			  error =
+			    heap_attrinfo_read_dbvalues (thread_p, oid, &recdes, NULL, &crt_del_lob_info->attr_info);
+			  if (error != NO_ERROR)
+			    {
+			      GOTO_EXIT_ON_ERROR;
+			    }
+			  for (i = 0; i < internal_class->no_lob_attrs; i++)
+			    {
+			      DB_VALUE *attr_valp = &crt_del_lob_info->attr_info.values[i].dbvalue;
+			      if (!db_value_is_null (attr_valp))
+				{
+				  DB_ELO *elo;
+				  error = NO_ERROR;
+
+				  assert (db_value_type (attr_valp) == DB_TYPE_BLOB
+					  || db_value_type (attr_valp) == DB_TYPE_CLOB);
+				  elo = db_get_elo (attr_valp);
+				  if (elo)
+				    {
+				      error = db_elo_delete (elo);
+				    }
+				  if (error != NO_ERROR)
+				    {
+				      GOTO_EXIT_ON_ERROR;
+				    }
+				}
+			    }
+			}
 		    }
-		}
-	    }
 
-	  if (mvcc_upddel_reev_data.mvcc_cond_reev_list == NULL)
-	    {
-	      /* If scan order was not set then do it. This operation must be run only once. We do it here and not at
-	       * the beginning of this function because the class OIDs must be set for classes involved in reevaluation 
-	       * (in mvcc_reev_classes) prior to this operation */
-	      mvcc_upddel_reev_data.mvcc_cond_reev_list =
-		qexec_mvcc_cond_reev_set_scan_order (aptr, mvcc_reev_classes, mvcc_reev_class_cnt, delete_->classes,
-						     class_oid_cnt);
+		  force_count = 0;
+		  error =
+		    locator_attribute_info_force (thread_p, internal_class->class_hfid, internal_class->oid, NULL, NULL,
+						  0, LC_FLUSH_DELETE, current_op_type, internal_class->scan_cache,
+						  &force_count, false, REPL_INFO_TYPE_RBR_NORMAL,
+						  DB_NOT_PARTITIONED_CLASS, NULL, NULL, &mvcc_reev_data,
+						  UPDATE_INPLACE_NONE, NULL, need_locking);
+
+		  if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
+		    {
+		      error = NO_ERROR;
+		    }
+		  else if (error != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		  else if (force_count)
+		    {
+		      xasl->list_id->tuple_cnt++;
+		    }
+		}
+
+	      if (heap_attrinfo_clear_dbvalues (&internal_class->attr_info) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      if (should_delete)
+		{
+		  goto continue_scan;
+		}
 	    }
 
-	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0; class_oid_idx < class_oid_cnt; class_oid_idx++)
+	  /* Get info for MVCC condition reevaluation */
+	  for (; mvcc_reev_class_idx < mvcc_reev_class_cnt; mvcc_reev_class_idx++)
+	    {
+	      mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx];
+
+	      /* instance OID */
+	      valp = vallist->val;
+	      if (valp == NULL)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      mvcc_reev_class->inst_oid = DB_GET_OID (valp);
+
+	      /* class OID */
+	      valp = vallist->next->val;
+	      if (valp == NULL)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      class_oid = DB_GET_OID (valp);
+
+	      /* class has changed to a new subclass */
+	      if (class_oid && !OID_EQ (&mvcc_reev_class->cls_oid, class_oid))
+		{
+		  error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
+		  if (error != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		}
+	      vallist = vallist->next->next;
+	    }
+
+	  if (mvcc_upddel_reev_data.mvcc_cond_reev_list == NULL && mvcc_reev_class_cnt > 0)
+	    {
+	      /* If scan order was not set then do it. This operation must be run only once. We do it here and not at
+	       * the beginning of this function because the class OIDs must be set for classes involved in reevaluation 
+	       * (in mvcc_reev_classes) prior to this operation */
+	      mvcc_upddel_reev_data.mvcc_cond_reev_list =
+		qexec_mvcc_cond_reev_set_scan_order (aptr, mvcc_reev_classes, mvcc_reev_class_cnt, update->classes,
+						     update->no_classes);
+	    }
+	  if (has_delete)
+	    {
+	      vallist = vallist->next;	/* skip should_delete */
+	    }
+
+	  /* perform assignments */
+	  for (assign_idx = 0; assign_idx < update->no_assigns; assign_idx++)
 	    {
+	      HEAP_CACHE_ATTRINFO *attr_info;
+
+	      assign = &update->assigns[assign_idx];
+	      class_oid_idx = assign->cls_idx;
 	      internal_class = &internal_classes[class_oid_idx];
+	      attr_info = &internal_class->attr_info;
+	      upd_cls = &update->classes[class_oid_idx];
 	      oid = internal_class->oid;
-	      class_oid = internal_class->class_oid;
+	      if (oid == NULL)
+		{
+		  /* nothing to update */
+		  if (assign->constant == NULL)
+		    {
+		      vallist = vallist->next;
+		    }
+		  continue;
+		}
+	      attr_id = upd_cls->att_id[internal_class->subclass_idx * upd_cls->no_attrs + assign->att_idx];
+	      if (mvcc_reev_assigns != NULL)
+		{
+		  mvcc_reev_assigns[assign_idx].att_id = attr_id;
+		}
+
+	      if (assign->constant != NULL)
+		{
+		  rc = heap_attrinfo_set (oid, attr_id, assign->constant, attr_info);
+		}
+	      else
+		{
+		  rc = heap_attrinfo_set (oid, attr_id, vallist->val, attr_info);
+		  vallist = vallist->next;
+		}
+	      if (rc != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+
+	  /* Flush new values for each class. The class list was built from right to left during XASL generation, so in 
+	   * order to maintain the correct update order specified in the query, we must iterate from right to left as
+	   * well; this makes a difference only when we update the same attribute of the same class more than once. */
+	  for (class_oid_idx = class_oid_cnt - 1, mvcc_reev_class_idx = mvcc_reev_class_cnt - 1; class_oid_idx >= 0;
+	       class_oid_idx--)
+	    {
+	      internal_class = &internal_classes[class_oid_idx];
+	      upd_cls = &update->classes[class_oid_idx];
 
 	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
 		{
@@ -9702,99 +9839,64 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 		}
 	      mvcc_upddel_reev_data.curr_upddel = mvcc_reev_class;
 
+	      force_count = 0;
+	      oid = internal_class->oid;
 	      if (oid == NULL)
 		{
 		  continue;
 		}
 
-	      if (internal_class->crt_del_lob_info)
+	      if (upd_cls->needs_pruning)
 		{
-		  /* delete lob files */
-		  DEL_LOB_INFO *crt_del_lob_info = internal_class->crt_del_lob_info;
-		  SCAN_CODE scan_code;
-		  int error;
-		  int i;
-
-		  /* read lob attributes */
-		  scan_code = heap_get (thread_p, oid, &recdes, internal_class->scan_cache, 1, NULL_CHN);
-		  if (scan_code == S_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		  if (scan_code == S_SUCCESS)
-		    {
-		      error = heap_attrinfo_read_dbvalues (thread_p, oid, &recdes, NULL, &crt_del_lob_info->attr_info);
-		      if (error != NO_ERROR)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
-		      for (i = 0; i < internal_class->no_lob_attrs; i++)
-			{
-			  DB_VALUE *attr_valp = &crt_del_lob_info->attr_info.values[i].dbvalue;
-			  if (!db_value_is_null (attr_valp))
-			    {
-			      DB_ELO *elo;
-			      error = NO_ERROR;
-
-			      assert (db_value_type (attr_valp) == DB_TYPE_BLOB
-				      || db_value_type (attr_valp) == DB_TYPE_CLOB);
-			      elo = db_get_elo (attr_valp);
-			      if (elo)
-				{
-				  error = db_elo_delete (elo);
-				}
-			      if (error != NO_ERROR)
-				{
-				  GOTO_EXIT_ON_ERROR;
-				}
-			    }
-			}
-		    }
+		  pcontext = &internal_class->context;
+		}
+	      else
+		{
+		  pcontext = NULL;
 		}
 
-	      force_count = 0;
+	      mvcc_upddel_reev_data.curr_extra_assign_reev = internal_class->mvcc_extra_assign_reev;
+	      mvcc_upddel_reev_data.curr_extra_assign_cnt = internal_class->extra_assign_reev_cnt;
+	      mvcc_upddel_reev_data.curr_assigns = internal_class->mvcc_reev_assigns;
+	      mvcc_upddel_reev_data.curr_attrinfo = &internal_class->attr_info;
 	      error =
-		locator_attribute_info_force (thread_p, internal_class->class_hfid, oid, NULL, NULL, 0, LC_FLUSH_DELETE,
-					      op_type, internal_class->scan_cache, &force_count, false,
-					      REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL,
-					      &mvcc_reev_data, UPDATE_INPLACE_NONE, NULL, need_locking);
+		locator_attribute_info_force (thread_p, internal_class->class_hfid, oid, &internal_class->attr_info,
+					      &upd_cls->att_id[internal_class->subclass_idx * upd_cls->no_attrs],
+					      upd_cls->no_attrs, LC_FLUSH_UPDATE, op_type, internal_class->scan_cache,
+					      &force_count, false, repl_info, internal_class->needs_pruning, pcontext,
+					      NULL, &mvcc_reev_data, UPDATE_INPLACE_NONE, NULL, need_locking);
 	      if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
 		{
 		  error = NO_ERROR;
 		}
+	      else if (error == ER_HEAP_UNKNOWN_OBJECT)
+		{
+		  /* TODO: This is a very dangerous. A different way of handling it must be found.
+		   *       This may not even be necessary. I guess this is legacy code from READ COMMITTED
+		   *       re-evaluation made under locator_attribute_info_force. I think currently locking object
+		   *       is done on select phase. However, I am not removing this code yet until more investigation
+		   *       is done.
+		   */
+		  er_clear ();
+		  error = NO_ERROR;
+		}
 	      else if (error != NO_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
-	      else if (force_count)
+	      else
 		{
-		  xasl->list_id->tuple_cnt++;
+		  /* Successful update. */
+		  force_count = 1;
 		}
-	    }
 
-	  while (val_list)
-	    {
-	      valp = val_list->val;
-	      if (!db_value_is_null (valp))
+	      /* Instances are not put into the result list file, but are counted. */
+	      if (force_count)
 		{
-		  DB_ELO *elo;
-		  int error = NO_ERROR;
-
-		  assert (db_value_type (valp) == DB_TYPE_BLOB || db_value_type (valp) == DB_TYPE_CLOB);
-		  elo = db_get_elo (valp);
-		  if (elo)
-		    {
-		      error = db_elo_delete (elo);
-		    }
-		  pr_clear_value (valp);
-		  if (error < NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
+		  xasl->list_id->tuple_cnt++;
 		}
-
-	      val_list = val_list->next;
 	    }
+	continue_scan:;
 	}
       if (ls_scan != S_END)
 	{
@@ -9806,28 +9908,34 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
       GOTO_EXIT_ON_ERROR;
     }
 
-  /* reflect local statistical information into transaction's statistical information */
   for (s = 0; s < class_oid_cnt; s++)
     {
-      internal_class = internal_classes + s;
-      query_class = delete_->classes + s;
-      if (internal_classes[s].needs_pruning)
-	{
-	  error = qexec_process_partition_unique_stats (thread_p, &internal_class->context);
-	}
-      else
+      internal_class = &internal_classes[s];
+      upd_cls = &update->classes[s];
+
+      if (upd_cls->has_uniques)
 	{
-	  error = qexec_process_unique_stats (thread_p, query_class->class_oid, internal_class);
-	}
-      if (error != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
+	  if (internal_class->needs_pruning)
+	    {
+	      error = qexec_process_partition_unique_stats (thread_p, &internal_class->context);
+	    }
+	  else
+	    {
+	      error = qexec_process_unique_stats (thread_p, upd_cls->class_oid, internal_class);
+	    }
+	  if (error != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
 	}
     }
 
   qexec_close_scan (thread_p, specp);
 
-  qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
+  if (has_delete)
+    {
+      qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
+    }
 
   if (internal_classes)
     {
@@ -9840,6 +9948,11 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
       db_private_free (thread_p, mvcc_reev_classes);
       mvcc_reev_classes = NULL;
     }
+  if (mvcc_reev_assigns != NULL)
+    {
+      db_private_free (thread_p, mvcc_reev_assigns);
+      mvcc_reev_assigns = NULL;
+    }
   if (mvcc_upddel_reev_data.copyarea != NULL)
     {
       locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
@@ -9857,15 +9970,15 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 
 #if 0				/* yaw */
   /* remove query result cache entries which are relevant with this class */
-  class_oid = XASL_DELETE_CLASS_OID (xasl);
+  class_oid = update->class_oid;
   if (!QFILE_IS_LIST_CACHE_DISABLED && class_oid)
     {
-      for (s = 0; s < XASL_DELETE_NO_CLASSES (xasl); s++, class_oid++)
+      for (s = 0; s < update->no_classes; s++, class_oid++)
 	{
 	  if (qexec_clear_list_cache_by_class (class_oid) != NO_ERROR)
 	    {
 	      er_log_debug (ARG_FILE_LINE,
-			    "qexec_execute_delete: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
+			    "qexec_execute_update: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
 			    class_oid->pageid, class_oid->slotid, class_oid->volid);
 	    }
 	}
@@ -9876,23 +9989,23 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
   return NO_ERROR;
 
 exit_on_error:
+
   if (scan_open)
     {
       qexec_end_scan (thread_p, specp);
       qexec_close_scan (thread_p, specp);
     }
 
-  if (internal_classes)
-    {
-      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
-      db_private_free_and_init (thread_p, internal_classes);
-    }
-
   if (mvcc_reev_classes != NULL)
     {
       db_private_free (thread_p, mvcc_reev_classes);
       mvcc_reev_classes = NULL;
     }
+  if (mvcc_reev_assigns != NULL)
+    {
+      db_private_free (thread_p, mvcc_reev_assigns);
+      mvcc_reev_assigns = NULL;
+    }
   if (mvcc_upddel_reev_data.copyarea != NULL)
     {
       locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
@@ -9904,1357 +10017,2046 @@ exit_on_error:
       xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
     }
 
+  if (internal_classes)
+    {
+      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
+      db_private_free_and_init (thread_p, internal_classes);
+    }
+
   return ER_FAILED;
 }
 
 /*
- * qexec_create_delete_lob_info () - creates a new DEL_LOB_INFO object using
- *			data from class_info
- *
- * thread_p (in)      :
- * xasl_state (in)    :
- * class_info (in)    :
- *
- * return	      : new DEL_LOB_INFO object
+ * qexec_update_btree_unique_stats_info () - updates statistical information
+ *	structure
+ *   return: NO_ERROR or ER_code
+ *   thread_p(in)   :
+ *   info(in)     : structure to update
  */
-static DEL_LOB_INFO *
-qexec_create_delete_lob_info (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, UPDDEL_CLASS_INFO_INTERNAL * class_info)
+static int
+qexec_update_btree_unique_stats_info (THREAD_ENTRY * thread_p, BTREE_UNIQUE_STATS_UPDATE_INFO * info)
 {
-  DEL_LOB_INFO *del_lob_info;
-
-  del_lob_info = (DEL_LOB_INFO *) db_private_alloc (thread_p, sizeof (DEL_LOB_INFO));
-  if (!del_lob_info)
-    {
-      qexec_failure_line (__LINE__, xasl_state);
-      goto error;
-    }
-
-  del_lob_info->class_oid = class_info->class_oid;
-  del_lob_info->class_hfid = class_info->class_hfid;
+  int s, t;
+  BTREE_UNIQUE_STATS *temp_info = NULL;
+  int malloc_size;
+  char *ptr;
+  BTREE_UNIQUE_STATS *unique_stat_info = info->unique_stat_info;
+  HEAP_SCANCACHE *scan_cache = &info->scan_cache;
+  int num_unique_btrees = info->num_unique_btrees;
+  int max_unique_btrees = info->max_unique_btrees;
 
-  if (heap_attrinfo_start (thread_p, class_info->class_oid, class_info->no_lob_attrs, class_info->lob_attr_ids,
-			   &del_lob_info->attr_info) != NO_ERROR)
+  for (s = 0; s < scan_cache->num_btids; s++)
     {
-      goto error;
-    }
-
-  del_lob_info->next = NULL;
-
-  return del_lob_info;
+      temp_info = &(scan_cache->index_stat_info[s]);
+      if (temp_info->num_nulls == 0 && temp_info->num_keys == 0 && temp_info->num_oids == 0)
+	{
+	  continue;
+	}
+      /* non-unique index would be filtered out at above statement. */
 
-error:
-  if (del_lob_info)
-    {
-      db_private_free (thread_p, del_lob_info);
-    }
-  return NULL;
+      for (t = 0; t < num_unique_btrees; t++)
+	{
+	  if (BTID_IS_EQUAL (&temp_info->btid, &unique_stat_info[t].btid))
+	    {
+	      break;
+	    }
+	}
+      if (t < num_unique_btrees)
+	{
+	  /* The same unique index has been found */
+	  unique_stat_info[t].num_nulls += temp_info->num_nulls;
+	  unique_stat_info[t].num_keys += temp_info->num_keys;
+	  unique_stat_info[t].num_oids += temp_info->num_oids;
+	}
+      else
+	{
+	  /* The same unique index has not been found */
+	  if (num_unique_btrees == max_unique_btrees)
+	    {
+	      /* need more space for storing the local stat info */
+	      max_unique_btrees += UNIQUE_STAT_INFO_INCREMENT;
+	      malloc_size = sizeof (BTREE_UNIQUE_STATS) * max_unique_btrees;
+	      ptr = (char *) db_private_realloc (thread_p, unique_stat_info, malloc_size);
+	      if (ptr == NULL)
+		{
+		  info->num_unique_btrees = num_unique_btrees;
+		  return ER_FAILED;
+		}
+	      unique_stat_info = (BTREE_UNIQUE_STATS *) ptr;
+	      info->unique_stat_info = unique_stat_info;
+	      info->max_unique_btrees = max_unique_btrees;
+	    }
+	  t = num_unique_btrees;
+	  BTID_COPY (&unique_stat_info[t].btid, &temp_info->btid);
+	  unique_stat_info[t].num_nulls = temp_info->num_nulls;
+	  unique_stat_info[t].num_keys = temp_info->num_keys;
+	  unique_stat_info[t].num_oids = temp_info->num_oids;
+	  num_unique_btrees++;	/* increment */
+	}
+    }				/* for */
+  info->num_unique_btrees = num_unique_btrees;
+  return NO_ERROR;
 }
 
+
 /*
- * qexec_change_delete_lob_info () - When the class_oid of the tuple that
- *		needs to be deleted changes, also the current DEL_LOB_INFO
- *		needs to be changed. This can also be used to initialize
- *		the list
- *
- * thread_p (in)	    :
- * xasl_state (in)	    :
- * class_info (in)	    :
- * del_lob_info_list_ptr    : pointer to current list of DEL_LOB_INFO
- *
- * return		    : DEL_LOB_INFO object specific to current class_info
+ * qexec_process_unique_stats () - verify unique statistic information for
+ *				   a class hierarchy and update index
+ * return : error code or NO_ERROR
+ * thread_p (in) :
+ * class_oid (in) :
+ * internal_class (in) :
  */
-static DEL_LOB_INFO *
-qexec_change_delete_lob_info (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, UPDDEL_CLASS_INFO_INTERNAL * class_info,
-			      DEL_LOB_INFO ** del_lob_info_list_ptr)
+static int
+qexec_process_unique_stats (THREAD_ENTRY * thread_p, OID * class_oid, UPDDEL_CLASS_INFO_INTERNAL * internal_class)
 {
-  DEL_LOB_INFO *del_lob_info_list = *del_lob_info_list_ptr;
-  DEL_LOB_INFO *del_lob_info = NULL;
-
-  assert (del_lob_info_list_ptr != NULL);
-  del_lob_info_list = *del_lob_info_list_ptr;
+  BTREE_UNIQUE_STATS *unique_stat_info, *unique_stat1 = NULL;
+  int error = NO_ERROR, i;
 
-  if (del_lob_info_list == NULL)
+  if (internal_class->unique_stats.scan_cache_inited)
     {
-      /* create new DEL_LOB_INFO */
-      del_lob_info_list = qexec_create_delete_lob_info (thread_p, xasl_state, class_info);
-      *del_lob_info_list_ptr = del_lob_info_list;
-      return del_lob_info_list;
+      /* Accumulate current statistics */
+      error = qexec_update_btree_unique_stats_info (thread_p, &internal_class->unique_stats);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
     }
 
-  /* verify if a DEL_LOB_INFO for current class_oid already exists */
-  for (del_lob_info = del_lob_info_list; del_lob_info; del_lob_info = del_lob_info->next)
+  unique_stat_info = internal_class->unique_stats.unique_stat_info;
+
+  /* When uniqueness checking based on each local statistical information turns out as valid, the local statistical
+   * information must be reflected into the global statistical information kept in the root page of corresponding
+   * unique index. */
+  for (i = 0; i < internal_class->unique_stats.num_unique_btrees; i++)
     {
-      if (del_lob_info->class_oid == class_info->class_oid)
+      unique_stat1 = &unique_stat_info[i];
+      /* If local statistical information is not valid, skip it. */
+      if (unique_stat1->num_nulls == 0 && unique_stat1->num_keys == 0 && unique_stat1->num_oids == 0)
 	{
-	  /* found */
-	  return del_lob_info;
+	  /* no modification : non-unique index */
+	  continue;
+	}
+      /* uniqueness checking based on local statistical information */
+      if ((unique_stat1->num_nulls + unique_stat1->num_keys) != unique_stat1->num_oids)
+	{
+	  BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, NULL, NULL, class_oid, &unique_stat1->btid, NULL);
+	  return ER_FAILED;
 	}
-    }
 
-  /* create a new DEL_LOB_INFO */
-  del_lob_info = qexec_create_delete_lob_info (thread_p, xasl_state, class_info);
-  if (!del_lob_info)
-    {
-      return NULL;
+      /* In MVCC, at this point, we will update only in-memory statistics */
+      error =
+	logtb_tran_update_unique_stats (thread_p, &unique_stat1->btid, unique_stat1->num_keys, unique_stat1->num_oids,
+					unique_stat1->num_nulls, true);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
     }
-  del_lob_info->next = del_lob_info_list;
-  del_lob_info_list = del_lob_info;
-  *del_lob_info_list_ptr = del_lob_info_list;
-
-  return del_lob_info_list;
+  return NO_ERROR;
 }
 
 /*
- * qexec_free_delete_lob_info_list () - frees the list of DEL_LOB_INFO
- *	      created for deleting lob files.
- *
- * thread_p (in)	  :
- * del_lob_info_list_ptr  : pointer to the list of DEL_LOB_INFO structures
+ * qexec_process_partition_unique_stats () - process unique statistics on a
+ *					     partitioned class
+ * return : error code or NO_ERROR
+ * thread_p (in) :
+ * pcontext (in) :
  *
- * NOTE: also all HEAP_CACHE_ATTRINFO must be ended
+ * Note: Since unique indexes for partitioned classes are either local or
+ *    global, it's to expensive to use the validation made on normal class
+ *    hierarchies. This function just reflects the unique statistics to the
+ *    index header
  */
-static void
-qexec_free_delete_lob_info_list (THREAD_ENTRY * thread_p, DEL_LOB_INFO ** del_lob_info_list_ptr)
+static int
+qexec_process_partition_unique_stats (THREAD_ENTRY * thread_p, PRUNING_CONTEXT * pcontext)
 {
-  DEL_LOB_INFO *del_lob_info_list;
-  DEL_LOB_INFO *del_lob_info, *next_del_lob_info;
-
-  if (!del_lob_info_list_ptr)
-    {
-      /* invalid pointer, nothing to free */
-      return;
-    }
+  PRUNING_SCAN_CACHE *scan_cache = NULL;
+  SCANCACHE_LIST *node = NULL;
+  BTREE_UNIQUE_STATS *unique_stat_info, *unique_stat = NULL;
+  int error = NO_ERROR, i;
 
-  del_lob_info_list = *del_lob_info_list_ptr;
-  if (!del_lob_info_list)
+  for (node = pcontext->scan_cache_list; node != NULL; node = node->next)
     {
-      /* no item in the list, nothing to free */
-      return;
-    }
+      scan_cache = &node->scan_cache;
+      if (!scan_cache->is_scan_cache_started)
+	{
+	  continue;
+	}
+      unique_stat_info = scan_cache->scan_cache.index_stat_info;
+      if (unique_stat_info != NULL)
+	{
+	  for (i = 0; i < scan_cache->scan_cache.num_btids; i++)
+	    {
+	      unique_stat = &unique_stat_info[i];
+	      if (unique_stat->num_keys == 0 && unique_stat->num_nulls == 0 && unique_stat->num_oids == 0)
+		{
+		  continue;
+		}
+	      if ((unique_stat->num_nulls + unique_stat->num_keys) != unique_stat->num_oids)
+		{
+		  char *index_name = NULL;
+		  error =
+		    heap_get_indexinfo_of_btid (thread_p, &scan_cache->scan_cache.node.class_oid, &unique_stat->btid,
+						NULL, NULL, NULL, NULL, &index_name, NULL);
+		  if (error != NO_ERROR)
+		    {
+		      return error;
+		    }
 
-  del_lob_info = del_lob_info_list;
-  while (del_lob_info)
-    {
-      next_del_lob_info = del_lob_info->next;
-      /* end HEAP_CACHE_ATTRINFO first */
-      heap_attrinfo_end (thread_p, &del_lob_info->attr_info);
+		  BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, NULL, NULL, &scan_cache->scan_cache.node.class_oid,
+						    &unique_stat->btid, index_name);
 
-      db_private_free (thread_p, del_lob_info);
-      del_lob_info = next_del_lob_info;
+		  if (index_name)
+		    {
+		      free_and_init (index_name);
+		    }
+		  return ER_FAILED;
+		}
+
+	      error =
+		logtb_tran_update_unique_stats (thread_p, &unique_stat->btid, unique_stat->num_keys,
+						unique_stat->num_oids, unique_stat->num_nulls, true);
+	      if (error != NO_ERROR)
+		{
+		  return error;
+		}
+	    }
+	}
     }
-  *del_lob_info_list_ptr = NULL;
+  return NO_ERROR;
 }
 
-
 /*
- * qexec_remove_duplicates_for_replace () - Removes the objects that would
- *       generate unique index violations when inserting the given attr_info
- *       (This is used for executing REPLACE statements)
+ * qexec_execute_delete () -
  *   return: NO_ERROR or ER_code
- *   scan_cache(in):
- *   attr_info(in/out): The attribute information that will be inserted
- *   index_attr_info(in/out):
- *   idx_info(in):
- *   op_type (in): operation type
- *   pruning_type (in): one of DB_NOT_PARTITIONED_CLASS, DB_PARTITIONED_CLASS,
- *			DB_PARTITION_CLASS
- *   pcontext (in): pruning context
- *   removed_count (in/out):
+ *   xasl(in)   : XASL Tree block
+ *   xasl_state(in)     :
  */
 static int
-qexec_remove_duplicates_for_replace (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache,
-				     HEAP_CACHE_ATTRINFO * attr_info, HEAP_CACHE_ATTRINFO * index_attr_info,
-				     const HEAP_IDX_ELEMENTS_INFO * idx_info, int op_type, int pruning_type,
-				     PRUNING_CONTEXT * pcontext, int *removed_count)
+qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
 {
-  LC_COPYAREA *copyarea = NULL;
-  RECDES new_recdes;
-  int i = 0;
-  int error_code = NO_ERROR;
-  char buf[DBVAL_BUFSIZE + MAX_ALIGNMENT];
-  char *const aligned_buf = PTR_ALIGN (buf, MAX_ALIGNMENT);
-  DB_VALUE dbvalue;
-  DB_VALUE *key_dbvalue = NULL;
+#define MIN_NUM_ROWS_FOR_MULTI_DELETE   20
+
+  DELETE_PROC_NODE *delete_ = &xasl->proc.delete_;
+  SCAN_CODE xb_scan = S_END;
+  SCAN_CODE ls_scan = S_END;
+  XASL_NODE *aptr = NULL;
+  DB_VALUE *valp = NULL;
+  OID *oid = NULL;
+  OID *class_oid = NULL;
+  ACCESS_SPEC_TYPE *specp = NULL;
+  SCAN_ID *s_id = NULL;
+  LOG_LSA lsa;
+  int savepoint_used = 0;
+  int class_oid_cnt = 0, class_oid_idx = 0;
+  int cl_index = 0;
   int force_count = 0;
-  OR_INDEX *index = NULL;
-  OID unique_oid;
-  OID class_oid, pruned_oid;
-  BTID btid;
-  bool is_global_index;
-  HFID class_hfid, pruned_hfid;
-  int local_op_type = SINGLE_ROW_DELETE;
-  HEAP_SCANCACHE *local_scan_cache = NULL;
-  BTREE_SEARCH r;
+  int op_type = SINGLE_ROW_DELETE;
+  int s = 0, t = 0, error = NO_ERROR;
+  int malloc_size = 0;
+  int mvcc_reev_class_cnt = 0, mvcc_reev_class_idx = 0;
+  QPROC_DB_VALUE_LIST val_list = NULL;
+  bool scan_open = false;
+  UPDDEL_CLASS_INFO *query_class = NULL;
+  UPDDEL_CLASS_INFO_INTERNAL *internal_classes = NULL, *internal_class = NULL;
+  DEL_LOB_INFO *del_lob_info_list = NULL;
+  RECDES recdes;
+  bool btid_dup_key_locked = false;
+  MVCC_REEV_DATA mvcc_reev_data;
+  MVCC_UPDDEL_REEV_DATA mvcc_upddel_reev_data;
+  UPDDEL_MVCC_COND_REEVAL *mvcc_reev_classes = NULL, *mvcc_reev_class = NULL;
+  bool need_locking;
+  UPDDEL_CLASS_INSTANCE_LOCK_INFO class_instance_lock_info, *p_class_instance_lock_info = NULL;
 
-  *removed_count = 0;
+  /* get the snapshot, before acquiring locks, since the transaction may be blocked and we need the snapshot when
+   * delete starts, not later */
+  (void) logtb_get_mvcc_snapshot (thread_p);
 
-  DB_MAKE_NULL (&dbvalue);
+  class_oid_cnt = delete_->no_classes;
+  mvcc_reev_class_cnt = delete_->no_reev_classes;
+  SET_MVCC_UPDATE_REEV_DATA (&mvcc_reev_data, &mvcc_upddel_reev_data, V_TRUE);
 
-  if (heap_attrinfo_clear_dbvalues (index_attr_info) != NO_ERROR)
+  mvcc_upddel_reev_data.copyarea = NULL;
+
+  /* Allocate memory for oids, hfids and attributes cache info of all classes used in update */
+  error = qexec_create_internal_classes (thread_p, delete_->classes, class_oid_cnt, &internal_classes);
+  if (error != NO_ERROR)
     {
-      goto error_exit;
+      GOTO_EXIT_ON_ERROR;
     }
 
-  copyarea = locator_allocate_copy_area_by_attr_info (thread_p, attr_info, NULL, &new_recdes, -1, LOB_FLAG_EXCLUDE_LOB);
-  if (copyarea == NULL)
+  /* lock classes from which this query will delete */
+  error = qexec_set_class_locks (thread_p, xasl->aptr_list, delete_->classes, delete_->no_classes, internal_classes);
+  if (error != NO_ERROR)
     {
-      goto error_exit;
+      GOTO_EXIT_ON_ERROR;
     }
 
-  if (idx_info->has_single_col)
+  aptr = xasl->aptr_list;
+
+  error =
+    prepare_mvcc_reev_data (thread_p, aptr, xasl_state, mvcc_reev_class_cnt, delete_->mvcc_reev_classes,
+			    &mvcc_upddel_reev_data, delete_->no_classes, delete_->classes, internal_classes, 0, NULL,
+			    NULL, &mvcc_reev_classes, NULL, 0);
+  if (error != NO_ERROR)
     {
-      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid_Null_oid, &new_recdes, NULL, index_attr_info);
-      if (error_code != NO_ERROR)
-	{
-	  goto error_exit;
-	}
+      GOTO_EXIT_ON_ERROR;
     }
-  assert_release (index_attr_info->last_classrepr != NULL);
 
-  HFID_COPY (&class_hfid, &scan_cache->node.hfid);
-  COPY_OID (&class_oid, &attr_info->class_oid);
+  if (class_oid_cnt == 1 && delete_->classes->no_subclasses == 1)
+    {
+      /* We delete instances of only one class. We expect to lock the instances at select phase. However this not
+       * happens in all situations. The qexec_execute_mainblock function will set instances_locked of
+       * p_class_instance_lock_info to true in case that current class instances are locked at select phase. */
+      COPY_OID (&class_instance_lock_info.class_oid, (*((*delete_).classes)).class_oid);
+      class_instance_lock_info.instances_locked = false;
+      p_class_instance_lock_info = &class_instance_lock_info;
+    }
 
-  local_scan_cache = scan_cache;
-  local_op_type = BTREE_IS_MULTI_ROW_OP (op_type) ? MULTI_ROW_DELETE : SINGLE_ROW_DELETE;
+  if (qexec_execute_mainblock (thread_p, aptr, xasl_state, p_class_instance_lock_info) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
 
-  for (i = 0; i < idx_info->num_btids; ++i)
+  if (p_class_instance_lock_info && p_class_instance_lock_info->instances_locked)
     {
-      is_global_index = false;
-      index = &(index_attr_info->last_classrepr->indexes[i]);
-      if (!btree_is_unique_type (index->type))
-	{
-	  continue;
-	}
+      /* already locked in select phase. Avoid locking again the same instances at delete phase. */
+      need_locking = false;
+    }
+  else
+    {
+      /* not locked in select phase, need locking at update phase */
+      need_locking = true;
+    }
 
-      COPY_OID (&pruned_oid, &class_oid);
-      HFID_COPY (&pruned_hfid, &class_hfid);
-      BTID_COPY (&btid, &index->btid);
-      key_dbvalue =
-	heap_attrvalue_get_key (thread_p, i, index_attr_info, &new_recdes, &btid, &dbvalue, aligned_buf, NULL, NULL);
-      /* TODO: unique with prefix length */
-      if (key_dbvalue == NULL)
-	{
-	  goto error_exit;
-	}
+  /* This guarantees that the result list file will have a type list. Copying a list_id structure fails unless it has a 
+   * type list. */
+  if ((qexec_setup_list_id (thread_p, xasl) != NO_ERROR)
+      /* it can be > 2 || (aptr->list_id->type_list.type_cnt != 2) */ )
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
 
-      if (pruning_type != DB_NOT_PARTITIONED_CLASS)
-	{
-	  if (pcontext == NULL)
-	    {
-	      assert (false);
-	      goto error_exit;
-	    }
-	  error_code = partition_prune_unique_btid (pcontext, key_dbvalue, &pruned_oid, &pruned_hfid, &btid);
-	  if (error_code != NO_ERROR)
-	    {
-	      goto error_exit;
-	    }
-	}
 
-      OID_SET_NULL (&unique_oid);
+  /* Allocate and init structures for statistical information */
+  if (aptr->list_id->tuple_cnt > MIN_NUM_ROWS_FOR_MULTI_DELETE)
+    {
+      op_type = MULTI_ROW_DELETE;
+    }
+  else
+    {
+      /* When the number of instances to be deleted is small, SINGLE_ROW_DELETE operation would be better, I guess.. */
+      op_type = SINGLE_ROW_DELETE;
+    }
 
-      r = xbtree_find_unique (thread_p, &btid, S_DELETE, key_dbvalue, &pruned_oid, &unique_oid, is_global_index);
+  /* need to start a topop to ensure statement atomicity. One delete statement might update several disk images. For
+   * example, one row delete might update zero or more index keys, one heap record, catalog info of object count, and
+   * other things. So, the delete statement must be performed atomically. */
+  if (xtran_server_start_topop (thread_p, &lsa) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
 
-      if (r == BTREE_KEY_FOUND)
-	{
-	  if (pruning_type != DB_NOT_PARTITIONED_CLASS)
-	    {
-	      COPY_OID (&attr_info->inst_oid, &unique_oid);
-	    }
+  savepoint_used = 1;
 
-	  if (pruning_type && BTREE_IS_MULTI_ROW_OP (op_type))
-	    {
-	      /* need to provide appropriate scan_cache to locator_delete_force in order to correctly compute
-	       * statistics */
-	      PRUNING_SCAN_CACHE *pruning_cache;
+  specp = xasl->spec_list;
+  assert (xasl->scan_op_type == S_SELECT);
+  /* force_select_lock = false */
+  if (qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state->vd, false, specp->fixed_scan, specp->grouped_scan,
+		       true, &specp->s_id, xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
 
-	      pruning_cache =
-		locator_get_partition_scancache (pcontext, &pruned_oid, &pruned_hfid, local_op_type, false);
-	      if (pruning_cache == NULL)
+  scan_open = true;
+
+  while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
+    {
+      s_id = &xasl->curr_spec->s_id;
+
+      while ((ls_scan = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
+	{
+	  val_list = s_id->val_list->valp;
+
+	  /* Get info for MVCC condition reevaluation */
+	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0;
+	       class_oid_idx < class_oid_cnt || mvcc_reev_class_idx < mvcc_reev_class_cnt;
+	       val_list = val_list->next->next, class_oid_idx++)
+	    {
+	      if (mvcc_reev_class_idx < mvcc_reev_class_cnt
+		  && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
 		{
-		  assert (er_errid () != NO_ERROR);
+		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
+		}
+	      else
+		{
+		  mvcc_reev_class = NULL;
+		}
 
-		  error_code = er_errid ();
-		  if (error_code == NO_ERROR)
+	      valp = val_list->val;
+	      if (valp == NULL)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      if (DB_IS_NULL (valp))
+		{
+		  if (class_oid_idx < class_oid_cnt)
 		    {
-		      error_code = ER_FAILED;
+		      internal_class = &internal_classes[class_oid_idx];
+		      internal_class->class_oid = NULL;
+		      internal_class->oid = NULL;
 		    }
-		  goto error_exit;
+		  continue;
 		}
+	      oid = DB_GET_OID (valp);
 
-	      local_scan_cache = &pruning_cache->scan_cache;
-	    }
+	      /* class OID */
+	      valp = val_list->next->val;
+	      if (valp == NULL)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      if (DB_IS_NULL (valp))
+		{
+		  if (class_oid_idx < class_oid_cnt)
+		    {
+		      internal_classes[class_oid_idx].class_oid = NULL;
+		    }
+		  continue;
+		}
+	      class_oid = DB_GET_OID (valp);
 
-	  /* last version was already locked and returned by xbtree_find_unique() */
-	  error_code = locator_delete_lob_force (thread_p, &pruned_oid, &unique_oid, NULL);
-	  if (error_code != NO_ERROR)
-	    {
-	      goto error_exit;
-	    }
+	      if (class_oid_idx < class_oid_cnt)
+		{
+		  internal_class = &internal_classes[class_oid_idx];
 
-	  force_count = 0;
-	  /* The object was locked during find unique */
-	  error_code =
-	    locator_attribute_info_force (thread_p, &pruned_hfid, &unique_oid, NULL, NULL, 0, LC_FLUSH_DELETE,
-					  local_op_type, local_scan_cache, &force_count, false,
-					  REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL, NULL,
-					  UPDATE_INPLACE_NONE, NULL, false);
+		  internal_class->oid = oid;
 
-	  if (error_code == ER_MVCC_NOT_SATISFIED_REEVALUATION)
-	    {
-	      error_code = NO_ERROR;
-	    }
-	  else if (error_code != NO_ERROR)
-	    {
-	      goto error_exit;
-	    }
-	  else if (force_count != 0)
-	    {
-	      assert (force_count == 1);
-	      *removed_count += force_count;
-	      force_count = 0;
+		  if (class_oid
+		      && (internal_class->class_oid == NULL || !OID_EQ (internal_class->class_oid, class_oid)))
+		    {
+		      query_class = &delete_->classes[class_oid_idx];
+
+		      /* find class HFID */
+		      error =
+			qexec_upddel_setup_current_class (thread_p, query_class, internal_class, op_type, class_oid);
+		      if (error != NO_ERROR)
+			{
+			  /* matching class oid does not exist... error */
+			  er_log_debug (ARG_FILE_LINE, "qexec_execute_delete: class OID is not correct\n");
+			  GOTO_EXIT_ON_ERROR;
+			}
+
+		      if (internal_class->no_lob_attrs)
+			{
+			  internal_class->crt_del_lob_info =
+			    qexec_change_delete_lob_info (thread_p, xasl_state, internal_class, &del_lob_info_list);
+			  if (internal_class->crt_del_lob_info == NULL)
+			    {
+			      GOTO_EXIT_ON_ERROR;
+			    }
+			}
+		      else
+			{
+			  internal_class->crt_del_lob_info = NULL;
+			}
+		    }
+		}
+
+	      if (mvcc_reev_class != NULL)
+		{
+		  /* class has changed to a new subclass */
+		  if (class_oid && !OID_EQ (&mvcc_reev_class->cls_oid, class_oid))
+		    {
+		      error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
+		      if (error != NO_ERROR)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+		    }
+		}
 	    }
-	}
-      else if (r == BTREE_ERROR_OCCURRED)
-	{
-	  if (!OID_ISNULL (&unique_oid))
+
+	  if (mvcc_upddel_reev_data.mvcc_cond_reev_list == NULL)
 	    {
-	      /* more than one OID has been found */
-	      BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, key_dbvalue, &unique_oid, &class_oid, &btid, NULL);
+	      /* If scan order was not set then do it. This operation must be run only once. We do it here and not at
+	       * the beginning of this function because the class OIDs must be set for classes involved in reevaluation 
+	       * (in mvcc_reev_classes) prior to this operation */
+	      mvcc_upddel_reev_data.mvcc_cond_reev_list =
+		qexec_mvcc_cond_reev_set_scan_order (aptr, mvcc_reev_classes, mvcc_reev_class_cnt, delete_->classes,
+						     class_oid_cnt);
 	    }
-	  goto error_exit;
-	}
-      else
-	{
-	  /* BTREE_KEY_NOTFOUND */
-	  ;			/* just go to the next one */
-	}
 
-      if (key_dbvalue == &dbvalue)
-	{
-	  pr_clear_value (&dbvalue);
-	  key_dbvalue = NULL;
-	}
-    }
+	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0; class_oid_idx < class_oid_cnt; class_oid_idx++)
+	    {
+	      internal_class = &internal_classes[class_oid_idx];
+	      oid = internal_class->oid;
+	      class_oid = internal_class->class_oid;
 
-  if (copyarea != NULL)
-    {
-      locator_free_copy_area (copyarea);
-      copyarea = NULL;
-      new_recdes.data = NULL;
-      new_recdes.area_size = 0;
-    }
+	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
+		{
+		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
+		}
+	      else
+		{
+		  mvcc_reev_class = NULL;
+		}
+	      mvcc_upddel_reev_data.curr_upddel = mvcc_reev_class;
 
-  return NO_ERROR;
+	      if (oid == NULL)
+		{
+		  continue;
+		}
 
-error_exit:
-  if (key_dbvalue == &dbvalue)
-    {
-      pr_clear_value (&dbvalue);
-      key_dbvalue = NULL;
-    }
+	      if (internal_class->crt_del_lob_info)
+		{
+		  /* delete lob files */
+		  DEL_LOB_INFO *crt_del_lob_info = internal_class->crt_del_lob_info;
+		  SCAN_CODE scan_code;
+		  int error;
+		  int i;
 
-  if (copyarea != NULL)
-    {
-      locator_free_copy_area (copyarea);
-      copyarea = NULL;
-      new_recdes.data = NULL;
-      new_recdes.area_size = 0;
-    }
+		  /* read lob attributes */
+		  scan_code = heap_get (thread_p, oid, &recdes, internal_class->scan_cache, 1, NULL_CHN);
+		  if (scan_code == S_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		  if (scan_code == S_SUCCESS)
+		    {
+		      error = heap_attrinfo_read_dbvalues (thread_p, oid, &recdes, NULL, &crt_del_lob_info->attr_info);
+		      if (error != NO_ERROR)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+		      for (i = 0; i < internal_class->no_lob_attrs; i++)
+			{
+			  DB_VALUE *attr_valp = &crt_del_lob_info->attr_info.values[i].dbvalue;
+			  if (!db_value_is_null (attr_valp))
+			    {
+			      DB_ELO *elo;
+			      error = NO_ERROR;
 
-  return ER_FAILED;
-}
+			      assert (db_value_type (attr_valp) == DB_TYPE_BLOB
+				      || db_value_type (attr_valp) == DB_TYPE_CLOB);
+			      elo = db_get_elo (attr_valp);
+			      if (elo)
+				{
+				  error = db_elo_delete (elo);
+				}
+			      if (error != NO_ERROR)
+				{
+				  GOTO_EXIT_ON_ERROR;
+				}
+			    }
+			}
+		    }
+		}
 
-/*
- * qexec_oid_of_duplicate_key_update () - Finds an OID of an object that would
- *       generate unique index violations when inserting the given attr_info
- *       (This is used for executing INSERT ON DUPLICATE KEY UPDATE
- *        statements)
- *   return: NO_ERROR or ER_code
- *   thread_p(in):
- *   pruned_partition_scan_cache(out): the real scan_cache for this oid
- *   scan_cache(in):
- *   attr_info(in/out): The attribute information that will be inserted
- *   index_attr_info(in/out):
- *   idx_info(in):
- *   pruning_type(in):
- *   pcontext(in):
- *   unique_oid_p(out): the OID of one object to be updated or a NULL OID if
- *                      there are no potential unique index violations
- *   op_type(int):
- * Note: A single OID is returned even if there are several objects that would
- *       generate unique index violations (this can only happen if there are
- *       several unique indexes).
- */
-static int
-qexec_oid_of_duplicate_key_update (THREAD_ENTRY * thread_p, HEAP_SCANCACHE ** pruned_partition_scan_cache,
-				   HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info,
-				   HEAP_CACHE_ATTRINFO * index_attr_info, const HEAP_IDX_ELEMENTS_INFO * idx_info,
-				   int pruning_type, PRUNING_CONTEXT * pcontext, OID * unique_oid_p, int op_type)
-{
-  LC_COPYAREA *copyarea = NULL;
-  RECDES recdes;
-  int i = 0;
-  int error_code = NO_ERROR;
-  char buf[DBVAL_BUFSIZE + MAX_ALIGNMENT];
-  char *const aligned_buf = PTR_ALIGN (buf, MAX_ALIGNMENT);
-  DB_VALUE dbvalue;
-  DB_VALUE *key_dbvalue = NULL;
-  bool found_duplicate = false;
-  BTID btid;
-  OR_INDEX *index;
-  OID unique_oid;
-  OID class_oid;
-  HFID class_hfid;
-  bool is_global_index = false;
-  int local_op_type = SINGLE_ROW_UPDATE;
-  BTREE_SEARCH r;
+	      force_count = 0;
+	      error =
+		locator_attribute_info_force (thread_p, internal_class->class_hfid, oid, NULL, NULL, 0, LC_FLUSH_DELETE,
+					      op_type, internal_class->scan_cache, &force_count, false,
+					      REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL,
+					      &mvcc_reev_data, UPDATE_INPLACE_NONE, NULL, need_locking);
+	      if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
+		{
+		  error = NO_ERROR;
+		}
+	      else if (error != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      else if (force_count)
+		{
+		  xasl->list_id->tuple_cnt++;
+		}
+	    }
 
-  assert (pruned_partition_scan_cache != NULL);
+	  while (val_list)
+	    {
+	      valp = val_list->val;
+	      if (!db_value_is_null (valp))
+		{
+		  DB_ELO *elo;
+		  int error = NO_ERROR;
 
-  DB_MAKE_NULL (&dbvalue);
-  OID_SET_NULL (unique_oid_p);
-  OID_SET_NULL (&unique_oid);
+		  assert (db_value_type (valp) == DB_TYPE_BLOB || db_value_type (valp) == DB_TYPE_CLOB);
+		  elo = db_get_elo (valp);
+		  if (elo)
+		    {
+		      error = db_elo_delete (elo);
+		    }
+		  pr_clear_value (valp);
+		  if (error < NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		}
 
-  if (BTREE_IS_MULTI_ROW_OP (op_type))
+	      val_list = val_list->next;
+	    }
+	}
+      if (ls_scan != S_END)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+  if (xb_scan != S_END)
     {
-      local_op_type = MULTI_ROW_UPDATE;
+      GOTO_EXIT_ON_ERROR;
     }
 
-  if (heap_attrinfo_clear_dbvalues (index_attr_info) != NO_ERROR)
+  /* reflect local statistical information into transaction's statistical information */
+  for (s = 0; s < class_oid_cnt; s++)
     {
-      goto error_exit;
+      internal_class = internal_classes + s;
+      query_class = delete_->classes + s;
+      if (internal_classes[s].needs_pruning)
+	{
+	  error = qexec_process_partition_unique_stats (thread_p, &internal_class->context);
+	}
+      else
+	{
+	  error = qexec_process_unique_stats (thread_p, query_class->class_oid, internal_class);
+	}
+      if (error != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
     }
 
-  copyarea = locator_allocate_copy_area_by_attr_info (thread_p, attr_info, NULL, &recdes, -1, LOB_FLAG_INCLUDE_LOB);
-  if (copyarea == NULL)
+  qexec_close_scan (thread_p, specp);
+
+  qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
+
+  if (internal_classes)
     {
-      goto error_exit;
+      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
+      db_private_free_and_init (thread_p, internal_classes);
     }
 
-  if (idx_info->has_single_col)
+  if (mvcc_reev_classes != NULL)
     {
-      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid_Null_oid, &recdes, NULL, index_attr_info);
-      if (error_code != NO_ERROR)
-	{
-	  goto error_exit;
-	}
+      db_private_free (thread_p, mvcc_reev_classes);
+      mvcc_reev_classes = NULL;
     }
-  assert (index_attr_info->last_classrepr != NULL);
-
-  for (i = 0; i < idx_info->num_btids && !found_duplicate; ++i)
+  if (mvcc_upddel_reev_data.copyarea != NULL)
     {
-      index = &(index_attr_info->last_classrepr->indexes[i]);
-      if (!btree_is_unique_type (index->type))
-	{
-	  continue;
-	}
-
-      COPY_OID (&class_oid, &attr_info->class_oid);
-      is_global_index = false;
+      locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
+      mvcc_upddel_reev_data.copyarea = NULL;
+    }
 
-      key_dbvalue =
-	heap_attrvalue_get_key (thread_p, i, index_attr_info, &recdes, &btid, &dbvalue, aligned_buf, NULL, NULL);
-      if (key_dbvalue == NULL)
+  if (savepoint_used)
+    {
+      if (xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ATTACH_TO_OUTER, &lsa) != TRAN_ACTIVE)
 	{
-	  goto error_exit;
+	  qexec_failure_line (__LINE__, xasl_state);
+	  return ER_FAILED;
 	}
+    }
 
-      if (pruning_type != DB_NOT_PARTITIONED_CLASS)
+#if 0				/* yaw */
+  /* remove query result cache entries which are relevant with this class */
+  class_oid = XASL_DELETE_CLASS_OID (xasl);
+  if (!QFILE_IS_LIST_CACHE_DISABLED && class_oid)
+    {
+      for (s = 0; s < XASL_DELETE_NO_CLASSES (xasl); s++, class_oid++)
 	{
-	  if (pcontext == NULL)
-	    {
-	      assert (false);
-	      goto error_exit;
-	    }
-
-	  error_code = partition_prune_unique_btid (pcontext, key_dbvalue, &class_oid, &class_hfid, &btid);
-	  if (error_code != NO_ERROR)
+	  if (qexec_clear_list_cache_by_class (class_oid) != NO_ERROR)
 	    {
-	      goto error_exit;
+	      er_log_debug (ARG_FILE_LINE,
+			    "qexec_execute_delete: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
+			    class_oid->pageid, class_oid->slotid, class_oid->volid);
 	    }
 	}
+      qmgr_add_modified_class (class_oid);
+    }
+#endif
 
-      r = xbtree_find_unique (thread_p, &btid, S_UPDATE, key_dbvalue, &class_oid, &unique_oid, is_global_index);
+  return NO_ERROR;
 
-      if (r == BTREE_KEY_FOUND)
-	{
-	  if (pruning_type != DB_NOT_PARTITIONED_CLASS)
-	    {
-	      COPY_OID (&attr_info->inst_oid, &unique_oid);
-	    }
+exit_on_error:
+  if (scan_open)
+    {
+      qexec_end_scan (thread_p, specp);
+      qexec_close_scan (thread_p, specp);
+    }
 
-	  if (pruning_type != DB_NOT_PARTITIONED_CLASS && BTREE_IS_MULTI_ROW_OP (op_type))
-	    {
-	      /* need to provide appropriate scan_cache to locator_delete_force in order to correctly compute
-	       * statistics */
-	      PRUNING_SCAN_CACHE *pruning_cache;
+  if (internal_classes)
+    {
+      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
+      db_private_free_and_init (thread_p, internal_classes);
+    }
 
-	      pruning_cache = locator_get_partition_scancache (pcontext, &class_oid, &class_hfid, local_op_type, false);
-	      if (pruning_cache == NULL)
-		{
-		  assert (er_errid () != NO_ERROR);
+  if (mvcc_reev_classes != NULL)
+    {
+      db_private_free (thread_p, mvcc_reev_classes);
+      mvcc_reev_classes = NULL;
+    }
+  if (mvcc_upddel_reev_data.copyarea != NULL)
+    {
+      locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
+      mvcc_upddel_reev_data.copyarea = NULL;
+    }
 
-		  error_code = er_errid ();
-		  if (error_code == NO_ERROR)
-		    {
-		      error_code = ER_FAILED;
-		    }
-		  goto error_exit;
-		}
+  if (savepoint_used)
+    {
+      xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
+    }
 
-	      *pruned_partition_scan_cache = &pruning_cache->scan_cache;
-	    }
+  return ER_FAILED;
+}
 
-	  /* We now hold an U_LOCK on the instance. It will be upgraded to an X_LOCK when the update is executed. */
-	  if (pruning_type == DB_PARTITION_CLASS)
-	    {
-	      if (!OID_EQ (&class_oid, &pcontext->selected_partition->class_oid))
-		{
-		  /* found a duplicate OID but not in the right partition */
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INVALID_DATA_FOR_PARTITION, 0);
-		  goto error_exit;
-		}
-	    }
+/*
+ * qexec_create_delete_lob_info () - creates a new DEL_LOB_INFO object using
+ *			data from class_info
+ *
+ * thread_p (in)      :
+ * xasl_state (in)    :
+ * class_info (in)    :
+ *
+ * return	      : new DEL_LOB_INFO object
+ */
+static DEL_LOB_INFO *
+qexec_create_delete_lob_info (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, UPDDEL_CLASS_INFO_INTERNAL * class_info)
+{
+  DEL_LOB_INFO *del_lob_info;
 
-	  found_duplicate = true;
-	  COPY_OID (unique_oid_p, &unique_oid);
-	}
-      else if (r == BTREE_ERROR_OCCURRED)
-	{
-	  if (!OID_ISNULL (&unique_oid))
-	    {
-	      /* more than one OID has been found */
-	      BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, key_dbvalue, &unique_oid, &class_oid, &btid, NULL);
-	    }
-	  goto error_exit;
-	}
-      else
-	{
-	  /* BTREE_KEY_NOTFOUND */
-	  ;			/* just go to the next one */
-	}
+  del_lob_info = (DEL_LOB_INFO *) db_private_alloc (thread_p, sizeof (DEL_LOB_INFO));
+  if (!del_lob_info)
+    {
+      qexec_failure_line (__LINE__, xasl_state);
+      goto error;
+    }
 
-      if (key_dbvalue == &dbvalue)
+  del_lob_info->class_oid = class_info->class_oid;
+  del_lob_info->class_hfid = class_info->class_hfid;
+
+  if (heap_attrinfo_start (thread_p, class_info->class_oid, class_info->no_lob_attrs, class_info->lob_attr_ids,
+			   &del_lob_info->attr_info) != NO_ERROR)
+    {
+      goto error;
+    }
+
+  del_lob_info->next = NULL;
+
+  return del_lob_info;
+
+error:
+  if (del_lob_info)
+    {
+      db_private_free (thread_p, del_lob_info);
+    }
+  return NULL;
+}
+
+/*
+ * qexec_change_delete_lob_info () - When the class_oid of the tuple that
+ *		needs to be deleted changes, also the current DEL_LOB_INFO
+ *		needs to be changed. This can also be used to initialize
+ *		the list
+ *
+ * thread_p (in)	    :
+ * xasl_state (in)	    :
+ * class_info (in)	    :
+ * del_lob_info_list_ptr    : pointer to current list of DEL_LOB_INFO
+ *
+ * return		    : DEL_LOB_INFO object specific to current class_info
+ */
+static DEL_LOB_INFO *
+qexec_change_delete_lob_info (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, UPDDEL_CLASS_INFO_INTERNAL * class_info,
+			      DEL_LOB_INFO ** del_lob_info_list_ptr)
+{
+  DEL_LOB_INFO *del_lob_info_list = *del_lob_info_list_ptr;
+  DEL_LOB_INFO *del_lob_info = NULL;
+
+  assert (del_lob_info_list_ptr != NULL);
+  del_lob_info_list = *del_lob_info_list_ptr;
+
+  if (del_lob_info_list == NULL)
+    {
+      /* create new DEL_LOB_INFO */
+      del_lob_info_list = qexec_create_delete_lob_info (thread_p, xasl_state, class_info);
+      *del_lob_info_list_ptr = del_lob_info_list;
+      return del_lob_info_list;
+    }
+
+  /* verify if a DEL_LOB_INFO for current class_oid already exists */
+  for (del_lob_info = del_lob_info_list; del_lob_info; del_lob_info = del_lob_info->next)
+    {
+      if (del_lob_info->class_oid == class_info->class_oid)
 	{
-	  pr_clear_value (&dbvalue);
-	  key_dbvalue = NULL;
+	  /* found */
+	  return del_lob_info;
 	}
     }
 
-  if (copyarea != NULL)
+  /* create a new DEL_LOB_INFO */
+  del_lob_info = qexec_create_delete_lob_info (thread_p, xasl_state, class_info);
+  if (!del_lob_info)
     {
-      locator_free_copy_area (copyarea);
-      copyarea = NULL;
-      recdes.data = NULL;
-      recdes.area_size = 0;
+      return NULL;
     }
+  del_lob_info->next = del_lob_info_list;
+  del_lob_info_list = del_lob_info;
+  *del_lob_info_list_ptr = del_lob_info_list;
 
-  return NO_ERROR;
+  return del_lob_info_list;
+}
 
-error_exit:
-  if (key_dbvalue == &dbvalue)
+/*
+ * qexec_free_delete_lob_info_list () - frees the list of DEL_LOB_INFO
+ *	      created for deleting lob files.
+ *
+ * thread_p (in)	  :
+ * del_lob_info_list_ptr  : pointer to the list of DEL_LOB_INFO structures
+ *
+ * NOTE: also all HEAP_CACHE_ATTRINFO must be ended
+ */
+static void
+qexec_free_delete_lob_info_list (THREAD_ENTRY * thread_p, DEL_LOB_INFO ** del_lob_info_list_ptr)
+{
+  DEL_LOB_INFO *del_lob_info_list;
+  DEL_LOB_INFO *del_lob_info, *next_del_lob_info;
+
+  if (!del_lob_info_list_ptr)
     {
-      pr_clear_value (&dbvalue);
-      key_dbvalue = NULL;
+      /* invalid pointer, nothing to free */
+      return;
     }
 
-  if (copyarea != NULL)
+  del_lob_info_list = *del_lob_info_list_ptr;
+  if (!del_lob_info_list)
     {
-      locator_free_copy_area (copyarea);
-      copyarea = NULL;
-      recdes.data = NULL;
-      recdes.area_size = 0;
+      /* no item in the list, nothing to free */
+      return;
     }
 
-  return ER_FAILED;
+  del_lob_info = del_lob_info_list;
+  while (del_lob_info)
+    {
+      next_del_lob_info = del_lob_info->next;
+      /* end HEAP_CACHE_ATTRINFO first */
+      heap_attrinfo_end (thread_p, &del_lob_info->attr_info);
+
+      db_private_free (thread_p, del_lob_info);
+      del_lob_info = next_del_lob_info;
+    }
+  *del_lob_info_list_ptr = NULL;
 }
 
+
 /*
- * qexec_execute_duplicate_key_update () - Executes an update on a given OID
- *       (required by INSERT ON DUPLICATE KEY UPDATE processing)
+ * qexec_remove_duplicates_for_replace () - Removes the objects that would
+ *       generate unique index violations when inserting the given attr_info
+ *       (This is used for executing REPLACE statements)
  *   return: NO_ERROR or ER_code
- *   thread_p(in) :
- *   odku(in) : on duplicate key update clause info
- *   hfid(in) : class HFID
- *   vd(in) : values descriptor
- *   op_type(in): operation type
- *   scan_cache(in): scan cache
- *   attr_info(in): attribute cache info
- *   index_attr_info(in): attribute info cache for indexes
- *   idx_info(in): index info
- *   pruning_type(in): pruning type
- *   pcontext(in): pruning context
- *   force_count(out): the number of objects that have been updated; it should
- *                     always be 1 on success and 0 on error
+ *   scan_cache(in):
+ *   attr_info(in/out): The attribute information that will be inserted
+ *   index_attr_info(in/out):
+ *   idx_info(in):
+ *   op_type (in): operation type
+ *   pruning_type (in): one of DB_NOT_PARTITIONED_CLASS, DB_PARTITIONED_CLASS,
+ *			DB_PARTITION_CLASS
+ *   pcontext (in): pruning context
+ *   removed_count (in/out):
  */
 static int
-qexec_execute_duplicate_key_update (THREAD_ENTRY * thread_p, ODKU_INFO * odku, HFID * hfid, VAL_DESCR * vd, int op_type,
-				    HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info,
-				    HEAP_CACHE_ATTRINFO * index_attr_info, HEAP_IDX_ELEMENTS_INFO * idx_info,
-				    int pruning_type, PRUNING_CONTEXT * pcontext, int *force_count)
+qexec_remove_duplicates_for_replace (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache,
+				     HEAP_CACHE_ATTRINFO * attr_info, HEAP_CACHE_ATTRINFO * index_attr_info,
+				     const HEAP_IDX_ELEMENTS_INFO * idx_info, int op_type, int pruning_type,
+				     PRUNING_CONTEXT * pcontext, int *removed_count)
 {
-  int stat = NO_ERROR;
-  int satisfies_constraints;
-  int assign_idx;
-  UPDATE_ASSIGNMENT *assign;
-  RECDES rec_descriptor = { 0, -1, REC_HOME, NULL };
-  SCAN_CODE scan_code;
-  DB_VALUE *val = NULL;
-  REPL_INFO_TYPE repl_info = REPL_INFO_TYPE_RBR_NORMAL;
-  int error = NO_ERROR;
-  bool need_clear = 0;
+  LC_COPYAREA *copyarea = NULL;
+  RECDES new_recdes;
+  int i = 0;
+  int error_code = NO_ERROR;
+  char buf[DBVAL_BUFSIZE + MAX_ALIGNMENT];
+  char *const aligned_buf = PTR_ALIGN (buf, MAX_ALIGNMENT);
+  DB_VALUE dbvalue;
+  DB_VALUE *key_dbvalue = NULL;
+  int force_count = 0;
+  OR_INDEX *index = NULL;
   OID unique_oid;
-  int local_op_type = SINGLE_ROW_UPDATE;
+  OID class_oid, pruned_oid;
+  BTID btid;
+  bool is_global_index;
+  HFID class_hfid, pruned_hfid;
+  int local_op_type = SINGLE_ROW_DELETE;
   HEAP_SCANCACHE *local_scan_cache = NULL;
-  int ispeeking;
-
-  OID_SET_NULL (&unique_oid);
+  BTREE_SEARCH r;
 
-  local_scan_cache = scan_cache;
+  *removed_count = 0;
 
-  error =
-    qexec_oid_of_duplicate_key_update (thread_p, &local_scan_cache, scan_cache, attr_info, index_attr_info, idx_info,
-				       pruning_type, pcontext, &unique_oid, op_type);
-  if (error != NO_ERROR)
-    {
-      ASSERT_ERROR ();
-      goto exit_on_error;
-    }
+  DB_MAKE_NULL (&dbvalue);
 
-  if (OID_ISNULL (&unique_oid))
+  if (heap_attrinfo_clear_dbvalues (index_attr_info) != NO_ERROR)
     {
-      *force_count = 0;
-      return NO_ERROR;
+      goto error_exit;
     }
 
-  /* get attribute values */
-  ispeeking = ((local_scan_cache != NULL && local_scan_cache->cache_last_fix_page) ? PEEK : COPY);
-
-  scan_code = heap_get (thread_p, &unique_oid, &rec_descriptor, local_scan_cache, ispeeking, NULL_CHN);
-  if (scan_code != S_SUCCESS)
+  copyarea = locator_allocate_copy_area_by_attr_info (thread_p, attr_info, NULL, &new_recdes, -1, LOB_FLAG_EXCLUDE_LOB);
+  if (copyarea == NULL)
     {
-      assert (er_errid () == ER_INTERRUPTED);
-      error = ER_FAILED;
-      goto exit_on_error;
+      goto error_exit;
     }
 
-  /* setup operation type and handle partition representation id */
-  if (pruning_type == DB_PARTITIONED_CLASS)
+  if (idx_info->has_single_col)
     {
-      /* modify rec_descriptor representation id to that of attr_info */
-      assert (OID_EQ (&attr_info->class_oid, &pcontext->root_oid));
-
-      if (OID_ISNULL (&attr_info->inst_oid))
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid_Null_oid, &new_recdes, NULL, index_attr_info);
+      if (error_code != NO_ERROR)
 	{
-	  or_set_rep_id (&rec_descriptor, pcontext->root_repr_id);
+	  goto error_exit;
 	}
-
-      local_op_type = (BTREE_IS_MULTI_ROW_OP (op_type) ? MULTI_ROW_UPDATE : SINGLE_ROW_UPDATE);
-    }
-
-  error = heap_attrinfo_read_dbvalues (thread_p, &unique_oid, &rec_descriptor, local_scan_cache, odku->attr_info);
-  if (error != NO_ERROR)
-    {
-      ASSERT_ERROR ();
-      goto exit_on_error;
     }
+  assert_release (index_attr_info->last_classrepr != NULL);
 
-  need_clear = true;
+  HFID_COPY (&class_hfid, &scan_cache->node.hfid);
+  COPY_OID (&class_oid, &attr_info->class_oid);
 
-  /* evaluate constraint predicate */
-  satisfies_constraints = V_UNKNOWN;
-  if (odku->cons_pred != NULL)
+  local_scan_cache = scan_cache;
+  local_op_type = BTREE_IS_MULTI_ROW_OP (op_type) ? MULTI_ROW_DELETE : SINGLE_ROW_DELETE;
+
+  for (i = 0; i < idx_info->num_btids; ++i)
     {
-      satisfies_constraints = eval_pred (thread_p, odku->cons_pred, vd, NULL);
-      if (satisfies_constraints == V_ERROR)
+      is_global_index = false;
+      index = &(index_attr_info->last_classrepr->indexes[i]);
+      if (!btree_is_unique_type (index->type))
 	{
-	  ASSERT_ERROR_AND_SET (error);
-	  goto exit_on_error;
+	  continue;
 	}
 
-      if (satisfies_constraints != V_TRUE)
+      COPY_OID (&pruned_oid, &class_oid);
+      HFID_COPY (&pruned_hfid, &class_hfid);
+      BTID_COPY (&btid, &index->btid);
+      key_dbvalue =
+	heap_attrvalue_get_key (thread_p, i, index_attr_info, &new_recdes, &btid, &dbvalue, aligned_buf, NULL, NULL);
+      /* TODO: unique with prefix length */
+      if (key_dbvalue == NULL)
 	{
-	  /* currently there are only NOT NULL constraints */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
-	  error = ER_NULL_CONSTRAINT_VIOLATION;
-	  goto exit_on_error;
+	  goto error_exit;
 	}
-    }
 
-  /* set values for object */
-  heap_attrinfo_clear_dbvalues (attr_info);
-  for (assign_idx = 0; assign_idx < odku->no_assigns && error == NO_ERROR; assign_idx++)
-    {
-      assign = &odku->assignments[assign_idx];
-      if (assign->constant)
+      if (pruning_type != DB_NOT_PARTITIONED_CLASS)
 	{
-	  error = heap_attrinfo_set (&unique_oid, odku->attr_ids[assign_idx], assign->constant, attr_info);
-	  if (error != NO_ERROR)
+	  if (pcontext == NULL)
 	    {
-	      ASSERT_ERROR ();
-	      goto exit_on_error;
+	      assert (false);
+	      goto error_exit;
+	    }
+	  error_code = partition_prune_unique_btid (pcontext, key_dbvalue, &pruned_oid, &pruned_hfid, &btid);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto error_exit;
 	    }
 	}
-      else
+
+      OID_SET_NULL (&unique_oid);
+
+      r = xbtree_find_unique (thread_p, &btid, S_DELETE, key_dbvalue, &pruned_oid, &unique_oid, is_global_index);
+
+      if (r == BTREE_KEY_FOUND)
 	{
-	  assert_release (assign->regu_var != NULL);
-	  error = fetch_peek_dbval (thread_p, assign->regu_var, vd, NULL, NULL, NULL, &val);
-	  if (error != NO_ERROR)
+	  if (pruning_type != DB_NOT_PARTITIONED_CLASS)
 	    {
-	      ASSERT_ERROR ();
-	      goto exit_on_error;
+	      COPY_OID (&attr_info->inst_oid, &unique_oid);
 	    }
 
-	  error = heap_attrinfo_set (&unique_oid, odku->attr_ids[assign_idx], val, attr_info);
-	  if (error != NO_ERROR)
+	  if (pruning_type && BTREE_IS_MULTI_ROW_OP (op_type))
 	    {
-	      ASSERT_ERROR ();
-	      goto exit_on_error;
+	      /* need to provide appropriate scan_cache to locator_delete_force in order to correctly compute
+	       * statistics */
+	      PRUNING_SCAN_CACHE *pruning_cache;
+
+	      pruning_cache =
+		locator_get_partition_scancache (pcontext, &pruned_oid, &pruned_hfid, local_op_type, false);
+	      if (pruning_cache == NULL)
+		{
+		  assert (er_errid () != NO_ERROR);
+
+		  error_code = er_errid ();
+		  if (error_code == NO_ERROR)
+		    {
+		      error_code = ER_FAILED;
+		    }
+		  goto error_exit;
+		}
+
+	      local_scan_cache = &pruning_cache->scan_cache;
+	    }
+
+	  /* last version was already locked and returned by xbtree_find_unique() */
+	  error_code = locator_delete_lob_force (thread_p, &pruned_oid, &unique_oid, NULL);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto error_exit;
+	    }
+
+	  force_count = 0;
+	  /* The object was locked during find unique */
+	  error_code =
+	    locator_attribute_info_force (thread_p, &pruned_hfid, &unique_oid, NULL, NULL, 0, LC_FLUSH_DELETE,
+					  local_op_type, local_scan_cache, &force_count, false,
+					  REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL, NULL,
+					  UPDATE_INPLACE_NONE, NULL, false);
+
+	  if (error_code == ER_MVCC_NOT_SATISFIED_REEVALUATION)
+	    {
+	      error_code = NO_ERROR;
+	    }
+	  else if (error_code != NO_ERROR)
+	    {
+	      goto error_exit;
+	    }
+	  else if (force_count != 0)
+	    {
+	      assert (force_count == 1);
+	      *removed_count += force_count;
+	      force_count = 0;
 	    }
 	}
-    }
+      else if (r == BTREE_ERROR_OCCURRED)
+	{
+	  if (!OID_ISNULL (&unique_oid))
+	    {
+	      /* more than one OID has been found */
+	      BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, key_dbvalue, &unique_oid, &class_oid, &btid, NULL);
+	    }
+	  goto error_exit;
+	}
+      else
+	{
+	  /* BTREE_KEY_NOTFOUND */
+	  ;			/* just go to the next one */
+	}
 
-  /* unique_oid already locked in qexec_oid_of_duplicate_key_update */
-  error =
-    locator_attribute_info_force (thread_p, hfid, &unique_oid, attr_info, odku->attr_ids, odku->no_assigns,
-				  LC_FLUSH_UPDATE, local_op_type, local_scan_cache, force_count, false, repl_info,
-				  pruning_type, pcontext, NULL, NULL, UPDATE_INPLACE_NONE, &rec_descriptor, false);
-  if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
-    {
-      er_clear ();
-      error = NO_ERROR;
+      if (key_dbvalue == &dbvalue)
+	{
+	  pr_clear_value (&dbvalue);
+	  key_dbvalue = NULL;
+	}
     }
-  else if (error != NO_ERROR)
+
+  if (copyarea != NULL)
     {
-      ASSERT_ERROR ();
-      goto exit_on_error;
+      locator_free_copy_area (copyarea);
+      copyarea = NULL;
+      new_recdes.data = NULL;
+      new_recdes.area_size = 0;
     }
 
-  heap_attrinfo_clear_dbvalues (attr_info);
-  heap_attrinfo_clear_dbvalues (odku->attr_info);
-
-  return error;
-
-exit_on_error:
+  return NO_ERROR;
 
-  if (need_clear)
+error_exit:
+  if (key_dbvalue == &dbvalue)
     {
-      heap_attrinfo_clear_dbvalues (odku->attr_info);
+      pr_clear_value (&dbvalue);
+      key_dbvalue = NULL;
     }
 
-  assert (error != NO_ERROR);
+  if (copyarea != NULL)
+    {
+      locator_free_copy_area (copyarea);
+      copyarea = NULL;
+      new_recdes.data = NULL;
+      new_recdes.area_size = 0;
+    }
 
-  return error;
+  return ER_FAILED;
 }
 
 /*
- * qexec_execute_insert () -
+ * qexec_oid_of_duplicate_key_update () - Finds an OID of an object that would
+ *       generate unique index violations when inserting the given attr_info
+ *       (This is used for executing INSERT ON DUPLICATE KEY UPDATE
+ *        statements)
  *   return: NO_ERROR or ER_code
- *   xasl(in)   : XASL Tree block
- *   xasl_state(in)     :
+ *   thread_p(in):
+ *   pruned_partition_scan_cache(out): the real scan_cache for this oid
+ *   scan_cache(in):
+ *   attr_info(in/out): The attribute information that will be inserted
+ *   index_attr_info(in/out):
+ *   idx_info(in):
+ *   pruning_type(in):
+ *   pcontext(in):
+ *   unique_oid_p(out): the OID of one object to be updated or a NULL OID if
+ *                      there are no potential unique index violations
+ *   op_type(int):
+ * Note: A single OID is returned even if there are several objects that would
+ *       generate unique index violations (this can only happen if there are
+ *       several unique indexes).
  */
 static int
-qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, bool skip_aptr)
+qexec_oid_of_duplicate_key_update (THREAD_ENTRY * thread_p, HEAP_SCANCACHE ** pruned_partition_scan_cache,
+				   HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info,
+				   HEAP_CACHE_ATTRINFO * index_attr_info, const HEAP_IDX_ELEMENTS_INFO * idx_info,
+				   int pruning_type, PRUNING_CONTEXT * pcontext, OID * unique_oid_p, int op_type)
 {
-  INSERT_PROC_NODE *insert = &xasl->proc.insert;
-  SCAN_CODE xb_scan;
-  SCAN_CODE ls_scan;
-  XASL_NODE *aptr = NULL;
-  DB_VALUE *valp = NULL;
-  QPROC_DB_VALUE_LIST vallist;
-  int i, k;
-  int val_no;
-  int rc;
-  OID oid;
+  LC_COPYAREA *copyarea = NULL;
+  RECDES recdes;
+  int i = 0;
+  int error_code = NO_ERROR;
+  char buf[DBVAL_BUFSIZE + MAX_ALIGNMENT];
+  char *const aligned_buf = PTR_ALIGN (buf, MAX_ALIGNMENT);
+  DB_VALUE dbvalue;
+  DB_VALUE *key_dbvalue = NULL;
+  bool found_duplicate = false;
+  BTID btid;
+  OR_INDEX *index;
+  OID unique_oid;
   OID class_oid;
   HFID class_hfid;
-  ACCESS_SPEC_TYPE *specp = NULL;
-  SCAN_ID *s_id = NULL;
-  HEAP_CACHE_ATTRINFO attr_info;
-  HEAP_CACHE_ATTRINFO index_attr_info;
-  HEAP_IDX_ELEMENTS_INFO idx_info;
-  bool attr_info_inited = false;
-  volatile bool index_attr_info_inited = false;
-  volatile bool odku_attr_info_inited = false;
-  LOG_LSA lsa;
-  int savepoint_used = 0;
-  int satisfies_constraints;
-  HEAP_SCANCACHE scan_cache;
-  bool scan_cache_inited = false;
-  int scan_cache_op_type = 0;
-  int force_count = 0;
-  REGU_VARIABLE *rvsave = NULL;
-  int no_default_expr = 0;
-  LC_COPYAREA_OPERATION operation = LC_FLUSH_INSERT;
-  PRUNING_CONTEXT context, *volatile pcontext = NULL;
-  FUNC_PRED_UNPACK_INFO *func_indx_preds = NULL;
-  volatile int n_indexes = 0;
-  int error = 0;
-  ODKU_INFO *odku_assignments = insert->odku;
-  DB_VALUE oid_val;
-  int is_autoincrement_set = 0;
-  int month, day, year, hour, minute, second, millisecond;
-
-  aptr = xasl->aptr_list;
-  val_no = insert->no_vals;
+  bool is_global_index = false;
+  int local_op_type = SINGLE_ROW_UPDATE;
+  BTREE_SEARCH r;
 
-  if (!skip_aptr)
-    {
-      if (aptr && qexec_execute_mainblock (thread_p, aptr, xasl_state, NULL) != NO_ERROR)
-	{
-	  qexec_failure_line (__LINE__, xasl_state);
-	  return ER_FAILED;
-	}
-    }
+  assert (pruned_partition_scan_cache != NULL);
 
-  if (XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS) && xasl->list_id)
-    {
-      xasl->list_id->query_id = xasl_state->query_id;
-    }
+  DB_MAKE_NULL (&dbvalue);
+  OID_SET_NULL (unique_oid_p);
+  OID_SET_NULL (&unique_oid);
 
-  /* This guarantees that the result list file will have a type list. Copying a list_id structure fails unless it has a 
-   * type list. */
-  if (qexec_setup_list_id (thread_p, xasl) != NO_ERROR)
+  if (BTREE_IS_MULTI_ROW_OP (op_type))
     {
-      qexec_failure_line (__LINE__, xasl_state);
-      return ER_FAILED;
+      local_op_type = MULTI_ROW_UPDATE;
     }
 
-  /* We might not hold a strong enough lock on the class yet. */
-  if (lock_object (thread_p, &insert->class_oid, oid_Root_class_oid, IX_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
+  if (heap_attrinfo_clear_dbvalues (index_attr_info) != NO_ERROR)
     {
-      assert (er_errid () != NO_ERROR);
-      error = er_errid ();
-      if (error != NO_ERROR)
-	{
-	  error = ER_FAILED;
-	}
-      qexec_failure_line (__LINE__, xasl_state);
-      return error;
+      goto error_exit;
     }
 
-  /* need to start a topop to ensure statement atomicity. One insert statement might update several disk images. For
-   * example, one row insert might update one heap record, zero or more index keys, catalog info of object count, and
-   * other things. So, the insert statement must be performed atomically. */
-  if (xtran_server_start_topop (thread_p, &lsa) != NO_ERROR)
+  copyarea = locator_allocate_copy_area_by_attr_info (thread_p, attr_info, NULL, &recdes, -1, LOB_FLAG_INCLUDE_LOB);
+  if (copyarea == NULL)
     {
-      qexec_failure_line (__LINE__, xasl_state);
-      return ER_FAILED;
+      goto error_exit;
     }
-  savepoint_used = 1;
-
-  (void) session_begin_insert_values (thread_p);
 
-  COPY_OID (&class_oid, &insert->class_oid);
-  HFID_COPY (&class_hfid, &insert->class_hfid);
-  if (insert->pruning_type != DB_NOT_PARTITIONED_CLASS)
+  if (idx_info->has_single_col)
     {
-      /* initialize the pruning context here */
-      pcontext = &context;
-      partition_init_pruning_context (pcontext);
-      error = partition_load_pruning_context (thread_p, &insert->class_oid, insert->pruning_type, pcontext);
-      if (error != NO_ERROR)
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid_Null_oid, &recdes, NULL, index_attr_info);
+      if (error_code != NO_ERROR)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  goto error_exit;
 	}
     }
+  assert (index_attr_info->last_classrepr != NULL);
 
-  if (insert->has_uniques && (insert->do_replace || odku_assignments != NULL))
+  for (i = 0; i < idx_info->num_btids && !found_duplicate; ++i)
     {
-      if (heap_attrinfo_start_with_index (thread_p, &class_oid, NULL, &index_attr_info, &idx_info) < 0)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-      index_attr_info_inited = true;
-      if (odku_assignments != NULL)
+      index = &(index_attr_info->last_classrepr->indexes[i]);
+      if (!btree_is_unique_type (index->type))
 	{
-	  error = heap_attrinfo_start (thread_p, &insert->class_oid, -1, NULL, odku_assignments->attr_info);
-	  if (error != NO_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	  odku_attr_info_inited = true;
+	  continue;
 	}
-    }
-
-  if (heap_attrinfo_start (thread_p, &class_oid, -1, NULL, &attr_info) != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
-  attr_info_inited = true;
-  n_indexes = attr_info.last_classrepr->n_indexes;
 
-  /* first values should be the results of default expressions */
-  no_default_expr = insert->no_default_expr;
-  if (no_default_expr < 0)
-    {
-      no_default_expr = 0;
-    }
-  for (k = 0; k < no_default_expr; k++)
-    {
-      OR_ATTRIBUTE *attr;
-      DB_VALUE *new_val;
-      int error = NO_ERROR;
-      TP_DOMAIN_STATUS status = DOMAIN_COMPATIBLE;
+      COPY_OID (&class_oid, &attr_info->class_oid);
+      is_global_index = false;
 
-      attr = heap_locate_last_attrepr (insert->att_id[k], &attr_info);
-      if (attr == NULL)
+      key_dbvalue =
+	heap_attrvalue_get_key (thread_p, i, index_attr_info, &recdes, &btid, &dbvalue, aligned_buf, NULL, NULL);
+      if (key_dbvalue == NULL)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  goto error_exit;
 	}
-      new_val = (DB_VALUE *) db_private_alloc (thread_p, sizeof (DB_VALUE));
-      if (new_val == NULL)
+
+      if (pruning_type != DB_NOT_PARTITIONED_CLASS)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  if (pcontext == NULL)
+	    {
+	      assert (false);
+	      goto error_exit;
+	    }
+
+	  error_code = partition_prune_unique_btid (pcontext, key_dbvalue, &class_oid, &class_hfid, &btid);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto error_exit;
+	    }
 	}
-      DB_MAKE_NULL (new_val);
-      insert->vals[k] = new_val;
-      switch (attr->current_default_value.default_expr)
-	{
-	case DB_DEFAULT_SYSTIME:
-	case DB_DEFAULT_CURRENTTIME:
-	  db_datetime_decode (&xasl_state->vd.sys_datetime, &month, &day, &year, &hour, &minute, &second, &millisecond);
-	  db_make_time (insert->vals[k], hour, minute, second);
-	  break;
-	case DB_DEFAULT_SYSDATE:
-	case DB_DEFAULT_CURRENTDATE:
-	  db_datetime_decode (&xasl_state->vd.sys_datetime, &month, &day, &year, &hour, &minute, &second, &millisecond);
-	  db_make_date (insert->vals[k], month, day, year);
-	  break;
-	case DB_DEFAULT_SYSDATETIME:
-	  DB_MAKE_DATETIME (insert->vals[k], &xasl_state->vd.sys_datetime);
-	  break;
-	case DB_DEFAULT_SYSTIMESTAMP:
-	  DB_MAKE_DATETIME (insert->vals[k], &xasl_state->vd.sys_datetime);
-	  error = db_datetime_to_timestamp (insert->vals[k], insert->vals[k]);
-	  break;
-	case DB_DEFAULT_CURRENTDATETIME:
-	  DB_MAKE_DATETIME (insert->vals[k], &xasl_state->vd.sys_datetime);
-	  break;
-	case DB_DEFAULT_CURRENTTIMESTAMP:
-	  DB_MAKE_DATETIME (insert->vals[k], &xasl_state->vd.sys_datetime);
-	  error = db_datetime_to_timestamp (insert->vals[k], insert->vals[k]);
-	  break;
-	case DB_DEFAULT_UNIX_TIMESTAMP:
-	  DB_MAKE_DATETIME (insert->vals[k], &xasl_state->vd.sys_datetime);
-	  error = db_unix_timestamp (insert->vals[k], insert->vals[k]);
-	  break;
-	case DB_DEFAULT_USER:
-	  {
-	    int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-	    LOG_TDES *tdes = NULL;
-	    char *temp = NULL;
 
-	    tdes = LOG_FIND_TDES (tran_index);
-	    if (tdes)
-	      {
-		int len = strlen (tdes->client.db_user) + strlen (tdes->client.host_name) + 2;
-		temp = db_private_alloc (thread_p, len);
-		if (!temp)
-		  {
-		    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) len);
-		  }
-		else
-		  {
-		    strcpy (temp, tdes->client.db_user);
-		    strcat (temp, "@");
-		    strcat (temp, tdes->client.host_name);
-		  }
-	      }
-	    DB_MAKE_STRING (insert->vals[k], temp);
-	    insert->vals[k]->need_clear = true;
-	  }
-	  break;
-	case DB_DEFAULT_CURR_USER:
-	  {
-	    int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-	    LOG_TDES *tdes = NULL;
-	    char *temp = NULL;
+      r = xbtree_find_unique (thread_p, &btid, S_UPDATE, key_dbvalue, &class_oid, &unique_oid, is_global_index);
 
-	    tdes = LOG_FIND_TDES (tran_index);
-	    if (tdes != NULL)
-	      {
-		temp = tdes->client.db_user;
-	      }
-	    DB_MAKE_STRING (insert->vals[k], temp);
-	  }
-	  break;
-	case DB_DEFAULT_NONE:
-	  if (attr->current_default_value.val_length <= 0)
+      if (r == BTREE_KEY_FOUND)
+	{
+	  if (pruning_type != DB_NOT_PARTITIONED_CLASS)
 	    {
-	      /* leave default value as NULL */
-	      break;
+	      COPY_OID (&attr_info->inst_oid, &unique_oid);
 	    }
-	  else
+
+	  if (pruning_type != DB_NOT_PARTITIONED_CLASS && BTREE_IS_MULTI_ROW_OP (op_type))
 	    {
-	      OR_BUF buf;
-	      PR_TYPE *pr_type = PR_TYPE_FROM_ID (attr->type);
-	      bool copy = (pr_is_set_type (attr->type)) ? true : false;
-	      if (pr_type != NULL)
+	      /* need to provide appropriate scan_cache to locator_delete_force in order to correctly compute
+	       * statistics */
+	      PRUNING_SCAN_CACHE *pruning_cache;
+
+	      pruning_cache = locator_get_partition_scancache (pcontext, &class_oid, &class_hfid, local_op_type, false);
+	      if (pruning_cache == NULL)
 		{
-		  or_init (&buf, attr->current_default_value.value, attr->current_default_value.val_length);
-		  buf.error_abort = 1;
-		  switch (_setjmp (buf.env))
+		  assert (er_errid () != NO_ERROR);
+
+		  error_code = er_errid ();
+		  if (error_code == NO_ERROR)
 		    {
-		    case 0:
-		      error = (*(pr_type->data_readval)) (&buf, insert->vals[k], attr->domain,
-							  attr->current_default_value.val_length, copy, NULL, 0);
-		      if (error != NO_ERROR)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
-		      break;
-		    default:
-		      error = ER_FAILED;
-		      GOTO_EXIT_ON_ERROR;
-		      break;
+		      error_code = ER_FAILED;
 		    }
+		  goto error_exit;
 		}
-	    }
-	  break;
-	default:
-	  assert (0);
-	  error = ER_FAILED;
-	  GOTO_EXIT_ON_ERROR;
-	  break;
-	}
 
-      if (error != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
+	      *pruned_partition_scan_cache = &pruning_cache->scan_cache;
+	    }
 
-      if (attr->current_default_value.default_expr == DB_DEFAULT_NONE)
-	{
-	  /* skip the value cast */
-	  continue;
+	  /* We now hold an U_LOCK on the instance. It will be upgraded to an X_LOCK when the update is executed. */
+	  if (pruning_type == DB_PARTITION_CLASS)
+	    {
+	      if (!OID_EQ (&class_oid, &pcontext->selected_partition->class_oid))
+		{
+		  /* found a duplicate OID but not in the right partition */
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INVALID_DATA_FOR_PARTITION, 0);
+		  goto error_exit;
+		}
+	    }
+
+	  found_duplicate = true;
+	  COPY_OID (unique_oid_p, &unique_oid);
+	}
+      else if (r == BTREE_ERROR_OCCURRED)
+	{
+	  if (!OID_ISNULL (&unique_oid))
+	    {
+	      /* more than one OID has been found */
+	      BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, key_dbvalue, &unique_oid, &class_oid, &btid, NULL);
+	    }
+	  goto error_exit;
+	}
+      else
+	{
+	  /* BTREE_KEY_NOTFOUND */
+	  ;			/* just go to the next one */
 	}
 
-      status = tp_value_cast (insert->vals[k], insert->vals[k], attr->domain, false);
-      if (status != DOMAIN_COMPATIBLE)
+      if (key_dbvalue == &dbvalue)
 	{
-	  (void) tp_domain_status_er_set (status, ARG_FILE_LINE, insert->vals[k], attr->domain);
-	  GOTO_EXIT_ON_ERROR;
+	  pr_clear_value (&dbvalue);
+	  key_dbvalue = NULL;
 	}
     }
 
-  specp = xasl->spec_list;
-  if (specp != NULL || ((insert->do_replace || (xasl->dptr_list != NULL)) && insert->has_uniques)
-      || insert->no_val_lists > 1)
+  if (copyarea != NULL)
     {
-      scan_cache_op_type = MULTI_ROW_INSERT;
+      locator_free_copy_area (copyarea);
+      copyarea = NULL;
+      recdes.data = NULL;
+      recdes.area_size = 0;
     }
-  else
+
+  return NO_ERROR;
+
+error_exit:
+  if (key_dbvalue == &dbvalue)
     {
-      scan_cache_op_type = SINGLE_ROW_INSERT;
+      pr_clear_value (&dbvalue);
+      key_dbvalue = NULL;
     }
 
-  if (specp)
+  if (copyarea != NULL)
     {
-      /* we are inserting multiple values ... ie. insert into foo select ... */
+      locator_free_copy_area (copyarea);
+      copyarea = NULL;
+      recdes.data = NULL;
+      recdes.area_size = 0;
+    }
 
-      /* if the class has at least one function index, the function expressions will be cached */
-      if (heap_init_func_pred_unpack_info (thread_p, &attr_info, &class_oid, &func_indx_preds) != NO_ERROR)
+  return ER_FAILED;
+}
+
+/*
+ * qexec_execute_duplicate_key_update () - Executes an update on a given OID
+ *       (required by INSERT ON DUPLICATE KEY UPDATE processing)
+ *   return: NO_ERROR or ER_code
+ *   thread_p(in) :
+ *   odku(in) : on duplicate key update clause info
+ *   hfid(in) : class HFID
+ *   vd(in) : values descriptor
+ *   op_type(in): operation type
+ *   scan_cache(in): scan cache
+ *   attr_info(in): attribute cache info
+ *   index_attr_info(in): attribute info cache for indexes
+ *   idx_info(in): index info
+ *   pruning_type(in): pruning type
+ *   pcontext(in): pruning context
+ *   force_count(out): the number of objects that have been updated; it should
+ *                     always be 1 on success and 0 on error
+ */
+static int
+qexec_execute_duplicate_key_update (THREAD_ENTRY * thread_p, ODKU_INFO * odku, HFID * hfid, VAL_DESCR * vd, int op_type,
+				    HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info,
+				    HEAP_CACHE_ATTRINFO * index_attr_info, HEAP_IDX_ELEMENTS_INFO * idx_info,
+				    int pruning_type, PRUNING_CONTEXT * pcontext, int *force_count)
+{
+  int stat = NO_ERROR;
+  int satisfies_constraints;
+  int assign_idx;
+  UPDATE_ASSIGNMENT *assign;
+  RECDES rec_descriptor = { 0, -1, REC_HOME, NULL };
+  SCAN_CODE scan_code;
+  DB_VALUE *val = NULL;
+  REPL_INFO_TYPE repl_info = REPL_INFO_TYPE_RBR_NORMAL;
+  int error = NO_ERROR;
+  bool need_clear = 0;
+  OID unique_oid;
+  int local_op_type = SINGLE_ROW_UPDATE;
+  HEAP_SCANCACHE *local_scan_cache = NULL;
+  int ispeeking;
+
+  OID_SET_NULL (&unique_oid);
+
+  local_scan_cache = scan_cache;
+
+  error =
+    qexec_oid_of_duplicate_key_update (thread_p, &local_scan_cache, scan_cache, attr_info, index_attr_info, idx_info,
+				       pruning_type, pcontext, &unique_oid, op_type);
+  if (error != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit_on_error;
+    }
+
+  if (OID_ISNULL (&unique_oid))
+    {
+      *force_count = 0;
+      return NO_ERROR;
+    }
+
+  /* get attribute values */
+  ispeeking = ((local_scan_cache != NULL && local_scan_cache->cache_last_fix_page) ? PEEK : COPY);
+
+  scan_code = heap_get (thread_p, &unique_oid, &rec_descriptor, local_scan_cache, ispeeking, NULL_CHN);
+  if (scan_code != S_SUCCESS)
+    {
+      assert (er_errid () == ER_INTERRUPTED);
+      error = ER_FAILED;
+      goto exit_on_error;
+    }
+
+  /* setup operation type and handle partition representation id */
+  if (pruning_type == DB_PARTITIONED_CLASS)
+    {
+      /* modify rec_descriptor representation id to that of attr_info */
+      assert (OID_EQ (&attr_info->class_oid, &pcontext->root_oid));
+
+      if (OID_ISNULL (&attr_info->inst_oid))
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  or_set_rep_id (&rec_descriptor, pcontext->root_repr_id);
 	}
 
-      if (locator_start_force_scan_cache (thread_p, &scan_cache, &insert->class_hfid, &class_oid,
-					  scan_cache_op_type) != NO_ERROR)
+      local_op_type = (BTREE_IS_MULTI_ROW_OP (op_type) ? MULTI_ROW_UPDATE : SINGLE_ROW_UPDATE);
+    }
+
+  error = heap_attrinfo_read_dbvalues (thread_p, &unique_oid, &rec_descriptor, local_scan_cache, odku->attr_info);
+  if (error != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit_on_error;
+    }
+
+  need_clear = true;
+
+  /* evaluate constraint predicate */
+  satisfies_constraints = V_UNKNOWN;
+  if (odku->cons_pred != NULL)
+    {
+      satisfies_constraints = eval_pred (thread_p, odku->cons_pred, vd, NULL);
+      if (satisfies_constraints == V_ERROR)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  ASSERT_ERROR_AND_SET (error);
+	  goto exit_on_error;
 	}
-      scan_cache_inited = true;
 
-      assert (xasl->scan_op_type == S_SELECT);
+      if (satisfies_constraints != V_TRUE)
+	{
+	  /* currently there are only NOT NULL constraints */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
+	  error = ER_NULL_CONSTRAINT_VIOLATION;
+	  goto exit_on_error;
+	}
+    }
 
-      /* force_select_lock = false */
-      if (qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state->vd, false, specp->fixed_scan,
-			   specp->grouped_scan, true, &specp->s_id, xasl_state->query_id, S_SELECT, false,
-			   NULL) != NO_ERROR)
+  /* set values for object */
+  heap_attrinfo_clear_dbvalues (attr_info);
+  for (assign_idx = 0; assign_idx < odku->no_assigns && error == NO_ERROR; assign_idx++)
+    {
+      assign = &odku->assignments[assign_idx];
+      if (assign->constant)
 	{
-	  if (savepoint_used)
+	  error = heap_attrinfo_set (&unique_oid, odku->attr_ids[assign_idx], assign->constant, attr_info);
+	  if (error != NO_ERROR)
 	    {
-	      xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
+	      ASSERT_ERROR ();
+	      goto exit_on_error;
 	    }
-	  qexec_failure_line (__LINE__, xasl_state);
-	  GOTO_EXIT_ON_ERROR;
 	}
-
-      while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
+      else
 	{
-	  s_id = &xasl->curr_spec->s_id;
-	  while ((ls_scan = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
+	  assert_release (assign->regu_var != NULL);
+	  error = fetch_peek_dbval (thread_p, assign->regu_var, vd, NULL, NULL, NULL, &val);
+	  if (error != NO_ERROR)
 	    {
-	      for (k = no_default_expr, vallist = s_id->val_list->valp; k < val_no; k++, vallist = vallist->next)
-		{
-		  if (vallist == NULL || vallist->val == NULL)
-		    {
-		      assert (0);
-		      GOTO_EXIT_ON_ERROR;
-		    }
-
-		  insert->vals[k] = vallist->val;
-		}
+	      ASSERT_ERROR ();
+	      goto exit_on_error;
+	    }
 
-	      /* evaluate constraint predicate */
-	      satisfies_constraints = V_UNKNOWN;
-	      if (insert->cons_pred != NULL)
-		{
-		  satisfies_constraints = eval_pred (thread_p, insert->cons_pred, &xasl_state->vd, NULL);
-		  if (satisfies_constraints == V_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		}
+	  error = heap_attrinfo_set (&unique_oid, odku->attr_ids[assign_idx], val, attr_info);
+	  if (error != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      goto exit_on_error;
+	    }
+	}
+    }
 
-	      if (insert->cons_pred != NULL && satisfies_constraints != V_TRUE)
-		{
-		  /* currently there are only NOT NULL constraints */
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
-		  GOTO_EXIT_ON_ERROR;
-		}
+  /* unique_oid already locked in qexec_oid_of_duplicate_key_update */
+  error =
+    locator_attribute_info_force (thread_p, hfid, &unique_oid, attr_info, odku->attr_ids, odku->no_assigns,
+				  LC_FLUSH_UPDATE, local_op_type, local_scan_cache, force_count, false, repl_info,
+				  pruning_type, pcontext, NULL, NULL, UPDATE_INPLACE_NONE, &rec_descriptor, false);
+  if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
+    {
+      er_clear ();
+      error = NO_ERROR;
+    }
+  else if (error != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit_on_error;
+    }
 
-	      if (heap_attrinfo_clear_dbvalues (&attr_info) != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      for (k = 0; k < val_no; ++k)
-		{
-		  if (DB_IS_NULL (insert->vals[k]))
-		    {
-		      OR_ATTRIBUTE *attr = heap_locate_last_attrepr (insert->att_id[k], &attr_info);
-
-		      if (attr == NULL)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
+  heap_attrinfo_clear_dbvalues (attr_info);
+  heap_attrinfo_clear_dbvalues (odku->attr_info);
 
-		      if (attr->is_autoincrement)
-			{
-			  continue;
-			}
-		    }
+  return error;
 
+exit_on_error:
 
-		  rc = heap_attrinfo_set (NULL, insert->att_id[k], insert->vals[k], &attr_info);
-		  if (rc != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		}
+  if (need_clear)
+    {
+      heap_attrinfo_clear_dbvalues (odku->attr_info);
+    }
 
-	      if (heap_set_autoincrement_value (thread_p, &attr_info, &scan_cache, &is_autoincrement_set) != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
+  assert (error != NO_ERROR);
 
-	      if (insert->do_replace && insert->has_uniques)
-		{
-		  int removed_count = 0;
+  return error;
+}
 
-		  assert (index_attr_info_inited == true);
+/*
+ * qexec_execute_insert () -
+ *   return: NO_ERROR or ER_code
+ *   xasl(in)   : XASL Tree block
+ *   xasl_state(in)     :
+ */
+static int
+qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, bool skip_aptr)
+{
+  INSERT_PROC_NODE *insert = &xasl->proc.insert;
+  SCAN_CODE xb_scan;
+  SCAN_CODE ls_scan;
+  XASL_NODE *aptr = NULL;
+  DB_VALUE *valp = NULL;
+  QPROC_DB_VALUE_LIST vallist;
+  int i, k;
+  int val_no;
+  int rc;
+  OID oid;
+  OID class_oid;
+  HFID class_hfid;
+  ACCESS_SPEC_TYPE *specp = NULL;
+  SCAN_ID *s_id = NULL;
+  HEAP_CACHE_ATTRINFO attr_info;
+  HEAP_CACHE_ATTRINFO index_attr_info;
+  HEAP_IDX_ELEMENTS_INFO idx_info;
+  bool attr_info_inited = false;
+  volatile bool index_attr_info_inited = false;
+  volatile bool odku_attr_info_inited = false;
+  LOG_LSA lsa;
+  int savepoint_used = 0;
+  int satisfies_constraints;
+  HEAP_SCANCACHE scan_cache;
+  bool scan_cache_inited = false;
+  int scan_cache_op_type = 0;
+  int force_count = 0;
+  REGU_VARIABLE *rvsave = NULL;
+  int no_default_expr = 0;
+  LC_COPYAREA_OPERATION operation = LC_FLUSH_INSERT;
+  PRUNING_CONTEXT context, *volatile pcontext = NULL;
+  FUNC_PRED_UNPACK_INFO *func_indx_preds = NULL;
+  volatile int n_indexes = 0;
+  int error = 0;
+  ODKU_INFO *odku_assignments = insert->odku;
+  DB_VALUE oid_val;
+  int is_autoincrement_set = 0;
+  int month, day, year, hour, minute, second, millisecond;
 
-		  if (qexec_remove_duplicates_for_replace (thread_p, &scan_cache, &attr_info, &index_attr_info,
-							   &idx_info, scan_cache_op_type, insert->pruning_type,
-							   pcontext, &removed_count) != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		  xasl->list_id->tuple_cnt += removed_count;
-		}
+  aptr = xasl->aptr_list;
+  val_no = insert->no_vals;
 
-	      if (odku_assignments && insert->has_uniques)
-		{
-		  force_count = 0;
-		  error =
-		    qexec_execute_duplicate_key_update (thread_p, insert->odku, &insert->class_hfid, &xasl_state->vd,
-							scan_cache_op_type, &scan_cache, &attr_info, &index_attr_info,
-							&idx_info, insert->pruning_type, pcontext, &force_count);
-		  if (error != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
+  if (!skip_aptr)
+    {
+      if (aptr && qexec_execute_mainblock (thread_p, aptr, xasl_state, NULL) != NO_ERROR)
+	{
+	  qexec_failure_line (__LINE__, xasl_state);
+	  return ER_FAILED;
+	}
+    }
 
-		  if (force_count != 0)
-		    {
-		      assert (force_count == 1);
+  if (XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS) && xasl->list_id)
+    {
+      xasl->list_id->query_id = xasl_state->query_id;
+    }
 
-		      xasl->list_id->tuple_cnt += force_count * 2;
-		      continue;
-		    }
-		}
+  /* This guarantees that the result list file will have a type list. Copying a list_id structure fails unless it has a 
+   * type list. */
+  if (qexec_setup_list_id (thread_p, xasl) != NO_ERROR)
+    {
+      qexec_failure_line (__LINE__, xasl_state);
+      return ER_FAILED;
+    }
 
-	      force_count = 0;
-	      /* when insert in heap, don't care about instance locking */
-	      if (locator_attribute_info_force (thread_p, &insert->class_hfid, &oid, &attr_info, NULL, 0, operation,
-						scan_cache_op_type, &scan_cache, &force_count, false,
-						REPL_INFO_TYPE_RBR_NORMAL, insert->pruning_type, pcontext,
-						func_indx_preds, NULL, UPDATE_INPLACE_NONE, NULL, false) != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
+  /* We might not hold a strong enough lock on the class yet. */
+  if (lock_object (thread_p, &insert->class_oid, oid_Root_class_oid, IX_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
+    {
+      assert (er_errid () != NO_ERROR);
+      error = er_errid ();
+      if (error != NO_ERROR)
+	{
+	  error = ER_FAILED;
+	}
+      qexec_failure_line (__LINE__, xasl_state);
+      return error;
+    }
 
-	      /* restore class oid and hfid that might have changed in the call above */
-	      HFID_COPY (&insert->class_hfid, &class_hfid);
-	      COPY_OID (&(attr_info.class_oid), &class_oid);
+  /* need to start a topop to ensure statement atomicity. One insert statement might update several disk images. For
+   * example, one row insert might update one heap record, zero or more index keys, catalog info of object count, and
+   * other things. So, the insert statement must be performed atomically. */
+  if (xtran_server_start_topop (thread_p, &lsa) != NO_ERROR)
+    {
+      qexec_failure_line (__LINE__, xasl_state);
+      return ER_FAILED;
+    }
+  savepoint_used = 1;
 
-	      /* Instances are not put into the result list file, but are counted. */
-	      if (force_count)
-		{
-		  assert (force_count == 1);
+  (void) session_begin_insert_values (thread_p);
 
-		  if (!OID_ISNULL (&oid) && XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS)
-		      && is_autoincrement_set > 0)
-		    {
-		      db_make_oid (&oid_val, &oid);
-		      if (qfile_fast_val_tuple_to_list (thread_p, xasl->list_id, &oid_val) != NO_ERROR)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
-		    }
-		  else
-		    {
-		      xasl->list_id->tuple_cnt += force_count;
-		    }
-		}
-	    }
+  COPY_OID (&class_oid, &insert->class_oid);
+  HFID_COPY (&class_hfid, &insert->class_hfid);
+  if (insert->pruning_type != DB_NOT_PARTITIONED_CLASS)
+    {
+      /* initialize the pruning context here */
+      pcontext = &context;
+      partition_init_pruning_context (pcontext);
+      error = partition_load_pruning_context (thread_p, &insert->class_oid, insert->pruning_type, pcontext);
+      if (error != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
 
-	  if (ls_scan != S_END)
+  if (insert->has_uniques && (insert->do_replace || odku_assignments != NULL))
+    {
+      if (heap_attrinfo_start_with_index (thread_p, &class_oid, NULL, &index_attr_info, &idx_info) < 0)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      index_attr_info_inited = true;
+      if (odku_assignments != NULL)
+	{
+	  error = heap_attrinfo_start (thread_p, &insert->class_oid, -1, NULL, odku_assignments->attr_info);
+	  if (error != NO_ERROR)
 	    {
 	      GOTO_EXIT_ON_ERROR;
 	    }
+	  odku_attr_info_inited = true;
 	}
+    }
 
-      if (xb_scan != S_END)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-      qexec_close_scan (thread_p, specp);
+  if (heap_attrinfo_start (thread_p, &class_oid, -1, NULL, &attr_info) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
     }
-  else
+  attr_info_inited = true;
+  n_indexes = attr_info.last_classrepr->n_indexes;
+
+  /* first values should be the results of default expressions */
+  no_default_expr = insert->no_default_expr;
+  if (no_default_expr < 0)
     {
-      /* we are inserting a single row ie. insert into foo values(...) */
-      REGU_VARIABLE_LIST regu_list = NULL;
+      no_default_expr = 0;
+    }
+  for (k = 0; k < no_default_expr; k++)
+    {
+      OR_ATTRIBUTE *attr;
+      DB_VALUE *new_val;
+      int error = NO_ERROR;
+      TP_DOMAIN_STATUS status = DOMAIN_COMPATIBLE;
 
-      if (locator_start_force_scan_cache (thread_p, &scan_cache, &insert->class_hfid, &class_oid, scan_cache_op_type) !=
-	  NO_ERROR)
+      attr = heap_locate_last_attrepr (insert->att_id[k], &attr_info);
+      if (attr == NULL)
 	{
 	  GOTO_EXIT_ON_ERROR;
 	}
-      scan_cache_inited = true;
-
-      if (XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE) && scan_cache.file_type == FILE_HEAP_REUSE_SLOTS)
+      new_val = (DB_VALUE *) db_private_alloc (thread_p, sizeof (DB_VALUE));
+      if (new_val == NULL)
 	{
-	  /* do not allow references to reusable oids in sub-inserts. this is a safety check and should have been
-	   * detected at semantic level */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_REFERENCE_TO_NON_REFERABLE_NOT_ALLOWED, 0);
 	  GOTO_EXIT_ON_ERROR;
 	}
-
-      for (i = 0; i < insert->no_val_lists; i++)
+      DB_MAKE_NULL (new_val);
+      insert->vals[k] = new_val;
+      switch (attr->current_default_value.default_expr)
 	{
-	  for (regu_list = insert->valptr_lists[i]->valptrp, vallist = xasl->val_list->valp, k = no_default_expr;
-	       k < val_no; k++, regu_list = regu_list->next, vallist = vallist->next)
+	case DB_DEFAULT_SYSTIME:
+	case DB_DEFAULT_CURRENTTIME:
+	  db_datetime_decode (&xasl_state->vd.sys_datetime, &month, &day, &year, &hour, &minute, &second, &millisecond);
+	  db_make_time (insert->vals[k], hour, minute, second);
+	  break;
+	case DB_DEFAULT_SYSDATE:
+	case DB_DEFAULT_CURRENTDATE:
+	  db_datetime_decode (&xasl_state->vd.sys_datetime, &month, &day, &year, &hour, &minute, &second, &millisecond);
+	  db_make_date (insert->vals[k], month, day, year);
+	  break;
+	case DB_DEFAULT_SYSDATETIME:
+	  DB_MAKE_DATETIME (insert->vals[k], &xasl_state->vd.sys_datetime);
+	  break;
+	case DB_DEFAULT_SYSTIMESTAMP:
+	  DB_MAKE_DATETIME (insert->vals[k], &xasl_state->vd.sys_datetime);
+	  error = db_datetime_to_timestamp (insert->vals[k], insert->vals[k]);
+	  break;
+	case DB_DEFAULT_CURRENTDATETIME:
+	  DB_MAKE_DATETIME (insert->vals[k], &xasl_state->vd.sys_datetime);
+	  break;
+	case DB_DEFAULT_CURRENTTIMESTAMP:
+	  DB_MAKE_DATETIME (insert->vals[k], &xasl_state->vd.sys_datetime);
+	  error = db_datetime_to_timestamp (insert->vals[k], insert->vals[k]);
+	  break;
+	case DB_DEFAULT_UNIX_TIMESTAMP:
+	  DB_MAKE_DATETIME (insert->vals[k], &xasl_state->vd.sys_datetime);
+	  error = db_unix_timestamp (insert->vals[k], insert->vals[k]);
+	  break;
+	case DB_DEFAULT_USER:
+	  {
+	    int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+	    LOG_TDES *tdes = NULL;
+	    char *temp = NULL;
+
+	    tdes = LOG_FIND_TDES (tran_index);
+	    if (tdes)
+	      {
+		int len = strlen (tdes->client.db_user) + strlen (tdes->client.host_name) + 2;
+		temp = db_private_alloc (thread_p, len);
+		if (!temp)
+		  {
+		    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) len);
+		  }
+		else
+		  {
+		    strcpy (temp, tdes->client.db_user);
+		    strcat (temp, "@");
+		    strcat (temp, tdes->client.host_name);
+		  }
+	      }
+	    DB_MAKE_STRING (insert->vals[k], temp);
+	    insert->vals[k]->need_clear = true;
+	  }
+	  break;
+	case DB_DEFAULT_CURR_USER:
+	  {
+	    int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+	    LOG_TDES *tdes = NULL;
+	    char *temp = NULL;
+
+	    tdes = LOG_FIND_TDES (tran_index);
+	    if (tdes != NULL)
+	      {
+		temp = tdes->client.db_user;
+	      }
+	    DB_MAKE_STRING (insert->vals[k], temp);
+	  }
+	  break;
+	case DB_DEFAULT_NONE:
+	  if (attr->current_default_value.val_length <= 0)
 	    {
-	      if (fetch_peek_dbval (thread_p, &regu_list->value, &xasl_state->vd, &class_oid, NULL, NULL, &valp) !=
-		  NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      if (!qdata_copy_db_value (vallist->val, valp))
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      insert->vals[k] = valp;
+	      /* leave default value as NULL */
+	      break;
 	    }
-
-	  /* evaluate constraint predicate */
-	  satisfies_constraints = V_UNKNOWN;
-	  if (insert->cons_pred != NULL)
+	  else
 	    {
-	      satisfies_constraints = eval_pred (thread_p, insert->cons_pred, &xasl_state->vd, NULL);
-	      if (satisfies_constraints == V_ERROR)
+	      OR_BUF buf;
+	      PR_TYPE *pr_type = PR_TYPE_FROM_ID (attr->type);
+	      bool copy = (pr_is_set_type (attr->type)) ? true : false;
+	      if (pr_type != NULL)
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  or_init (&buf, attr->current_default_value.value, attr->current_default_value.val_length);
+		  buf.error_abort = 1;
+		  switch (_setjmp (buf.env))
+		    {
+		    case 0:
+		      error = (*(pr_type->data_readval)) (&buf, insert->vals[k], attr->domain,
+							  attr->current_default_value.val_length, copy, NULL, 0);
+		      if (error != NO_ERROR)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+		      break;
+		    default:
+		      error = ER_FAILED;
+		      GOTO_EXIT_ON_ERROR;
+		      break;
+		    }
 		}
 	    }
+	  break;
+	default:
+	  assert (0);
+	  error = ER_FAILED;
+	  GOTO_EXIT_ON_ERROR;
+	  break;
+	}
 
-	  if (insert->cons_pred != NULL && satisfies_constraints != V_TRUE)
-	    {
-	      /* currently there are only NOT NULL constraints */
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
-	      GOTO_EXIT_ON_ERROR;
-	    }
+      if (error != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
 
-	  if (heap_attrinfo_clear_dbvalues (&attr_info) != NO_ERROR)
+      if (attr->current_default_value.default_expr == DB_DEFAULT_NONE)
+	{
+	  /* skip the value cast */
+	  continue;
+	}
+
+      status = tp_value_cast (insert->vals[k], insert->vals[k], attr->domain, false);
+      if (status != DOMAIN_COMPATIBLE)
+	{
+	  (void) tp_domain_status_er_set (status, ARG_FILE_LINE, insert->vals[k], attr->domain);
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+
+  specp = xasl->spec_list;
+  if (specp != NULL || ((insert->do_replace || (xasl->dptr_list != NULL)) && insert->has_uniques)
+      || insert->no_val_lists > 1)
+    {
+      scan_cache_op_type = MULTI_ROW_INSERT;
+    }
+  else
+    {
+      scan_cache_op_type = SINGLE_ROW_INSERT;
+    }
+
+  if (specp)
+    {
+      /* we are inserting multiple values ... ie. insert into foo select ... */
+
+      /* if the class has at least one function index, the function expressions will be cached */
+      if (heap_init_func_pred_unpack_info (thread_p, &attr_info, &class_oid, &func_indx_preds) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      if (locator_start_force_scan_cache (thread_p, &scan_cache, &insert->class_hfid, &class_oid,
+					  scan_cache_op_type) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      scan_cache_inited = true;
+
+      assert (xasl->scan_op_type == S_SELECT);
+
+      /* force_select_lock = false */
+      if (qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state->vd, false, specp->fixed_scan,
+			   specp->grouped_scan, true, &specp->s_id, xasl_state->query_id, S_SELECT, false,
+			   NULL) != NO_ERROR)
+	{
+	  if (savepoint_used)
 	    {
-	      GOTO_EXIT_ON_ERROR;
+	      xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
 	    }
+	  qexec_failure_line (__LINE__, xasl_state);
+	  GOTO_EXIT_ON_ERROR;
+	}
 
-	  for (k = 0; k < val_no; ++k)
+      while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
+	{
+	  s_id = &xasl->curr_spec->s_id;
+	  while ((ls_scan = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
 	    {
-	      if (DB_IS_NULL (insert->vals[k]))
+	      for (k = no_default_expr, vallist = s_id->val_list->valp; k < val_no; k++, vallist = vallist->next)
 		{
-		  OR_ATTRIBUTE *attr = heap_locate_last_attrepr (insert->att_id[k], &attr_info);
-		  if (attr == NULL)
+		  if (vallist == NULL || vallist->val == NULL)
 		    {
+		      assert (0);
 		      GOTO_EXIT_ON_ERROR;
 		    }
 
-		  if (attr->is_autoincrement)
-		    {
-		      continue;
-		    }
+		  insert->vals[k] = vallist->val;
 		}
-	      rc = heap_attrinfo_set (NULL, insert->att_id[k], insert->vals[k], &attr_info);
-	      if (rc != NO_ERROR)
+
+	      /* evaluate constraint predicate */
+	      satisfies_constraints = V_UNKNOWN;
+	      if (insert->cons_pred != NULL)
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  satisfies_constraints = eval_pred (thread_p, insert->cons_pred, &xasl_state->vd, NULL);
+		  if (satisfies_constraints == V_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
 		}
-	    }
-
-	  if (heap_set_autoincrement_value (thread_p, &attr_info, &scan_cache, &is_autoincrement_set) != NO_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
 
-	  if (insert->do_replace && insert->has_uniques)
-	    {
-	      int removed_count = 0;
-	      assert (index_attr_info_inited == true);
-	      error =
-		qexec_remove_duplicates_for_replace (thread_p, &scan_cache, &attr_info, &index_attr_info, &idx_info,
-						     scan_cache_op_type, insert->pruning_type, pcontext,
-						     &removed_count);
-	      if (error != NO_ERROR)
+	      if (insert->cons_pred != NULL && satisfies_constraints != V_TRUE)
 		{
+		  /* currently there are only NOT NULL constraints */
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
 		  GOTO_EXIT_ON_ERROR;
 		}
-	      xasl->list_id->tuple_cnt += removed_count;
-	    }
 
-	  force_count = 0;
-	  if (odku_assignments && insert->has_uniques)
-	    {
-	      error =
-		qexec_execute_duplicate_key_update (thread_p, insert->odku, &insert->class_hfid, &xasl_state->vd,
-						    scan_cache_op_type, &scan_cache, &attr_info, &index_attr_info,
-						    &idx_info, insert->pruning_type, pcontext, &force_count);
-	      if (error != NO_ERROR)
+	      if (heap_attrinfo_clear_dbvalues (&attr_info) != NO_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
-
-	      if (force_count)
+	      for (k = 0; k < val_no; ++k)
 		{
-		  assert (force_count == 1);
-		  xasl->list_id->tuple_cnt += force_count * 2;
-		}
-	    }
-
-	  if (force_count == 0)
+		  if (DB_IS_NULL (insert->vals[k]))
+		    {
+		      OR_ATTRIBUTE *attr = heap_locate_last_attrepr (insert->att_id[k], &attr_info);
+
+		      if (attr == NULL)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+
+		      if (attr->is_autoincrement)
+			{
+			  continue;
+			}
+		    }
+
+
+		  rc = heap_attrinfo_set (NULL, insert->att_id[k], insert->vals[k], &attr_info);
+		  if (rc != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		}
+
+	      if (heap_set_autoincrement_value (thread_p, &attr_info, &scan_cache, &is_autoincrement_set) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      if (insert->do_replace && insert->has_uniques)
+		{
+		  int removed_count = 0;
+
+		  assert (index_attr_info_inited == true);
+
+		  if (qexec_remove_duplicates_for_replace (thread_p, &scan_cache, &attr_info, &index_attr_info,
+							   &idx_info, scan_cache_op_type, insert->pruning_type,
+							   pcontext, &removed_count) != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		  xasl->list_id->tuple_cnt += removed_count;
+		}
+
+	      if (odku_assignments && insert->has_uniques)
+		{
+		  force_count = 0;
+		  error =
+		    qexec_execute_duplicate_key_update (thread_p, insert->odku, &insert->class_hfid, &xasl_state->vd,
+							scan_cache_op_type, &scan_cache, &attr_info, &index_attr_info,
+							&idx_info, insert->pruning_type, pcontext, &force_count);
+		  if (error != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+
+		  if (force_count != 0)
+		    {
+		      assert (force_count == 1);
+
+		      xasl->list_id->tuple_cnt += force_count * 2;
+		      continue;
+		    }
+		}
+
+	      force_count = 0;
+	      /* when insert in heap, don't care about instance locking */
+	      if (locator_attribute_info_force (thread_p, &insert->class_hfid, &oid, &attr_info, NULL, 0, operation,
+						scan_cache_op_type, &scan_cache, &force_count, false,
+						REPL_INFO_TYPE_RBR_NORMAL, insert->pruning_type, pcontext,
+						func_indx_preds, NULL, UPDATE_INPLACE_NONE, NULL, false) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      /* restore class oid and hfid that might have changed in the call above */
+	      HFID_COPY (&insert->class_hfid, &class_hfid);
+	      COPY_OID (&(attr_info.class_oid), &class_oid);
+
+	      /* Instances are not put into the result list file, but are counted. */
+	      if (force_count)
+		{
+		  assert (force_count == 1);
+
+		  if (!OID_ISNULL (&oid) && XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS)
+		      && is_autoincrement_set > 0)
+		    {
+		      db_make_oid (&oid_val, &oid);
+		      if (qfile_fast_val_tuple_to_list (thread_p, xasl->list_id, &oid_val) != NO_ERROR)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+		    }
+		  else
+		    {
+		      xasl->list_id->tuple_cnt += force_count;
+		    }
+		}
+	    }
+
+	  if (ls_scan != S_END)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	}
+
+      if (xb_scan != S_END)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      qexec_close_scan (thread_p, specp);
+    }
+  else
+    {
+      /* we are inserting a single row ie. insert into foo values(...) */
+      REGU_VARIABLE_LIST regu_list = NULL;
+
+      if (locator_start_force_scan_cache (thread_p, &scan_cache, &insert->class_hfid, &class_oid, scan_cache_op_type) !=
+	  NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      scan_cache_inited = true;
+
+      if (XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE) && scan_cache.file_type == FILE_HEAP_REUSE_SLOTS)
+	{
+	  /* do not allow references to reusable oids in sub-inserts. this is a safety check and should have been
+	   * detected at semantic level */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_REFERENCE_TO_NON_REFERABLE_NOT_ALLOWED, 0);
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      for (i = 0; i < insert->no_val_lists; i++)
+	{
+	  for (regu_list = insert->valptr_lists[i]->valptrp, vallist = xasl->val_list->valp, k = no_default_expr;
+	       k < val_no; k++, regu_list = regu_list->next, vallist = vallist->next)
+	    {
+	      if (fetch_peek_dbval (thread_p, &regu_list->value, &xasl_state->vd, &class_oid, NULL, NULL, &valp) !=
+		  NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      if (!qdata_copy_db_value (vallist->val, valp))
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      insert->vals[k] = valp;
+	    }
+
+	  /* evaluate constraint predicate */
+	  satisfies_constraints = V_UNKNOWN;
+	  if (insert->cons_pred != NULL)
+	    {
+	      satisfies_constraints = eval_pred (thread_p, insert->cons_pred, &xasl_state->vd, NULL);
+	      if (satisfies_constraints == V_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+
+	  if (insert->cons_pred != NULL && satisfies_constraints != V_TRUE)
+	    {
+	      /* currently there are only NOT NULL constraints */
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  if (heap_attrinfo_clear_dbvalues (&attr_info) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  for (k = 0; k < val_no; ++k)
+	    {
+	      if (DB_IS_NULL (insert->vals[k]))
+		{
+		  OR_ATTRIBUTE *attr = heap_locate_last_attrepr (insert->att_id[k], &attr_info);
+		  if (attr == NULL)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+
+		  if (attr->is_autoincrement)
+		    {
+		      continue;
+		    }
+		}
+	      rc = heap_attrinfo_set (NULL, insert->att_id[k], insert->vals[k], &attr_info);
+	      if (rc != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+
+	  if (heap_set_autoincrement_value (thread_p, &attr_info, &scan_cache, &is_autoincrement_set) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  if (insert->do_replace && insert->has_uniques)
+	    {
+	      int removed_count = 0;
+	      assert (index_attr_info_inited == true);
+	      error =
+		qexec_remove_duplicates_for_replace (thread_p, &scan_cache, &attr_info, &index_attr_info, &idx_info,
+						     scan_cache_op_type, insert->pruning_type, pcontext,
+						     &removed_count);
+	      if (error != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      xasl->list_id->tuple_cnt += removed_count;
+	    }
+
+	  force_count = 0;
+	  if (odku_assignments && insert->has_uniques)
+	    {
+	      error =
+		qexec_execute_duplicate_key_update (thread_p, insert->odku, &insert->class_hfid, &xasl_state->vd,
+						    scan_cache_op_type, &scan_cache, &attr_info, &index_attr_info,
+						    &idx_info, insert->pruning_type, pcontext, &force_count);
+	      if (error != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      if (force_count)
+		{
+		  assert (force_count == 1);
+		  xasl->list_id->tuple_cnt += force_count * 2;
+		}
+	    }
+
+	  if (force_count == 0)
 	    {
 	      if (locator_attribute_info_force (thread_p, &insert->class_hfid, &oid, &attr_info, NULL, 0, operation,
 						scan_cache_op_type, &scan_cache, &force_count, false,
@@ -12821,7 +13623,7 @@ qexec_end_buildvalueblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl,
 	    {
 	      /* allocate tuple descriptor */
 	      tplrec->size = DB_PAGESIZE;
-	      tplrec->tpl = (QFILE_TUPLE) db_private_alloc (thread_p, DB_PAGESIZE);
+	      tplrec->tpl = (QFILE_TUPLE) db_arena_alloc (thread_p, DB_PAGESIZE);
 	      if (tplrec->tpl == NULL)
 		{
 		  GOTO_EXIT_ON_ERROR;
@@ -13132,6 +13934,9 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
   int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   bool instant_lock_mode_started = false;
   bool mvcc_select_lock_needed;
+#if defined(SERVER_MODE)
+  QEXEC_PX_SCAN *px_scan = NULL;
+#endif /* SERVER_MODE */
 
   /* 
    * Pre_processing
@@ -13666,434 +14471,1118 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 			      GOTO_EXIT_ON_ERROR;
 			    }
 
-			  if (p_class_instance_lock_info && specp->type == TARGET_CLASS
-			      && OID_EQ (&specp->s.cls_node.cls_oid, &p_class_instance_lock_info->class_oid)
-			      && mvcc_select_lock_needed)
-			    {
-			      /* the instances are locked at select phase */
-			      p_class_instance_lock_info->instances_locked = true;
-			    }
-			}
-		    }
-		}
-	    }
+			  if (p_class_instance_lock_info && specp->type == TARGET_CLASS
+			      && OID_EQ (&specp->s.cls_node.cls_oid, &p_class_instance_lock_info->class_oid)
+			      && mvcc_select_lock_needed)
+			    {
+			      /* the instances are locked at select phase */
+			      p_class_instance_lock_info->instances_locked = true;
+			    }
+			}
+		    }
+		}
+	    }
+
+	  /* allocate xasl scan function vector */
+	  func_vector = (XASL_SCAN_FNC_PTR) db_arena_alloc (thread_p, level * sizeof (XSAL_SCAN_FUNC));
+	  if (func_vector == NULL)
+	    {
+	      qexec_clear_mainblock_iterations (thread_p, xasl);
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  /* determine the type of XASL block associated functions */
+	  if (xasl->merge_spec)
+	    {
+	      func_vector[0] = (XSAL_SCAN_FUNC) qexec_merge_fnc;
+	      /* monitor */
+	      mnt_qm_mjoins (thread_p);
+	    }
+	  else
+	    {
+	      for (xptr = xasl, level = 0; xptr; xptr = xptr->scan_ptr, level++)
+		{
+
+		  /* set all the following scan blocks to off */
+		  xasl->next_scan_block_on = false;
+
+		  /* set the associated function with the scan */
+
+		  /* Having more than one interpreter function was a bad idea, so I've removed the specialized ones.
+		   * dkh. */
+		  if (level == 0)
+		    {
+		      func_vector[level] = (XSAL_SCAN_FUNC) qexec_intprt_fnc;
+		    }
+		  else
+		    {
+		      func_vector[level] = (XSAL_SCAN_FUNC) qexec_execute_scan;
+		      /* monitor */
+		      mnt_qm_nljoins (thread_p);
+		    }
+		}
+	    }
+
+	  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
+	    {
+	      if (xasl->connect_by_ptr == NULL)
+		{
+		  qexec_clear_mainblock_iterations (thread_p, xasl);
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      /* initialize CONNECT BY internal lists */
+	      if (qexec_start_connect_by_lists (thread_p, xasl->connect_by_ptr, xasl_state) != NO_ERROR)
+		{
+		  qexec_clear_mainblock_iterations (thread_p, xasl);
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+
+	  if (query_multi_range_opt_check_set_sort_col (thread_p, xasl) != NO_ERROR)
+	    {
+	      qexec_clear_mainblock_iterations (thread_p, xasl);
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+#if defined(SERVER_MODE)
+	  /* let other threads help with the heap scan if the query allows it */
+	  px_scan = qexec_start_parallel_scan (thread_p, xasl, xasl_state);
+#endif /* SERVER_MODE */
+
+	  /* call the first xasl interpreter function */
+	  qp_scan = (*func_vector[0]) (thread_p, xasl, xasl_state, &tplrec, &func_vector[1]);
+
+#if defined(SERVER_MODE)
+	  if (px_scan != NULL)
+	    {
+	      /* merge the results of the helpers */
+	      if (qexec_end_parallel_scan (thread_p, px_scan, xasl, qp_scan == S_SUCCESS) != NO_ERROR)
+		{
+		  qp_scan = S_ERROR;
+		}
+	      px_scan = NULL;
+	    }
+#endif /* SERVER_MODE */
+
+	  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
+	    {
+	      /* close CONNECT BY internal lists */
+	      qexec_end_connect_by_lists (thread_p, xasl->connect_by_ptr);
+	    }
+
+	  /* free the function vector */
+	  db_private_free_and_init (thread_p, func_vector);
+
+	  /* close all the scans that are involved within the query */
+	  for (xptr = xasl, level = 0; xptr; xptr = xptr->scan_ptr, level++)
+	    {
+	      spec_ptr[0] = xptr->spec_list;
+	      spec_ptr[1] = xptr->merge_spec;
+	      for (spec_level = 0; spec_level < 2; ++spec_level)
+		{
+		  for (specp = spec_ptr[spec_level]; specp; specp = specp->next)
+		    {
+		      qexec_end_scan (thread_p, specp);
+		      qexec_close_scan (thread_p, specp);
+		    }
+		}
+	      if (xptr->curr_spec != NULL)
+		{
+		  xptr->curr_spec->curent = NULL;
+		  xptr->curr_spec = NULL;
+		}
+	    }
+
+	  if (qp_scan != S_SUCCESS)	/* error case */
+	    {
+	      qexec_clear_mainblock_iterations (thread_p, xasl);
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  /* process CONNECT BY xasl */
+	  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
+	    {
+	      TSC_TICKS start_tick, end_tick;
+	      TSCTIMEVAL tv_diff;
+
+	      UINT64 old_fetches = 0, old_ioreads = 0;
+	      XASL_STATS *xasl_stats;
+	      bool on_trace;
+
+	      on_trace = thread_is_on_trace (thread_p);
+	      if (on_trace)
+		{
+		  tsc_getticks (&start_tick);
+
+		  old_fetches = mnt_get_pb_fetches (thread_p);
+		  old_ioreads = mnt_get_pb_ioreads (thread_p);
+		}
+
+	      if (qexec_execute_connect_by (thread_p, xasl->connect_by_ptr, xasl_state, &tplrec) != NO_ERROR)
+		{
+		  qexec_clear_mainblock_iterations (thread_p, xasl);
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      /* scan CONNECT BY results, apply WHERE, add to xasl->list_id */
+	      if (qexec_iterate_connect_by_results (thread_p, xasl, xasl_state, &tplrec) != NO_ERROR)
+		{
+		  qexec_clear_mainblock_iterations (thread_p, xasl);
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      /* clear CONNECT BY internal lists */
+	      qexec_clear_connect_by_lists (thread_p, xasl->connect_by_ptr);
+
+	      if (on_trace)
+		{
+		  xasl_stats = &xasl->connect_by_ptr->xasl_stats;
+
+		  tsc_getticks (&end_tick);
+		  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+		  TSC_ADD_TIMEVAL (xasl_stats->elapsed_time, tv_diff);
+
+		  xasl_stats->fetches = mnt_get_pb_fetches (thread_p) - old_fetches;
+		  xasl_stats->ioreads = mnt_get_pb_ioreads (thread_p) - old_ioreads;
+		}
+	    }
+	}
+
+      if (xasl->selected_upd_list)
+	{
+	  if (xasl->list_id->tuple_cnt > 1)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_QRY_SINGLE_TUPLE, 0);
+	      qexec_clear_mainblock_iterations (thread_p, xasl);
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	  else if (xasl->list_id->tuple_cnt == 1)
+	    {
+	      old_wait_msecs = XASL_WAIT_MSECS_NOCHANGE;
+	      if (xasl->selected_upd_list->wait_msecs != XASL_WAIT_MSECS_NOCHANGE)
+		{
+		  old_wait_msecs = xlogtb_reset_wait_msecs (thread_p, xasl->selected_upd_list->wait_msecs);
+		}
+
+	      error = qexec_execute_selupd_list (thread_p, xasl, xasl_state);
+	      if (old_wait_msecs != XASL_WAIT_MSECS_NOCHANGE)
+		{
+		  (void) xlogtb_reset_wait_msecs (thread_p, old_wait_msecs);
+		}
+
+	      assert (lock_is_instant_lock_mode (tran_index) == false);
+	      instant_lock_mode_started = false;
+
+	      if (error != NO_ERROR)
+		{
+		  qexec_clear_mainblock_iterations (thread_p, xasl);
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+	  else
+	    {
+	      if (instant_lock_mode_started == true)
+		{
+		  lock_stop_instant_lock_mode (thread_p, tran_index, true);
+		  instant_lock_mode_started = false;
+		}
+	    }
+	}
+
+      /* end main block iterations */
+      if (qexec_end_mainblock_iterations (thread_p, xasl, xasl_state, &tplrec) != NO_ERROR)
+	{
+	  qexec_clear_mainblock_iterations (thread_p, xasl);
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      /* 
+       * Post_processing
+       */
+
+      /* 
+       * DISTINCT processing caused by statement set operators(UNION,
+       * DIFFERENCE, INTERSECTION) has already taken place now.
+       * But, in the other cases, DISTINCT are not processed yet.
+       * qexec_orderby_distinct() will handle it.
+       */
+
+      /* GROUP BY processing */
+
+      /* if groupby skip, we compute group by from the already sorted list */
+      if (xasl->spec_list && xasl->spec_list->indexptr && xasl->spec_list->indexptr->groupby_skip)
+	{
+	  if (qexec_groupby_index (thread_p, xasl, xasl_state, &tplrec) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	}
+      else if (xasl->type == BUILDLIST_PROC	/* it is SELECT query */
+	       && xasl->proc.buildlist.groupby_list)	/* it has GROUP BY clause */
+	{
+	  if (qexec_groupby (thread_p, xasl, xasl_state, &tplrec) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	}
+
+      /* process analytic functions */
+      if (xasl->type == BUILDLIST_PROC && xasl->proc.buildlist.a_eval_list)
+	{
+	  ANALYTIC_EVAL_TYPE *eval_list;
+	  for (eval_list = xasl->proc.buildlist.a_eval_list; eval_list; eval_list = eval_list->next)
+	    {
+	      if (qexec_execute_analytic (thread_p, xasl, xasl_state, eval_list, &tplrec, (eval_list->next == NULL)) !=
+		  NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+	}
+
+      if ((COMPOSITE_LOCK (xasl->scan_op_type) || QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl))
+	  && XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG))
+	{
+	  if (lock_finalize_composite_lock (thread_p, &xasl->composite_lock) != LK_GRANTED)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	}
+
+#if 0				/* DO NOT DELETE ME !!! - yaw: for future work */
+      if (xasl->list_id->tuple_cnt == 0)
+	{
+	  /* skip post processing for empty list file */
+
+	  /* monitor */
+	  mnt_qm_selects (thread_p);
+	  break;
+	}
+#endif
+
+
+      /* ORDER BY and DISTINCT processing */
+      if (xasl->type == UNION_PROC || xasl->type == DIFFERENCE_PROC || xasl->type == INTERSECTION_PROC)
+	{
+	  /* DISTINCT was already processed in these cases. Consider only ORDER BY */
+	  if (xasl->orderby_list	/* it has ORDER BY clause */
+	      && (xasl->list_id->tuple_cnt > 1	/* the result has more than one tuple */
+		  || xasl->ordbynum_val != NULL))	/* ORDERBY_NUM() is used */
+	    {
+	      /* It has ORDER BY clause and the result has more than one tuple. We cannot skip the processing some
+	       * cases such as 'orderby_num() < 1', for example. */
+	      if (qexec_orderby_distinct (thread_p, xasl, Q_ALL, xasl_state) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+	}
+      else
+	{
+	  /* DISTINCT & ORDER BY check orderby_list flag for skipping order by */
+	  if ((xasl->orderby_list	/* it has ORDER BY clause */
+	       && (!XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)	/* cannot skip */
+		   || XASL_IS_FLAGED (xasl, XASL_USES_MRO))	/* MRO must go on */
+	       && (xasl->list_id->tuple_cnt > 1	/* the result has more than one tuple */
+		   || xasl->ordbynum_val != NULL	/* ORDERBY_NUM() is used */
+		   || xasl->topn_items != NULL))	/* used internal sort */
+	      || (xasl->option == Q_DISTINCT))	/* DISTINCT must be go on */
+	    {
+	      if (qexec_orderby_distinct (thread_p, xasl, xasl->option, xasl_state) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+	}
+
+      /* monitor */
+      mnt_qm_selects (thread_p);
+      break;
+    }
+
+  if (xasl->is_single_tuple)
+    {
+      if (xasl->list_id->tuple_cnt > 1)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_QRY_SINGLE_TUPLE, 0);
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      if (xasl->single_tuple
+	  && (qdata_get_single_tuple_from_list_id (thread_p, xasl->list_id, xasl->single_tuple) != NO_ERROR))
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+
+
+  /* 
+   * Cleanup and Exit processing
+   */
+  if (instant_lock_mode_started == true)
+    {
+      assert (lock_is_instant_lock_mode (tran_index) == false);
+      /* a safe guard */
+      lock_stop_instant_lock_mode (thread_p, tran_index, true);
+    }
+
+  /* destroy hash table */
+  if (xasl->type == BUILDLIST_PROC)
+    {
+      qexec_free_agg_hash_context (thread_p, &xasl->proc.buildlist);
+    }
+
+  /* clear only non-zero correlation-level uncorrelated subquery list files */
+  for (xptr = xasl; xptr; xptr = xptr->scan_ptr)
+    {
+      if (xptr->aptr_list)
+	{
+	  qexec_clear_head_lists (thread_p, xptr->aptr_list);
+	}
+    }
+  if (tplrec.tpl)
+    {
+      db_private_free_and_init (thread_p, tplrec.tpl);
+    }
+
+  xasl->status = XASL_SUCCESS;
+
+  return NO_ERROR;
+
+  /* 
+   * Error processing
+   */
+exit_on_error:
+#if defined(SERVER_MODE)
+  /* query execution error must be set up before qfile_close_list(). */
+  if (er_errid () < 0)
+    {
+      qmgr_set_query_error (thread_p, xasl_state->query_id);
+    }
+#endif
+
+  if (instant_lock_mode_started == true)
+    {
+      lock_stop_instant_lock_mode (thread_p, tran_index, true);
+    }
+  qfile_close_list (thread_p, xasl->list_id);
+  if (func_vector)
+    {
+      db_private_free_and_init (thread_p, func_vector);
+    }
+
+  /* close all the scans that are involved within the query */
+  for (xptr = xasl, level = 0; xptr; xptr = xptr->scan_ptr, level++)
+    {
+      spec_ptr[0] = xptr->spec_list;
+      spec_ptr[1] = xptr->merge_spec;
+      for (spec_level = 0; spec_level < 2; ++spec_level)
+	{
+	  for (specp = spec_ptr[spec_level]; specp; specp = specp->next)
+	    {
+	      qexec_end_scan (thread_p, specp);
+	      qexec_close_scan (thread_p, specp);
+	    }
+	}
+      if (xptr->curr_spec != NULL)
+	{
+	  xptr->curr_spec->curent = NULL;
+	  xptr->curr_spec = NULL;
+	}
+    }
+
+  if (tplrec.tpl)
+    {
+      db_private_free_and_init (thread_p, tplrec.tpl);
+    }
+
+  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
+    {
+      qexec_clear_connect_by_lists (thread_p, xasl->connect_by_ptr);
+    }
+
+  /* destroy hash table */
+  if (xasl->type == BUILDLIST_PROC)
+    {
+      qexec_free_agg_hash_context (thread_p, &xasl->proc.buildlist);
+    }
+
+  /* free alloced memory for composite locking */
+  lock_abort_composite_lock (&xasl->composite_lock);
+
+  xasl->status = XASL_FAILURE;
+
+  qexec_failure_line (__LINE__, xasl_state);
+  return ER_FAILED;
+}
+
+/*
+ * qexec_resolve_buildvalue_output_domains () - Set the domains of the output
+ *                                              values computed by aggregates
+ *   return:
+ *   xasl(in): BUILDVALUE_PROC XASL node
+ */
+static void
+qexec_resolve_buildvalue_output_domains (XASL_NODE * xasl)
+{
+  AGGREGATE_TYPE *agg_node = NULL;
+  REGU_VARIABLE_LIST out_list_val = NULL;
+
+  for (out_list_val = xasl->outptr_list->valptrp; out_list_val != NULL; out_list_val = out_list_val->next)
+    {
+      assert (out_list_val->value.domain != NULL);
 
-	  /* allocate xasl scan function vector */
-	  func_vector = (XASL_SCAN_FNC_PTR) db_private_alloc (thread_p, level * sizeof (XSAL_SCAN_FUNC));
-	  if (func_vector == NULL)
-	    {
-	      qexec_clear_mainblock_iterations (thread_p, xasl);
-	      GOTO_EXIT_ON_ERROR;
-	    }
+      /* aggregates corresponds to CONSTANT regu vars in outptr_list */
+      if (out_list_val->value.type != TYPE_CONSTANT
+	  || (TP_DOMAIN_TYPE (out_list_val->value.domain) != DB_TYPE_VARIABLE
+	      && TP_DOMAIN_COLLATION_FLAG (out_list_val->value.domain) == TP_DOMAIN_COLL_NORMAL))
+	{
+	  continue;
+	}
 
-	  /* determine the type of XASL block associated functions */
-	  if (xasl->merge_spec)
+      /* search in aggregate list by comparing DB_VALUE pointers */
+      for (agg_node = xasl->proc.buildvalue.agg_list; agg_node != NULL; agg_node = agg_node->next)
+	{
+	  if (out_list_val->value.value.dbvalptr == agg_node->accumulator.value && agg_node->domain != NULL
+	      && TP_DOMAIN_TYPE (agg_node->domain) != DB_TYPE_NULL)
 	    {
-	      func_vector[0] = (XSAL_SCAN_FUNC) qexec_merge_fnc;
-	      /* monitor */
-	      mnt_qm_mjoins (thread_p);
+	      assert (TP_DOMAIN_COLLATION_FLAG (agg_node->domain) == TP_DOMAIN_COLL_NORMAL);
+	      out_list_val->value.domain = agg_node->domain;
 	    }
-	  else
-	    {
-	      for (xptr = xasl, level = 0; xptr; xptr = xptr->scan_ptr, level++)
-		{
+	}
+    }
+}
 
-		  /* set all the following scan blocks to off */
-		  xasl->next_scan_block_on = false;
+#if defined(SERVER_MODE)
+/*
+ * qexec_can_scan_in_parallel () - Check whether the heap scan of a query may
+ *                                 be split among several threads
+ *   return: true if the scan may run in parallel
+ *   thread_p(in):
+ *   xasl(in): XASL tree
+ *
+ * Note: Only aggregate queries without grouping that scan a single class
+ * sequentially are eligible. Their result is made of aggregate
+ * accumulators that can be computed separately by each thread and merged at
+ * the end. Queries producing list files, joins, subqueries, path
+ * expressions, instnum() and locking reads are always executed serially.
+ */
+static bool
+qexec_can_scan_in_parallel (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  ACCESS_SPEC_TYPE *specp;
+  AGGREGATE_TYPE *agg_p;
 
-		  /* set the associated function with the scan */
+  if (prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_THREADS) <= 0)
+    {
+      return false;
+    }
 
-		  /* Having more than one interpreter function was a bad idea, so I've removed the specialized ones.
-		   * dkh. */
-		  if (level == 0)
-		    {
-		      func_vector[level] = (XSAL_SCAN_FUNC) qexec_intprt_fnc;
-		    }
-		  else
-		    {
-		      func_vector[level] = (XSAL_SCAN_FUNC) qexec_execute_scan;
-		      /* monitor */
-		      mnt_qm_nljoins (thread_p);
-		    }
-		}
-	    }
+  if (xasl->type != BUILDVALUE_PROC || !XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL)
+      || xasl->proc.buildvalue.agg_list == NULL || xasl->proc.buildvalue.is_always_false)
+    {
+      return false;
+    }
 
-	  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
-	    {
-	      if (xasl->connect_by_ptr == NULL)
-		{
-		  qexec_clear_mainblock_iterations (thread_p, xasl);
-		  GOTO_EXIT_ON_ERROR;
-		}
+  if (xasl->scan_ptr != NULL || xasl->merge_spec != NULL || xasl->aptr_list != NULL || xasl->bptr_list != NULL
+      || xasl->dptr_list != NULL || xasl->fptr_list != NULL || xasl->connect_by_ptr != NULL
+      || xasl->instnum_pred != NULL || XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY) || xasl->scan_op_type != S_SELECT)
+    {
+      return false;
+    }
 
-	      /* initialize CONNECT BY internal lists */
-	      if (qexec_start_connect_by_lists (thread_p, xasl->connect_by_ptr, xasl_state) != NO_ERROR)
-		{
-		  qexec_clear_mainblock_iterations (thread_p, xasl);
-		  GOTO_EXIT_ON_ERROR;
-		}
-	    }
+  specp = xasl->spec_list;
+  if (specp == NULL || specp->next != NULL || specp->type != TARGET_CLASS || specp->access != SEQUENTIAL
+      || specp->pruning_type == DB_PARTITIONED_CLASS || !specp->fixed_scan || specp->s_id.type != S_HEAP_SCAN
+      || specp->s_id.status != S_OPENED || specp->s_id.mvcc_select_lock_needed || specp->s_id.scan_immediately_stop
+      || (specp->flags & ACCESS_SPEC_FLAG_FOR_UPDATE) || OID_IS_ROOTOID (&ACCESS_SPEC_CLS_OID (specp))
+      || HFID_IS_NULL (&ACCESS_SPEC_HFID (specp)))
+    {
+      return false;
+    }
 
-	  if (query_multi_range_opt_check_set_sort_col (thread_p, xasl) != NO_ERROR)
-	    {
-	      qexec_clear_mainblock_iterations (thread_p, xasl);
-	      GOTO_EXIT_ON_ERROR;
-	    }
+  for (agg_p = xasl->proc.buildvalue.agg_list; agg_p != NULL; agg_p = agg_p->next)
+    {
+      if (agg_p->option == Q_DISTINCT || agg_p->sort_list != NULL)
+	{
+	  return false;
+	}
 
-	  /* call the first xasl interpreter function */
-	  qp_scan = (*func_vector[0]) (thread_p, xasl, xasl_state, &tplrec, &func_vector[1]);
+      if (agg_p->flag_agg_optimize && agg_p->function != PT_COUNT_STAR)
+	{
+	  /* evaluated from the index statistics */
+	  return false;
+	}
 
-	  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
-	    {
-	      /* close CONNECT BY internal lists */
-	      qexec_end_connect_by_lists (thread_p, xasl->connect_by_ptr);
-	    }
+      switch (agg_p->function)
+	{
+	case PT_COUNT_STAR:
+	case PT_COUNT:
+	case PT_MIN:
+	case PT_MAX:
+	case PT_SUM:
+	case PT_AVG:
+	case PT_STDDEV:
+	case PT_STDDEV_POP:
+	case PT_STDDEV_SAMP:
+	case PT_VARIANCE:
+	case PT_VAR_POP:
+	case PT_VAR_SAMP:
+	case PT_AGG_BIT_AND:
+	case PT_AGG_BIT_OR:
+	case PT_AGG_BIT_XOR:
+	  break;
 
-	  /* free the function vector */
-	  db_private_free_and_init (thread_p, func_vector);
+	default:
+	  return false;
+	}
+    }
 
-	  /* close all the scans that are involved within the query */
-	  for (xptr = xasl, level = 0; xptr; xptr = xptr->scan_ptr, level++)
-	    {
-	      spec_ptr[0] = xptr->spec_list;
-	      spec_ptr[1] = xptr->merge_spec;
-	      for (spec_level = 0; spec_level < 2; ++spec_level)
-		{
-		  for (specp = spec_ptr[spec_level]; specp; specp = specp->next)
-		    {
-		      qexec_end_scan (thread_p, specp);
-		      qexec_close_scan (thread_p, specp);
-		    }
-		}
-	      if (xptr->curr_spec != NULL)
-		{
-		  xptr->curr_spec->curent = NULL;
-		  xptr->curr_spec = NULL;
-		}
-	    }
+  if (file_get_numpages (thread_p, &ACCESS_SPEC_HFID (specp).vfid) <
+      prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_MIN_PAGES))
+    {
+      return false;
+    }
 
-	  if (qp_scan != S_SUCCESS)	/* error case */
-	    {
-	      qexec_clear_mainblock_iterations (thread_p, xasl);
-	      GOTO_EXIT_ON_ERROR;
-	    }
+  return true;
+}
 
-	  /* process CONNECT BY xasl */
-	  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
-	    {
-	      TSC_TICKS start_tick, end_tick;
-	      TSCTIMEVAL tv_diff;
+/*
+ * qexec_start_parallel_scan () - Start the threads helping the heap scan of a
+ *                                query
+ *   return: parallel scan descriptor, or NULL if the query runs serially
+ *   thread_p(in):
+ *   xasl(in): XASL tree; its scans are already opened
+ *   xasl_state(in): XASL tree state information
+ *
+ * Note: Every helper unpacks its own copy of the XASL tree from the cached
+ * stream, scans the heap pages it gets from the shared page cursor and keeps
+ * its aggregate accumulators. The calling thread scans pages from the same
+ * cursor as usual. The accumulators are merged by qexec_end_parallel_scan.
+ */
+static QEXEC_PX_SCAN *
+qexec_start_parallel_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
+{
+  QEXEC_PX_SCAN *px;
+  QMGR_QUERY_ENTRY *query_p;
+  CSS_CONN_ENTRY *conn_p;
+  CSS_JOB_ENTRY *job_entry_p;
+  int tran_index, conn_index;
+  int num_workers, i;
 
-	      UINT64 old_fetches = 0, old_ioreads = 0;
-	      XASL_STATS *xasl_stats;
-	      bool on_trace;
+  if (!qexec_can_scan_in_parallel (thread_p, xasl))
+    {
+      return NULL;
+    }
 
-	      on_trace = thread_is_on_trace (thread_p);
-	      if (on_trace)
-		{
-		  tsc_getticks (&start_tick);
+  /* the helpers unpack the XASL tree from the cached stream */
+  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  query_p = qmgr_get_query_entry (thread_p, xasl_state->query_id, tran_index);
+  if (query_p == NULL || XASL_ID_IS_NULL (&query_p->xasl_id))
+    {
+      return NULL;
+    }
 
-		  old_fetches = mnt_get_pb_fetches (thread_p);
-		  old_ioreads = mnt_get_pb_ioreads (thread_p);
-		}
+  /* the helpers must share the snapshot of the transaction */
+  if (logtb_get_mvcc_snapshot (thread_p) == NULL)
+    {
+      return NULL;
+    }
 
-	      if (qexec_execute_connect_by (thread_p, xasl->connect_by_ptr, xasl_state, &tplrec) != NO_ERROR)
-		{
-		  qexec_clear_mainblock_iterations (thread_p, xasl);
-		  GOTO_EXIT_ON_ERROR;
-		}
+  num_workers = prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_THREADS);
 
-	      /* scan CONNECT BY results, apply WHERE, add to xasl->list_id */
-	      if (qexec_iterate_connect_by_results (thread_p, xasl, xasl_state, &tplrec) != NO_ERROR)
-		{
-		  qexec_clear_mainblock_iterations (thread_p, xasl);
-		  GOTO_EXIT_ON_ERROR;
-		}
+  /* shared with the helper threads, cannot use the private heap */
+  px = (QEXEC_PX_SCAN *) malloc (sizeof (QEXEC_PX_SCAN) + num_workers * sizeof (QEXEC_PX_WORKER));
+  if (px == NULL)
+    {
+      /* run serially */
+      return NULL;
+    }
 
-	      /* clear CONNECT BY internal lists */
-	      qexec_clear_connect_by_lists (thread_p, xasl->connect_by_ptr);
+  if (heap_parallel_scan_init (&px->heap_scan, &ACCESS_SPEC_HFID (xasl->spec_list)) != NO_ERROR)
+    {
+      free_and_init (px);
+      er_clear ();
+      return NULL;
+    }
 
-	      if (on_trace)
-		{
-		  xasl_stats = &xasl->connect_by_ptr->xasl_stats;
+  XASL_ID_COPY (&px->xasl_id, &query_p->xasl_id);
+  px->vd = xasl_state->vd;
+  px->query_id = xasl_state->query_id;
+  px->tran_index = tran_index;
+  px->ref_count = 1;
+  px->num_running = 0;
+  px->is_closed = false;
+  px->workers = (QEXEC_PX_WORKER *) (px + 1);
+  pthread_mutex_init (&px->mutex, NULL);
+  pthread_cond_init (&px->cond, NULL);
 
-		  tsc_getticks (&end_tick);
-		  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
-		  TSC_ADD_TIMEVAL (xasl_stats->elapsed_time, tv_diff);
+  for (i = 0; i < num_workers; i++)
+    {
+      px->workers[i].px = px;
+      px->workers[i].agg_area = NULL;
+      px->workers[i].error = NO_ERROR;
+      px->workers[i].has_er_area = false;
+    }
 
-		  xasl_stats->fetches = mnt_get_pb_fetches (thread_p) - old_fetches;
-		  xasl_stats->ioreads = mnt_get_pb_ioreads (thread_p) - old_ioreads;
-		}
-	    }
-	}
+  conn_p = thread_get_current_conn_entry ();
+  conn_index = (conn_p) ? conn_p->idx : 0;
 
-      if (xasl->selected_upd_list)
+  for (i = 0; i < num_workers; i++)
+    {
+      /* explicit job queue index */
+      job_entry_p =
+	css_make_job_entry (conn_p, (CSS_THREAD_FN) qexec_parallel_scan_worker, (CSS_THREAD_ARG) & px->workers[i],
+			    conn_index + i + 1);
+      if (job_entry_p == NULL)
 	{
-	  if (xasl->list_id->tuple_cnt > 1)
-	    {
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_QRY_SINGLE_TUPLE, 0);
-	      qexec_clear_mainblock_iterations (thread_p, xasl);
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	  else if (xasl->list_id->tuple_cnt == 1)
-	    {
-	      old_wait_msecs = XASL_WAIT_MSECS_NOCHANGE;
-	      if (xasl->selected_upd_list->wait_msecs != XASL_WAIT_MSECS_NOCHANGE)
-		{
-		  old_wait_msecs = xlogtb_reset_wait_msecs (thread_p, xasl->selected_upd_list->wait_msecs);
-		}
+	  /* do with the helpers already started */
+	  er_clear ();
+	  break;
+	}
 
-	      error = qexec_execute_selupd_list (thread_p, xasl, xasl_state);
-	      if (old_wait_msecs != XASL_WAIT_MSECS_NOCHANGE)
-		{
-		  (void) xlogtb_reset_wait_msecs (thread_p, old_wait_msecs);
-		}
+      pthread_mutex_lock (&px->mutex);
+      px->ref_count++;
+      pthread_mutex_unlock (&px->mutex);
 
-	      assert (lock_is_instant_lock_mode (tran_index) == false);
-	      instant_lock_mode_started = false;
+      css_add_to_job_queue (job_entry_p);
+    }
+  px->num_workers = i;
 
-	      if (error != NO_ERROR)
+  /* the scan of this thread takes its pages from the shared cursor too */
+  scan_set_parallel_heap_scan (&xasl->spec_list->s_id, &px->heap_scan);
+
+  return px;
+}
+
+/*
+ * qexec_end_parallel_scan () - Wait for the helpers of a parallel heap scan
+ *                              and merge their results
+ *   return: error code
+ *   thread_p(in):
+ *   px(in): parallel scan descriptor; released by this function
+ *   xasl(in): XASL tree
+ *   is_scan_done(in): false if the scan of this thread was not completed
+ */
+static int
+qexec_end_parallel_scan (THREAD_ENTRY * thread_p, QEXEC_PX_SCAN * px, XASL_NODE * xasl, bool is_scan_done)
+{
+  QEXEC_PX_WORKER *worker;
+  int error = NO_ERROR;
+  int i;
+
+  if (!is_scan_done)
+    {
+      /* do not let the helpers scan the rest of the heap */
+      heap_parallel_scan_stop (&px->heap_scan);
+    }
+
+  /* helpers that did not start yet will find nothing to do */
+  pthread_mutex_lock (&px->mutex);
+  px->is_closed = true;
+  while (px->num_running > 0)
+    {
+      pthread_cond_wait (&px->cond, &px->mutex);
+    }
+  pthread_mutex_unlock (&px->mutex);
+
+  if (xasl->spec_list != NULL)
+    {
+      xasl->spec_list->s_id.s.hsid.px_scan = NULL;
+    }
+
+  if (is_scan_done)
+    {
+      for (i = 0; i < px->num_workers && error == NO_ERROR; i++)
+	{
+	  worker = &px->workers[i];
+	  if (worker->error != NO_ERROR)
+	    {
+	      if (worker->has_er_area)
+		{
+		  (void) er_set_area_error (worker->er_area);
+		}
+	      else
 		{
-		  qexec_clear_mainblock_iterations (thread_p, xasl);
-		  GOTO_EXIT_ON_ERROR;
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
 		}
+	      error = worker->error;
 	    }
-	  else
+	  else if (worker->agg_area != NULL)
 	    {
-	      if (instant_lock_mode_started == true)
-		{
-		  lock_stop_instant_lock_mode (thread_p, tran_index, true);
-		  instant_lock_mode_started = false;
-		}
+	      error = qexec_merge_parallel_aggregates (thread_p, xasl->proc.buildvalue.agg_list, worker->agg_area);
 	    }
 	}
 
-      /* end main block iterations */
-      if (qexec_end_mainblock_iterations (thread_p, xasl, xasl_state, &tplrec) != NO_ERROR)
+      if (error == NO_ERROR)
 	{
-	  qexec_clear_mainblock_iterations (thread_p, xasl);
-	  GOTO_EXIT_ON_ERROR;
+	  qexec_resolve_buildvalue_output_domains (xasl);
 	}
+    }
 
-      /* 
-       * Post_processing
-       */
+  qexec_release_parallel_scan (px);
 
-      /* 
-       * DISTINCT processing caused by statement set operators(UNION,
-       * DIFFERENCE, INTERSECTION) has already taken place now.
-       * But, in the other cases, DISTINCT are not processed yet.
-       * qexec_orderby_distinct() will handle it.
-       */
+  return error;
+}
 
-      /* GROUP BY processing */
+/*
+ * qexec_release_parallel_scan () - Release a reference to a parallel scan
+ *                                  descriptor
+ *   return:
+ *   px(in): parallel scan descriptor
+ *
+ * Note: The descriptor is freed by the last of the calling thread and the
+ * helpers that leaves it.
+ */
+static void
+qexec_release_parallel_scan (QEXEC_PX_SCAN * px)
+{
+  int ref_count, i;
 
-      /* if groupby skip, we compute group by from the already sorted list */
-      if (xasl->spec_list && xasl->spec_list->indexptr && xasl->spec_list->indexptr->groupby_skip)
-	{
-	  if (qexec_groupby_index (thread_p, xasl, xasl_state, &tplrec) != NO_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	}
-      else if (xasl->type == BUILDLIST_PROC	/* it is SELECT query */
-	       && xasl->proc.buildlist.groupby_list)	/* it has GROUP BY clause */
-	{
-	  if (qexec_groupby (thread_p, xasl, xasl_state, &tplrec) != NO_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	}
+  pthread_mutex_lock (&px->mutex);
+  ref_count = --px->ref_count;
+  pthread_mutex_unlock (&px->mutex);
 
-      /* process analytic functions */
-      if (xasl->type == BUILDLIST_PROC && xasl->proc.buildlist.a_eval_list)
-	{
-	  ANALYTIC_EVAL_TYPE *eval_list;
-	  for (eval_list = xasl->proc.buildlist.a_eval_list; eval_list; eval_list = eval_list->next)
-	    {
-	      if (qexec_execute_analytic (thread_p, xasl, xasl_state, eval_list, &tplrec, (eval_list->next == NULL)) !=
-		  NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	    }
-	}
+  if (ref_count > 0)
+    {
+      return;
+    }
 
-      if ((COMPOSITE_LOCK (xasl->scan_op_type) || QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl))
-	  && XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG))
+  for (i = 0; i < px->num_workers; i++)
+    {
+      if (px->workers[i].agg_area != NULL)
 	{
-	  if (lock_finalize_composite_lock (thread_p, &xasl->composite_lock) != LK_GRANTED)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
+	  free_and_init (px->workers[i].agg_area);
 	}
+    }
 
-#if 0				/* DO NOT DELETE ME !!! - yaw: for future work */
-      if (xasl->list_id->tuple_cnt == 0)
-	{
-	  /* skip post processing for empty list file */
+  heap_parallel_scan_destroy (&px->heap_scan);
+  pthread_cond_destroy (&px->cond);
+  pthread_mutex_destroy (&px->mutex);
+  free_and_init (px);
+}
 
-	  /* monitor */
-	  mnt_qm_selects (thread_p);
-	  break;
-	}
-#endif
+/*
+ * qexec_parallel_scan_worker () - Job of a helper of a parallel heap scan
+ *   return: NO_ERROR
+ *   thread_p(in):
+ *   arg(in): helper descriptor
+ */
+static int
+qexec_parallel_scan_worker (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg)
+{
+  QEXEC_PX_WORKER *worker = (QEXEC_PX_WORKER *) arg;
+  QEXEC_PX_SCAN *px = worker->px;
+  int length;
+  bool is_closed;
 
+  thread_p->tran_index = px->tran_index;
+  pthread_mutex_unlock (&thread_p->tran_index_lock);
 
-      /* ORDER BY and DISTINCT processing */
-      if (xasl->type == UNION_PROC || xasl->type == DIFFERENCE_PROC || xasl->type == INTERSECTION_PROC)
-	{
-	  /* DISTINCT was already processed in these cases. Consider only ORDER BY */
-	  if (xasl->orderby_list	/* it has ORDER BY clause */
-	      && (xasl->list_id->tuple_cnt > 1	/* the result has more than one tuple */
-		  || xasl->ordbynum_val != NULL))	/* ORDERBY_NUM() is used */
-	    {
-	      /* It has ORDER BY clause and the result has more than one tuple. We cannot skip the processing some
-	       * cases such as 'orderby_num() < 1', for example. */
-	      if (qexec_orderby_distinct (thread_p, xasl, Q_ALL, xasl_state) != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	    }
-	}
-      else
+  pthread_mutex_lock (&px->mutex);
+  is_closed = px->is_closed;
+  if (!is_closed)
+    {
+      px->num_running++;
+    }
+  pthread_mutex_unlock (&px->mutex);
+
+  if (!is_closed)
+    {
+      worker->error = qexec_execute_parallel_scan (thread_p, worker);
+      if (worker->error != NO_ERROR)
 	{
-	  /* DISTINCT & ORDER BY check orderby_list flag for skipping order by */
-	  if ((xasl->orderby_list	/* it has ORDER BY clause */
-	       && (!XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)	/* cannot skip */
-		   || XASL_IS_FLAGED (xasl, XASL_USES_MRO))	/* MRO must go on */
-	       && (xasl->list_id->tuple_cnt > 1	/* the result has more than one tuple */
-		   || xasl->ordbynum_val != NULL	/* ORDERBY_NUM() is used */
-		   || xasl->topn_items != NULL))	/* used internal sort */
-	      || (xasl->option == Q_DISTINCT))	/* DISTINCT must be go on */
-	    {
-	      if (qexec_orderby_distinct (thread_p, xasl, xasl->option, xasl_state) != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	    }
+	  length = sizeof (worker->er_area);
+	  worker->has_er_area = (er_get_area_error (worker->er_area, &length) != NULL);
+
+	  /* the others need not go on */
+	  heap_parallel_scan_stop (&px->heap_scan);
 	}
 
-      /* monitor */
-      mnt_qm_selects (thread_p);
-      break;
+      pthread_mutex_lock (&px->mutex);
+      px->num_running--;
+      pthread_cond_signal (&px->cond);
+      pthread_mutex_unlock (&px->mutex);
     }
 
-  if (xasl->is_single_tuple)
+  qexec_release_parallel_scan (px);
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_execute_parallel_scan () - Scan heap pages of a parallel heap scan
+ *                                  and compute the aggregates over them
+ *   return: error code
+ *   thread_p(in):
+ *   worker(in/out): helper descriptor; gets the packed accumulators
+ */
+static int
+qexec_execute_parallel_scan (THREAD_ENTRY * thread_p, QEXEC_PX_WORKER * worker)
+{
+  QEXEC_PX_SCAN *px = worker->px;
+  XASL_NODE *xasl = NULL;
+  XASL_STATE xasl_state;
+  ACCESS_SPEC_TYPE *specp;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  void *xasl_unpack_info = NULL;
+  char *xasl_stream = NULL;
+  int xasl_stream_size = 0;
+  bool mvcc_select_lock_needed = false;
+  bool is_scan_opened = false;
+  int error = NO_ERROR;
+
+  if (qfile_load_xasl (thread_p, &px->xasl_id, &xasl_stream, &xasl_stream_size) == 0)
     {
-      if (xasl->list_id->tuple_cnt > 1)
-	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_QRY_SINGLE_TUPLE, 0);
-	  GOTO_EXIT_ON_ERROR;
-	}
+      error = ER_FAILED;
+      goto exit;
+    }
 
-      if (xasl->single_tuple
-	  && (qdata_get_single_tuple_from_list_id (thread_p, xasl->list_id, xasl->single_tuple) != NO_ERROR))
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
+  error = stx_map_stream_to_xasl (thread_p, &xasl, xasl_stream, xasl_stream_size, &xasl_unpack_info);
+  if (error != NO_ERROR)
+    {
+      goto exit;
     }
 
+  xasl_state.vd = px->vd;
+  xasl_state.vd.xasl_state = &xasl_state;
+  xasl_state.query_id = px->query_id;
+  xasl_state.qp_xasl_line = 0;
+
+  error = qdata_initialize_aggregate_list (thread_p, xasl->proc.buildvalue.agg_list, xasl_state.query_id);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
 
-  /* 
-   * Cleanup and Exit processing
-   */
-  if (instant_lock_mode_started == true)
+  specp = xasl->spec_list;
+  error =
+    qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state.vd, false, specp->fixed_scan, true, false,
+		     &specp->s_id, xasl_state.query_id, xasl->scan_op_type, false, &mvcc_select_lock_needed);
+  if (error != NO_ERROR)
     {
-      assert (lock_is_instant_lock_mode (tran_index) == false);
-      /* a safe guard */
-      lock_stop_instant_lock_mode (thread_p, tran_index, true);
+      goto exit;
     }
+  is_scan_opened = true;
 
-  /* destroy hash table */
-  if (xasl->type == BUILDLIST_PROC)
+  scan_set_parallel_heap_scan (&specp->s_id, &px->heap_scan);
+
+  if (qexec_intprt_fnc (thread_p, xasl, &xasl_state, &tplrec, NULL) != S_SUCCESS)
     {
-      qexec_free_agg_hash_context (thread_p, &xasl->proc.buildlist);
+      error = ER_FAILED;
+      goto exit;
     }
 
-  /* clear only non-zero correlation-level uncorrelated subquery list files */
-  for (xptr = xasl; xptr; xptr = xptr->scan_ptr)
+  worker->agg_area = qexec_pack_parallel_aggregates (xasl->proc.buildvalue.agg_list);
+  if (worker->agg_area == NULL)
     {
-      if (xptr->aptr_list)
-	{
-	  qexec_clear_head_lists (thread_p, xptr->aptr_list);
-	}
+      error = ER_FAILED;
     }
-  if (tplrec.tpl)
+
+exit:
+  if (is_scan_opened)
+    {
+      qexec_end_scan (thread_p, specp);
+      qexec_close_scan (thread_p, specp);
+    }
+
+  if (tplrec.tpl != NULL)
     {
       db_private_free_and_init (thread_p, tplrec.tpl);
     }
 
-  xasl->status = XASL_SUCCESS;
+  if (xasl != NULL)
+    {
+      (void) qexec_clear_xasl (thread_p, xasl, true);
+    }
 
-  return NO_ERROR;
+  if (xasl_unpack_info != NULL)
+    {
+      stx_free_additional_buff (thread_p, xasl_unpack_info);
+      stx_free_xasl_unpack_info (xasl_unpack_info);
+      db_private_free_and_init (thread_p, xasl_unpack_info);
+    }
 
-  /* 
-   * Error processing
-   */
-exit_on_error:
-#if defined(SERVER_MODE)
-  /* query execution error must be set up before qfile_close_list(). */
-  if (er_errid () < 0)
+  if (xasl_stream != NULL)
     {
-      qmgr_set_query_error (thread_p, xasl_state->query_id);
+      db_private_free_and_init (thread_p, xasl_stream);
     }
-#endif
 
-  if (instant_lock_mode_started == true)
+  if (error != NO_ERROR && er_errid () == NO_ERROR)
     {
-      lock_stop_instant_lock_mode (thread_p, tran_index, true);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
     }
-  qfile_close_list (thread_p, xasl->list_id);
-  if (func_vector)
+
+  return error;
+}
+
+/*
+ * qexec_pack_parallel_aggregates () - Pack the accumulators of a helper of a
+ *                                     parallel heap scan
+ *   return: packed area allocated with malloc, or NULL
+ *   agg_list(in): aggregate list
+ *
+ * Note: The domains resolved by the helper are packed along with the
+ * accumulators since the calling thread may have seen no rows at all.
+ */
+static char *
+qexec_pack_parallel_aggregates (AGGREGATE_TYPE * agg_list)
+{
+  AGGREGATE_TYPE *agg_p;
+  TP_DOMAIN *domains[3];
+  char *area, *ptr;
+  int size = 0;
+  int i;
+
+  for (agg_p = agg_list; agg_p != NULL; agg_p = agg_p->next)
     {
-      db_private_free_and_init (thread_p, func_vector);
+      /* curr_cnt, opr_dbtype and a null flag for every value and domain */
+      size += OR_INT_SIZE * 7;
+
+      domains[0] = agg_p->domain;
+      domains[1] = agg_p->accumulator_domain.value_dom;
+      domains[2] = agg_p->accumulator_domain.value2_dom;
+      for (i = 0; i < 3; i++)
+	{
+	  if (domains[i] != NULL)
+	    {
+	      size += or_packed_domain_size (domains[i], 0);
+	    }
+	}
+
+      size += OR_VALUE_ALIGNED_SIZE (agg_p->accumulator.value);
+      if (agg_p->accumulator.value2 != NULL)
+	{
+	  size += OR_VALUE_ALIGNED_SIZE (agg_p->accumulator.value2);
+	}
+    }
+
+  area = (char *) malloc (size);
+  if (area == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) size);
+      return NULL;
+    }
+
+  ptr = area;
+  for (agg_p = agg_list; agg_p != NULL; agg_p = agg_p->next)
+    {
+      ptr = or_pack_int (ptr, agg_p->accumulator.curr_cnt);
+      ptr = or_pack_int (ptr, (int) agg_p->opr_dbtype);
+
+      domains[0] = agg_p->domain;
+      domains[1] = agg_p->accumulator_domain.value_dom;
+      domains[2] = agg_p->accumulator_domain.value2_dom;
+      for (i = 0; i < 3; i++)
+	{
+	  ptr = or_pack_int (ptr, (domains[i] != NULL) ? 1 : 0);
+	  if (domains[i] != NULL)
+	    {
+	      ptr = or_pack_domain (ptr, domains[i], 0, 0);
+	    }
+	}
+
+      ptr = or_pack_db_value (ptr, agg_p->accumulator.value);
+      ptr = or_pack_int (ptr, (agg_p->accumulator.value2 != NULL) ? 1 : 0);
+      if (agg_p->accumulator.value2 != NULL)
+	{
+	  ptr = or_pack_db_value (ptr, agg_p->accumulator.value2);
+	}
     }
 
-  /* close all the scans that are involved within the query */
-  for (xptr = xasl, level = 0; xptr; xptr = xptr->scan_ptr, level++)
+  return area;
+}
+
+/*
+ * qexec_merge_parallel_aggregates () - Merge the accumulators of a helper of
+ *                                      a parallel heap scan
+ *   return: error code
+ *   thread_p(in):
+ *   agg_list(in/out): aggregate list of the calling thread
+ *   area(in): accumulators packed by qexec_pack_parallel_aggregates
+ */
+static int
+qexec_merge_parallel_aggregates (THREAD_ENTRY * thread_p, AGGREGATE_TYPE * agg_list, char *area)
+{
+  AGGREGATE_TYPE *agg_p;
+  AGGREGATE_ACCUMULATOR acc;
+  DB_VALUE value, value2;
+  TP_DOMAIN *domains[3];
+  char *ptr = area;
+  int opr_dbtype, has_value, is_null;
+  int i, count;
+  int error = NO_ERROR;
+
+  for (agg_p = agg_list; agg_p != NULL && error == NO_ERROR; agg_p = agg_p->next)
     {
-      spec_ptr[0] = xptr->spec_list;
-      spec_ptr[1] = xptr->merge_spec;
-      for (spec_level = 0; spec_level < 2; ++spec_level)
+      ptr = or_unpack_int (ptr, &acc.curr_cnt);
+      ptr = or_unpack_int (ptr, &opr_dbtype);
+      for (i = 0; i < 3; i++)
 	{
-	  for (specp = spec_ptr[spec_level]; specp; specp = specp->next)
+	  domains[i] = NULL;
+	  ptr = or_unpack_int (ptr, &has_value);
+	  if (has_value)
 	    {
-	      qexec_end_scan (thread_p, specp);
-	      qexec_close_scan (thread_p, specp);
+	      ptr = or_unpack_domain (ptr, &domains[i], &is_null);
 	    }
 	}
-      if (xptr->curr_spec != NULL)
+
+      db_make_null (&value);
+      db_make_null (&value2);
+      ptr = or_unpack_db_value (ptr, &value);
+      ptr = or_unpack_int (ptr, &has_value);
+      if (has_value)
 	{
-	  xptr->curr_spec->curent = NULL;
-	  xptr->curr_spec = NULL;
+	  ptr = or_unpack_db_value (ptr, &value2);
 	}
-    }
+      acc.value = &value;
+      acc.value2 = &value2;
 
-  if (tplrec.tpl)
-    {
-      db_private_free_and_init (thread_p, tplrec.tpl);
-    }
+      if (acc.curr_cnt > 0 && (agg_p->accumulator_domain.value_dom == NULL
+			       || agg_p->accumulator_domain.value2_dom == NULL
+			       || agg_p->opr_dbtype == DB_TYPE_VARIABLE))
+	{
+	  /* this thread did not resolve the domains, take the ones of the helper */
+	  agg_p->opr_dbtype = (DB_TYPE) opr_dbtype;
+	  agg_p->domain = domains[0];
+	  agg_p->accumulator_domain.value_dom = domains[1];
+	  agg_p->accumulator_domain.value2_dom = domains[2];
+	}
 
-  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
-    {
-      qexec_clear_connect_by_lists (thread_p, xasl->connect_by_ptr);
-    }
+      switch (agg_p->function)
+	{
+	case PT_COUNT_STAR:
+	  agg_p->accumulator.curr_cnt += acc.curr_cnt;
+	  break;
 
-  /* destroy hash table */
-  if (xasl->type == BUILDLIST_PROC)
-    {
-      qexec_free_agg_hash_context (thread_p, &xasl->proc.buildlist);
-    }
+	case PT_COUNT:
+	  /* the accumulator counts the not null values */
+	  if (acc.curr_cnt > 0 && !DB_IS_NULL (&value))
+	    {
+	      count = DB_IS_NULL (agg_p->accumulator.value) ? 0 : DB_GET_INT (agg_p->accumulator.value);
+	      db_make_int (agg_p->accumulator.value, count + DB_GET_INT (&value));
+	    }
+	  agg_p->accumulator.curr_cnt += acc.curr_cnt;
+	  break;
 
-  /* free alloced memory for composite locking */
-  lock_abort_composite_lock (&xasl->composite_lock);
+	default:
+	  if (acc.curr_cnt > 0)
+	    {
+	      error =
+		qdata_aggregate_accumulator_to_accumulator (thread_p, &agg_p->accumulator, &agg_p->accumulator_domain,
+							    agg_p->function, agg_p->domain, &acc);
+	    }
+	  break;
+	}
 
-  xasl->status = XASL_FAILURE;
+      pr_clear_value (&value);
+      pr_clear_value (&value2);
+    }
 
-  qexec_failure_line (__LINE__, xasl_state);
-  return ER_FAILED;
+  return error;
 }
+#endif /* SERVER_MODE */
 
 /*
  * qexec_execute_query () -
@@ -14503,6 +15992,8 @@ qexec_initialize_xasl_cache (THREAD_ENTRY * thread_p)
   xasl_ent_cache.counter.hit = 0;
   xasl_ent_cache.counter.miss = 0;
   xasl_ent_cache.counter.full = 0;
+  xasl_ent_cache.counter.recompile = 0;
+  memset (xasl_cache_recompile_history, 0, sizeof (xasl_cache_recompile_history));
 
   /* memory hash table for XASL stream cache referencing by query string */
   if (xasl_ent_cache.qstr_ht)
@@ -14838,6 +16329,8 @@ qexec_print_xasl_cache_ent (FILE * fp, const void *key, void *data, void *args)
     }
 
   fprintf (fp, "         ref_count = %d\n", ent->ref_count);
+  fprintf (fp, "        miss_count = %d\n", ent->miss_count);
+  fprintf (fp, "   recompile_count = %d\n", ent->recompile_count);
   fprintf (fp, "   deletion_marker = %s\n", (ent->deletion_marker) ? "true" : "false");
   fprintf (fp, "         dbval_cnt = %d\n", ent->dbval_cnt);
   fprintf (fp, "        list_ht_no = %d\n", ent->list_ht_no);
@@ -14881,10 +16374,10 @@ qexec_dump_xasl_cache_internal (THREAD_ENTRY * thread_p, FILE * fp, int mask)
     }
 
   fprintf (fp, "\n");
-  fprintf (fp, "CACHE        MAX        NUM     LOOKUP        HIT       MISS       FULL\n");
-  fprintf (fp, "entry %10d %10d %10d %10d %10d %10d\n", xasl_ent_cache.max_entries, xasl_ent_cache.num,
+  fprintf (fp, "CACHE        MAX        NUM     LOOKUP        HIT       MISS       FULL  RECOMPILE\n");
+  fprintf (fp, "entry %10d %10d %10d %10d %10d %10d %10d\n", xasl_ent_cache.max_entries, xasl_ent_cache.num,
 	   xasl_ent_cache.counter.lookup, xasl_ent_cache.counter.hit, xasl_ent_cache.counter.miss,
-	   xasl_ent_cache.counter.full);
+	   xasl_ent_cache.counter.full, xasl_ent_cache.counter.recompile);
 #if defined (ENABLE_UNUSED_FUNCTION)
   fprintf (fp, "clone %10d %10d %10d %10d %10d %10d\n", xasl_clo_cache.max_clones, xasl_clo_cache.num,
 	   xasl_clo_cache.counter.lookup, xasl_clo_cache.counter.hit, xasl_clo_cache.counter.miss,
@@ -14936,6 +16429,181 @@ qexec_dump_xasl_cache_internal (THREAD_ENTRY * thread_p, FILE * fp, int mask)
   return NO_ERROR;
 }
 
+/*
+ * qexec_xasl_cache_start_scan () - start scan function for 'show statement cache'
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in):
+ *   type(in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out): 'show statement cache' context
+ *
+ * Note: The entries are copied under the shared lock of the cache; one row for each entry in the order of the
+ *       eviction clock.
+ */
+int
+qexec_xasl_cache_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
+{
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  const int num_cols = 12;
+  XASL_CACHE_ENTRY *ent;
+  HENTRY_PTR h_entry;
+  DB_VALUE *vals = NULL;
+  DB_DATETIME time_val;
+  time_t sec;
+  char *sql_id;
+  char buf[512], vpid_buf[64], vfid_buf[64];
+  int idx, error = NO_ERROR;
+
+  *ptr = NULL;
+
+  if (xasl_ent_cache.max_entries <= 0 || xasl_ent_cache.qstr_ht == NULL)
+    {
+      /* the cache is disabled; empty result */
+      ctx = showstmt_alloc_array_context (thread_p, 0, num_cols);
+      if (ctx == NULL)
+	{
+	  return er_errid ();
+	}
+      *ptr = (void *) ctx;
+      return NO_ERROR;
+    }
+
+  if (rwlock_read_lock (QEXEC_RWLOCK_XASL_CACHE) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  ctx = showstmt_alloc_array_context (thread_p, (int) mht_count (xasl_ent_cache.qstr_ht), num_cols);
+  if (ctx == NULL)
+    {
+      error = er_errid ();
+      goto exit_on_error;
+    }
+
+  for (h_entry = xasl_ent_cache.qstr_ht->lru_head; h_entry != NULL; h_entry = h_entry->lru_next)
+    {
+      ent = (XASL_CACHE_ENTRY *) h_entry->data;
+
+      vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+      if (vals == NULL)
+	{
+	  error = er_errid ();
+	  goto exit_on_error;
+	}
+
+      idx = 0;
+      /* Sql_id */
+      error = qmgr_get_sql_id (thread_p, &sql_id, ent->sql_info.sql_hash_text, strlen (ent->sql_info.sql_hash_text));
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      error = db_make_string_copy (&vals[idx], sql_id);
+      free_and_init (sql_id);
+      idx++;
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      /* Sql_user_text */
+      if (ent->sql_info.sql_user_text != NULL)
+	{
+	  error = db_make_string_copy (&vals[idx], ent->sql_info.sql_user_text);
+	  if (error != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	}
+      else
+	{
+	  db_make_null (&vals[idx]);
+	}
+      idx++;
+
+      /* Xasl_id */
+      vpid_to_string (vpid_buf, sizeof (vpid_buf), &ent->xasl_id.first_vpid);
+      vfid_to_string (vfid_buf, sizeof (vfid_buf), &ent->xasl_id.temp_vfid);
+      snprintf (buf, sizeof (buf), "vpid: %s, vfid: %s", vpid_buf, vfid_buf);
+      error = db_make_string_copy (&vals[idx], buf);
+      idx++;
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      /* Num_classes */
+      db_make_int (&vals[idx], ent->n_oid_list);
+      idx++;
+
+      /* Num_fixed_tran */
+#if defined (SERVER_MODE)
+      db_make_int (&vals[idx], ent->num_fixed_tran);
+#else
+      db_make_int (&vals[idx], 0);
+#endif
+      idx++;
+
+      /* Hit_count */
+      db_make_int (&vals[idx], ent->ref_count);
+      idx++;
+
+      /* Miss_count */
+      db_make_int (&vals[idx], ent->miss_count);
+      idx++;
+
+      /* Recompile_count */
+      db_make_int (&vals[idx], ent->recompile_count);
+      idx++;
+
+      /* Referenced */
+      db_make_int (&vals[idx], ent->clock_referenced ? 1 : 0);
+      idx++;
+
+      /* Dbval_cnt */
+      db_make_int (&vals[idx], ent->dbval_cnt);
+      idx++;
+
+      /* Create_time */
+      sec = ent->time_created.tv_sec;
+      db_localdatetime_msec (&sec, (int) (ent->time_created.tv_usec / 1000), &time_val);
+      error = db_make_datetime (&vals[idx], &time_val);
+      idx++;
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      /* Last_used_time */
+      sec = ent->time_last_used.tv_sec;
+      db_localdatetime_msec (&sec, (int) (ent->time_last_used.tv_usec / 1000), &time_val);
+      error = db_make_datetime (&vals[idx], &time_val);
+      idx++;
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      assert (idx == num_cols);
+    }
+
+  (void) rwlock_read_unlock (QEXEC_RWLOCK_XASL_CACHE);
+
+  *ptr = (void *) ctx;
+  return NO_ERROR;
+
+exit_on_error:
+  (void) rwlock_read_unlock (QEXEC_RWLOCK_XASL_CACHE);
+
+  if (ctx != NULL)
+    {
+      showstmt_free_array_context (thread_p, ctx);
+    }
+
+  return error;
+}
+
 #if defined (CUBRID_DEBUG)
 /*
  * qexec_dump_xasl_cache () -
@@ -15364,6 +17032,10 @@ qexec_free_xasl_cache_ent (THREAD_ENTRY * thread_p, void *data, void *args)
  *        This count must be decreased with qexec_remove_my_tran_id_in_xasl_entry before current request is finished.
  *
  *        A fixed xasl cache entry cannot be deleted from the xasl_id hash table when victimized.
+ *
+ *        Lookups which are not pinned references share the lock. They do not move the entry in the LRU list, but
+ *        mark it referenced for the eviction clock. An entry which is timed out is reported as a miss and replaced
+ *        when the query is compiled again.
  */
 XASL_CACHE_ENTRY *
 qexec_lookup_xasl_cache_ent (THREAD_ENTRY * thread_p, const char *qstr, const OID * user_oid, bool is_pinned_reference,
@@ -15385,16 +17057,27 @@ qexec_lookup_xasl_cache_ent (THREAD_ENTRY * thread_p, const char *qstr, const OI
       return NULL;
     }
 
-  if (rwlock_write_lock (QEXEC_RWLOCK_XASL_CACHE) != NO_ERROR)
+  /* a pinned reference changes the pinned entry list */
+  if (is_pinned_reference)
     {
-      return NULL;
+      if (rwlock_write_lock (QEXEC_RWLOCK_XASL_CACHE) != NO_ERROR)
+	{
+	  return NULL;
+	}
+    }
+  else
+    {
+      if (XASL_CACHE_LOOKUP_LOCK () != NO_ERROR)
+	{
+	  return NULL;
+	}
     }
 
   MAKE_XASL_QSTR_HT_KEY (key, qstr, user_oid);
 
-  /* look up the hash table with the key */
-  ent = (XASL_CACHE_ENTRY *) mht_get (xasl_ent_cache.qstr_ht, &key);
-  xasl_ent_cache.counter.lookup++;	/* counter */
+  /* look up the hash table with the key; mht_get2 does not change the LRU list */
+  ent = (XASL_CACHE_ENTRY *) mht_get2 (xasl_ent_cache.qstr_ht, &key, NULL);
+  XASL_CACHE_STAT_INC (xasl_ent_cache.counter.lookup);	/* counter */
   mnt_pc_lookup (thread_p);
 
   if (ent)
@@ -15410,11 +17093,10 @@ qexec_lookup_xasl_cache_ent (THREAD_ENTRY * thread_p, const char *qstr, const OI
 	}
 
       /* check age - timeout */
-      if (ent && prm_get_integer_value (PRM_ID_XASL_PLAN_CACHE_TIMEOUT) >= 0
-	  && difftime (time (NULL), ent->time_created.tv_sec) > prm_get_integer_value (PRM_ID_XASL_PLAN_CACHE_TIMEOUT))
+      if (ent && qexec_xasl_cache_ent_is_timed_out (ent))
 	{
-	  /* delete the entry which is timed out */
-	  (void) qexec_delete_xasl_cache_ent (thread_p, ent, NULL);
+	  /* the entry which is timed out is deleted by qexec_update_xasl_cache_ent; it requires the exclusive lock */
+	  XASL_CACHE_STAT_INC (ent->miss_count);
 	  ent = NULL;
 	}
 
@@ -15457,30 +17139,70 @@ qexec_lookup_xasl_cache_ent (THREAD_ENTRY * thread_p, const char *qstr, const OI
 	  assert (ent->tran_fix_count_array[tran_index] > 0);
 #endif
 	  (void) gettimeofday (&ent->time_last_used, NULL);
-	  ent->ref_count++;
+	  XASL_CACHE_STAT_INC (ent->ref_count);
+	  ent->clock_referenced = true;
 	}
     }
 
   if (ent)
     {
-      xasl_ent_cache.counter.hit++;	/* counter */
+      XASL_CACHE_STAT_INC (xasl_ent_cache.counter.hit);	/* counter */
       mnt_pc_hit (thread_p);
     }
   else
     {
-      xasl_ent_cache.counter.miss++;	/* counter */
+      XASL_CACHE_STAT_INC (xasl_ent_cache.counter.miss);	/* counter */
       mnt_pc_miss (thread_p);
     }
 
 end:
-  if (rwlock_write_unlock (QEXEC_RWLOCK_XASL_CACHE) != NO_ERROR)
+  if (is_pinned_reference)
     {
-      return NULL;
+      if (rwlock_write_unlock (QEXEC_RWLOCK_XASL_CACHE) != NO_ERROR)
+	{
+	  return NULL;
+	}
+    }
+  else
+    {
+      if (XASL_CACHE_LOOKUP_UNLOCK () != NO_ERROR)
+	{
+	  return NULL;
+	}
     }
 
   return ent;
 }
 
+/*
+ * qexec_xasl_cache_ent_is_timed_out () - Check whether the entry is older than xasl_plan_cache_timeout
+ *   return: true if the entry is timed out
+ *   ent(in)    : cache entry
+ */
+static bool
+qexec_xasl_cache_ent_is_timed_out (const XASL_CACHE_ENTRY * ent)
+{
+  int timeout = prm_get_integer_value (PRM_ID_XASL_PLAN_CACHE_TIMEOUT);
+
+  return (timeout >= 0 && difftime (time (NULL), ent->time_created.tv_sec) > timeout);
+}
+
+/*
+ * qexec_get_xasl_cache_recompile_history () - Get the recompile history slot of the query string key
+ *   return: history slot
+ *   key(in)    : query string hash table key
+ *
+ * Note: The caller must hold QEXEC_RWLOCK_XASL_CACHE exclusively. The slot may belong to another query; compare
+ *       its hash with the hash of the key before using the count.
+ */
+static XASL_CACHE_RECOMPILE_HISTORY *
+qexec_get_xasl_cache_recompile_history (const XASL_QSTR_HT_KEY * key)
+{
+  unsigned int hash = qexec_xasl_qstr_ht_hash (key, UINT_MAX);
+
+  return &xasl_cache_recompile_history[hash % XASL_CACHE_RECOMPILE_HISTORY_SIZE];
+}
+
 /*
  * qexec_update_xasl_cache_ent () -
  *   return:
@@ -15505,13 +17227,14 @@ qexec_update_xasl_cache_ent (THREAD_ENTRY * thread_p, COMPILE_CONTEXT * context,
   XASL_CACHE_ENTRY *ent, *victim_ent;
   const OID *o;
   int sql_hash_text_len, sql_plan_text_len, sql_user_text_len, i;
-  int current_count, max_victim_count;
+  int current_count, max_victim_count, scan_count, max_scan_count;
 #if defined(SERVER_MODE)
   bool all_entries_are_fixed = false;
 #endif /* SERVER_MODE */
   XASL_NODE_HEADER xasl_header;
-  HENTRY_PTR h_entry;
+  HENTRY_PTR h_entry, next_h_entry;
   XASL_QSTR_HT_KEY key;
+  XASL_CACHE_RECOMPILE_HISTORY *history;
 
   if (xasl_ent_cache.max_entries <= 0)
     {
@@ -15527,6 +17250,12 @@ qexec_update_xasl_cache_ent (THREAD_ENTRY * thread_p, COMPILE_CONTEXT * context,
 
   /* check again whether the entry is in the cache */
   ent = (XASL_CACHE_ENTRY *) mht_get (xasl_ent_cache.qstr_ht, &key);
+  if (ent != NULL && !ent->deletion_marker && qexec_xasl_cache_ent_is_timed_out (ent))
+    {
+      /* the lookup found this entry timed out; replace it with the new one */
+      (void) qexec_delete_xasl_cache_ent (thread_p, ent, NULL);
+      ent = NULL;
+    }
   if (ent != NULL)
     {
       if (ent->deletion_marker)
@@ -15586,7 +17315,8 @@ qexec_update_xasl_cache_ent (THREAD_ENTRY * thread_p, COMPILE_CONTEXT * context,
   if ((int) mht_count (xasl_ent_cache.qstr_ht) >= xasl_ent_cache.max_entries)
     {
       /* Cache full! We need to remove some entries from the cache. 
-       * We will refer to the LRU list of query string hash table to find out victims. 
+       * The LRU list of query string hash table is the ring of the eviction clock. Lookups do not reorder it but mark
+       * the entry referenced; such an entry gets a second chance, it is moved to the tail and its mark is cleared.
        */
       xasl_ent_cache.counter.full++;	/* counter */
       mnt_pc_full (thread_p);
@@ -15594,14 +17324,23 @@ qexec_update_xasl_cache_ent (THREAD_ENTRY * thread_p, COMPILE_CONTEXT * context,
       /* Number of entries to victimize. It will be one in normal case. */
       max_victim_count = (int) mht_count (xasl_ent_cache.qstr_ht) - xasl_ent_cache.max_entries + 1;
 
+      /* two turns of the clock clear every mark; stop there if all entries are fixed */
+      max_scan_count = 2 * (int) mht_count (xasl_ent_cache.qstr_ht);
+
       h_entry = xasl_ent_cache.qstr_ht->lru_head;
       assert (h_entry != NULL);
 
       current_count = 0;
-      while (current_count < max_victim_count && h_entry)
+      for (scan_count = 0; current_count < max_victim_count && h_entry && scan_count < max_scan_count;
+	   scan_count++, h_entry = next_h_entry)
 	{
 	  victim_ent = (XASL_CACHE_ENTRY *) h_entry->data;
-	  h_entry = h_entry->lru_next;
+	  next_h_entry = h_entry->lru_next;
+	  if (next_h_entry == NULL)
+	    {
+	      /* wrap around */
+	      next_h_entry = xasl_ent_cache.qstr_ht->lru_head;
+	    }
 #if defined (SERVER_MODE)
 	  if (victim_ent->num_fixed_tran > 0)
 	    {
@@ -15609,6 +17348,18 @@ qexec_update_xasl_cache_ent (THREAD_ENTRY * thread_p, COMPILE_CONTEXT * context,
 	      continue;
 	    }
 #endif
+	  if (victim_ent->clock_referenced)
+	    {
+	      victim_ent->clock_referenced = false;
+	      (void) mht_adjust_lru_list (xasl_ent_cache.qstr_ht, h_entry);
+	      continue;
+	    }
+
+	  if (next_h_entry == h_entry)
+	    {
+	      /* the last entry */
+	      next_h_entry = NULL;
+	    }
 	  (void) qexec_delete_xasl_cache_ent (thread_p, (void *) victim_ent, NULL);
 	  current_count++;
 	}
@@ -15718,13 +17469,25 @@ qexec_update_xasl_cache_ent (THREAD_ENTRY * thread_p, COMPILE_CONTEXT * context,
   (void) gettimeofday (&ent->time_created, NULL);
   (void) gettimeofday (&ent->time_last_used, NULL);
   ent->ref_count = 0;
+  ent->miss_count = 0;
+  ent->recompile_count = 0;
   ent->deletion_marker = false;
+  ent->clock_referenced = false;
   ent->dbval_cnt = dbval_cnt;
   ent->list_ht_no = -1;
+  ent->list_clear_count = 0;
   ent->clo_list = NULL;
 
   MAKE_XASL_QSTR_HT_KEY (ent->qstr_ht_key, ent->sql_info.sql_hash_text, oid);
 
+  /* take over the recompile count if this query was recompiled by the recompilation threshold */
+  history = qexec_get_xasl_cache_recompile_history (&ent->qstr_ht_key);
+  if (history->count > 0 && history->hash == qexec_xasl_qstr_ht_hash (&ent->qstr_ht_key, UINT_MAX))
+    {
+      ent->recompile_count = history->count;
+      history->count = 0;
+    }
+
   /* insert (or update) the entry into the query string hash table */
   if (mht_put_new (xasl_ent_cache.qstr_ht, &ent->qstr_ht_key, ent) == NULL)
     {
@@ -16018,6 +17781,7 @@ qexec_RT_xasl_cache_ent (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * ent)
   CLS_INFO *cls_info_p;
   int npages;
   int RT;
+  XASL_CACHE_RECOMPILE_HISTORY *history;
 
 #define DEFAULT_PLAN_RECOMP_THRESHOLD 50
 
@@ -16094,6 +17858,14 @@ qexec_RT_xasl_cache_ent (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * ent)
 #if defined (SERVER_MODE)
       assert (ent->num_fixed_tran > 0);
 #endif
+      if (!ent->deletion_marker)
+	{
+	  /* remember the recompile count for the entry which replaces this one */
+	  history = qexec_get_xasl_cache_recompile_history (&ent->qstr_ht_key);
+	  history->hash = qexec_xasl_qstr_ht_hash (&ent->qstr_ht_key, UINT_MAX);
+	  history->count = ent->recompile_count + 1;
+	  xasl_ent_cache.counter.recompile++;	/* counter */
+	}
       (void) qexec_delete_xasl_cache_ent (thread_p, ent, NULL);
 
       if (rwlock_write_unlock (QEXEC_RWLOCK_XASL_CACHE) != NO_ERROR)
@@ -16121,6 +17893,7 @@ qexec_RT_xasl_cache_ent (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * ent)
  *
  *        A fixed xasl cache entry cannot be deleted from the xasl_id hash table when victimized.
  *
+ *        The lookup shares the lock with other lookups; see qexec_lookup_xasl_cache_ent.
  */
 XASL_CACHE_ENTRY *
 qexec_check_xasl_cache_ent_by_xasl (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id, int dbval_cnt,
@@ -16138,13 +17911,13 @@ qexec_check_xasl_cache_ent_by_xasl (THREAD_ENTRY * thread_p, const XASL_ID * xas
 
   ent = NULL;			/* init */
 
-  if (rwlock_write_lock (QEXEC_RWLOCK_XASL_CACHE) != NO_ERROR)
+  if (XASL_CACHE_LOOKUP_LOCK () != NO_ERROR)
     {
       return NULL;
     }
 
   /* look up the hash table with the key, which is XASL ID */
-  ent = (XASL_CACHE_ENTRY *) mht_get (xasl_ent_cache.xid_ht, xasl_id);
+  ent = (XASL_CACHE_ENTRY *) mht_get2 (xasl_ent_cache.xid_ht, xasl_id, NULL);
 
   if (ent)
     {
@@ -16160,6 +17933,7 @@ qexec_check_xasl_cache_ent_by_xasl (THREAD_ENTRY * thread_p, const XASL_ID * xas
 			"qexec_check_xasl_cache_ent_by_xasl: store time mismatch %d sec %d usec vs %d sec %d usec\n",
 			ent->xasl_id.time_stored.sec, ent->xasl_id.time_stored.usec, xasl_id->time_stored.sec,
 			xasl_id->time_stored.usec);
+	  XASL_CACHE_STAT_INC (ent->miss_count);
 	  ent = NULL;
 	}
 
@@ -16168,6 +17942,7 @@ qexec_check_xasl_cache_ent_by_xasl (THREAD_ENTRY * thread_p, const XASL_ID * xas
 	{
 	  er_log_debug (ARG_FILE_LINE, "qexec_check_xasl_cache_ent_by_xasl: dbval_cnt mismatch %d vs %d\n",
 			ent->dbval_cnt, dbval_cnt);
+	  XASL_CACHE_STAT_INC (ent->miss_count);
 	  ent = NULL;
 	}
 
@@ -16194,19 +17969,12 @@ qexec_check_xasl_cache_ent_by_xasl (THREAD_ENTRY * thread_p, const XASL_ID * xas
 	}
 #endif
 
-      if (ent && !ent->deletion_marker && xasl_ent_cache.qstr_ht->build_lru_list)
+      if (ent && !ent->deletion_marker)
 	{
-	  if (ent->qstr_ht_entry_ptr)
-	    {
-	      mht_adjust_lru_list (xasl_ent_cache.qstr_ht, ent->qstr_ht_entry_ptr);
-#if !defined (NDEBUG)
-	      assert (mht_get (xasl_ent_cache.qstr_ht, (void *) &ent->qstr_ht_key) == ent);
-#endif
-	    }
-	  else
-	    {
-	      assert (0);
-	    }
+	  /* give the entry a second chance on the eviction clock */
+	  assert (ent->qstr_ht_entry_ptr != NULL);
+	  assert (mht_get2 (xasl_ent_cache.qstr_ht, (void *) &ent->qstr_ht_key, NULL) == ent);
+	  ent->clock_referenced = true;
 	}
     }
 
@@ -16280,7 +18048,7 @@ qexec_check_xasl_cache_ent_by_xasl (THREAD_ENTRY * thread_p, const XASL_ID * xas
     }
 #endif /* ENABLE_UNUSED_FUNCTION */
 
-  if (rwlock_write_unlock (QEXEC_RWLOCK_XASL_CACHE) != NO_ERROR)
+  if (XASL_CACHE_LOOKUP_UNLOCK () != NO_ERROR)
     {
       return NULL;
     }
@@ -17084,6 +18852,11 @@ qexec_clear_list_cache_by_class (THREAD_ENTRY * thread_p, const OID * class_oid)
     {
       /* look up the hash table with the key */
       ent = (XASL_CACHE_ENTRY *) mht_get2 (xasl_ent_cache.oid_ht, class_oid, &last);
+      if (ent)
+	{
+	  /* queries running across the clear must not cache their results */
+	  ent->list_clear_count++;
+	}
       if (ent && ent->list_ht_no >= 0)
 	{
 	  (void) qfile_clear_list_cache (thread_p, ent->list_ht_no, false);
@@ -17099,6 +18872,45 @@ qexec_clear_list_cache_by_class (THREAD_ENTRY * thread_p, const OID * class_oid)
   return NO_ERROR;
 }
 
+/*
+ * qexec_update_list_cache_ent () - Cache the result of a query unless its
+ *				    results were cleared while it ran
+ *   return: the list cache entry, or NULL if the result is not cached
+ *   ent(in)		  : XASL cache entry of the query
+ *   list_clear_count(in) : ent->list_clear_count when the query started
+ *   params(in)		  : values of the host variables
+ *   list_id(in)	  : result of the query
+ *   exec_time(in)	  : execution time in microseconds
+ *
+ * Note: qexec_clear_list_cache_by_class counts and clears under the write
+ *	 lock of the XASL cache, so holding the lock while checking the count
+ *	 and inserting keeps a clear from falling in between.
+ */
+QFILE_LIST_CACHE_ENTRY *
+qexec_update_list_cache_ent (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * ent, unsigned int list_clear_count,
+			     const DB_VALUE_ARRAY * params, const QFILE_LIST_ID * list_id, INT64 exec_time)
+{
+  QFILE_LIST_CACHE_ENTRY *lent = NULL;
+
+  if (XASL_CACHE_LOOKUP_LOCK () != NO_ERROR)
+    {
+      return NULL;
+    }
+
+  if (!ent->deletion_marker && ent->list_clear_count == list_clear_count)
+    {
+      lent = qfile_update_list_cache_entry (thread_p, &ent->list_ht_no, params, list_id, ent->sql_info.sql_hash_text,
+					    exec_time);
+    }
+
+  if (XASL_CACHE_LOOKUP_UNLOCK () != NO_ERROR)
+    {
+      return NULL;
+    }
+
+  return lent;
+}
+
 /*
  * replace_null_arith () -
  *   return:
@@ -18160,7 +19972,7 @@ qexec_insert_tuple_into_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id,
 	{
 	  /* allocate tuple descriptor */
 	  tplrec->size = DB_PAGESIZE;
-	  tplrec->tpl = (QFILE_TUPLE) db_private_alloc (thread_p, DB_PAGESIZE);
+	  tplrec->tpl = (QFILE_TUPLE) db_arena_alloc (thread_p, DB_PAGESIZE);
 	  if (tplrec->tpl == NULL)
 	    {
 	      return ER_FAILED;
@@ -24238,9 +26050,13 @@ qexec_update_filter_pred_cache_ent (THREAD_ENTRY * thread_p, const char *qstr, X
   (void) gettimeofday (&ent->time_created, NULL);
   (void) gettimeofday (&ent->time_last_used, NULL);
   ent->ref_count = 0;
+  ent->miss_count = 0;
+  ent->recompile_count = 0;
   ent->deletion_marker = false;
+  ent->clock_referenced = false;
   ent->dbval_cnt = dbval_cnt;
   ent->list_ht_no = -1;
+  ent->list_clear_count = 0;
   ent->clo_list = NULL;
   /* record my transaction id into the entry */
 #if defined(SERVER_MODE)
@@ -1062,11 +1062,16 @@ struct xasl_cache_ent
   struct timeval time_last_used;	/* when this entry used lastly */
   int n_oid_list;		/* size of the class OID list */
   int ref_count;		/* how many times this entry used */
+  int miss_count;		/* how many times this entry was found but could not be used; timed out or stale XASL ID */
+  int recompile_count;		/* how many times the plan of this query was recompiled by the recompilation threshold */
   int dbval_cnt;		/* number of DB_VALUE parameters of the XASL */
   int list_ht_no;		/* memory hash table for query result(list file) cache generated by this XASL
 				 * referencing by DB_VALUE parameters bound to the result */
+  unsigned int list_clear_count;	/* how many times the results were cleared by class modifications; a result
+					 * made across a clear is not cached */
   struct xasl_cache_clo *clo_list;	/* list of cache clones for this XASL */
   bool deletion_marker;		/* this entry will be deleted if marker set */
+  bool clock_referenced;	/* set when this entry is used; the eviction clock gives it a second chance and clears it */
   XASL_QSTR_HT_KEY qstr_ht_key;	/* The key of query string hash table */
   HENTRY_PTR qstr_ht_entry_ptr;	/* Hash entry of the query string hash table that holds this xasl cache entry. This
 				 * pointer is used to update query string hash table's lru list. */
@@ -1112,6 +1117,8 @@ extern int qexec_initialize_xasl_cache (THREAD_ENTRY * thread_p);
 extern int qexec_initialize_filter_pred_cache (THREAD_ENTRY * thread_p);
 extern int qexec_finalize_xasl_cache (THREAD_ENTRY * thread_p);
 extern int qexec_finalize_filter_pred_cache (THREAD_ENTRY * thread_p);
+extern int qexec_xasl_cache_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt,
+					void **ptr);
 extern int qexec_dump_xasl_cache_internal (THREAD_ENTRY * thread_p, FILE * fp, int mask);
 extern int qexec_dump_filter_pred_cache_internal (THREAD_ENTRY * thread_p, FILE * fp, int mask);
 #if defined(CUBRID_DEBUG)
@@ -1156,6 +1163,10 @@ extern int qexec_remove_xasl_cache_ent_by_volume (THREAD_ENTRY * thread_p, VOLID
 #endif
 extern int qexec_remove_all_filter_pred_cache_ent_by_xasl (THREAD_ENTRY * thread_p);
 extern int qexec_clear_list_cache_by_class (THREAD_ENTRY * thread_p, const OID * class_oid);
+extern struct qfile_list_cache_entry *qexec_update_list_cache_ent (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * ent,
+								   unsigned int list_clear_count,
+								   const DB_VALUE_ARRAY * params,
+								   const QFILE_LIST_ID * list_id, INT64 exec_time);
 extern int qexec_clear_list_pred_cache_by_class (THREAD_ENTRY * thread_p, const OID * class_oid);
 extern bool qdump_print_xasl (XASL_NODE * xasl);
 #if defined(CUBRID_DEBUG)
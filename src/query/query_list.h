@@ -528,11 +528,19 @@ struct qfile_tuple_value_position
   int pos_no;			/* value position number */
 };
 
+/* List File Join Method */
+typedef enum
+{
+  QFILE_JOIN_SORT_MERGE = 0,	/* merge two list files sorted on the join columns */
+  QFILE_JOIN_HASH		/* build a hash table on one list file and probe it with the other */
+} QFILE_JOIN_METHOD;
+
 /* List File Merge Information */
 typedef struct qfile_list_merge_info QFILE_LIST_MERGE_INFO;
 struct qfile_list_merge_info
 {
   JOIN_TYPE join_type;		/* inner, left, right or outer */
+  QFILE_JOIN_METHOD join_method;	/* sort-merge or hash */
   QPROC_SINGLE_FETCH single_fetch;	/* merge in single fetch mode */
   int ls_column_cnt;		/* join columns count */
   int ls_pos_cnt;		/* tuple value fetch count */
@@ -158,6 +158,7 @@ static int xqmgr_unpack_xasl_tree (THREAD_ENTRY * thread_p, const XASL_ID * xasl
 				   int xasl_stream_size, XASL_CACHE_CLONE * cache_clone_p, XASL_NODE ** xasl_tree,
 				   void **xasl_unpack_info_ptr);
 static void qmgr_clear_relative_cache_entries (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry_p);
+static bool qmgr_has_modified_class (QMGR_TRAN_ENTRY * tran_entry_p, const XASL_CACHE_ENTRY * xasl_cache_entry_p);
 static OID_BLOCK_LIST *qmgr_allocate_oid_block (THREAD_ENTRY * thread_p);
 static void qmgr_free_oid_block (THREAD_ENTRY * thread_p, OID_BLOCK_LIST * oid_block);
 static PAGE_PTR qmgr_get_external_file_page (THREAD_ENTRY * thread_p, VPID * vpid, QMGR_TEMP_FILE * vfid);
@@ -1221,6 +1222,7 @@ qmgr_process_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id, char *xasl
   XASL_NODE *xasl_p;
   void *xasl_buf_info;
   QFILE_LIST_ID *list_id;
+  DB_ARENA arena;
 
   assert (query_p != NULL);
   assert (tran_entry_p != NULL);
@@ -1229,6 +1231,9 @@ qmgr_process_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id, char *xasl
   xasl_buf_info = NULL;
   list_id = NULL;
 
+  /* buffers of the execution are allocated in the arena; they are all released after the XASL tree is cleared */
+  db_arena_begin (thread_p, &arena);
+
   if (xqmgr_unpack_xasl_tree (thread_p, xasl_id, xasl_stream, xasl_stream_size, cache_clone_p, &xasl_p, &xasl_buf_info)
       != NO_ERROR)
     {
@@ -1299,6 +1304,8 @@ end:
       db_private_free_and_init (thread_p, xasl_buf_info);
     }
 
+  db_arena_end (thread_p, &arena);
+
   return list_id;
 
 exit_on_error:
@@ -1352,6 +1359,9 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
   bool saved_is_stats_on;
   bool xasl_trace;
   bool is_xasl_pinned_reference;
+  bool use_result_cache;
+  unsigned int list_clear_count;
+  struct timeval exec_start, exec_end;
 
   cached_result = false;
   query_p = NULL;
@@ -1517,7 +1527,17 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
       goto exit_on_error;
     }
 
-  if (qmgr_can_get_result_from_cache (*flag_p))
+  /* The results made by this transaction after it modified a class of the query are not visible to others and cannot
+   * be cached, and the committed ones do not show its changes. Cached results are those of the latest commits, so they
+   * are used and made only by READ COMMITTED statements, whose snapshot is taken after this point; the snapshot of a
+   * REPEATABLE READ or SERIALIZABLE transaction may be older or newer than a cached result. Remember how many times
+   * the results of this query were cleared, so that a result made across a commit that modified its classes is not
+   * cached. */
+  use_result_cache = (logtb_find_current_isolation (thread_p) == TRAN_READ_COMMITTED
+		      && !qmgr_has_modified_class (&qmgr_Query_table.tran_entries_p[tran_index], xasl_cache_entry_p));
+  list_clear_count = xasl_cache_entry_p->list_clear_count;
+
+  if (use_result_cache && qmgr_can_get_result_from_cache (*flag_p))
     {
       /* lookup the list cache with the parameter values (DB_VALUE array) */
       list_cache_entry_p = qfile_lookup_list_cache_entry (thread_p, xasl_cache_entry_p->list_ht_no, &params);
@@ -1623,6 +1643,8 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 
   assert (cached_result == false);
 
+  (void) gettimeofday (&exec_start, NULL);
+
   list_id_p = qmgr_process_query (thread_p, xasl_id_p, NULL, 0, dbval_count, dbvals_p, *flag_p, cache_clone_p,
 				  query_p, tran_entry_p);
   if (list_id_p == NULL)
@@ -1636,10 +1658,13 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
   /* If it is allowed to cache the query result or if it is required to cache, put the list file id(QFILE_LIST_ID) into 
    * the list cache. Provided are the corresponding XASL cache entry to be linked, and the parameters (host variables - 
    * DB_VALUES). */
-  if (qmgr_is_allowed_result_cache (*flag_p))
+  if (use_result_cache && qmgr_is_allowed_result_cache (*flag_p))
     {
-      /* check once more to ensure that the related XASL entry is still valid */
-      if (!xasl_cache_entry_p->deletion_marker)
+      (void) gettimeofday (&exec_end, NULL);
+
+      /* check once more to ensure that the related XASL entry is still valid and the result is still up to date */
+      if (!xasl_cache_entry_p->deletion_marker && xasl_cache_entry_p->list_clear_count == list_clear_count
+	  && !qmgr_has_modified_class (tran_entry_p, xasl_cache_entry_p))
 	{
 	  if (list_id_p == NULL)
 	    {
@@ -1669,10 +1694,11 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 	    }
 
 	  /* update the cache entry for the result associated with the used parameter values (DB_VALUE array) if there
-	   * is, or make new one */
+	   * is, or make new one; the clear count is checked again with the insert */
 	  list_cache_entry_p =
-	    qfile_update_list_cache_entry (thread_p, &xasl_cache_entry_p->list_ht_no, &params, list_id_p,
-					   xasl_cache_entry_p->sql_info.sql_hash_text);
+	    qexec_update_list_cache_ent (thread_p, xasl_cache_entry_p, list_clear_count, &params, list_id_p,
+					 ((INT64) (exec_end.tv_sec - exec_start.tv_sec) * 1000000LL
+					  + (exec_end.tv_usec - exec_start.tv_usec)));
 	  if (list_cache_entry_p == NULL)
 	    {
 	      char *s;
@@ -2212,6 +2238,75 @@ qmgr_clear_relative_cache_entries (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tr
     }
 }
 
+/*
+ * qmgr_has_modified_class () - Check if the transaction modified any class
+ *				referenced by the query
+ *   return: true if a class of the query was modified by the transaction
+ *   tran_entry_p(in)   : query table entry of the transaction
+ *   xasl_cache_entry_p(in) : XASL cache entry of the query
+ */
+static bool
+qmgr_has_modified_class (QMGR_TRAN_ENTRY * tran_entry_p, const XASL_CACHE_ENTRY * xasl_cache_entry_p)
+{
+  OID_BLOCK_LIST *oid_block_p;
+  OID *class_oid_p;
+  int i, j;
+
+  for (oid_block_p = tran_entry_p->modified_classes_p; oid_block_p; oid_block_p = oid_block_p->next)
+    {
+      for (i = 0, class_oid_p = oid_block_p->oid_array; i < oid_block_p->last_oid_idx; i++, class_oid_p++)
+	{
+	  for (j = 0; j < xasl_cache_entry_p->n_oid_list; j++)
+	    {
+	      if (OID_EQ (class_oid_p, &xasl_cache_entry_p->class_oid_list[j]))
+		{
+		  return true;
+		}
+	    }
+	}
+    }
+
+  return false;
+}
+
+/*
+ * qmgr_clear_committed_cache_entries () - Clear the query results which
+ *					   depend on the classes modified by a
+ *					   committed transaction
+ *   return:
+ *   tran_index(in)     : Log Transaction index
+ *
+ * Note: This is called once the changes of the transaction are visible to
+ * other transactions, so that no result made before the commit survives it.
+ * The results of the other transactions depending on the modified classes
+ * stay valid until then, since they do not see the uncommitted changes.
+ */
+void
+qmgr_clear_committed_cache_entries (THREAD_ENTRY * thread_p, int tran_index)
+{
+  QMGR_TRAN_ENTRY *tran_entry_p;
+
+  if (tran_index >= qmgr_Query_table.num_trans
+#if defined (SERVER_MODE)
+      || tran_index == LOG_SYSTEM_TRAN_INDEX
+#endif
+    )
+    {
+      return;
+    }
+
+  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
+  if (tran_entry_p->modified_classes_p == NULL)
+    {
+      return;
+    }
+
+  qmgr_clear_relative_cache_entries (thread_p, tran_entry_p);
+
+  qmgr_free_oid_block (thread_p, tran_entry_p->modified_classes_p);
+  tran_entry_p->modified_classes_p = NULL;
+}
+
 /*
  * qmgr_clear_trans_wakeup () -
  *   return:
@@ -2258,14 +2353,10 @@ qmgr_clear_trans_wakeup (THREAD_ENTRY * thread_p, int tran_index, bool is_tran_d
       qfile_clear_uncommited_list_cache_entry (thread_p, tran_index);
     }
 
-  /* if the transaction is aborting, clear relative cache entries */
-  if (tran_entry_p->modified_classes_p)
+  /* the cached results never show uncommitted changes, so there is nothing to clear when the changes are rolled back. A
+   * committing transaction keeps its modified classes until qmgr_clear_committed_cache_entries (). */
+  if (tran_entry_p->modified_classes_p && (is_abort || is_tran_died))
     {
-      if (is_abort)
-	{
-	  qmgr_clear_relative_cache_entries (thread_p, tran_entry_p);
-	}
-
       qmgr_free_oid_block (thread_p, tran_entry_p->modified_classes_p);
       tran_entry_p->modified_classes_p = NULL;
     }
@@ -141,6 +141,7 @@ extern void qmgr_dump (void);
 extern int qmgr_initialize (THREAD_ENTRY * thread_p);
 extern void qmgr_finalize (THREAD_ENTRY * thread_p);
 extern void qmgr_clear_trans_wakeup (THREAD_ENTRY * thread_p, int tran_index, bool tran_died, bool is_abort);
+extern void qmgr_clear_committed_cache_entries (THREAD_ENTRY * thread_p, int tran_index);
 #if defined(ENABLE_UNUSED_FUNCTION)
 extern QMGR_TRAN_STATUS qmgr_get_tran_status (THREAD_ENTRY * thread_p, int tran_index);
 extern void qmgr_set_tran_status (THREAD_ENTRY * thread_p, int tran_index, QMGR_TRAN_STATUS trans_status);
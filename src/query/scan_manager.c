@@ -41,6 +41,7 @@
 #include "fetch.h"
 #include "list_file.h"
 #include "set_scan.h"
+#include "set_object.h"
 #include "system_parameter.h"
 #include "btree_load.h"
 #include "perf_monitor.h"
@@ -75,6 +76,9 @@ static int rv;
 
 #define GET_NTH_OID(oid_setp, n) ((OID *)((OID *)(oid_setp) + (n)))
 
+/* initial size of the record area of a heap scan batch, per row */
+#define SCAN_BATCH_ROW_AREA_SIZE 256
+
 /* ISS_RANGE_DETAILS stores information about the two ranges we use
  * interchangeably in Index Skip Scan mode: along with the real range, we
  * use a "fake" one to obtain the next value for the index's first column.
@@ -172,6 +176,21 @@ static void scan_init_scan_id (SCAN_ID * scan_id, bool force_select_lock, SCAN_O
 static int scan_init_index_key_limit (THREAD_ENTRY * thread_p, INDX_SCAN_ID * isidp, KEY_INFO * key_infop,
 				      VAL_DESCR * vd);
 static SCAN_CODE scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static bool scan_batch_is_vector_type (DB_TYPE type);
+static void scan_batch_get_value (const DB_VALUE * value, INT64 * i64, double *dbl);
+static HEAP_SCAN_BATCH_TERM *scan_batch_add_term (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, ATTR_ID attr_id,
+						  DB_TYPE type, REL_OP rel_op, int *error);
+static int scan_batch_add_comp_term (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, COMP_EVAL_TERM * et_comp,
+				     VAL_DESCR * vd);
+static int scan_batch_add_in_term (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, ALSM_EVAL_TERM * et_alsm,
+				   VAL_DESCR * vd);
+static int scan_batch_add_terms (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, PRED_EXPR * pr, VAL_DESCR * vd);
+static void scan_batch_free (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch);
+static int scan_batch_create (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static void scan_batch_reset (HEAP_SCAN_BATCH * batch, const OID * oid);
+static SCAN_CODE scan_batch_fill (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, bool * is_decoded);
+static void scan_batch_filter (HEAP_SCAN_BATCH * batch);
+static SCAN_CODE scan_batch_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, RECDES * recdes);
 static SCAN_CODE scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static int scan_next_heap_page_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_class_attr_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
@@ -2781,7 +2800,31 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   hsidp->cache_recordinfo = cache_recordinfo;
   hsidp->recordinfo_regu_list = regu_list_recordinfo;
 
-  return NO_ERROR;
+  hsidp->px_scan = NULL;
+
+  return scan_batch_create (thread_p, scan_id);
+}
+
+/*
+ * scan_set_parallel_heap_scan () - Make a heap scan take its pages from a parallel heap scan
+ *   return:
+ *   scan_id(in/out): Scan identifier of an opened heap scan
+ *   px_scan(in): Page cursor shared with the other scanners of the heap
+ *
+ * Note: The scan is turned into a grouped scan where every scan block is a
+ * heap page handed out by the shared cursor. It must be called before the
+ * scan is started.
+ */
+void
+scan_set_parallel_heap_scan (SCAN_ID * scan_id, HEAP_PARALLEL_SCAN * px_scan)
+{
+  assert (scan_id->type == S_HEAP_SCAN);
+  assert (scan_id->status == S_OPENED);
+  assert (scan_id->fixed);
+
+  scan_id->grouped = true;
+  scan_id->direction = S_FORWARD;
+  scan_id->s.hsid.px_scan = px_scan;
 }
 
 /*
@@ -3047,7 +3090,7 @@ scan_open_index_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   if (prm_get_bool_value (PRM_ID_ORACLE_STYLE_EMPTY_STRING))
     {
       isidp->num_vstr = isidp->bt_num_attrs;	/* init to maximum */
-      isidp->vstr_ids = (ATTR_ID *) db_private_alloc (thread_p, isidp->num_vstr * sizeof (ATTR_ID));
+      isidp->vstr_ids = (ATTR_ID *) db_arena_alloc (thread_p, isidp->num_vstr * sizeof (ATTR_ID));
       if (isidp->vstr_ids == NULL)
 	{
 	  goto exit_on_error;
@@ -3137,7 +3180,7 @@ scan_open_index_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
     {
       bool need_copy_buf;
 
-      isidp->key_vals = (KEY_VAL_RANGE *) db_private_alloc (thread_p, isidp->key_cnt * sizeof (KEY_VAL_RANGE));
+      isidp->key_vals = (KEY_VAL_RANGE *) db_arena_alloc (thread_p, isidp->key_cnt * sizeof (KEY_VAL_RANGE));
       if (isidp->key_vals == NULL)
 	{
 	  goto exit_on_error;
@@ -3172,7 +3215,7 @@ scan_open_index_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
       if (need_copy_buf)
 	{
 	  /* alloc index key copy_buf */
-	  isidp->copy_buf = (char *) db_private_alloc (thread_p, DBVAL_BUFSIZE);
+	  isidp->copy_buf = (char *) db_arena_alloc (thread_p, DBVAL_BUFSIZE);
 	  if (isidp->copy_buf == NULL)
 	    {
 	      goto exit_on_error;
@@ -3376,7 +3419,7 @@ scan_open_index_key_info_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   if (prm_get_bool_value (PRM_ID_ORACLE_STYLE_EMPTY_STRING))
     {
       isidp->num_vstr = isidp->bt_num_attrs;	/* init to maximum */
-      isidp->vstr_ids = (ATTR_ID *) db_private_alloc (thread_p, isidp->num_vstr * sizeof (ATTR_ID));
+      isidp->vstr_ids = (ATTR_ID *) db_arena_alloc (thread_p, isidp->num_vstr * sizeof (ATTR_ID));
       if (isidp->vstr_ids == NULL)
 	{
 	  goto exit_on_error;
@@ -3845,6 +3888,10 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
     case S_HEAP_SCAN_RECORD_INFO:
       hsidp = &scan_id->s.hsid;
       UT_CAST_TO_NULL_HEAP_OID (&hsidp->hfid, &hsidp->curr_oid);
+      if (hsidp->batch != NULL)
+	{
+	  scan_batch_reset (hsidp->batch, &hsidp->curr_oid);
+	}
       if (!OID_IS_ROOTOID (&hsidp->cls_oid))
 	{
 	  mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
@@ -4142,6 +4189,10 @@ scan_reset_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id)
 	  s_id->position = (s_id->direction == S_FORWARD) ? S_BEFORE : S_AFTER;
 	  OID_SET_NULL (&s_id->s.hsid.curr_oid);
 	}
+      if (s_id->s.hsid.batch != NULL)
+	{
+	  scan_batch_reset (s_id->s.hsid.batch, &s_id->s.hsid.curr_oid);
+	}
       break;
 
     case S_INDX_SCAN:
@@ -4274,7 +4325,12 @@ scan_next_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id)
       if (s_id->grouped)
 	{			/* grouped, fixed scan */
 
-	  if (s_id->direction == S_FORWARD)
+	  if (s_id->type == S_HEAP_SCAN && s_id->s.hsid.px_scan != NULL)
+	    {
+	      /* the next page nobody else has scanned */
+	      sp_scan = heap_parallel_scan_next_range (thread_p, s_id->s.hsid.px_scan, &s_id->s.hsid.scan_range);
+	    }
+	  else if (s_id->direction == S_FORWARD)
 	    {
 	      sp_scan = heap_scanrange_to_following (thread_p, &s_id->s.hsid.scan_range, NULL);
 	    }
@@ -4502,6 +4558,13 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   switch (scan_id->type)
     {
     case S_HEAP_SCAN:
+      if (scan_id->s.hsid.batch != NULL)
+	{
+	  scan_batch_free (thread_p, scan_id->s.hsid.batch);
+	  scan_id->s.hsid.batch = NULL;
+	}
+      break;
+
     case S_HEAP_SCAN_RECORD_INFO:
     case S_HEAP_PAGE_SCAN:
     case S_CLASS_ATTR_SCAN:
@@ -4828,6 +4891,840 @@ typedef enum
   OBJ_REPEAT_GET_WITH_LOCK = 1,
   OBJ_GET_WITH_LOCK_COMPLETE = 2
 } OBJECT_GET_STATUS;
+/*
+ * scan_batch_is_vector_type () - Can the values of the type be evaluated over a whole batch?
+ *   return: true if INT, BIGINT, DATE, DATETIME or DOUBLE
+ *   type(in):
+ */
+static bool
+scan_batch_is_vector_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_DATE:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_DOUBLE:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * scan_batch_get_value () - Put a value into the batch representation of its type
+ *   return:
+ *   value(in): non null value of a vector type
+ *   i64(out): INT, BIGINT, DATE and DATETIME values
+ *   dbl(out): DOUBLE values
+ *
+ * Note: DATETIME values are kept as milliseconds since the epoch of the julian
+ * date so that they keep their order.
+ */
+static void
+scan_batch_get_value (const DB_VALUE * value, INT64 * i64, double *dbl)
+{
+  DB_DATETIME *datetime;
+
+  switch (DB_VALUE_DOMAIN_TYPE (value))
+    {
+    case DB_TYPE_INTEGER:
+      *i64 = db_get_int (value);
+      break;
+
+    case DB_TYPE_BIGINT:
+      *i64 = db_get_bigint (value);
+      break;
+
+    case DB_TYPE_DATE:
+      *i64 = *db_get_date (value);
+      break;
+
+    case DB_TYPE_DATETIME:
+      datetime = db_get_datetime (value);
+      *i64 = (INT64) datetime->date * MILLISECONDS_OF_ONE_DAY + datetime->time;
+      break;
+
+    case DB_TYPE_DOUBLE:
+      *dbl = db_get_double (value);
+      break;
+
+    default:
+      assert (false);
+      break;
+    }
+}
+
+/*
+ * scan_batch_add_term () - Add a vectorized term on an attribute to the batch
+ *   return: the new term, NULL if the attribute is already used with another type
+ *   thread_p(in):
+ *   batch(in/out):
+ *   attr_id(in): attribute of the term
+ *   type(in): type of the constants of the term
+ *   rel_op(in):
+ *   error(out): error code
+ */
+static HEAP_SCAN_BATCH_TERM *
+scan_batch_add_term (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, ATTR_ID attr_id, DB_TYPE type, REL_OP rel_op,
+		     int *error)
+{
+  HEAP_SCAN_BATCH_TERM *term;
+  void *p;
+  int col;
+
+  *error = NO_ERROR;
+
+  for (col = 0; col < batch->num_cols; col++)
+    {
+      if (batch->cols[col].attr_id == attr_id)
+	{
+	  break;
+	}
+    }
+  if (col < batch->num_cols && type != DB_TYPE_NULL && batch->cols[col].type != type)
+    {
+      return NULL;
+    }
+
+  if (col == batch->num_cols && type != DB_TYPE_NULL)
+    {
+      p = db_private_realloc (thread_p, batch->cols, (batch->num_cols + 1) * sizeof (HEAP_SCAN_BATCH_COL));
+      if (p == NULL)
+	{
+	  *error = ER_OUT_OF_VIRTUAL_MEMORY;
+	  return NULL;
+	}
+      batch->cols = (HEAP_SCAN_BATCH_COL *) p;
+      batch->cols[col].attr_id = attr_id;
+      batch->cols[col].type = type;
+      batch->cols[col].i64 = NULL;
+      batch->cols[col].dbl = NULL;
+      batch->cols[col].is_null = NULL;
+      batch->num_cols++;
+    }
+
+  p = db_private_realloc (thread_p, batch->terms, (batch->num_terms + 1) * sizeof (HEAP_SCAN_BATCH_TERM));
+  if (p == NULL)
+    {
+      *error = ER_OUT_OF_VIRTUAL_MEMORY;
+      return NULL;
+    }
+  batch->terms = (HEAP_SCAN_BATCH_TERM *) p;
+
+  term = &batch->terms[batch->num_terms++];
+  /* a term on a NULL constant has no column */
+  term->col = (type != DB_TYPE_NULL) ? col : -1;
+  term->rel_op = rel_op;
+  term->is_false = (type == DB_TYPE_NULL);
+  term->i64 = 0;
+  term->dbl = 0;
+  term->set_size = -1;
+  term->i64_set = NULL;
+  term->dbl_set = NULL;
+
+  return term;
+}
+
+/*
+ * scan_batch_add_comp_term () - Add a comparison of an attribute with a constant
+ *   return: error code
+ *   thread_p(in):
+ *   batch(in/out):
+ *   et_comp(in): comparison term of the scan predicate
+ *   vd(in): host variables
+ */
+static int
+scan_batch_add_comp_term (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, COMP_EVAL_TERM * et_comp, VAL_DESCR * vd)
+{
+  REGU_VARIABLE *attr, *constant;
+  REL_OP rel_op = et_comp->rel_op;
+  HEAP_SCAN_BATCH_TERM *term;
+  DB_VALUE *value;
+  DB_TYPE type;
+  int error = NO_ERROR;
+
+  if (et_comp->lhs == NULL || et_comp->rhs == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  attr = et_comp->lhs;
+  constant = et_comp->rhs;
+  if (attr->type != TYPE_ATTR_ID)
+    {
+      /* constant op attr */
+      attr = et_comp->rhs;
+      constant = et_comp->lhs;
+      switch (rel_op)
+	{
+	case R_GT:
+	  rel_op = R_LT;
+	  break;
+	case R_GE:
+	  rel_op = R_LE;
+	  break;
+	case R_LT:
+	  rel_op = R_GT;
+	  break;
+	case R_LE:
+	  rel_op = R_GE;
+	  break;
+	default:
+	  break;
+	}
+    }
+
+  if (attr->type != TYPE_ATTR_ID || (constant->type != TYPE_DBVAL && constant->type != TYPE_POS_VALUE))
+    {
+      return NO_ERROR;
+    }
+
+  switch (rel_op)
+    {
+    case R_EQ:
+    case R_NE:
+    case R_GT:
+    case R_GE:
+    case R_LT:
+    case R_LE:
+      break;
+
+    default:
+      return NO_ERROR;
+    }
+
+  if (fetch_peek_dbval (thread_p, constant, vd, NULL, NULL, NULL, &value) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  type = DB_IS_NULL (value) ? DB_TYPE_NULL : DB_VALUE_DOMAIN_TYPE (value);
+  if (type != DB_TYPE_NULL
+      && (!scan_batch_is_vector_type (type) || (et_comp->type != DB_TYPE_NULL && et_comp->type != type)))
+    {
+      return NO_ERROR;
+    }
+
+  term = scan_batch_add_term (thread_p, batch, attr->value.attr_descr.id, type, rel_op, &error);
+  if (term != NULL && type != DB_TYPE_NULL)
+    {
+      scan_batch_get_value (value, &term->i64, &term->dbl);
+    }
+
+  return error;
+}
+
+/*
+ * scan_batch_add_in_term () - Add an IN list of constants on an attribute
+ *   return: error code
+ *   thread_p(in):
+ *   batch(in/out):
+ *   et_alsm(in): "attr = SOME (set)" term of the scan predicate
+ *   vd(in): host variables
+ *
+ * Note: NULL constants of the list never match and are left out.
+ */
+static int
+scan_batch_add_in_term (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, ALSM_EVAL_TERM * et_alsm, VAL_DESCR * vd)
+{
+  HEAP_SCAN_BATCH_TERM *term;
+  DB_VALUE *value, elem;
+  DB_COLLECTION *set;
+  DB_TYPE type = DB_TYPE_NULL, elem_type;
+  int size, i, n;
+  int error = NO_ERROR;
+
+  if (et_alsm->eq_flag != F_SOME || et_alsm->rel_op != R_EQ || et_alsm->elem == NULL || et_alsm->elemset == NULL
+      || et_alsm->elem->type != TYPE_ATTR_ID
+      || (et_alsm->elemset->type != TYPE_DBVAL && et_alsm->elemset->type != TYPE_POS_VALUE))
+    {
+      return NO_ERROR;
+    }
+
+  if (fetch_peek_dbval (thread_p, et_alsm->elemset, vd, NULL, NULL, NULL, &value) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+  if (DB_IS_NULL (value) || !TP_IS_SET_TYPE (DB_VALUE_DOMAIN_TYPE (value)))
+    {
+      return NO_ERROR;
+    }
+
+  /* all the constants must have the same vector type */
+  set = db_get_set (value);
+  size = set_size (set);
+  for (i = 0; i < size; i++)
+    {
+      if (set_get_element (set, i, &elem) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+      elem_type = DB_IS_NULL (&elem) ? DB_TYPE_NULL : DB_VALUE_DOMAIN_TYPE (&elem);
+      pr_clear_value (&elem);
+      if (elem_type == DB_TYPE_NULL)
+	{
+	  continue;
+	}
+      if (!scan_batch_is_vector_type (elem_type) || (type != DB_TYPE_NULL && elem_type != type))
+	{
+	  return NO_ERROR;
+	}
+      type = elem_type;
+    }
+
+  term = scan_batch_add_term (thread_p, batch, et_alsm->elem->value.attr_descr.id, type, R_EQ, &error);
+  if (term == NULL || type == DB_TYPE_NULL)
+    {
+      return error;
+    }
+
+  term->set_size = 0;
+  if (type == DB_TYPE_DOUBLE)
+    {
+      term->dbl_set = (double *) db_private_alloc (thread_p, size * sizeof (double));
+      if (term->dbl_set == NULL)
+	{
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+    }
+  else
+    {
+      term->i64_set = (INT64 *) db_private_alloc (thread_p, size * sizeof (INT64));
+      if (term->i64_set == NULL)
+	{
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+    }
+
+  for (i = 0, n = 0; i < size; i++)
+    {
+      if (set_get_element (set, i, &elem) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+      if (!DB_IS_NULL (&elem))
+	{
+	  scan_batch_get_value (&elem, (term->i64_set != NULL) ? &term->i64_set[n] : NULL,
+				(term->dbl_set != NULL) ? &term->dbl_set[n] : NULL);
+	  n++;
+	}
+      pr_clear_value (&elem);
+    }
+  term->set_size = n;
+
+  return NO_ERROR;
+}
+
+/*
+ * scan_batch_add_terms () - Add the vectorizable conjuncts of a predicate to the batch
+ *   return: error code
+ *   thread_p(in):
+ *   batch(in/out):
+ *   pr(in): predicate
+ *   vd(in): host variables
+ *
+ * Note: Only the top level AND terms are looked at. A row that fails any of them
+ * can not qualify, whatever the rest of the predicate is.
+ */
+static int
+scan_batch_add_terms (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, PRED_EXPR * pr, VAL_DESCR * vd)
+{
+  int error;
+
+  if (pr == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  switch (pr->type)
+    {
+    case T_PRED:
+      if (pr->pe.pred.bool_op != B_AND)
+	{
+	  return NO_ERROR;
+	}
+      error = scan_batch_add_terms (thread_p, batch, pr->pe.pred.lhs, vd);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      return scan_batch_add_terms (thread_p, batch, pr->pe.pred.rhs, vd);
+
+    case T_EVAL_TERM:
+      if (pr->pe.eval_term.et_type == T_COMP_EVAL_TERM)
+	{
+	  return scan_batch_add_comp_term (thread_p, batch, &pr->pe.eval_term.et.et_comp, vd);
+	}
+      else if (pr->pe.eval_term.et_type == T_ALSM_EVAL_TERM)
+	{
+	  return scan_batch_add_in_term (thread_p, batch, &pr->pe.eval_term.et.et_alsm, vd);
+	}
+      return NO_ERROR;
+
+    default:
+      return NO_ERROR;
+    }
+}
+
+/*
+ * scan_batch_free () - Free a heap scan batch
+ *   return:
+ *   thread_p(in):
+ *   batch(in):
+ */
+static void
+scan_batch_free (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch)
+{
+  int i;
+
+  if (batch == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < batch->num_cols; i++)
+    {
+      if (batch->cols[i].i64 != NULL)
+	{
+	  db_private_free (thread_p, batch->cols[i].i64);
+	}
+      if (batch->cols[i].dbl != NULL)
+	{
+	  db_private_free (thread_p, batch->cols[i].dbl);
+	}
+      if (batch->cols[i].is_null != NULL)
+	{
+	  db_private_free (thread_p, batch->cols[i].is_null);
+	}
+    }
+  for (i = 0; i < batch->num_terms; i++)
+    {
+      if (batch->terms[i].i64_set != NULL)
+	{
+	  db_private_free (thread_p, batch->terms[i].i64_set);
+	}
+      if (batch->terms[i].dbl_set != NULL)
+	{
+	  db_private_free (thread_p, batch->terms[i].dbl_set);
+	}
+    }
+  if (batch->cols != NULL)
+    {
+      db_private_free (thread_p, batch->cols);
+    }
+  if (batch->terms != NULL)
+    {
+      db_private_free (thread_p, batch->terms);
+    }
+  if (batch->oids != NULL)
+    {
+      db_private_free (thread_p, batch->oids);
+    }
+  if (batch->recdes != NULL)
+    {
+      db_private_free (thread_p, batch->recdes);
+    }
+  if (batch->sel != NULL)
+    {
+      db_private_free (thread_p, batch->sel);
+    }
+  if (batch->area != NULL)
+    {
+      db_private_free (thread_p, batch->area);
+    }
+  db_private_free (thread_p, batch);
+}
+
+/*
+ * scan_batch_create () - Create the batch of a heap scan if its predicate can be vectorized
+ *   return: error code
+ *   thread_p(in):
+ *   scan_id(in/out): opened heap scan
+ *
+ * Note: The batch is kept only for plain forward select scans of MVCC classes whose
+ * predicate has comparisons or IN lists of an attribute with constants of type
+ * INT, BIGINT, DATE, DATETIME or DOUBLE. The constants are fetched once here, so
+ * host variables must not change while the scan is open.
+ */
+static int
+scan_batch_create (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  HEAP_SCAN_BATCH *batch;
+  int max_rows = prm_get_integer_value (PRM_ID_SCAN_BATCH_SIZE);
+  int error, i;
+
+  hsidp->batch = NULL;
+
+  if (max_rows <= 0 || scan_id->type != S_HEAP_SCAN || scan_id->grouped || scan_id->mvcc_select_lock_needed
+      || scan_id->scan_op_type != S_SELECT || hsidp->scan_pred.pred_expr == NULL || hsidp->pred_attrs.num_attrs <= 0
+      || OID_IS_ROOTOID (&hsidp->cls_oid) || heap_is_mvcc_disabled_for_class (&hsidp->cls_oid))
+    {
+      return NO_ERROR;
+    }
+
+  batch = (HEAP_SCAN_BATCH *) db_private_alloc (thread_p, sizeof (HEAP_SCAN_BATCH));
+  if (batch == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (batch, 0, sizeof (HEAP_SCAN_BATCH));
+  batch->max_rows = max_rows;
+
+  error = scan_batch_add_terms (thread_p, batch, hsidp->scan_pred.pred_expr, scan_id->vd);
+  if (error != NO_ERROR || batch->num_terms == 0)
+    {
+      scan_batch_free (thread_p, batch);
+      return error;
+    }
+
+  batch->area_size = DB_ALIGN (MAX (DB_PAGESIZE, max_rows * SCAN_BATCH_ROW_AREA_SIZE), MAX_ALIGNMENT);
+  batch->area = (char *) db_private_alloc (thread_p, batch->area_size);
+  batch->oids = (OID *) db_private_alloc (thread_p, max_rows * sizeof (OID));
+  batch->recdes = (RECDES *) db_private_alloc (thread_p, max_rows * sizeof (RECDES));
+  batch->sel = (int *) db_private_alloc (thread_p, max_rows * sizeof (int));
+  if (batch->area == NULL || batch->oids == NULL || batch->recdes == NULL || batch->sel == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  for (i = 0; i < batch->num_cols; i++)
+    {
+      if (batch->cols[i].type == DB_TYPE_DOUBLE)
+	{
+	  batch->cols[i].dbl = (double *) db_private_alloc (thread_p, max_rows * sizeof (double));
+	}
+      else
+	{
+	  batch->cols[i].i64 = (INT64 *) db_private_alloc (thread_p, max_rows * sizeof (INT64));
+	}
+      batch->cols[i].is_null = (char *) db_private_alloc (thread_p, max_rows);
+      if ((batch->cols[i].dbl == NULL && batch->cols[i].i64 == NULL) || batch->cols[i].is_null == NULL)
+	{
+	  goto exit_on_error;
+	}
+    }
+
+  hsidp->batch = batch;
+  return NO_ERROR;
+
+exit_on_error:
+  scan_batch_free (thread_p, batch);
+  return ER_OUT_OF_VIRTUAL_MEMORY;
+}
+
+/*
+ * scan_batch_reset () - Restart the batch reads at the given object
+ *   return:
+ *   batch(in/out):
+ *   oid(in): the reads start after this object
+ */
+static void
+scan_batch_reset (HEAP_SCAN_BATCH * batch, const OID * oid)
+{
+  batch->num_rows = 0;
+  batch->num_selected = 0;
+  batch->sel_pos = 0;
+  batch->is_end = false;
+  COPY_OID (&batch->next_oid, oid);
+}
+
+/*
+ * scan_batch_fill () - Read the next rows of the heap into the batch
+ *   return: S_SUCCESS, S_ERROR
+ *   thread_p(in):
+ *   scan_id(in/out):
+ *   is_decoded(out): are the predicate columns of all the rows decoded?
+ *
+ * Note: The records are copied into the batch area and stay valid until the
+ * next fill. The predicate columns are decoded with the predicate attribute
+ * cache; if a value does not have the type of its column (e.g. the class was
+ * altered), the rows of the batch are left undecoded.
+ */
+static SCAN_CODE
+scan_batch_fill (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, bool * is_decoded)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  HEAP_SCAN_BATCH *batch = hsidp->batch;
+  HEAP_SCAN_BATCH_COL *col;
+  HEAP_CACHE_ATTRINFO *attr_cache = hsidp->pred_attrs.attr_cache;
+  RECDES *recdes;
+  DB_VALUE *value;
+  SCAN_CODE sp_scan;
+  OID oid;
+  char *area;
+  int area_used = 0, area_size, row, c;
+
+  batch->num_rows = 0;
+  batch->num_selected = 0;
+  batch->sel_pos = 0;
+  *is_decoded = true;
+
+  while (batch->num_rows < batch->max_rows)
+    {
+      row = batch->num_rows;
+      recdes = &batch->recdes[row];
+      recdes->data = batch->area + area_used;
+      recdes->area_size = batch->area_size - area_used;
+
+      COPY_OID (&oid, &batch->next_oid);
+      sp_scan = heap_next (thread_p, &hsidp->hfid, &hsidp->cls_oid, &oid, recdes, &hsidp->scan_cache, COPY);
+      if (sp_scan == S_DOESNT_FIT)
+	{
+	  if (row > 0)
+	    {
+	      /* the record goes to the next batch */
+	      break;
+	    }
+
+	  /* the record alone does not fit the area */
+	  assert (recdes->length < 0);
+	  area_size = DB_ALIGN (-recdes->length, MAX_ALIGNMENT);
+	  area = (char *) db_private_realloc (thread_p, batch->area, area_size);
+	  if (area == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) area_size);
+	      return S_ERROR;
+	    }
+	  batch->area = area;
+	  batch->area_size = area_size;
+	  continue;
+	}
+      else if (sp_scan == S_END)
+	{
+	  batch->is_end = true;
+	  break;
+	}
+      else if (sp_scan != S_SUCCESS)
+	{
+	  return S_ERROR;
+	}
+
+      COPY_OID (&batch->next_oid, &oid);
+      COPY_OID (&batch->oids[row], &oid);
+      area_used += DB_ALIGN (recdes->length, MAX_ALIGNMENT);
+      batch->num_rows++;
+
+      if (*is_decoded == false)
+	{
+	  continue;
+	}
+
+      if (heap_attrinfo_read_dbvalues (thread_p, &oid, recdes, &hsidp->scan_cache, attr_cache) != NO_ERROR)
+	{
+	  return S_ERROR;
+	}
+      for (c = 0; c < batch->num_cols; c++)
+	{
+	  col = &batch->cols[c];
+	  value = heap_attrinfo_access (col->attr_id, attr_cache);
+	  if (value == NULL || (!DB_IS_NULL (value) && DB_VALUE_DOMAIN_TYPE (value) != col->type))
+	    {
+	      *is_decoded = false;
+	      break;
+	    }
+
+	  col->is_null[row] = DB_IS_NULL (value) ? 1 : 0;
+	  if (!col->is_null[row])
+	    {
+	      scan_batch_get_value (value, (col->i64 != NULL) ? &col->i64[row] : NULL,
+				    (col->dbl != NULL) ? &col->dbl[row] : NULL);
+	    }
+	}
+    }
+
+  if (batch->num_rows == 0)
+    {
+      assert (batch->is_end);
+    }
+
+  return S_SUCCESS;
+}
+
+/* keep the rows of the selection vector for which cond is true; r is the row of the batch */
+#define SCAN_BATCH_SELECT(cond) \
+  do \
+    { \
+      for (i = 0, k = 0; i < n; i++) \
+	{ \
+	  r = sel[i]; \
+	  sel[k] = r; \
+	  k += (cond) ? 1 : 0; \
+	} \
+      n = k; \
+    } \
+  while (0)
+
+#define SCAN_BATCH_COMPARE(values, constant) \
+  do \
+    { \
+      switch (term->rel_op) \
+	{ \
+	case R_EQ: \
+	  SCAN_BATCH_SELECT ((values)[r] == (constant)); \
+	  break; \
+	case R_NE: \
+	  SCAN_BATCH_SELECT ((values)[r] != (constant)); \
+	  break; \
+	case R_GT: \
+	  SCAN_BATCH_SELECT ((values)[r] > (constant)); \
+	  break; \
+	case R_GE: \
+	  SCAN_BATCH_SELECT ((values)[r] >= (constant)); \
+	  break; \
+	case R_LT: \
+	  SCAN_BATCH_SELECT ((values)[r] < (constant)); \
+	  break; \
+	case R_LE: \
+	  SCAN_BATCH_SELECT ((values)[r] <= (constant)); \
+	  break; \
+	default: \
+	  assert (false); \
+	  break; \
+	} \
+    } \
+  while (0)
+
+#define SCAN_BATCH_IN(values, set, set_size) \
+  do \
+    { \
+      for (i = 0, k = 0; i < n; i++) \
+	{ \
+	  r = sel[i]; \
+	  sel[k] = r; \
+	  for (j = 0, found = 0; j < (set_size); j++) \
+	    { \
+	      found |= ((values)[r] == (set)[j]); \
+	    } \
+	  k += found; \
+	} \
+      n = k; \
+    } \
+  while (0)
+
+/*
+ * scan_batch_filter () - Evaluate the vectorized terms over the rows of the batch
+ *   return:
+ *   batch(in/out): sel and num_selected are set to the rows that pass all the terms
+ *
+ * Note: A row with a NULL in a column of the terms can not pass them. The loops
+ * only compare arrays of fixed width values and let the compiler vectorize them.
+ */
+static void
+scan_batch_filter (HEAP_SCAN_BATCH * batch)
+{
+  HEAP_SCAN_BATCH_TERM *term;
+  HEAP_SCAN_BATCH_COL *col;
+  int *sel = batch->sel;
+  int n = batch->num_rows;
+  int i, j, k, r, t, found;
+  const char *is_null;
+  const INT64 *i64;
+  const double *dbl;
+
+  for (i = 0; i < n; i++)
+    {
+      sel[i] = i;
+    }
+
+  for (t = 0; t < batch->num_terms && n > 0; t++)
+    {
+      term = &batch->terms[t];
+      if (term->is_false)
+	{
+	  n = 0;
+	  break;
+	}
+
+      col = &batch->cols[term->col];
+      is_null = col->is_null;
+      SCAN_BATCH_SELECT (!is_null[r]);
+
+      if (col->type == DB_TYPE_DOUBLE)
+	{
+	  dbl = col->dbl;
+	  if (term->set_size >= 0)
+	    {
+	      SCAN_BATCH_IN (dbl, term->dbl_set, term->set_size);
+	    }
+	  else
+	    {
+	      SCAN_BATCH_COMPARE (dbl, term->dbl);
+	    }
+	}
+      else
+	{
+	  i64 = col->i64;
+	  if (term->set_size >= 0)
+	    {
+	      SCAN_BATCH_IN (i64, term->i64_set, term->set_size);
+	    }
+	  else
+	    {
+	      SCAN_BATCH_COMPARE (i64, term->i64);
+	    }
+	}
+    }
+
+  batch->num_selected = n;
+}
+
+/*
+ * scan_batch_next () - Get the next row of the batch that passed the vectorized terms
+ *   return: S_SUCCESS, S_END, S_ERROR
+ *   thread_p(in):
+ *   scan_id(in/out): curr_oid is set to the row
+ *   recdes(out): record of the row, in the batch area
+ *
+ * Note: The rows that are returned still have to be evaluated with the whole
+ * scan predicate. The rows filtered out by the batch are counted as read rows
+ * of the scan.
+ */
+static SCAN_CODE
+scan_batch_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, RECDES * recdes)
+{
+  HEAP_SCAN_BATCH *batch = scan_id->s.hsid.batch;
+  bool is_decoded;
+  int row;
+
+  while (batch->sel_pos >= batch->num_selected)
+    {
+      if (batch->is_end)
+	{
+	  return S_END;
+	}
+
+      if (scan_batch_fill (thread_p, scan_id, &is_decoded) != S_SUCCESS)
+	{
+	  return S_ERROR;
+	}
+
+      if (is_decoded && scan_id->qualification == QPROC_QUALIFIED)
+	{
+	  scan_batch_filter (batch);
+	}
+      else
+	{
+	  for (row = 0; row < batch->num_rows; row++)
+	    {
+	      batch->sel[row] = row;
+	    }
+	  batch->num_selected = batch->num_rows;
+	}
+
+      scan_id->stats.read_rows += batch->num_rows - batch->num_selected;
+    }
+
+  row = batch->sel[batch->sel_pos++];
+  COPY_OID (&scan_id->s.hsid.curr_oid, &batch->oids[row]);
+  *recdes = batch->recdes[row];
+
+  return S_SUCCESS;
+}
+
 /*
  * scan_next_heap_scan () - The scan is moved to the next heap scan item.
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
@@ -4850,6 +5747,7 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   OID retry_oid;
   LOG_LSA ref_lsa;
   int is_peeking;
+  bool use_batch;
   OBJECT_GET_STATUS object_get_status;
 
   hsidp = &scan_id->s.hsid;
@@ -4872,6 +5770,13 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       is_peeking = PEEK;
     }
 
+  use_batch = (hsidp->batch != NULL && !scan_id->grouped && scan_id->direction == S_FORWARD);
+  if (use_batch)
+    {
+      /* the records are copies in the batch area */
+      is_peeking = COPY;
+    }
+
   while (1)
     {
       COPY_OID (&retry_oid, &hsidp->curr_oid);
@@ -4880,7 +5785,12 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
     restart_scan_oid:
 
       /* get next object */
-      if (scan_id->grouped)
+      if (use_batch)
+	{
+	  /* the rows that can not pass the vectorized terms of the predicate are already skipped */
+	  sp_scan = scan_batch_next (thread_p, scan_id, &recdes);
+	}
+      else if (scan_id->grouped)
 	{
 	  /* grouped, fixed scan */
 	  sp_scan = heap_scanrange_next (thread_p, &hsidp->curr_oid, &recdes, &hsidp->scan_range, is_peeking);
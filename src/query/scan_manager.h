@@ -61,6 +61,49 @@ typedef enum
   S_INDX_NODE_INFO_SCAN		/* scans b-tree nodes for info */
 } SCAN_TYPE;
 
+typedef struct heap_scan_batch_col HEAP_SCAN_BATCH_COL;
+struct heap_scan_batch_col
+{
+  ATTR_ID attr_id;		/* attribute identifier */
+  DB_TYPE type;			/* type of the values; DB_TYPE_DOUBLE goes to dbl, the others to i64 */
+  INT64 *i64;			/* INT, BIGINT, DATE and DATETIME values of the batch rows */
+  double *dbl;			/* DOUBLE values of the batch rows */
+  char *is_null;		/* null flags of the batch rows */
+};				/* Column of a heap scan batch */
+
+typedef struct heap_scan_batch_term HEAP_SCAN_BATCH_TERM;
+struct heap_scan_batch_term
+{
+  int col;			/* index of the column in the batch */
+  REL_OP rel_op;		/* R_EQ .. R_LE; R_EQ with set_size >= 0 is an IN list */
+  bool is_false;		/* the term is never true (e.g. compared with NULL) */
+  INT64 i64;			/* constant operand */
+  double dbl;
+  int set_size;			/* number of IN list constants, -1 for comparisons */
+  INT64 *i64_set;		/* IN list constants */
+  double *dbl_set;
+};				/* Conjunct of the scan predicate evaluated over a whole batch */
+
+typedef struct heap_scan_batch HEAP_SCAN_BATCH;
+struct heap_scan_batch
+{
+  int max_rows;			/* capacity of the batch in rows */
+  int num_rows;			/* rows read into the batch */
+  int num_selected;		/* rows left in the selection vector */
+  int sel_pos;			/* next entry of the selection vector to return */
+  bool is_end;			/* the heap has no more rows after this batch */
+  OID next_oid;			/* heap cursor of the batch reads */
+  OID *oids;			/* object identifiers of the batch rows */
+  RECDES *recdes;		/* records of the batch rows, copied into area */
+  int *sel;			/* selection vector */
+  char *area;			/* record copies */
+  int area_size;
+  HEAP_SCAN_BATCH_COL *cols;	/* decoded predicate columns */
+  int num_cols;
+  HEAP_SCAN_BATCH_TERM *terms;	/* vectorized conjuncts */
+  int num_terms;
+};				/* Rows read by a heap scan in one go and filtered column by column */
+
 typedef struct heap_scan_id HEAP_SCAN_ID;
 struct heap_scan_id
 {
@@ -78,6 +121,8 @@ struct heap_scan_id
   bool scanrange_inited;
   DB_VALUE **cache_recordinfo;	/* cache for record information */
   REGU_VARIABLE_LIST recordinfo_regu_list;	/* regulator variable list for record info */
+  HEAP_PARALLEL_SCAN *px_scan;	/* page cursor of a parallel heap scan; scan blocks are taken from it */
+  HEAP_SCAN_BATCH *batch;	/* batch of vectorized predicate evaluation, NULL if not used */
 };				/* Regular Heap File Scan Identifier */
 
 typedef struct heap_page_scan_id HEAP_PAGE_SCAN_ID;
@@ -446,6 +491,7 @@ extern int scan_open_method_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 				  VAL_LIST * val_list, VAL_DESCR * vd,
 				  /* */
 				  QFILE_LIST_ID * list_id, METHOD_SIG_LIST * meth_sig_list);
+extern void scan_set_parallel_heap_scan (SCAN_ID * scan_id, HEAP_PARALLEL_SCAN * px_scan);
 extern int scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern SCAN_CODE scan_reset_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern SCAN_CODE scan_next_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
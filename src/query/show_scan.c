@@ -218,6 +218,18 @@ showstmt_scan_init (void)
   req->next_func = showstmt_array_next_scan;
   req->end_func = showstmt_array_end_scan;
 
+  req = &show_Requests[SHOWSTMT_STATEMENT_CACHE];
+  req->show_type = SHOWSTMT_STATEMENT_CACHE;
+  req->start_func = qexec_xasl_cache_start_scan;
+  req->next_func = showstmt_array_next_scan;
+  req->end_func = showstmt_array_end_scan;
+
+  req = &show_Requests[SHOWSTMT_CONTENTION_STATISTICS];
+  req->show_type = SHOWSTMT_CONTENTION_STATISTICS;
+  req->start_func = sync_profile_start_scan;
+  req->next_func = showstmt_array_next_scan;
+  req->end_func = showstmt_array_end_scan;
+
   /* append to init other show statement scan function here */
 
 
@@ -3523,6 +3523,8 @@ xts_process_ls_merge_info (char *ptr, const QFILE_LIST_MERGE_INFO * qfile_list_m
 
   ptr = or_pack_int (ptr, qfile_list_merge_info->join_type);
 
+  ptr = or_pack_int (ptr, qfile_list_merge_info->join_method);
+
   ptr = or_pack_int (ptr, qfile_list_merge_info->single_fetch);
 
   ptr = or_pack_int (ptr, qfile_list_merge_info->ls_column_cnt);
@@ -5898,6 +5900,7 @@ xts_sizeof_ls_merge_info (const QFILE_LIST_MERGE_INFO * qfile_list_merge_info)
   int size = 0;
 
   size += (OR_INT_SIZE		/* join_type */
+	   + OR_INT_SIZE	/* join_method */
 	   + OR_INT_SIZE	/* single_fetch */
 	   + OR_INT_SIZE	/* ls_column_cnt */
 	   + PTR_SIZE		/* ls_outer_column */
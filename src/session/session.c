@@ -99,6 +99,26 @@ struct prepared_statement
   char *info;
   PREPARED_STATEMENT *next;
 };
+
+/* A prepared statement shared by all sessions. A session which prepares the same statement text binds to it instead
+ * of compiling the statement again. */
+typedef struct shared_prepared_statement SHARED_PREPARED_STATEMENT;
+struct shared_prepared_statement
+{
+  char *key;			/* "<parse flags>|<user OID>|<normalized statement text>" */
+  char *alias_print;
+  int info_length;
+  char *info;
+};
+
+typedef struct shared_statements SHARED_STATEMENTS;
+struct shared_statements
+{
+  MHT_TABLE *table;		/* shared prepared statements by key; LRU ordered */
+  int max_count;		/* max number of shared prepared statements */
+  unsigned int schema_version;	/* increased on every schema change */
+  pthread_mutex_t mutex;
+};
 typedef struct session_query_entry SESSION_QUERY_ENTRY;
 struct session_query_entry
 {
@@ -173,6 +193,12 @@ static ACTIVE_SESSIONS sessions = { LF_HASH_TABLE_INITIALIZER, LF_FREELIST_INITI
 
 static int session_check_timeout (SESSION_STATE * session_p, SESSION_TIMEOUT_INFO * timeout_info, bool * remove);
 
+/* the prepared statements shared by sessions */
+static SHARED_STATEMENTS shared_Statements;
+
+static char *session_make_shared_statement_key (const OID * user, int parse_flags, const char *sql_text);
+static int session_free_shared_statement (const void *key, void *data, void *args);
+
 static void session_free_prepared_statement (PREPARED_STATEMENT * stmt_p);
 
 static int session_add_variable (SESSION_STATE * state_p, const DB_VALUE * name, DB_VALUE * value);
@@ -513,6 +539,23 @@ session_states_init (THREAD_ENTRY * thread_p)
       return ret;
     }
 
+  /* shared prepared statements; there is no use keeping more of them than XASL cache entries */
+  pthread_mutex_init (&shared_Statements.mutex, NULL);
+  shared_Statements.schema_version = 0;
+  shared_Statements.max_count = prm_get_integer_value (PRM_ID_XASL_MAX_PLAN_CACHE_ENTRIES);
+  shared_Statements.table = NULL;
+  if (shared_Statements.max_count > 0)
+    {
+      shared_Statements.table =
+	mht_create ("Shared prepared statements", shared_Statements.max_count, mht_5strhash,
+		    mht_compare_strings_are_equal);
+      if (shared_Statements.table == NULL)
+	{
+	  return ER_FAILED;
+	}
+      shared_Statements.table->build_lru_list = true;
+    }
+
   /* all ok */
   return NO_ERROR;
 }
@@ -543,6 +586,14 @@ session_states_finalize (THREAD_ENTRY * thread_p)
   /* destroy hash and freelist */
   lf_hash_destroy (&sessions.sessions_table);
   lf_freelist_destroy (&sessions.session_table_freelist);
+
+  if (shared_Statements.table != NULL)
+    {
+      (void) mht_map (shared_Statements.table, session_free_shared_statement, NULL);
+      mht_destroy (shared_Statements.table);
+      shared_Statements.table = NULL;
+    }
+  pthread_mutex_destroy (&shared_Statements.mutex);
 }
 
 /*
@@ -1849,6 +1900,327 @@ session_delete_prepared_statement (THREAD_ENTRY * thread_p, const char *name)
   return NO_ERROR;
 }
 
+/*
+ * session_make_shared_statement_key () - make the key of a shared prepared
+ *					  statement
+ * return : the key allocated with malloc or NULL
+ * user (in)	     : OID of the user who prepares the statement
+ * parse_flags (in)  : client settings which change the compiled statement
+ * sql_text (in)     : normalized statement text
+ */
+static char *
+session_make_shared_statement_key (const OID * user, int parse_flags, const char *sql_text)
+{
+  char prefix[64];
+  char *key = NULL;
+  int prefix_len;
+  size_t key_len;
+
+  prefix_len = snprintf (prefix, sizeof (prefix), "%d|%d|%d|%d|", parse_flags, user->volid, user->pageid,
+			 user->slotid);
+  key_len = prefix_len + strlen (sql_text) + 1;
+
+  key = (char *) malloc (key_len);
+  if (key == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, key_len);
+      return NULL;
+    }
+  memcpy (key, prefix, prefix_len);
+  strcpy (key + prefix_len, sql_text);
+
+  return key;
+}
+
+/*
+ * session_free_shared_statement () - free a shared prepared statement
+ * return : NO_ERROR
+ * key (in)  : not used
+ * data (in) : shared prepared statement
+ * args (in) : not used
+ */
+static int
+session_free_shared_statement (const void *key, void *data, void *args)
+{
+  SHARED_PREPARED_STATEMENT *shared_p = (SHARED_PREPARED_STATEMENT *) data;
+
+  if (shared_p == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  if (shared_p->key != NULL)
+    {
+      free_and_init (shared_p->key);
+    }
+  if (shared_p->alias_print != NULL)
+    {
+      free_and_init (shared_p->alias_print);
+    }
+  if (shared_p->info != NULL)
+    {
+      free_and_init (shared_p->info);
+    }
+  free_and_init (shared_p);
+
+  return NO_ERROR;
+}
+
+/*
+ * session_share_prepared_statement () - make a prepared statement available
+ *					 to all sessions
+ * return : NO_ERROR or error code
+ * thread_p (in)       :
+ * user (in)	       : OID of the user who prepared this statement
+ * sql_text (in)       : normalized statement text
+ * parse_flags (in)    : client settings which change the compiled statement
+ * schema_version (in) : schema version read before the statement was compiled
+ * alias_print (in)    : the printed compiled statement
+ * info (in)	       : serialized prepared statement info
+ * info_len (in)       : serialized buffer length
+ *
+ * Note: The arguments are copied. The statement is not shared if the schema
+ * was changed after schema_version was read; it may be compiled with the old
+ * schema. When the registry is full, the least recently used statement is
+ * removed.
+ */
+int
+session_share_prepared_statement (THREAD_ENTRY * thread_p, OID user, const char *sql_text, int parse_flags,
+				  unsigned int schema_version, const char *alias_print, const char *info, int info_len)
+{
+  SHARED_PREPARED_STATEMENT *shared_p = NULL, *victim_p = NULL;
+  int err = NO_ERROR;
+  int rv;
+
+  if (shared_Statements.table == NULL || sql_text == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  shared_p = (SHARED_PREPARED_STATEMENT *) calloc (1, sizeof (SHARED_PREPARED_STATEMENT));
+  if (shared_p == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (SHARED_PREPARED_STATEMENT));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  shared_p->key = session_make_shared_statement_key (&user, parse_flags, sql_text);
+  if (shared_p->key == NULL)
+    {
+      err = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto exit;
+    }
+
+  if (alias_print != NULL)
+    {
+      shared_p->alias_print = strdup (alias_print);
+      if (shared_p->alias_print == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, strlen (alias_print) + 1);
+	  err = ER_OUT_OF_VIRTUAL_MEMORY;
+	  goto exit;
+	}
+    }
+
+  if (info_len > 0)
+    {
+      shared_p->info = (char *) malloc (info_len);
+      if (shared_p->info == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) info_len);
+	  err = ER_OUT_OF_VIRTUAL_MEMORY;
+	  goto exit;
+	}
+      memcpy (shared_p->info, info, info_len);
+    }
+  shared_p->info_length = info_len;
+
+  rv = pthread_mutex_lock (&shared_Statements.mutex);
+
+  if (schema_version != shared_Statements.schema_version
+      || mht_get2 (shared_Statements.table, shared_p->key, NULL) != NULL)
+    {
+      /* compiled with an old schema, or another session shared the statement first */
+      pthread_mutex_unlock (&shared_Statements.mutex);
+      goto exit;
+    }
+
+  if ((int) mht_count (shared_Statements.table) >= shared_Statements.max_count)
+    {
+      victim_p = (SHARED_PREPARED_STATEMENT *) shared_Statements.table->lru_head->data;
+      (void) mht_rem (shared_Statements.table, victim_p->key, NULL, NULL);
+      (void) session_free_shared_statement (NULL, victim_p, NULL);
+    }
+
+  if (mht_put (shared_Statements.table, shared_p->key, shared_p) == NULL)
+    {
+      pthread_mutex_unlock (&shared_Statements.mutex);
+      err = ER_FAILED;
+      goto exit;
+    }
+
+  pthread_mutex_unlock (&shared_Statements.mutex);
+
+  return NO_ERROR;
+
+exit:
+  (void) session_free_shared_statement (NULL, shared_p, NULL);
+
+  return err;
+}
+
+/*
+ * session_bind_shared_prepared_statement () - create a prepared statement
+ *					       from the shared one
+ * return : NO_ERROR or error code
+ * thread_p (in)	:
+ * user (in)		: OID of the user who prepares the statement
+ * name (in)		: the name of the statement
+ * sql_text (in)	: normalized statement text
+ * parse_flags (in)	: client settings which change the compiled statement
+ * found (out)		: true if the statement was created from a shared one
+ * schema_version (out) : current schema version; pass it to
+ *			  session_share_prepared_statement if not found
+ *
+ * Note: The statement is added to the prepared statements of the session as
+ * if it was compiled by the client.
+ */
+int
+session_bind_shared_prepared_statement (THREAD_ENTRY * thread_p, OID user, const char *name, const char *sql_text,
+					int parse_flags, bool * found, unsigned int *schema_version)
+{
+  SHARED_PREPARED_STATEMENT *shared_p = NULL;
+  char *key = NULL, *local_name = NULL, *alias_print = NULL, *info = NULL;
+  int info_len = 0;
+  int err = NO_ERROR;
+  int rv;
+
+  *found = false;
+  *schema_version = 0;
+
+  if (shared_Statements.table == NULL || name == NULL || sql_text == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  key = session_make_shared_statement_key (&user, parse_flags, sql_text);
+  if (key == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  rv = pthread_mutex_lock (&shared_Statements.mutex);
+
+  *schema_version = shared_Statements.schema_version;
+  shared_p = (SHARED_PREPARED_STATEMENT *) mht_get (shared_Statements.table, key);
+  if (shared_p != NULL)
+    {
+      /* copy while holding the mutex; the statement may be removed right after */
+      if (shared_p->alias_print != NULL)
+	{
+	  alias_print = strdup (shared_p->alias_print);
+	  if (alias_print == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, strlen (shared_p->alias_print) + 1);
+	      err = ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	}
+      if (err == NO_ERROR && shared_p->info_length > 0)
+	{
+	  info = (char *) malloc (shared_p->info_length);
+	  if (info == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) shared_p->info_length);
+	      err = ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	  else
+	    {
+	      memcpy (info, shared_p->info, shared_p->info_length);
+	      info_len = shared_p->info_length;
+	    }
+	}
+    }
+
+  pthread_mutex_unlock (&shared_Statements.mutex);
+
+  free_and_init (key);
+
+  if (err != NO_ERROR)
+    {
+      goto error;
+    }
+  if (shared_p == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  local_name = strdup (name);
+  if (local_name == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, strlen (name) + 1);
+      err = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto error;
+    }
+
+  err = session_create_prepared_statement (thread_p, user, local_name, alias_print, info, info_len);
+  if (err != NO_ERROR)
+    {
+      goto error;
+    }
+
+  *found = true;
+
+  return NO_ERROR;
+
+error:
+  if (local_name != NULL)
+    {
+      free_and_init (local_name);
+    }
+  if (alias_print != NULL)
+    {
+      free_and_init (alias_print);
+    }
+  if (info != NULL)
+    {
+      free_and_init (info);
+    }
+
+  return err;
+}
+
+/*
+ * session_invalidate_shared_statements () - remove all shared prepared
+ *					     statements on a schema or
+ *					     authorization change
+ * return : void
+ * thread_p (in) :
+ *
+ * Note: The schema version is increased too, so the statements which are
+ * being compiled with the old schema are not shared afterwards.
+ */
+void
+session_invalidate_shared_statements (THREAD_ENTRY * thread_p)
+{
+  int rv;
+
+  if (shared_Statements.table == NULL)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&shared_Statements.mutex);
+
+  shared_Statements.schema_version++;
+  if (mht_count (shared_Statements.table) > 0)
+    {
+      (void) mht_map (shared_Statements.table, session_free_shared_statement, NULL);
+      (void) mht_clear (shared_Statements.table, NULL, NULL);
+    }
+
+  pthread_mutex_unlock (&shared_Statements.mutex);
+}
+
 /*
  * login_user () - login user
  * return	  : error code
@@ -49,6 +49,13 @@ extern int session_create_prepared_statement (THREAD_ENTRY * thread_p, OID user,
 extern int session_get_prepared_statement (THREAD_ENTRY * thread_p, const char *name, char **info, int *info_len,
 					   XASL_CACHE_ENTRY ** xasl_entry);
 extern int session_delete_prepared_statement (THREAD_ENTRY * thread_p, const char *name);
+extern int session_share_prepared_statement (THREAD_ENTRY * thread_p, OID user, const char *sql_text,
+					     int parse_flags, unsigned int schema_version, const char *alias_print,
+					     const char *info, int info_len);
+extern int session_bind_shared_prepared_statement (THREAD_ENTRY * thread_p, OID user, const char *name,
+						   const char *sql_text, int parse_flags, bool * found,
+						   unsigned int *schema_version);
+extern void session_invalidate_shared_statements (THREAD_ENTRY * thread_p);
 extern int login_user (THREAD_ENTRY * thread_p, const char *username);
 extern int session_set_session_variables (THREAD_ENTRY * thread_p, DB_VALUE * values, const int count);
 extern int session_get_variable (THREAD_ENTRY * thread_p, const DB_VALUE * name, DB_VALUE * result);
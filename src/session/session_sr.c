@@ -160,21 +160,54 @@ xsession_reset_cur_insert_id (THREAD_ENTRY * thread_p)
  * user (in)		: OID of the user who prepared this statement
  * name (in)		: the name of the statement
  * alias_print(in)	: the printed compiled statement
+ * sql_text (in)	: normalized statement text; NULL if not shared
+ * parse_flags (in)	: client settings which change the compiled statement
+ * schema_version (in)	: schema version read before the statement was
+ *			  compiled
  * info (in)		: serialized prepared statement info
  * info_len (in)	: serialized buffer length
  *
  * Note: This function assumes that the memory for its arguments was
  * dynamically allocated and does not copy the values received. It's important
  * that the caller never frees this memory. If an error occurs, this function
- * will free the memory allocated for its arguments
+ * will free the memory allocated for its arguments. sql_text is not kept.
  */
 int
-xsession_create_prepared_statement (THREAD_ENTRY * thread_p, OID user, char *name, char *alias_print, char *info,
+xsession_create_prepared_statement (THREAD_ENTRY * thread_p, OID user, char *name, char *alias_print,
+				    const char *sql_text, int parse_flags, unsigned int schema_version, char *info,
 				    int info_len)
 {
+  if (sql_text != NULL
+      && session_share_prepared_statement (thread_p, user, sql_text, parse_flags, schema_version, alias_print, info,
+					   info_len) != NO_ERROR)
+    {
+      /* the statement is still prepared for this session */
+      er_clear ();
+    }
+
   return session_create_prepared_statement (thread_p, user, name, alias_print, info, info_len);
 }
 
+/*
+ * xsession_bind_shared_prepared_statement () - create a prepared statement
+ *						from one shared by another
+ *						session
+ * return : NO_ERROR or error code
+ * thread_p (in)	:
+ * user (in)		: OID of the user who prepares the statement
+ * name (in)		: the name of the statement
+ * sql_text (in)	: normalized statement text
+ * parse_flags (in)	: client settings which change the compiled statement
+ * found (out)		: true if the statement was created
+ * schema_version (out) : current schema version
+ */
+int
+xsession_bind_shared_prepared_statement (THREAD_ENTRY * thread_p, OID user, const char *name, const char *sql_text,
+					 int parse_flags, bool * found, unsigned int *schema_version)
+{
+  return session_bind_shared_prepared_statement (thread_p, user, name, sql_text, parse_flags, found, schema_version);
+}
+
 /*
  * xsession_get_prepared_statement () - get the information about a prepared
  *					statement
@@ -106,6 +106,36 @@
 #define FORCE_MERGE_WHEN_EMPTY \
   (MAX (DB_PAGESIZE * 0.66, MAX_MERGE_ALIGN_WASTE * 1.3))
 
+/* Adaptive hash index: maps keys that are often searched to the leaf node they were found in. */
+#define BTREE_AHI_VERSION_COUNT 1024	/* versions of indexes, shared by hashing file identifier */
+#define BTREE_AHI_LOCK_COUNT 64	/* mutexes protecting entries, shared by hashing entry index */
+#define BTREE_AHI_HOT_THRESHOLD 4	/* searches of a key before its leaf node is remembered */
+
+#define BTREE_AHI_VERSION(vfid) \
+  (btree_Ahi.versions[((unsigned int) ((vfid)->fileid ^ ((vfid)->volid << 24))) % BTREE_AHI_VERSION_COUNT])
+
+typedef struct btree_ahi_entry BTREE_AHI_ENTRY;
+struct btree_ahi_entry
+{
+  BTID btid;			/* index of the key */
+  unsigned int key_hash;	/* hash of the key */
+  unsigned int version;		/* version of the index when the leaf node was remembered */
+  VPID leaf_vpid;		/* leaf node where the key was found; null until the key is hot */
+  LOG_LSA leaf_lsa;		/* LSA of the leaf node when the key was found there */
+  int hits;			/* searches of the key; other keys hashed to the entry decrease it to take its place */
+};
+
+typedef struct btree_ahi BTREE_AHI;
+struct btree_ahi
+{
+  BTREE_AHI_ENTRY *entries;	/* hash table of keys; NULL if adaptive hash index is disabled */
+  unsigned int n_entries;	/* size of hash table */
+  /* Incremented when nodes of an index are merged or deallocated. Entries remembered with an older version are not
+   * used any more. */
+  volatile unsigned int versions[BTREE_AHI_VERSION_COUNT];
+  pthread_mutex_t locks[BTREE_AHI_LOCK_COUNT];
+};
+
 /*
  * Page header information related defines
  */
@@ -1150,10 +1180,18 @@ enum btree_rv_debug_id
   BTREE_RV_DEBUG_ID_INS_REM_LEAF_LAST
 };
 
+static BTREE_AHI btree_Ahi;
+
 /*
  * Static functions
  */
 
+static void btree_ahi_invalidate (const VFID * vfid);
+static int btree_ahi_search (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key, unsigned int key_hash,
+			     PAGE_PTR * crt_page, BTREE_SEARCH_KEY_HELPER * search_key, bool * found);
+static void btree_ahi_remember (THREAD_ENTRY * thread_p, BTID_INT * btid_int, unsigned int key_hash,
+				PAGE_PTR leaf_page);
+
 STATIC_INLINE PAGE_PTR btree_fix_root_with_info (THREAD_ENTRY * thread_p, BTID * btid, PGBUF_LATCH_MODE latch_mode,
 						 VPID * root_vpid_p, BTREE_ROOT_HEADER ** root_header_p,
 						 BTID_INT * btid_int_p) __attribute__ ((ALWAYS_INLINE));
@@ -1209,7 +1247,7 @@ static int btree_get_subtree_stats (THREAD_ENTRY * thread_p, BTID_INT * btid, PA
 #endif
 static int btree_get_stats_midxkey (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env, DB_MIDXKEY * midxkey);
 static int btree_get_stats_key (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env, MVCC_SNAPSHOT * mvcc_snapshot);
-static int btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env);
+static int btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env, int sample_leafs);
 static int btree_get_stats_with_fullscan (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env);
 static DISK_ISVALID btree_check_page_key (THREAD_ENTRY * thread_p, const OID * class_oid_p, BTID_INT * btid,
 					  const char *btname, PAGE_PTR page_ptr, VPID * page_vpid);
@@ -4822,6 +4860,7 @@ btree_dealloc_page (THREAD_ENTRY * thread_p, BTID_INT * btid, VPID * vpid)
       return ER_FAILED;
     }
 
+  btree_ahi_invalidate (&btid->sys_btid->vfid);
   error = file_dealloc_page (thread_p, &btid->sys_btid->vfid, vpid, FILE_BTREE);
 
   log_end_system_op (thread_p, LOG_RESULT_TOPOP_COMMIT);
@@ -5635,6 +5674,9 @@ xbtree_delete_index (THREAD_ENTRY * thread_p, BTID * btid)
 
   unique_pk = root_header->unique_pk;
 
+  /* leaf nodes of the index must not be used any more */
+  btree_ahi_invalidate (&btid->vfid);
+
   if (unique_pk)
     {
       /* mark the statistics associated with deleted B-tree as deleted */
@@ -6722,15 +6764,22 @@ exit_on_error:
  * btree_get_stats_with_AR_sampling () - Do Acceptance/Rejection Sampling
  *   return: NO_ERROR
  *   env(in/out): Structure to store and return the statistical information
+ *   sample_leafs(in): number of leaf pages to sample
+ *
+ * Note: Every key of the index lives in exactly one leaf, so the number of keys scales with the number of leaves.
+ *       A partial key-value usually spans several leaves though; counting it once per sampled leaf and scaling
+ *       that would overestimate it by up to the number of leaves. The partial keys are rather estimated from the
+ *       rate at which their value changes between two adjacent keys of a sampled leaf.
  */
 static int
-btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env)
+btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env, int sample_leafs)
 {
   BTREE_SCAN *BTS;
   int n, i;
   bool found;
   int key_cnt;
-  int exp_ratio;
+  int n_trials, n_runs, prev_keys;
+  double exp_ratio, est_keys, n_pairs, est_pkeys;
   int ret = NO_ERROR;
 #if !defined(NDEBUG)
   BTREE_NODE_HEADER *header = NULL;
@@ -6742,9 +6791,13 @@ btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env
   BTS = &(env->btree_scan);
   BTS->use_desc_index = 0;	/* init */
 
-  for (n = 0; n < STATS_SAMPLING_THRESHOLD; n++)
+  /* keep the ratio of trials to samples of the default sampling */
+  n_trials = (int) MIN ((INT64) sample_leafs * STATS_SAMPLING_THRESHOLD / STATS_SAMPLING_LEAFS_MAX, INT_MAX);
+  n_runs = 0;
+
+  for (n = 0; n < n_trials; n++)
     {
-      if (env->stat_info->leafs >= STATS_SAMPLING_LEAFS_MAX)
+      if (env->stat_info->leafs >= sample_leafs)
 	{
 	  break;		/* found all samples */
 	}
@@ -6778,6 +6831,14 @@ btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env
 
 	      assert_release (BTS->slot_id <= key_cnt);
 
+	      /* the first key of the leaf always starts a new run of every partial key-value */
+	      for (i = 0; i < env->pkeys_val_num; i++)
+		{
+		  pr_clear_value (&(env->pkeys_val[i]));
+		  DB_MAKE_NULL (&(env->pkeys_val[i]));
+		}
+	      prev_keys = env->stat_info->keys;
+
 	      for (i = 0; i < key_cnt; i++)
 		{
 		  ret = btree_get_stats_key (thread_p, env, NULL);
@@ -6793,6 +6854,11 @@ btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env
 		      goto exit_on_error;
 		    }
 		}
+
+	      if (env->stat_info->keys > prev_keys)
+		{
+		  n_runs++;
+		}
 	    }
 	}
 
@@ -6815,28 +6881,27 @@ btree_get_stats_with_AR_sampling (THREAD_ENTRY * thread_p, BTREE_STATS_ENV * env
   /* apply distributed expension */
   if (env->stat_info->leafs > 0)
     {
-      exp_ratio = env->stat_info->pages / env->stat_info->leafs;
+      exp_ratio = (double) env->stat_info->pages / env->stat_info->leafs;
+      est_keys = MIN (env->stat_info->keys * exp_ratio, (double) INT_MAX);
 
-      env->stat_info->leafs *= exp_ratio;
-      if (env->stat_info->leafs < 0)
-	{
-	  env->stat_info->leafs = INT_MAX;
-	}
-
-      env->stat_info->keys *= exp_ratio;
-      if (env->stat_info->keys < 0)
-	{
-	  env->stat_info->keys = INT_MAX;
-	}
+      /* pairs of adjacent keys seen; pkeys[i] - n_runs of them have a different i-th partial key-value */
+      n_pairs = env->stat_info->keys - n_runs;
 
       for (i = 0; i < env->pkeys_val_num; i++)
 	{
-	  env->stat_info->pkeys[i] *= exp_ratio;
-	  if (env->stat_info->pkeys[i] < 0)
-	    {			/* multiply-overflow defence */
-	      env->stat_info->pkeys[i] = INT_MAX;
+	  if (n_pairs > 0)
+	    {
+	      est_pkeys = 1.0 + (env->stat_info->pkeys[i] - n_runs) * (est_keys - 1.0) / n_pairs;
 	    }
+	  else
+	    {
+	      est_pkeys = env->stat_info->pkeys[i] * exp_ratio;
+	    }
+	  env->stat_info->pkeys[i] = (int) MIN (est_pkeys, est_keys);
 	}
+
+      env->stat_info->leafs = (int) MIN (env->stat_info->leafs * exp_ratio, (double) INT_MAX);
+      env->stat_info->keys = (int) est_keys;
     }
 
 end:
@@ -6979,16 +7044,17 @@ btree_get_root_page (THREAD_ENTRY * thread_p, BTID * btid, VPID * root_vpid)
  *   return: NO_ERROR
  *   stat_info_p(in/out): Structure to store and
  *                        return the statistical information
- *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sampling_percent(in): percentage of the leaf pages to sample; STATS_WITH_SAMPLING samples a fixed number of
+ *                         leaves and STATS_WITH_FULLSCAN reads all of them
  *
  * Note: Computes and returns statistical information about B+tree
  * which consist of the number of leaf pages, total number of
  * pages, number of keys and the height of the tree.
  */
 int
-btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, bool with_fullscan)
+btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, int sampling_percent)
 {
-  int npages;
+  int npages, sample_leafs;
   BTREE_STATS_ENV stat_env, *env;
   VPID root_vpid;
   PAGE_PTR root_page_ptr = NULL;
@@ -7009,7 +7075,7 @@ btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, bool with_f
 
   /* For the optimization of the sampling, if the btree file has currently the same pages as we gathered statistics, we 
    * guess the btree file has not been modified; So, we take current stats as it is */
-  if (!with_fullscan)
+  if (sampling_percent == STATS_WITH_SAMPLING)
     {
       /* check if the stats has been gathered */
       if (stat_info_p->keys > 0)
@@ -7101,14 +7167,20 @@ btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, bool with_f
       env->stat_info->pkeys[i] = 0;	/* clear old stats */
     }
 
-  if (with_fullscan || npages <= STATS_SAMPLING_THRESHOLD)
+  sample_leafs = STATS_SAMPLING_LEAFS_MAX;
+  if (sampling_percent > STATS_WITH_SAMPLING)
     {
-      /* do fullscan at small table */
+      sample_leafs = MAX (sample_leafs, (int) ((INT64) npages * MIN (sampling_percent, 100) / 100));
+    }
+
+  if (STATS_IS_FULLSCAN (sampling_percent) || npages <= STATS_SAMPLING_THRESHOLD || sample_leafs >= npages / 2)
+    {
+      /* do fullscan at small table, or when random descents would cost more than reading all the leaves */
       ret = btree_get_stats_with_fullscan (thread_p, env);
     }
   else
     {
-      ret = btree_get_stats_with_AR_sampling (thread_p, env);
+      ret = btree_get_stats_with_AR_sampling (thread_p, env, sample_leafs);
     }
 
   if (ret != NO_ERROR)
@@ -18020,6 +18092,7 @@ btree_rv_newpage_undo_alloc (THREAD_ENTRY * thread_p, LOG_RCV * recv)
 
   pageid_struct = (PAGEID_STRUCT *) recv->data;
 
+  btree_ahi_invalidate (&pageid_struct->vfid);
   ret = file_dealloc_page (thread_p, &pageid_struct->vfid, &pageid_struct->vpid, FILE_BTREE);
 
   assert (ret == NO_ERROR);
@@ -22865,6 +22938,247 @@ error:
   return ER_GENERIC_ERROR;
 }
 
+/*
+ * btree_ahi_initialize () - Initialize the adaptive hash index.
+ *
+ * return : Error code.
+ *
+ * Note: The adaptive hash index remembers the leaf nodes where keys which are often searched were found, and lets
+ *	 later searches of these keys skip the non-leaf levels. It is disabled if btree_adaptive_hash_index_entries is 0.
+ */
+int
+btree_ahi_initialize (void)
+{
+  int n_entries;
+  int i;
+
+  btree_ahi_finalize ();
+
+  for (i = 0; i < BTREE_AHI_VERSION_COUNT; i++)
+    {
+      btree_Ahi.versions[i] = 0;
+    }
+
+  n_entries = prm_get_integer_value (PRM_ID_BT_ADAPTIVE_HASH_INDEX_ENTRIES);
+  if (n_entries <= 0)
+    {
+      /* Disabled. */
+      return NO_ERROR;
+    }
+
+  btree_Ahi.entries = (BTREE_AHI_ENTRY *) malloc (n_entries * sizeof (BTREE_AHI_ENTRY));
+  if (btree_Ahi.entries == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, n_entries * sizeof (BTREE_AHI_ENTRY));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  for (i = 0; i < n_entries; i++)
+    {
+      BTID_SET_NULL (&btree_Ahi.entries[i].btid);
+      btree_Ahi.entries[i].key_hash = 0;
+      btree_Ahi.entries[i].version = 0;
+      VPID_SET_NULL (&btree_Ahi.entries[i].leaf_vpid);
+      LSA_SET_NULL (&btree_Ahi.entries[i].leaf_lsa);
+      btree_Ahi.entries[i].hits = 0;
+    }
+  for (i = 0; i < BTREE_AHI_LOCK_COUNT; i++)
+    {
+      pthread_mutex_init (&btree_Ahi.locks[i], NULL);
+    }
+  btree_Ahi.n_entries = n_entries;
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_ahi_finalize () - Free the adaptive hash index.
+ *
+ * return : Void.
+ */
+void
+btree_ahi_finalize (void)
+{
+  int i;
+
+  if (btree_Ahi.entries == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < BTREE_AHI_LOCK_COUNT; i++)
+    {
+      pthread_mutex_destroy (&btree_Ahi.locks[i]);
+    }
+  free_and_init (btree_Ahi.entries);
+  btree_Ahi.n_entries = 0;
+}
+
+/*
+ * btree_ahi_invalidate () - Stop using the leaf nodes remembered for the keys of an index.
+ *
+ * return : Void.
+ * vfid (in) : File of b-tree.
+ *
+ * Note: Must be called when nodes of the index are merged or deallocated, before their latches are released. Other
+ *	 changes of the leaf nodes are detected by their LSA.
+ */
+static void
+btree_ahi_invalidate (const VFID * vfid)
+{
+  if (btree_Ahi.entries == NULL)
+    {
+      return;
+    }
+
+  ATOMIC_INC_32 (&BTREE_AHI_VERSION (vfid), 1);
+}
+
+/*
+ * btree_ahi_search () - Look for key in the leaf node remembered by adaptive hash index.
+ *
+ * return	   : Error code.
+ * thread_p (in)   : Thread entry.
+ * btid_int (in)   : B-tree info.
+ * key (in)	   : Search key value.
+ * key_hash (in)   : Hash of key.
+ * crt_page (in/out) : Root page as input. If key is found, the root page is unfixed and the leaf page is output.
+ * search_key (out) : Search key result.
+ * found (out)	   : Output true if key was found in remembered leaf node.
+ *
+ * Note: The leaf is used only if it was not changed since the key was found in it, and the key is searched again in
+ *	 the page, which also filters out other keys with the same hash. The leaf page is latched conditionally,
+ *	 because the root page is still fixed.
+ */
+static int
+btree_ahi_search (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key, unsigned int key_hash,
+		  PAGE_PTR * crt_page, BTREE_SEARCH_KEY_HELPER * search_key, bool * found)
+{
+  BTREE_AHI_ENTRY *entry;
+  BTREE_NODE_HEADER *node_header;
+  PAGE_PTR leaf_page = NULL;
+  pthread_mutex_t *lock;
+  VPID leaf_vpid;
+  LOG_LSA leaf_lsa;
+  unsigned int index;
+  unsigned int version;
+  int error_code = NO_ERROR;
+
+  assert (btree_Ahi.entries != NULL);
+  assert (crt_page != NULL && *crt_page != NULL);
+
+  *found = false;
+
+  index = key_hash % btree_Ahi.n_entries;
+  entry = &btree_Ahi.entries[index];
+  lock = &btree_Ahi.locks[index % BTREE_AHI_LOCK_COUNT];
+  version = BTREE_AHI_VERSION (&btid_int->sys_btid->vfid);
+
+  pthread_mutex_lock (lock);
+  if (entry->key_hash != key_hash || !BTID_IS_EQUAL (&entry->btid, btid_int->sys_btid)
+      || VPID_ISNULL (&entry->leaf_vpid) || entry->version != version)
+    {
+      pthread_mutex_unlock (lock);
+      return NO_ERROR;
+    }
+  VPID_COPY (&leaf_vpid, &entry->leaf_vpid);
+  LSA_COPY (&leaf_lsa, &entry->leaf_lsa);
+  pthread_mutex_unlock (lock);
+
+  leaf_page = pgbuf_fix (thread_p, &leaf_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+  if (leaf_page == NULL)
+    {
+      /* Leaf is latched exclusively. Traverse the tree. */
+      er_clear ();
+      return NO_ERROR;
+    }
+
+  if (pgbuf_get_page_ptype (thread_p, leaf_page) != PAGE_BTREE || pgbuf_page_has_changed (leaf_page, &leaf_lsa)
+      || BTREE_AHI_VERSION (&btid_int->sys_btid->vfid) != version)
+    {
+      goto miss;
+    }
+  node_header = btree_get_node_header (leaf_page);
+  if (node_header == NULL || node_header->node_level != 1)
+    {
+      goto miss;
+    }
+
+  error_code = btree_search_leaf_page (thread_p, btid_int, leaf_page, key, search_key);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+      return error_code;
+    }
+  if (search_key->result != BTREE_KEY_FOUND || btree_is_fence_key (leaf_page, search_key->slotid))
+    {
+      goto miss;
+    }
+
+  /* Hit. Key is in a leaf that was not changed since the key was found there. */
+  pgbuf_unfix (thread_p, *crt_page);
+  *crt_page = leaf_page;
+  *found = true;
+  return NO_ERROR;
+
+miss:
+  search_key->result = BTREE_KEY_NOTFOUND;
+  search_key->slotid = NULL_SLOTID;
+  pgbuf_unfix_and_init (thread_p, leaf_page);
+  return NO_ERROR;
+}
+
+/*
+ * btree_ahi_remember () - Count a search of key that was found in leaf node and remember the leaf if key is hot.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * btid_int (in) : B-tree info.
+ * key_hash (in) : Hash of key.
+ * leaf_page (in) : Leaf page where key was found (latched).
+ *
+ * Note: Each entry counts the searches of one key. Searches of other keys with the same hash decrease the count, and
+ *	 the key that brings it to zero takes the entry.
+ */
+static void
+btree_ahi_remember (THREAD_ENTRY * thread_p, BTID_INT * btid_int, unsigned int key_hash, PAGE_PTR leaf_page)
+{
+  BTREE_AHI_ENTRY *entry;
+  pthread_mutex_t *lock;
+  unsigned int index;
+
+  assert (btree_Ahi.entries != NULL);
+
+  index = key_hash % btree_Ahi.n_entries;
+  entry = &btree_Ahi.entries[index];
+  lock = &btree_Ahi.locks[index % BTREE_AHI_LOCK_COUNT];
+
+  pthread_mutex_lock (lock);
+  if (entry->key_hash == key_hash && BTID_IS_EQUAL (&entry->btid, btid_int->sys_btid))
+    {
+      if (entry->hits < BTREE_AHI_HOT_THRESHOLD)
+	{
+	  entry->hits++;
+	}
+      if (entry->hits >= BTREE_AHI_HOT_THRESHOLD)
+	{
+	  /* Hot key. Remember its leaf, or refresh the leaf LSA. */
+	  VPID_COPY (&entry->leaf_vpid, pgbuf_get_vpid_ptr (leaf_page));
+	  LSA_COPY (&entry->leaf_lsa, pgbuf_get_lsa (leaf_page));
+	  entry->version = BTREE_AHI_VERSION (&btid_int->sys_btid->vfid);
+	}
+    }
+  else if (--entry->hits <= 0)
+    {
+      BTID_COPY (&entry->btid, btid_int->sys_btid);
+      entry->key_hash = key_hash;
+      VPID_SET_NULL (&entry->leaf_vpid);
+      LSA_SET_NULL (&entry->leaf_lsa);
+      entry->hits = 1;
+    }
+  pthread_mutex_unlock (lock);
+}
+
 /*
  * btree_search_key_and_apply_functions () - B-tree internal function to
  *					     traverse the tree in the
@@ -22907,12 +23221,19 @@ btree_search_key_and_apply_functions (THREAD_ENTRY * thread_p, BTID * btid, BTID
   bool stop = false;		/* Set to true to stop advancing in b-tree. */
   bool restart = false;		/* Set to true to restart b-tree traversal from root. */
   BTREE_SEARCH_KEY_HELPER local_search_key;	/* Store search key result if search key pointer argument is NULL. */
+  bool use_ahi;			/* Set to true if adaptive hash index may be used to skip non-leaf levels. */
+  bool is_ahi_hit = false;	/* Set to true if leaf was found by adaptive hash index. */
+  bool is_root_leaf = false;	/* Set to true if root is also leaf. */
+  unsigned int key_hash = 0;	/* Hash of key for adaptive hash index. */
 
   /* Assert expected arguments. */
   assert (btid != NULL);
   assert (key != NULL);
   assert (advance_function != NULL);
 
+  /* Only plain read-only searches use the adaptive hash index. */
+  use_ahi = (btree_Ahi.entries != NULL && root_function == NULL && advance_function == btree_advance_and_find_key);
+
   if (leaf_page_ptr != NULL)
     {
       /* Initialize leaf_page_ptr as NULL. */
@@ -22978,6 +23299,26 @@ start_btree_traversal:
   /* Root page must be fixed. */
   assert (crt_page != NULL);
 
+  is_root_leaf = is_leaf;
+  if (use_ahi && !is_leaf)
+    {
+      /* Try once to go directly to the leaf. */
+      use_ahi = false;
+      key_hash = mht_valhash (key, UINT_MAX);
+      error_code = btree_ahi_search (thread_p, btid_int, key, key_hash, &crt_page, search_key, &is_ahi_hit);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto error;
+	}
+      is_leaf = is_ahi_hit;
+      if (!is_ahi_hit)
+	{
+	  /* Remember leaf if key is found by traversal. */
+	  use_ahi = true;
+	}
+    }
+
   /* Advance until leaf page is found. */
   while (!is_leaf)
     {
@@ -23026,6 +23367,11 @@ start_btree_traversal:
   assert (crt_page != NULL);
   assert (btree_get_node_header (crt_page) != NULL && btree_get_node_header (crt_page)->node_level == 1);
 
+  if (use_ahi && !is_root_leaf && search_key->result == BTREE_KEY_FOUND)
+    {
+      btree_ahi_remember (thread_p, btid_int, key_hash, crt_page);
+    }
+
   if (key_function != NULL)
     {
       /* Call key_function. */
@@ -540,7 +540,7 @@ extern int btree_get_unique_statistics (THREAD_ENTRY * thread_p, BTID * btid, in
 extern int btree_get_unique_statistics_for_count (THREAD_ENTRY * thread_p, BTID * btid, int *oid_cnt, int *null_cnt,
 						  int *key_cnt);
 
-extern int btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, bool with_fullscan);
+extern int btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, int sampling_percent);
 extern DISK_ISVALID btree_check_tree (THREAD_ENTRY * thread_p, const OID * class_oid_p, BTID * btid,
 				      const char *btname);
 extern DISK_ISVALID btree_check_by_btid (THREAD_ENTRY * thread_p, BTID * btid);
@@ -575,6 +575,10 @@ extern DISK_ISVALID btree_find_key (THREAD_ENTRY * thread_p, BTID * btid, OID *
 /* for migration */
 extern TP_DOMAIN *btree_read_key_type (THREAD_ENTRY * thread_p, BTID * btid);
 
+/* Adaptive hash index */
+extern int btree_ahi_initialize (void);
+extern void btree_ahi_finalize (void);
+
 /* Dump routines */
 extern int btree_dump_capacity (THREAD_ENTRY * thread_p, FILE * fp, BTID * btid);
 extern int btree_dump_capacity_all (THREAD_ENTRY * thread_p, FILE * fp);
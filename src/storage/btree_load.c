@@ -44,6 +44,23 @@
 #include "log_impl.h"
 #include "xserver_interface.h"
 
+#if defined(SERVER_MODE)
+#include "connection_error.h"
+#include "thread.h"
+#include "job_queue.h"
+#endif /* SERVER_MODE */
+
+#if defined(SERVER_MODE)
+/* size of the chunks the keys are extracted to by a parallel load */
+#define BTREE_PX_CHUNK_SIZE (256 * ONE_K)
+/* chunks queued per loader before the helpers wait for the sort */
+#define BTREE_PX_CHUNKS_PER_LOADER 4
+/* every sort item of a chunk is preceded by its length */
+#define BTREE_PX_ITEM_HEADER_SIZE DB_ALIGN (OR_INT_SIZE, MAX_ALIGNMENT)
+
+typedef struct btree_px_load BTREE_PX_LOAD;
+#endif /* SERVER_MODE */
+
 typedef struct sort_args SORT_ARGS;
 struct sort_args
 {				/* Collection of information required for "sr_index_sort" */
@@ -76,7 +93,61 @@ struct sort_args
   FUNCTION_INDEX_INFO *func_index_info;
 
   MVCCID lowest_active_mvccid;
+
+  char *pred_stream;		/* filter predicate, unpacked again by the loaders of a parallel load */
+  int pred_stream_size;
+#if defined(SERVER_MODE)
+  BTREE_PX_LOAD *px;		/* parallel extraction of the keys, or NULL */
+#endif				/* SERVER_MODE */
+};
+
+#if defined(SERVER_MODE)
+typedef struct btree_px_chunk BTREE_PX_CHUNK;
+struct btree_px_chunk
+{				/* Sort items extracted by a loader, in the format of btree_sort_get_next */
+  BTREE_PX_CHUNK *next;
+  char *area;			/* aligned start of the items */
+  int area_size;
+  int length;			/* bytes used by the items */
+  int offset;			/* offset of the next item to be sorted */
+};
+
+typedef struct btree_px_loader BTREE_PX_LOADER;
+struct btree_px_loader
+{				/* One of the threads extracting keys from the heap */
+  BTREE_PX_LOAD *px;
+  SORT_ARGS sort_args;		/* private attribute caches, predicates and counters */
+  FUNCTION_INDEX_INFO func_index_info;
+  void *filter_unpack_info;
+  void *func_unpack_info;
+  HEAP_SCANRANGE scan_range;	/* objects of the current heap page */
+  bool is_scanrange_started;
+  BTREE_PX_CHUNK *chunk;	/* chunk being filled */
+  bool is_done;			/* the heap is exhausted */
+  bool has_er_area;
+  char er_area[1024];		/* error of the helper, see er_get_area_error */
+};
+
+struct btree_px_load
+{
+  HEAP_PARALLEL_SCAN heap_scan;	/* page cursor shared by all the loaders */
+  SORT_ARGS *sort_args;		/* sort arguments of the calling thread */
+  int tran_index;
+  pthread_mutex_t mutex;	/* protects the members below */
+  pthread_cond_t cond;		/* signaled when the queue or a helper changes */
+  int ref_count;		/* calling thread + queued helpers */
+  int num_running;		/* helpers still loading */
+  bool is_closed;		/* no more helpers may start loading */
+  BTREE_PX_LOADER *failed_loader;	/* first helper that failed */
+  BTREE_PX_CHUNK *queue_head;	/* chunks ready to be sorted */
+  BTREE_PX_CHUNK *queue_tail;
+  int queue_length;
+  int max_queue_length;
+  BTREE_PX_CHUNK *cur_chunk;	/* chunk being sorted, owned by the calling thread */
+  int num_loaders;		/* loaders[0] is the calling thread */
+  BTREE_PX_LOADER *loaders;
 };
+#endif /* SERVER_MODE */
 
 typedef struct btree_page BTREE_PAGE;
 struct btree_page
@@ -153,6 +224,19 @@ static int btree_dump_sort_output (const RECDES * recdes, LOAD_ARGS * load_args)
 #endif /* defined(CUBRID_DEBUG) */
 static int btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC * out_func, void *out_args);
 static SORT_STATUS btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg);
+static SORT_STATUS btree_sort_make_record (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, RECDES * temp_recdes,
+					   bool * has_record);
+#if defined(SERVER_MODE)
+static BTREE_PX_LOAD *btree_px_start_load (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args);
+static void btree_px_end_load (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args);
+static void btree_px_release_load (BTREE_PX_LOAD * px);
+static int btree_px_init_loader (THREAD_ENTRY * thread_p, BTREE_PX_LOADER * loader, SORT_ARGS * sort_args);
+static void btree_px_clear_loader (THREAD_ENTRY * thread_p, BTREE_PX_LOADER * loader);
+static int btree_px_load_worker (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
+static int btree_px_load_range (THREAD_ENTRY * thread_p, BTREE_PX_LOADER * loader);
+static void btree_px_queue_chunk (BTREE_PX_LOADER * loader);
+static SORT_STATUS btree_px_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, BTREE_PX_LOAD * px);
+#endif /* SERVER_MODE */
 static int compare_driver (const void *first, const void *second, void *arg);
 static int add_list (BTREE_NODE ** list, VPID * pageid);
 static void remove_first (BTREE_NODE ** list);
@@ -728,6 +812,11 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
   sort_args->fk_refcls_oid = fk_refcls_oid;
   sort_args->fk_refcls_pk_btid = fk_refcls_pk_btid;
   sort_args->fk_name = fk_name;
+  sort_args->pred_stream = pred_stream;
+  sort_args->pred_stream_size = pred_stream_size;
+#if defined(SERVER_MODE)
+  sort_args->px = NULL;
+#endif /* SERVER_MODE */
   if (pred_stream && pred_stream_size > 0)
     {
       if (stx_map_stream_to_filter_pred (thread_p, &filter_pred, pred_stream, pred_stream_size, &buf_info) != NO_ERROR)
@@ -2891,14 +2980,32 @@ exit_on_error:
  * Note: This function supports the initial loading phase of B+tree
  * indices by providing an ordered list of (index-attribute
  * value, object address) pairs. It uses the general sorting
- * facility provided in the "sr" module.
+ * facility provided in the "sr" module. The keys of a big heap may be
+ * extracted by several threads, see btree_px_start_load. The runs are sorted
+ * in parallel by sort_listfile itself, up to sort_parallel_threads.
  */
 static int
 btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC * out_func, void *out_args)
 {
-  return sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* TODO - support parallelism */ ,
-			&btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP,
-			NO_SORT_LIMIT);
+  int error;
+
+#if defined(SERVER_MODE)
+  sort_args->px = btree_px_start_load (thread_p, sort_args);
+#endif /* SERVER_MODE */
+
+  error =
+    sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* unknown number of input pages */ ,
+		   &btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP,
+		   NO_SORT_LIMIT);
+
+#if defined(SERVER_MODE)
+  if (sort_args->px != NULL)
+    {
+      btree_px_end_load (thread_p, sort_args);
+    }
+#endif /* SERVER_MODE */
+
+  return error;
 }
 
 /*
@@ -3038,40 +3145,21 @@ static SORT_STATUS
 btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 {
   SCAN_CODE scan_result;
-  DB_VALUE dbvalue;
-  DB_VALUE *dbvalue_ptr;
-  int key_len;
   OID prev_oid;
   SORT_ARGS *sort_args;
-  OR_BUF buf;
-  int value_has_null;
-  int next_size;
-  int record_size;
-  int oid_size;
-  char midxkey_buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_midxkey_buf;
-  int *prefix_lengthp;
-  int result;
-  MVCC_REC_HEADER mvcc_header = MVCC_REC_HEADER_INITIALIZER;
-  MVCC_SNAPSHOT mvcc_snapshot_dirty;
-  MVCC_SATISFIES_SNAPSHOT_RESULT snapshot_dirty_satisfied;
-
-  DB_MAKE_NULL (&dbvalue);
-
-  aligned_midxkey_buf = PTR_ALIGN (midxkey_buf, MAX_ALIGNMENT);
+  SORT_STATUS status;
+  bool has_record;
 
   sort_args = (SORT_ARGS *) arg;
-  prev_oid = sort_args->cur_oid;
 
-  if (BTREE_IS_UNIQUE (sort_args->unique_pk))
-    {
-      oid_size = 2 * OR_OID_SIZE;
-    }
-  else
+#if defined(SERVER_MODE)
+  if (sort_args->px != NULL)
     {
-      oid_size = OR_OID_SIZE;
+      return btree_px_sort_get_next (thread_p, temp_recdes, sort_args->px);
     }
+#endif /* SERVER_MODE */
 
-  mvcc_snapshot_dirty.snapshot_fnc = mvcc_satisfies_dirty;
+  prev_oid = sort_args->cur_oid;
 
   do
     {				/* Infinite loop */
@@ -3185,266 +3273,329 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
        * Produce the sort item for this object
        */
 
-      /* filter out dead records before any more checks */
-      if (or_mvcc_get_header (&sort_args->in_recdes, &mvcc_header) != NO_ERROR)
+      status = btree_sort_make_record (thread_p, sort_args, temp_recdes, &has_record);
+      if (status == SORT_REC_DOESNT_FIT)
 	{
-	  return SORT_ERROR_OCCURRED;
+	  /* backtrack this iteration */
+	  sort_args->cur_oid = prev_oid;
+	  return SORT_REC_DOESNT_FIT;
 	}
-      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header) && MVCC_GET_DELID (&mvcc_header) < sort_args->lowest_active_mvccid)
+      else if (status != SORT_SUCCESS)
 	{
-	  continue;
+	  return status;
 	}
-      if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header)
-	  && MVCC_GET_INSID (&mvcc_header) < sort_args->lowest_active_mvccid)
+
+      if (has_record)
 	{
-	  /* Insert MVCCID is now visible to everyone. Clear it to avoid unnecessary vacuuming. */
-	  MVCC_CLEAR_FLAG_BITS (&mvcc_header, OR_MVCC_FLAG_VALID_INSID);
+	  return SORT_SUCCESS;
 	}
+    }
+  while (true);
+}
 
-      snapshot_dirty_satisfied = mvcc_snapshot_dirty.snapshot_fnc (thread_p, &mvcc_header, &mvcc_snapshot_dirty);
+/*
+ * btree_sort_make_record () - Produce the sort item of the current object
+ *   return: SORT_STATUS
+ *           (Either of SORT_SUCCESS, SORT_REC_DOESNT_FIT, SORT_ERROR_OCCURRED)
+ *   temp_recdes(in): temporary record descriptor; specifies where to put the
+ *                    sort item.
+ *   sort_args(in): sort arguments; the object is given by cur_oid and
+ *                  in_recdes of the current class.
+ *   has_record(out): false if the object has no sort item (dead, filtered
+ *                    out or null key)
+ *
+ * Note: When the sort item is too big for temp_recdes, its length is set to
+ * the size needed and the caller has to come back with the same object.
+ */
+static SORT_STATUS
+btree_sort_make_record (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, RECDES * temp_recdes, bool * has_record)
+{
+  DB_VALUE dbvalue;
+  DB_VALUE *dbvalue_ptr;
+  int key_len;
+  OR_BUF buf;
+  int value_has_null;
+  int next_size;
+  int record_size;
+  int oid_size;
+  char midxkey_buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_midxkey_buf;
+  int *prefix_lengthp;
+  int result;
+  int cur_class, attr_offset;
+  MVCC_REC_HEADER mvcc_header = MVCC_REC_HEADER_INITIALIZER;
+  MVCC_SNAPSHOT mvcc_snapshot_dirty;
+  MVCC_SATISFIES_SNAPSHOT_RESULT snapshot_dirty_satisfied;
 
-      if (sort_args->filter)
-	{
-	  if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
-					   sort_args->filter->cache_pred) != NO_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
+  *has_record = false;
 
-	  result = (*sort_args->filter_eval_func) (thread_p, sort_args->filter->pred, NULL, &sort_args->cur_oid);
-	  if (result == V_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
-	  else if (result != V_TRUE)
-	    {
-	      continue;
-	    }
-	}
+  DB_MAKE_NULL (&dbvalue);
 
-      if (sort_args->func_index_info && sort_args->func_index_info->expr)
+  aligned_midxkey_buf = PTR_ALIGN (midxkey_buf, MAX_ALIGNMENT);
+
+  if (BTREE_IS_UNIQUE (sort_args->unique_pk))
+    {
+      oid_size = 2 * OR_OID_SIZE;
+    }
+  else
+    {
+      oid_size = OR_OID_SIZE;
+    }
+
+  mvcc_snapshot_dirty.snapshot_fnc = mvcc_satisfies_dirty;
+
+  cur_class = sort_args->cur_class;
+  attr_offset = cur_class * sort_args->n_attrs;
+
+  /* filter out dead records before any more checks */
+  if (or_mvcc_get_header (&sort_args->in_recdes, &mvcc_header) != NO_ERROR)
+    {
+      return SORT_ERROR_OCCURRED;
+    }
+  if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header) && MVCC_GET_DELID (&mvcc_header) < sort_args->lowest_active_mvccid)
+    {
+      return SORT_SUCCESS;
+    }
+  if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header)
+      && MVCC_GET_INSID (&mvcc_header) < sort_args->lowest_active_mvccid)
+    {
+      /* Insert MVCCID is now visible to everyone. Clear it to avoid unnecessary vacuuming. */
+      MVCC_CLEAR_FLAG_BITS (&mvcc_header, OR_MVCC_FLAG_VALID_INSID);
+    }
+
+  snapshot_dirty_satisfied = mvcc_snapshot_dirty.snapshot_fnc (thread_p, &mvcc_header, &mvcc_snapshot_dirty);
+
+  if (sort_args->filter)
+    {
+      if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
+				       sort_args->filter->cache_pred) != NO_ERROR)
 	{
-	  if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
-					   ((FUNC_PRED *) sort_args->func_index_info->expr)->cache_attrinfo) !=
-	      NO_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
+	  return SORT_ERROR_OCCURRED;
 	}
 
-      if (sort_args->n_attrs == 1)
-	{			/* single-column index */
-	  if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
-					   &sort_args->attr_info) != NO_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
+      result = (*sort_args->filter_eval_func) (thread_p, sort_args->filter->pred, NULL, &sort_args->cur_oid);
+      if (result == V_ERROR)
+	{
+	  return SORT_ERROR_OCCURRED;
+	}
+      else if (result != V_TRUE)
+	{
+	  return SORT_SUCCESS;
 	}
+    }
 
-      prefix_lengthp = NULL;
-      if (sort_args->attrs_prefix_length)
+  if (sort_args->func_index_info && sort_args->func_index_info->expr)
+    {
+      if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
+				       ((FUNC_PRED *) sort_args->func_index_info->expr)->cache_attrinfo) != NO_ERROR)
 	{
-	  prefix_lengthp = &(sort_args->attrs_prefix_length[0]);
+	  return SORT_ERROR_OCCURRED;
 	}
+    }
 
-      dbvalue_ptr =
-	heap_attrinfo_generate_key (thread_p, sort_args->n_attrs, &sort_args->attr_ids[attr_offset], prefix_lengthp,
-				    &sort_args->attr_info, &sort_args->in_recdes, &dbvalue, aligned_midxkey_buf,
-				    sort_args->func_index_info);
-      if (dbvalue_ptr == NULL)
+  if (sort_args->n_attrs == 1)
+    {				/* single-column index */
+      if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
+				       &sort_args->attr_info) != NO_ERROR)
 	{
 	  return SORT_ERROR_OCCURRED;
 	}
+    }
+
+  prefix_lengthp = NULL;
+  if (sort_args->attrs_prefix_length)
+    {
+      prefix_lengthp = &(sort_args->attrs_prefix_length[0]);
+    }
+
+  dbvalue_ptr =
+    heap_attrinfo_generate_key (thread_p, sort_args->n_attrs, &sort_args->attr_ids[attr_offset], prefix_lengthp,
+				&sort_args->attr_info, &sort_args->in_recdes, &dbvalue, aligned_midxkey_buf,
+				sort_args->func_index_info);
+  if (dbvalue_ptr == NULL)
+    {
+      return SORT_ERROR_OCCURRED;
+    }
 
-      if (sort_args->fk_refcls_oid && !OID_ISNULL (sort_args->fk_refcls_oid))
+  if (sort_args->fk_refcls_oid && !OID_ISNULL (sort_args->fk_refcls_oid))
+    {
+      if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
 	{
-	  if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+	  if (btree_check_foreign_key (thread_p, &sort_args->class_ids[cur_class], &sort_args->hfids[cur_class],
+				       &sort_args->cur_oid, dbvalue_ptr, sort_args->n_attrs, sort_args->fk_refcls_oid,
+				       sort_args->fk_refcls_pk_btid, sort_args->fk_name) != NO_ERROR)
 	    {
-	      if (btree_check_foreign_key (thread_p, &sort_args->class_ids[cur_class], &sort_args->hfids[cur_class],
-					   &sort_args->cur_oid, dbvalue_ptr, sort_args->n_attrs,
-					   sort_args->fk_refcls_oid, sort_args->fk_refcls_pk_btid,
-					   sort_args->fk_name) != NO_ERROR)
+	      if (dbvalue_ptr == &dbvalue)
 		{
-		  if (dbvalue_ptr == &dbvalue)
-		    {
-		      pr_clear_value (&dbvalue);
-		    }
-		  return SORT_ERROR_OCCURRED;
+		  pr_clear_value (&dbvalue);
 		}
+	      return SORT_ERROR_OCCURRED;
 	    }
 	}
+    }
+
+  value_has_null = 0;		/* init */
+  if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_has_null (dbvalue_ptr))
+    {
+      value_has_null = 1;	/* found null columns */
+    }
 
-      value_has_null = 0;	/* init */
-      if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_has_null (dbvalue_ptr))
+  if (sort_args->not_null_flag && value_has_null && snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+    {
+      if (dbvalue_ptr == &dbvalue)
 	{
-	  value_has_null = 1;	/* found null columns */
+	  pr_clear_value (&dbvalue);
 	}
 
-      if (sort_args->not_null_flag && value_has_null && snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
-	{
-	  if (dbvalue_ptr == &dbvalue)
-	    {
-	      pr_clear_value (&dbvalue);
-	    }
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NOT_NULL_DOES_NOT_ALLOW_NULL_VALUE, 0);
+      return SORT_ERROR_OCCURRED;
+    }
 
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NOT_NULL_DOES_NOT_ALLOW_NULL_VALUE, 0);
-	  return SORT_ERROR_OCCURRED;
+  if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_is_null (dbvalue_ptr))
+    {
+      if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+	{
+	  /* All objects that were not candidates for vacuum are loaded, but statistics should only care for objects
+	   * that have not been deleted and committed at the time of load. */
+	  sort_args->n_oids++;	/* Increment the OID counter */
+	  sort_args->n_nulls++;	/* Increment the NULL counter */
 	}
-
-      if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_is_null (dbvalue_ptr))
+      if (dbvalue_ptr == &dbvalue)
 	{
-	  if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
-	    {
-	      /* All objects that were not candidates for vacuum are loaded, but statistics should only care for
-	       * objects that have not been deleted and committed at the time of load. */
-	      sort_args->n_oids++;	/* Increment the OID counter */
-	      sort_args->n_nulls++;	/* Increment the NULL counter */
-	    }
-	  if (dbvalue_ptr == &dbvalue)
-	    {
-	      pr_clear_value (&dbvalue);
-	    }
-	  if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
-	    {
-	      _er_log_debug (ARG_FILE_LINE,
-			     "DEBUG_BTREE: load sort found null at oid(%d, %d, %d)"
-			     ", class_oid(%d, %d, %d), btid(%d, (%d, %d).", sort_args->cur_oid.volid,
-			     sort_args->cur_oid.pageid, sort_args->cur_oid.slotid,
-			     sort_args->class_ids[sort_args->cur_class].volid,
-			     sort_args->class_ids[sort_args->cur_class].pageid,
-			     sort_args->class_ids[sort_args->cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
-			     sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid);
-	    }
-	  continue;
+	  pr_clear_value (&dbvalue);
 	}
-
-      key_len = pr_data_writeval_disk_size (dbvalue_ptr);
-
-      if (key_len > 0)
+      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
 	{
-	  next_size = sizeof (char *);
-	  record_size = (next_size	/* Pointer to next */
-			 + OR_INT_SIZE	/* Has null */
-			 + oid_size	/* OID, Class OID */
-			 + 2 * OR_MVCCID_SIZE	/* Insert and delete MVCCID */
-			 + key_len	/* Key length */
-			 + (int) MAX_ALIGNMENT /* Alignment */ );
+	  _er_log_debug (ARG_FILE_LINE,
+			 "DEBUG_BTREE: load sort found null at oid(%d, %d, %d)"
+			 ", class_oid(%d, %d, %d), btid(%d, (%d, %d).", sort_args->cur_oid.volid,
+			 sort_args->cur_oid.pageid, sort_args->cur_oid.slotid,
+			 sort_args->class_ids[sort_args->cur_class].volid,
+			 sort_args->class_ids[sort_args->cur_class].pageid,
+			 sort_args->class_ids[sort_args->cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
+			 sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid);
+	}
+      return SORT_SUCCESS;
+    }
 
-	  if (temp_recdes->area_size < record_size)
-	    {
-	      /* 
-	       * Record is too big to fit into temp_recdes area; so
-	       * backtrack this iteration
-	       */
-	      sort_args->cur_oid = prev_oid;
-	      temp_recdes->length = record_size;
-	      goto nofit;
-	    }
+  key_len = pr_data_writeval_disk_size (dbvalue_ptr);
 
-	  assert (PTR_ALIGN (temp_recdes->data, MAX_ALIGNMENT) == temp_recdes->data);
-	  or_init (&buf, temp_recdes->data, 0);
+  if (key_len > 0)
+    {
+      next_size = sizeof (char *);
+      record_size = (next_size	/* Pointer to next */
+		     + OR_INT_SIZE	/* Has null */
+		     + oid_size	/* OID, Class OID */
+		     + 2 * OR_MVCCID_SIZE	/* Insert and delete MVCCID */
+		     + key_len	/* Key length */
+		     + (int) MAX_ALIGNMENT /* Alignment */ );
 
-	  or_pad (&buf, next_size);	/* init as NULL */
+      if (temp_recdes->area_size < record_size)
+	{
+	  /* Record is too big to fit into temp_recdes area */
+	  temp_recdes->length = record_size;
+	  goto nofit;
+	}
 
-	  /* save has_null */
-	  if (or_put_byte (&buf, value_has_null) != NO_ERROR)
-	    {
-	      goto nofit;
-	    }
+      assert (PTR_ALIGN (temp_recdes->data, MAX_ALIGNMENT) == temp_recdes->data);
+      or_init (&buf, temp_recdes->data, 0);
 
-	  or_advance (&buf, (OR_INT_SIZE - OR_BYTE_SIZE));
-	  assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
+      or_pad (&buf, next_size);	/* init as NULL */
 
-	  if (BTREE_IS_UNIQUE (sort_args->unique_pk))
-	    {
-	      if (or_put_oid (&buf, &sort_args->class_ids[cur_class]) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
+      /* save has_null */
+      if (or_put_byte (&buf, value_has_null) != NO_ERROR)
+	{
+	  goto nofit;
+	}
+
+      or_advance (&buf, (OR_INT_SIZE - OR_BYTE_SIZE));
+      assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
 
-	  if (or_put_oid (&buf, &sort_args->cur_oid) != NO_ERROR)
+      if (BTREE_IS_UNIQUE (sort_args->unique_pk))
+	{
+	  if (or_put_oid (&buf, &sort_args->class_ids[cur_class]) != NO_ERROR)
 	    {
 	      goto nofit;
 	    }
+	}
 
-	  /* Pack insert and delete MVCCID's */
-	  if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header))
-	    {
-	      if (or_put_mvccid (&buf, MVCC_GET_INSID (&mvcc_header)) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
-	  else
-	    {
-	      if (or_put_mvccid (&buf, MVCCID_ALL_VISIBLE) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
+      if (or_put_oid (&buf, &sort_args->cur_oid) != NO_ERROR)
+	{
+	  goto nofit;
+	}
 
-	  if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
-	    {
-	      if (or_put_mvccid (&buf, MVCC_GET_DELID (&mvcc_header)) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
-	  else
+      /* Pack insert and delete MVCCID's */
+      if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header))
+	{
+	  if (or_put_mvccid (&buf, MVCC_GET_INSID (&mvcc_header)) != NO_ERROR)
 	    {
-	      if (or_put_mvccid (&buf, MVCCID_NULL) != NO_ERROR)
-		{
-		  goto nofit;
-		}
+	      goto nofit;
 	    }
-
-	  if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
+	}
+      else
+	{
+	  if (or_put_mvccid (&buf, MVCCID_ALL_VISIBLE) != NO_ERROR)
 	    {
-	      _er_log_debug (ARG_FILE_LINE,
-			     "DEBUG_BTREE: load sort found oid(%d, %d, %d)"
-			     ", class_oid(%d, %d, %d), btid(%d, (%d, %d), mvcc_info=%llu | %llu.",
-			     sort_args->cur_oid.volid, sort_args->cur_oid.pageid, sort_args->cur_oid.slotid,
-			     sort_args->class_ids[sort_args->cur_class].volid,
-			     sort_args->class_ids[sort_args->cur_class].pageid,
-			     sort_args->class_ids[sort_args->cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
-			     sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid,
-			     MVCC_IS_FLAG_SET (&mvcc_header,
-					       OR_MVCC_FLAG_VALID_INSID) ? MVCC_GET_INSID (&mvcc_header) :
-			     MVCCID_ALL_VISIBLE, MVCC_IS_FLAG_SET (&mvcc_header,
-								   OR_MVCC_FLAG_VALID_DELID) ?
-			     MVCC_GET_DELID (&mvcc_header) : MVCCID_NULL);
+	      goto nofit;
 	    }
+	}
 
-	  assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
-
-	  if ((*(sort_args->key_type->type->data_writeval)) (&buf, dbvalue_ptr) != NO_ERROR)
+      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+	{
+	  if (or_put_mvccid (&buf, MVCC_GET_DELID (&mvcc_header)) != NO_ERROR)
 	    {
 	      goto nofit;
 	    }
-
-	  temp_recdes->length = CAST_STRLEN (buf.ptr - buf.buffer);
-
-	  if (dbvalue_ptr == &dbvalue)
+	}
+      else
+	{
+	  if (or_put_mvccid (&buf, MVCCID_NULL) != NO_ERROR)
 	    {
-	      pr_clear_value (&dbvalue);
+	      goto nofit;
 	    }
 	}
 
-      if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
 	{
-	  /* All objects that were not candidates for vacuum are loaded, but statistics should only care for objects
-	   * that have not been deleted and committed at the time of load. */
-	  sort_args->n_oids++;	/* Increment the OID counter */
+	  _er_log_debug (ARG_FILE_LINE,
+			 "DEBUG_BTREE: load sort found oid(%d, %d, %d)"
+			 ", class_oid(%d, %d, %d), btid(%d, (%d, %d), mvcc_info=%llu | %llu.",
+			 sort_args->cur_oid.volid, sort_args->cur_oid.pageid, sort_args->cur_oid.slotid,
+			 sort_args->class_ids[sort_args->cur_class].volid,
+			 sort_args->class_ids[sort_args->cur_class].pageid,
+			 sort_args->class_ids[sort_args->cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
+			 sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid,
+			 MVCC_IS_FLAG_SET (&mvcc_header,
+					   OR_MVCC_FLAG_VALID_INSID) ? MVCC_GET_INSID (&mvcc_header) :
+			 MVCCID_ALL_VISIBLE, MVCC_IS_FLAG_SET (&mvcc_header,
+							       OR_MVCC_FLAG_VALID_DELID) ?
+			 MVCC_GET_DELID (&mvcc_header) : MVCCID_NULL);
 	}
 
-      if (key_len > 0)
+      assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
+
+      if ((*(sort_args->key_type->type->data_writeval)) (&buf, dbvalue_ptr) != NO_ERROR)
 	{
-	  return SORT_SUCCESS;
+	  goto nofit;
+	}
+
+      temp_recdes->length = CAST_STRLEN (buf.ptr - buf.buffer);
+
+      if (dbvalue_ptr == &dbvalue)
+	{
+	  pr_clear_value (&dbvalue);
 	}
 
+      *has_record = true;
     }
-  while (true);
+
+  if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+    {
+      /* All objects that were not candidates for vacuum are loaded, but statistics should only care for objects that
+       * have not been deleted and committed at the time of load. */
+      sort_args->n_oids++;	/* Increment the OID counter */
+    }
+
+  return SORT_SUCCESS;
 
 nofit:
 
@@ -3456,6 +3607,698 @@ nofit:
   return SORT_REC_DOESNT_FIT;
 }
 
+#if defined(SERVER_MODE)
+/*
+ * btree_px_start_load () - Start the threads extracting the keys of the
+ *                          index being loaded
+ *   return: parallel load descriptor, or NULL if the keys are extracted
+ *           serially
+ *   thread_p(in):
+ *   sort_args(in): sort arguments
+ *
+ * Note: The pages of the heap are handed out one at a time by a shared page
+ * cursor. Every loader extracts the sort items of its pages with its own
+ * attribute caches and predicates and queues them in chunks, which are
+ * consumed by btree_px_sort_get_next. The calling thread is a loader too, so
+ * the load goes on even if no helper gets a thread.
+ */
+static BTREE_PX_LOAD *
+btree_px_start_load (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args)
+{
+  BTREE_PX_LOAD *px;
+  BTREE_PX_LOADER *loader;
+  CSS_CONN_ENTRY *conn_p;
+  CSS_JOB_ENTRY *job_entry_p;
+  int num_helpers, conn_index, i;
+
+  num_helpers = prm_get_integer_value (PRM_ID_INDEX_BUILD_PARALLEL_THREADS);
+  if (num_helpers <= 0)
+    {
+      return NULL;
+    }
+
+  /* class hierarchies and foreign keys are loaded serially */
+  if (sort_args->n_classes != 1 || HFID_IS_NULL (&sort_args->hfids[0])
+      || (sort_args->fk_refcls_oid != NULL && !OID_ISNULL (sort_args->fk_refcls_oid)))
+    {
+      return NULL;
+    }
+
+  if (file_get_numpages (thread_p, &sort_args->hfids[0].vfid) <
+      prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_MIN_PAGES))
+    {
+      return NULL;
+    }
+
+  /* shared with the helper threads, cannot use the private heap */
+  px = (BTREE_PX_LOAD *) malloc (sizeof (BTREE_PX_LOAD) + (num_helpers + 1) * sizeof (BTREE_PX_LOADER));
+  if (px == NULL)
+    {
+      /* load serially */
+      return NULL;
+    }
+
+  if (heap_parallel_scan_init (&px->heap_scan, &sort_args->hfids[0]) != NO_ERROR)
+    {
+      free_and_init (px);
+      er_clear ();
+      return NULL;
+    }
+
+  px->sort_args = sort_args;
+  px->tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  px->ref_count = 1;
+  px->num_running = 0;
+  px->is_closed = false;
+  px->failed_loader = NULL;
+  px->queue_head = px->queue_tail = NULL;
+  px->queue_length = 0;
+  px->cur_chunk = NULL;
+  px->loaders = (BTREE_PX_LOADER *) (px + 1);
+  px->num_loaders = num_helpers + 1;
+  pthread_mutex_init (&px->mutex, NULL);
+  pthread_cond_init (&px->cond, NULL);
+
+  for (i = 0; i < px->num_loaders; i++)
+    {
+      loader = &px->loaders[i];
+      loader->px = px;
+      loader->sort_args = *sort_args;
+      loader->sort_args.px = NULL;
+      loader->sort_args.filter = NULL;
+      loader->sort_args.filter_eval_func = NULL;
+      loader->sort_args.func_index_info = NULL;
+      loader->sort_args.scancache_inited = 0;
+      loader->sort_args.attrinfo_inited = 0;
+      loader->sort_args.n_oids = 0;
+      loader->sort_args.n_nulls = 0;
+      OID_SET_NULL (&loader->sort_args.cur_oid);
+      loader->filter_unpack_info = NULL;
+      loader->func_unpack_info = NULL;
+      loader->is_scanrange_started = false;
+      loader->chunk = NULL;
+      loader->is_done = false;
+      loader->has_er_area = false;
+    }
+
+  /* the first loader is the calling thread */
+  if (btree_px_init_loader (thread_p, &px->loaders[0], sort_args) != NO_ERROR)
+    {
+      btree_px_clear_loader (thread_p, &px->loaders[0]);
+      btree_px_release_load (px);
+      er_clear ();
+      return NULL;
+    }
+
+  conn_p = thread_get_current_conn_entry ();
+  conn_index = (conn_p) ? conn_p->idx : 0;
+
+  for (i = 1; i < px->num_loaders; i++)
+    {
+      /* explicit job queue index */
+      job_entry_p =
+	css_make_job_entry (conn_p, (CSS_THREAD_FN) btree_px_load_worker, (CSS_THREAD_ARG) & px->loaders[i],
+			    conn_index + i);
+      if (job_entry_p == NULL)
+	{
+	  /* do with the helpers already started */
+	  er_clear ();
+	  break;
+	}
+
+      pthread_mutex_lock (&px->mutex);
+      px->ref_count++;
+      pthread_mutex_unlock (&px->mutex);
+
+      css_add_to_job_queue (job_entry_p);
+    }
+  px->num_loaders = i;
+  px->max_queue_length = BTREE_PX_CHUNKS_PER_LOADER * px->num_loaders;
+
+  return px;
+}
+
+/*
+ * btree_px_end_load () - Stop the helpers of a parallel load and collect
+ *                        their counters
+ *   return:
+ *   thread_p(in):
+ *   sort_args(in/out): sort arguments; gets the number of OIDs and NULLs
+ */
+static void
+btree_px_end_load (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args)
+{
+  BTREE_PX_LOAD *px = sort_args->px;
+  int i;
+
+  /* the sort may have been given up; do not let the helpers read the rest of the heap */
+  heap_parallel_scan_stop (&px->heap_scan);
+
+  pthread_mutex_lock (&px->mutex);
+  px->is_closed = true;
+  pthread_cond_broadcast (&px->cond);
+  while (px->num_running > 0)
+    {
+      pthread_cond_wait (&px->cond, &px->mutex);
+    }
+  pthread_mutex_unlock (&px->mutex);
+
+  btree_px_clear_loader (thread_p, &px->loaders[0]);
+
+  for (i = 0; i < px->num_loaders; i++)
+    {
+      sort_args->n_oids += px->loaders[i].sort_args.n_oids;
+      sort_args->n_nulls += px->loaders[i].sort_args.n_nulls;
+    }
+
+  sort_args->px = NULL;
+  btree_px_release_load (px);
+}
+
+/*
+ * btree_px_release_load () - Release a reference to a parallel load
+ *                            descriptor
+ *   return:
+ *   px(in): parallel load descriptor
+ *
+ * Note: The descriptor is freed by the last of the calling thread and the
+ * helpers that leaves it.
+ */
+static void
+btree_px_release_load (BTREE_PX_LOAD * px)
+{
+  BTREE_PX_CHUNK *chunk;
+  int ref_count, i;
+
+  pthread_mutex_lock (&px->mutex);
+  ref_count = --px->ref_count;
+  pthread_mutex_unlock (&px->mutex);
+
+  if (ref_count > 0)
+    {
+      return;
+    }
+
+  while (px->queue_head != NULL)
+    {
+      chunk = px->queue_head;
+      px->queue_head = chunk->next;
+      free_and_init (chunk);
+    }
+  if (px->cur_chunk != NULL)
+    {
+      free_and_init (px->cur_chunk);
+    }
+  for (i = 0; i < px->num_loaders; i++)
+    {
+      if (px->loaders[i].chunk != NULL)
+	{
+	  free_and_init (px->loaders[i].chunk);
+	}
+    }
+
+  heap_parallel_scan_destroy (&px->heap_scan);
+  pthread_cond_destroy (&px->cond);
+  pthread_mutex_destroy (&px->mutex);
+  free_and_init (px);
+}
+
+/*
+ * btree_px_init_loader () - Prepare a loader for extracting sort items
+ *   return: error code
+ *   thread_p(in): thread of the loader
+ *   loader(in/out): loader
+ *   sort_args(in): sort arguments of the load
+ *
+ * Note: The predicates of filtered and function indexes are unpacked again
+ * for every loader, since their evaluation caches values.
+ */
+static int
+btree_px_init_loader (THREAD_ENTRY * thread_p, BTREE_PX_LOADER * loader, SORT_ARGS * sort_args)
+{
+  SORT_ARGS *loader_args = &loader->sort_args;
+  DB_TYPE single_node_type = DB_TYPE_NULL;
+  int error;
+
+  if (sort_args->filter != NULL)
+    {
+      error =
+	stx_map_stream_to_filter_pred (thread_p, &loader_args->filter, sort_args->pred_stream,
+				       sort_args->pred_stream_size, &loader->filter_unpack_info);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      loader_args->filter_eval_func = eval_fnc (thread_p, loader_args->filter->pred, &single_node_type);
+    }
+
+  if (sort_args->func_index_info != NULL)
+    {
+      loader->func_index_info = *sort_args->func_index_info;
+      loader->func_index_info.expr = NULL;
+      error =
+	stx_map_stream_to_func_pred (thread_p, (FUNC_PRED **) (&loader->func_index_info.expr),
+				     loader->func_index_info.expr_stream, loader->func_index_info.expr_stream_size,
+				     &loader->func_unpack_info);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      loader_args->func_index_info = &loader->func_index_info;
+    }
+
+  error = heap_scanrange_start (thread_p, &loader->scan_range, &loader_args->hfids[0], &loader_args->class_ids[0], NULL);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+  loader->is_scanrange_started = true;
+
+  error =
+    heap_attrinfo_start (thread_p, &loader_args->class_ids[0], loader_args->n_attrs, loader_args->attr_ids,
+			 &loader_args->attr_info);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+  if (loader_args->filter != NULL)
+    {
+      error =
+	heap_attrinfo_start (thread_p, &loader_args->class_ids[0], loader_args->filter->num_attrs_pred,
+			     loader_args->filter->attrids_pred, loader_args->filter->cache_pred);
+      if (error != NO_ERROR)
+	{
+	  heap_attrinfo_end (thread_p, &loader_args->attr_info);
+	  return error;
+	}
+    }
+  if (loader_args->func_index_info != NULL)
+    {
+      error =
+	heap_attrinfo_start (thread_p, &loader_args->class_ids[0], loader_args->n_attrs, loader_args->attr_ids,
+			     ((FUNC_PRED *) loader_args->func_index_info->expr)->cache_attrinfo);
+      if (error != NO_ERROR)
+	{
+	  heap_attrinfo_end (thread_p, &loader_args->attr_info);
+	  if (loader_args->filter != NULL)
+	    {
+	      heap_attrinfo_end (thread_p, loader_args->filter->cache_pred);
+	    }
+	  return error;
+	}
+    }
+  loader_args->attrinfo_inited = 1;
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_px_clear_loader () - Free the resources of a loader
+ *   return:
+ *   thread_p(in): thread of the loader
+ *   loader(in/out): loader
+ */
+static void
+btree_px_clear_loader (THREAD_ENTRY * thread_p, BTREE_PX_LOADER * loader)
+{
+  SORT_ARGS *loader_args = &loader->sort_args;
+
+  if (loader_args->attrinfo_inited)
+    {
+      heap_attrinfo_end (thread_p, &loader_args->attr_info);
+      if (loader_args->filter != NULL)
+	{
+	  heap_attrinfo_end (thread_p, loader_args->filter->cache_pred);
+	}
+      if (loader_args->func_index_info != NULL)
+	{
+	  heap_attrinfo_end (thread_p, ((FUNC_PRED *) loader_args->func_index_info->expr)->cache_attrinfo);
+	}
+      loader_args->attrinfo_inited = 0;
+    }
+
+  if (loader->is_scanrange_started)
+    {
+      heap_scanrange_end (thread_p, &loader->scan_range);
+      loader->is_scanrange_started = false;
+    }
+
+  if (loader_args->filter != NULL)
+    {
+      qexec_clear_pred_context (thread_p, loader_args->filter, true);
+      loader_args->filter = NULL;
+    }
+  if (loader->filter_unpack_info != NULL)
+    {
+      stx_free_additional_buff (thread_p, loader->filter_unpack_info);
+      stx_free_xasl_unpack_info (loader->filter_unpack_info);
+      db_private_free_and_init (thread_p, loader->filter_unpack_info);
+    }
+
+  if (loader_args->func_index_info != NULL && loader_args->func_index_info->expr != NULL)
+    {
+      (void) qexec_clear_func_pred (thread_p, loader_args->func_index_info->expr);
+    }
+  loader_args->func_index_info = NULL;
+  if (loader->func_unpack_info != NULL)
+    {
+      stx_free_additional_buff (thread_p, loader->func_unpack_info);
+      stx_free_xasl_unpack_info (loader->func_unpack_info);
+      db_private_free_and_init (thread_p, loader->func_unpack_info);
+    }
+}
+
+/*
+ * btree_px_load_worker () - Job of a helper of a parallel load
+ *   return: NO_ERROR
+ *   thread_p(in):
+ *   arg(in): loader of the helper
+ */
+static int
+btree_px_load_worker (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg)
+{
+  BTREE_PX_LOADER *loader = (BTREE_PX_LOADER *) arg;
+  BTREE_PX_LOAD *px = loader->px;
+  int error = NO_ERROR;
+  int length;
+  bool is_closed;
+
+  thread_p->tran_index = px->tran_index;
+  pthread_mutex_unlock (&thread_p->tran_index_lock);
+
+  pthread_mutex_lock (&px->mutex);
+  is_closed = px->is_closed;
+  if (!is_closed)
+    {
+      px->num_running++;
+    }
+  pthread_mutex_unlock (&px->mutex);
+
+  if (is_closed)
+    {
+      btree_px_release_load (px);
+      return NO_ERROR;
+    }
+
+  error = btree_px_init_loader (thread_p, loader, px->sort_args);
+  while (error == NO_ERROR && !loader->is_done)
+    {
+      /* do not get too far ahead of the sort */
+      pthread_mutex_lock (&px->mutex);
+      while (px->queue_length >= px->max_queue_length && !px->is_closed)
+	{
+	  pthread_cond_wait (&px->cond, &px->mutex);
+	}
+      is_closed = px->is_closed;
+      pthread_mutex_unlock (&px->mutex);
+
+      if (is_closed)
+	{
+	  break;
+	}
+
+      error = btree_px_load_range (thread_p, loader);
+    }
+
+  if (error != NO_ERROR)
+    {
+      length = sizeof (loader->er_area);
+      loader->has_er_area = (er_get_area_error (loader->er_area, &length) != NULL);
+
+      /* the others need not go on */
+      heap_parallel_scan_stop (&px->heap_scan);
+    }
+
+  btree_px_clear_loader (thread_p, loader);
+
+  pthread_mutex_lock (&px->mutex);
+  if (error != NO_ERROR && px->failed_loader == NULL)
+    {
+      px->failed_loader = loader;
+    }
+  px->num_running--;
+  pthread_cond_broadcast (&px->cond);
+  pthread_mutex_unlock (&px->mutex);
+
+  btree_px_release_load (px);
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_px_load_range () - Extract the sort items of the next heap page of a
+ *                          parallel load
+ *   return: error code
+ *   thread_p(in): thread of the loader
+ *   loader(in/out): loader; is_done is set when the heap is exhausted
+ *
+ * Note: Full chunks are queued for the sort. What is left of the chunk of
+ * the loader is queued when the heap is exhausted.
+ */
+static int
+btree_px_load_range (THREAD_ENTRY * thread_p, BTREE_PX_LOADER * loader)
+{
+  SORT_ARGS *loader_args = &loader->sort_args;
+  BTREE_PX_CHUNK *chunk;
+  RECDES temp_recdes;
+  SCAN_CODE scan;
+  SORT_STATUS status;
+  int size;
+  int error = NO_ERROR;
+  bool has_record;
+
+  scan = heap_parallel_scan_next_range (thread_p, &loader->px->heap_scan, &loader->scan_range);
+  if (scan == S_END)
+    {
+      loader->is_done = true;
+      btree_px_queue_chunk (loader);
+      return NO_ERROR;
+    }
+  else if (scan != S_SUCCESS)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  OID_SET_NULL (&loader_args->cur_oid);
+  while (true)
+    {
+      loader_args->in_recdes.data = NULL;
+      scan = heap_scanrange_next (thread_p, &loader_args->cur_oid, &loader_args->in_recdes, &loader->scan_range, PEEK);
+      if (scan == S_END)
+	{
+	  break;
+	}
+      else if (scan != S_SUCCESS)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
+	}
+
+      size = BTREE_PX_CHUNK_SIZE;
+      do
+	{
+	  chunk = loader->chunk;
+	  if (chunk == NULL)
+	    {
+	      chunk = (BTREE_PX_CHUNK *) malloc (sizeof (BTREE_PX_CHUNK) + size + MAX_ALIGNMENT);
+	      if (chunk == NULL)
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+			  sizeof (BTREE_PX_CHUNK) + size + MAX_ALIGNMENT);
+		  return ER_OUT_OF_VIRTUAL_MEMORY;
+		}
+	      chunk->next = NULL;
+	      chunk->area = PTR_ALIGN ((char *) (chunk + 1), MAX_ALIGNMENT);
+	      chunk->area_size = size;
+	      chunk->length = 0;
+	      chunk->offset = 0;
+	      loader->chunk = chunk;
+	    }
+
+	  temp_recdes.data = chunk->area + chunk->length + BTREE_PX_ITEM_HEADER_SIZE;
+	  temp_recdes.area_size = MAX (chunk->area_size - chunk->length - BTREE_PX_ITEM_HEADER_SIZE, 0);
+	  temp_recdes.length = 0;
+
+	  status = btree_sort_make_record (thread_p, loader_args, &temp_recdes, &has_record);
+	  if (status == SORT_REC_DOESNT_FIT)
+	    {
+	      if (chunk->length == 0 && temp_recdes.length <= temp_recdes.area_size)
+		{
+		  /* the item does not fit even into an empty chunk */
+		  assert_release (false);
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+		  return ER_GENERIC_ERROR;
+		}
+
+	      /* go on with a new chunk that is big enough for the item */
+	      btree_px_queue_chunk (loader);
+	      size = MAX (BTREE_PX_CHUNK_SIZE, temp_recdes.length + BTREE_PX_ITEM_HEADER_SIZE);
+	    }
+	}
+      while (status == SORT_REC_DOESNT_FIT);
+
+      if (status != SORT_SUCCESS)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
+	}
+
+      if (has_record)
+	{
+	  *(int *) (chunk->area + chunk->length) = temp_recdes.length;
+	  chunk->length += BTREE_PX_ITEM_HEADER_SIZE + DB_ALIGN (temp_recdes.length, MAX_ALIGNMENT);
+	}
+    }
+
+  /* do not keep the page fixed while waiting for the sort */
+  if (loader->scan_range.scan_cache.page_watcher.pgptr != NULL)
+    {
+      pgbuf_ordered_unfix (thread_p, &loader->scan_range.scan_cache.page_watcher);
+    }
+
+  if (loader->chunk != NULL && loader->chunk->length >= loader->chunk->area_size / 2)
+    {
+      btree_px_queue_chunk (loader);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_px_queue_chunk () - Hand the chunk of a loader over to the sort
+ *   return:
+ *   loader(in/out): loader
+ */
+static void
+btree_px_queue_chunk (BTREE_PX_LOADER * loader)
+{
+  BTREE_PX_LOAD *px = loader->px;
+  BTREE_PX_CHUNK *chunk = loader->chunk;
+
+  if (chunk == NULL)
+    {
+      return;
+    }
+
+  loader->chunk = NULL;
+  if (chunk->length == 0)
+    {
+      free_and_init (chunk);
+      return;
+    }
+
+  pthread_mutex_lock (&px->mutex);
+  if (px->queue_tail != NULL)
+    {
+      px->queue_tail->next = chunk;
+    }
+  else
+    {
+      px->queue_head = chunk;
+    }
+  px->queue_tail = chunk;
+  px->queue_length++;
+  pthread_cond_broadcast (&px->cond);
+  pthread_mutex_unlock (&px->mutex);
+}
+
+/*
+ * btree_px_sort_get_next () - Get_key function of a parallel load
+ *   return: SORT_STATUS
+ *   temp_recdes(in): temporary record descriptor; specifies where to put the
+ *                    next sort item.
+ *   px(in): parallel load descriptor
+ *
+ * Note: The sort items are taken from the queued chunks. When the queue is
+ * empty, the calling thread extracts the items of the next heap page itself.
+ */
+static SORT_STATUS
+btree_px_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, BTREE_PX_LOAD * px)
+{
+  BTREE_PX_LOADER *self = &px->loaders[0];
+  BTREE_PX_LOADER *failed_loader;
+  BTREE_PX_CHUNK *chunk;
+  int length;
+
+  while (true)
+    {
+      chunk = px->cur_chunk;
+      if (chunk != NULL && chunk->offset < chunk->length)
+	{
+	  length = *(int *) (chunk->area + chunk->offset);
+	  if (temp_recdes->area_size < length)
+	    {
+	      temp_recdes->length = length;
+	      return SORT_REC_DOESNT_FIT;
+	    }
+
+	  memcpy (temp_recdes->data, chunk->area + chunk->offset + BTREE_PX_ITEM_HEADER_SIZE, length);
+	  temp_recdes->length = length;
+	  chunk->offset += BTREE_PX_ITEM_HEADER_SIZE + DB_ALIGN (length, MAX_ALIGNMENT);
+	  return SORT_SUCCESS;
+	}
+
+      if (chunk != NULL)
+	{
+	  px->cur_chunk = NULL;
+	  free_and_init (chunk);
+	}
+
+      pthread_mutex_lock (&px->mutex);
+      while (px->queue_head == NULL && px->failed_loader == NULL && self->is_done && px->num_running > 0)
+	{
+	  pthread_cond_wait (&px->cond, &px->mutex);
+	}
+
+      failed_loader = px->failed_loader;
+      if (failed_loader == NULL && px->queue_head != NULL)
+	{
+	  px->cur_chunk = px->queue_head;
+	  px->queue_head = px->cur_chunk->next;
+	  if (px->queue_head == NULL)
+	    {
+	      px->queue_tail = NULL;
+	    }
+	  px->queue_length--;
+
+	  /* wake up the helpers waiting for room in the queue */
+	  pthread_cond_broadcast (&px->cond);
+	  pthread_mutex_unlock (&px->mutex);
+	  continue;
+	}
+      pthread_mutex_unlock (&px->mutex);
+
+      if (failed_loader != NULL)
+	{
+	  if (failed_loader->has_er_area)
+	    {
+	      (void) er_set_area_error (failed_loader->er_area);
+	    }
+	  else
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	    }
+	  return SORT_ERROR_OCCURRED;
+	}
+
+      if (self->is_done)
+	{
+	  /* the heap is exhausted and every helper has queued its items */
+	  return SORT_NOMORE_RECS;
+	}
+
+      /* nothing to sort yet; extract the items of the next page in this thread */
+      if (btree_px_load_range (thread_p, self) != NO_ERROR)
+	{
+	  heap_parallel_scan_stop (&px->heap_scan);
+	  return SORT_ERROR_OCCURRED;
+	}
+      btree_px_queue_chunk (self);
+    }
+}
+#endif /* SERVER_MODE */
+
 /*
  * compare_driver () -
  *   return:
@@ -213,6 +213,67 @@ static DISK_CACHE_VOLINFO disk_Cache_struct = {
 
 static DISK_CACHE_VOLINFO *disk_Cache = &disk_Cache_struct;
 
+/* Index of free extents (runs of free pages) of the page allocation table of volumes */
+
+#define DISK_EXTENT_MAX_PENDING 64
+
+typedef enum
+{
+  DISK_EXTENT_BY_ADDRESS = 0,	/* ordered by first page */
+  DISK_EXTENT_BY_SIZE,		/* ordered by number of pages, then by first page */
+  DISK_EXTENT_NTREES
+} DISK_EXTENT_TREE;
+
+typedef enum
+{
+  DISK_EXTENT_INDEX_UNBUILT = 0,
+  DISK_EXTENT_INDEX_BUILDING,
+  DISK_EXTENT_INDEX_BUILT
+} DISK_EXTENT_INDEX_STATE;
+
+typedef struct disk_extent DISK_EXTENT;
+struct disk_extent
+{
+  INT32 pageid;			/* first free page */
+  INT32 npages;			/* number of free pages */
+  unsigned int priority;	/* treap priority, shared by both trees */
+  DISK_EXTENT *left[DISK_EXTENT_NTREES];
+  DISK_EXTENT *right[DISK_EXTENT_NTREES];
+};
+
+typedef struct disk_extent_set DISK_EXTENT_SET;
+struct disk_extent_set
+{
+  DISK_EXTENT *root[DISK_EXTENT_NTREES];
+  INT32 nextents;		/* number of free extents */
+  INT32 free_pages;		/* number of pages in free extents */
+  unsigned int seed;		/* seed of priorities */
+};
+
+typedef struct disk_extent_change DISK_EXTENT_CHANGE;
+struct disk_extent_change
+{				/* change of the page allocation table while the index is built */
+  INT32 pageid;
+  INT32 npages;
+  DISK_ALLOCTABLE_MODE mode;
+};
+
+typedef struct disk_extent_index DISK_EXTENT_INDEX;
+struct disk_extent_index
+{
+  pthread_mutex_t lock;
+  DISK_EXTENT_INDEX_STATE state;
+  INT32 page_alloctb_page1;	/* page allocation table of the volume */
+  INT32 page_alloctb_npages;
+  DISK_EXTENT_SET set;
+  int npending;			/* changes made while the index is built */
+  bool is_pending_overflow;
+  DISK_EXTENT_CHANGE pending[DISK_EXTENT_MAX_PENDING];
+};
+
+static DISK_EXTENT_INDEX *disk_Extent_index[VOLID_MAX + 1];
+static pthread_mutex_t disk_Extent_index_lock = PTHREAD_MUTEX_INITIALIZER;
+
 static char *disk_vhdr_get_vol_fullname (const DISK_VAR_HEADER * vhdr);
 static char *disk_vhdr_get_next_vol_fullname (const DISK_VAR_HEADER * vhdr);
 static char *disk_vhdr_get_vol_remarks (const DISK_VAR_HEADER * vhdr);
@@ -289,6 +350,33 @@ static INT32 disk_alloctable_vhdr_update (THREAD_ENTRY * thread_p, PAGE_PTR vhdr
 					  DISK_PAGE_TYPE page_type, DISK_ALLOCTABLE_MODE mode);
 static void disk_alloctable_bitmap_update (THREAD_ENTRY * thread_p, PAGE_PTR alloctable_page, INT32 start_byte,
 					   unsigned int start_bit, int num_pages, DISK_ALLOCTABLE_MODE mode);
+static int disk_extent_compare (const DISK_EXTENT * ext1, const DISK_EXTENT * ext2, DISK_EXTENT_TREE tree);
+static DISK_EXTENT *disk_extent_tree_insert (DISK_EXTENT * root, DISK_EXTENT * ext, DISK_EXTENT_TREE tree);
+static DISK_EXTENT *disk_extent_tree_merge (DISK_EXTENT * left, DISK_EXTENT * right, DISK_EXTENT_TREE tree);
+static DISK_EXTENT *disk_extent_tree_delete (DISK_EXTENT * root, DISK_EXTENT * ext, DISK_EXTENT_TREE tree);
+static DISK_EXTENT *disk_extent_tree_floor (DISK_EXTENT * root, INT32 pageid);
+static DISK_EXTENT *disk_extent_tree_ceiling (DISK_EXTENT * root, INT32 pageid);
+static DISK_EXTENT *disk_extent_tree_best_fit (DISK_EXTENT * root, INT32 npages);
+static void disk_extent_tree_free (DISK_EXTENT * root);
+static void disk_extent_set_init (DISK_EXTENT_SET * set);
+static void disk_extent_set_clear (DISK_EXTENT_SET * set);
+static int disk_extent_set_link (DISK_EXTENT_SET * set, INT32 pageid, INT32 npages);
+static void disk_extent_set_unlink (DISK_EXTENT_SET * set, DISK_EXTENT * ext);
+static int disk_extent_set_add (DISK_EXTENT_SET * set, INT32 pageid, INT32 npages);
+static int disk_extent_set_remove (DISK_EXTENT_SET * set, INT32 pageid, INT32 npages);
+static int disk_extent_set_build (THREAD_ENTRY * thread_p, INT16 volid, DISK_VAR_HEADER * vhdr,
+				  DISK_EXTENT_SET * set);
+static DISK_EXTENT_INDEX *disk_extent_index_get (THREAD_ENTRY * thread_p, INT16 volid, DISK_VAR_HEADER * vhdr);
+static void disk_extent_index_update (INT16 volid, INT32 pageid, INT32 npages, DISK_ALLOCTABLE_MODE mode);
+static void disk_extent_index_update_bitmap (PAGE_PTR alloctable_page, INT32 start_byte, unsigned int start_bit,
+					     int num, DISK_ALLOCTABLE_MODE mode);
+static void disk_extent_index_invalidate (INT16 volid);
+static void disk_extent_index_final (void);
+static INT32 disk_extent_alloc (THREAD_ENTRY * thread_p, INT16 volid, DISK_VAR_HEADER * vhdr, INT32 npages,
+				INT32 near_pageid, INT32 skip_pageid, bool * is_index_used);
+static bool disk_extent_get_info (THREAD_ENTRY * thread_p, INT16 volid, DISK_VAR_HEADER * vhdr, INT32 * nextents,
+				  INT32 * max_npages);
+
 static void disk_id_dealloc_with_volheader (THREAD_ENTRY * thread_p, LOG_DATA_ADDR * addr,
 					    DISK_RECV_MTAB_BITS_WITH * recv);
 
@@ -391,6 +479,8 @@ disk_goodvol_decache (THREAD_ENTRY * thread_p)
   disk_Cache->nvols = 0;
   disk_Cache->inited = false;
 
+  disk_extent_index_final ();
+
   return NO_ERROR;
 }
 
@@ -1894,6 +1984,7 @@ disk_expand_tmp (THREAD_ENTRY * thread_p, INT16 volid, INT32 min_pages, INT32 ma
    * NOTE that the bitmap has already been initialized during the format of the
    *      volume.
    */
+  disk_extent_index_update (volid, vhdr->total_pages, npages_toadd, DISK_ALLOCTABLE_CLEAR);
   vhdr->total_pages += npages_toadd;
   vhdr->free_pages += npages_toadd;
 
@@ -2018,6 +2109,7 @@ disk_expand_perm (THREAD_ENTRY * thread_p, INT16 volid, INT32 npages)
    * NOTE that the bitmap has already been initialized during the format of the
    *      volume.
    */
+  disk_extent_index_update (volid, vhdr->total_pages, npages, DISK_ALLOCTABLE_CLEAR);
   vhdr->total_pages += npages;
   vhdr->free_pages += npages;
 
@@ -2602,6 +2694,8 @@ disk_map_init (THREAD_ENTRY * thread_p, INT16 volid, INT32 at_fpageid, INT32 at_
 
   vpid.volid = volid;
 
+  disk_extent_index_invalidate (volid);
+
   /* One page at a time */
   for (vpid.pageid = at_fpageid; vpid.pageid <= at_lpageid; vpid.pageid++)
     {
@@ -3160,6 +3254,842 @@ disk_get_boot_db_charset (THREAD_ENTRY * thread_p, INT16 volid, int *db_charset)
   return db_charset;
 }
 
+/*
+ * Free extent index
+ *
+ * The free pages of the page allocation table of a volume are indexed as extents (runs of contiguous free pages) in
+ * two treaps: one ordered by address and one ordered by size. Contiguous pages are found without scanning the
+ * allocation bitmap, and the extents found are claimed through the bitmap, which remains the reference. The index is
+ * built from the bitmap the first time it is needed, and it is kept up to date with every update of the bitmap.
+ * Updates of the bitmap made while the index is built are kept aside and applied at the end of the build.
+ */
+
+/*
+ * disk_extent_compare () - Compare two extents in the order of the given tree
+ *   return: negative, zero or positive
+ *   ext1(in):
+ *   ext2(in):
+ *   tree(in): DISK_EXTENT_BY_ADDRESS or DISK_EXTENT_BY_SIZE
+ */
+static int
+disk_extent_compare (const DISK_EXTENT * ext1, const DISK_EXTENT * ext2, DISK_EXTENT_TREE tree)
+{
+  if (tree == DISK_EXTENT_BY_SIZE && ext1->npages != ext2->npages)
+    {
+      return (ext1->npages < ext2->npages) ? -1 : 1;
+    }
+
+  return (ext1->pageid < ext2->pageid) ? -1 : ((ext1->pageid > ext2->pageid) ? 1 : 0);
+}
+
+/*
+ * disk_extent_tree_insert () - Insert an extent in a tree
+ *   return: new root
+ *   root(in): root of the tree
+ *   ext(in): extent to insert
+ *   tree(in): tree
+ */
+static DISK_EXTENT *
+disk_extent_tree_insert (DISK_EXTENT * root, DISK_EXTENT * ext, DISK_EXTENT_TREE tree)
+{
+  DISK_EXTENT *child;
+
+  if (root == NULL)
+    {
+      ext->left[tree] = NULL;
+      ext->right[tree] = NULL;
+      return ext;
+    }
+
+  if (disk_extent_compare (ext, root, tree) < 0)
+    {
+      child = disk_extent_tree_insert (root->left[tree], ext, tree);
+      if (child->priority > root->priority)
+	{
+	  /* rotate right */
+	  root->left[tree] = child->right[tree];
+	  child->right[tree] = root;
+	  return child;
+	}
+      root->left[tree] = child;
+    }
+  else
+    {
+      child = disk_extent_tree_insert (root->right[tree], ext, tree);
+      if (child->priority > root->priority)
+	{
+	  /* rotate left */
+	  root->right[tree] = child->left[tree];
+	  child->left[tree] = root;
+	  return child;
+	}
+      root->right[tree] = child;
+    }
+
+  return root;
+}
+
+/*
+ * disk_extent_tree_merge () - Merge two trees, all extents of left being before the ones of right
+ *   return: root of the merged tree
+ *   left(in):
+ *   right(in):
+ *   tree(in):
+ */
+static DISK_EXTENT *
+disk_extent_tree_merge (DISK_EXTENT * left, DISK_EXTENT * right, DISK_EXTENT_TREE tree)
+{
+  if (left == NULL)
+    {
+      return right;
+    }
+  if (right == NULL)
+    {
+      return left;
+    }
+
+  if (left->priority > right->priority)
+    {
+      left->right[tree] = disk_extent_tree_merge (left->right[tree], right, tree);
+      return left;
+    }
+  else
+    {
+      right->left[tree] = disk_extent_tree_merge (left, right->left[tree], tree);
+      return right;
+    }
+}
+
+/*
+ * disk_extent_tree_delete () - Delete an extent from a tree
+ *   return: new root
+ *   root(in): root of the tree
+ *   ext(in): extent to delete
+ *   tree(in):
+ */
+static DISK_EXTENT *
+disk_extent_tree_delete (DISK_EXTENT * root, DISK_EXTENT * ext, DISK_EXTENT_TREE tree)
+{
+  if (root == NULL)
+    {
+      assert (false);
+      return NULL;
+    }
+
+  if (root == ext)
+    {
+      return disk_extent_tree_merge (root->left[tree], root->right[tree], tree);
+    }
+
+  if (disk_extent_compare (ext, root, tree) < 0)
+    {
+      root->left[tree] = disk_extent_tree_delete (root->left[tree], ext, tree);
+    }
+  else
+    {
+      root->right[tree] = disk_extent_tree_delete (root->right[tree], ext, tree);
+    }
+
+  return root;
+}
+
+/*
+ * disk_extent_tree_floor () - Find the last extent starting at or before the given page
+ *   return: extent or NULL
+ *   root(in): root of the address tree
+ *   pageid(in):
+ */
+static DISK_EXTENT *
+disk_extent_tree_floor (DISK_EXTENT * root, INT32 pageid)
+{
+  DISK_EXTENT *found = NULL;
+
+  while (root != NULL)
+    {
+      if (root->pageid <= pageid)
+	{
+	  found = root;
+	  root = root->right[DISK_EXTENT_BY_ADDRESS];
+	}
+      else
+	{
+	  root = root->left[DISK_EXTENT_BY_ADDRESS];
+	}
+    }
+
+  return found;
+}
+
+/*
+ * disk_extent_tree_ceiling () - Find the first extent starting at or after the given page
+ *   return: extent or NULL
+ *   root(in): root of the address tree
+ *   pageid(in):
+ */
+static DISK_EXTENT *
+disk_extent_tree_ceiling (DISK_EXTENT * root, INT32 pageid)
+{
+  DISK_EXTENT *found = NULL;
+
+  while (root != NULL)
+    {
+      if (root->pageid >= pageid)
+	{
+	  found = root;
+	  root = root->left[DISK_EXTENT_BY_ADDRESS];
+	}
+      else
+	{
+	  root = root->right[DISK_EXTENT_BY_ADDRESS];
+	}
+    }
+
+  return found;
+}
+
+/*
+ * disk_extent_tree_best_fit () - Find the smallest extent of at least the given number of pages
+ *   return: extent or NULL
+ *   root(in): root of the size tree
+ *   npages(in):
+ *
+ * Note: Among the extents of the same size, the one with the lowest address is returned.
+ */
+static DISK_EXTENT *
+disk_extent_tree_best_fit (DISK_EXTENT * root, INT32 npages)
+{
+  DISK_EXTENT *found = NULL;
+
+  while (root != NULL)
+    {
+      if (root->npages >= npages)
+	{
+	  found = root;
+	  root = root->left[DISK_EXTENT_BY_SIZE];
+	}
+      else
+	{
+	  root = root->right[DISK_EXTENT_BY_SIZE];
+	}
+    }
+
+  return found;
+}
+
+/*
+ * disk_extent_tree_free () - Free all extents of a tree
+ *   return: void
+ *   root(in): root of the address tree
+ */
+static void
+disk_extent_tree_free (DISK_EXTENT * root)
+{
+  if (root != NULL)
+    {
+      disk_extent_tree_free (root->left[DISK_EXTENT_BY_ADDRESS]);
+      disk_extent_tree_free (root->right[DISK_EXTENT_BY_ADDRESS]);
+      free (root);
+    }
+}
+
+/*
+ * disk_extent_set_init () - Initialize an empty set of extents
+ *   return: void
+ *   set(out):
+ */
+static void
+disk_extent_set_init (DISK_EXTENT_SET * set)
+{
+  set->root[DISK_EXTENT_BY_ADDRESS] = NULL;
+  set->root[DISK_EXTENT_BY_SIZE] = NULL;
+  set->nextents = 0;
+  set->free_pages = 0;
+  set->seed = 1;
+}
+
+/*
+ * disk_extent_set_clear () - Free all extents of a set
+ *   return: void
+ *   set(in/out):
+ */
+static void
+disk_extent_set_clear (DISK_EXTENT_SET * set)
+{
+  disk_extent_tree_free (set->root[DISK_EXTENT_BY_ADDRESS]);
+  disk_extent_set_init (set);
+}
+
+/*
+ * disk_extent_set_link () - Add a new extent to both trees of a set
+ *   return: NO_ERROR or ER_OUT_OF_VIRTUAL_MEMORY
+ *   set(in/out):
+ *   pageid(in): first page of the extent
+ *   npages(in): number of pages of the extent
+ *
+ * Note: The extent must not overlap any extent of the set.
+ */
+static int
+disk_extent_set_link (DISK_EXTENT_SET * set, INT32 pageid, INT32 npages)
+{
+  DISK_EXTENT *ext;
+
+  ext = (DISK_EXTENT *) malloc (sizeof (DISK_EXTENT));
+  if (ext == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (DISK_EXTENT));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  set->seed = set->seed * 1103515245 + 12345;
+  ext->pageid = pageid;
+  ext->npages = npages;
+  ext->priority = set->seed;
+
+  set->root[DISK_EXTENT_BY_ADDRESS] = disk_extent_tree_insert (set->root[DISK_EXTENT_BY_ADDRESS], ext,
+							       DISK_EXTENT_BY_ADDRESS);
+  set->root[DISK_EXTENT_BY_SIZE] = disk_extent_tree_insert (set->root[DISK_EXTENT_BY_SIZE], ext, DISK_EXTENT_BY_SIZE);
+  set->nextents++;
+  set->free_pages += npages;
+
+  return NO_ERROR;
+}
+
+/*
+ * disk_extent_set_unlink () - Remove an extent from both trees of a set and free it
+ *   return: void
+ *   set(in/out):
+ *   ext(in):
+ */
+static void
+disk_extent_set_unlink (DISK_EXTENT_SET * set, DISK_EXTENT * ext)
+{
+  set->root[DISK_EXTENT_BY_ADDRESS] = disk_extent_tree_delete (set->root[DISK_EXTENT_BY_ADDRESS], ext,
+							       DISK_EXTENT_BY_ADDRESS);
+  set->root[DISK_EXTENT_BY_SIZE] = disk_extent_tree_delete (set->root[DISK_EXTENT_BY_SIZE], ext, DISK_EXTENT_BY_SIZE);
+  set->nextents--;
+  set->free_pages -= ext->npages;
+  free (ext);
+}
+
+/*
+ * disk_extent_set_add () - Declare a run of pages as free
+ *   return: NO_ERROR or ER_OUT_OF_VIRTUAL_MEMORY
+ *   set(in/out):
+ *   pageid(in): first free page
+ *   npages(in): number of free pages
+ *
+ * Note: The run is coalesced with the extents it touches or overlaps.
+ */
+static int
+disk_extent_set_add (DISK_EXTENT_SET * set, INT32 pageid, INT32 npages)
+{
+  DISK_EXTENT *ext;
+  INT32 end = pageid + npages;
+
+  /* Absorb every extent starting before or at the end of the run, while it reaches the run */
+  while ((ext = disk_extent_tree_floor (set->root[DISK_EXTENT_BY_ADDRESS], end)) != NULL
+	 && ext->pageid + ext->npages >= pageid)
+    {
+      pageid = MIN (pageid, ext->pageid);
+      end = MAX (end, ext->pageid + ext->npages);
+      disk_extent_set_unlink (set, ext);
+    }
+
+  return disk_extent_set_link (set, pageid, end - pageid);
+}
+
+/*
+ * disk_extent_set_remove () - Declare a run of pages as allocated
+ *   return: NO_ERROR or ER_OUT_OF_VIRTUAL_MEMORY
+ *   set(in/out):
+ *   pageid(in): first allocated page
+ *   npages(in): number of allocated pages
+ *
+ * Note: The extents overlapping the run are cut; the parts outside the run are kept.
+ */
+static int
+disk_extent_set_remove (DISK_EXTENT_SET * set, INT32 pageid, INT32 npages)
+{
+  DISK_EXTENT *ext;
+  INT32 end = pageid + npages;
+  INT32 ext_pageid, ext_end;
+  int error = NO_ERROR;
+
+  while ((ext = disk_extent_tree_floor (set->root[DISK_EXTENT_BY_ADDRESS], end - 1)) != NULL
+	 && ext->pageid + ext->npages > pageid)
+    {
+      ext_pageid = ext->pageid;
+      ext_end = ext->pageid + ext->npages;
+      disk_extent_set_unlink (set, ext);
+
+      if (ext_end > end)
+	{
+	  error = disk_extent_set_link (set, end, ext_end - end);
+	}
+      if (error == NO_ERROR && ext_pageid < pageid)
+	{
+	  error = disk_extent_set_link (set, ext_pageid, pageid - ext_pageid);
+	}
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * disk_extent_set_build () - Collect the free extents of a volume from its page allocation table
+ *   return: NO_ERROR or error code
+ *   volid(in): Permanent volume identifier
+ *   vhdr(in): Volume header, latched by the caller
+ *   set(out): extents of the volume
+ */
+static int
+disk_extent_set_build (THREAD_ENTRY * thread_p, INT16 volid, DISK_VAR_HEADER * vhdr, DISK_EXTENT_SET * set)
+{
+  int i;
+  INT32 pageid, last_pageid;
+  INT32 run_pageid = NULL_PAGEID;	/* first page of the current run of free pages */
+  unsigned char *at_chptr;
+  unsigned char *out_chptr;
+  VPID vpid;
+  PAGE_PTR pgptr = NULL;
+  int error = NO_ERROR;
+
+  disk_extent_set_init (set);
+
+  pageid = vhdr->sys_lastpage + 1;
+  last_pageid = vhdr->total_pages - 1;
+  vpid.volid = volid;
+
+  /* One allocation table page at a time */
+  for (vpid.pageid = (pageid / DISK_PAGE_BIT) + vhdr->page_alloctb_page1; pageid <= last_pageid; vpid.pageid++)
+    {
+      pgptr = pgbuf_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+      if (pgptr == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  goto error;
+	}
+
+      (void) pgbuf_check_page_ptype (thread_p, pgptr, PAGE_VOLBITMAP);
+
+      /* One byte at a time */
+      at_chptr = (unsigned char *) pgptr + ((pageid - (vpid.pageid - vhdr->page_alloctb_page1) * DISK_PAGE_BIT)
+					    / CHAR_BIT);
+      out_chptr = (unsigned char *) pgptr + DB_PAGESIZE;
+      for (; pageid <= last_pageid && at_chptr < out_chptr; at_chptr++)
+	{
+	  if (pageid % CHAR_BIT == 0
+	      && ((*at_chptr == 0 && run_pageid != NULL_PAGEID) || (*at_chptr == UCHAR_MAX && run_pageid == NULL_PAGEID)))
+	    {
+	      /* the whole byte continues the run of free pages, or has no free page */
+	      pageid += CHAR_BIT;
+	      continue;
+	    }
+
+	  /* One bit at a time */
+	  for (i = pageid % CHAR_BIT; i < CHAR_BIT && pageid <= last_pageid; i++, pageid++)
+	    {
+	      if (!disk_bit_is_set (at_chptr, i))
+		{
+		  if (run_pageid == NULL_PAGEID)
+		    {
+		      run_pageid = pageid;
+		    }
+		}
+	      else if (run_pageid != NULL_PAGEID)
+		{
+		  error = disk_extent_set_link (set, run_pageid, pageid - run_pageid);
+		  if (error != NO_ERROR)
+		    {
+		      goto error;
+		    }
+		  run_pageid = NULL_PAGEID;
+		}
+	    }
+	}
+
+      pgbuf_unfix_and_init (thread_p, pgptr);
+    }
+
+  if (run_pageid != NULL_PAGEID)
+    {
+      /* the whole byte skip may go beyond the last page */
+      error = disk_extent_set_link (set, run_pageid, MIN (pageid, last_pageid + 1) - run_pageid);
+      if (error != NO_ERROR)
+	{
+	  goto error;
+	}
+    }
+
+  return NO_ERROR;
+
+error:
+  if (pgptr != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, pgptr);
+    }
+  disk_extent_set_clear (set);
+
+  return error;
+}
+
+/*
+ * disk_extent_index_get () - Get the built free extent index of a volume
+ *   return: index locked by the caller's thread, or NULL if the index cannot be used now
+ *   volid(in): Permanent volume identifier
+ *   vhdr(in): Volume header, latched by the caller
+ *
+ * Note: The index is built if needed. The bitmap pages are latched with the index unlocked, so that the updates of
+ *       the bitmap can be kept aside and applied at the end. The caller must unlock the index returned.
+ */
+static DISK_EXTENT_INDEX *
+disk_extent_index_get (THREAD_ENTRY * thread_p, INT16 volid, DISK_VAR_HEADER * vhdr)
+{
+  DISK_EXTENT_INDEX *index;
+  DISK_EXTENT_SET set;
+  DISK_EXTENT_CHANGE *change;
+  int i, rv;
+  int error;
+
+  index = disk_Extent_index[volid];
+  if (index == NULL)
+    {
+      rv = pthread_mutex_lock (&disk_Extent_index_lock);
+      index = disk_Extent_index[volid];
+      if (index == NULL)
+	{
+	  index = (DISK_EXTENT_INDEX *) malloc (sizeof (DISK_EXTENT_INDEX));
+	  if (index == NULL)
+	    {
+	      pthread_mutex_unlock (&disk_Extent_index_lock);
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (DISK_EXTENT_INDEX));
+	      return NULL;
+	    }
+
+	  pthread_mutex_init (&index->lock, NULL);
+	  index->state = DISK_EXTENT_INDEX_UNBUILT;
+	  index->page_alloctb_page1 = NULL_PAGEID;
+	  index->page_alloctb_npages = 0;
+	  disk_extent_set_init (&index->set);
+	  index->npending = 0;
+	  index->is_pending_overflow = false;
+
+	  disk_Extent_index[volid] = index;
+	}
+      pthread_mutex_unlock (&disk_Extent_index_lock);
+    }
+
+  rv = pthread_mutex_lock (&index->lock);
+  if (index->state == DISK_EXTENT_INDEX_BUILT)
+    {
+      return index;
+    }
+  if (index->state == DISK_EXTENT_INDEX_BUILDING)
+    {
+      /* someone else is building it */
+      pthread_mutex_unlock (&index->lock);
+      return NULL;
+    }
+
+  index->state = DISK_EXTENT_INDEX_BUILDING;
+  index->page_alloctb_page1 = vhdr->page_alloctb_page1;
+  index->page_alloctb_npages = vhdr->page_alloctb_npages;
+  index->npending = 0;
+  index->is_pending_overflow = false;
+  pthread_mutex_unlock (&index->lock);
+
+  error = disk_extent_set_build (thread_p, volid, vhdr, &set);
+
+  rv = pthread_mutex_lock (&index->lock);
+  if (index->state != DISK_EXTENT_INDEX_BUILDING || index->is_pending_overflow)
+    {
+      /* invalidated or too many updates meanwhile; it will be built next time */
+      error = ER_FAILED;
+    }
+
+  for (i = 0; i < index->npending && error == NO_ERROR; i++)
+    {
+      change = &index->pending[i];
+      if (change->mode == DISK_ALLOCTABLE_CLEAR)
+	{
+	  error = disk_extent_set_add (&set, change->pageid, change->npages);
+	}
+      else
+	{
+	  error = disk_extent_set_remove (&set, change->pageid, change->npages);
+	}
+    }
+  index->npending = 0;
+
+  if (error != NO_ERROR)
+    {
+      disk_extent_set_clear (&set);
+      index->state = DISK_EXTENT_INDEX_UNBUILT;
+      pthread_mutex_unlock (&index->lock);
+      return NULL;
+    }
+
+  index->set = set;
+  index->state = DISK_EXTENT_INDEX_BUILT;
+
+  return index;
+}
+
+/*
+ * disk_extent_index_update () - Apply an update of the page allocation table to the free extent index
+ *   return: void
+ *   volid(in): Permanent volume identifier
+ *   pageid(in): first page of the update
+ *   npages(in): number of pages of the update
+ *   mode(in): DISK_ALLOCTABLE_SET for allocated pages, DISK_ALLOCTABLE_CLEAR for free pages
+ *
+ * Note: Must be called after the bitmap is updated.
+ */
+static void
+disk_extent_index_update (INT16 volid, INT32 pageid, INT32 npages, DISK_ALLOCTABLE_MODE mode)
+{
+  DISK_EXTENT_INDEX *index;
+  DISK_EXTENT_CHANGE *change;
+  int error, rv;
+
+  index = disk_Extent_index[volid];
+  if (index == NULL || npages <= 0)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&index->lock);
+  if (index->state == DISK_EXTENT_INDEX_BUILT)
+    {
+      if (mode == DISK_ALLOCTABLE_CLEAR)
+	{
+	  error = disk_extent_set_add (&index->set, pageid, npages);
+	}
+      else
+	{
+	  error = disk_extent_set_remove (&index->set, pageid, npages);
+	}
+
+      if (error != NO_ERROR)
+	{
+	  disk_extent_set_clear (&index->set);
+	  index->state = DISK_EXTENT_INDEX_UNBUILT;
+	}
+    }
+  else if (index->state == DISK_EXTENT_INDEX_BUILDING)
+    {
+      if (index->npending < DISK_EXTENT_MAX_PENDING)
+	{
+	  change = &index->pending[index->npending++];
+	  change->pageid = pageid;
+	  change->npages = npages;
+	  change->mode = mode;
+	}
+      else
+	{
+	  index->is_pending_overflow = true;
+	}
+    }
+  pthread_mutex_unlock (&index->lock);
+}
+
+/*
+ * disk_extent_index_update_bitmap () - Apply an update of an allocation table page to the free extent index
+ *   return: void
+ *   alloctable_page(in): Allocation table page
+ *   start_byte(in): First byte updated
+ *   start_bit(in): First bit updated in the first byte
+ *   num(in): Number of bits updated
+ *   mode(in): Set/clear bit
+ *
+ * Note: Updates of the sector allocation table are ignored.
+ */
+static void
+disk_extent_index_update_bitmap (PAGE_PTR alloctable_page, INT32 start_byte, unsigned int start_bit, int num,
+				 DISK_ALLOCTABLE_MODE mode)
+{
+  DISK_EXTENT_INDEX *index;
+  VPID *vpid;
+  INT32 page1, npages;
+
+  vpid = pgbuf_get_vpid_ptr (alloctable_page);
+  index = disk_Extent_index[vpid->volid];
+  if (index == NULL)
+    {
+      return;
+    }
+
+  /* the allocation table does not move once the volume is formatted */
+  page1 = index->page_alloctb_page1;
+  npages = index->page_alloctb_npages;
+  if (vpid->pageid < page1 || vpid->pageid >= page1 + npages)
+    {
+      return;
+    }
+
+  disk_extent_index_update (vpid->volid,
+			    (vpid->pageid - page1) * DISK_PAGE_BIT + start_byte * CHAR_BIT + (INT32) start_bit, num,
+			    mode);
+}
+
+/*
+ * disk_extent_index_invalidate () - Drop the free extent index of a volume
+ *   return: void
+ *   volid(in): Permanent volume identifier
+ *
+ * Note: Used when the allocation tables are initialized. The index is built again when needed.
+ */
+static void
+disk_extent_index_invalidate (INT16 volid)
+{
+  DISK_EXTENT_INDEX *index;
+  int rv;
+
+  index = disk_Extent_index[volid];
+  if (index == NULL)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&index->lock);
+  disk_extent_set_clear (&index->set);
+  index->state = DISK_EXTENT_INDEX_UNBUILT;
+  pthread_mutex_unlock (&index->lock);
+}
+
+/*
+ * disk_extent_index_final () - Free the free extent indexes of all volumes
+ *   return: void
+ */
+static void
+disk_extent_index_final (void)
+{
+  DISK_EXTENT_INDEX *index;
+  int i;
+
+  for (i = 0; i < VOLID_MAX + 1; i++)
+    {
+      index = disk_Extent_index[i];
+      if (index != NULL)
+	{
+	  disk_extent_set_clear (&index->set);
+	  pthread_mutex_destroy (&index->lock);
+	  free_and_init (disk_Extent_index[i]);
+	}
+    }
+}
+
+/*
+ * disk_extent_alloc () - Allocate contiguous pages anywhere in a volume using the free extent index
+ *   return: first allocated page, or NULL_PAGEID
+ *   volid(in): Permanent volume identifier
+ *   vhdr(in): Volume header, latched in write mode by the caller
+ *   npages(in): Number of contiguous pages to allocate
+ *   near_pageid(in): Pages are allocated at or after this page if the extent there is large enough
+ *   skip_pageid(in): Page that must not be allocated
+ *   is_index_used(out): false if the caller must search the allocation table
+ *
+ * Note: When the extents at and after near_pageid are too small, the smallest extent that has enough pages is used
+ *       (best fit, ties going to the lowest address). The pages are claimed through the allocation table; if they
+ *       are not free there, the index is dropped.
+ */
+static INT32
+disk_extent_alloc (THREAD_ENTRY * thread_p, INT16 volid, DISK_VAR_HEADER * vhdr, INT32 npages, INT32 near_pageid,
+		   INT32 skip_pageid, bool * is_index_used)
+{
+  DISK_EXTENT_INDEX *index;
+  DISK_EXTENT *ext;
+  INT32 pageid = NULL_PAGEID;
+  INT32 new_pageid;
+
+  *is_index_used = false;
+
+  index = disk_extent_index_get (thread_p, volid, vhdr);
+  if (index == NULL)
+    {
+      return NULL_PAGEID;
+    }
+
+  /* The extent containing near_pageid, or the first one after it */
+  ext = disk_extent_tree_floor (index->set.root[DISK_EXTENT_BY_ADDRESS], near_pageid);
+  if (ext != NULL && ext->pageid + ext->npages - near_pageid >= npages)
+    {
+      pageid = near_pageid;
+    }
+  else
+    {
+      ext = disk_extent_tree_ceiling (index->set.root[DISK_EXTENT_BY_ADDRESS], near_pageid);
+      if (ext == NULL || ext->npages < npages)
+	{
+	  ext = disk_extent_tree_best_fit (index->set.root[DISK_EXTENT_BY_SIZE], npages);
+	}
+      if (ext != NULL)
+	{
+	  pageid = ext->pageid;
+	}
+    }
+  pthread_mutex_unlock (&index->lock);
+
+  if (pageid == NULL_PAGEID)
+    {
+      /* there are not such contiguous pages */
+      *is_index_used = true;
+      return NULL_PAGEID;
+    }
+
+  if (skip_pageid >= pageid && skip_pageid < pageid + npages)
+    {
+      /* let the allocation table search avoid it */
+      return NULL_PAGEID;
+    }
+
+  new_pageid = disk_id_alloc (thread_p, volid, vhdr, npages, pageid, pageid + npages - 1, DISK_PAGE, -1, skip_pageid);
+  if (new_pageid == NULL_PAGEID)
+    {
+      disk_extent_index_invalidate (volid);
+      return NULL_PAGEID;
+    }
+
+  *is_index_used = true;
+  return new_pageid;
+}
+
+/*
+ * disk_extent_get_info () - Get fragmentation information of the free pages of a volume
+ *   return: true if the information is available
+ *   volid(in): Permanent volume identifier
+ *   vhdr(in): Volume header, latched by the caller
+ *   nextents(out): Number of free extents
+ *   max_npages(out): Number of pages of the largest free extent
+ */
+static bool
+disk_extent_get_info (THREAD_ENTRY * thread_p, INT16 volid, DISK_VAR_HEADER * vhdr, INT32 * nextents,
+		      INT32 * max_npages)
+{
+  DISK_EXTENT_INDEX *index;
+  DISK_EXTENT *ext;
+
+  index = disk_extent_index_get (thread_p, volid, vhdr);
+  if (index == NULL)
+    {
+      return false;
+    }
+
+  *nextents = index->set.nextents;
+  *max_npages = 0;
+  for (ext = index->set.root[DISK_EXTENT_BY_SIZE]; ext != NULL; ext = ext->right[DISK_EXTENT_BY_SIZE])
+    {
+      *max_npages = ext->npages;
+    }
+  pthread_mutex_unlock (&index->lock);
+
+  return true;
+}
+
 /*
  * disk_alloc_sector () - Allocates a new sector
  *   return: sector identifier
@@ -3322,6 +4252,7 @@ disk_alloc_page (THREAD_ENTRY * thread_p, INT16 volid, INT32 sectid, INT32 npage
   DISK_RECV_MTAB_BITS_WITH undoredo_data;
   int delta;
   bool need_to_add_generic_volume;
+  bool is_index_used = false;
 
 #if defined(CUBRID_DEBUG)
   if (npages <= 0)
@@ -3417,6 +4348,12 @@ disk_alloc_page (THREAD_ENTRY * thread_p, INT16 volid, INT32 sectid, INT32 npage
     }
 
 
+  if (sectid == DISK_SECTOR_WITH_ALL_PAGES)
+    {
+      /* Pages may be anywhere in the volume, look for them in the free extent index */
+      new_pageid = disk_extent_alloc (thread_p, volid, vhdr, npages, near_pageid, skip_pageid, &is_index_used);
+    }
+
   /* 
    * First look at the pages after near_pageid
    *
@@ -3425,9 +4362,12 @@ disk_alloc_page (THREAD_ENTRY * thread_p, INT16 volid, INT32 sectid, INT32 npage
    * But in abnormal case it could be not marked
    * (disk & file allocset mismatch)
    */
-  new_pageid = disk_id_alloc (thread_p, volid, vhdr, npages, near_pageid, lpageid, DISK_PAGE, -1, skip_pageid);
+  if (is_index_used == false)
+    {
+      new_pageid = disk_id_alloc (thread_p, volid, vhdr, npages, near_pageid, lpageid, DISK_PAGE, -1, skip_pageid);
+    }
 
-  if (new_pageid == NULL_PAGEID && near_pageid != fpageid)
+  if (new_pageid == NULL_PAGEID && is_index_used == false && near_pageid != fpageid)
     {
       /* Try again from the beginning of the sector. Include the near_pageid for multiple pages */
 
@@ -3741,6 +4681,19 @@ disk_id_alloc (THREAD_ENTRY * thread_p, INT16 volid, DISK_VAR_HEADER * vhdr, INT
 	  pgbuf_set_dirty (thread_p, addr.pgptr, FREE);
 	  addr.pgptr = NULL;
 	}
+
+      if (allid_type == DISK_PAGE)
+	{
+	  if (allid != NULL_PAGEID)
+	    {
+	      disk_extent_index_update (volid, allid, nalloc, DISK_ALLOCTABLE_SET);
+	    }
+	  else
+	    {
+	      /* some of the pages may have been set */
+	      disk_extent_index_invalidate (volid);
+	    }
+	}
     }
   else
     {
@@ -4293,6 +5246,7 @@ disk_get_maxcontiguous_numpages (THREAD_ENTRY * thread_p, INT16 volid, INT32 max
   VPID vpid;
   PAGE_PTR pgptr = NULL;
   INT32 npages;
+  INT32 nextents;
 
   vpid.volid = volid;
   vpid.pageid = DISK_VOLHEADER_PAGE;
@@ -4319,6 +5273,12 @@ disk_get_maxcontiguous_numpages (THREAD_ENTRY * thread_p, INT16 volid, INT32 max
       goto end;
     }
 
+  if (disk_extent_get_info (thread_p, volid, vhdr, &nextents, &npages) == true)
+    {
+      npages = MIN (npages, max_npages);
+      goto end;
+    }
+
   npages =
     disk_id_get_max_contiguous (thread_p, volid, vhdr->page_alloctb_page1, vhdr->sys_lastpage + 1,
 				vhdr->total_pages - 1, max_npages);
@@ -4351,6 +5311,7 @@ disk_get_hint_contiguous_free_numpages (THREAD_ENTRY * thread_p, INT16 volid, IN
   VPID vpid;
   PAGE_PTR pgptr = NULL;
   INT32 npages;
+  INT32 nextents;
 
   vpid.volid = volid;
   vpid.pageid = DISK_VOLHEADER_PAGE;
@@ -4374,9 +5335,12 @@ disk_get_hint_contiguous_free_numpages (THREAD_ENTRY * thread_p, INT16 volid, IN
 
   if (arecontiguous_npages > 1)
     {
-      npages =
-	disk_id_get_max_contiguous (thread_p, volid, vhdr->page_alloctb_page1, vhdr->sys_lastpage + 1,
-				    vhdr->total_pages - 1, arecontiguous_npages);
+      if (disk_extent_get_info (thread_p, volid, vhdr, &nextents, &npages) == false)
+	{
+	  npages =
+	    disk_id_get_max_contiguous (thread_p, volid, vhdr->page_alloctb_page1, vhdr->sys_lastpage + 1,
+					vhdr->total_pages - 1, arecontiguous_npages);
+	}
     }
   else
     {
@@ -5128,6 +6092,7 @@ disk_volume_header_next_scan (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** o
   DB_DATETIME create_time;
   char buf[256];
   DISK_VOL_HEADER_CONTEXT *ctx = (DISK_VOL_HEADER_CONTEXT *) ptr;
+  INT32 nextents, max_extent_npages;
 
   if (cursor >= 1)
     {
@@ -5252,6 +6217,23 @@ disk_volume_header_next_scan (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** o
       goto exit_on_error;
     }
 
+  if (disk_extent_get_info (thread_p, vpid.volid, vhdr, &nextents, &max_extent_npages) == true)
+    {
+      db_make_int (out_values[idx], nextents);
+      idx++;
+
+      db_make_int (out_values[idx], max_extent_npages);
+      idx++;
+    }
+  else
+    {
+      db_make_null (out_values[idx]);
+      idx++;
+
+      db_make_null (out_values[idx]);
+      idx++;
+    }
+
   assert (idx == out_cnt);
 
 exit_on_error:
@@ -5512,6 +6494,8 @@ disk_rv_redo_init_map (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 
   (void) pgbuf_set_page_ptype (thread_p, rcv->pgptr, PAGE_VOLBITMAP);
 
+  disk_extent_index_invalidate (pgbuf_get_volume_id (rcv->pgptr));
+
   nalloc_bits = *(INT32 *) rcv->data;
 
   /* Initialize the page to zeros, and allocate the needed bits for the pages or sectors */
@@ -5711,6 +6695,8 @@ disk_alloctable_bitmap_update (THREAD_ENTRY * thread_p, PAGE_PTR alloctable_page
 	}
       bit = 0;
     }
+
+  disk_extent_index_update_bitmap (alloctable_page, start_byte, start_bit, num_pages, mode);
 }
 
 /*
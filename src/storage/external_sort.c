@@ -120,30 +120,6 @@ struct vol_list
   VOL_INFO *vol_info;		/* array of volume information */
 };
 
-/* Parallel eXecution and communition node */
-typedef struct px_tree_node PX_TREE_NODE;
-struct px_tree_node
-{
-  int px_id;			/* node ID */
-#if defined(SERVER_MODE)
-  int px_status;		/* node status; access through px_mtx */
-#endif				/* SERVER_MODE */
-
-  int px_height;		/* tournament tree: node level */
-  int px_myself;		/* tournament tree: node ID */
-
-  int px_tran_index;
-
-  void *px_arg;			/* operation info */
-
-  char **px_buff;
-  char **px_vector;
-  long px_vector_size;
-
-  char **px_result;		/* output */
-  long px_result_size;		/* output */
-};
-
 typedef struct sort_param SORT_PARAM;
 struct sort_param
 {
@@ -180,14 +156,60 @@ struct sort_param
   /* multipage number of pages */
   int multipage_npages;
 
-  /* support parallelism */
+  /* helper threads of the internal sorting; see sort_px_run_sort */
+  int px_max_threads;
+};
+
 #if defined(SERVER_MODE)
-  pthread_mutex_t px_mtx;	/* px_node status mutex */
-#endif
-  int px_height_max;		/* px_node tournament tree max level */
-  int px_array_size;		/* px_node array size */
-  PX_TREE_NODE *px_array;	/* px_node array */
+/* Minimum number of keys a partition of a parallel internal sort gets */
+#define SORT_PX_PARTITION_SIZE_MIN (64 * ONE_K)
+
+/* Partitions made for each sorting thread, to balance their load */
+#define SORT_PX_PARTITIONS_PER_THREAD 2
+
+#define SORT_PX_IS_IN_BUFF(px_context, node) \
+  ((node)->result >= (px_context)->buff && (node)->result < (px_context)->buff + (px_context)->vector_size)
+
+/* Task of a parallel internal sort: sort of a partition or merge of two nodes */
+typedef struct sort_px_node SORT_PX_NODE;
+struct sort_px_node
+{
+  long start;			/* first slot of the node in the vector and in the buffer */
+  long size;			/* number of slots of the node */
+  int left;			/* children of a merge; -1 for a partition */
+  int right;
+  int parent;			/* -1 for the root */
+  int num_done_children;	/* access through mutex */
+
+  char **result;		/* sorted keys, in the vector or in the buffer */
+  long result_size;
+};
+
+typedef struct sort_px_context SORT_PX_CONTEXT;
+struct sort_px_context
+{
+  SORT_PARAM *sort_param;
+  char **vector;
+  char **buff;
+  long vector_size;
+  int tran_index;
+
+  SORT_PX_NODE *nodes;		/* partitions first, the root last */
+  int num_nodes;
+
+  pthread_mutex_t mutex;	/* protects the members below */
+  pthread_cond_t cond;		/* signaled when tasks are done */
+  int *ready;			/* queue of the tasks ready to execute */
+  int ready_head;
+  int ready_tail;
+  int num_done;
+  int num_running;		/* threads executing tasks */
+  int ref_count;		/* sorting thread + queued helpers */
+  int error;
+  int er_area_length;
+  char er_area[1024];		/* error of the failed task, see er_get_area_error */
 };
+#endif /* SERVER_MODE */
 
 typedef struct sort_rec_list SORT_REC_LIST;
 struct sort_rec_list
@@ -248,12 +270,17 @@ typedef void MERGE_RUN_FN (char **, char **, SORT_STACK *, SORT_CMP_FUNC *, void
 #if !defined(NDEBUG)
 static int sort_validate (char **vector, long size, SORT_CMP_FUNC * compare, void *comp_arg);
 #endif
-static PX_TREE_NODE *px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, char **px_buff,
-				     char **px_vector, long px_vector_size, int px_height, int px_myself);
-static int px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node);
+static char **sort_px_run_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **vector, long vector_size,
+				char **buff, long *result_size);
 #if defined(SERVER_MODE)
-static int px_sort_communicate (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node);
-#endif
+static SORT_PX_CONTEXT *sort_px_create_context (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **vector,
+						long vector_size, char **buff, int num_parts);
+static void sort_px_release_context (SORT_PX_CONTEXT * px_context);
+static int sort_px_execute (THREAD_ENTRY * thread_p, SORT_PX_CONTEXT * px_context);
+static int sort_px_helper (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
+static void sort_px_do_tasks (THREAD_ENTRY * thread_p, SORT_PX_CONTEXT * px_context);
+static int sort_px_merge (SORT_PX_CONTEXT * px_context, SORT_PX_NODE * node);
+#endif /* SERVER_MODE */
 
 static int sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FUNC * get_next,
 			      void *arguments, unsigned int *total_numrecs);
@@ -1348,15 +1375,10 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 {
   int error = NO_ERROR;
   SORT_PARAM *sort_param = NULL;
-  bool prm_enable_sort_parallel = false;	/* TODO - PRM_SORT_PARALLEL_SORT */
   INT32 input_pages;
   int i;
   int file_pg_cnt_est;
   unsigned int total_numrecs = 0;
-#if defined(SERVER_MODE)
-  int num_cpus;
-  int rv;
-#endif /* SERVER_MODE */
 
   thread_set_sort_stats_active (thread_p, true);
 
@@ -1372,19 +1394,6 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
       return error;
     }
 
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_init (&(sort_param->px_mtx), NULL);
-  if (rv != 0)
-    {
-      error = ER_CSS_PTHREAD_MUTEX_INIT;
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
-
-      free_and_init (sort_param);
-
-      return error;
-    }
-#endif /* SERVER_MODE */
-
   sort_param->cmp_fn = cmp_fn;
   sort_param->cmp_arg = cmp_arg;
   sort_param->option = option;
@@ -1402,8 +1411,11 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
       sort_param->file_contents[i].num_pages = NULL;
     }
   sort_param->internal_memory = NULL;
-  sort_param->px_height_max = sort_param->px_array_size = 0;
-  sort_param->px_array = NULL;
+#if defined(SERVER_MODE)
+  sort_param->px_max_threads = prm_get_integer_value (PRM_ID_SORT_PARALLEL_THREADS);
+#else /* SERVER_MODE */
+  sort_param->px_max_threads = 0;
+#endif /* SERVER_MODE */
 
   /* initialize temp. overflow file. Real value will be assigned in sort_inphase_sort function, if long size sorting
    * records are encountered. */
@@ -1474,35 +1486,6 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
   sort_param->tmp_file_pgs = CEIL_PTVDIV (input_pages, sort_param->half_files);
   sort_param->tmp_file_pgs = MAX (1, sort_param->tmp_file_pgs);
 
-  sort_param->px_height_max = 0;	/* init */
-  sort_param->px_array_size = 1;	/* init */
-
-#if 1				/* TODO - currently, disable parallelism */
-  prm_enable_sort_parallel = false;
-#endif
-
-#if defined(SERVER_MODE)
-  if (prm_enable_sort_parallel == true)
-    {
-      /* TODO - calc n, 2^^n get the number of CPUs TODO - fileio_os_sysconf really get #cores instead of #CPUs -
-       * NEED MORE CONSIDERATION */
-      num_cpus = fileio_os_sysconf ();
-
-      sort_param->px_height_max = sqrt (num_cpus);	/* n */
-      sort_param->px_array_size = num_cpus;	/* 2^^n */
-
-      assert_release (sort_param->px_array_size == pow (2, sort_param->px_height_max));
-    }
-#endif /* SERVER_MODE */
-
-  sort_param->px_array = (PX_TREE_NODE *) malloc (sort_param->px_array_size * sizeof (PX_TREE_NODE));
-  if (sort_param->px_array == NULL)
-    {
-      error = ER_OUT_OF_VIRTUAL_MEMORY;
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, (sort_param->px_array_size * sizeof (PX_TREE_NODE)));
-      goto cleanup;
-    }
-
   /* 
    * Don't allocate any temp files yet, since we may not need them.
    * We'll allocate them on the fly as the need arises.
@@ -1607,566 +1590,484 @@ sort_validate (char **vector, long size, SORT_CMP_FUNC * compare, void *comp_arg
 #endif
 
 /*
- * px_sort_assign() -
- *   return:
+ * sort_px_run_sort () - Sort the keys kept in the internal memory
+ *   return: sorted vector, or NULL on error
  *   thread_p(in):
  *   sort_param(in): sort parameters
- *   px_id(in):
- *   px_buff(in):
- *   px_vector(in):
- *   px_vector_size(in):
- *   px_height(in):
- *   px_myself(in):
+ *   vector(in): addresses of the records to sort
+ *   vector_size(in): number of records
+ *   buff(in): buffer of vector_size slots for the sort
+ *   result_size(out): number of slots of the sorted vector
  *
- * NOTE: support parallelism
+ * Note: When helper threads are allowed and the vector is large enough, it
+ * is cut in partitions that are sorted independently and then merged by
+ * pairs (see sort_px_execute). Otherwise sort_run_sort is used directly.
+ * As with sort_run_sort, the result of a SORT_ELIM_DUP sort is kept at the
+ * end of the vector.
  */
-static PX_TREE_NODE *
-px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, char **px_buff, char **px_vector,
-		long px_vector_size, int px_height, int px_myself)
+static char **
+sort_px_run_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **vector, long vector_size, char **buff,
+		  long *result_size)
 {
-  PX_TREE_NODE *px_node;
 #if defined(SERVER_MODE)
-  int rv = NO_ERROR;
+  SORT_PX_CONTEXT *px_context;
+  SORT_PX_NODE *root;
+  char **result;
+  int num_parts;
+
+  num_parts = MIN ((sort_param->px_max_threads + 1) * SORT_PX_PARTITIONS_PER_THREAD,
+		   vector_size / SORT_PX_PARTITION_SIZE_MIN);
+  if (sort_param->px_max_threads > 0 && num_parts > 1)
+    {
+      px_context = sort_px_create_context (thread_p, sort_param, vector, vector_size, buff, num_parts);
+      if (px_context != NULL)
+	{
+	  result = NULL;
+	  if (sort_px_execute (thread_p, px_context) == NO_ERROR)
+	    {
+	      root = &px_context->nodes[px_context->num_nodes - 1];
+	      result = root->result;
+	      *result_size = root->result_size;
+
+	      if (sort_param->option == SORT_ELIM_DUP && result != vector + vector_size - *result_size)
+		{
+		  /* keep the sorted keys at the end of the vector, as sort_run_sort does */
+		  memmove (vector + vector_size - *result_size, result, *result_size * sizeof (char *));
+		  result = vector + vector_size - *result_size;
+		}
+
+#if !defined(NDEBUG)
+	      if (sort_validate (result, *result_size, sort_param->cmp_fn, sort_param->cmp_arg) != NO_ERROR)
+		{
+		  result = NULL;
+		}
 #endif
+	    }
 
-  assert (sort_param != NULL);
+	  sort_px_release_context (px_context);
+	  return result;
+	}
 
-  if (px_height < 0 || px_height > sort_param->px_height_max)
-    {
-      assert_release (false);
-      return NULL;
+      /* not enough memory for the parallel sort; sort serially */
+      er_clear ();
     }
+#endif /* SERVER_MODE */
+
+  *result_size = vector_size;
+  return sort_run_sort (thread_p, sort_param, vector, vector_size, 0, buff, result_size);
+}
 
-  if (px_id < 0 || px_id >= sort_param->px_array_size)
+#if defined(SERVER_MODE)
+/*
+ * sort_px_create_context () - Build the tasks of a parallel internal sort
+ *   return: context, or NULL on error
+ *   thread_p(in):
+ *   sort_param(in): sort parameters
+ *   vector(in): addresses of the records to sort
+ *   vector_size(in): number of records
+ *   buff(in): buffer of vector_size slots
+ *   num_parts(in): number of partitions
+ *
+ * Note: The tasks form a tree kept in an array: the partition sorts come
+ * first, followed by the merges of adjacent pairs, level by level, the root
+ * being the last node. A merge becomes ready when both its children are
+ * done. The context is shared with the helper threads and allocated with
+ * malloc.
+ */
+static SORT_PX_CONTEXT *
+sort_px_create_context (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **vector, long vector_size,
+			char **buff, int num_parts)
+{
+  SORT_PX_CONTEXT *px_context;
+  SORT_PX_NODE *node;
+  int *level;
+  int level_size, next_level_size;
+  int num_nodes, i;
+  size_t size;
+
+  /* a binary tree with num_parts leaves */
+  num_nodes = 2 * num_parts - 1;
+
+  size = sizeof (SORT_PX_CONTEXT) + num_nodes * sizeof (SORT_PX_NODE) + (num_nodes + num_parts) * sizeof (int);
+  px_context = (SORT_PX_CONTEXT *) malloc (size);
+  if (px_context == NULL)
     {
-      assert_release (false);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
       return NULL;
     }
 
-  if (px_myself < 0 || px_myself > px_id)
+  px_context->sort_param = sort_param;
+  px_context->vector = vector;
+  px_context->buff = buff;
+  px_context->vector_size = vector_size;
+  px_context->tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  px_context->nodes = (SORT_PX_NODE *) (px_context + 1);
+  px_context->ready = (int *) (px_context->nodes + num_nodes);
+  level = px_context->ready + num_nodes;
+  px_context->num_nodes = 0;
+  px_context->ready_head = 0;
+  px_context->ready_tail = 0;
+  px_context->num_done = 0;
+  px_context->num_running = 0;
+  px_context->ref_count = 1;
+  px_context->error = NO_ERROR;
+  px_context->er_area_length = 0;
+
+  /* the partitions; all of them are ready */
+  for (i = 0; i < num_parts; i++)
     {
-      assert_release (false);
-      return NULL;
+      node = &px_context->nodes[i];
+      node->start = vector_size * i / num_parts;
+      node->size = vector_size * (i + 1) / num_parts - node->start;
+      node->left = node->right = node->parent = -1;
+      node->num_done_children = 0;
+      node->result = NULL;
+      node->result_size = 0;
+
+      level[i] = i;
+      px_context->ready[px_context->ready_tail++] = i;
     }
+  px_context->num_nodes = num_parts;
 
-  px_node = &(sort_param->px_array[px_id]);
+  /* the merges of adjacent nodes, up to the root */
+  for (level_size = num_parts; level_size > 1; level_size = next_level_size)
+    {
+      next_level_size = 0;
+      for (i = 0; i + 1 < level_size; i += 2)
+	{
+	  node = &px_context->nodes[px_context->num_nodes];
+	  node->left = level[i];
+	  node->right = level[i + 1];
+	  node->parent = -1;
+	  node->num_done_children = 0;
+	  node->start = px_context->nodes[node->left].start;
+	  node->size = px_context->nodes[node->left].size + px_context->nodes[node->right].size;
+	  node->result = NULL;
+	  node->result_size = 0;
+
+	  px_context->nodes[node->left].parent = px_context->num_nodes;
+	  px_context->nodes[node->right].parent = px_context->num_nodes;
+	  level[next_level_size++] = px_context->num_nodes++;
+	}
+      if (i < level_size)
+	{
+	  /* odd one goes up as it is */
+	  level[next_level_size++] = level[i];
+	}
+    }
 
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-  assert (rv == NO_ERROR);
+  assert (px_context->num_nodes == num_nodes);
 
-#if !defined(NDEBUG)
-  if (px_node->px_status != 0)
+  if (pthread_mutex_init (&px_context->mutex, NULL) != 0)
     {
-      assert (false);
-      pthread_mutex_unlock (&(sort_param->px_mtx));
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_INIT, 0);
+      free_and_init (px_context);
+      return NULL;
+    }
+  if (pthread_cond_init (&px_context->cond, NULL) != 0)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_COND_INIT, 0);
+      pthread_mutex_destroy (&px_context->mutex);
+      free_and_init (px_context);
       return NULL;
     }
-#endif
-
-  px_node->px_status = 0;
-
-  pthread_mutex_unlock (&(sort_param->px_mtx));
-#else /* SERVER_MODE */
-  assert (sort_param->px_height_max == 0);
-  assert (sort_param->px_array_size == 1);
-
-  assert (px_id == 0);
-  assert (px_height == 0);
-  assert (px_myself == 0);
-#endif /* SERVER_MODE */
-
-  /* set node info */
-
-  px_node->px_id = px_id;
-
-  px_node->px_height = px_height;
-  px_node->px_myself = px_myself;
-
-  px_node->px_tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-
-  /* set operation info */
-
-  px_node->px_arg = (void *) sort_param;
-
-  px_node->px_buff = px_buff;
-  px_node->px_vector = px_vector;
-  px_node->px_vector_size = px_vector_size;
-
-  px_node->px_result = px_node->px_vector;	/* init */
-  px_node->px_result_size = px_node->px_vector_size;	/* init */
 
-  return px_node;
+  return px_context;
 }
 
-#if defined(SERVER_MODE)
 /*
- * px_sort_communicate() -
+ * sort_px_release_context () - Release a reference to the context of a
+ *                              parallel internal sort
  *   return:
- *   thread_p(in):
- *   px_node(in):
+ *   px_context(in):
  *
- * NOTE: support parallelism
+ * Note: The last of the sorting thread and the helpers frees it.
  */
-static int
-px_sort_communicate (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
+static void
+sort_px_release_context (SORT_PX_CONTEXT * px_context)
 {
-  int ret = NO_ERROR;
-  SORT_PARAM *sort_param;
-  CSS_CONN_ENTRY *conn_p;
-  int conn_index;
-  CSS_JOB_ENTRY *job_entry_p;
-
-  assert_release (px_node != NULL);
-  assert_release (px_node->px_arg != NULL);
+  int ref_count;
 
-  sort_param = (SORT_PARAM *) (px_node->px_arg);
-  assert_release (px_node->px_height <= sort_param->px_height_max);
-  assert_release (px_node->px_id < sort_param->px_array_size);
+  pthread_mutex_lock (&px_context->mutex);
+  ref_count = --px_context->ref_count;
+  pthread_mutex_unlock (&px_context->mutex);
 
-  assert_release (px_node->px_vector_size > 1);
-
-  conn_p = thread_get_current_conn_entry ();
-  conn_index = (conn_p) ? conn_p->idx : 0;
-
-  /* explicit job queue index */
-  conn_index += px_node->px_id;
-
-  job_entry_p = css_make_job_entry (conn_p, (CSS_THREAD_FN) px_sort_myself, (CSS_THREAD_ARG) px_node, conn_index);
-  if (job_entry_p == NULL)
+  if (ref_count > 0)
     {
-      return ER_FAILED;
+      return;
     }
 
-  css_add_to_job_queue (job_entry_p);
-
-  assert (ret == NO_ERROR);
-
-  return ret;
+  pthread_cond_destroy (&px_context->cond);
+  pthread_mutex_destroy (&px_context->mutex);
+  free_and_init (px_context);
 }
-#endif /* SERVER_MODE */
 
 /*
- * px_sort_myself() -
- *   return:
+ * sort_px_execute () - Run a parallel internal sort
+ *   return: NO_ERROR or error code
  *   thread_p(in):
- *   px_node(in):
+ *   px_context(in): tasks of the sort
  *
- * NOTE: support parallelism
- *
- * Partitioned merge logic
- *
- * The working core: each internal node recurses on this function
- * both for its left side and its right side, as nodes one closer to
- * the leaf level.  It then merges the results into the vector
- *
- * Leaf level nodes just sort the vector.
+ * Note: Up to px_max_threads helpers are queued on the job queue. All of
+ * them, and the calling thread as well, take the ready tasks from the
+ * context until the root merge is done. Because the calling thread works
+ * on the tasks too, the sort completes even if no helper gets a worker
+ * thread; helpers that start after the sort is over just leave.
  */
 static int
-px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
+sort_px_execute (THREAD_ENTRY * thread_p, SORT_PX_CONTEXT * px_context)
 {
-#define SORT_PARTITION_RUN_SIZE_MIN (ONE_M)
-
-  int ret = NO_ERROR;
-  bool old_check_interrupt;
-
-#if defined(SERVER_MODE)
-  int parent;
-  int child_right = 0;
-  int child_height;
-
-  int cmp;
-
-  int rv = NO_ERROR;
-#endif /* SERVER_MODE */
+  CSS_CONN_ENTRY *conn_p;
+  CSS_JOB_ENTRY *job_entry_p;
+  int conn_index;
+  int num_helpers, i;
+  int error;
 
-  SORT_PARAM *sort_param;
+  /* no more helpers than partitions to sort */
+  num_helpers = MIN (px_context->sort_param->px_max_threads, px_context->ready_tail - 1);
 
-  char **buff;
-  char **vector;
-  long vector_size;
+  conn_p = thread_get_current_conn_entry ();
+  conn_index = (conn_p) ? conn_p->idx : 0;
 
-  char **result = NULL;
-  long result_size = -1;
+  for (i = 0; i < num_helpers; i++)
+    {
+      /* explicit job queue index */
+      job_entry_p =
+	css_make_job_entry (conn_p, (CSS_THREAD_FN) sort_px_helper, (CSS_THREAD_ARG) px_context, conn_index + i + 1);
+      if (job_entry_p == NULL)
+	{
+	  /* go on with the helpers already queued */
+	  er_clear ();
+	  break;
+	}
 
-  assert_release (px_node != NULL);
-  assert_release (px_node->px_id >= 0);
-  assert_release (px_node->px_arg != NULL);
+      pthread_mutex_lock (&px_context->mutex);
+      px_context->ref_count++;
+      pthread_mutex_unlock (&px_context->mutex);
 
-  if (thread_p == NULL)
-    {
-      thread_p = thread_get_thread_entry_info ();
+      css_add_to_job_queue (job_entry_p);
     }
 
-  sort_param = (SORT_PARAM *) (px_node->px_arg);
+  sort_px_do_tasks (thread_p, px_context);
 
-#if defined(SERVER_MODE)
-  if (px_node->px_id > 0)
+  /* wait for the helpers still working on the memory of the sort */
+  pthread_mutex_lock (&px_context->mutex);
+  while (px_context->num_running > 0)
     {
-      /* is new childs */
-      thread_p->tran_index = px_node->px_tran_index;
-      pthread_mutex_unlock (&thread_p->tran_index_lock);
+      pthread_cond_wait (&px_context->cond, &px_context->mutex);
     }
+  error = px_context->error;
+  pthread_mutex_unlock (&px_context->mutex);
 
-#if !defined(NDEBUG)
-  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-  assert (rv == NO_ERROR);
-
-  assert (px_node->px_status == 0);
-
-  pthread_mutex_unlock (&(sort_param->px_mtx));
-#endif
-#endif /* SERVER_MODE */
-
-  old_check_interrupt = thread_set_check_interrupt (thread_p, false);
-
-  buff = px_node->px_buff;
-  vector = px_node->px_vector;
-  vector_size = px_node->px_vector_size;
-
-  assert_release (px_node->px_result == vector);
-  assert_release (px_node->px_result_size == vector_size);
-
-  result = px_node->px_result;
-  result_size = px_node->px_result_size;
-
-  assert_release (vector_size > 0);
-
-#if defined(SERVER_MODE)
-  parent = px_node->px_id & ~(1 << px_node->px_height);
-  child_height = px_node->px_height - 1;
-  if (child_height >= 0)
+  if (error != NO_ERROR)
     {
-      child_right = px_node->px_myself | (1 << child_height);
-      assert_release (child_right > 0);
+      if (px_context->er_area_length > 0)
+	{
+	  (void) er_set_area_error (px_context->er_area);
+	}
+      else if (er_errid () == NO_ERROR)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	}
     }
 
-  if (vector_size <= 1)
-    {
-      assert_release (px_node->px_result == vector);
-      assert_release (px_node->px_result_size == vector_size);
+  return error;
+}
+
+/*
+ * sort_px_helper () - Job of a helper of a parallel internal sort
+ *   return: NO_ERROR
+ *   thread_p(in):
+ *   arg(in): context of the sort
+ */
+static int
+sort_px_helper (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg)
+{
+  SORT_PX_CONTEXT *px_context = (SORT_PX_CONTEXT *) arg;
 
-      result = px_node->px_result = vector;
-      result_size = px_node->px_result_size = vector_size;
+  thread_p->tran_index = px_context->tran_index;
+  pthread_mutex_unlock (&thread_p->tran_index_lock);
 
-      /* mark as finished */
+  sort_px_do_tasks (thread_p, px_context);
 
-      rv = pthread_mutex_lock (&(sort_param->px_mtx));
-      assert (rv == NO_ERROR);
+  sort_px_release_context (px_context);
 
-      assert_release (px_node->px_status == 0);
-      px_node->px_status = 1;	/* done */
+  return NO_ERROR;
+}
 
-      pthread_mutex_unlock (&(sort_param->px_mtx));
+/*
+ * sort_px_do_tasks () - Execute the ready tasks of a parallel internal sort
+ *   return:
+ *   thread_p(in):
+ *   px_context(in): context of the sort
+ *
+ * Note: Returns when all the tasks are done or one of them failed.
+ */
+static void
+sort_px_do_tasks (THREAD_ENTRY * thread_p, SORT_PX_CONTEXT * px_context)
+{
+  SORT_PX_NODE *node, *parent;
+  int node_index;
+  int error;
+  int length;
 
-      goto exit_on_end;
-    }
+  pthread_mutex_lock (&px_context->mutex);
+  px_context->num_running++;
 
-  if (px_node->px_height > 0 && vector_size > SORT_PARTITION_RUN_SIZE_MIN)
+  for (;;)
     {
-      long left_vector_size, right_vector_size;
-      char **left_vector, **right_vector;
-      PX_TREE_NODE *left_px_node, *right_px_node;
-      int i, j, k;		// Used in the merge logic
-
-      assert_release (child_right > 0);
-
-      left_vector_size = vector_size / 2;
-      right_vector_size = vector_size - left_vector_size;
-
-      assert_release (vector_size == left_vector_size + right_vector_size);
-
-      /* do new child first */
-      right_vector = vector + left_vector_size;
-      right_px_node = px_sort_assign (thread_p, sort_param, px_node->px_id + child_right, buff + left_vector_size, right_vector, right_vector_size, child_height, 0	/* px_myself: 
-																					 * set 
-																					 * as 
-																					 * root 
-																					 */ );
-      if (right_px_node == NULL)
+      while (px_context->error == NO_ERROR && px_context->num_done < px_context->num_nodes
+	     && px_context->ready_head == px_context->ready_tail)
 	{
-	  goto exit_on_error;
+	  pthread_cond_wait (&px_context->cond, &px_context->mutex);
 	}
 
-      if (right_vector_size > 1)
+      if (px_context->error != NO_ERROR || px_context->num_done == px_context->num_nodes)
 	{
-	  /* launch new worker */
-	  if (px_sort_communicate (thread_p, right_px_node) != NO_ERROR)
-	    {
-	      goto exit_on_error;
-	    }
+	  break;
 	}
-      else
-	{
-	  /* mark as finished */
-
-	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-	  assert (rv == NO_ERROR);
 
-	  assert_release (right_px_node->px_status == 0);
-	  right_px_node->px_status = 1;	/* done */
+      node_index = px_context->ready[px_context->ready_head++];
+      pthread_mutex_unlock (&px_context->mutex);
 
-	  pthread_mutex_unlock (&(sort_param->px_mtx));
+      node = &px_context->nodes[node_index];
+      if (node->left < 0)
+	{
+	  /* partition */
+	  node->result_size = node->size;
+	  node->result =
+	    sort_run_sort (thread_p, px_context->sort_param, px_context->vector + node->start, node->size, 0,
+			   px_context->buff + node->start, &node->result_size);
+	  error = (node->result == NULL) ? ER_FAILED : NO_ERROR;
 	}
-
-      left_vector = vector;
-      left_px_node =
-	px_sort_assign (thread_p, sort_param, px_node->px_id, buff, left_vector, left_vector_size, child_height,
-			px_node->px_myself);
-      if (left_px_node == NULL)
+      else
 	{
-	  goto exit_on_error;
+	  error = sort_px_merge (px_context, node);
 	}
 
-      assert_release (px_node == left_px_node);
-#if !defined(NDEBUG)
-      rv = pthread_mutex_lock (&(sort_param->px_mtx));
-      assert (rv == NO_ERROR);
-
-      assert (px_node->px_status == 0);
-
-      pthread_mutex_unlock (&(sort_param->px_mtx));
-#endif
-
-      if (left_vector_size > 1)
+      pthread_mutex_lock (&px_context->mutex);
+      if (error != NO_ERROR)
 	{
-	  if (px_sort_myself (thread_p, left_px_node) != NO_ERROR)
+	  if (px_context->error == NO_ERROR)
 	    {
-	      goto exit_on_error;
+	      px_context->error = (er_errid () != NO_ERROR) ? er_errid () : ER_FAILED;
+	      length = sizeof (px_context->er_area);
+	      if (er_get_area_error (px_context->er_area, &length) == NULL)
+		{
+		  length = 0;
+		}
+	      px_context->er_area_length = length;
 	    }
+	  pthread_cond_broadcast (&px_context->cond);
+	  break;
 	}
 
-      /* wait for right-child finished */
-      do
+      px_context->num_done++;
+      if (node->parent >= 0)
 	{
-	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-	  assert (rv == NO_ERROR);
-
-	  if (right_px_node->px_status != 0)
+	  parent = &px_context->nodes[node->parent];
+	  if (++parent->num_done_children == 2)
 	    {
-	      assert (right_px_node->px_status == 1);
-	      pthread_mutex_unlock (&(sort_param->px_mtx));
-	      break;
+	      px_context->ready[px_context->ready_tail++] = node->parent;
 	    }
-
-	  pthread_mutex_unlock (&(sort_param->px_mtx));
-
-#if 1				/* TODO */
-	  thread_sleep (10);	/* 10 msec */
-#endif
-	}
-      while (1);
-
-      assert_release (px_node == left_px_node);
-#if !defined(NDEBUG)
-      rv = pthread_mutex_lock (&(sort_param->px_mtx));
-      assert (rv == NO_ERROR);
-
-      assert (right_px_node->px_status == 1);
-      assert (px_node->px_status == 0);
-
-      pthread_mutex_unlock (&(sort_param->px_mtx));
-#endif
-
-      right_vector = right_px_node->px_result;
-      right_vector_size = right_px_node->px_result_size;
-      if (right_vector == NULL || right_vector_size < 0)
-	{
-	  goto exit_on_error;
-	}
-
-      left_vector = left_px_node->px_result;
-      left_vector_size = left_px_node->px_result_size;
-      if (left_vector == NULL || left_vector_size < 0)
-	{
-	  goto exit_on_error;
-	}
-
-      assert_release (vector_size >= left_vector_size + right_vector_size);
-
-      result_size = px_node->px_result_size = left_vector_size + right_vector_size;
-      if (left_vector < vector)
-	{
-	  assert_release (left_vector + left_vector_size <= vector);
-	  result = px_node->px_result = vector;
-	}
-      else
-	{
-	  result = px_node->px_result = buff;
 	}
+      pthread_cond_broadcast (&px_context->cond);
+    }
 
-      /* Merge the two sub-results back into upper result */
+  px_context->num_running--;
+  pthread_cond_broadcast (&px_context->cond);
+  pthread_mutex_unlock (&px_context->mutex);
+}
 
-      i = j = k = 0;
+/*
+ * sort_px_merge () - Merge the sorted vectors of the children of a node
+ *   return: NO_ERROR or error code
+ *   px_context(in): context of the sort
+ *   node(in/out): merge task
+ *
+ * Note: The result of a node starts at or after the first slot of the
+ * node, in the vector or in the buffer. The merged keys are written from
+ * the first slot of the node into the array of the right child, or into
+ * the other array when both children are in the same one. The writes never
+ * get ahead of the keys of the right child still to be read since all the
+ * keys of the left child come before it.
+ */
+static int
+sort_px_merge (SORT_PX_CONTEXT * px_context, SORT_PX_NODE * node)
+{
+  SORT_PARAM *sort_param = px_context->sort_param;
+  SORT_PX_NODE *left = &px_context->nodes[node->left];
+  SORT_PX_NODE *right = &px_context->nodes[node->right];
+  char **left_vector = left->result, **right_vector = right->result;
+  long left_size = left->result_size, right_size = right->result_size;
+  char **left_array, **right_array, **result;
+  long i = 0, j = 0, k = 0;
+  int cmp;
 
-#if 1
-      /* STEP 2: check CON conditions if (left_max < right_min) do FORWARD-CON. we use '<' instead of '<=' */
-      cmp = (*(sort_param->cmp_fn)) (&(left_vector[left_vector_size - 1]), &(right_vector[0]), sort_param->cmp_arg);
+  left_array = SORT_PX_IS_IN_BUFF (px_context, left) ? px_context->buff : px_context->vector;
+  right_array = SORT_PX_IS_IN_BUFF (px_context, right) ? px_context->buff : px_context->vector;
 
-      if (cmp == DB_LT || cmp == DB_EQ || cmp == DB_GT)
-	{
-	  ;			/* ok */
-	}
-      else
-	{
-	  assert_release (cmp == DB_LT || cmp == DB_EQ || cmp == DB_GT);
-	  goto exit_on_error;
-	}
+  if (left_array == right_array)
+    {
+      result = ((left_array == px_context->vector) ? px_context->buff : px_context->vector) + node->start;
+    }
+  else
+    {
+      result = right_array + node->start;
+    }
 
-      if (cmp == DB_LT)
+  if ((*(sort_param->cmp_fn)) (&left_vector[left_size - 1], &right_vector[0], sort_param->cmp_arg) < 0)
+    {
+      /* already in order */
+      memmove (result, left_vector, left_size * sizeof (char *));
+      memmove (result + left_size, right_vector, right_size * sizeof (char *));
+      k = left_size + right_size;
+    }
+  else
+    {
+      while (i < left_size && j < right_size)
 	{
-	  while (i < left_vector_size)
+	  cmp = (*(sort_param->cmp_fn)) (&left_vector[i], &right_vector[j], sort_param->cmp_arg);
+	  if (cmp == DB_EQ)
 	    {
-	      result[k++] = left_vector[i++];
+	      if (sort_param->option == SORT_DUP)
+		{
+		  sort_append (&left_vector[i], &right_vector[j]);
+		}
+
+	      /* the left duplicate is appended to, or eliminated by, the right one */
+	      i++;
 	    }
-	  while (j < right_vector_size)
+	  else if (cmp == DB_GT)
 	    {
 	      result[k++] = right_vector[j++];
 	    }
-	}
-      else
-	{
-	  /* STEP 3: check CON conditions if (right_max < left_min) do BACKWARD-CON. we use '<' instead of '<=' */
-	  cmp =
-	    (*(sort_param->cmp_fn)) (&(right_vector[right_vector_size - 1]), &(left_vector[0]), sort_param->cmp_arg);
-
-	  if (cmp == DB_LT || cmp == DB_EQ || cmp == DB_GT)
+	  else if (cmp == DB_LT)
 	    {
-	      ;			/* ok */
+	      result[k++] = left_vector[i++];
 	    }
 	  else
 	    {
 	      assert_release (cmp == DB_LT || cmp == DB_EQ || cmp == DB_GT);
-	      goto exit_on_error;
-	    }
-
-	  if (cmp == DB_LT)
-	    {
-	      while (j < right_vector_size)
-		{
-		  result[k++] = right_vector[j++];
-		}
-	      while (i < left_vector_size)
-		{
-		  result[k++] = left_vector[i++];
-		}
+	      return ER_FAILED;
 	    }
-	  else
-	    {
-#endif
-	      /* STEP 4: do the actual merge */
-	      while (i < left_vector_size && j < right_vector_size)
-		{
-		  cmp = (*(sort_param->cmp_fn)) (&(left_vector[i]), &(right_vector[j]), sort_param->cmp_arg);
-
-		  if (cmp == DB_LT || cmp == DB_EQ || cmp == DB_GT)
-		    {
-		      ;		/* ok */
-		    }
-		  else
-		    {
-		      assert_release (cmp == DB_LT || cmp == DB_EQ || cmp == DB_GT);
-		      goto exit_on_error;
-		    }
-
-		  if (cmp == DB_EQ)
-		    {
-		      if (sort_param->option == SORT_DUP)	/* allow duplicate */
-			{
-			  sort_append (&(left_vector[i]), &(right_vector[j]));
-			}
-
-		      result[k++] = right_vector[j++];	/* temp */
-		      i++;	/* skip left-side dup */
-		    }
-		  else if (cmp == DB_GT)
-		    {
-		      result[k++] = right_vector[j++];
-		    }
-		  else
-		    {
-		      assert_release (cmp == DB_LT);
-		      result[k++] = left_vector[i++];
-		    }
-		}
-	      while (i < left_vector_size)
-		{
-		  result[k++] = left_vector[i++];
-		}
-	      while (j < right_vector_size)
-		{
-		  result[k++] = right_vector[j++];
-		}
-#if 1
-	    }			/* else */
-	}			/* else */
-#endif
-
-      assert_release (result_size >= k);
-
-      result_size = px_node->px_result_size = k;
-
-#if !defined(NDEBUG)
-      if (sort_validate (result, result_size, sort_param->cmp_fn, sort_param->cmp_arg) != NO_ERROR)
+	}
+      while (i < left_size)
 	{
-	  goto exit_on_error;
+	  result[k++] = left_vector[i++];
+	}
+      while (j < right_size)
+	{
+	  result[k++] = right_vector[j++];
 	}
-#endif
-    }
-  else
-    {
-      result = px_node->px_result = sort_run_sort (thread_p, sort_param, vector, vector_size, 0 /* dummy */ ,
-						   buff, &(px_node->px_result_size));
-      result_size = px_node->px_result_size;
-    }
-
-#else /* SERVER_MODE */
-
-  result = px_node->px_result = sort_run_sort (thread_p, sort_param, vector, vector_size, 0 /* dummy */ ,
-					       buff, &(px_node->px_result_size));
-  result_size = px_node->px_result_size;
-
-#endif /* SERVER_MODE */
-
-  if (result == NULL || result_size < 0)
-    {
-      assert_release (false);
-      goto exit_on_error;
-    }
-
-exit_on_end:
-
-  assert_release (result == px_node->px_result);
-  assert_release (result_size == px_node->px_result_size);
-
-#if defined(SERVER_MODE)
-  if (parent != px_node->px_id)
-    {
-      /* mark as finished */
-
-      rv = pthread_mutex_lock (&(sort_param->px_mtx));
-      assert (rv == NO_ERROR);
-
-      assert_release (px_node->px_status == 0);
-      px_node->px_status = 1;	/* done */
-
-      pthread_mutex_unlock (&(sort_param->px_mtx));
     }
-#endif /* SERVER_MODE */
-
-  (void) thread_set_check_interrupt (thread_p, old_check_interrupt);
 
-  return ret;
+  node->result = result;
+  node->result_size = k;
 
-exit_on_error:
-
-  result = px_node->px_result = NULL;
-  result_size = px_node->px_result_size = -1;
-
-  ret = (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
-
-  goto exit_on_end;
+  return NO_ERROR;
 }
+#endif /* SERVER_MODE */
 
 /*
  * sort_inphase_sort () - Internal sorting phase
@@ -2204,14 +2105,8 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
   int i;
   int error = NO_ERROR;
 
-  PX_TREE_NODE *px_node;
-  int rv = NO_ERROR;
-
   assert (sort_param->half_files <= SORT_MAX_HALF_FILES);
 
-  assert (sort_param->px_height_max >= 0);
-  assert (sort_param->px_array_size >= 1);
-
   /* Initialize the current pages of all temp files to 0 */
   for (i = 0; i < sort_param->half_files; i++)
     {
@@ -2286,37 +2181,7 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 
 	      if (sort_numrecs == 0)
 		{
-		  assert (sort_param->px_height_max >= 0);
-		  assert (sort_param->px_array_size >= 1);
-#if defined(SERVER_MODE)
-		  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-		  assert (rv == NO_ERROR);
-
-		  for (i = 0; i < sort_param->px_array_size; i++)
-		    {
-		      sort_param->px_array[i].px_status = 0;	/* init */
-		    }
-
-		  pthread_mutex_unlock (&(sort_param->px_mtx));
-#endif /* SERVER_MODE */
-
-		  px_node = px_sort_assign (thread_p, sort_param, 0, index_buff, index_area, numrecs, sort_param->px_height_max, 0	/* px_myself: 
-																	 * set 
-																	 * as 
-																	 * root 
-																	 */ );
-		  if (px_node == NULL)
-		    {
-		      goto exit_on_error;
-		    }
-
-		  if (px_sort_myself (thread_p, px_node) != NO_ERROR)
-		    {
-		      goto exit_on_error;
-		    }
-
-		  index_area = px_node->px_result;
-		  numrecs = px_node->px_result_size;
+		  index_area = sort_px_run_sort (thread_p, sort_param, index_area, numrecs, index_buff, &numrecs);
 		  *total_numrecs += numrecs;
 		}
 	      else
@@ -2535,34 +2400,7 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 
       if (sort_numrecs == 0)
 	{
-	  assert (sort_param->px_height_max >= 0);
-	  assert (sort_param->px_array_size >= 1);
-#if defined(SERVER_MODE)
-	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-	  assert (rv == NO_ERROR);
-
-	  for (i = 0; i < sort_param->px_array_size; i++)
-	    {
-	      sort_param->px_array[i].px_status = 0;	/* init */
-	    }
-
-	  pthread_mutex_unlock (&(sort_param->px_mtx));
-#endif /* SERVER_MODE */
-
-	  px_node = px_sort_assign (thread_p, sort_param, 0, index_buff, index_area, numrecs, sort_param->px_height_max,
-				    0 /* px_myself: set as root */ );
-	  if (px_node == NULL)
-	    {
-	      goto exit_on_error;
-	    }
-
-	  if (px_sort_myself (thread_p, px_node) != NO_ERROR)
-	    {
-	      goto exit_on_error;
-	    }
-
-	  index_area = px_node->px_result;
-	  numrecs = px_node->px_result_size;
+	  index_area = sort_px_run_sort (thread_p, sort_param, index_area, numrecs, index_buff, &numrecs);
 	  *total_numrecs += numrecs;
 	}
       else
@@ -4406,9 +4244,6 @@ static void
 sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 {
   int k;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
   if (sort_param == NULL)
     {
@@ -4441,20 +4276,6 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 	}
     }
 
-  if (sort_param->px_array)
-    {
-      free_and_init (sort_param->px_array);
-    }
-  sort_param->px_height_max = sort_param->px_array_size = 0;
-
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_destroy (&(sort_param->px_mtx));
-  if (rv != 0)
-    {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_DESTROY, 0);
-    }
-#endif
-
   free_and_init (sort_param);
 }
 
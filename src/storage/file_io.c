@@ -4194,6 +4194,230 @@ fileio_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID
   return io_page_array[0];
 }
 
+/*
+ * fileio_io_batch_init () - Initialize an empty batch of page requests
+ *   return: void
+ *   batch(in/out): I/O batch
+ *   page_size(in): Page size of all the requests of the batch
+ */
+void
+fileio_io_batch_init (FILEIO_IO_BATCH * batch, size_t page_size)
+{
+  batch->count = 0;
+  batch->page_size = page_size;
+}
+
+/*
+ * fileio_io_batch_add () - Add a page read or write to the batch
+ *   return: index of the request in the batch
+ *   batch(in/out): I/O batch
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(in): Page area to read into or to write from
+ *   page_id(in): Page identifier
+ *   is_write(in): true for a write request, false for a read request
+ *
+ * Note: The request is only queued; it is done by fileio_io_batch_execute.
+ *       io_page_p must stay valid until fileio_io_batch_execute returns.
+ */
+int
+fileio_io_batch_add (FILEIO_IO_BATCH * batch, int vol_fd, void *io_page_p, PAGEID page_id, bool is_write)
+{
+  FILEIO_IO_REQUEST *req;
+
+  assert (!FILEIO_IO_BATCH_IS_FULL (batch));
+
+  req = &batch->requests[batch->count];
+  req->vol_fd = vol_fd;
+  req->io_page_p = io_page_p;
+  req->page_id = page_id;
+  req->is_write = is_write;
+  req->status = FILEIO_IO_REQUEST_QUEUED;
+
+  return batch->count++;
+}
+
+#if defined (LINUX)
+/*
+ * fileio_io_batch_do_run () - Read or write contiguous pages of the batch
+ *                             with one vectored I/O
+ *   return: true if all the pages were transferred
+ *   batch(in/out): I/O batch
+ *   order(in): indexes of the requests of the run, in page order
+ *   num_pages(in): Number of requests of the run
+ *
+ * Note: The requests of the run are on the same volume, of the same kind,
+ *       and their pages follow each other. The status of the requests is
+ *       changed only when the whole run succeeded.
+ */
+static bool
+fileio_io_batch_do_run (THREAD_ENTRY * thread_p, FILEIO_IO_BATCH * batch, const int *order, int num_pages)
+{
+  struct iovec iov[FILEIO_IO_BATCH_MAX_REQUESTS];
+  FILEIO_IO_REQUEST *first_req = &batch->requests[order[0]];
+  off_t offset = FILEIO_GET_FILE_SIZE (batch->page_size, first_req->page_id);
+  size_t remain_bytes = batch->page_size * (size_t) num_pages;
+  ssize_t nbytes;
+  int iov_idx, i;
+
+  for (i = 0; i < num_pages; i++)
+    {
+      iov[i].iov_base = batch->requests[order[i]].io_page_p;
+      iov[i].iov_len = batch->page_size;
+    }
+
+  iov_idx = 0;
+  while (remain_bytes > 0)
+    {
+      if (first_req->is_write)
+	{
+	  nbytes = pwritev (first_req->vol_fd, &iov[iov_idx], num_pages - iov_idx, offset);
+	}
+      else
+	{
+	  nbytes = preadv (first_req->vol_fd, &iov[iov_idx], num_pages - iov_idx, offset);
+	}
+
+      if (nbytes <= 0)
+	{
+	  if (nbytes < 0 && errno == EINTR)
+	    {
+	      continue;
+	    }
+	  /* the pages are retried one by one, which reports the error of each page */
+	  return false;
+	}
+
+      offset += nbytes;
+      remain_bytes -= nbytes;
+
+      /* skip what was transferred, for a short read or write */
+      while (iov_idx < num_pages && (size_t) nbytes >= iov[iov_idx].iov_len)
+	{
+	  nbytes -= iov[iov_idx].iov_len;
+	  iov_idx++;
+	}
+      if (iov_idx < num_pages)
+	{
+	  iov[iov_idx].iov_base = (char *) iov[iov_idx].iov_base + nbytes;
+	  iov[iov_idx].iov_len -= nbytes;
+	}
+    }
+
+  for (i = 0; i < num_pages; i++)
+    {
+      batch->requests[order[i]].status = FILEIO_IO_REQUEST_DONE;
+    }
+
+  if (first_req->is_write)
+    {
+      fileio_compensate_flush (thread_p, first_req->vol_fd, num_pages);
+      mnt_file_iowrites (thread_p, num_pages);
+    }
+  else
+    {
+      for (i = 0; i < num_pages; i++)
+	{
+	  mnt_file_ioreads (thread_p);
+	}
+    }
+
+  return true;
+}
+#endif /* LINUX */
+
+/*
+ * fileio_io_batch_execute () - Do all the requests of the batch
+ *   return: NO_ERROR if every request succeeded, ER_FAILED otherwise
+ *   batch(in/out): I/O batch
+ *
+ * Note: The requests are sorted by volume and page. On Linux, each run of
+ *       contiguous pages of a volume is read or written with one
+ *       preadv/pwritev, so neighbor and sequential victim pages become one
+ *       large I/O. A single page, and every page on the other platforms,
+ *       uses fileio_read/fileio_write. A run whose vectored I/O fails is
+ *       retried page by page, to find the pages that failed.
+ *       The status of each request is left as FILEIO_IO_REQUEST_DONE or
+ *       FILEIO_IO_REQUEST_FAILED, so the caller can handle the failed ones.
+ */
+int
+fileio_io_batch_execute (THREAD_ENTRY * thread_p, FILEIO_IO_BATCH * batch)
+{
+  FILEIO_IO_REQUEST *req, *prev_req;
+  int order[FILEIO_IO_BATCH_MAX_REQUESTS];
+  void *io_page_p;
+  int run_start, run_length;
+  int i, j, tmp;
+  int error = NO_ERROR;
+
+  /* insertion sort of at most FILEIO_IO_BATCH_MAX_REQUESTS requests by volume and page */
+  for (i = 0; i < batch->count; i++)
+    {
+      order[i] = i;
+      for (j = i; j > 0; j--)
+	{
+	  prev_req = &batch->requests[order[j - 1]];
+	  req = &batch->requests[order[j]];
+	  if (prev_req->vol_fd < req->vol_fd
+	      || (prev_req->vol_fd == req->vol_fd && prev_req->page_id <= req->page_id))
+	    {
+	      break;
+	    }
+	  tmp = order[j - 1];
+	  order[j - 1] = order[j];
+	  order[j] = tmp;
+	}
+    }
+
+  for (run_start = 0; run_start < batch->count; run_start += run_length)
+    {
+      /* find the pages that follow the first one of the run */
+      run_length = 1;
+      while (run_start + run_length < batch->count)
+	{
+	  prev_req = &batch->requests[order[run_start + run_length - 1]];
+	  req = &batch->requests[order[run_start + run_length]];
+	  if (req->vol_fd != prev_req->vol_fd || req->is_write != prev_req->is_write
+	      || req->page_id != prev_req->page_id + 1)
+	    {
+	      break;
+	    }
+	  run_length++;
+	}
+
+#if defined (LINUX)
+      if (run_length > 1 && fileio_io_batch_do_run (thread_p, batch, &order[run_start], run_length))
+	{
+	  continue;
+	}
+#endif /* LINUX */
+
+      for (i = run_start; i < run_start + run_length; i++)
+	{
+	  req = &batch->requests[order[i]];
+	  if (req->is_write)
+	    {
+	      io_page_p = fileio_write (thread_p, req->vol_fd, req->io_page_p, req->page_id, batch->page_size);
+	    }
+	  else
+	    {
+	      io_page_p = fileio_read (thread_p, req->vol_fd, req->io_page_p, req->page_id, batch->page_size);
+	    }
+
+	  if (io_page_p != NULL)
+	    {
+	      req->status = FILEIO_IO_REQUEST_DONE;
+	    }
+	  else
+	    {
+	      req->status = FILEIO_IO_REQUEST_FAILED;
+	      error = ER_FAILED;
+	    }
+	}
+    }
+
+  return error;
+}
+
 /*
  * fileio_synchronize () - Synchronize a database volume's state with that on disk
  *   return: vdes or NULL_VOLDES
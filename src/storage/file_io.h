@@ -85,6 +85,11 @@
 #define FILEIO_VOLLOCK_SUFFIX        "__lock"
 #define FILEIO_MAX_SUFFIX_LENGTH     7
 
+/* Maximum number of page requests of an I/O batch */
+#define FILEIO_IO_BATCH_MAX_REQUESTS 32
+
+#define FILEIO_IO_BATCH_IS_FULL(batch) ((batch)->count >= FILEIO_IO_BATCH_MAX_REQUESTS)
+
 typedef enum
 {
   FILEIO_BACKUP_FULL_LEVEL = 0,	/* Full backup */
@@ -367,6 +372,33 @@ struct io_backup_session
   int sleep_msecs;		/* sleep internval in msecs */
 };
 
+typedef enum
+{
+  FILEIO_IO_REQUEST_QUEUED,	/* added to the batch, not done yet */
+  FILEIO_IO_REQUEST_DONE,
+  FILEIO_IO_REQUEST_FAILED
+} FILEIO_IO_REQUEST_STATUS;
+
+typedef struct fileio_io_request FILEIO_IO_REQUEST;
+struct fileio_io_request
+{
+  int vol_fd;			/* Volume descriptor */
+  void *io_page_p;		/* Page area to read into or to write from */
+  PAGEID page_id;
+  bool is_write;
+  FILEIO_IO_REQUEST_STATUS status;
+};
+
+/* A set of page reads/writes which are done together. The pages that follow each other on a volume are read or
+ * written with one vectored I/O (see fileio_io_batch_execute). */
+typedef struct fileio_io_batch FILEIO_IO_BATCH;
+struct fileio_io_batch
+{
+  int count;			/* Number of requests in the batch */
+  size_t page_size;
+  FILEIO_IO_REQUEST requests[FILEIO_IO_BATCH_MAX_REQUESTS];
+};
+
 typedef struct token_bucket TOKEN_BUCKET;
 struct token_bucket
 {
@@ -415,6 +447,9 @@ extern void *fileio_write_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_p
 				 size_t page_size);
 extern void *fileio_writev (THREAD_ENTRY * thread_p, int vdes, void **arrayof_io_pgptr, PAGEID start_pageid,
 			    DKNPAGES npages, size_t page_size);
+extern void fileio_io_batch_init (FILEIO_IO_BATCH * batch, size_t page_size);
+extern int fileio_io_batch_add (FILEIO_IO_BATCH * batch, int vol_fd, void *io_page_p, PAGEID page_id, bool is_write);
+extern int fileio_io_batch_execute (THREAD_ENTRY * thread_p, FILEIO_IO_BATCH * batch);
 extern int fileio_synchronize (THREAD_ENTRY * thread_p, int vdes, const char *vlabel);
 extern int fileio_synchronize_all (THREAD_ENTRY * thread_p, bool include_log);
 #if defined (ENABLE_UNUSED_FUNCTION)
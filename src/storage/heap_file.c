@@ -129,6 +129,12 @@ static int rv;
 #define HEAP_DEBUG_ISVALID_SCANRANGE(scan_range) (DISK_VALID)
 #endif /* !CUBRID_DEBUG */
 
+/* A scanrange covers objects of a single page; heap_next may walk to the following page of the heap chain, which
+ * does not necessarily have a greater page identifier. */
+#define HEAP_SCANRANGE_IS_PASSED(oid, scan_range) \
+  (OID_GT ((oid), &(scan_range)->last_oid) \
+   || (oid)->pageid != (scan_range)->last_oid.pageid || (oid)->volid != (scan_range)->last_oid.volid)
+
 #define HEAP_IS_PAGE_OF_OID(pgptr, oid) \
   (((pgptr) != NULL) \
    && pgbuf_get_volume_id (pgptr) == (oid)->volid \
@@ -9714,7 +9720,7 @@ heap_scanrange_next (THREAD_ENTRY * thread_p, OID * next_oid, RECDES * recdes, H
 		       recdes, &scan_range->scan_cache, ispeeking);
 	}
       /* Make sure that we did not go overboard */
-      if (scan == S_SUCCESS && OID_GT (next_oid, &scan_range->last_oid))
+      if (scan == S_SUCCESS && HEAP_SCANRANGE_IS_PASSED (next_oid, scan_range))
 	{
 	  OID_SET_NULL (next_oid);
 	  scan = S_END;
@@ -9734,7 +9740,7 @@ heap_scanrange_next (THREAD_ENTRY * thread_p, OID * next_oid, RECDES * recdes, H
 	    heap_next (thread_p, &scan_range->scan_cache.node.hfid, &scan_range->scan_cache.node.class_oid, next_oid,
 		       recdes, &scan_range->scan_cache, ispeeking);
 	  /* Make sure that we did not go overboard */
-	  if (scan == S_SUCCESS && OID_GT (next_oid, &scan_range->last_oid))
+	  if (scan == S_SUCCESS && HEAP_SCANRANGE_IS_PASSED (next_oid, scan_range))
 	    {
 	      OID_SET_NULL (next_oid);
 	      scan = S_END;
@@ -9904,6 +9910,185 @@ heap_scanrange_last (THREAD_ENTRY * thread_p, OID * last_oid, RECDES * recdes, H
   return scan;
 }
 
+/*
+ * heap_parallel_scan_init () - Initialize the page cursor of a parallel heap scan
+ *   return: NO_ERROR, or ER_code
+ *   px_scan(out): Parallel heap scan
+ *   hfid(in): Heap file identifier
+ *
+ * Note: The cursor starts at the heap header page. Any number of scanners,
+ * each one with its own scanrange, may share the cursor. See
+ * heap_parallel_scan_next_range.
+ */
+int
+heap_parallel_scan_init (HEAP_PARALLEL_SCAN * px_scan, const HFID * hfid)
+{
+  HFID_COPY (&px_scan->hfid, hfid);
+  px_scan->next_vpid.volid = hfid->vfid.volid;
+  px_scan->next_vpid.pageid = hfid->hpgid;
+  px_scan->num_pages = 0;
+
+#if defined(SERVER_MODE)
+  if (pthread_mutex_init (&px_scan->mutex, NULL) != 0)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_INIT, 0);
+      return ER_CSS_PTHREAD_MUTEX_INIT;
+    }
+#endif /* SERVER_MODE */
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_parallel_scan_destroy () - Destroy the page cursor of a parallel heap scan
+ *   return:
+ *   px_scan(in): Parallel heap scan
+ *
+ * Note: None of the scanners may use the cursor anymore.
+ */
+void
+heap_parallel_scan_destroy (HEAP_PARALLEL_SCAN * px_scan)
+{
+  VPID_SET_NULL (&px_scan->next_vpid);
+
+#if defined(SERVER_MODE)
+  pthread_mutex_destroy (&px_scan->mutex);
+#endif /* SERVER_MODE */
+}
+
+/*
+ * heap_parallel_scan_stop () - Stop handing out pages of a parallel heap scan
+ *   return:
+ *   px_scan(in/out): Parallel heap scan
+ *
+ * Note: The scanners get S_END on their next request of a scanrange.
+ */
+void
+heap_parallel_scan_stop (HEAP_PARALLEL_SCAN * px_scan)
+{
+#if defined(SERVER_MODE)
+  (void) pthread_mutex_lock (&px_scan->mutex);
+#endif /* SERVER_MODE */
+
+  VPID_SET_NULL (&px_scan->next_vpid);
+
+#if defined(SERVER_MODE)
+  pthread_mutex_unlock (&px_scan->mutex);
+#endif /* SERVER_MODE */
+}
+
+/*
+ * heap_parallel_scan_next_range () - Define the scanrange over the next page of a parallel heap scan
+ *   return: SCAN_CODE
+ *           (Either of S_SUCCESS, S_END, S_ERROR)
+ *   px_scan(in/out): Parallel heap scan shared by all the scanners
+ *   scan_range(in/out): Scanrange of the caller
+ *
+ * Note: The next page of the heap chain is taken from the shared cursor and
+ * the scanrange is defined as the objects of that page. Every page is handed
+ * out to exactly one scanner. Pages without objects are skipped. Only the
+ * walk of the page chain is serialized; the objects of the scanrange are
+ * retrieved with heap_scanrange_next as usual.
+ */
+SCAN_CODE
+heap_parallel_scan_next_range (THREAD_ENTRY * thread_p, HEAP_PARALLEL_SCAN * px_scan, HEAP_SCANRANGE * scan_range)
+{
+  PGBUF_WATCHER pg_watcher;
+  VPID vpid;
+  RECDES recdes;
+  INT16 slotid;
+  INT16 type;
+  bool found = false;
+  int ret;
+
+  if (HEAP_DEBUG_ISVALID_SCANRANGE (scan_range) != DISK_VALID)
+    {
+      return S_ERROR;
+    }
+
+  /* the page of the previous scanrange is not needed anymore */
+  if (scan_range->scan_cache.page_watcher.pgptr != NULL)
+    {
+      pgbuf_ordered_unfix (thread_p, &scan_range->scan_cache.page_watcher);
+    }
+
+  PGBUF_INIT_WATCHER (&pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, &px_scan->hfid);
+
+  while (!found)
+    {
+#if defined(SERVER_MODE)
+      (void) pthread_mutex_lock (&px_scan->mutex);
+#endif /* SERVER_MODE */
+
+      vpid = px_scan->next_vpid;
+      if (VPID_ISNULL (&vpid))
+	{
+#if defined(SERVER_MODE)
+	  pthread_mutex_unlock (&px_scan->mutex);
+#endif /* SERVER_MODE */
+	  OID_SET_NULL (&scan_range->first_oid);
+	  OID_SET_NULL (&scan_range->last_oid);
+	  return S_END;
+	}
+
+      ret = pgbuf_ordered_fix (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, PGBUF_LATCH_READ, &pg_watcher);
+      if (ret != NO_ERROR)
+	{
+#if defined(SERVER_MODE)
+	  pthread_mutex_unlock (&px_scan->mutex);
+#endif /* SERVER_MODE */
+	  return S_ERROR;
+	}
+
+      (void) pgbuf_check_page_ptype (thread_p, pg_watcher.pgptr, PAGE_HEAP);
+
+      /* advance the cursor, the page itself is examined after releasing it */
+      ret = heap_vpid_next (&px_scan->hfid, pg_watcher.pgptr, &px_scan->next_vpid);
+      px_scan->num_pages++;
+
+#if defined(SERVER_MODE)
+      pthread_mutex_unlock (&px_scan->mutex);
+#endif /* SERVER_MODE */
+
+      if (ret != NO_ERROR)
+	{
+	  pgbuf_ordered_unfix (thread_p, &pg_watcher);
+	  return S_ERROR;
+	}
+
+      /* the scanrange goes from the first to the last object of the page */
+      slotid = HEAP_HEADER_AND_CHAIN_SLOTID;
+      while (spage_next_record (pg_watcher.pgptr, &slotid, &recdes, PEEK) == S_SUCCESS)
+	{
+	  if (slotid == HEAP_HEADER_AND_CHAIN_SLOTID)
+	    {
+	      continue;
+	    }
+	  type = spage_get_record_type (pg_watcher.pgptr, slotid);
+	  if (type == REC_NEWHOME || type == REC_ASSIGN_ADDRESS || type == REC_UNKNOWN)
+	    {
+	      /* not an object; relocated records are reached through their home slot */
+	      continue;
+	    }
+
+	  if (!found)
+	    {
+	      scan_range->first_oid.volid = vpid.volid;
+	      scan_range->first_oid.pageid = vpid.pageid;
+	      scan_range->first_oid.slotid = slotid;
+	      found = true;
+	    }
+	  scan_range->last_oid.volid = vpid.volid;
+	  scan_range->last_oid.pageid = vpid.pageid;
+	  scan_range->last_oid.slotid = slotid;
+	}
+
+      pgbuf_ordered_unfix (thread_p, &pg_watcher);
+    }
+
+  return S_SUCCESS;
+}
+
 /*
  * heap_does_exist () - Does object exist?
  *   return: true/false
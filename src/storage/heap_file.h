@@ -147,6 +147,18 @@ struct heap_scanrange
   HEAP_SCANCACHE scan_cache;	/* Current cached information from previous scan */
 };
 
+typedef struct heap_parallel_scan HEAP_PARALLEL_SCAN;
+struct heap_parallel_scan
+{				/* Page cursor shared by the scanners of a parallel heap scan. Every scanner gets its
+				 * scanranges from the cursor, one heap page at a time, following the heap page chain. */
+  HFID hfid;			/* Heap file identifier */
+  VPID next_vpid;		/* Next page to be handed out or NULL when the heap is exhausted */
+  int num_pages;		/* Number of pages handed out so far */
+#if defined(SERVER_MODE)
+  pthread_mutex_t mutex;	/* Protects next_vpid and num_pages */
+#endif				/* SERVER_MODE */
+};
+
 typedef struct heap_hfid_table HEAP_HFID_TABLE;
 struct heap_hfid_table
 {
@@ -428,6 +440,11 @@ extern SCAN_CODE heap_scanrange_first (THREAD_ENTRY * thread_p, OID * first_oid,
 				       HEAP_SCANRANGE * scan_range, int ispeeking);
 extern SCAN_CODE heap_scanrange_last (THREAD_ENTRY * thread_p, OID * last_oid, RECDES * recdes,
 				      HEAP_SCANRANGE * scan_range, int ispeeking);
+extern int heap_parallel_scan_init (HEAP_PARALLEL_SCAN * px_scan, const HFID * hfid);
+extern void heap_parallel_scan_destroy (HEAP_PARALLEL_SCAN * px_scan);
+extern void heap_parallel_scan_stop (HEAP_PARALLEL_SCAN * px_scan);
+extern SCAN_CODE heap_parallel_scan_next_range (THREAD_ENTRY * thread_p, HEAP_PARALLEL_SCAN * px_scan,
+						HEAP_SCANRANGE * scan_range);
 
 extern bool heap_does_exist (THREAD_ENTRY * thread_p, OID * class_oid, const OID * oid);
 extern bool heap_is_object_not_null (THREAD_ENTRY * thread_p, OID * class_oid, const OID * oid);
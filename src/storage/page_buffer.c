@@ -142,6 +142,12 @@ static int rv;
   ((PGBUF_IOPAGE_BUFFER *)((char *)&(pgbuf_Pool.iopage_table[0]) \
   +(PGBUF_IOPAGE_BUFFER_SIZE*(i))))
 
+/* NUMA node of buffer frame; buffers are split in equal ranges of consecutive buffers, one per node */
+#define PGBUF_BCB_NUMA_NODE(bufptr) \
+  ((int) (((INT64) (bufptr)->ipool * pgbuf_Pool.num_numa_nodes) / pgbuf_Pool.num_buffers))
+#define PGBUF_NUMA_NODE_FIRST_BUFFER(node) \
+  ((int) (((INT64) (node) * pgbuf_Pool.num_buffers + pgbuf_Pool.num_numa_nodes - 1) / pgbuf_Pool.num_numa_nodes))
+
 #define PGBUF_FIND_BUFFER_GUARD(bufptr) \
   (&bufptr->iopage_buffer->iopage.page[DB_PAGESIZE])
 
@@ -229,6 +235,27 @@ static int rv;
 #define MUTEX_LOCK_VIA_BUSY_WAIT(rv, m)
 #endif /* SERVER_MODE */
 
+/* Lock the mutex of an LRU list. Acquisitions that cannot be done at the
+ * first try are counted as LRU mutex waits. */
+#if defined(SERVER_MODE)
+#define PGBUF_LRU_LIST_LOCK(rv, lru_list) \
+  do \
+    { \
+      rv = pthread_mutex_trylock (&(lru_list)->LRU_mutex); \
+      if (rv != 0) \
+	{ \
+	  mnt_pb_lru_mutex_waits (NULL); \
+	  MUTEX_LOCK_VIA_BUSY_WAIT (rv, (lru_list)->LRU_mutex); \
+	} \
+    } \
+  while (0)
+#else /* SERVER_MODE */
+#define PGBUF_LRU_LIST_LOCK(rv, lru_list)
+#endif /* SERVER_MODE */
+
+/* maximum number of LRU lists a thread looks at when it needs a victim */
+#define PGBUF_VICTIM_LRU_PROBE_COUNT 4
+
 #define INIT_HOLDER_STAT(perf_stat) \
         do { \
             (perf_stat)->dirty_before_hold = 0; \
@@ -366,6 +393,25 @@ struct pgbuf_batch_flush_helper
   VPID vpids[2 * PGBUF_MAX_NEIGHBOR_PAGES - 1];
 };
 
+typedef struct pgbuf_flush_io_batch PGBUF_FLUSH_IO_BATCH;
+
+/* Pages written by the victim flush are copied here and written together, so that contiguous pages are written with
+ * one I/O and the log is forced only once per batch. There is one batch for the pool; it is used only by the thread
+ * holding pgbuf_Pool.victim_flush_mutex, which picks the slot of each page and writes the batch. */
+struct pgbuf_flush_io_batch
+{
+  FILEIO_IO_BATCH io;		/* one write request for each page */
+  PGBUF_BCB *bufptr[FILEIO_IO_BATCH_MAX_REQUESTS];	/* BCB of each page */
+  bool was_dirty[FILEIO_IO_BATCH_MAX_REQUESTS];	/* false for a non-dirty neighbor page */
+  LOG_LSA oldest_unflush_lsa[FILEIO_IO_BATCH_MAX_REQUESTS];	/* restored if the write of a dirty page fails */
+  LOG_LSA max_page_lsa;		/* WAL: log is flushed up to here before the writes */
+  char *page_area;		/* aligned copies of the pages, IO_PAGESIZE each */
+  char *page_area_alloc;
+#if defined (SERVER_MODE)
+  THREAD_ENTRY *owner;		/* victim flusher using the batch */
+#endif
+};
+
 /* BCB holder entry */
 struct pgbuf_holder
 {
@@ -426,6 +472,7 @@ struct pgbuf_bcb
   unsigned victim_candidate:1;
   LOG_LSA oldest_unflush_lsa;	/* The oldest LSA record of the page that has not been written to disk */
   PGBUF_IOPAGE_BUFFER *iopage_buffer;	/* pointer to iopage buffer structure */
+  void *latch_site;		/* call site of the last fix, reported to the waiters of the latch */
 };
 
 /* iopage buffer structure */
@@ -580,6 +627,8 @@ struct pgbuf_buffer_pool
   PGBUF_BUFFER_LOCK *buf_lock_table;	/* buffer lock table */
   PGBUF_IOPAGE_BUFFER *iopage_table;	/* IO page table */
   int num_LRU_list;		/* number of LRU lists */
+  int num_numa_nodes;		/* number of NUMA nodes buffers are bound to; 1 if not NUMA aware */
+  int num_LRU_list_per_node;	/* LRU lists of the buffers of each NUMA node */
   int num_LRU1_zone_threshold;	/* target number of pages in LRU1 zone */
   int last_flushed_LRU_list_idx;	/* index of the last flushed LRU list */
   PGBUF_LRU_LIST *buf_LRU_list;	/* LRU lists */
@@ -622,6 +671,7 @@ struct pgbuf_buffer_pool
 
 #if defined(SERVER_MODE)
   bool is_flushing_victims;	/* flag set true when pgbuf flush thread is flushing victim candidates */
+  pthread_mutex_t victim_flush_mutex;	/* only one thread at a time flushes victim candidates */
   pthread_mutex_t volinfo_mutex;
 #endif				/* SERVER_MODE */
   VOLID last_perm_volid;	/* last perm. volume id */
@@ -695,6 +745,7 @@ struct pgbuf_ps_info
 
 static PGBUF_BUFFER_POOL pgbuf_Pool;	/* The buffer Pool */
 static PGBUF_BATCH_FLUSH_HELPER pgbuf_Flush_helper;
+static PGBUF_FLUSH_IO_BATCH pgbuf_Flush_io_batch;
 
 HFID *pgbuf_ordered_null_hfid = NULL;
 
@@ -770,7 +821,8 @@ static int pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_BCB * bu
 static int pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE request_mode,
 			    int request_fcnt, bool as_promote);
 #endif /* NDEBUG */
-static PGBUF_BCB *pgbuf_search_hash_chain (PGBUF_BUFFER_HASH * hash_anchor, const VPID * vpid);
+static PGBUF_BCB *pgbuf_search_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor,
+					   const VPID * vpid);
 static int pgbuf_insert_into_hash_chain (PGBUF_BUFFER_HASH * hash_anchor, PGBUF_BCB * bufptr);
 static int pgbuf_delete_from_hash_chain (PGBUF_BCB * bufptr);
 static int pgbuf_lock_page (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor, const VPID * vpid);
@@ -789,12 +841,14 @@ static int pgbuf_flush_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int syn
 static int pgbuf_invalidate_bcb (PGBUF_BCB * bufptr);
 static PGBUF_BCB *pgbuf_get_bcb_from_invalid_list (void);
 static int pgbuf_put_bcb_into_invalid_list (PGBUF_BCB * bufptr);
-static int pgbuf_get_lru_index (const VPID * vpid);
+static int pgbuf_get_lru_index (const VPID * vpid, int numa_node);
+static int pgbuf_get_thread_numa_node (THREAD_ENTRY * thread_p);
 static int pgbuf_get_victim_candidates_from_ain (int check_count);
 static int pgbuf_get_victim_candidates_from_lru (int check_count, int victim_count);
-static PGBUF_BCB *pgbuf_get_victim (THREAD_ENTRY * thread_p, const VPID * vpid, int max_count);
+static PGBUF_BCB *pgbuf_get_victim (THREAD_ENTRY * thread_p, const VPID * vpid, int numa_node, int max_count);
 static PGBUF_BCB *pgbuf_get_victim_from_ain_list (THREAD_ENTRY * thread_p, int max_count);
-static PGBUF_BCB *pgbuf_get_victim_from_lru_list (THREAD_ENTRY * thread_p, const VPID * vpid, int max_count);
+static PGBUF_BCB *pgbuf_get_victim_from_lru_list (THREAD_ENTRY * thread_p, const VPID * vpid, int numa_node,
+						   int max_count);
 static void pgbuf_add_vpid_to_aout_list (THREAD_ENTRY * thread_p, const VPID * vpid);
 static bool pgbuf_remove_vpid_from_aout_list (THREAD_ENTRY * thread_p, const VPID * vpid);
 static int pgbuf_invalidate_bcb_from_lru (PGBUF_BCB * bufptr);
@@ -878,6 +932,8 @@ static int pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB
 static void pgbuf_add_bufptr_to_batch (PGBUF_BCB * bufptr, int idx);
 static int pgbuf_flush_neighbor_safe (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, VPID * expected_vpid,
 				      bool * flushed);
+static int pgbuf_flush_io_batch_add (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
+static int pgbuf_flush_io_batch_complete (THREAD_ENTRY * thread_p);
 
 static int pgbuf_get_groupid_and_unfix (THREAD_ENTRY * thread_p, const VPID * req_vpid, PAGE_PTR * pgptr,
 					VPID * groupid, bool do_unfix);
@@ -990,6 +1046,13 @@ pgbuf_initialize (void)
       pgbuf_Pool.num_buffers = PGBUF_MINIMUM_BUFFERS;
     }
 
+  pgbuf_Pool.num_numa_nodes = 1;
+  if (prm_get_bool_value (PRM_ID_PB_NUMA_AWARE))
+    {
+      pgbuf_Pool.num_numa_nodes = MIN (os_numa_get_node_count (), pgbuf_Pool.num_buffers / PGBUF_MINIMUM_BUFFERS);
+      pgbuf_Pool.num_numa_nodes = MAX (pgbuf_Pool.num_numa_nodes, 1);
+    }
+
   if (pgbuf_initialize_bcb_table () != NO_ERROR)
     {
       goto error;
@@ -1032,6 +1095,9 @@ pgbuf_initialize (void)
 
   pgbuf_Pool.check_for_interrupts = false;
   pthread_mutex_init (&pgbuf_Pool.volinfo_mutex, NULL);
+#if defined (SERVER_MODE)
+  pthread_mutex_init (&pgbuf_Pool.victim_flush_mutex, NULL);
+#endif
   pgbuf_Pool.last_perm_volid = LOG_MAX_DBVOLID;
   pgbuf_Pool.num_permvols_tmparea = 0;
   pgbuf_Pool.size_permvols_tmparea_volids = 0;
@@ -1046,6 +1112,20 @@ pgbuf_initialize (void)
       goto error;
     }
 
+  pgbuf_Flush_io_batch.page_area_alloc = (char *) malloc (FILEIO_IO_BATCH_MAX_REQUESTS * IO_PAGESIZE + MAX_ALIGNMENT);
+  if (pgbuf_Flush_io_batch.page_area_alloc == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) (FILEIO_IO_BATCH_MAX_REQUESTS * IO_PAGESIZE + MAX_ALIGNMENT));
+      goto error;
+    }
+  pgbuf_Flush_io_batch.page_area = PTR_ALIGN (pgbuf_Flush_io_batch.page_area_alloc, MAX_ALIGNMENT);
+  fileio_io_batch_init (&pgbuf_Flush_io_batch.io, IO_PAGESIZE);
+  LSA_SET_NULL (&pgbuf_Flush_io_batch.max_page_lsa);
+#if defined (SERVER_MODE)
+  pgbuf_Flush_io_batch.owner = NULL;
+#endif
+
   pgbuf_Pool.lru_victim_req_cnt = 0;
   pgbuf_Pool.ain_victim_req_cnt = 0;
   pgbuf_Pool.fix_req_cnt = 0;
@@ -1179,6 +1259,9 @@ pgbuf_finalize (void)
 
   /* final task for volume info */
   pthread_mutex_destroy (&pgbuf_Pool.volinfo_mutex);
+#if defined (SERVER_MODE)
+  pthread_mutex_destroy (&pgbuf_Pool.victim_flush_mutex);
+#endif
   area = pgbuf_Pool.permvols_tmparea_volids;
   if (area != NULL)
     {
@@ -1193,6 +1276,12 @@ pgbuf_finalize (void)
       free_and_init (pgbuf_Pool.victim_cand_list);
     }
 
+  if (pgbuf_Flush_io_batch.page_area_alloc != NULL)
+    {
+      free_and_init (pgbuf_Flush_io_batch.page_area_alloc);
+      pgbuf_Flush_io_batch.page_area = NULL;
+    }
+
   pthread_mutex_destroy (&pgbuf_Pool.buf_AIN_list.Ain_mutex);
 
   if (pgbuf_Pool.buf_AOUT_list.bufarray != NULL)
@@ -1436,7 +1525,7 @@ try_again:
   hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)];
 
   buf_lock_acquired = false;
-  bufptr = pgbuf_search_hash_chain (hash_anchor, vpid);
+  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid);
   if (bufptr != NULL)
     {
 #if defined (ENABLE_SYSTEMTAP)
@@ -1444,6 +1533,12 @@ try_again:
       pgbuf_hit = true;
 #endif /* ENABLE_SYSTEMTAP */
 
+      if (pgbuf_Pool.num_numa_nodes > 1)
+	{
+	  mnt_pb_numa_fix (thread_p, PGBUF_BCB_NUMA_NODE (bufptr), true,
+			   PGBUF_BCB_NUMA_NODE (bufptr) != pgbuf_get_thread_numa_node (thread_p));
+	}
+
       if (fetch_mode == NEW_PAGE)
 	{
 	  /* Fix a page as NEW_PAGE, when oldest_unflush_lsa of the page is not NULL_LSA, it should be dirty. */
@@ -1535,6 +1630,11 @@ try_again:
 	{
 	  /* Record number of reads in statistics */
 	  mnt_pb_ioreads (thread_p);
+	  if (pgbuf_Pool.num_numa_nodes > 1)
+	    {
+	      mnt_pb_numa_fix (thread_p, PGBUF_BCB_NUMA_NODE (bufptr), false,
+			       PGBUF_BCB_NUMA_NODE (bufptr) != pgbuf_get_thread_numa_node (thread_p));
+	    }
 
 #if defined(ENABLE_SYSTEMTAP)
 	  query_id = qmgr_get_current_query_id (thread_p);
@@ -1710,6 +1810,7 @@ try_again:
     }
 
   assert (bufptr == bufptr->iopage_buffer->bcb);
+  bufptr->latch_site = SYNC_CALLER_SITE ();
 
   /* In case of NO_ERROR, bufptr->BCB_mutex has been released. */
 
@@ -2523,7 +2624,7 @@ pgbuf_invalidate_temporary_file (VOLID volid, PAGEID first_pageid, DKNPAGES npag
 
       /* fix page */
       hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (&vpid)];
-      bufptr = pgbuf_search_hash_chain (hash_anchor, &vpid);
+      bufptr = pgbuf_search_hash_chain (NULL, hash_anchor, &vpid);
       if (bufptr == NULL)
 	{
 	  pthread_mutex_unlock (&hash_anchor->hash_mutex);
@@ -3051,7 +3152,13 @@ pgbuf_get_victim_candidates_from_lru (int check_count, int victim_count)
  *   return: NO_ERROR, or ER_code
  *
  * Note: This function flushes at most VictimCleanCount buffers that might
- *       become victim candidates in the near future.
+ *       become victim candidates in the near future. The pages are written in
+ *       batches of up to FILEIO_IO_BATCH_MAX_REQUESTS pages (see
+ *       pgbuf_flush_io_batch_complete).
+ *       Without the page flush thread, e.g. during a parallel restart
+ *       recovery, any thread that finds no victim calls this function. The
+ *       victim candidate list and the neighbor flush helper are shared, so
+ *       a caller returns at once while another thread is flushing.
  */
 #if !defined(NDEBUG)
 int
@@ -3081,6 +3188,21 @@ pgbuf_flush_victim_candidate (THREAD_ENTRY * thread_p, float flush_ratio)
   static THREAD_ENTRY *page_flush_thread = NULL;
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  if (pthread_mutex_trylock (&pgbuf_Pool.victim_flush_mutex) != 0)
+    {
+      /* the pages flushed by the other thread will be victims for this one too */
+      return NO_ERROR;
+    }
+  assert (pgbuf_Flush_io_batch.owner == NULL && pgbuf_Flush_io_batch.io.count == 0);
+  pgbuf_Flush_io_batch.owner = thread_p;
+#endif
+
   mnt_pb_victims (thread_p);
 
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_FLUSH_VICTIM_STARTED, 0);
@@ -3217,6 +3339,15 @@ pgbuf_flush_victim_candidate (THREAD_ENTRY * thread_p, float flush_ratio)
 
 	  bufptr = victim_cand_list[i].bufptr;
 
+	  if (FILEIO_IO_BATCH_IS_FULL (&pgbuf_Flush_io_batch.io))
+	    {
+	      error = pgbuf_flush_io_batch_complete (thread_p);
+	      if (error != NO_ERROR)
+		{
+		  goto flush_error;
+		}
+	    }
+
 	  MUTEX_LOCK_VIA_BUSY_WAIT (rv, bufptr->BCB_mutex);
 	  /* flush condition check */
 	  if (!VPID_EQ (&bufptr->vpid, &victim_cand_list[i].vpid) || bufptr->dirty == false
@@ -3242,8 +3373,8 @@ pgbuf_flush_victim_candidate (THREAD_ENTRY * thread_p, float flush_ratio)
 	    }
 	  else
 	    {
-	      error = pgbuf_flush_page_with_wal (thread_p, bufptr);
-	      pthread_mutex_unlock (&bufptr->BCB_mutex);
+	      error = pgbuf_flush_io_batch_add (thread_p, bufptr);
+	      /* BCB mutex already unlocked by batch function */
 	      flushed_pages = (error == NO_ERROR) ? 1 : 0;
 	    }
 
@@ -3251,11 +3382,7 @@ pgbuf_flush_victim_candidate (THREAD_ENTRY * thread_p, float flush_ratio)
 
 	  if (error != NO_ERROR)
 	    {
-	      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_FLUSH_VICTIM_FINISHED, 1, total_flushed_count);
-#if defined (SERVER_MODE)
-	      pgbuf_Pool.is_flushing_victims = false;
-#endif
-	      return ER_FAILED;
+	      goto flush_error;
 	    }
 
 	  total_flushed_count += flushed_pages;
@@ -3275,8 +3402,17 @@ pgbuf_flush_victim_candidate (THREAD_ENTRY * thread_p, float flush_ratio)
     }
 
 end:
+  /* write the pages left in the batch */
+  error = pgbuf_flush_io_batch_complete (thread_p);
+  if (error != NO_ERROR)
+    {
+      goto flush_error;
+    }
+
 #if defined (SERVER_MODE)
   pgbuf_Pool.is_flushing_victims = false;
+  pgbuf_Flush_io_batch.owner = NULL;
+  pthread_mutex_unlock (&pgbuf_Pool.victim_flush_mutex);
 #endif
   er_log_debug (ARG_FILE_LINE,
 		"pgbuf_flush_victim_candidate: flush %d pages from (%d) to (%d) list. "
@@ -3287,6 +3423,18 @@ end:
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_FLUSH_VICTIM_FINISHED, 1, total_flushed_count);
 
   return NO_ERROR;
+
+flush_error:
+  /* pages already in the batch must not be left protected from victimization */
+  (void) pgbuf_flush_io_batch_complete (thread_p);
+
+  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_FLUSH_VICTIM_FINISHED, 1, total_flushed_count);
+#if defined (SERVER_MODE)
+  pgbuf_Pool.is_flushing_victims = false;
+  pgbuf_Flush_io_batch.owner = NULL;
+  pthread_mutex_unlock (&pgbuf_Pool.victim_flush_mutex);
+#endif
+  return ER_FAILED;
 }
 
 /*
@@ -3902,7 +4050,7 @@ pgbuf_copy_to_area (THREAD_ENTRY * thread_p, const VPID * vpid, int start_offset
 
   /* Is this a resident page ? */
   hash_anchor = &(pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)]);
-  bufptr = pgbuf_search_hash_chain (hash_anchor, vpid);
+  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid);
 
   if (bufptr == NULL)
     {
@@ -4014,7 +4162,7 @@ pgbuf_copy_from_area (THREAD_ENTRY * thread_p, const VPID * vpid, int start_offs
 
   /* Is this a resident page ? */
   hash_anchor = &(pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)]);
-  bufptr = pgbuf_search_hash_chain (hash_anchor, vpid);
+  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid);
 
   if (bufptr == NULL)
     {
@@ -4845,6 +4993,16 @@ pgbuf_initialize_bcb_table (void)
       return ER_OUT_OF_VIRTUAL_MEMORY;
     }
 
+  /* Bind the buffers of each node before they are touched. Failure is not an error; the OS places them. */
+  for (i = 0; pgbuf_Pool.num_numa_nodes > 1 && i < pgbuf_Pool.num_numa_nodes; i++)
+    {
+      int first = PGBUF_NUMA_NODE_FIRST_BUFFER (i);
+      int count = PGBUF_NUMA_NODE_FIRST_BUFFER (i + 1) - first;
+
+      (void) os_numa_bind_memory (PGBUF_FIND_BCB_PTR (first), (size_t) count * PGBUF_BCB_SIZE, i);
+      (void) os_numa_bind_memory (PGBUF_FIND_IOPAGE_PTR (first), (size_t) count * PGBUF_IOPAGE_BUFFER_SIZE, i);
+    }
+
   /* initialize each entry of the buffer BCB table */
   for (i = 0; i < pgbuf_Pool.num_buffers; i++)
     {
@@ -4878,6 +5036,7 @@ pgbuf_initialize_bcb_table (void)
       bufptr->victim_candidate = false;
       bufptr->zone = PGBUF_INVALID_ZONE;
       LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
+      bufptr->latch_site = NULL;
 
       /* link BCB and iopage buffer */
       ioptr = PGBUF_FIND_IOPAGE_PTR (i);
@@ -4925,6 +5084,11 @@ pgbuf_initialize_hash_table (void)
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (hashsize * PGBUF_BUFFER_HASH_SIZE));
       return ER_OUT_OF_VIRTUAL_MEMORY;
     }
+  if (pgbuf_Pool.num_numa_nodes > 1)
+    {
+      /* the hash chains are used by all nodes */
+      (void) os_numa_bind_memory (pgbuf_Pool.buf_hash_table, hashsize * PGBUF_BUFFER_HASH_SIZE, -1);
+    }
 
   /* initialize each entry of the buffer hash table */
   for (i = 0; i < hashsize; i++)
@@ -4995,6 +5159,9 @@ pgbuf_initialize_lru_list (void)
       /* estimates: 1000 buffer frames per one LRU list will be good. */
       pgbuf_Pool.num_LRU_list = ((pgbuf_Pool.num_buffers - 1) / 1000) + 1;
     }
+  /* each NUMA node has its own LRU lists, for the buffers of the node */
+  pgbuf_Pool.num_LRU_list_per_node = CEIL_PTVDIV (pgbuf_Pool.num_LRU_list, pgbuf_Pool.num_numa_nodes);
+  pgbuf_Pool.num_LRU_list = pgbuf_Pool.num_LRU_list_per_node * pgbuf_Pool.num_numa_nodes;
 
   /* allocate memory space for the page buffer LRU lists */
   pgbuf_Pool.buf_LRU_list = (PGBUF_LRU_LIST *) malloc (pgbuf_Pool.num_LRU_list * PGBUF_LRU_LIST_SIZE);
@@ -6205,6 +6372,10 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
 #if defined(SERVER_MODE)
   THREAD_ENTRY *cur_thrd_entry, *thrd_entry;
   int rv;
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv_diff;
+  void *holder_site;
+  const char *page_type_name;
 
   /* caller is holding bufptr->BCB_mutex */
 
@@ -6222,6 +6393,11 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
   cur_thrd_entry->request_latch_mode = request_mode;
   cur_thrd_entry->request_fix_count = request_fcnt;	/* SPECIAL_NOTE */
 
+  /* for the contention profile of the thread */
+  holder_site = bufptr->latch_site;
+  page_type_name = perf_stat_page_type_name (bufptr->iopage_buffer->iopage.prv.ptype);
+  tsc_getticks (&start_tick);
+
   if (request_mode == PGBUF_LATCH_FLUSH)
     {
       /* put cur_thrd_entry to the top of the BCB waiting queue, but not before a promoter. */
@@ -6335,6 +6511,11 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
       assert (0 < bufptr->fcnt);
 #endif
     }
+
+  tsc_getticks (&end_tick);
+  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+  sync_profile_record_wait (thread_p, SYNC_WAIT_PGBUF_LATCH, page_type_name, holder_site,
+			    (UINT64) tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec);
 #endif /* SERVER_MODE */
 
   return NO_ERROR;
@@ -6743,11 +6924,12 @@ pgbuf_wakeup_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
  * pgbuf_search_hash_chain () - searches the buffer hash chain to find
  *				a BCB with page identifier
  *   return: if success, BCB pointer, otherwise NULL
+ *   thread_p(in):
  *   hash_anchor(in):
  *   vpid(in):
  */
 static PGBUF_BCB *
-pgbuf_search_hash_chain (PGBUF_BUFFER_HASH * hash_anchor, const VPID * vpid)
+pgbuf_search_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor, const VPID * vpid)
 {
   PGBUF_BCB *bufptr;
   int mbw_cnt;
@@ -6759,11 +6941,9 @@ pgbuf_search_hash_chain (PGBUF_BUFFER_HASH * hash_anchor, const VPID * vpid)
   TSC_TICKS start_tick, end_tick;
   UINT64 lock_wait_time = 0;
   bool is_perf_tracking = false;
-  THREAD_ENTRY *thread_p = NULL;
 #endif
 
 #if defined (PERF_ENABLE_PB_HASH_ANCHOR_STAT)
-  thread_p = thread_get_thread_entry_info ();
   is_perf_tracking = mnt_is_perf_tracking (thread_p);
 #endif
 
@@ -6821,6 +7001,8 @@ one_phase:
 
   if (bufptr != NULL)
     {
+      /* found without holding the hash anchor mutex */
+      mnt_pb_hash_lockfree_hits (thread_p);
       return bufptr;
     }
 
@@ -7291,8 +7473,10 @@ pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_vpid)
   VPID vpid;
   PGBUF_BCB *bufptr;
   int i, sleep_count, loop_count, check_count;
+  int numa_node, victim_node;
 
   loop_count = 0;
+  numa_node = pgbuf_get_thread_numa_node (thread_p);
 
   check_count =
     MAX (PGBUF_MIN_NUM_VICTIMS, (int) (PGBUF_LRU_SIZE * prm_get_float_value (PRM_ID_PB_BUFFER_FLUSH_RATIO)));
@@ -7315,7 +7499,9 @@ pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_vpid)
 
 	      /* If the allocation of BCB from invalid BCB list fails, that is, invalid BCB list is empty, allocate a
 	       * BCB from the bottom of LRU list */
-	      bufptr = pgbuf_get_victim (thread_p, &vpid, check_count);
+	      /* look for a victim in the LRU lists of the node of the thread first */
+	      victim_node = (numa_node + i / pgbuf_Pool.num_LRU_list_per_node) % pgbuf_Pool.num_numa_nodes;
+	      bufptr = pgbuf_get_victim (thread_p, &vpid, victim_node, check_count);
 	      if (bufptr != NULL)
 		{
 		  /* the caller is holding bufptr->BCB_mutex. */
@@ -7765,29 +7951,70 @@ pgbuf_put_bcb_into_invalid_list (PGBUF_BCB * bufptr)
  * pgbuf_get_lru_index () - Get the index of the LRU list for the given VPID
  *   return: the index of the LRU index
  *   vpid(in): VPID
+ *   numa_node(in): NUMA node of the buffer
  */
 static int
-pgbuf_get_lru_index (const VPID * vpid)
+pgbuf_get_lru_index (const VPID * vpid, int numa_node)
 {
   int lru_idx;
 
-  lru_idx = (vpid->pageid ^ vpid->volid) % pgbuf_Pool.num_LRU_list;
+  assert (numa_node >= 0 && numa_node < pgbuf_Pool.num_numa_nodes);
+
+  lru_idx = (numa_node * pgbuf_Pool.num_LRU_list_per_node
+	     + (vpid->pageid ^ vpid->volid) % pgbuf_Pool.num_LRU_list_per_node);
 
   return lru_idx;
 }
 
+/*
+ * pgbuf_get_thread_numa_node () - Get the NUMA node of the buffers preferred by a thread
+ *   return: NUMA node
+ *   thread_p(in):
+ *
+ * Note: Workers bound to a node use it, other threads use the node of the cpu they run on.
+ */
+static int
+pgbuf_get_thread_numa_node (THREAD_ENTRY * thread_p)
+{
+  int node;
+
+  if (pgbuf_Pool.num_numa_nodes <= 1)
+    {
+      return 0;
+    }
+
+#if defined(SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  if (thread_p != NULL && thread_p->numa_node >= 0)
+    {
+      return thread_p->numa_node % pgbuf_Pool.num_numa_nodes;
+    }
+#endif /* SERVER_MODE */
+
+  node = os_numa_get_current_node ();
+  if (node < 0)
+    {
+      return 0;
+    }
+  return node % pgbuf_Pool.num_numa_nodes;
+}
+
 /*
  * pgbuf_get_victim () - find a victim BCB
  * return : victim candidate or NULL if no candidate was found
  * thread_p (in) :
  * vpid (in) :
+ * numa_node (in) : NUMA node of the LRU lists to search
  * max_count (in) :
  *
  * Note: If a victim BCB is found, this function will already lock it. This
  *     means that the caller will have exclusive access to the returned BCB.
  */
 static PGBUF_BCB *
-pgbuf_get_victim (THREAD_ENTRY * thread_p, const VPID * vpid, int max_count)
+pgbuf_get_victim (THREAD_ENTRY * thread_p, const VPID * vpid, int numa_node, int max_count)
 {
   PGBUF_BCB *victim = NULL;
 
@@ -7804,7 +8031,7 @@ pgbuf_get_victim (THREAD_ENTRY * thread_p, const VPID * vpid, int max_count)
        * policy to wait for one only in AIN list, however, the worker thread must wait for the flush thread flushes
        * the dirty pages from AIN list while iterating the AIN list multiple times. */
       ATOMIC_INC_32 (&pgbuf_Pool.lru_victim_req_cnt, 1);
-      victim = pgbuf_get_victim_from_lru_list (thread_p, vpid, max_count);
+      victim = pgbuf_get_victim_from_lru_list (thread_p, vpid, numa_node, max_count);
     }
 
   return victim;
@@ -7922,55 +8149,94 @@ pgbuf_get_victim_from_ain_list (THREAD_ENTRY * thread_p, int max_count)
  *				       LRU list
  *   return: If success, BCB, otherwise NULL
  *   vpid (in)	      : VPID used for determining resident LRU list
+ *   numa_node (in)   : NUMA node of the LRU lists to search
  *   max_count (in)   : maximum number of elements to consider
  *
  * Note: This function disconnects BCB from the bottom of the LRU list and
  *       returns it if its fcnt == 0. If its fcnt != 0, makes bufptr->PrevBCB
  *       LRU_bottom and retry. While this processing, the caller must be the
  *       holder of the LRU list.
+ *
+ *       The LRU list of the VPID is searched first. If it has no victim, a
+ *       few neighbor lists of the same NUMA node are searched too, but only
+ *       if their mutex can be acquired without waiting, so that threads
+ *       needing a victim do not pile up on the same LRU list.
  */
 static PGBUF_BCB *
-pgbuf_get_victim_from_lru_list (THREAD_ENTRY * thread_p, const VPID * vpid, int max_count)
+pgbuf_get_victim_from_lru_list (THREAD_ENTRY * thread_p, const VPID * vpid, int numa_node, int max_count)
 {
 #if defined(SERVER_MODE)
   int rv;
 #endif /* SERVER_MODE */
 
-  PGBUF_BCB *bufptr;
-  int lru_idx;
+  PGBUF_BCB *bufptr = NULL;
+  int lru_idx, first_lru_idx;
   int check_count;
+  int probe, num_probes;
   bool found;
   bool list_bottom_dirty = false;
-  PGBUF_LRU_LIST *lru_list;
+  PGBUF_LRU_LIST *lru_list = NULL;
+
+  lru_idx = pgbuf_get_lru_index (vpid, numa_node);
+  first_lru_idx = numa_node * pgbuf_Pool.num_LRU_list_per_node;
+  num_probes = MIN (pgbuf_Pool.num_LRU_list_per_node, PGBUF_VICTIM_LRU_PROBE_COUNT);
 
-  lru_idx = pgbuf_get_lru_index (vpid);
-  lru_list = &pgbuf_Pool.buf_LRU_list[lru_idx];
+  found = false;
 
-  /* check if LRU list is empty */
-  if (lru_list->LRU_bottom == NULL)
+  for (probe = 0; probe < num_probes && !found; probe++)
     {
-      return NULL;
-    }
+      /* neighbor lists of the same node */
+      lru_list =
+	&pgbuf_Pool.buf_LRU_list[first_lru_idx
+				 + (lru_idx - first_lru_idx + probe) % pgbuf_Pool.num_LRU_list_per_node];
 
-  found = false;
-  check_count = max_count;
+      /* check if LRU list is empty */
+      if (lru_list->LRU_bottom == NULL)
+	{
+	  continue;
+	}
 
-  MUTEX_LOCK_VIA_BUSY_WAIT (rv, lru_list->LRU_mutex);
-  bufptr = lru_list->LRU_bottom;
+      if (probe == 0)
+	{
+	  PGBUF_LRU_LIST_LOCK (rv, lru_list);
+	}
+#if defined(SERVER_MODE)
+      else if (pthread_mutex_trylock (&lru_list->LRU_mutex) != 0)
+	{
+	  /* do not wait for a neighbor list */
+	  continue;
+	}
+#endif /* SERVER_MODE */
 
-  /* search for non dirty PGBUF */
-  while (bufptr != NULL && check_count > 0 && bufptr->zone == PGBUF_LRU_2_ZONE)
-    {
-      if (!bufptr->dirty && !bufptr->avoid_victim && bufptr->fcnt == 0 && bufptr->latch_mode == PGBUF_NO_LATCH
-	  && bufptr->victim_candidate == false && !pgbuf_is_exist_blocked_reader_writer_victim (bufptr))
+      check_count = max_count;
+      bufptr = lru_list->LRU_bottom;
+
+      /* search for non dirty PGBUF */
+      while (bufptr != NULL && check_count > 0 && bufptr->zone == PGBUF_LRU_2_ZONE)
 	{
-	  bufptr->victim_candidate = true;
-	  found = true;
-	  break;
+	  if (!bufptr->dirty && !bufptr->avoid_victim && bufptr->fcnt == 0 && bufptr->latch_mode == PGBUF_NO_LATCH
+	      && bufptr->victim_candidate == false && !pgbuf_is_exist_blocked_reader_writer_victim (bufptr))
+	    {
+	      bufptr->victim_candidate = true;
+	      found = true;
+	      break;
+	    }
+
+	  bufptr = bufptr->prev_BCB;
+	  check_count--;
 	}
 
-      bufptr = bufptr->prev_BCB;
-      check_count--;
+      if (lru_list->LRU_bottom != NULL && lru_list->LRU_bottom->dirty == true)
+	{
+	  list_bottom_dirty = true;
+	}
+
+      pthread_mutex_unlock (&lru_list->LRU_mutex);
+
+      if (found && probe > 0)
+	{
+	  mnt_pb_victim_lru_probes (thread_p);
+	}
     }
 
   if (!found)
@@ -7978,13 +8244,6 @@ pgbuf_get_victim_from_lru_list (THREAD_ENTRY * thread_p, const VPID * vpid, int
       bufptr = NULL;
     }
 
-  if (lru_list->LRU_bottom != NULL && lru_list->LRU_bottom->dirty == true)
-    {
-      list_bottom_dirty = true;
-    }
-
-  pthread_mutex_unlock (&lru_list->LRU_mutex);
-
   if (list_bottom_dirty == true)
     {
       /* flush dirty pages */
@@ -8008,7 +8267,10 @@ pgbuf_get_victim_from_lru_list (THREAD_ENTRY * thread_p, const VPID * vpid, int
     }
   else
     {
-      MUTEX_LOCK_VIA_BUSY_WAIT (rv, lru_list->LRU_mutex);
+      /* the victim belongs to the list it was found in */
+      assert (lru_list == &pgbuf_Pool.buf_LRU_list[pgbuf_get_lru_index (&bufptr->vpid, PGBUF_BCB_NUMA_NODE (bufptr))]);
+
+      PGBUF_LRU_LIST_LOCK (rv, lru_list);
       /* disconnect bufptr from the LRU list */
       pgbuf_remove_from_lru_list (bufptr, lru_list);
       pthread_mutex_unlock (&lru_list->LRU_mutex);
@@ -8035,11 +8297,11 @@ pgbuf_invalidate_bcb_from_lru (PGBUF_BCB * bufptr)
   int rv;
 #endif /* SERVER_MODE */
 
-  lru_idx = pgbuf_get_lru_index (&bufptr->vpid);
+  lru_idx = pgbuf_get_lru_index (&bufptr->vpid, PGBUF_BCB_NUMA_NODE (bufptr));
 
   /* the caller is holding bufptr->BCB_mutex */
   /* delete the bufptr from the LRU list */
-  MUTEX_LOCK_VIA_BUSY_WAIT (rv, pgbuf_Pool.buf_LRU_list[lru_idx].LRU_mutex);
+  PGBUF_LRU_LIST_LOCK (rv, &pgbuf_Pool.buf_LRU_list[lru_idx]);
 
   if (pgbuf_Pool.buf_LRU_list[lru_idx].LRU_top == bufptr)
     {
@@ -8142,10 +8404,26 @@ pgbuf_relocate_top_lru (PGBUF_BCB * bufptr, int dest_zone)
 
   assert (bufptr->zone != PGBUF_LRU_1_ZONE);
 
-  lru_idx = pgbuf_get_lru_index (&bufptr->vpid);
+  lru_idx = pgbuf_get_lru_index (&bufptr->vpid, PGBUF_BCB_NUMA_NODE (bufptr));
 
   /* the caller is holding bufptr->BCB_mutex */
-  MUTEX_LOCK_VIA_BUSY_WAIT (rv, pgbuf_Pool.buf_LRU_list[lru_idx].LRU_mutex);
+#if defined(SERVER_MODE)
+  if (bufptr->zone == PGBUF_LRU_2_ZONE)
+    {
+      /* The BCB is already in the LRU list and is only promoted because it was referenced again. If the list is
+       * busy, leave the BCB where it is instead of waiting for the list: the LRU order is an approximation anyway
+       * and hot pages are referenced again soon. */
+      if (pthread_mutex_trylock (&pgbuf_Pool.buf_LRU_list[lru_idx].LRU_mutex) != 0)
+	{
+	  mnt_pb_lru_relocate_skips (NULL);
+	  return NO_ERROR;
+	}
+    }
+  else
+#endif /* SERVER_MODE */
+    {
+      PGBUF_LRU_LIST_LOCK (rv, &pgbuf_Pool.buf_LRU_list[lru_idx]);
+    }
 
   if (dest_zone == PGBUF_LRU_2_ZONE
       && (pgbuf_Pool.buf_LRU_list[lru_idx].LRU_bottom == NULL || pgbuf_Pool.buf_LRU_list[lru_idx].LRU_middle == NULL
@@ -8259,10 +8537,10 @@ pgbuf_relocate_bottom_lru (PGBUF_BCB * bufptr)
 
   assert (bufptr->zone != PGBUF_LRU_1_ZONE && bufptr->zone != PGBUF_INVALID_ZONE);
 
-  lru_idx = pgbuf_get_lru_index (&bufptr->vpid);
+  lru_idx = pgbuf_get_lru_index (&bufptr->vpid, PGBUF_BCB_NUMA_NODE (bufptr));
 
   /* the caller is holding bufptr->BCB_mutex */
-  MUTEX_LOCK_VIA_BUSY_WAIT (rv, pgbuf_Pool.buf_LRU_list[lru_idx].LRU_mutex);
+  PGBUF_LRU_LIST_LOCK (rv, &pgbuf_Pool.buf_LRU_list[lru_idx]);
 
   if (bufptr->zone == PGBUF_LRU_2_ZONE)
     {
@@ -9985,7 +10263,6 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
 #define PGBUF_PAGES_COUNT_THRESHOLD 4
   int error = NO_ERROR, i;
   int save_first_error = NO_ERROR;
-  LOG_LSA log_newest_oldest_unflush_lsa;
   VPID first_vpid, vpid;
   PGBUF_BUFFER_HASH *hash_anchor;
   PGBUF_BATCH_FLUSH_HELPER *helper = &pgbuf_Flush_helper;
@@ -10019,7 +10296,6 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
   /* add bufptr as middle page */
   pgbuf_add_bufptr_to_batch (bufptr, 0);
   VPID_COPY (&first_vpid, &bufptr->vpid);
-  LSA_COPY (&log_newest_oldest_unflush_lsa, &bufptr->oldest_unflush_lsa);
   pthread_mutex_unlock (&bufptr->BCB_mutex);
 
   VPID_COPY (&vpid, &first_vpid);
@@ -10063,7 +10339,7 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
 
       hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (&vpid)];
 
-      bufptr = pgbuf_search_hash_chain (hash_anchor, &vpid);
+      bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, &vpid);
       if (bufptr == NULL)
 	{
 	  /* Page not found: change direction or abandon batch */
@@ -10170,10 +10446,6 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
 	}
       else
 	{
-	  if (LSA_LT (&log_newest_oldest_unflush_lsa, &bufptr->oldest_unflush_lsa))
-	    {
-	      LSA_COPY (&log_newest_oldest_unflush_lsa, &bufptr->oldest_unflush_lsa);
-	    }
 	  dirty_pages_cnt++;
 	}
 
@@ -10227,9 +10499,7 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
       return NO_ERROR;
     }
 
-  /* WAL protocol: force log record to disk */
-  logpb_flush_log_for_wal (thread_p, &log_newest_oldest_unflush_lsa);
-
+  /* WAL protocol is followed by pgbuf_flush_io_batch_complete for all the pages of the batch */
   written_pages = 0;
   for (pos = PGBUF_NEIGHBOR_POS (-helper->back_offset); pos <= PGBUF_NEIGHBOR_POS (helper->fwd_offset); pos++)
     {
@@ -10297,8 +10567,8 @@ pgbuf_add_bufptr_to_batch (PGBUF_BCB * bufptr, int idx)
 }
 
 /*
- * pgbuf_flush_neighbor_safe () - Flush collected page for neighbor flush if
- *				  it's safe:
+ * pgbuf_flush_neighbor_safe () - Add collected page for neighbor flush to the
+ *				  victim flush batch if it's safe:
  *				  1. VPID of bufptr has not changed.
  *				  2. Page has no latch or is only latched for
  *				     read.
@@ -10307,7 +10577,7 @@ pgbuf_add_bufptr_to_batch (PGBUF_BCB * bufptr, int idx)
  * thread_p (in)      : Thread entry.
  * bufptr (in)	      : Buffered page collected for neighbor flush.
  * expected_vpid (in) : Expected VPID for bufptr.
- * flushed (out)      : Output true if page was flushed.
+ * flushed (out)      : Output true if page was added to the batch.
  */
 static int
 pgbuf_flush_neighbor_safe (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, VPID * expected_vpid, bool * flushed)
@@ -10317,26 +10587,22 @@ pgbuf_flush_neighbor_safe (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, VPID * e
   int rv = 0;
 #endif /* SERVER_MODE */
 
-#if defined(ENABLE_SYSTEMTAP)
-  QUERY_ID query_id = NULL_QUERY_ID;
-  bool monitored = false;
-#endif /* ENABLE_SYSTEMTAP */
-
-#if defined(ENABLE_SYSTEMTAP)
-  query_id = qmgr_get_current_query_id (thread_p);
-  if (query_id != NULL_QUERY_ID)
-    {
-      monitored = true;
-      CUBRID_IO_WRITE_START (query_id);
-    }
-#endif /* ENABLE_SYSTEMTAP */
-
   assert (bufptr != NULL);
   assert (expected_vpid != NULL && !VPID_ISNULL (expected_vpid));
   assert (flushed != NULL);
 
   *flushed = false;
 
+  if (FILEIO_IO_BATCH_IS_FULL (&pgbuf_Flush_io_batch.io))
+    {
+      error = pgbuf_flush_io_batch_complete (thread_p);
+      if (error != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error;
+	}
+    }
+
   MUTEX_LOCK_VIA_BUSY_WAIT (rv, bufptr->BCB_mutex);
   if (!VPID_EQ (&bufptr->vpid, expected_vpid))
     {
@@ -10350,54 +10616,184 @@ pgbuf_flush_neighbor_safe (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, VPID * e
       return NO_ERROR;
     }
 
-  if (bufptr->dirty)
+  /* dirty or not, the page is written with the batch */
+  error = pgbuf_flush_io_batch_add (thread_p, bufptr);
+  if (error == NO_ERROR)
+    {
+      *flushed = true;
+    }
+  else
+    {
+      ASSERT_ERROR ();
+    }
+  return error;
+}
+
+/*
+ * pgbuf_flush_io_batch_add () - Copy the page of a BCB into the victim flush
+ *				 batch
+ *
+ * return      : Error code.
+ * thread_p (in) : Thread entry.
+ * bufptr (in)   : BCB of the page to write. The caller holds its mutex, which
+ *		   is released by this function.
+ *
+ * Note: The page is only written by pgbuf_flush_io_batch_complete. A dirty
+ *	 page is marked clean now, the same way pgbuf_flush_page_with_wal does
+ *	 before its write, and avoid_victim keeps the BCB from being replaced
+ *	 until the batch completes.
+ */
+static int
+pgbuf_flush_io_batch_add (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
+{
+  PGBUF_FLUSH_IO_BATCH *batch = &pgbuf_Flush_io_batch;
+  FILEIO_PAGE *iopage;
+  int idx;
+
+  /* the caller is holding bufptr->BCB_mutex */
+
+#if defined (SERVER_MODE)
+  assert (batch->owner == thread_p);
+#endif
+  assert (!FILEIO_IO_BATCH_IS_FULL (&batch->io));
+  assert (bufptr->avoid_victim == false);
+  assert (bufptr->latch_mode == PGBUF_NO_LATCH || bufptr->latch_mode == PGBUF_LATCH_READ);
+
+  if (bufptr->dirty && pgbuf_check_bcb_page_vpid (thread_p, bufptr) != true)
     {
-      error = pgbuf_flush_page_with_wal (thread_p, bufptr);
       pthread_mutex_unlock (&bufptr->BCB_mutex);
-      if (error == NO_ERROR)
-	{
-	  *flushed = true;
-	}
-      else
+      return ER_FAILED;
+    }
+
+  bufptr->avoid_victim = true;
+
+  iopage = (FILEIO_PAGE *) (batch->page_area + (size_t) batch->io.count * IO_PAGESIZE);
+  memcpy ((void *) iopage, (void *) (&bufptr->iopage_buffer->iopage), IO_PAGESIZE);
+
+  idx = fileio_io_batch_add (&batch->io, fileio_get_volume_descriptor (bufptr->vpid.volid), iopage,
+			     bufptr->vpid.pageid, true);
+  batch->bufptr[idx] = bufptr;
+  batch->was_dirty[idx] = bufptr->dirty;
+
+  if (bufptr->dirty)
+    {
+      bufptr->async_flush_request = false;
+      PGBUF_RESET_DIRTY (bufptr);
+      bufptr->dirty = false;
+      LSA_COPY (&batch->oldest_unflush_lsa[idx], &bufptr->oldest_unflush_lsa);
+      LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
+
+      if (LSA_LT (&batch->max_page_lsa, &iopage->prv.lsa))
 	{
-	  ASSERT_ERROR ();
+	  LSA_COPY (&batch->max_page_lsa, &iopage->prv.lsa);
 	}
-      return error;
     }
-  else
+
+  pthread_mutex_unlock (&bufptr->BCB_mutex);
+
+  return NO_ERROR;
+}
+
+/*
+ * pgbuf_flush_io_batch_complete () - Write all the pages of the victim flush
+ *				      batch and release their BCBs
+ *
+ * return      : NO_ERROR, or ER_FAILED if a dirty page could not be written.
+ * thread_p (in) : Thread entry.
+ *
+ * Note: The log is forced once, up to the newest page LSA of the batch, then
+ *	 the pages are written in page order, contiguous ones with one I/O
+ *	 (fileio_io_batch_execute). A dirty page
+ *	 whose write failed gets its dirty state back. Failed writes of
+ *	 non-dirty neighbor pages are ignored.
+ */
+static int
+pgbuf_flush_io_batch_complete (THREAD_ENTRY * thread_p)
+{
+  PGBUF_FLUSH_IO_BATCH *batch = &pgbuf_Flush_io_batch;
+  PGBUF_BCB *bufptr;
+#if defined(SERVER_MODE)
+  THREAD_ENTRY *thrd_entry;
+  int rv;
+#endif /* SERVER_MODE */
+  int error = NO_ERROR;
+  int i;
+#if defined(ENABLE_SYSTEMTAP)
+  QUERY_ID query_id = NULL_QUERY_ID;
+  bool monitored = false;
+#endif /* ENABLE_SYSTEMTAP */
+
+#if defined (SERVER_MODE)
+  assert (batch->owner == thread_p);
+#endif
+
+  if (batch->io.count == 0)
     {
-      /* write a non-dirty page */
-      char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
-      FILEIO_PAGE *iopage;
+      return NO_ERROR;
+    }
 
-      iopage = (FILEIO_PAGE *) PTR_ALIGN (page_buf, MAX_ALIGNMENT);
+  /* confirm WAL protocol for all the pages of the batch */
+  if (!LSA_ISNULL (&batch->max_page_lsa))
+    {
+      logpb_flush_log_for_wal (thread_p, &batch->max_page_lsa);
+    }
 
-      memcpy ((void *) iopage, (void *) (&bufptr->iopage_buffer->iopage), IO_PAGESIZE);
-      bufptr->avoid_victim = true;
-      pthread_mutex_unlock (&bufptr->BCB_mutex);
+  /* Record number of writes in statistics */
+  mnt_pb_iowrites (thread_p, batch->io.count);
 
-      /* flush buffer page */
-      if (fileio_write (thread_p, fileio_get_volume_descriptor (bufptr->vpid.volid), iopage, bufptr->vpid.pageid,
-			IO_PAGESIZE) != NULL)
+#if defined(ENABLE_SYSTEMTAP)
+  query_id = qmgr_get_current_query_id (thread_p);
+  if (query_id != NULL_QUERY_ID)
+    {
+      monitored = true;
+      CUBRID_IO_WRITE_START (query_id);
+    }
+#endif /* ENABLE_SYSTEMTAP */
+
+  (void) fileio_io_batch_execute (thread_p, &batch->io);
+
+  for (i = 0; i < batch->io.count; i++)
+    {
+      bufptr = batch->bufptr[i];
+
+      MUTEX_LOCK_VIA_BUSY_WAIT (rv, bufptr->BCB_mutex);
+
+      assert (bufptr->avoid_victim == true);
+      assert (bufptr->latch_mode != PGBUF_LATCH_VICTIM);
+
+      if (batch->io.requests[i].status != FILEIO_IO_REQUEST_DONE && batch->was_dirty[i])
 	{
-	  *flushed = true;
-	  mnt_pb_iowrites (thread_p, 1);
-	  /* ignore error, just store it for Systemtap marker */
+	  PGBUF_SET_DIRTY (bufptr);
+	  LSA_COPY (&bufptr->oldest_unflush_lsa, &batch->oldest_unflush_lsa[i]);
 	  error = ER_FAILED;
 	}
 
-      MUTEX_LOCK_VIA_BUSY_WAIT (rv, bufptr->BCB_mutex);
       bufptr->avoid_victim = false;
+
+#if defined(SERVER_MODE)
+      /* wakeup blocked flushers */
+      while (((thrd_entry = bufptr->next_wait_thrd) != NULL) && (thrd_entry->request_latch_mode == PGBUF_LATCH_FLUSH))
+	{
+	  bufptr->next_wait_thrd = thrd_entry->next_wait_thrd;
+	  thrd_entry->next_wait_thrd = NULL;
+	  pgbuf_wakeup_uncond (thrd_entry);
+	}
+#endif /* SERVER_MODE */
+
       pthread_mutex_unlock (&bufptr->BCB_mutex);
+    }
 
 #if defined(ENABLE_SYSTEMTAP)
-      {
-	CUBRID_IO_WRITE_END (query_id, IO_PAGESIZE, (error != NO_ERROR));
-      }
+  if (monitored == true)
+    {
+      CUBRID_IO_WRITE_END (query_id, batch->io.count * IO_PAGESIZE, (error != NO_ERROR));
+    }
 #endif /* ENABLE_SYSTEMTAP */
 
-      return NO_ERROR;
-    }
+  fileio_io_batch_init (&batch->io, IO_PAGESIZE);
+  LSA_SET_NULL (&batch->max_page_lsa);
+
+  return error;
 }
 
 /*
@@ -32,11 +32,16 @@
 #include "storage_common.h"
 #include "object_domain.h"
 
-#define STATS_WITH_FULLSCAN  true
-#define STATS_WITH_SAMPLING  false
+/* sampling level of UPDATE STATISTICS: the percentage of the heap and index pages that are read. STATS_WITH_SAMPLING
+ * reads a fixed-size sample whatever the size of the class, any level between reads that percentage of the pages. */
+#define STATS_WITH_FULLSCAN  100
+#define STATS_WITH_SAMPLING  0
+
+#define STATS_IS_FULLSCAN(percent) ((percent) >= STATS_WITH_FULLSCAN)
 
 #define STATS_SAMPLING_THRESHOLD 50	/* sampling trial count */
 #define STATS_SAMPLING_LEAFS_MAX   8	/* sampling leaf pages */
+#define STATS_SAMPLING_HEAP_PAGES_MIN 16	/* heap pages read at least when the heap is sampled */
 
 /* disk-resident elements of pkeys[] field */
 #define BTREE_STATS_PKEYS_NUM      8
@@ -44,6 +49,17 @@
 
 #define STATS_MIN_MAX_SIZE    sizeof(DB_DATA)
 
+/* column histograms */
+#define STATS_HISTOGRAM_BUCKETS_MAX   20	/* equi-depth buckets */
+#define STATS_HISTOGRAM_TOPN_MAX      10	/* most frequent values kept apart from the buckets */
+#define STATS_HISTOGRAM_SAMPLE_ROWS   30000	/* sampled rows per class */
+
+/* size of a packed histogram; n_buckets + 1 bounds follow the top-N values */
+#define STATS_HISTOGRAM_PACKED_SIZE(h) \
+  (OR_INT_SIZE * 4 + OR_DOUBLE_SIZE * (1 + 2 * (h)->n_topn + ((h)->n_buckets > 0 ? 3 * (h)->n_buckets + 1 : 0)))
+#define STATS_HISTOGRAM_PACKED_SIZE_MAX \
+  (OR_INT_SIZE * 4 + OR_DOUBLE_SIZE * (2 + 2 * STATS_HISTOGRAM_TOPN_MAX + 3 * STATS_HISTOGRAM_BUCKETS_MAX))
+
 /* free_and_init routine */
 #define stats_free_statistics_and_init(stats) \
   do \
@@ -72,6 +88,24 @@ struct btree_stats
 #endif
 };
 
+/* Value distribution of a column, built from a sample of the heap. Values are mapped to doubles by
+ * stats_histogram_key (); frequencies are fractions of all the rows of the class. */
+typedef struct stats_histogram STATS_HISTOGRAM;
+struct stats_histogram
+{
+  int sample_rows;		/* number of rows the histogram was built from */
+  int sample_ndv;		/* number of distinct non-null values in the sample */
+  double null_freq;		/* frequency of nulls */
+  int n_topn;			/* number of most frequent values */
+  double topn_values[STATS_HISTOGRAM_TOPN_MAX];
+  double topn_freqs[STATS_HISTOGRAM_TOPN_MAX];
+  int n_buckets;		/* number of buckets for the other values */
+  double bounds[STATS_HISTOGRAM_BUCKETS_MAX + 1];	/* bucket i holds (bounds[i], bounds[i + 1]]; bounds[0] is the
+							 * minimum and belongs to bucket 0 */
+  double bucket_freqs[STATS_HISTOGRAM_BUCKETS_MAX];
+  double bucket_ndv[STATS_HISTOGRAM_BUCKETS_MAX];	/* distinct values of each bucket */
+};
+
 /* Statistical Information about the attribute */
 typedef struct attr_stats ATTR_STATS;
 struct attr_stats
@@ -80,6 +114,7 @@ struct attr_stats
   DB_TYPE type;
   int n_btstats;		/* number of B+tree statistics information */
   BTREE_STATS *bt_stats;	/* pointer to array of BTREE_STATS[n_btstats] */
+  STATS_HISTOGRAM *histogram;	/* value distribution; NULL if not collected */
 };
 
 /* Statistical Information about the class */
@@ -93,6 +128,11 @@ struct class_stats
   ATTR_STATS *attr_stats;	/* pointer to the array of attribute statistics */
 };
 
+extern bool stats_histogram_key (const DB_VALUE * value, double *key);
+extern bool stats_histogram_is_supported_type (DB_TYPE type);
+extern char *stats_histogram_pack (char *ptr, const STATS_HISTOGRAM * histogram);
+extern char *stats_histogram_unpack (char *ptr, STATS_HISTOGRAM * histogram);
+
 #if !defined(SERVER_MODE)
 extern CLASS_STATS *stats_get_statistics (OID * classoid, unsigned int timestamp);
 extern void stats_free_statistics (CLASS_STATS * stats);
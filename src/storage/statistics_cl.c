@@ -84,6 +84,7 @@ stats_client_unpack_statistics (char *buf_p)
   ATTR_STATS *attr_stats_p;
   BTREE_STATS *btree_stats_p;
   int max_unique_keys;
+  int has_histogram;
   int i, j, k;
 
   if (buf_p == NULL)
@@ -136,6 +137,7 @@ stats_client_unpack_statistics (char *buf_p)
       db_ws_free (class_stats_p);
       return NULL;
     }
+  memset (class_stats_p->attr_stats, 0, class_stats_p->n_attrs * sizeof (ATTR_STATS));
 
   for (i = 0, attr_stats_p = class_stats_p->attr_stats; i < class_stats_p->n_attrs; i++, attr_stats_p++)
     {
@@ -148,6 +150,21 @@ stats_client_unpack_statistics (char *buf_p)
       attr_stats_p->n_btstats = OR_GET_INT (buf_p);
       buf_p += OR_INT_SIZE;
 
+      has_histogram = OR_GET_INT (buf_p);
+      buf_p += OR_INT_SIZE;
+
+      attr_stats_p->histogram = NULL;
+      if (has_histogram)
+	{
+	  attr_stats_p->histogram = (STATS_HISTOGRAM *) db_ws_alloc (sizeof (STATS_HISTOGRAM));
+	  if (attr_stats_p->histogram == NULL)
+	    {
+	      stats_free_statistics (class_stats_p);
+	      return NULL;
+	    }
+	  buf_p = stats_histogram_unpack (buf_p, attr_stats_p->histogram);
+	}
+
       if (attr_stats_p->n_btstats <= 0)
 	{
 	  attr_stats_p->bt_stats = NULL;
@@ -272,6 +289,12 @@ stats_free_statistics (CLASS_STATS * class_statsp)
 		  db_ws_free (attr_statsp->bt_stats);
 		  attr_statsp->bt_stats = NULL;
 		}
+
+	      if (attr_statsp->histogram)
+		{
+		  db_ws_free (attr_statsp->histogram);
+		  attr_statsp->histogram = NULL;
+		}
 	    }
 	  db_ws_free (class_statsp->attr_stats);
 	  class_statsp->attr_stats = NULL;
@@ -512,6 +535,25 @@ stats_dump (const char *class_name_p, FILE * file_p)
 		       bt_stats_p->leafs, bt_stats_p->height);
 	    }
 	}
+
+      if (attr_stats_p->histogram != NULL)
+	{
+	  STATS_HISTOGRAM *histogram_p = attr_stats_p->histogram;
+
+	  fprintf (file_p, "    Histogram: sampled rows: %d , distinct values: %d , null frequency: %g\n",
+		   histogram_p->sample_rows, histogram_p->sample_ndv, histogram_p->null_freq);
+	  for (j = 0; j < histogram_p->n_topn; j++)
+	    {
+	      fprintf (file_p, "        Frequent value: %.17g , frequency: %g\n", histogram_p->topn_values[j],
+		       histogram_p->topn_freqs[j]);
+	    }
+	  for (j = 0; j < histogram_p->n_buckets; j++)
+	    {
+	      fprintf (file_p, "        Bucket: %c%.17g , %.17g] , frequency: %g , distinct values: %g\n",
+		       (j == 0) ? '[' : '(', histogram_p->bounds[j], histogram_p->bounds[j + 1],
+		       histogram_p->bucket_freqs[j], histogram_p->bucket_ndv[j]);
+	    }
+	}
       fprintf (file_p, "\n");
     }
 
@@ -39,9 +39,11 @@
 #include "btree.h"
 #include "extendible_hash.h"
 #include "heap_file.h"
+#include "file_manager.h"
 #include "boot_sr.h"
 #include "partition.h"
 #include "db.h"
+#include "query_manager.h"
 
 #define SQUARE(n) ((n)*(n))
 
@@ -66,6 +68,15 @@ struct partition_stats_acumulator
 				 * # of {a, b} ... pkeys[pkeys_size-1] -> # of {a, b, ..., x} */
 };
 
+/* values of a column gathered from the sampled rows of the heap */
+typedef struct stats_column_sample STATS_COLUMN_SAMPLE;
+struct stats_column_sample
+{
+  DISK_ATTR *disk_attr;		/* the column */
+  double *keys;			/* histogram keys of the sampled rows */
+  char *is_null;		/* is_null[i] iff keys[i] is not set */
+};
+
 #if defined(ENABLE_UNUSED_FUNCTION)
 static int stats_compare_data (DB_DATA * data1, DB_DATA * data2, DB_TYPE type);
 static int stats_compare_date (DB_DATE * date1, DB_DATE * date2);
@@ -75,14 +86,19 @@ static int stats_compare_datetime (DB_DATETIME * datetime1_p, DB_DATETIME * date
 static int stats_compare_money (DB_MONETARY * mn1, DB_MONETARY * mn2);
 #endif
 static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_oid, OID * partitions, int count,
-						bool with_fullscan);
+						int sampling_percent);
+static int stats_update_histograms (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p, DISK_REPR * disk_repr_p,
+				    int sampling_percent, int *tot_objects_p);
+static int stats_compare_histogram_key (const void *key1, const void *key2);
+static void stats_make_histogram (double *keys, int n_keys, int n_rows, double tot_rows, STATS_HISTOGRAM * histogram);
+static double stats_estimate_ndv (int sample_ndv, int sample_singletons, double sample_rows, double tot_rows);
 
 /*
  * xstats_update_statistics () -  Updates the statistics for the objects
  *                                of a given class
  *   return:
  *   class_id(in): Identifier of the class
- *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sampling_percent(in): percentage of the pages to sample (see STATS_WITH_FULLSCAN)
  *
  * Note: It first retrieves the whole catalog information about this class,
  *       including all possible forms of disk representations for the instance
@@ -106,7 +122,7 @@ static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * c
  *       for the last class representation.
  */
 int
-xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_fullscan)
+xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, int sampling_percent)
 {
   CLS_INFO *cls_info_p = NULL;
   REPR_ID repr_id;
@@ -217,7 +233,7 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
       assert (partitions != NULL);
       catalog_free_class_info (cls_info_p);
       cls_info_p = NULL;
-      error_code = stats_update_partitioned_statistics (thread_p, class_id_p, partitions, count, with_fullscan);
+      error_code = stats_update_partitioned_statistics (thread_p, class_id_p, partitions, count, sampling_percent);
       db_private_free (thread_p, partitions);
       if (error_code != NO_ERROR)
 	{
@@ -281,7 +297,7 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
 	  assert_release (btree_stats_p->pkeys_size > 0);
 	  assert_release (btree_stats_p->pkeys_size <= BTREE_STATS_PKEYS_NUM);
 
-	  if (btree_get_stats (thread_p, btree_stats_p, with_fullscan) != NO_ERROR)
+	  if (btree_get_stats (thread_p, btree_stats_p, sampling_percent) != NO_ERROR)
 	    {
 	      goto error;
 	    }
@@ -290,6 +306,15 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
 	}			/* for (j = 0; ...) */
     }				/* for (i = 0; ...) */
 
+  /* update the value distributions of the columns; this also counts or extrapolates the objects */
+  error_code =
+    stats_update_histograms (thread_p, class_id_p, &cls_info_p->ci_hfid, disk_repr_p, sampling_percent,
+			     &cls_info_p->ci_tot_objects);
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+
   error_code = catalog_start_access_with_dir_oid (thread_p, &catalog_access_info, X_LOCK);
   if (error_code != NO_ERROR)
     {
@@ -357,11 +382,542 @@ error:
   goto end;
 }
 
+/*
+ * stats_update_histograms () - Build the histograms of the columns of a class
+ *   return: NO_ERROR or error code
+ *   class_id_p(in): class
+ *   hfid_p(in): heap file of the class
+ *   disk_repr_p(in/out): last disk representation; histograms are replaced
+ *   sampling_percent(in): percentage of the pages to sample (see STATS_WITH_FULLSCAN)
+ *   tot_objects_p(in/out): estimated number of objects of the class; counted or extrapolated on return
+ *
+ * Note: Unless the heap is small or FULLSCAN is given, only a random subset of the heap pages is read: the given
+ *       percentage of them, or by default just enough pages to hold about twice the sample size. The pages are
+ *       picked by selection sampling so they are visited in file order, and the number of objects is extrapolated
+ *       from the rows found on them. When the whole heap is read, without FULLSCAN only a fraction of the rows is
+ *       considered at all. The considered rows go through a reservoir so the sample is uniform whatever the order of
+ *       the heap; only the rows that enter the reservoir are decoded.
+ */
+static int
+stats_update_histograms (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p, DISK_REPR * disk_repr_p,
+			 int sampling_percent, int *tot_objects_p)
+{
+  STATS_COLUMN_SAMPLE *samples = NULL;
+  ATTR_ID *attr_ids = NULL;
+  DISK_ATTR *disk_attr_p;
+  HEAP_CACHE_ATTRINFO attr_info;
+  HEAP_SCANCACHE scan_cache;
+  MVCC_SNAPSHOT *mvcc_snapshot;
+  RECDES recdes;
+  OID oid;
+  VPID vpid;
+  SCAN_CODE scan;
+  DB_VALUE *value;
+  double keep_ratio, rows_per_page, tot_rows, *keys = NULL;
+  double r;
+  struct drand48_data *rand_buf_p;
+  int n_cols, max_rows, n_rows, n_seen, n_total, n_keys, slot;
+  int npages, sample_pages, page_idx, pages_left, pages_read;
+  bool page_sampling;
+  int i, j;
+  bool attr_info_inited = false, scan_cache_inited = false;
+  int error_code = NO_ERROR;
+
+  n_cols = 0;
+  for (i = 0; i < disk_repr_p->n_fixed + disk_repr_p->n_variable; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+
+      /* the previous histograms are out of date anyway */
+      if (disk_attr_p->histogram != NULL)
+	{
+	  db_private_free_and_init (thread_p, disk_attr_p->histogram);
+	}
+
+      if (stats_histogram_is_supported_type (disk_attr_p->type))
+	{
+	  n_cols++;
+	}
+    }
+
+  if (n_cols == 0 || HFID_IS_NULL (hfid_p))
+    {
+      return NO_ERROR;
+    }
+
+  npages = file_get_numpages (thread_p, &hfid_p->vfid);
+  if (npages <= 0)
+    {
+      return (npages < 0) ? er_errid () : NO_ERROR;
+    }
+
+  max_rows = (sampling_percent > STATS_WITH_SAMPLING) ? STATS_HISTOGRAM_SAMPLE_ROWS * 4 : STATS_HISTOGRAM_SAMPLE_ROWS;
+
+  if (STATS_IS_FULLSCAN (sampling_percent))
+    {
+      sample_pages = npages;
+    }
+  else if (sampling_percent > STATS_WITH_SAMPLING)
+    {
+      sample_pages = (int) ((INT64) npages * sampling_percent / 100);
+    }
+  else
+    {
+      rows_per_page = MAX ((double) *tot_objects_p / npages, 1.0);
+      sample_pages = (int) MIN (ceil (2.0 * max_rows / rows_per_page), (double) npages);
+    }
+  sample_pages = MAX (sample_pages, STATS_SAMPLING_HEAP_PAGES_MIN);
+
+  page_sampling = (sample_pages < npages);
+  if (page_sampling || STATS_IS_FULLSCAN (sampling_percent))
+    {
+      keep_ratio = 1.0;
+    }
+  else
+    {
+      keep_ratio = MIN (1.0, (2.0 * max_rows) / MAX (*tot_objects_p, 1));
+    }
+
+  samples = (STATS_COLUMN_SAMPLE *) db_private_alloc (thread_p, n_cols * sizeof (STATS_COLUMN_SAMPLE));
+  attr_ids = (ATTR_ID *) db_private_alloc (thread_p, n_cols * sizeof (ATTR_ID));
+  keys = (double *) db_private_alloc (thread_p, max_rows * sizeof (double));
+  if (samples == NULL || attr_ids == NULL || keys == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto exit;
+    }
+  memset (samples, 0, n_cols * sizeof (STATS_COLUMN_SAMPLE));
+
+  for (i = 0, j = 0; i < disk_repr_p->n_fixed + disk_repr_p->n_variable; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+      if (!stats_histogram_is_supported_type (disk_attr_p->type))
+	{
+	  continue;
+	}
+
+      samples[j].disk_attr = disk_attr_p;
+      samples[j].keys = (double *) db_private_alloc (thread_p, max_rows * sizeof (double));
+      samples[j].is_null = (char *) db_private_alloc (thread_p, max_rows);
+      if (samples[j].keys == NULL || samples[j].is_null == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto exit;
+	}
+      attr_ids[j] = disk_attr_p->id;
+      j++;
+    }
+
+  mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+  if (mvcc_snapshot == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto exit;
+    }
+
+  error_code = heap_attrinfo_start (thread_p, class_id_p, n_cols, attr_ids, &attr_info);
+  if (error_code != NO_ERROR)
+    {
+      goto exit;
+    }
+  attr_info_inited = true;
+
+  error_code = heap_scancache_start (thread_p, &scan_cache, hfid_p, class_id_p, true, false, mvcc_snapshot);
+  if (error_code != NO_ERROR)
+    {
+      goto exit;
+    }
+  scan_cache_inited = true;
+
+  oid.volid = hfid_p->vfid.volid;
+  oid.pageid = NULL_PAGEID;
+  oid.slotid = NULL_SLOTID;
+  VPID_SET_NULL (&vpid);
+
+  rand_buf_p = qmgr_get_rand_buf (thread_p);
+
+  n_rows = n_seen = n_total = 0;
+  page_idx = pages_read = 0;
+  pages_left = sample_pages;
+  while (true)
+    {
+      if (page_sampling && (VPID_ISNULL (&vpid) || oid.pageid != vpid.pageid || oid.volid != vpid.volid))
+	{
+	  /* move on to the next sampled page; each page is picked with probability pages_left / pages remaining */
+	  while (pages_left > 0 && page_idx < npages)
+	    {
+	      drand48_r (rand_buf_p, &r);
+	      if (r * (npages - page_idx) < pages_left)
+		{
+		  break;
+		}
+	      page_idx++;
+	    }
+	  if (pages_left <= 0 || page_idx >= npages)
+	    {
+	      scan = S_END;
+	      break;
+	    }
+
+	  if (file_find_nthpages (thread_p, &hfid_p->vfid, &vpid, page_idx, 1) != 1)
+	    {
+	      ASSERT_ERROR_AND_SET (error_code);
+	      goto exit;
+	    }
+	  page_idx++;
+	  pages_left--;
+	  pages_read++;
+
+	  /* slot 0 holds the chain record of the page, the objects follow it */
+	  oid.volid = vpid.volid;
+	  oid.pageid = vpid.pageid;
+	  oid.slotid = 0;
+	}
+
+      scan = heap_next (thread_p, hfid_p, class_id_p, &oid, &recdes, &scan_cache, PEEK);
+      if (scan != S_SUCCESS)
+	{
+	  if (scan == S_END && page_sampling)
+	    {
+	      /* the sampled page was the last one of the heap */
+	      VPID_SET_NULL (&vpid);
+	      continue;
+	    }
+	  break;
+	}
+
+      if (page_sampling && (oid.pageid != vpid.pageid || oid.volid != vpid.volid))
+	{
+	  /* went past the sampled page */
+	  continue;
+	}
+
+      n_total++;
+      if (keep_ratio < 1.0)
+	{
+	  drand48_r (rand_buf_p, &r);
+	  if (r >= keep_ratio)
+	    {
+	      continue;
+	    }
+	}
+
+      /* reservoir sampling */
+      n_seen++;
+      if (n_rows < max_rows)
+	{
+	  slot = n_rows++;
+	}
+      else
+	{
+	  drand48_r (rand_buf_p, &r);
+	  slot = (int) (r * n_seen);
+	  if (slot >= max_rows)
+	    {
+	      continue;
+	    }
+	}
+
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid, &recdes, NULL, &attr_info);
+      if (error_code != NO_ERROR)
+	{
+	  goto exit;
+	}
+
+      for (j = 0; j < n_cols; j++)
+	{
+	  value = heap_attrinfo_access (attr_ids[j], &attr_info);
+	  samples[j].is_null[slot] = !stats_histogram_key (value, &samples[j].keys[slot]);
+	}
+    }
+
+  if (scan == S_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto exit;
+    }
+
+  if (page_sampling)
+    {
+      tot_rows = (pages_read > 0) ? (double) n_total * npages / pages_read : 0.0;
+    }
+  else
+    {
+      tot_rows = n_total;
+    }
+  *tot_objects_p = (int) MIN (tot_rows, (double) INT_MAX);
+
+  if (n_rows == 0)
+    {
+      goto exit;
+    }
+
+  for (j = 0; j < n_cols; j++)
+    {
+      n_keys = 0;
+      for (i = 0; i < n_rows; i++)
+	{
+	  if (!samples[j].is_null[i])
+	    {
+	      keys[n_keys++] = samples[j].keys[i];
+	    }
+	}
+
+      disk_attr_p = samples[j].disk_attr;
+      disk_attr_p->histogram = (STATS_HISTOGRAM *) db_private_alloc (thread_p, sizeof (STATS_HISTOGRAM));
+      if (disk_attr_p->histogram == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto exit;
+	}
+
+      stats_make_histogram (keys, n_keys, n_rows, tot_rows, disk_attr_p->histogram);
+    }
+
+exit:
+  if (scan_cache_inited)
+    {
+      (void) heap_scancache_end (thread_p, &scan_cache);
+    }
+  if (attr_info_inited)
+    {
+      heap_attrinfo_end (thread_p, &attr_info);
+    }
+
+  if (samples != NULL)
+    {
+      for (j = 0; j < n_cols; j++)
+	{
+	  if (samples[j].keys != NULL)
+	    {
+	      db_private_free (thread_p, samples[j].keys);
+	    }
+	  if (samples[j].is_null != NULL)
+	    {
+	      db_private_free (thread_p, samples[j].is_null);
+	    }
+	}
+      db_private_free_and_init (thread_p, samples);
+    }
+  if (attr_ids != NULL)
+    {
+      db_private_free_and_init (thread_p, attr_ids);
+    }
+  if (keys != NULL)
+    {
+      db_private_free_and_init (thread_p, keys);
+    }
+
+  return error_code;
+}
+
+/*
+ * stats_compare_histogram_key () - qsort comparator of histogram keys
+ *   return: -1, 0 or 1
+ *   key1(in):
+ *   key2(in):
+ */
+static int
+stats_compare_histogram_key (const void *key1, const void *key2)
+{
+  double k1 = *(const double *) key1;
+  double k2 = *(const double *) key2;
+
+  return (k1 < k2) ? -1 : ((k1 > k2) ? 1 : 0);
+}
+
+/*
+ * stats_make_histogram () - Build the histogram of a column from its sampled values
+ *   return: nothing
+ *   keys(in/out): non-null keys of the sample; sorted on return
+ *   n_keys(in): number of keys
+ *   n_rows(in): number of sampled rows, including the null ones
+ *   tot_rows(in): number of rows of the class the sample was drawn from
+ *   histogram(out):
+ *
+ * Note: The values that are much more frequent than the average one are kept apart as the top-N values, each with
+ *       its own frequency; when there are no more distinct values than top-N slots, all of them are. The other
+ *       values are split into equi-depth buckets; the rows of a value never span two buckets. The distinct values
+ *       of a bucket are extrapolated from the sample to the whole class.
+ */
+static void
+stats_make_histogram (double *keys, int n_keys, int n_rows, double tot_rows, STATS_HISTOGRAM * histogram)
+{
+  int top_counts[STATS_HISTOGRAM_TOPN_MAX];
+  double skew_count, est_ndv;
+  int ndv, run_start, run_count;
+  int rest_keys, rest_ndv, n_target, cum_count, bucket_count, bucket_ndv, bucket_singletons;
+  int i, j, k;
+
+  memset (histogram, 0, sizeof (STATS_HISTOGRAM));
+
+  histogram->sample_rows = n_rows;
+  if (n_rows <= 0)
+    {
+      return;
+    }
+  histogram->null_freq = (double) (n_rows - n_keys) / n_rows;
+  if (n_keys <= 0)
+    {
+      return;
+    }
+
+  qsort (keys, n_keys, sizeof (double), stats_compare_histogram_key);
+
+  ndv = 1;
+  for (i = 1; i < n_keys; i++)
+    {
+      if (keys[i] != keys[i - 1])
+	{
+	  ndv++;
+	}
+    }
+  histogram->sample_ndv = ndv;
+
+  /* pick the most frequent values; a value qualifies when it is at least twice as frequent as the average one */
+  skew_count = (ndv <= STATS_HISTOGRAM_TOPN_MAX) ? 0.0 : MAX (2.0 * n_keys / ndv, 1.0);
+  for (run_start = 0; run_start < n_keys; run_start += run_count)
+    {
+      for (run_count = 1; run_start + run_count < n_keys && keys[run_start + run_count] == keys[run_start];
+	   run_count++)
+	{
+	  ;
+	}
+
+      if (run_count <= skew_count)
+	{
+	  continue;
+	}
+
+      /* keep the top-N ordered by descending count */
+      if (histogram->n_topn == STATS_HISTOGRAM_TOPN_MAX && run_count <= top_counts[STATS_HISTOGRAM_TOPN_MAX - 1])
+	{
+	  continue;
+	}
+
+      k = MIN (histogram->n_topn, STATS_HISTOGRAM_TOPN_MAX - 1);
+      while (k > 0 && top_counts[k - 1] < run_count)
+	{
+	  top_counts[k] = top_counts[k - 1];
+	  histogram->topn_values[k] = histogram->topn_values[k - 1];
+	  k--;
+	}
+      top_counts[k] = run_count;
+      histogram->topn_values[k] = keys[run_start];
+      if (histogram->n_topn < STATS_HISTOGRAM_TOPN_MAX)
+	{
+	  histogram->n_topn++;
+	}
+    }
+
+  rest_keys = n_keys;
+  for (k = 0; k < histogram->n_topn; k++)
+    {
+      histogram->topn_freqs[k] = (double) top_counts[k] / n_rows;
+      rest_keys -= top_counts[k];
+    }
+  rest_ndv = ndv - histogram->n_topn;
+
+  if (rest_keys <= 0 || rest_ndv <= 0)
+    {
+      return;
+    }
+
+  /* equi-depth buckets over the remaining values */
+  n_target = MIN (STATS_HISTOGRAM_BUCKETS_MAX, rest_ndv);
+  cum_count = bucket_count = bucket_ndv = bucket_singletons = 0;
+  j = 0;
+  for (run_start = 0; run_start < n_keys; run_start += run_count)
+    {
+      for (run_count = 1; run_start + run_count < n_keys && keys[run_start + run_count] == keys[run_start];
+	   run_count++)
+	{
+	  ;
+	}
+
+      for (k = 0; k < histogram->n_topn; k++)
+	{
+	  if (histogram->topn_values[k] == keys[run_start])
+	    {
+	      break;
+	    }
+	}
+      if (k < histogram->n_topn)
+	{
+	  continue;
+	}
+
+      if (cum_count == 0)
+	{
+	  histogram->bounds[0] = keys[run_start];
+	}
+
+      cum_count += run_count;
+      bucket_count += run_count;
+      bucket_ndv++;
+      if (run_count == 1)
+	{
+	  bucket_singletons++;
+	}
+
+      if ((j < n_target - 1 && cum_count >= (double) rest_keys * (j + 1) / n_target) || cum_count == rest_keys)
+	{
+	  /* close the bucket once it is deep enough; the last bucket takes whatever is left */
+	  histogram->bounds[j + 1] = keys[run_start];
+	  histogram->bucket_freqs[j] = (double) bucket_count / n_rows;
+	  est_ndv = stats_estimate_ndv (bucket_ndv, bucket_singletons, n_rows, tot_rows);
+	  histogram->bucket_ndv[j] = MIN (est_ndv, histogram->bucket_freqs[j] * MAX (tot_rows, n_rows));
+	  j++;
+	  bucket_count = bucket_ndv = bucket_singletons = 0;
+	}
+    }
+
+  histogram->n_buckets = j;
+}
+
+/*
+ * stats_estimate_ndv () - Extrapolate the number of distinct values of a sample to the population
+ *   return: estimated number of distinct values
+ *   sample_ndv(in): distinct values in the sample
+ *   sample_singletons(in): values that occur exactly once in the sample
+ *   sample_rows(in): rows of the sample
+ *   tot_rows(in): rows of the population
+ *
+ * Note: This is the Guaranteed-Error Estimator of Charikar et al. The values seen more than once are likely to be
+ *       frequent ones, all of them already found; a value seen once stands for sqrt (tot_rows / sample_rows) values
+ *       of the population, which bounds the ratio error by that same factor. It gives back sample_ndv when the
+ *       sample is the whole population.
+ */
+static double
+stats_estimate_ndv (int sample_ndv, int sample_singletons, double sample_rows, double tot_rows)
+{
+  if (sample_rows <= 0 || tot_rows <= sample_rows)
+    {
+      return sample_ndv;
+    }
+
+  return sqrt (tot_rows / sample_rows) * sample_singletons + (sample_ndv - sample_singletons);
+}
+
 /*
  * xstats_update_all_statistics () - Updates the statistics
  *                                   for all the classes of the database
  *   return:
- *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sampling_percent(in): percentage of the pages to sample (see STATS_WITH_FULLSCAN)
  *
  * Note: It performs this by getting the list of all classes existing in the
  *       database and their OID's from the catalog's class collection
@@ -370,7 +926,7 @@ error:
  *       of this list one by one.
  */
 int
-xstats_update_all_statistics (THREAD_ENTRY * thread_p, bool with_fullscan)
+xstats_update_all_statistics (THREAD_ENTRY * thread_p, int sampling_percent)
 {
   int error = NO_ERROR;
   RECDES recdes = RECDES_INITIALIZER;	/* Record descriptor for peeking object */
@@ -414,7 +970,7 @@ xstats_update_all_statistics (THREAD_ENTRY * thread_p, bool with_fullscan)
       assert (strlen (classname) < 255);
 #endif
 
-      error = xstats_update_statistics (thread_p, &class_oid, with_fullscan);
+      error = xstats_update_statistics (thread_p, &class_oid, sampling_percent);
       if (error == ER_UPDATE_STAT_CANNOT_GET_LOCK || error == ER_SP_UNKNOWN_SLOTID)
 	{
 	  /* continue with other classes */
@@ -557,6 +1113,10 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	}
 
       tot_n_btstats += disk_attr_p->n_btstats;
+      if (disk_attr_p->histogram != NULL)
+	{
+	  tot_key_info_size += STATS_HISTOGRAM_PACKED_SIZE (disk_attr_p->histogram);
+	}
       for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
 	{
 	  tot_key_info_size += or_packed_domain_size (btree_stats_p->key_type, 0);
@@ -572,6 +1132,7 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	  + (OR_INT_SIZE	/* id of DISK_ATTR */
 	     + OR_INT_SIZE	/* type of DISK_ATTR */
 	     + OR_INT_SIZE	/* n_btstats of DISK_ATTR */
+	     + OR_INT_SIZE	/* has histogram */
 	  ) * n_attrs);		/* number of attributes */
 
   size += ((OR_BTID_ALIGNED_SIZE	/* btid of BTREE_STATS */
@@ -582,7 +1143,7 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	    + OR_INT_SIZE	/* does the BTREE_STATS correspond to a function index */
 	   ) * tot_n_btstats);	/* total number of indexes */
 
-  size += tot_key_info_size;	/* key_type, pkeys[] of BTREE_STATS */
+  size += tot_key_info_size;	/* key_type, pkeys[] of BTREE_STATS, histograms of DISK_ATTR */
 
   size += OR_INT_SIZE;		/* max_unique_keys */
 
@@ -668,6 +1229,13 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
       OR_PUT_INT (buf_p, disk_attr_p->n_btstats);
       buf_p += OR_INT_SIZE;
 
+      OR_PUT_INT (buf_p, disk_attr_p->histogram != NULL ? 1 : 0);
+      buf_p += OR_INT_SIZE;
+      if (disk_attr_p->histogram != NULL)
+	{
+	  buf_p = stats_histogram_pack (buf_p, disk_attr_p->histogram);
+	}
+
       for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
 	{
 	  /* collect maximum unique keys info */
@@ -1223,7 +1791,7 @@ stats_dump_class_statistics (CLASS_STATS * class_stats, FILE * fpp)
  * class_id_p (in) : oid of the partitioned class
  * partitions (in) : oids of partitions
  * int partitions_count (in) : number of partitions
- * with_fullscan(in): true iff WITH FULLSCAN
+ * sampling_percent(in): percentage of the pages to sample (see STATS_WITH_FULLSCAN)
  *
  * Note: Since, during plan generation we only have access to the partitioned
  * class, we have to keep an estimate of average statistics in this class. We
@@ -1239,7 +1807,7 @@ stats_dump_class_statistics (CLASS_STATS * class_stats, FILE * fpp)
  */
 static int
 stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, OID * partitions, int partitions_count,
-				     bool with_fullscan)
+				     int sampling_percent)
 {
   int i, j, k, btree_iter, m;
   int error = NO_ERROR;
@@ -1266,7 +1834,7 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 
   for (i = 0; i < partitions_count; i++)
     {
-      error = xstats_update_statistics (thread_p, &partitions[i], with_fullscan);
+      error = xstats_update_statistics (thread_p, &partitions[i], sampling_percent);
       if (error != NO_ERROR)
 	{
 	  goto cleanup;
@@ -36,6 +36,9 @@
 #include "environment_variable.h"
 #include "file_io.h"
 #include "db_date.h"
+#include "object_representation.h"
+#include "numeric_opfunc.h"
+#include "statistics.h"
 
 
 /* RESERVED_SIZE_IN_PAGE should be aligned */
@@ -422,3 +425,200 @@ btid_to_string (char *buf, int buf_size, BTID * btid)
   buf[buf_size - 1] = 0;
   return buf;
 }
+
+/*
+ * stats_histogram_is_supported_type () - can the column have a histogram ?
+ *   return: true for the types stats_histogram_key () can map to doubles
+ *   type(in):
+ */
+bool
+stats_histogram_is_supported_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_MONETARY:
+    case DB_TYPE_NUMERIC:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * stats_histogram_key () - map a value to the histogram domain
+ *   return: false if the value is null or of an unsupported type
+ *   value(in):
+ *   key(out): the value as a double; the mapping preserves the order of the values of a type
+ */
+bool
+stats_histogram_key (const DB_VALUE * value, double *key)
+{
+  DB_DATETIME *datetime;
+
+  if (value == NULL || DB_IS_NULL (value))
+    {
+      return false;
+    }
+
+  switch (DB_VALUE_DOMAIN_TYPE (value))
+    {
+    case DB_TYPE_SHORT:
+      *key = (double) db_get_short (value);
+      return true;
+
+    case DB_TYPE_INTEGER:
+      *key = (double) db_get_int (value);
+      return true;
+
+    case DB_TYPE_BIGINT:
+      *key = (double) db_get_bigint (value);
+      return true;
+
+    case DB_TYPE_FLOAT:
+      *key = (double) db_get_float (value);
+      return true;
+
+    case DB_TYPE_DOUBLE:
+      *key = db_get_double (value);
+      return true;
+
+    case DB_TYPE_MONETARY:
+      *key = db_get_monetary (value)->amount;
+      return true;
+
+    case DB_TYPE_NUMERIC:
+      numeric_coerce_num_to_double (db_get_numeric (value), DB_VALUE_SCALE (value), key);
+      return true;
+
+    case DB_TYPE_DATE:
+      *key = (double) *db_get_date (value);
+      return true;
+
+    case DB_TYPE_TIME:
+      *key = (double) *db_get_time (value);
+      return true;
+
+    case DB_TYPE_TIMESTAMP:
+      *key = (double) *db_get_timestamp (value);
+      return true;
+
+    case DB_TYPE_DATETIME:
+      datetime = db_get_datetime (value);
+      *key = (double) datetime->date * 86400000.0 + (double) datetime->time;
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * stats_histogram_pack () - pack a histogram for the catalog or the network
+ *   return: advanced pointer
+ *   ptr(in): buffer of at least STATS_HISTOGRAM_PACKED_SIZE (histogram) bytes
+ *   histogram(in):
+ */
+char *
+stats_histogram_pack (char *ptr, const STATS_HISTOGRAM * histogram)
+{
+  int i;
+
+  OR_PUT_INT (ptr, histogram->sample_rows);
+  ptr += OR_INT_SIZE;
+  OR_PUT_INT (ptr, histogram->sample_ndv);
+  ptr += OR_INT_SIZE;
+  OR_PUT_INT (ptr, histogram->n_topn);
+  ptr += OR_INT_SIZE;
+  OR_PUT_INT (ptr, histogram->n_buckets);
+  ptr += OR_INT_SIZE;
+  OR_PUT_DOUBLE (ptr, &histogram->null_freq);
+  ptr += OR_DOUBLE_SIZE;
+
+  for (i = 0; i < histogram->n_topn; i++)
+    {
+      OR_PUT_DOUBLE (ptr, &histogram->topn_values[i]);
+      ptr += OR_DOUBLE_SIZE;
+      OR_PUT_DOUBLE (ptr, &histogram->topn_freqs[i]);
+      ptr += OR_DOUBLE_SIZE;
+    }
+
+  if (histogram->n_buckets > 0)
+    {
+      for (i = 0; i <= histogram->n_buckets; i++)
+	{
+	  OR_PUT_DOUBLE (ptr, &histogram->bounds[i]);
+	  ptr += OR_DOUBLE_SIZE;
+	}
+      for (i = 0; i < histogram->n_buckets; i++)
+	{
+	  OR_PUT_DOUBLE (ptr, &histogram->bucket_freqs[i]);
+	  ptr += OR_DOUBLE_SIZE;
+	  OR_PUT_DOUBLE (ptr, &histogram->bucket_ndv[i]);
+	  ptr += OR_DOUBLE_SIZE;
+	}
+    }
+
+  return ptr;
+}
+
+/*
+ * stats_histogram_unpack () - unpack a histogram packed by stats_histogram_pack ()
+ *   return: advanced pointer
+ *   ptr(in):
+ *   histogram(out):
+ */
+char *
+stats_histogram_unpack (char *ptr, STATS_HISTOGRAM * histogram)
+{
+  int i;
+
+  histogram->sample_rows = OR_GET_INT (ptr);
+  ptr += OR_INT_SIZE;
+  histogram->sample_ndv = OR_GET_INT (ptr);
+  ptr += OR_INT_SIZE;
+  histogram->n_topn = OR_GET_INT (ptr);
+  ptr += OR_INT_SIZE;
+  histogram->n_buckets = OR_GET_INT (ptr);
+  ptr += OR_INT_SIZE;
+  OR_GET_DOUBLE (ptr, &histogram->null_freq);
+  ptr += OR_DOUBLE_SIZE;
+
+  assert (histogram->n_topn >= 0 && histogram->n_topn <= STATS_HISTOGRAM_TOPN_MAX);
+  assert (histogram->n_buckets >= 0 && histogram->n_buckets <= STATS_HISTOGRAM_BUCKETS_MAX);
+
+  for (i = 0; i < histogram->n_topn; i++)
+    {
+      OR_GET_DOUBLE (ptr, &histogram->topn_values[i]);
+      ptr += OR_DOUBLE_SIZE;
+      OR_GET_DOUBLE (ptr, &histogram->topn_freqs[i]);
+      ptr += OR_DOUBLE_SIZE;
+    }
+
+  if (histogram->n_buckets > 0)
+    {
+      for (i = 0; i <= histogram->n_buckets; i++)
+	{
+	  OR_GET_DOUBLE (ptr, &histogram->bounds[i]);
+	  ptr += OR_DOUBLE_SIZE;
+	}
+      for (i = 0; i < histogram->n_buckets; i++)
+	{
+	  OR_GET_DOUBLE (ptr, &histogram->bucket_freqs[i]);
+	  ptr += OR_DOUBLE_SIZE;
+	  OR_GET_DOUBLE (ptr, &histogram->bucket_ndv[i]);
+	  ptr += OR_DOUBLE_SIZE;
+	}
+    }
+
+  return ptr;
+}
@@ -106,9 +106,12 @@ static int rv;
 #define CATALOG_DISK_REPR_N_FIXED_OFF        4
 #define CATALOG_DISK_REPR_FIXED_LENGTH_OFF   8
 #define CATALOG_DISK_REPR_N_VARIABLE_OFF     12
-#define CATALOG_DISK_REPR_RESERVED_1_OFF     16	/* reserved for future use */
+#define CATALOG_DISK_REPR_FLAGS_OFF          16
 #define CATALOG_DISK_REPR_SIZE               56
 
+/* flags of the disk representation; representations written before the flags were introduced have zero here */
+#define CATALOG_DISK_REPR_HAS_HISTOGRAMS     0x01	/* every attribute is followed by a histogram */
+
 /* Each disk attribute is aligned with MAX_ALIGNMENT
    Each disk attribute may be followed by a "value" which is of
    variable size. The below constants does not consider the
@@ -300,14 +303,17 @@ static int catalog_store_attribute_value (THREAD_ENTRY * thread_p, void *value,
 					  PGSLOTID * remembered_slotid);
 static int catalog_store_btree_statistics (THREAD_ENTRY * thread_p, BTREE_STATS * bt_statsp,
 					   CATALOG_RECORD * ct_recordp, PGSLOTID * remembered_slotid);
+static int catalog_store_histogram (THREAD_ENTRY * thread_p, STATS_HISTOGRAM * histogram, CATALOG_RECORD * ct_recordp,
+				    PGSLOTID * remembered_slotid);
 static int catalog_get_record_from_page (THREAD_ENTRY * thread_p, CATALOG_RECORD * ct_recordp);
-static int catalog_fetch_disk_representation (THREAD_ENTRY * thread_p, DISK_REPR * disk_reprp,
+static int catalog_fetch_disk_representation (THREAD_ENTRY * thread_p, DISK_REPR * disk_reprp, int *flags,
 					      CATALOG_RECORD * ct_recordp);
 static int catalog_fetch_disk_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attrp, CATALOG_RECORD * ct_recordp);
 static int catalog_fetch_attribute_value (THREAD_ENTRY * thread_p, void *value, int length,
 					  CATALOG_RECORD * ct_recordp);
 static int catalog_fetch_btree_statistics (THREAD_ENTRY * thread_p, BTREE_STATS * bt_statsp,
 					   CATALOG_RECORD * ct_recordp);
+static int catalog_fetch_histogram (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attrp, CATALOG_RECORD * ct_recordp);
 static int catalog_drop_disk_representation_from_page (THREAD_ENTRY * thread_p, VPID * page_id, PGSLOTID slot_id);
 static int catalog_drop_representation_class_from_page (THREAD_ENTRY * thread_p, VPID * dir_pgid, PAGE_PTR * dir_pgptr,
 							VPID * page_id, PGSLOTID slot_id);
@@ -345,7 +351,7 @@ static void catalog_dump_representation (DISK_REPR * dr);
 static void catalog_clear_hash_table ();
 
 static void catalog_put_page_header (char *rec_p, CATALOG_PAGE_HEADER * header_p);
-static void catalog_get_disk_representation (DISK_REPR * disk_repr_p, char *rec_p);
+static void catalog_get_disk_representation (DISK_REPR * disk_repr_p, int *flags_p, char *rec_p);
 static void catalog_put_disk_representation (char *rec_p, DISK_REPR * disk_repr_p);
 static void catalog_get_disk_attribute (DISK_ATTR * attr_p, char *rec_p);
 static void catalog_put_disk_attribute (char *rec_p, DISK_ATTR * attr_p);
@@ -354,7 +360,7 @@ static void catalog_get_class_info_from_record (CLS_INFO * class_info_p, char *r
 static void catalog_put_class_info_to_record (char *rec_p, CLS_INFO * class_info_p);
 static void catalog_get_repr_item_from_record (CATALOG_REPR_ITEM * item_p, char *rec_p);
 static void catalog_put_repr_item_to_record (char *rec_p, CATALOG_REPR_ITEM * item_p);
-static int catalog_assign_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attr_p,
+static int catalog_assign_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attr_p, int repr_flags,
 				     CATALOG_RECORD * catalog_record_p);
 
 static void
@@ -367,7 +373,7 @@ catalog_put_page_header (char *rec_p, CATALOG_PAGE_HEADER * header_p)
 }
 
 static void
-catalog_get_disk_representation (DISK_REPR * disk_repr_p, char *rec_p)
+catalog_get_disk_representation (DISK_REPR * disk_repr_p, int *flags_p, char *rec_p)
 {
   disk_repr_p->id = (REPR_ID) OR_GET_INT (rec_p + CATALOG_DISK_REPR_ID_OFF);
   disk_repr_p->n_fixed = OR_GET_INT (rec_p + CATALOG_DISK_REPR_N_FIXED_OFF);
@@ -376,9 +382,7 @@ catalog_get_disk_representation (DISK_REPR * disk_repr_p, char *rec_p)
   disk_repr_p->n_variable = OR_GET_INT (rec_p + CATALOG_DISK_REPR_N_VARIABLE_OFF);
   disk_repr_p->variable = NULL;
 
-#if 0				/* reserved for future use */
-  disk_repr_p->repr_reserved_1 = OR_GET_INT (rec_p + CATALOG_DISK_REPR_RESERVED_1_OFF);
-#endif
+  *flags_p = OR_GET_INT (rec_p + CATALOG_DISK_REPR_FLAGS_OFF);
 }
 
 static void
@@ -389,9 +393,7 @@ catalog_put_disk_representation (char *rec_p, DISK_REPR * disk_repr_p)
   OR_PUT_INT (rec_p + CATALOG_DISK_REPR_FIXED_LENGTH_OFF, disk_repr_p->fixed_length);
   OR_PUT_INT (rec_p + CATALOG_DISK_REPR_N_VARIABLE_OFF, disk_repr_p->n_variable);
 
-#if 1				/* reserved for future use */
-  OR_PUT_INT (rec_p + CATALOG_DISK_REPR_RESERVED_1_OFF, 0);
-#endif
+  OR_PUT_INT (rec_p + CATALOG_DISK_REPR_FLAGS_OFF, CATALOG_DISK_REPR_HAS_HISTOGRAMS);
 }
 
 static void
@@ -408,6 +410,7 @@ catalog_get_disk_attribute (DISK_ATTR * attr_p, char *rec_p)
   OR_GET_OID (rec_p + CATALOG_DISK_ATTR_CLASSOID_OFF, &attr_p->classoid);
   attr_p->n_btstats = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_N_BTSTATS_OFF);
   attr_p->bt_stats = NULL;
+  attr_p->histogram = NULL;
 }
 
 static void
@@ -821,6 +824,11 @@ catalog_free_representation (DISK_REPR * repr_p)
 		}
 	      db_private_free_and_init (NULL, attr_p->bt_stats);
 	    }
+
+	  if (attr_p->histogram != NULL)
+	    {
+	      db_private_free_and_init (NULL, attr_p->histogram);
+	    }
 	}
 
       if (repr_p->fixed != NULL)
@@ -1271,6 +1279,44 @@ catalog_store_btree_statistics (THREAD_ENTRY * thread_p, BTREE_STATS * btree_sta
   return NO_ERROR;
 }
 
+/*
+ * catalog_store_histogram () -
+ *   return: NO_ERROR or ER_FAILED
+ *   histogram(in): column histogram or NULL
+ *   ct_recordp(in): pointer to CATALOG_RECORD structure (catalog record)
+ *   remembered_slotid(in):
+ *
+ * Note: The histogram is stored as its packed length followed by the packed histogram; a zero length stands for
+ * an attribute without histogram.
+ */
+static int
+catalog_store_histogram (THREAD_ENTRY * thread_p, STATS_HISTOGRAM * histogram, CATALOG_RECORD * catalog_record_p,
+			 PGSLOTID * remembered_slot_id_p)
+{
+  char packed[STATS_HISTOGRAM_PACKED_SIZE_MAX];
+  int length;
+
+  length = (histogram != NULL) ? STATS_HISTOGRAM_PACKED_SIZE (histogram) : 0;
+  assert (length <= STATS_HISTOGRAM_PACKED_SIZE_MAX);
+
+  if (catalog_write_unwritten_portion (thread_p, catalog_record_p, remembered_slot_id_p, OR_INT_SIZE) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  OR_PUT_INT (catalog_record_p->recdes.data + catalog_record_p->offset, length);
+  catalog_record_p->offset += OR_INT_SIZE;
+
+  if (length == 0)
+    {
+      return NO_ERROR;
+    }
+
+  (void) stats_histogram_pack (packed, histogram);
+
+  return catalog_store_attribute_value (thread_p, packed, length, catalog_record_p, remembered_slot_id_p);
+}
+
 /*
  * catalog_get_record_from_page () - Get the catalog record from the page.
  *   return: NO_ERROR or ER_FAILED
@@ -1345,20 +1391,22 @@ catalog_read_unread_portion (THREAD_ENTRY * thread_p, CATALOG_RECORD * catalog_r
  * catalog_fetch_disk_representation () -
  *   return: NO_ERROR or ER_FAILED
  *   disk_reprp(in): pointer to DISK_REPR structure (disk representation)
+ *   flags(out): CATALOG_DISK_REPR_* flags of the representation
  *   ct_recordp(in): pointer to CATALOG_RECORD structure (catalog record)
  *
  * Note: Transforms catalog disk form into disk representation form.
  * Fetch DISK_REPR structure from catalog record.
  */
 static int
-catalog_fetch_disk_representation (THREAD_ENTRY * thread_p, DISK_REPR * disk_repr_p, CATALOG_RECORD * catalog_record_p)
+catalog_fetch_disk_representation (THREAD_ENTRY * thread_p, DISK_REPR * disk_repr_p, int *flags_p,
+				   CATALOG_RECORD * catalog_record_p)
 {
   if (catalog_read_unread_portion (thread_p, catalog_record_p, CATALOG_DISK_REPR_SIZE) != NO_ERROR)
     {
       return ER_FAILED;
     }
 
-  catalog_get_disk_representation (disk_repr_p, catalog_record_p->recdes.data + catalog_record_p->offset);
+  catalog_get_disk_representation (disk_repr_p, flags_p, catalog_record_p->recdes.data + catalog_record_p->offset);
   catalog_record_p->offset += CATALOG_DISK_REPR_SIZE;
 
   return NO_ERROR;
@@ -1535,6 +1583,55 @@ exit_on_end:
   return NO_ERROR;
 }
 
+/*
+ * catalog_fetch_histogram () -
+ *   return: NO_ERROR or ER_FAILED
+ *   disk_attrp(in/out): attribute the histogram belongs to
+ *   ct_recordp(in): pointer to CATALOG_RECORD structure (catalog record)
+ *
+ * Note: Fetch the histogram stored by catalog_store_histogram ().
+ */
+static int
+catalog_fetch_histogram (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attr_p, CATALOG_RECORD * catalog_record_p)
+{
+  char packed[STATS_HISTOGRAM_PACKED_SIZE_MAX];
+  int length;
+
+  if (catalog_read_unread_portion (thread_p, catalog_record_p, OR_INT_SIZE) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  length = OR_GET_INT (catalog_record_p->recdes.data + catalog_record_p->offset);
+  catalog_record_p->offset += OR_INT_SIZE;
+
+  if (length == 0)
+    {
+      return NO_ERROR;
+    }
+
+  if (length < 0 || length > STATS_HISTOGRAM_PACKED_SIZE_MAX)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+
+  if (catalog_fetch_attribute_value (thread_p, packed, length, catalog_record_p) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  disk_attr_p->histogram = (STATS_HISTOGRAM *) db_private_alloc (thread_p, sizeof (STATS_HISTOGRAM));
+  if (disk_attr_p->histogram == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  (void) stats_histogram_unpack (packed, disk_attr_p->histogram);
+
+  return NO_ERROR;
+}
+
 static int
 catalog_drop_representation_helper (THREAD_ENTRY * thread_p, PAGE_PTR page_p, VPID * page_id_p, PGSLOTID slot_id)
 {
@@ -2714,6 +2811,11 @@ catalog_sum_disk_attribute_size (DISK_ATTR * attrs_p, int count)
 	{
 	  size += CATALOG_BT_STATS_SIZE;
 	}
+      size += OR_INT_SIZE;
+      if (disk_attrp->histogram != NULL)
+	{
+	  size += STATS_HISTOGRAM_PACKED_SIZE (disk_attrp->histogram);
+	}
     }
 
   return size;
@@ -2892,6 +2994,18 @@ catalog_add_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
 	      return error_code;
 	    }
 	}
+
+      if (catalog_store_histogram (thread_p, disk_attr_p->histogram, &catalog_record, &remembered_slot_id) != NO_ERROR)
+	{
+	  db_private_free_and_init (thread_p, data);
+
+	  ASSERT_ERROR_AND_SET (error_code);
+	  if (do_end_access)
+	    {
+	      catalog_end_access_with_dir_oid (thread_p, catalog_access_info_p, ER_FAILED);
+	    }
+	  return error_code;
+	}
     }
 
   catalog_record.recdes.length = catalog_record.offset;
@@ -3711,10 +3825,12 @@ catalog_fixup_missing_disk_representation (THREAD_ENTRY * thread_p, OID * class_
  * catalog_assign_attribute () -
  *   return: NO_ERROR or ER_FAILED
  *   disk_attrp(in): pointer to DISK_ATTR structure (disk representation)
+ *   repr_flags(in): CATALOG_DISK_REPR_* flags of the representation
  *   catalog_record_p(in): pointer to CATALOG_RECORD structure (catalog record)
  */
 static int
-catalog_assign_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attr_p, CATALOG_RECORD * catalog_record_p)
+catalog_assign_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attr_p, int repr_flags,
+			  CATALOG_RECORD * catalog_record_p)
 {
   BTREE_STATS *btree_stats_p;
   int i, n_btstats;
@@ -3767,6 +3883,14 @@ catalog_assign_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attr_p, CATA
 	}
     }
 
+  if (repr_flags & CATALOG_DISK_REPR_HAS_HISTOGRAMS)
+    {
+      if (catalog_fetch_histogram (thread_p, disk_attr_p, catalog_record_p) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
   return NO_ERROR;
 }
 
@@ -3812,6 +3936,7 @@ catalog_get_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
   CATALOG_ACCESS_INFO catalog_access_info = CATALOG_ACCESS_INFO_INITIALIZER;
   OID dir_oid;
   int i, n_attrs;
+  int repr_flags = 0;
   int error = NO_ERROR;
   bool do_end_access = false;
 
@@ -3877,7 +4002,7 @@ catalog_get_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
     }
   memset (disk_repr_p, 0, sizeof (DISK_REPR));
 
-  if (catalog_fetch_disk_representation (thread_p, disk_repr_p, &catalog_record) != NO_ERROR)
+  if (catalog_fetch_disk_representation (thread_p, disk_repr_p, &repr_flags, &catalog_record) != NO_ERROR)
     {
       if (disk_repr_p)
 	{
@@ -3918,6 +4043,7 @@ catalog_get_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
 	  disk_attr_p->value = NULL;
 	  disk_attr_p->bt_stats = NULL;
 	  disk_attr_p->n_btstats = 0;
+	  disk_attr_p->histogram = NULL;
 	}
     }
   else
@@ -3940,6 +4066,7 @@ catalog_get_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
 	  disk_attr_p->value = NULL;
 	  disk_attr_p->bt_stats = NULL;
 	  disk_attr_p->n_btstats = 0;
+	  disk_attr_p->histogram = NULL;
 	}
     }
   else
@@ -3949,7 +4076,7 @@ catalog_get_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
 
   for (i = 0; i < disk_repr_p->n_fixed; i++)
     {
-      if (catalog_assign_attribute (thread_p, &disk_repr_p->fixed[i], &catalog_record) != NO_ERROR)
+      if (catalog_assign_attribute (thread_p, &disk_repr_p->fixed[i], repr_flags, &catalog_record) != NO_ERROR)
 	{
 	  goto exit_on_error;
 	}
@@ -3957,7 +4084,7 @@ catalog_get_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
 
   for (i = 0; i < disk_repr_p->n_variable; i++)
     {
-      if (catalog_assign_attribute (thread_p, &disk_repr_p->variable[i], &catalog_record) != NO_ERROR)
+      if (catalog_assign_attribute (thread_p, &disk_repr_p->variable[i], repr_flags, &catalog_record) != NO_ERROR)
 	{
 	  goto exit_on_error;
 	}
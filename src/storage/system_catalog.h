@@ -72,9 +72,6 @@ struct disk_representation
   int fixed_length;		/* total length of fixed attributes */
   int n_variable;		/* number of variable attributes */
   struct disk_attribute *variable;	/* variable attribute structures */
-#if 0				/* reserved for future use */
-  int repr_reserved_1;
-#endif
 };				/* object disk representation */
 
 
@@ -94,6 +91,7 @@ struct disk_attribute
   OID classoid;			/* source class object id */
   int n_btstats;		/* number of B+tree statistics information */
   BTREE_STATS *bt_stats;	/* pointer to array of BTREE_STATS; BTREE_STATS[n_btstats] */
+  STATS_HISTOGRAM *histogram;	/* value distribution; NULL if not collected */
 };				/* disk attribute structure */
 
 typedef struct cls_info CLS_INFO;
@@ -30,6 +30,9 @@
 #if !defined(WINDOWS)
 #include <sys/time.h>
 #endif /* !WINDOWS */
+#if defined (LINUX)
+#include <execinfo.h>
+#endif /* LINUX */
 
 #include "porting.h"
 #include "critical_section.h"
@@ -126,7 +129,14 @@ static int csect_wait_on_promoter_queue (THREAD_ENTRY * thread_p, SYNC_CRITICAL_
 static int csect_wakeup_waiting_writer (SYNC_CRITICAL_SECTION * csect);
 static int csect_wakeup_waiting_promoter (SYNC_CRITICAL_SECTION * csect);
 static int csect_demote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs);
-static int csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs);
+static int csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs,
+					   void *site);
+static int csect_enter_critical_section_internal (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect,
+						  int wait_secs, void *site);
+static int csect_enter_critical_section_as_reader_internal (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect,
+							    int wait_secs, void *site);
+static void csect_record_wait (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, void *holder_site,
+			       TSC_TICKS * start_tick);
 static int csect_check_own_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect);
 
 static SYNC_STATS_CHUNK *sync_allocate_sync_stats_chunk (void);
@@ -137,6 +147,8 @@ static int sync_return_sync_stats_to_pool (SYNC_STATS_CHUNK * sync_stats_chunk,
 static SYNC_STATS *sync_allocate_sync_stats (SYNC_PRIMITIVE_TYPE sync_prim_type, const char *name);
 static int sync_deallocate_sync_stats (SYNC_STATS * stats);
 static void sync_reset_stats_metrics (SYNC_STATS * stats);
+static int sync_lock_mutex_profiled (THREAD_ENTRY * thread_p, pthread_mutex_t * mutex, SYNC_WAIT_CLASS wait_class,
+				     const char *name, void *holder_site);
 
 /*
  * csect_initialize_critical_section() - initialize critical section
@@ -173,6 +185,7 @@ csect_initialize_critical_section (SYNC_CRITICAL_SECTION * csect, const char *na
   csect->rwlock = 0;
   csect->owner = ((pthread_t) 0);
   csect->tran_index = -1;
+  csect->owner_site = NULL;
   csect->waiting_readers = 0;
   csect->waiting_writers = 0;
   csect->waiting_writers_queue = NULL;
@@ -218,6 +231,7 @@ csect_finalize_critical_section (SYNC_CRITICAL_SECTION * csect)
   csect->rwlock = 0;
   csect->owner = ((pthread_t) 0);
   csect->tran_index = -1;
+  csect->owner_site = NULL;
   csect->waiting_readers = 0;
   csect->waiting_writers = 0;
   csect->waiting_writers_queue = NULL;
@@ -458,6 +472,31 @@ csect_wakeup_waiting_promoter (SYNC_CRITICAL_SECTION * csect)
   return error_code;
 }
 
+/*
+ * csect_record_wait () - account a wait of the thread on the critical section
+ *   return: void
+ *   csect(in): critical section
+ *   holder_site(in): call site of the holder the thread waited for
+ *   start_tick(in): when the wait started
+ */
+static void
+csect_record_wait (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, void *holder_site, TSC_TICKS * start_tick)
+{
+  TSC_TICKS end_tick;
+  TSCTIMEVAL tv_diff;
+
+  tsc_getticks (&end_tick);
+  tsc_elapsed_time_usec (&tv_diff, end_tick, *start_tick);
+
+  if (thread_p->event_stats.trace_slow_query == true)
+    {
+      TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, tv_diff);
+    }
+
+  sync_profile_record_wait (thread_p, SYNC_WAIT_CSECT, CSECT_NAME (csect), holder_site,
+			    tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec);
+}
+
 /*
  * csect_enter_critical_section() - lock critical section
  *   return: 0 if success, or error code
@@ -466,13 +505,27 @@ csect_wakeup_waiting_promoter (SYNC_CRITICAL_SECTION * csect)
  */
 int
 csect_enter_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs)
+{
+  return csect_enter_critical_section_internal (thread_p, csect, wait_secs, SYNC_CALLER_SITE ());
+}
+
+/*
+ * csect_enter_critical_section_internal() - lock critical section
+ *   return: 0 if success, or error code
+ *   csect(in): critical section
+ *   wait_secs(in): timeout second
+ *   site(in): call site of the caller, for the contention profiler
+ */
+static int
+csect_enter_critical_section_internal (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs,
+				       void *site)
 {
   int error_code = NO_ERROR, r;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
 
-  TSC_TICKS wait_start_tick, wait_end_tick;
-  TSCTIMEVAL wait_tv_diff;
+  TSC_TICKS wait_start_tick;
+  void *holder_site;
 
   assert (csect != NULL);
 
@@ -516,18 +569,11 @@ csect_enter_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * c
 	      csect->waiting_writers++;
 	      csect->stats->nwait++;
 
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_start_tick);
-		}
+	      holder_site = csect->owner_site;
+	      tsc_getticks (&wait_start_tick);
 
 	      error_code = csect_wait_on_writer_queue (thread_p, csect, INF_WAIT, NULL);
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_end_tick);
-		  tsc_elapsed_time_usec (&wait_tv_diff, wait_end_tick, wait_start_tick);
-		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
-		}
+	      csect_record_wait (thread_p, csect, holder_site, &wait_start_tick);
 
 	      csect->waiting_writers--;
 	      if (error_code != NO_ERROR)
@@ -575,18 +621,11 @@ csect_enter_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * c
 
 	      csect->waiting_writers++;
 
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_start_tick);
-		}
+	      holder_site = csect->owner_site;
+	      tsc_getticks (&wait_start_tick);
 
 	      error_code = csect_wait_on_writer_queue (thread_p, csect, NOT_WAIT, &to);
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_end_tick);
-		  tsc_elapsed_time_usec (&wait_tv_diff, wait_end_tick, wait_start_tick);
-		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
-		}
+	      csect_record_wait (thread_p, csect, holder_site, &wait_start_tick);
 
 	      csect->waiting_writers--;
 	      if (error_code != NO_ERROR)
@@ -628,6 +667,7 @@ csect_enter_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * c
   /* record that I am the writer of the csect. */
   csect->owner = thread_p->tid;
   csect->tran_index = thread_p->tran_index;
+  csect->owner_site = site;
 
   tsc_getticks (&end_tick);
   tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
@@ -682,7 +722,7 @@ csect_enter (THREAD_ENTRY * thread_p, int cs_index, int wait_secs)
   assert (csect->cs_index == cs_index);
 #endif
 
-  return csect_enter_critical_section (thread_p, csect, wait_secs);
+  return csect_enter_critical_section_internal (thread_p, csect, wait_secs, SYNC_CALLER_SITE ());
 }
 
 /*
@@ -693,12 +733,26 @@ csect_enter (THREAD_ENTRY * thread_p, int cs_index, int wait_secs)
  */
 int
 csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs)
+{
+  return csect_enter_critical_section_as_reader_internal (thread_p, csect, wait_secs, SYNC_CALLER_SITE ());
+}
+
+/*
+ * csect_enter_critical_section_as_reader_internal () - acquire a read lock
+ *   return: 0 if success, or error code
+ *   csect(in): critical section
+ *   wait_secs(in): timeout second
+ *   site(in): call site of the caller, for the contention profiler
+ */
+static int
+csect_enter_critical_section_as_reader_internal (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect,
+						 int wait_secs, void *site)
 {
   int error_code = NO_ERROR, r;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
-  TSC_TICKS wait_start_tick, wait_end_tick;
-  TSCTIMEVAL wait_tv_diff;
+  TSC_TICKS wait_start_tick;
+  void *holder_site;
 
   assert (csect != NULL);
 
@@ -742,18 +796,11 @@ csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_S
 	      csect->stats->nwait++;
 	      thread_p->resume_status = THREAD_CSECT_READER_SUSPENDED;
 
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_start_tick);
-		}
+	      holder_site = csect->owner_site;
+	      tsc_getticks (&wait_start_tick);
 
 	      error_code = pthread_cond_wait (&csect->readers_ok, &csect->lock);
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_end_tick);
-		  tsc_elapsed_time_usec (&wait_tv_diff, wait_end_tick, wait_start_tick);
-		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
-		}
+	      csect_record_wait (thread_p, csect, holder_site, &wait_start_tick);
 
 	      csect->waiting_readers--;
 
@@ -791,18 +838,11 @@ csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_S
 	      csect->waiting_readers++;
 	      thread_p->resume_status = THREAD_CSECT_READER_SUSPENDED;
 
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_start_tick);
-		}
+	      holder_site = csect->owner_site;
+	      tsc_getticks (&wait_start_tick);
 
 	      error_code = pthread_cond_timedwait (&csect->readers_ok, &csect->lock, &to);
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_end_tick);
-		  tsc_elapsed_time_usec (&wait_tv_diff, wait_end_tick, wait_start_tick);
-		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
-		}
+	      csect_record_wait (thread_p, csect, holder_site, &wait_start_tick);
 
 	      csect->waiting_readers--;
 
@@ -850,6 +890,7 @@ csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_S
 
       /* rwlock will be > 0. record that a reader enters the csect. */
       csect->rwlock++;
+      csect->owner_site = site;
     }
 
   tsc_getticks (&end_tick);
@@ -903,7 +944,7 @@ csect_enter_as_reader (THREAD_ENTRY * thread_p, int cs_index, int wait_secs)
   assert (csect->cs_index == cs_index);
 #endif
 
-  return csect_enter_critical_section_as_reader (thread_p, csect, wait_secs);
+  return csect_enter_critical_section_as_reader_internal (thread_p, csect, wait_secs, SYNC_CALLER_SITE ());
 }
 
 /*
@@ -920,8 +961,8 @@ csect_demote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
   int error_code = NO_ERROR, r;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
-  TSC_TICKS wait_start_tick, wait_end_tick;
-  TSCTIMEVAL wait_tv_diff;
+  TSC_TICKS wait_start_tick;
+  void *holder_site;
 
   assert (csect != NULL);
 
@@ -988,18 +1029,11 @@ csect_demote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 	      csect->stats->nwait++;
 	      thread_p->resume_status = THREAD_CSECT_READER_SUSPENDED;
 
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_start_tick);
-		}
+	      holder_site = csect->owner_site;
+	      tsc_getticks (&wait_start_tick);
 
 	      error_code = pthread_cond_wait (&csect->readers_ok, &csect->lock);
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_end_tick);
-		  tsc_elapsed_time_usec (&wait_tv_diff, wait_end_tick, wait_start_tick);
-		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
-		}
+	      csect_record_wait (thread_p, csect, holder_site, &wait_start_tick);
 
 	      csect->waiting_readers--;
 
@@ -1037,18 +1071,11 @@ csect_demote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 	      csect->waiting_readers++;
 	      thread_p->resume_status = THREAD_CSECT_READER_SUSPENDED;
 
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_start_tick);
-		}
+	      holder_site = csect->owner_site;
+	      tsc_getticks (&wait_start_tick);
 
 	      error_code = pthread_cond_timedwait (&csect->readers_ok, &csect->lock, &to);
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_end_tick);
-		  tsc_elapsed_time_usec (&wait_tv_diff, wait_end_tick, wait_start_tick);
-		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
-		}
+	      csect_record_wait (thread_p, csect, holder_site, &wait_start_tick);
 
 	      csect->waiting_readers--;
 
@@ -1170,17 +1197,18 @@ csect_demote (THREAD_ENTRY * thread_p, int cs_index, int wait_secs)
  *   return: 0 if success, or error code
  *   csect(in): critical section
  *   wait_secs(in): timeout second
+ *   site(in): call site of the caller, for the contention profiler
  *
  * Note: Always successful because I have the write lock.
  */
 static int
-csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs)
+csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs, void *site)
 {
   int error_code = NO_ERROR, r;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
-  TSC_TICKS wait_start_tick, wait_end_tick;
-  TSCTIMEVAL wait_tv_diff;
+  TSC_TICKS wait_start_tick;
+  void *holder_site;
 
   assert (csect != NULL);
 
@@ -1239,18 +1267,11 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 	      csect->waiting_writers++;
 	      csect->stats->nwait++;
 
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_start_tick);
-		}
+	      holder_site = csect->owner_site;
+	      tsc_getticks (&wait_start_tick);
 
 	      error_code = csect_wait_on_promoter_queue (thread_p, csect, INF_WAIT, NULL);
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_end_tick);
-		  tsc_elapsed_time_usec (&wait_tv_diff, wait_end_tick, wait_start_tick);
-		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
-		}
+	      csect_record_wait (thread_p, csect, holder_site, &wait_start_tick);
 
 	      csect->waiting_writers--;
 	      if (error_code != NO_ERROR)
@@ -1275,18 +1296,11 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 
 	      csect->waiting_writers++;
 
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_start_tick);
-		}
+	      holder_site = csect->owner_site;
+	      tsc_getticks (&wait_start_tick);
 
 	      error_code = csect_wait_on_promoter_queue (thread_p, csect, NOT_WAIT, &to);
-	      if (thread_p->event_stats.trace_slow_query == true)
-		{
-		  tsc_getticks (&wait_end_tick);
-		  tsc_elapsed_time_usec (&wait_tv_diff, wait_end_tick, wait_start_tick);
-		  TSC_ADD_TIMEVAL (thread_p->event_stats.cs_waits, wait_tv_diff);
-		}
+	      csect_record_wait (thread_p, csect, holder_site, &wait_start_tick);
 
 	      csect->waiting_writers--;
 	      if (error_code != NO_ERROR)
@@ -1326,6 +1340,7 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
   /* record that I am the writer of the csect. */
   csect->owner = thread_p->tid;
   csect->tran_index = thread_p->tran_index;
+  csect->owner_site = site;
 
   tsc_getticks (&end_tick);
   tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
@@ -1374,7 +1389,7 @@ csect_promote (THREAD_ENTRY * thread_p, int cs_index, int wait_secs)
   assert (cs_index < CRITICAL_SECTION_COUNT);
 
   csect = &csectgl_Critical_sections[cs_index];
-  return csect_promote_critical_section (thread_p, csect, wait_secs);
+  return csect_promote_critical_section (thread_p, csect, wait_secs, SYNC_CALLER_SITE ());
 }
 
 /*
@@ -1833,6 +1848,7 @@ rwlock_initialize (SYNC_RWLOCK * rwlock, const char *name)
 
   rwlock->name = name;
   rwlock->num_readers = 0;
+  rwlock->owner_site = NULL;
 
   rwlock->stats = sync_allocate_sync_stats (SYNC_TYPE_RWLOCK, rwlock->name);
   if (rwlock->stats == NULL)
@@ -1900,7 +1916,7 @@ rwlock_read_lock (SYNC_RWLOCK * rwlock)
   tsc_getticks (&start_tick);
 
   /* hold the reader lock */
-  error_code = pthread_mutex_lock (&rwlock->read_lock);
+  error_code = sync_lock_mutex_profiled (NULL, &rwlock->read_lock, SYNC_WAIT_RWLOCK, rwlock->name, rwlock->owner_site);
   if (error_code != NO_ERROR)
     {
       er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_LOCK, 0);
@@ -1914,7 +1930,8 @@ rwlock_read_lock (SYNC_RWLOCK * rwlock)
   /* hold the global lock if it is the first reader */
   if (rwlock->num_readers == 1)
     {
-      error_code = pthread_mutex_lock (&rwlock->global_lock);
+      error_code =
+	sync_lock_mutex_profiled (NULL, &rwlock->global_lock, SYNC_WAIT_RWLOCK, rwlock->name, rwlock->owner_site);
       if (error_code != NO_ERROR)
 	{
 	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_LOCK, 0);
@@ -1924,6 +1941,8 @@ rwlock_read_lock (SYNC_RWLOCK * rwlock)
 
 	  return ER_CSS_PTHREAD_MUTEX_LOCK;
 	}
+
+      rwlock->owner_site = SYNC_CALLER_SITE ();
     }
 
   /* collect statistics */
@@ -2014,7 +2033,8 @@ rwlock_write_lock (SYNC_RWLOCK * rwlock)
 
   tsc_getticks (&start_tick);
 
-  error_code = pthread_mutex_lock (&rwlock->global_lock);
+  error_code =
+    sync_lock_mutex_profiled (NULL, &rwlock->global_lock, SYNC_WAIT_RWLOCK, rwlock->name, rwlock->owner_site);
   if (error_code != NO_ERROR)
     {
       er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_LOCK, 0);
@@ -2022,6 +2042,8 @@ rwlock_write_lock (SYNC_RWLOCK * rwlock)
       return ER_CSS_PTHREAD_MUTEX_LOCK;
     }
 
+  rwlock->owner_site = SYNC_CALLER_SITE ();
+
   /* collect statistics */
   tsc_getticks (&end_tick);
   tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
@@ -2122,6 +2144,7 @@ rmutex_initialize (SYNC_RMUTEX * rmutex, const char *name)
 
   rmutex->owner = (pthread_t) 0;
   rmutex->lock_cnt = 0;
+  rmutex->owner_site = NULL;
 
   rmutex->stats = sync_allocate_sync_stats (SYNC_TYPE_RMUTEX, name);
   if (rmutex->stats == NULL)
@@ -2198,7 +2221,8 @@ rmutex_lock (THREAD_ENTRY * thread_p, SYNC_RMUTEX * rmutex)
     {
       tsc_getticks (&start_tick);
 
-      if (pthread_mutex_lock (&rmutex->lock) != NO_ERROR)
+      if (sync_lock_mutex_profiled (thread_p, &rmutex->lock, SYNC_WAIT_RMUTEX, rmutex->stats->name,
+				    rmutex->owner_site) != NO_ERROR)
 	{
 	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_LOCK, 0);
 	  assert (0);
@@ -2216,6 +2240,7 @@ rmutex_lock (THREAD_ENTRY * thread_p, SYNC_RMUTEX * rmutex)
       rmutex->lock_cnt++;
 
       rmutex->owner = thread_p->tid;
+      rmutex->owner_site = SYNC_CALLER_SITE ();
     }
 
   return NO_ERROR;
@@ -2591,3 +2616,588 @@ sync_dump_statistics (FILE * fp, SYNC_PRIMITIVE_TYPE type)
       rmutex_dump_statistics (fp);
     }
 }
+
+/*
+ * Contention profiler
+ *
+ * A thread that blocked on a synchronization primitive records the wait in its own profile, keyed by the wait
+ * class, the name of the primitive and the call site of the holder it waited for. Only the owner thread writes
+ * its profile, so recording a wait takes no latch. SHOW CONTENTION STATISTICS reads the profiles of all threads
+ * without latching them and merges them; a row may be a little behind the waits that are being recorded.
+ */
+
+#define SYNC_PROFILE_NUM_SLOTS		128	/* must be a power of 2 */
+#define SYNC_PROFILE_MAX_PROBES		16
+
+/* a wait of [2^i, 2^(i+1)) usecs is counted in bucket i, bucket 0 counts the waits under 2 usecs and the last
+ * bucket the waits of 2^23 usecs (~8 secs) and over. */
+#define SYNC_PROFILE_HISTOGRAM_SIZE	24
+
+typedef struct sync_profile_slot SYNC_PROFILE_SLOT;
+struct sync_profile_slot
+{
+  const char *name;		/* name of the primitive, NULL if the slot is free */
+  void *holder_site;		/* call site of the holder */
+  SYNC_WAIT_CLASS wait_class;
+  UINT64 nwaits;
+  UINT64 total_usec;
+  UINT64 max_usec;
+  UINT64 histogram[SYNC_PROFILE_HISTOGRAM_SIZE];
+};
+
+struct sync_wait_profile
+{
+  SYNC_PROFILE_SLOT slots[SYNC_PROFILE_NUM_SLOTS];
+};
+typedef struct sync_wait_profile SYNC_WAIT_PROFILE;
+
+/* waits of all threads on a wait point, merged for SHOW CONTENTION STATISTICS */
+typedef struct sync_profile_row SYNC_PROFILE_ROW;
+struct sync_profile_row
+{
+  SYNC_PROFILE_SLOT merged;
+  int num_waiters;		/* number of threads that waited */
+  int top_waiter_index;		/* thread that waited longest in total */
+  UINT64 top_waiter_usec;
+  int last_thread_index;	/* thread being merged, and its waits so far */
+  UINT64 last_thread_usec;
+};
+
+static const char *sync_Wait_class_names[SYNC_WAIT_CLASS_COUNT] = {
+  "CSECT", "RWLOCK", "RMUTEX", "PGBUF_LATCH", "LOCK"
+};
+
+static SYNC_PROFILE_SLOT *sync_profile_find_slot (SYNC_WAIT_PROFILE * profile, SYNC_WAIT_CLASS wait_class,
+						  const char *name, void *holder_site);
+static int sync_profile_compare_rows (const void *a, const void *b);
+static int sync_profile_make_msecs (DB_VALUE * value, UINT64 usec);
+static void sync_profile_dump_histogram (const SYNC_PROFILE_SLOT * slot, char *buf, int buf_size);
+
+/*
+ * sync_lock_mutex_profiled () - lock a mutex, recording the wait if it is busy
+ *   return: 0 if success, or error code of pthread_mutex_lock
+ *
+ *   thread_p(in):
+ *   mutex(in):
+ *   wait_class(in):
+ *   name(in): name of the primitive the mutex belongs to
+ *   holder_site(in): call site of the holder, read before waiting
+ */
+static int
+sync_lock_mutex_profiled (THREAD_ENTRY * thread_p, pthread_mutex_t * mutex, SYNC_WAIT_CLASS wait_class,
+			  const char *name, void *holder_site)
+{
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv_diff;
+  int error_code;
+
+  if (pthread_mutex_trylock (mutex) == 0)
+    {
+      return 0;
+    }
+
+  tsc_getticks (&start_tick);
+  error_code = pthread_mutex_lock (mutex);
+  if (error_code == 0)
+    {
+      tsc_getticks (&end_tick);
+      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+      sync_profile_record_wait (thread_p, wait_class, name, holder_site,
+				(UINT64) tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec);
+    }
+
+  return error_code;
+}
+
+/*
+ * sync_profile_find_slot () - find or add the slot of a wait point in a profile
+ *   return: slot, or NULL if the profile has no room for the wait point
+ *
+ *   profile(in):
+ *   wait_class(in):
+ *   name(in):
+ *   holder_site(in):
+ *
+ * Note: the name is set last, since a slot with a name is visible to the readers of the profile.
+ */
+static SYNC_PROFILE_SLOT *
+sync_profile_find_slot (SYNC_WAIT_PROFILE * profile, SYNC_WAIT_CLASS wait_class, const char *name, void *holder_site)
+{
+  SYNC_PROFILE_SLOT *slot;
+  unsigned int hash;
+  int i;
+
+  hash = (unsigned int) ((UINTPTR) name ^ ((UINTPTR) holder_site >> 4)) + (unsigned int) wait_class;
+  hash = (hash * 2654435761U) >> 16;
+
+  for (i = 0; i < SYNC_PROFILE_MAX_PROBES; i++)
+    {
+      slot = &profile->slots[(hash + i) & (SYNC_PROFILE_NUM_SLOTS - 1)];
+      if (slot->name == NULL)
+	{
+	  slot->wait_class = wait_class;
+	  slot->holder_site = holder_site;
+	  slot->name = name;
+	  return slot;
+	}
+
+      if (slot->name == name && slot->holder_site == holder_site && slot->wait_class == wait_class)
+	{
+	  return slot;
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * sync_profile_record_wait () - record a wait of the thread on a synchronization primitive
+ *   return: void
+ *
+ *   thread_p(in):
+ *   wait_class(in):
+ *   name(in): name of the primitive, must outlive the server
+ *   holder_site(in): call site of the holder, NULL if unknown
+ *   wait_usec(in): time waited
+ */
+void
+sync_profile_record_wait (THREAD_ENTRY * thread_p, SYNC_WAIT_CLASS wait_class, const char *name, void *holder_site,
+			  UINT64 wait_usec)
+{
+  SYNC_WAIT_PROFILE *profile;
+  SYNC_PROFILE_SLOT *slot;
+  UINT64 v;
+  int bucket;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+      if (thread_p == NULL)
+	{
+	  return;
+	}
+    }
+
+  if (thread_p->tran_index >= 0)
+    {
+      mnt_sync_wait (thread_p, wait_class, wait_usec);
+    }
+
+  if (name == NULL)
+    {
+      name = "";
+    }
+
+  profile = thread_p->wait_profile;
+  if (profile == NULL)
+    {
+      profile = (SYNC_WAIT_PROFILE *) calloc (1, sizeof (SYNC_WAIT_PROFILE));
+      if (profile == NULL)
+	{
+	  /* the wait is only counted in the server statistics */
+	  return;
+	}
+      thread_p->wait_profile = profile;
+    }
+
+  slot = sync_profile_find_slot (profile, wait_class, name, holder_site);
+  if (slot == NULL && holder_site != NULL)
+    {
+      /* too many wait points; keep the wait without its holder site */
+      slot = sync_profile_find_slot (profile, wait_class, name, NULL);
+    }
+  if (slot == NULL)
+    {
+      return;
+    }
+
+  for (bucket = 0, v = wait_usec >> 1; v != 0 && bucket < SYNC_PROFILE_HISTOGRAM_SIZE - 1; v >>= 1)
+    {
+      bucket++;
+    }
+
+  slot->nwaits++;
+  slot->total_usec += wait_usec;
+  if (slot->max_usec < wait_usec)
+    {
+      slot->max_usec = wait_usec;
+    }
+  slot->histogram[bucket]++;
+}
+
+/*
+ * sync_profile_finalize () - free the wait profile of a thread
+ *   return: void
+ *
+ *   thread_p(in):
+ */
+void
+sync_profile_finalize (THREAD_ENTRY * thread_p)
+{
+  if (thread_p->wait_profile != NULL)
+    {
+      free_and_init (thread_p->wait_profile);
+    }
+}
+
+/*
+ * sync_profile_compare_rows () - order merged wait points by total wait time, longest first
+ *   return: compare result
+ *
+ *   a(in):
+ *   b(in):
+ */
+static int
+sync_profile_compare_rows (const void *a, const void *b)
+{
+  const SYNC_PROFILE_ROW *row_a = (const SYNC_PROFILE_ROW *) a;
+  const SYNC_PROFILE_ROW *row_b = (const SYNC_PROFILE_ROW *) b;
+
+  if (row_a->merged.total_usec > row_b->merged.total_usec)
+    {
+      return -1;
+    }
+  else if (row_a->merged.total_usec < row_b->merged.total_usec)
+    {
+      return 1;
+    }
+
+  return 0;
+}
+
+/*
+ * sync_profile_make_msecs () - make a numeric value of milliseconds
+ *   return: NO_ERROR, or ER_code
+ *
+ *   value(out):
+ *   usec(in):
+ */
+static int
+sync_profile_make_msecs (DB_VALUE * value, UINT64 usec)
+{
+  DB_VALUE db_val;
+  DB_DATA_STATUS data_status;
+
+  db_make_double (&db_val, (double) usec / 1000.0);
+  db_value_domain_init (value, DB_TYPE_NUMERIC, 20, 3);
+
+  return numeric_db_value_coerce_to_num (&db_val, value, &data_status);
+}
+
+/*
+ * sync_profile_dump_histogram () - print the non-empty buckets of a histogram as "<lower bound>:<waits>"
+ *   return: void
+ *
+ *   slot(in):
+ *   buf(out):
+ *   buf_size(in):
+ */
+static void
+sync_profile_dump_histogram (const SYNC_PROFILE_SLOT * slot, char *buf, int buf_size)
+{
+  UINT64 lower_usec;
+  int i, n = 0;
+
+  buf[0] = '\0';
+  for (i = 0; i < SYNC_PROFILE_HISTOGRAM_SIZE && n < buf_size; i++)
+    {
+      if (slot->histogram[i] == 0)
+	{
+	  continue;
+	}
+
+      lower_usec = (i == 0) ? 0 : ((UINT64) 1 << i);
+      if (lower_usec < 1000)
+	{
+	  n += snprintf (buf + n, buf_size - n, "%s%dus:%lld", (n > 0) ? " " : "", (int) lower_usec,
+			 (long long) slot->histogram[i]);
+	}
+      else if (lower_usec < 1000000)
+	{
+	  n += snprintf (buf + n, buf_size - n, "%s%dms:%lld", (n > 0) ? " " : "", (int) (lower_usec / 1000),
+			 (long long) slot->histogram[i]);
+	}
+      else
+	{
+	  n += snprintf (buf + n, buf_size - n, "%s%ds:%lld", (n > 0) ? " " : "", (int) (lower_usec / 1000000),
+			 (long long) slot->histogram[i]);
+	}
+    }
+}
+
+/*
+ * sync_profile_start_scan () - start scan function for 'show contention statistics'
+ *   return: NO_ERROR, or ER_code
+ *
+ *   thread_p(in):
+ *   show_type(in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out):
+ *
+ * Note: the waits of all threads are merged by wait point, and the wait points are listed by total wait time.
+ */
+int
+sync_profile_start_scan (THREAD_ENTRY * thread_p, int show_type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
+{
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  SYNC_PROFILE_ROW *rows = NULL, *row;
+  SYNC_PROFILE_SLOT *slot;
+  SYNC_WAIT_PROFILE *profile;
+  THREAD_ENTRY *thread_entry;
+  DB_VALUE *vals = NULL;
+  void **sites = NULL;
+  char **site_names = NULL;
+  char buf[512];
+  const char *p;
+  int num_rows = 0, max_rows = 0;
+  int i, j, k, idx, error = NO_ERROR;
+  int num_cols = 11;
+
+  *ptr = NULL;
+
+  for (i = 0; i < thread_num_total_threads (); i++)
+    {
+      thread_entry = thread_find_entry_by_index (i);
+      profile = (thread_entry != NULL) ? thread_entry->wait_profile : NULL;
+      if (profile == NULL)
+	{
+	  continue;
+	}
+
+      for (j = 0; j < SYNC_PROFILE_NUM_SLOTS; j++)
+	{
+	  slot = &profile->slots[j];
+	  if (slot->name == NULL || slot->nwaits == 0)
+	    {
+	      continue;
+	    }
+
+	  for (k = 0; k < num_rows; k++)
+	    {
+	      row = &rows[k];
+	      if (row->merged.wait_class == slot->wait_class && row->merged.holder_site == slot->holder_site
+		  && strcmp (row->merged.name, slot->name) == 0)
+		{
+		  break;
+		}
+	    }
+
+	  if (k == num_rows)
+	    {
+	      if (num_rows == max_rows)
+		{
+		  max_rows = (max_rows == 0) ? SYNC_PROFILE_NUM_SLOTS : max_rows * 2;
+		  row = (SYNC_PROFILE_ROW *) db_private_realloc (thread_p, rows, max_rows * sizeof (SYNC_PROFILE_ROW));
+		  if (row == NULL)
+		    {
+		      error = ER_OUT_OF_VIRTUAL_MEMORY;
+		      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, max_rows * sizeof (SYNC_PROFILE_ROW));
+		      goto exit_on_error;
+		    }
+		  rows = row;
+		}
+
+	      row = &rows[num_rows++];
+	      memset (row, 0, sizeof (SYNC_PROFILE_ROW));
+	      row->merged.name = slot->name;
+	      row->merged.holder_site = slot->holder_site;
+	      row->merged.wait_class = slot->wait_class;
+	      row->last_thread_index = -1;
+	    }
+
+	  row->merged.nwaits += slot->nwaits;
+	  row->merged.total_usec += slot->total_usec;
+	  if (row->merged.max_usec < slot->max_usec)
+	    {
+	      row->merged.max_usec = slot->max_usec;
+	    }
+	  for (k = 0; k < SYNC_PROFILE_HISTOGRAM_SIZE; k++)
+	    {
+	      row->merged.histogram[k] += slot->histogram[k];
+	    }
+
+	  /* a thread may have several slots of a wait point whose name is not a single string */
+	  if (row->last_thread_index != thread_entry->index)
+	    {
+	      row->last_thread_index = thread_entry->index;
+	      row->last_thread_usec = 0;
+	      row->num_waiters++;
+	    }
+	  row->last_thread_usec += slot->total_usec;
+	  if (row->top_waiter_usec < row->last_thread_usec)
+	    {
+	      row->top_waiter_usec = row->last_thread_usec;
+	      row->top_waiter_index = thread_entry->index;
+	    }
+	}
+    }
+
+  ctx = showstmt_alloc_array_context (thread_p, (num_rows > 0) ? num_rows : 1, num_cols);
+  if (ctx == NULL)
+    {
+      error = er_errid ();
+      goto exit_on_error;
+    }
+
+  if (num_rows == 0)
+    {
+      goto exit;
+    }
+
+  qsort (rows, num_rows, sizeof (SYNC_PROFILE_ROW), sync_profile_compare_rows);
+
+#if defined (LINUX)
+  sites = (void **) db_private_alloc (thread_p, num_rows * sizeof (void *));
+  if (sites != NULL)
+    {
+      for (i = 0; i < num_rows; i++)
+	{
+	  sites[i] = rows[i].merged.holder_site;
+	}
+      site_names = backtrace_symbols (sites, num_rows);
+    }
+#endif /* LINUX */
+
+  for (i = 0; i < num_rows; i++)
+    {
+      row = &rows[i];
+      idx = 0;
+      vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+      if (vals == NULL)
+	{
+	  error = er_errid ();
+	  goto exit_on_error;
+	}
+
+      /* Wait_class */
+      db_make_string (&vals[idx], sync_Wait_class_names[row->merged.wait_class]);
+      idx++;
+
+      /* Name */
+      error = db_make_string_copy (&vals[idx], row->merged.name);
+      idx++;
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      /* Holder_site */
+      if (row->merged.holder_site == NULL)
+	{
+	  db_make_null (&vals[idx]);
+	}
+      else
+	{
+	  if (site_names != NULL)
+	    {
+	      p = strrchr (site_names[i], '/');
+	      snprintf (buf, sizeof (buf), "%s", (p != NULL) ? p + 1 : site_names[i]);
+	    }
+	  else
+	    {
+	      snprintf (buf, sizeof (buf), "%p", row->merged.holder_site);
+	    }
+
+	  error = db_make_string_copy (&vals[idx], buf);
+	  if (error != NO_ERROR)
+	    {
+	      idx++;
+	      goto exit_on_error;
+	    }
+	}
+      idx++;
+
+      /* Num_waits */
+      db_make_bigint (&vals[idx], row->merged.nwaits);
+      idx++;
+
+      /* Num_waiting_threads */
+      db_make_int (&vals[idx], row->num_waiters);
+      idx++;
+
+      /* Total_wait_msecs */
+      error = sync_profile_make_msecs (&vals[idx], row->merged.total_usec);
+      idx++;
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      /* Avg_wait_msecs */
+      error = sync_profile_make_msecs (&vals[idx], row->merged.total_usec / row->merged.nwaits);
+      idx++;
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      /* Max_wait_msecs */
+      error = sync_profile_make_msecs (&vals[idx], row->merged.max_usec);
+      idx++;
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      /* Wait_histogram */
+      sync_profile_dump_histogram (&row->merged, buf, sizeof (buf));
+      error = db_make_string_copy (&vals[idx], buf);
+      idx++;
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      /* Top_waiter_thread_index */
+      db_make_int (&vals[idx], row->top_waiter_index);
+      idx++;
+
+      /* Top_waiter_wait_msecs */
+      error = sync_profile_make_msecs (&vals[idx], row->top_waiter_usec);
+      idx++;
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      assert (idx == num_cols);
+    }
+
+exit:
+  if (site_names != NULL)
+    {
+      free (site_names);
+    }
+  if (sites != NULL)
+    {
+      db_private_free_and_init (thread_p, sites);
+    }
+  if (rows != NULL)
+    {
+      db_private_free_and_init (thread_p, rows);
+    }
+
+  *ptr = ctx;
+  return NO_ERROR;
+
+exit_on_error:
+  if (site_names != NULL)
+    {
+      free (site_names);
+    }
+  if (sites != NULL)
+    {
+      db_private_free_and_init (thread_p, sites);
+    }
+  if (rows != NULL)
+    {
+      db_private_free_and_init (thread_p, rows);
+    }
+  if (ctx != NULL)
+    {
+      showstmt_free_array_context (thread_p, ctx);
+    }
+
+  return error;
+}
@@ -107,6 +107,25 @@ typedef struct sync_stats
   struct timeval max_elapsed;	/* max elapsed time to acquire the synchronization primitive */
 } SYNC_STATS;
 
+/* classes of blocking waits recorded by the contention profiler */
+typedef enum
+{
+  SYNC_WAIT_CSECT = 0,		/* critical section */
+  SYNC_WAIT_RWLOCK,		/* rwlock */
+  SYNC_WAIT_RMUTEX,		/* re-entrant mutex */
+  SYNC_WAIT_PGBUF_LATCH,	/* page buffer latch */
+  SYNC_WAIT_LOCK,		/* object lock */
+
+  SYNC_WAIT_CLASS_COUNT
+} SYNC_WAIT_CLASS;
+
+/* the code address a function returns to; kept as the call site of the holder of a primitive */
+#if defined(__GNUC__)
+#define SYNC_CALLER_SITE() __builtin_return_address (0)
+#else
+#define SYNC_CALLER_SITE() NULL
+#endif
+
 typedef struct sync_critical_section
 {
   const char *name;
@@ -120,6 +139,7 @@ typedef struct sync_critical_section
   THREAD_ENTRY *waiting_promoters_queue;	/* queue of waiting promoters */
   pthread_t owner;		/* CS owner writer */
   int tran_index;		/* transaction id acquiring CS */
+  void *owner_site;		/* call site of the owner writer, or of the last reader */
   SYNC_STATS *stats;
 } SYNC_CRITICAL_SECTION;
 
@@ -129,6 +149,7 @@ typedef struct sync_rwlock
   pthread_mutex_t read_lock;	/* read lock. Only readers will use it. */
   pthread_mutex_t global_lock;	/* global lock */
   int num_readers;		/* # of readers. Only readers will use it. */
+  void *owner_site;		/* call site of the writer, or of the first reader */
   SYNC_STATS *stats;
 } SYNC_RWLOCK;
 
@@ -138,6 +159,7 @@ typedef struct sync_rmutex
   pthread_mutex_t lock;		/* mutex */
   pthread_t owner;		/* owner thread id */
   int lock_cnt;			/* # of times that owner enters */
+  void *owner_site;		/* call site of the owner */
   SYNC_STATS *stats;
 } SYNC_RMUTEX;
 
@@ -187,6 +209,12 @@ extern void rmutex_dump_statistics (FILE * fp);
 
 extern void sync_dump_statistics (FILE * fp, SYNC_PRIMITIVE_TYPE type);
 
+extern void sync_profile_record_wait (THREAD_ENTRY * thread_p, SYNC_WAIT_CLASS wait_class, const char *name,
+				      void *holder_site, UINT64 wait_usec);
+extern void sync_profile_finalize (THREAD_ENTRY * thread_p);
+extern int sync_profile_start_scan (THREAD_ENTRY * thread_p, int show_type, DB_VALUE ** arg_values, int arg_cnt,
+				    void **ctx);
+
 #if !defined(SERVER_MODE)
 #define csect_initialize_critical_section(a, b)
 #define csect_finalize_critical_section(a)
@@ -198,6 +226,9 @@ extern void sync_dump_statistics (FILE * fp, SYNC_PRIMITIVE_TYPE type);
 #define csect_exit_critical_section(a, b)
 #define csect_check_own(a, b) 1
 #define csect_start_scan NULL
+#define sync_profile_record_wait(a, b, c, d, e)
+#define sync_profile_finalize(a)
+#define sync_profile_start_scan NULL
 
 #define rwlock_initialize(a, b) NO_ERROR
 #define rwlock_finalize(a) NO_ERROR
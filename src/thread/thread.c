@@ -590,6 +590,7 @@ thread_start_workers (void)
 {
   int i;
   int thread_index, r;
+  int num_numa_nodes;
   THREAD_ENTRY *thread_p = NULL;
   pthread_attr_t thread_attr;
 #if defined(_POSIX_THREAD_ATTR_STACKSIZE)
@@ -598,6 +599,8 @@ thread_start_workers (void)
 
   assert (thread_Manager.initialized == true);
 
+  num_numa_nodes = prm_get_bool_value (PRM_ID_PB_NUMA_AWARE) ? os_numa_get_node_count () : 1;
+
 #if !defined(WINDOWS)
   r = pthread_attr_init (&thread_attr);
   if (r != 0)
@@ -648,6 +651,12 @@ thread_start_workers (void)
     {
       thread_p = &thread_Manager.thread_array[thread_index];
 
+      if (num_numa_nodes > 1)
+	{
+	  /* spread workers over NUMA nodes; the worker binds itself when it starts */
+	  thread_p->numa_node = (thread_index - 1) % num_numa_nodes;
+	}
+
       r = pthread_mutex_lock (&thread_p->th_entry_lock);
       if (r != 0)
 	{
@@ -1119,6 +1128,7 @@ thread_initialize_entry (THREAD_ENTRY * entry_p)
   entry_p->resume_status = THREAD_RESUME_NONE;
   entry_p->er_Msg = NULL;
   entry_p->victim_request_fail = false;
+  entry_p->numa_node = -1;
   entry_p->next_wait_thrd = NULL;
   entry_p->wait_for_latch_promote = false;
 
@@ -1138,6 +1148,7 @@ thread_initialize_entry (THREAD_ENTRY * entry_p)
       return ER_CSS_ALLOC;
     }
 
+  entry_p->query_arena = NULL;
   entry_p->log_zip_undo = NULL;
   entry_p->log_zip_redo = NULL;
   entry_p->log_data_length = 0;
@@ -1149,6 +1160,7 @@ thread_initialize_entry (THREAD_ENTRY * entry_p)
   entry_p->sort_stats_active = false;
 
   memset (&(entry_p->event_stats), 0, sizeof (EVENT_STAT));
+  entry_p->wait_profile = NULL;
 
   entry_p->on_trace = false;
   entry_p->clear_trace = false;
@@ -1249,6 +1261,8 @@ thread_finalize_entry (THREAD_ENTRY * entry_p)
 
   (void) thread_rc_track_finalize (entry_p);
 
+  sync_profile_finalize (entry_p);
+
   db_destroy_private_heap (entry_p, entry_p->private_heap_id);
 
 #if !defined(NDEBUG)
@@ -2414,6 +2428,12 @@ thread_worker (void *arg_p)
   tsd_ptr->type = TT_WORKER;	/* not defined yet */
   tsd_ptr->status = TS_FREE;	/* set thread stat as free */
 
+  if (tsd_ptr->numa_node >= 0 && os_numa_bind_current_thread (tsd_ptr->numa_node) != 0)
+    {
+      /* run anywhere; page buffer uses the node of the current cpu */
+      tsd_ptr->numa_node = -1;
+    }
+
   /* during server is active */
   while (!tsd_ptr->shutdown)
     {
@@ -3526,6 +3546,8 @@ thread_log_flush_thread (void *arg_p)
 
   int working_time, remained_time, total_elapsed_time, param_refresh_remained;
   int gc_interval, wakeup_interval;
+  int num_committers;
+  bool is_gc_adaptive;
   int param_refresh_interval = 3000;
   int max_wait_time = 1000;
 
@@ -3556,6 +3578,7 @@ thread_log_flush_thread (void *arg_p)
       er_clear ();
 
       gc_interval = prm_get_integer_value (PRM_ID_LOG_GROUP_COMMIT_INTERVAL_MSECS);
+      is_gc_adaptive = prm_get_bool_value (PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE);
 
       wakeup_interval = max_wait_time;
       if (gc_interval > 0)
@@ -3574,7 +3597,8 @@ thread_log_flush_thread (void *arg_p)
       rv = pthread_mutex_lock (&thread_Log_flush_thread.lock);
 
       ret = 0;
-      if (thread_Log_flush_thread.nrequestors == 0 || gc_interval > 0)
+      /* an adaptive group commit is flushed as soon as the group is complete */
+      if (thread_Log_flush_thread.nrequestors == 0 || (gc_interval > 0 && !is_gc_adaptive))
 	{
 	  thread_Log_flush_thread.is_running = false;
 	  ret = pthread_cond_timedwait (&thread_Log_flush_thread.cond, &thread_Log_flush_thread.lock, &LFT_wakeup_time);
@@ -3608,6 +3632,12 @@ thread_log_flush_thread (void *arg_p)
 	  param_refresh_remained = param_refresh_interval;
 	}
 
+      /* the committers waiting now have their commit records appended; this flush serves them */
+      rv = pthread_mutex_lock (&group_commit_info->gc_mutex);
+      num_committers = group_commit_info->num_waiters;
+      group_commit_info->num_waiters = 0;
+      pthread_mutex_unlock (&group_commit_info->gc_mutex);
+
       LOG_CS_ENTER (tsd_ptr);
       logpb_flush_pages_direct (tsd_ptr);
       LOG_CS_EXIT (tsd_ptr);
@@ -3616,10 +3646,20 @@ thread_log_flush_thread (void *arg_p)
       total_elapsed_time = 0;
 
       rv = pthread_mutex_lock (&group_commit_info->gc_mutex);
+      if (num_committers > 0)
+	{
+	  group_commit_info->avg_waiters +=
+	    (num_committers * LOG_GROUP_COMMIT_AVG_WAITERS_SCALE - group_commit_info->avg_waiters) / 8;
+	}
       pthread_cond_broadcast (&group_commit_info->gc_cond);
       thread_reset_nrequestors_of_log_flush_thread ();
       pthread_mutex_unlock (&group_commit_info->gc_mutex);
 
+      if (num_committers > 0)
+	{
+	  mnt_log_group_commit_flush (tsd_ptr, num_committers);
+	}
+
 #if defined(CUBRID_DEBUG)
       er_log_debug (ARG_FILE_LINE, "css_log_flush_thread: [%d]send signal - waiters\n", (int) THREAD_ID ());
 #endif /* CUBRID_DEBUG */
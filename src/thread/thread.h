@@ -246,6 +246,8 @@ struct thread_resource_track
 /* Forward definition to fix compile error. */
 struct vacuum_worker;
 struct fi_test_item;
+struct sync_wait_profile;
+struct db_arena;
 
 
 typedef struct thread_entry THREAD_ENTRY;
@@ -290,6 +292,7 @@ struct thread_entry
   pthread_cond_t wakeup_cond;	/* wakeup condition */
 
   HL_HEAPID private_heap_id;	/* id of thread private memory allocator */
+  struct db_arena *query_arena;	/* arena of the query being executed, see memory_alloc.c */
   ADJ_ARRAY *cnv_adj_buffer[3];	/* conversion buffer */
 
   struct css_conn_entry *conn_entry;	/* conn entry ptr */
@@ -311,6 +314,7 @@ struct thread_entry
   int resume_status;		/* resume status */
   int request_latch_mode;	/* for page latch support */
   int request_fix_count;
+  int numa_node;		/* NUMA node the thread is bound to, -1 if not bound */
   bool victim_request_fail;
   bool interrupted;		/* is this request/transaction interrupted ? */
   bool shutdown;		/* is server going down? */
@@ -347,6 +351,8 @@ struct thread_entry
 
   EVENT_STAT event_stats;
 
+  struct sync_wait_profile *wait_profile;	/* blocking waits of this thread, see critical_section.c */
+
   /* for query profile */
   int trace_format;
   bool on_trace;
@@ -3832,6 +3832,13 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
       goto error;
     }
 
+  /* initialize b-tree adaptive hash index */
+  error_code = btree_ahi_initialize ();
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+
   cfg_free_directory (dir);
 
   if (print_restart)
@@ -3883,6 +3890,7 @@ error:
 
   session_states_finalize (thread_p);
   logtb_finalize_global_unique_stats_table (thread_p);
+  btree_ahi_finalize ();
 
   log_final (thread_p);
   qexec_finalize_filter_pred_cache (thread_p);
@@ -4779,6 +4787,7 @@ boot_server_all_finalize (THREAD_ENTRY * thread_p, ER_FINAL_CODE is_er_final,
   catcls_finalize_class_oid_to_oid_hash_table (thread_p);
   serial_finalize_cache_pool ();
   partition_cache_finalize (thread_p);
+  btree_ahi_finalize ();
 #if defined(SERVER_MODE)
   /* server mode shuts down all modules */
   shutdown_common_modules = BOOT_SHUTDOWN_ALL_MODULES;
@@ -69,6 +69,7 @@
 #include "probes.h"
 #endif /* ENABLE_SYSTEMTAP */
 #include "db.h"
+#include "session.h"
 
 #if defined(DMALLOC)
 #include "dmalloc.h"
@@ -184,6 +185,7 @@ static int locator_delete_force_internal (THREAD_ENTRY * thread_p, HFID * hfid,
 					  MVCC_REEV_DATA * mvcc_reev_data, LOCATOR_INDEX_ACTION_FLAG idx_action_flag,
 					  OID * new_obj_oid, OID * partition_oid, bool need_locking);
 static int locator_force_for_multi_update (THREAD_ENTRY * thread_p, LC_COPYAREA * force_area);
+static void locator_check_authorization_change (THREAD_ENTRY * thread_p, const OID * class_oid);
 
 #if defined(ENABLE_UNUSED_FUNCTION)
 static void locator_increase_catalog_count (THREAD_ENTRY * thread_p, OID * cls_oid);
@@ -5093,6 +5095,37 @@ error3:
   goto end;
 }
 
+/*
+ * locator_check_authorization_change () - drop the shared prepared statements
+ *					    if users or privileges are changed
+ *   return: nothing
+ *   class_oid(in): class of the instance being changed
+ *
+ * Note: Shared statements are authorized once, by the session which compiled
+ *       them. They are dropped here and again when the transaction ends,
+ *       because a statement compiled in between saw the old privileges.
+ */
+static void
+locator_check_authorization_change (THREAD_ENTRY * thread_p, const OID * class_oid)
+{
+  LOG_TDES *tdes;
+
+  if (!oid_check_cached_class_oid (OID_CACHE_USER_CLASS_ID, class_oid)
+      && !oid_check_cached_class_oid (OID_CACHE_AUTH_CLASS_ID, class_oid)
+      && !oid_check_cached_class_oid (OID_CACHE_CLASSAUTH_CLASS_ID, class_oid))
+    {
+      return;
+    }
+
+  tdes = LOG_FIND_CURRENT_TDES (thread_p);
+  if (tdes != NULL)
+    {
+      tdes->has_authorization_changes = true;
+    }
+
+  session_invalidate_shared_statements (thread_p);
+}
+
 /*
  * locator_insert_force () - Insert the given object on this heap
  *
@@ -5149,6 +5182,8 @@ locator_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
   local_scan_cache = scan_cache;
   local_func_preds = func_preds;
 
+  locator_check_authorization_change (thread_p, class_oid);
+
   if (pruning_type != DB_NOT_PARTITIONED_CLASS)
     {
       OID superclass_oid;
@@ -5412,15 +5447,9 @@ locator_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
       locator_increase_catalog_count (thread_p, &real_class_oid);
 #endif
 
-      /* remove query result cache entries which are relevant with this class */
+      /* query result cache entries which are relevant with this class are removed when the transaction commits */
       if (!QFILE_IS_LIST_CACHE_DISABLED)
 	{
-	  if (qexec_clear_list_cache_by_class (thread_p, &real_class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "locator_insert_force: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    real_class_oid.pageid, real_class_oid.slotid, real_class_oid.volid);
-	    }
 	  qmgr_add_modified_class (thread_p, &real_class_oid);
 	}
 #if 0				/* TODO - dead code; do not delete me */
@@ -5812,6 +5841,12 @@ locator_update_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
 			" failed for class { %d %d %d }\n", oid->pageid, oid->slotid, oid->volid);
 	}
 
+      /* prepared statements shared between sessions are compiled against the old class */
+      if (!OID_IS_ROOTOID (oid))
+	{
+	  session_invalidate_shared_statements (thread_p);
+	}
+
       if (!OID_IS_ROOTOID (oid) && prm_get_integer_value (PRM_ID_FILTER_PRED_MAX_CACHE_ENTRIES) > 0
 	  && qexec_remove_filter_pred_cache_ent_by_class (thread_p, oid) != NO_ERROR)
 	{
@@ -5824,6 +5859,8 @@ locator_update_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
     {
       HEAP_OPERATION_CONTEXT update_context;
 
+      locator_check_authorization_change (thread_p, class_oid);
+
       local_scan_cache = scan_cache;
       if (pruning_type != DB_NOT_PARTITIONED_CLASS && pcontext != NULL)
 	{
@@ -6196,15 +6233,9 @@ locator_update_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
 	}
 #endif
 
-      /* remove query result cache entries which are relevant with this class */
+      /* query result cache entries which are relevant with this class are removed when the transaction commits */
       if (!QFILE_IS_LIST_CACHE_DISABLED)
 	{
-	  if (qexec_clear_list_cache_by_class (thread_p, class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "locator_update_force: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    class_oid->pageid, class_oid->slotid, class_oid->volid);
-	    }
 	  qmgr_add_modified_class (thread_p, class_oid);
 	}
     }
@@ -6398,6 +6429,10 @@ locator_delete_force_internal (THREAD_ENTRY * thread_p, HFID * hfid, OID * oid,
     {
       OID_SET_NULL (&class_oid);
     }
+  else if (!OID_IS_ROOTOID (&class_oid))
+    {
+      locator_check_authorization_change (thread_p, &class_oid);
+    }
 
   if (isold_object == true && OID_IS_ROOTOID (&class_oid))
     {
@@ -6446,6 +6481,12 @@ locator_delete_force_internal (THREAD_ENTRY * thread_p, HFID * hfid, OID * oid,
 			" failed for class { %d %d %d }\n", oid->pageid, oid->slotid, oid->volid);
 	}
 
+      /* prepared statements shared between sessions are compiled against the old class */
+      if (!OID_IS_ROOTOID (oid))
+	{
+	  session_invalidate_shared_statements (thread_p);
+	}
+
       if (!OID_IS_ROOTOID (oid) && prm_get_integer_value (PRM_ID_FILTER_PRED_MAX_CACHE_ENTRIES) > 0
 	  && qexec_remove_filter_pred_cache_ent_by_class (thread_p, oid) != NO_ERROR)
 	{
@@ -6518,15 +6559,9 @@ locator_delete_force_internal (THREAD_ENTRY * thread_p, HFID * hfid, OID * oid,
 	    }
 	}
 
-      /* remove query result cache entries which are relevant with this class */
+      /* query result cache entries which are relevant with this class are removed when the transaction commits */
       if (!QFILE_IS_LIST_CACHE_DISABLED)
 	{
-	  if (qexec_clear_list_cache_by_class (thread_p, &class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "locator_delete_force: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    class_oid.pageid, class_oid.slotid, class_oid.volid);
-	    }
 	  qmgr_add_modified_class (thread_p, &class_oid);
 	}
     }
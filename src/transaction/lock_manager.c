@@ -512,6 +512,7 @@ static void lock_dump_deadlock_victims (THREAD_ENTRY * thread_p, FILE * outfile)
 static int lock_compare_lock_info (const void *lockinfo1, const void *lockinfo2);
 static float lock_wait_msecs_to_secs (int msecs);
 static void lock_dump_resource (THREAD_ENTRY * thread_p, FILE * outfp, LK_RES * res_ptr);
+static const char *lock_resource_type_to_string (LOCK_RESOURCE_TYPE type);
 #if defined (ENABLE_UNUSED_FUNCTION)
 static bool lock_check_consistent_resource (THREAD_ENTRY * thread_p, LK_RES * res_ptr);
 static bool lock_check_consistent_tran_lock (LK_TRAN_LOCK * tran_lock);
@@ -880,6 +881,7 @@ lock_initialize_entry (LK_ENTRY * entry_ptr)
   entry_ptr->instant_lock_count = 0;
   entry_ptr->bind_index_in_tran = -1;
   XASL_ID_SET_NULL (&entry_ptr->xasl_id);
+  entry_ptr->site = NULL;
 }
 
 /* initialize lock entry as granted state */
@@ -3243,6 +3245,10 @@ lock_internal_perform_lock_object (THREAD_ENTRY * thread_p, int tran_index, cons
   bool is_instant_duration;
   int compat1, compat2;
   bool is_res_mutex_locked = false;
+  void *site = SYNC_CALLER_SITE ();
+  void *holder_site = NULL;
+  TSC_TICKS wait_start_tick, wait_end_tick;
+  TSCTIMEVAL wait_tv_diff;
 #if defined(PERF_ENABLE_LOCK_OBJECT_STAT)
   bool is_perf_tracking;
   TSC_TICKS start_tick, end_tick;
@@ -3390,6 +3396,7 @@ start:
 
       /* initialize the lock entry as granted state */
       lock_initialize_entry_as_granted (entry_ptr, tran_index, res_ptr, lock);
+      entry_ptr->site = site;
       if (is_instant_duration)
 	{
 	  entry_ptr->instant_lock_count++;
@@ -3478,6 +3485,7 @@ start:
 
 	  /* initialize the lock entry as granted state */
 	  lock_initialize_entry_as_granted (entry_ptr, tran_index, res_ptr, lock);
+	  entry_ptr->site = site;
 	  if (is_instant_duration)
 	    {
 	      entry_ptr->instant_lock_count++;
@@ -3643,6 +3651,7 @@ start:
 	}
       /* initialize the lock entry as blocked state */
       lock_initialize_entry_as_blocked (entry_ptr, thread_p, tran_index, res_ptr, lock);
+      entry_ptr->site = site;
       if (is_instant_duration)
 	{
 	  entry_ptr->instant_lock_count++;
@@ -3920,9 +3929,23 @@ blocked:
   (void) thread_lock_entry (entry_ptr->thrd_entry);
   if (is_res_mutex_locked)
     {
+      /* for the contention profile: the site of a holder of another transaction */
+      for (i = res_ptr->holder; i != NULL; i = i->next)
+	{
+	  if (i->tran_index != tran_index)
+	    {
+	      holder_site = i->site;
+	      break;
+	    }
+	}
       pthread_mutex_unlock (&res_ptr->res_mutex);
     }
+  tsc_getticks (&wait_start_tick);
   ret_val = lock_suspend (thread_p, entry_ptr, wait_msecs);
+  tsc_getticks (&wait_end_tick);
+  tsc_elapsed_time_usec (&wait_tv_diff, wait_end_tick, wait_start_tick);
+  sync_profile_record_wait (thread_p, SYNC_WAIT_LOCK, lock_resource_type_to_string (res_ptr->key.type), holder_site,
+			    (UINT64) wait_tv_diff.tv_sec * 1000000LL + wait_tv_diff.tv_usec);
 #if defined(PERF_ENABLE_LOCK_OBJECT_STAT)
   if (is_perf_tracking)
     {
@@ -5523,6 +5546,31 @@ lock_wait_msecs_to_secs (int msecs)
 #endif /* SERVER_MODE */
 
 #if defined(SERVER_MODE)
+/*
+ * lock_resource_type_to_string - Get the name of a lock resource type
+ *
+ * return: name of the resource type
+ *
+ *   type(in): resource type
+ */
+static const char *
+lock_resource_type_to_string (LOCK_RESOURCE_TYPE type)
+{
+  switch (type)
+    {
+    case LOCK_RESOURCE_INSTANCE:
+      return "INSTANCE";
+    case LOCK_RESOURCE_CLASS:
+      return "CLASS";
+    case LOCK_RESOURCE_ROOT_CLASS:
+      return "ROOT_CLASS";
+    case LOCK_RESOURCE_OBJECT:
+      return "OBJECT";
+    default:
+      return "UNKNOWN";
+    }
+}
+
 /*
  * lock_dump_resource - Dump locks acquired on a resource
  *
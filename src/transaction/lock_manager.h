@@ -108,6 +108,7 @@ struct lk_entry
   int instant_lock_count;	/* number of instant lock requests */
   int bind_index_in_tran;
   XASL_ID xasl_id;
+  void *site;			/* call site of the lock request, reported to the waiters */
 #else				/* not SERVER_MODE */
   int dummy;
 #endif				/* not SERVER_MODE */
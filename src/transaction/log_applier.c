@@ -31,6 +31,8 @@
 #include <fcntl.h>
 #if !defined (WINDOWS)
 #include <sys/time.h>
+#include <sys/wait.h>
+#include <poll.h>
 #endif
 
 #include "porting.h"
@@ -93,6 +95,16 @@
 
 #define LA_NUM_REPL_FILTER			50
 
+/* parallel apply */
+#define LA_PAR_MAX_WORKERS                      16
+#define LA_PAR_KEY_BUCKETS                      4096
+#define LA_PAR_MAX_PENDING_TRANS                256
+#define LA_PAR_MAX_GROUP_COMMIT                 64
+#define LA_PAR_STATS_INTERVAL_IN_SECS           60
+
+#define LA_PAR_MSG_ITEM                         1
+#define LA_PAR_MSG_COMMIT                       2
+
 #define LA_LOG_IS_IN_ARCHIVE(pageid) \
   ((pageid) < la_Info.act_log.log_hdr->nxarv_pageid)
 
@@ -398,6 +410,94 @@ enum lp_op
 };
 #define LP_HA_APPLIED_INFO_REFRESH_TIME         (50)	/* msec */
 
+/* a transaction dispatched to an apply worker */
+typedef struct la_par_trans LA_PAR_TRANS;
+struct la_par_trans
+{
+  int worker;			/* index of the worker applying it */
+  bool is_done;			/* committed by the worker */
+  LOG_LSA start_lsa;		/* LSA of the first log record of the transaction */
+  LOG_LSA commit_lsa;		/* LSA of LOG_COMMIT */
+  LOG_LSA last_rep_lsa;		/* LSA of the last replication log sent */
+  time_t log_record_time;	/* commit time at the server site */
+  int num_rows;
+  int num_buckets;
+  int max_buckets;
+  int *buckets;			/* key buckets written by the transaction */
+};
+
+typedef struct la_par_worker LA_PAR_WORKER;
+struct la_par_worker
+{
+  pid_t pid;
+  int request_fd;		/* applier -> worker */
+  int reply_fd;			/* worker -> applier */
+  int num_pending;		/* # of transactions sent and not yet committed */
+  int *key_refs;		/* # of pending rows in each key bucket */
+
+  /* statistics */
+  INT64 trans_counter;
+  INT64 row_counter;
+  INT64 wait_counter;		/* # of waits for an overlapping write set */
+  INT64 last_row_counter;	/* row_counter at the last report */
+  int delay;			/* delay of the last committed transaction in secs */
+  int max_delay;		/* max delay since the last report */
+};
+
+typedef struct la_par_info LA_PAR_INFO;
+struct la_par_info
+{
+  int num_workers;
+  LA_PAR_WORKER *workers;
+
+  /* dispatched transactions in commit order, from head_seq to tail_seq */
+  LA_PAR_TRANS *trans;
+  int max_trans;
+  unsigned int head_seq;
+  unsigned int tail_seq;
+
+  /* the last transaction committed together with all the previous ones */
+  LOG_LSA applied_lsa;
+  LOG_LSA applied_rep_lsa;
+  time_t applied_log_record_time;
+
+  /* commit LSAs of the transactions that the workers committed after the recorded position before a restart */
+  LOG_LSA *applied_marks;
+  int num_applied_marks;
+  int next_applied_mark;
+
+  char *buffer;			/* messages of a transaction */
+  int buffer_size;
+  time_t last_report_time;
+};
+
+/* a message to an apply worker, followed by body_length bytes of the key, the class name and the record */
+typedef struct la_par_request LA_PAR_REQUEST;
+struct la_par_request
+{
+  int type;			/* LA_PAR_MSG_ITEM or LA_PAR_MSG_COMMIT */
+  unsigned int seq;		/* sequence number of the transaction */
+  int item_type;
+  int key_length;
+  int class_name_length;
+  int rec_type;
+  int rec_length;
+  int body_length;		/* also keeps the size of the message header a multiple of MAX_ALIGNMENT */
+  LOG_LSA commit_lsa;		/* LSA of LOG_COMMIT, of LA_PAR_MSG_COMMIT */
+};
+
+/* a reply of an apply worker for each committed transaction */
+typedef struct la_par_reply LA_PAR_REPLY;
+struct la_par_reply
+{
+  unsigned int seq;
+  int error;
+  int insert_counter;		/* counters since the previous reply */
+  int update_counter;
+  int delete_counter;
+  int fail_counter;
+};
+
 typedef struct lp_info LP_INFO;
 struct lp_info
 {
@@ -418,6 +518,8 @@ LP_INFO lp_Info;
 
 LA_RECDES_POOL la_recdes_pool;
 
+static LA_PAR_INFO la_Par;
+
 static bool la_applier_need_shutdown = false;
 static bool la_applier_shutdown_by_signal = false;
 static char la_slave_db_name[DB_MAX_IDENTIFIER_LENGTH + 1];
@@ -570,6 +672,37 @@ static void la_print_repl_filter_info (void);
 
 static int check_reinit_copylog (void);
 
+static int la_par_read (int fd, void *buf, int size);
+static int la_par_write (int fd, const void *buf, int size);
+static int la_par_connect (const char *database_name, const char *er_file);
+static int la_par_start_workers (const char *database_name);
+static void la_par_stop_workers (void);
+static void la_par_worker_main (const char *database_name, const char *er_file, int request_fd, int reply_fd);
+static int la_par_worker_apply_item (LA_PAR_REQUEST * request, char *body);
+static int la_par_worker_commit (int reply_fd, unsigned int *seqs, LOG_LSA * commit_lsas, int num_seqs);
+static int la_par_make_mark_pattern (char *pattern, int size);
+static int la_par_mark_applied (LOG_LSA * commit_lsas, int num_lsas);
+static int la_par_load_applied_marks (void);
+static int la_par_delete_applied_marks (const LOG_LSA * lsa);
+static bool la_par_was_applied (const LOG_LSA * commit_lsa);
+static int la_par_get_class_constraints (const char *class_name, bool * has_unique, bool * has_foreign_key);
+static bool la_par_can_dispatch (LA_APPLY * apply);
+static bool la_par_need_apply (LA_ITEM * item);
+static char *la_par_reserve_buffer (int size);
+static int la_par_key_bucket (LA_ITEM * item);
+static int la_par_process_reply (int worker, LA_PAR_REPLY * reply);
+static int la_par_wait_reply (int worker);
+static void la_par_retire_committed (void);
+static int la_par_collect_replies (void);
+static int la_par_wait_workers (void);
+static int la_par_choose_worker (LA_PAR_TRANS * trans, int *worker);
+static int la_par_pack_item (LA_ITEM * item, LA_PAR_TRANS * trans, int *offset);
+static int la_par_new_trans (LA_PAR_TRANS ** trans);
+static int la_par_skip_applied (LA_APPLY * apply, LA_COMMIT * commit);
+static int la_par_dispatch (LA_APPLY * apply, LA_COMMIT * commit);
+static int la_par_apply_commit (LA_COMMIT * commit, LOG_PAGEID final_pageid);
+static void la_par_report_stats (bool force);
+
 /*
  * la_shutdown_by_signal() - When the process catches the SIGTERM signal,
  *                                it does the shutdown process.
@@ -2208,6 +2341,7 @@ la_delete_ha_apply_info (void)
 
   res = la_update_query_execute_with_values (query_buf, in_value_idx, &in_value[0], true);
   la_Info.is_apply_info_updated = true;
+  (void) la_par_delete_applied_marks (NULL);
 
   for (i = 0; i < in_value_idx; i++)
     {
@@ -5764,6 +5898,7 @@ static int
 la_apply_commit_list (LOG_LSA * lsa, LOG_PAGEID final_pageid)
 {
   LA_COMMIT *commit;
+  LA_APPLY *apply;
   int error = NO_ERROR;
 
   LSA_SET_NULL (lsa);
@@ -5771,7 +5906,24 @@ la_apply_commit_list (LOG_LSA * lsa, LOG_PAGEID final_pageid)
   commit = la_Info.commit_head;
   if (commit && (commit->type == LOG_COMMIT || commit->type == LOG_COMMIT_TOPOPE || commit->type == LOG_ABORT))
     {
-      error = la_apply_repl_log (commit->tranid, commit->type, &commit->log_lsa, &la_Info.total_rows, final_pageid);
+      if (la_Par.num_workers > 0)
+	{
+	  error = la_par_apply_commit (commit, final_pageid);
+	}
+      else if (commit->type == LOG_COMMIT && la_par_was_applied (&commit->log_lsa))
+	{
+	  /* committed by an apply worker before the restart */
+	  apply = la_find_apply_list (commit->tranid);
+	  if (apply != NULL)
+	    {
+	      la_clear_applied_info (apply);
+	    }
+	}
+      else
+	{
+	  error =
+	    la_apply_repl_log (commit->tranid, commit->type, &commit->log_lsa, &la_Info.total_rows, final_pageid);
+	}
       if (error != NO_ERROR)
 	{
 	  er_log_debug (ARG_FILE_LINE, "apply_commit_list : error %d while apply_repl_log\n", error);
@@ -5864,208 +6016,1992 @@ la_free_repl_items_by_tranid (int tranid)
   return;
 }
 
-static LA_ITEM *
-la_get_next_repl_item (LA_ITEM * item, bool is_long_trans, LOG_LSA * last_lsa)
+/*
+ * la_par_read() - read a message of an apply worker or of the applier
+ *   return: NO_ERROR, or ER_FAILED on an error or the end of the pipe
+ *   fd(in): pipe
+ *   buf(out):
+ *   size(in):
+ */
+static int
+la_par_read (int fd, void *buf, int size)
 {
-  if (is_long_trans)
-    {
-      return la_get_next_repl_item_from_log (item, last_lsa);
-    }
-  else
+  char *ptr = (char *) buf;
+  ssize_t nbytes;
+
+  while (size > 0)
     {
-      return la_get_next_repl_item_from_list (item);
+      nbytes = read (fd, ptr, size);
+      if (nbytes < 0 && errno == EINTR)
+	{
+	  continue;
+	}
+      if (nbytes <= 0)
+	{
+	  return ER_FAILED;
+	}
+
+      ptr += nbytes;
+      size -= nbytes;
     }
-}
 
-static LA_ITEM *
-la_get_next_repl_item_from_list (LA_ITEM * item)
-{
-  return (item->next);
+  return NO_ERROR;
 }
 
-static LA_ITEM *
-la_get_next_repl_item_from_log (LA_ITEM * item, LOG_LSA * last_lsa)
+/*
+ * la_par_write() - write a message to an apply worker or to the applier
+ *   return: NO_ERROR or ER_FAILED
+ *   fd(in): pipe
+ *   buf(in):
+ *   size(in):
+ */
+static int
+la_par_write (int fd, const void *buf, int size)
 {
-  LOG_LSA prev_repl_lsa;
-  LOG_LSA curr_lsa;
-  LOG_PAGE *curr_log_page;
-  LOG_RECORD_HEADER *prev_repl_log_record = NULL;
-  LOG_RECORD_HEADER *curr_log_record;
-  LA_ITEM *next_item = NULL;
-
-  LSA_COPY (&prev_repl_lsa, &item->lsa);
-  LSA_COPY (&curr_lsa, &item->lsa);
+  const char *ptr = (const char *) buf;
+  ssize_t nbytes;
 
-  while (!LSA_ISNULL (&curr_lsa))
+  while (size > 0)
     {
-      curr_log_page = la_get_page (curr_lsa.pageid);
-      curr_log_record = LOG_GET_LOG_RECORD_HEADER (curr_log_page, &curr_lsa);
-
-      if (prev_repl_log_record == NULL)
+      nbytes = write (fd, ptr, size);
+      if (nbytes < 0)
 	{
-	  prev_repl_log_record = (LOG_RECORD_HEADER *) malloc (sizeof (LOG_RECORD_HEADER));
-	  if (prev_repl_log_record == NULL)
+	  if (errno == EINTR)
 	    {
-	      return NULL;
+	      continue;
 	    }
-
-	  memcpy (prev_repl_log_record, curr_log_record, sizeof (LOG_RECORD_HEADER));
+	  return ER_FAILED;
 	}
-      if (!LSA_EQ (&curr_lsa, &prev_repl_lsa) && prev_repl_log_record->trid == curr_log_record->trid)
-	{
-	  if (LSA_GT (&curr_lsa, last_lsa) || curr_log_record->type == LOG_COMMIT || curr_log_record->type == LOG_ABORT
-	      || LSA_GE (&curr_lsa, &la_Info.act_log.log_hdr->eof_lsa))
-	    {
-	      break;
-	    }
 
-	  if (curr_log_record->type == LOG_REPLICATION_DATA || curr_log_record->type == LOG_REPLICATION_STATEMENT)
-	    {
-	      next_item = la_make_repl_item (curr_log_page, curr_log_record->type, curr_log_record->trid, &curr_lsa);
-	      assert (next_item);
+      ptr += nbytes;
+      size -= nbytes;
+    }
 
-	      break;
-	    }
+  return NO_ERROR;
+}
 
-	}
-      la_release_page_buffer (curr_lsa.pageid);
-      LSA_COPY (&curr_lsa, &curr_log_record->forw_lsa);
+/*
+ * la_par_connect() - connect to the slave database as applylogdb does
+ *   return: NO_ERROR or error code
+ *   database_name(in):
+ *   er_file(in): error log file of applylogdb
+ */
+static int
+la_par_connect (const char *database_name, const char *er_file)
+{
+  int error;
+
+  AU_DISABLE_PASSWORDS ();
+  db_set_client_type (DB_CLIENT_TYPE_LOG_APPLIER);
+  error = db_login ("DBA", NULL);
+  if (error != NO_ERROR)
+    {
+      return error;
     }
 
-  if (prev_repl_log_record)
+  error = db_restart (UTIL_OPTION_APPLYLOGDB, FALSE, database_name);
+  if (error != NO_ERROR)
     {
-      free_and_init (prev_repl_log_record);
+      return error;
     }
 
-  return next_item;
-}
+  if (er_file != NULL)
+    {
+      er_init (er_file, ER_NEVER_EXIT);
+    }
+
+  /* applylogdb should not fire trigger action */
+  db_disable_trigger ();
+  db_set_lock_timeout (-1);
+
+  error = sysprm_load_and_init (database_name, NULL);
+  if (error != NO_ERROR)
+    {
+      (void) db_shutdown ();
+    }
 
+  return error;
+}
 
+/*
+ * la_par_start_workers() - start the apply workers
+ *   return: NO_ERROR or error code
+ *   database_name(in):
+ *
+ * Note: the client workspace and the connection are process-global, so the
+ *       workers are processes. The applier logs out, forks the workers which
+ *       log in by themselves and logs in again. Each worker reads the
+ *       transactions from a pipe and replies on another pipe when they are
+ *       committed. When no worker can be started, the applier applies the
+ *       transactions by itself.
+ */
 static int
-la_log_record_process (LOG_RECORD_HEADER * lrec, LOG_LSA * final, LOG_PAGE * pg_ptr)
+la_par_start_workers (const char *database_name)
 {
-  LA_APPLY *apply = NULL;
+  int num_workers, i, j;
+  int request_fds[2], reply_fds[2];
+  const char *er_file;
+  char *er_file_copy = NULL;
+  char buffer[LINE_MAX];
+  pid_t pid;
   int error = NO_ERROR;
-  LOG_LSA lsa_apply;
-  LOG_LSA required_lsa;
-  LOG_PAGEID final_pageid;
-  int commit_list_count;
-  LOG_REC_HA_SERVER_STATE *ha_server_state;
-  char buffer[256];
-  time_t eot_time;
 
-  if (lrec->trid == NULL_TRANID || LSA_GT (&lrec->prev_tranlsa, final) || LSA_GT (&lrec->back_lsa, final))
+  num_workers = prm_get_integer_value (PRM_ID_HA_APPLYLOGDB_PARALLEL_WORKERS);
+  if (num_workers <= 0)
     {
-      if (lrec->type != LOG_END_OF_LOG)
-	{
-	  la_applier_need_shutdown = true;
+      return NO_ERROR;
+    }
 
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_LA_INVALID_REPL_LOG_RECORD, 10, final->pageid, final->offset,
-		  lrec->forw_lsa.pageid, lrec->forw_lsa.offset, lrec->back_lsa.pageid, lrec->back_lsa.offset,
-		  lrec->trid, lrec->prev_tranlsa.pageid, lrec->prev_tranlsa.offset, lrec->type);
-	  return ER_LOG_PAGE_CORRUPTED;
-	}
+  if (la_enable_sql_logging)
+    {
+      snprintf (buffer, sizeof (buffer), "%s is ignored since %s is enabled",
+		prm_get_name (PRM_ID_HA_APPLYLOGDB_PARALLEL_WORKERS), prm_get_name (PRM_ID_HA_SQL_LOGGING));
+      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buffer);
+      return NO_ERROR;
     }
 
-  if ((lrec->type != LOG_END_OF_LOG && lrec->type != LOG_DUMMY_HA_SERVER_STATE) && lrec->trid != LOG_SYSTEM_TRANID
-      && LSA_ISNULL (&lrec->prev_tranlsa))
+  memset (&la_Par, 0, sizeof (la_Par));
+  la_Par.workers = (LA_PAR_WORKER *) calloc (num_workers, sizeof (LA_PAR_WORKER));
+  la_Par.max_trans = num_workers * LA_PAR_MAX_PENDING_TRANS * 2;
+  la_Par.trans = (LA_PAR_TRANS *) calloc (la_Par.max_trans, sizeof (LA_PAR_TRANS));
+  if (la_Par.workers == NULL || la_Par.trans == NULL)
     {
-      apply = la_add_apply_list (lrec->trid);
-      if (apply == NULL)
-	{
-	  la_applier_need_shutdown = true;
+      error = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, la_Par.max_trans * sizeof (LA_PAR_TRANS));
+      goto error_exit;
+    }
 
-	  assert (er_errid () != NO_ERROR);
-	  error = er_errid ();
-	  if (error != NO_ERROR)
-	    {
-	      return error;
-	    }
-	  else
-	    {
-	      return ER_FAILED;
-	    }
-	}
-      if (LSA_ISNULL (&apply->start_lsa))
-	{
-	  LSA_COPY (&apply->start_lsa, final);
-	}
+  LSA_COPY (&la_Par.applied_lsa, &la_Info.last_committed_lsa);
+  LSA_COPY (&la_Par.applied_rep_lsa, &la_Info.last_committed_rep_lsa);
+  la_Par.applied_log_record_time = la_Info.log_record_time;
+  la_Par.last_report_time = time (NULL);
+
+  er_file = er_get_msglog_filename ();
+  if (er_file != NULL)
+    {
+      er_file_copy = strdup (er_file);
     }
 
-  la_Info.is_end_of_record = false;
-  switch (lrec->type)
+  (void) db_commit_transaction ();
+  (void) db_shutdown ();
+
+  for (i = 0; i < num_workers; i++)
     {
-    case LOG_END_OF_LOG:
-      if (la_does_page_exist (final->pageid + 1) && la_does_page_exist (final->pageid) == LA_PAGE_EXST_IN_ARCHIVE_LOG)
+      la_Par.workers[i].key_refs = (int *) calloc (LA_PAR_KEY_BUCKETS, sizeof (int));
+      if (la_Par.workers[i].key_refs == NULL)
 	{
-	  /* when we meet the END_OF_LOG of archive file, skip log page */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_LA_UNEXPECTED_EOF_IN_ARCHIVE_LOG, 2, final->pageid,
-		  final->offset);
-	  final->pageid++;
-	  final->offset = 0;
+	  break;
 	}
-      else
+      if (pipe (request_fds) < 0)
 	{
-	  /* we meet the END_OF_LOG */
-#if defined (LA_VERBOSE_DEBUG)
-	  er_log_debug (ARG_FILE_LINE, "reached END_OF_LOG in active log. LSA(%d|%d)", final->pageid, final->offset);
-#endif
-	  la_Info.is_end_of_record = true;
+	  free_and_init (la_Par.workers[i].key_refs);
+	  break;
 	}
-      return ER_INTERRUPTED;
-
-    case LOG_REPLICATION_DATA:
-    case LOG_REPLICATION_STATEMENT:
-      /* add the replication log to the target transaction */
-      error = la_set_repl_log (pg_ptr, lrec->type, lrec->trid, final);
-      if (error != NO_ERROR)
+      if (pipe (reply_fds) < 0)
 	{
-	  la_applier_need_shutdown = true;
-	  return error;
+	  close (request_fds[0]);
+	  close (request_fds[1]);
+	  free_and_init (la_Par.workers[i].key_refs);
+	  break;
 	}
-      break;
 
-    case LOG_COMMIT_TOPOPE:
-    case LOG_COMMIT:
-      /* apply the replication log to the slave */
-      if (LSA_GT (final, &la_Info.committed_lsa))
+      pid = fork ();
+      if (pid < 0)
 	{
-	  /* add the repl_list to the commit_list */
-	  if (lrec->type == LOG_COMMIT_TOPOPE)
-	    {
-	      eot_time = 0;
-	    }
-	  else
+	  close (request_fds[0]);
+	  close (request_fds[1]);
+	  close (reply_fds[0]);
+	  close (reply_fds[1]);
+	  free_and_init (la_Par.workers[i].key_refs);
+	  break;
+	}
+      else if (pid == 0)
+	{
+	  close (request_fds[1]);
+	  close (reply_fds[0]);
+	  for (j = 0; j < i; j++)
 	    {
-	      eot_time = la_retrieve_eot_time (pg_ptr, final);
+	      close (la_Par.workers[j].request_fd);
+	      close (la_Par.workers[j].reply_fd);
 	    }
 
-	  error = la_add_node_into_la_commit_list (lrec->trid, final, lrec->type, eot_time);
-	  if (error != NO_ERROR)
-	    {
-	      la_applier_need_shutdown = true;
-	      return error;
-	    }
+	  la_par_worker_main (database_name, er_file_copy, request_fds[0], reply_fds[1]);
+	  /* not reached */
+	}
 
-	  /* in case of delayed/time-bound replication */
-	  if (eot_time != 0)
-	    {
-	      error = la_delay_replica (eot_time);
-	      if (error != NO_ERROR)
-		{
-		  return error;
-		}
-	    }
+      close (request_fds[0]);
+      close (reply_fds[1]);
 
-	  /* make db_ha_apply_info.status busy */
-	  if (la_Info.status == LA_STATUS_IDLE)
-	    {
-	      la_Info.status = LA_STATUS_BUSY;
-	    }
+      la_Par.workers[i].pid = pid;
+      la_Par.workers[i].request_fd = request_fds[1];
+      la_Par.workers[i].reply_fd = reply_fds[0];
+      la_Par.num_workers++;
+    }
 
-	  final_pageid = (pg_ptr) ? pg_ptr->hdr.logical_pageid : NULL_PAGEID;
-	  do
-	    {
+  error = la_par_connect (database_name, er_file_copy);
+  if (er_file_copy != NULL)
+    {
+      free_and_init (er_file_copy);
+    }
+  if (error != NO_ERROR)
+    {
+      goto error_exit;
+    }
+
+  if (la_Par.num_workers < num_workers)
+    {
+      snprintf (buffer, sizeof (buffer), "cannot start apply workers (%d of %d started): %s", la_Par.num_workers,
+		num_workers, strerror (errno));
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buffer);
+    }
+
+  if (la_Par.num_workers == 0)
+    {
+      la_par_stop_workers ();
+      return NO_ERROR;
+    }
+
+  snprintf (buffer, sizeof (buffer), "transactions are applied by %d apply workers", la_Par.num_workers);
+  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buffer);
+
+  return NO_ERROR;
+
+error_exit:
+  la_par_stop_workers ();
+
+  return error;
+}
+
+/*
+ * la_par_stop_workers() - stop the apply workers
+ *   return: none
+ *
+ * Note: a worker commits what it has applied and exits at the end of its
+ *       request pipe.
+ */
+static void
+la_par_stop_workers (void)
+{
+  int i, status;
+
+  for (i = 0; i < la_Par.num_workers; i++)
+    {
+      close (la_Par.workers[i].request_fd);
+    }
+
+  for (i = 0; i < la_Par.num_workers; i++)
+    {
+      while (waitpid (la_Par.workers[i].pid, &status, 0) < 0 && errno == EINTR)
+	{
+	  ;
+	}
+      close (la_Par.workers[i].reply_fd);
+    }
+
+  if (la_Par.num_workers > 0)
+    {
+      la_par_report_stats (true);
+    }
+
+  for (i = 0; i < la_Par.num_workers; i++)
+    {
+      free_and_init (la_Par.workers[i].key_refs);
+    }
+  for (i = 0; i < la_Par.max_trans && la_Par.trans != NULL; i++)
+    {
+      if (la_Par.trans[i].buckets != NULL)
+	{
+	  free_and_init (la_Par.trans[i].buckets);
+	}
+    }
+  if (la_Par.workers != NULL)
+    {
+      free_and_init (la_Par.workers);
+    }
+  if (la_Par.trans != NULL)
+    {
+      free_and_init (la_Par.trans);
+    }
+  if (la_Par.buffer != NULL)
+    {
+      free_and_init (la_Par.buffer);
+    }
+  if (la_Par.applied_marks != NULL)
+    {
+      free_and_init (la_Par.applied_marks);
+    }
+
+  memset (&la_Par, 0, sizeof (la_Par));
+}
+
+/*
+ * la_par_worker_main() - main loop of an apply worker
+ *   return: does not return
+ *   database_name(in):
+ *   er_file(in): error log file of applylogdb
+ *   request_fd(in): pipe from the applier
+ *   reply_fd(in): pipe to the applier
+ *
+ * Note: the transactions received without a pause are committed together,
+ *       up to LA_PAR_MAX_GROUP_COMMIT transactions, as the applier commits
+ *       by its commit interval.
+ */
+static void
+la_par_worker_main (const char *database_name, const char *er_file, int request_fd, int reply_fd)
+{
+  LA_PAR_REQUEST request;
+  LA_PAR_REPLY reply;
+  unsigned int seqs[LA_PAR_MAX_GROUP_COMMIT];
+  LOG_LSA commit_lsas[LA_PAR_MAX_GROUP_COMMIT];
+  int num_seqs = 0;
+  char *body = NULL;
+  int body_size = 0;
+  struct pollfd pfd;
+  int error;
+
+  /* the worker does not dispatch, and only marks its transactions in db_ha_apply_info */
+  memset (&la_Par, 0, sizeof (la_Par));
+  la_Info.insert_counter = 0;
+  la_Info.update_counter = 0;
+  la_Info.delete_counter = 0;
+  la_Info.fail_counter = 0;
+  la_Info.num_unflushed = 0;
+
+  error = la_par_connect (database_name, er_file);
+  if (error != NO_ERROR)
+    {
+      memset (&reply, 0, sizeof (reply));
+      reply.error = error;
+      (void) la_par_write (reply_fd, &reply, sizeof (reply));
+      exit (1);
+    }
+
+  while (true)
+    {
+      if (num_seqs > 0)
+	{
+	  pfd.fd = request_fd;
+	  pfd.events = POLLIN;
+	  pfd.revents = 0;
+	  if (num_seqs >= LA_PAR_MAX_GROUP_COMMIT || poll (&pfd, 1, 0) == 0)
+	    {
+	      error = la_par_worker_commit (reply_fd, seqs, commit_lsas, num_seqs);
+	      num_seqs = 0;
+	      if (error != NO_ERROR)
+		{
+		  break;
+		}
+	    }
+	}
+
+      if (la_par_read (request_fd, &request, sizeof (request)) != NO_ERROR)
+	{
+	  /* the applier has stopped */
+	  if (num_seqs > 0)
+	    {
+	      error = la_par_worker_commit (reply_fd, seqs, commit_lsas, num_seqs);
+	    }
+	  break;
+	}
+
+      if (request.type == LA_PAR_MSG_COMMIT)
+	{
+	  LSA_COPY (&commit_lsas[num_seqs], &request.commit_lsa);
+	  seqs[num_seqs++] = request.seq;
+	  continue;
+	}
+
+      if (request.body_length > body_size)
+	{
+	  if (body != NULL)
+	    {
+	      free_and_init (body);
+	    }
+	  body_size = request.body_length;
+	  body = (char *) malloc (body_size);
+	  if (body == NULL)
+	    {
+	      error = ER_OUT_OF_VIRTUAL_MEMORY;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, body_size);
+	      break;
+	    }
+	}
+
+      if (la_par_read (request_fd, body, request.body_length) != NO_ERROR)
+	{
+	  break;
+	}
+
+      error = la_par_worker_apply_item (&request, body);
+      if (error != NO_ERROR)
+	{
+	  /* let the applier stop and restart from the last committed transaction */
+	  memset (&reply, 0, sizeof (reply));
+	  reply.error = error;
+	  (void) la_par_write (reply_fd, &reply, sizeof (reply));
+	  break;
+	}
+    }
+
+  if (body != NULL)
+    {
+      free_and_init (body);
+    }
+
+  (void) db_shutdown ();
+  exit ((error == NO_ERROR) ? 0 : 1);
+}
+
+/*
+ * la_par_worker_apply_item() - apply a replication item in an apply worker
+ *   return: NO_ERROR or error code that stops the applier
+ *   request(in): message header
+ *   body(in): the key, the class name and the record of the item
+ *
+ * Note: errors are retried or ignored as la_apply_repl_log () does. Any
+ *       other error stops the applier instead of skipping the row: the
+ *       transactions of the other workers have gone on and the row may not
+ *       be applied later in commit order. The pending transactions are
+ *       applied again from the oldest of them when the applier restarts,
+ *       except those that a worker has marked as committed.
+ */
+static int
+la_par_worker_apply_item (LA_PAR_REQUEST * request, char *body)
+{
+  DB_VALUE key;
+  DB_OBJECT *class_obj;
+  RECDES *recdes = NULL;
+  char *class_name;
+  char buf[256];
+  int la_err_code;
+  int error, errid;
+
+  (void) or_unpack_value (body, &key);
+  class_name = body + request->key_length;
+
+  if (request->item_type != RVREPL_DATA_DELETE)
+    {
+      recdes = la_assign_recdes_from_pool ();
+      error = la_realloc_recdes_data (recdes, request->rec_length);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      memcpy (recdes->data, class_name + request->class_name_length, request->rec_length);
+      recdes->length = request->rec_length;
+      recdes->type = request->rec_type;
+    }
+
+  while (true)
+    {
+      error = la_flush_repl_items (false);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      class_obj = db_find_class (class_name);
+      if (class_obj == NULL)
+	{
+	  error = er_errid ();
+	  if (error == NO_ERROR)
+	    {
+	      error = ER_FAILED;
+	    }
+	}
+      else
+	{
+	  error = obj_repl_add_object (class_obj, &key, request->item_type, recdes);
+	}
+
+      if (error == NO_ERROR)
+	{
+	  if (request->item_type == RVREPL_DATA_INSERT)
+	    {
+	      la_Info.insert_counter++;
+	    }
+	  else if (request->item_type == RVREPL_DATA_DELETE)
+	    {
+	      la_Info.delete_counter++;
+	    }
+	  else
+	    {
+	      la_Info.update_counter++;
+	    }
+	  la_Info.num_unflushed++;
+	  break;
+	}
+
+      if (request->item_type == RVREPL_DATA_INSERT)
+	{
+	  la_err_code = ER_HA_LA_FAILED_TO_APPLY_INSERT;
+	}
+      else if (request->item_type == RVREPL_DATA_DELETE)
+	{
+	  la_err_code = ER_HA_LA_FAILED_TO_APPLY_DELETE;
+	}
+      else
+	{
+	  la_err_code = ER_HA_LA_FAILED_TO_APPLY_UPDATE;
+	}
+
+      errid = er_errid ();
+      if (errid == NO_ERROR)
+	{
+	  errid = error;
+	}
+
+      help_sprint_value (&key, buf, 255);
+      er_stack_push ();
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, la_err_code, 4, class_name, buf, error, "internal client error.");
+      er_stack_pop ();
+
+      la_Info.fail_counter++;
+
+      if (errid == ER_NET_CANT_CONNECT_SERVER || errid == ER_OBJ_NO_CONNECT)
+	{
+	  error = ER_NET_CANT_CONNECT_SERVER;
+	  break;
+	}
+      else if (la_ignore_on_error (errid) == false && la_retry_on_error (errid) == true)
+	{
+	  snprintf (buf, sizeof (buf), "attempts to try applying failed replication log again. (error:%d)", errid);
+	  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buf);
+
+	  /* try it again */
+	  LA_SLEEP (10, 0);
+	  continue;
+	}
+      else if (la_ignore_on_error (errid) == true)
+	{
+	  error = NO_ERROR;
+	  break;
+	}
+
+      error = errid;
+      break;
+    }
+
+end:
+  pr_clear_value (&key);
+
+  return error;
+}
+
+/*
+ * la_par_worker_commit() - commit the applied transactions and reply
+ *   return: NO_ERROR or error code
+ *   reply_fd(in): pipe to the applier
+ *   seqs(in): sequence numbers of the transactions
+ *   commit_lsas(in): LSAs of LOG_COMMIT of the transactions
+ *   num_seqs(in):
+ *
+ * Note: the transactions are marked as committed in the same transaction as
+ *       their rows, since db_ha_apply_info records only the transactions
+ *       committed together with all the previous ones.
+ */
+static int
+la_par_worker_commit (int reply_fd, unsigned int *seqs, LOG_LSA * commit_lsas, int num_seqs)
+{
+  static unsigned long last_insert_counter = 0, last_update_counter = 0;
+  static unsigned long last_delete_counter = 0, last_fail_counter = 0;
+  LA_PAR_REPLY reply;
+  int error, i;
+
+  error = la_flush_repl_items (true);
+  if (error == NO_ERROR)
+    {
+      error = la_par_mark_applied (commit_lsas, num_seqs);
+    }
+  if (error == NO_ERROR)
+    {
+      error = la_commit_transaction ();
+    }
+  if (error == ER_OBJ_NO_CONNECT)
+    {
+      error = ER_NET_CANT_CONNECT_SERVER;
+    }
+
+  for (i = 0; i < num_seqs; i++)
+    {
+      memset (&reply, 0, sizeof (reply));
+      reply.seq = seqs[i];
+      reply.error = error;
+      if (i == 0)
+	{
+	  reply.insert_counter = (int) (la_Info.insert_counter - last_insert_counter);
+	  reply.update_counter = (int) (la_Info.update_counter - last_update_counter);
+	  reply.delete_counter = (int) (la_Info.delete_counter - last_delete_counter);
+	  reply.fail_counter = (int) (la_Info.fail_counter - last_fail_counter);
+
+	  last_insert_counter = la_Info.insert_counter;
+	  last_update_counter = la_Info.update_counter;
+	  last_delete_counter = la_Info.delete_counter;
+	  last_fail_counter = la_Info.fail_counter;
+	}
+
+      if (la_par_write (reply_fd, &reply, sizeof (reply)) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
+  return error;
+}
+
+/*
+ * la_par_make_mark_pattern() - make the LIKE pattern of the marks of the
+ *                              committed transactions
+ *   return: NO_ERROR or ER_FAILED if it does not fit
+ *   pattern(out): pattern escaped by '!'
+ *   size(in): size of pattern
+ *
+ * Note: a transaction committed by a worker is marked by a row whose
+ *       copied_log_path is "<copied log path>#<commit LSA>" and whose
+ *       committed_lsa is its commit LSA.
+ */
+static int
+la_par_make_mark_pattern (char *pattern, int size)
+{
+  const char *p;
+  int i = 0;
+
+  for (p = la_Info.log_path; *p != '\0'; p++)
+    {
+      if (i + 5 > size)
+	{
+	  return ER_FAILED;
+	}
+
+      if (*p == '!' || *p == '%' || *p == '_')
+	{
+	  pattern[i++] = '!';
+	}
+      pattern[i++] = *p;
+    }
+
+  pattern[i++] = '#';
+  pattern[i++] = '%';
+  pattern[i] = '\0';
+
+  return NO_ERROR;
+}
+
+/*
+ * la_par_mark_applied() - mark the transactions committed by an apply worker
+ *   return: NO_ERROR or error code
+ *   commit_lsas(in): LSAs of LOG_COMMIT of the transactions
+ *   num_lsas(in):
+ */
+static int
+la_par_mark_applied (LOG_LSA * commit_lsas, int num_lsas)
+{
+#define LA_IN_VALUE_COUNT       7
+  int res;
+  int i, j;
+  int in_value_idx;
+  DB_VALUE in_value[LA_IN_VALUE_COUNT];
+  DB_DATETIME creation_time;
+  char query_buf[LA_QUERY_BUF_SIZE];
+  char mark_path[PATH_MAX + 64];
+  LA_ACT_LOG *act_log;
+
+  act_log = &la_Info.act_log;
+
+  snprintf (query_buf, sizeof (query_buf), "INSERT INTO %s "	/* INSERT */
+	    "( db_name, "	/* 1 */
+	    "  db_creation_time, "	/* 2 */
+	    "  copied_log_path, "	/* 3 */
+	    "  committed_lsa_pageid, "	/* 4 */
+	    "  committed_lsa_offset, "	/* 5 */
+	    "  required_lsa_pageid, "	/* 6 */
+	    "  required_lsa_offset ) "	/* 7 */
+	    " VALUES ( ?, ?, ?, ?, ?, ?, ? ) ;", CT_HA_APPLY_INFO_NAME);
+
+  db_localdatetime (&act_log->log_hdr->db_creation, &creation_time);
+
+  for (i = 0; i < num_lsas; i++)
+    {
+      snprintf (mark_path, sizeof (mark_path), "%s#%lld|%d", la_Info.log_path, (long long) commit_lsas[i].pageid,
+		(int) commit_lsas[i].offset);
+
+      in_value_idx = 0;
+
+      /* 1. db_name */
+      db_make_varchar (&in_value[in_value_idx++], 255, act_log->log_hdr->prefix_name,
+		       strlen (act_log->log_hdr->prefix_name), LANG_SYS_CODESET, LANG_SYS_COLLATION);
+
+      /* 2. db_creation time */
+      db_make_datetime (&in_value[in_value_idx++], &creation_time);
+
+      /* 3. copied_log_path */
+      db_make_varchar (&in_value[in_value_idx++], 4096, mark_path, strlen (mark_path), LANG_SYS_CODESET,
+		       LANG_SYS_COLLATION);
+
+      /* 4 ~ 7. committed_lsa and required_lsa */
+      db_make_bigint (&in_value[in_value_idx++], commit_lsas[i].pageid);
+      db_make_int (&in_value[in_value_idx++], commit_lsas[i].offset);
+      db_make_bigint (&in_value[in_value_idx++], commit_lsas[i].pageid);
+      db_make_int (&in_value[in_value_idx++], commit_lsas[i].offset);
+      assert_release (in_value_idx == LA_IN_VALUE_COUNT);
+
+      res = la_update_query_execute_with_values (query_buf, in_value_idx, &in_value[0], true);
+
+      for (j = 0; j < in_value_idx; j++)
+	{
+	  db_value_clear (&in_value[j]);
+	}
+
+      if (res < 0)
+	{
+	  return res;
+	}
+    }
+
+  return NO_ERROR;
+
+#undef LA_IN_VALUE_COUNT
+}
+
+/*
+ * la_par_load_applied_marks() - find the transactions committed by the apply
+ *                               workers after the recorded position
+ *   return: NO_ERROR or error code
+ *
+ * Note: the workers commit out of commit order, and db_ha_apply_info records
+ *       only the transactions committed together with all the previous
+ *       ones. The transactions after it are read again at restart, and
+ *       those marked by a worker are skipped instead of applied twice.
+ */
+static int
+la_par_load_applied_marks (void)
+{
+#define LA_IN_VALUE_COUNT       2
+#define LA_OUT_VALUE_COUNT      2
+  int res, pos;
+  int i, in_value_idx;
+  DB_VALUE in_value[LA_IN_VALUE_COUNT];
+  DB_VALUE out_value[LA_OUT_VALUE_COUNT];
+  char query_buf[LA_QUERY_BUF_SIZE];
+  char pattern[PATH_MAX * 2 + 3];
+  char buffer[LINE_MAX];
+  DB_QUERY_ERROR query_error;
+  DB_QUERY_RESULT *result = NULL;
+  LOG_LSA lsa;
+  int error = NO_ERROR;
+
+  if (la_par_make_mark_pattern (pattern, sizeof (pattern)) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  snprintf (query_buf, sizeof (query_buf),
+	    "SELECT committed_lsa_pageid, committed_lsa_offset FROM %s "
+	    " WHERE db_name = ? AND copied_log_path LIKE ? ESCAPE '!' ORDER BY 1, 2 ;", CT_HA_APPLY_INFO_NAME);
+
+  in_value_idx = 0;
+  db_make_varchar (&in_value[in_value_idx++], 255, la_Info.act_log.log_hdr->prefix_name,
+		   strlen (la_Info.act_log.log_hdr->prefix_name), LANG_SYS_CODESET, LANG_SYS_COLLATION);
+  db_make_varchar (&in_value[in_value_idx++], 4096, pattern, strlen (pattern), LANG_SYS_CODESET,
+		   LANG_SYS_COLLATION);
+  assert_release (in_value_idx == LA_IN_VALUE_COUNT);
+
+  res = db_execute_with_values (query_buf, &result, &query_error, in_value_idx, &in_value[0]);
+  if (res < 0)
+    {
+      error = res;
+      goto end;
+    }
+
+  if (res > 0)
+    {
+      la_Par.applied_marks = (LOG_LSA *) malloc (res * sizeof (LOG_LSA));
+      if (la_Par.applied_marks == NULL)
+	{
+	  error = ER_OUT_OF_VIRTUAL_MEMORY;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, res * sizeof (LOG_LSA));
+	  goto end;
+	}
+
+      for (pos = db_query_first_tuple (result); pos == DB_CURSOR_SUCCESS; pos = db_query_next_tuple (result))
+	{
+	  error = db_query_get_tuple_valuelist (result, LA_OUT_VALUE_COUNT, out_value);
+	  if (error != NO_ERROR)
+	    {
+	      goto end;
+	    }
+
+	  lsa.pageid = DB_GET_BIGINT (&out_value[0]);
+	  lsa.offset = DB_GET_INTEGER (&out_value[1]);
+	  for (i = 0; i < LA_OUT_VALUE_COUNT; i++)
+	    {
+	      db_value_clear (&out_value[i]);
+	    }
+
+	  /* the marks up to the recorded position are left over by the last update of db_ha_apply_info */
+	  if (LSA_GT (&lsa, &la_Info.last_committed_lsa) && la_Par.num_applied_marks < res)
+	    {
+	      LSA_COPY (&la_Par.applied_marks[la_Par.num_applied_marks++], &lsa);
+	    }
+	}
+
+      if (pos != DB_CURSOR_END)
+	{
+	  error = ER_FAILED;
+	  goto end;
+	}
+    }
+
+  if (la_Par.num_applied_marks > 0)
+    {
+      snprintf (buffer, sizeof (buffer),
+		"%d transactions committed by the apply workers after the last committed LSA (%lld|%d) are skipped",
+		la_Par.num_applied_marks, (long long) la_Info.last_committed_lsa.pageid,
+		(int) la_Info.last_committed_lsa.offset);
+      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buffer);
+    }
+
+end:
+  if (result != NULL)
+    {
+      db_query_end (result);
+    }
+  for (i = 0; i < in_value_idx; i++)
+    {
+      db_value_clear (&in_value[i]);
+    }
+
+  return error;
+
+#undef LA_IN_VALUE_COUNT
+#undef LA_OUT_VALUE_COUNT
+}
+
+/*
+ * la_par_delete_applied_marks() - delete the marks of the committed
+ *                                 transactions up to a position
+ *   return: NO_ERROR or error code
+ *   lsa(in): position recorded in db_ha_apply_info, or NULL for all the marks
+ *
+ * Note: called in the transaction that records the position.
+ */
+static int
+la_par_delete_applied_marks (const LOG_LSA * lsa)
+{
+#define LA_IN_VALUE_COUNT       5
+  int res;
+  int i, in_value_idx;
+  DB_VALUE in_value[LA_IN_VALUE_COUNT];
+  char query_buf[LA_QUERY_BUF_SIZE];
+  char pattern[PATH_MAX * 2 + 3];
+
+  if (la_par_make_mark_pattern (pattern, sizeof (pattern)) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  snprintf (query_buf, sizeof (query_buf),
+	    "DELETE FROM %s WHERE db_name = ? AND copied_log_path LIKE ? ESCAPE '!' %s ;", CT_HA_APPLY_INFO_NAME,
+	    (lsa != NULL) ? " AND (committed_lsa_pageid < ? "
+	    "      OR (committed_lsa_pageid = ? AND committed_lsa_offset <= ?))" : "");
+
+  in_value_idx = 0;
+  db_make_varchar (&in_value[in_value_idx++], 255, la_Info.act_log.log_hdr->prefix_name,
+		   strlen (la_Info.act_log.log_hdr->prefix_name), LANG_SYS_CODESET, LANG_SYS_COLLATION);
+  db_make_varchar (&in_value[in_value_idx++], 4096, pattern, strlen (pattern), LANG_SYS_CODESET,
+		   LANG_SYS_COLLATION);
+  if (lsa != NULL)
+    {
+      db_make_bigint (&in_value[in_value_idx++], lsa->pageid);
+      db_make_bigint (&in_value[in_value_idx++], lsa->pageid);
+      db_make_int (&in_value[in_value_idx++], lsa->offset);
+    }
+  assert_release (in_value_idx <= LA_IN_VALUE_COUNT);
+
+  res = la_update_query_execute_with_values (query_buf, in_value_idx, &in_value[0], true);
+
+  for (i = 0; i < in_value_idx; i++)
+    {
+      db_value_clear (&in_value[i]);
+    }
+
+  return (res < 0) ? res : NO_ERROR;
+
+#undef LA_IN_VALUE_COUNT
+}
+
+/*
+ * la_par_was_applied() - check if a transaction was committed by an apply
+ *                        worker before the restart
+ *   return: true if it is marked
+ *   commit_lsa(in): LSA of LOG_COMMIT of the transaction
+ *
+ * Note: called in commit order.
+ */
+static bool
+la_par_was_applied (const LOG_LSA * commit_lsa)
+{
+  while (la_Par.next_applied_mark < la_Par.num_applied_marks
+	 && LSA_LT (&la_Par.applied_marks[la_Par.next_applied_mark], commit_lsa))
+    {
+      la_Par.next_applied_mark++;
+    }
+
+  return (la_Par.next_applied_mark < la_Par.num_applied_marks
+	  && LSA_EQ (&la_Par.applied_marks[la_Par.next_applied_mark], commit_lsa));
+}
+
+/*
+ * la_par_get_class_constraints() - find the constraints of a class that its
+ *                                  primary key does not stand for
+ *   return: NO_ERROR or error code
+ *   class_name(in):
+ *   has_unique(out): the class has a unique key other than the primary key
+ *   has_foreign_key(out): the class references another class
+ */
+static int
+la_par_get_class_constraints (const char *class_name, bool * has_unique, bool * has_foreign_key)
+{
+  DB_OBJECT *class_obj;
+  DB_CONSTRAINT *constraint;
+  DB_CONSTRAINT_TYPE type;
+  int error;
+
+  *has_unique = false;
+  *has_foreign_key = false;
+
+  class_obj = db_find_class (class_name);
+  if (class_obj == NULL)
+    {
+      error = er_errid ();
+      return (error == NO_ERROR) ? ER_FAILED : error;
+    }
+
+  for (constraint = db_get_constraints (class_obj); constraint != NULL; constraint = db_constraint_next (constraint))
+    {
+      type = db_constraint_type (constraint);
+      if (type == DB_CONSTRAINT_UNIQUE || type == DB_CONSTRAINT_REVERSE_UNIQUE)
+	{
+	  *has_unique = true;
+	}
+      else if (type == DB_CONSTRAINT_FOREIGN_KEY)
+	{
+	  *has_foreign_key = true;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * la_par_can_dispatch() - whether a transaction can be applied by a worker
+ *   return: true if all its items are row changes in memory
+ *   apply(in):
+ *
+ * Note: statements, including DDL, may touch any row and are applied by the
+ *       applier after all the previous transactions, as are long
+ *       transactions whose items are read from the log while applied.
+ *       So are the rows of a class with a foreign key, whose check depends
+ *       on the rows of the referenced class applied by any worker.
+ */
+static bool
+la_par_can_dispatch (LA_APPLY * apply)
+{
+  LA_ITEM *item;
+  bool has_unique, has_foreign_key;
+
+  if (apply->is_long_trans)
+    {
+      return false;
+    }
+
+  for (item = apply->head; item != NULL; item = item->next)
+    {
+      if (item->log_type != LOG_REPLICATION_DATA)
+	{
+	  return false;
+	}
+
+      switch (item->item_type)
+	{
+	case RVREPL_DATA_UPDATE_START:
+	case RVREPL_DATA_UPDATE_END:
+	case RVREPL_DATA_UPDATE:
+	case RVREPL_DATA_INSERT:
+	case RVREPL_DATA_DELETE:
+	  break;
+	default:
+	  return false;
+	}
+
+      if (la_par_need_apply (item) == false)
+	{
+	  continue;
+	}
+
+      if (la_par_get_class_constraints (item->class_name, &has_unique, &has_foreign_key) != NO_ERROR
+	  || has_foreign_key)
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * la_par_need_apply() - whether an item is to be applied, as in la_apply_repl_log ()
+ *   return:
+ *   item(in):
+ */
+static bool
+la_par_need_apply (LA_ITEM * item)
+{
+  return (LSA_GT (&item->lsa, &la_Info.last_committed_rep_lsa) && la_need_filter_out (item) == false);
+}
+
+/*
+ * la_par_reserve_buffer() - make room in the message buffer
+ *   return: message buffer or NULL
+ *   size(in): required size
+ */
+static char *
+la_par_reserve_buffer (int size)
+{
+  char *buffer;
+  int new_size;
+
+  if (size <= la_Par.buffer_size)
+    {
+      return la_Par.buffer;
+    }
+
+  new_size = MAX (size, la_Par.buffer_size * 2);
+  buffer = (char *) realloc (la_Par.buffer, new_size);
+  if (buffer == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, new_size);
+      return NULL;
+    }
+
+  la_Par.buffer = buffer;
+  la_Par.buffer_size = new_size;
+
+  return buffer;
+}
+
+/*
+ * la_par_key_bucket() - get the key bucket of the row changed by an item
+ *   return: bucket or error code
+ *   item(in):
+ *
+ * Note: a bucket stands for the class and the packed primary key of the row.
+ *       Rows of the same bucket are applied by one worker in commit order.
+ *       The rows of a class with another unique key may conflict on it with
+ *       any other row of the class, so the bucket stands for the class only.
+ */
+static int
+la_par_key_bucket (LA_ITEM * item)
+{
+  unsigned int hash;
+  int key_length, i;
+  char *key;
+  bool has_unique, has_foreign_key;
+  int error;
+
+  hash = mht_1strlowerhash (item->class_name, UINT_MAX);
+
+  error = la_par_get_class_constraints (item->class_name, &has_unique, &has_foreign_key);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+  if (has_unique)
+    {
+      return (int) (hash % LA_PAR_KEY_BUCKETS);
+    }
+
+  key_length = or_packed_value_size (&item->key, 1, 1, 0);
+  key = la_par_reserve_buffer (key_length);
+  if (key == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  (void) or_pack_value (key, &item->key);
+
+  for (i = 0; i < key_length; i++)
+    {
+      hash = (hash << 5) - hash + (unsigned char) key[i];
+    }
+
+  return (int) (hash % LA_PAR_KEY_BUCKETS);
+}
+
+/*
+ * la_par_process_reply() - account a transaction committed by a worker
+ *   return: NO_ERROR or error code
+ *   worker(in): index of the worker
+ *   reply(in):
+ *
+ * Note: the transactions committed together with all the previous ones are
+ *       retired; the last of them is the position recorded in
+ *       db_ha_apply_info.
+ */
+static int
+la_par_process_reply (int worker, LA_PAR_REPLY * reply)
+{
+  LA_PAR_WORKER *w = &la_Par.workers[worker];
+  LA_PAR_TRANS *trans;
+  char buffer[LINE_MAX];
+  int i;
+
+  if (reply->error != NO_ERROR)
+    {
+      snprintf (buffer, sizeof (buffer), "apply worker %d (pid %d) failed to apply transactions. (error:%d)", worker,
+		(int) w->pid, reply->error);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buffer);
+
+      if (reply->error == ER_NET_CANT_CONNECT_SERVER || reply->error == ER_LC_PARTIALLY_FAILED_TO_FLUSH
+	  || reply->error == ER_LC_FAILED_TO_FLUSH_REPL_ITEMS)
+	{
+	  return reply->error;
+	}
+
+      la_applier_need_shutdown = true;
+      return ER_HA_GENERIC_ERROR;
+    }
+
+  la_Info.insert_counter += reply->insert_counter;
+  la_Info.update_counter += reply->update_counter;
+  la_Info.delete_counter += reply->delete_counter;
+  la_Info.fail_counter += reply->fail_counter;
+
+  trans = &la_Par.trans[reply->seq % la_Par.max_trans];
+  assert (trans->worker == worker && trans->is_done == false);
+
+  trans->is_done = true;
+  for (i = 0; i < trans->num_buckets; i++)
+    {
+      w->key_refs[trans->buckets[i]]--;
+    }
+  w->num_pending--;
+
+  w->trans_counter++;
+  w->row_counter += trans->num_rows;
+  if (trans->log_record_time != 0)
+    {
+      w->delay = MAX (0, (int) (time (NULL) - trans->log_record_time));
+      w->max_delay = MAX (w->max_delay, w->delay);
+    }
+
+  la_par_retire_committed ();
+
+  return NO_ERROR;
+}
+
+/*
+ * la_par_retire_committed() - retire the transactions committed together
+ *                             with all the previous ones
+ *   return: none
+ */
+static void
+la_par_retire_committed (void)
+{
+  LA_PAR_TRANS *trans;
+
+  while (la_Par.head_seq != la_Par.tail_seq)
+    {
+      trans = &la_Par.trans[la_Par.head_seq % la_Par.max_trans];
+      if (trans->is_done == false)
+	{
+	  break;
+	}
+
+      LSA_COPY (&la_Par.applied_lsa, &trans->commit_lsa);
+      if (!LSA_ISNULL (&trans->last_rep_lsa))
+	{
+	  LSA_COPY (&la_Par.applied_rep_lsa, &trans->last_rep_lsa);
+	}
+      if (trans->log_record_time != 0)
+	{
+	  la_Par.applied_log_record_time = trans->log_record_time;
+	}
+      la_Par.head_seq++;
+    }
+}
+
+/*
+ * la_par_wait_reply() - wait for a transaction to be committed by a worker
+ *   return: NO_ERROR or error code
+ *   worker(in): index of the worker
+ */
+static int
+la_par_wait_reply (int worker)
+{
+  LA_PAR_REPLY reply;
+  char buffer[LINE_MAX];
+
+  if (la_par_read (la_Par.workers[worker].reply_fd, &reply, sizeof (reply)) != NO_ERROR)
+    {
+      snprintf (buffer, sizeof (buffer), "apply worker %d (pid %d) has exited", worker,
+		(int) la_Par.workers[worker].pid);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buffer);
+
+      la_applier_need_shutdown = true;
+      return ER_HA_GENERIC_ERROR;
+    }
+
+  return la_par_process_reply (worker, &reply);
+}
+
+/*
+ * la_par_collect_replies() - account the transactions committed by the workers so far
+ *   return: NO_ERROR or error code
+ */
+static int
+la_par_collect_replies (void)
+{
+  struct pollfd pfds[LA_PAR_MAX_WORKERS];
+  int i, nready, error;
+
+  assert (la_Par.num_workers <= LA_PAR_MAX_WORKERS);
+
+  while (true)
+    {
+      for (i = 0; i < la_Par.num_workers; i++)
+	{
+	  pfds[i].fd = la_Par.workers[i].reply_fd;
+	  pfds[i].events = POLLIN;
+	  pfds[i].revents = 0;
+	}
+
+      nready = poll (pfds, la_Par.num_workers, 0);
+      if (nready <= 0)
+	{
+	  return NO_ERROR;
+	}
+
+      for (i = 0; i < la_Par.num_workers; i++)
+	{
+	  if (pfds[i].revents != 0)
+	    {
+	      error = la_par_wait_reply (i);
+	      if (error != NO_ERROR)
+		{
+		  return error;
+		}
+	    }
+	}
+    }
+}
+
+/*
+ * la_par_wait_workers() - wait for all the dispatched transactions to be committed
+ *   return: NO_ERROR or error code
+ */
+static int
+la_par_wait_workers (void)
+{
+  int i, error;
+
+  for (i = 0; i < la_Par.num_workers; i++)
+    {
+      while (la_Par.workers[i].num_pending > 0)
+	{
+	  error = la_par_wait_reply (i);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * la_par_choose_worker() - choose the worker of a transaction
+ *   return: NO_ERROR or error code
+ *   trans(in): transaction with its key buckets
+ *   worker(out): index of the worker
+ *
+ * Note: a transaction goes to the worker which has a pending transaction on
+ *       one of its rows, or else to the least loaded worker. When its rows
+ *       are pending on several workers, it waits until they are left on one
+ *       worker only; this is the only barrier between the workers.
+ */
+static int
+la_par_choose_worker (LA_PAR_TRANS * trans, int *worker)
+{
+  LA_PAR_WORKER *w;
+  int first, second, i, j, error;
+
+  while (true)
+    {
+      first = second = -1;
+      for (i = 0; i < la_Par.num_workers && second < 0; i++)
+	{
+	  w = &la_Par.workers[i];
+	  if (w->num_pending == 0)
+	    {
+	      continue;
+	    }
+
+	  for (j = 0; j < trans->num_buckets; j++)
+	    {
+	      if (w->key_refs[trans->buckets[j]] > 0)
+		{
+		  if (first < 0)
+		    {
+		      first = i;
+		    }
+		  else
+		    {
+		      second = i;
+		    }
+		  break;
+		}
+	    }
+	}
+
+      if (second >= 0)
+	{
+	  /* the write set overlaps the pending transactions of several workers */
+	  la_Par.workers[second].wait_counter++;
+	  error = la_par_wait_reply (second);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	  continue;
+	}
+
+      if (first < 0)
+	{
+	  first = 0;
+	  for (i = 1; i < la_Par.num_workers; i++)
+	    {
+	      if (la_Par.workers[i].num_pending < la_Par.workers[first].num_pending)
+		{
+		  first = i;
+		}
+	    }
+	}
+
+      if (la_Par.workers[first].num_pending >= LA_PAR_MAX_PENDING_TRANS)
+	{
+	  error = la_par_wait_reply (first);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	  continue;
+	}
+
+      *worker = first;
+      return NO_ERROR;
+    }
+}
+
+/*
+ * la_par_pack_item() - append a replication item to the messages of a transaction
+ *   return: NO_ERROR or error code
+ *   item(in):
+ *   trans(in/out):
+ *   offset(in/out): end of the messages in the message buffer
+ *
+ * Note: the record of an insert or an update is read from the log here, so
+ *       that the workers do not read the log. An item whose record cannot
+ *       be read fails as in la_apply_insert_log () and la_apply_update_log ().
+ */
+static int
+la_par_pack_item (LA_ITEM * item, LA_PAR_TRANS * trans, int *offset)
+{
+  LA_PAR_REQUEST request;
+  RECDES *recdes = NULL;
+  LOG_PAGE *pgptr;
+  LOG_PAGEID pageid = NULL_PAGEID;
+  unsigned int rcvindex;
+  char *buffer, *ptr;
+  char buf[256];
+  int error = NO_ERROR;
+
+  memset (&request, 0, sizeof (request));
+  request.type = LA_PAR_MSG_ITEM;
+  request.item_type = item->item_type;
+  request.key_length = DB_ALIGN (or_packed_value_size (&item->key, 1, 1, 0), MAX_ALIGNMENT);
+  request.class_name_length = strlen (item->class_name) + 1;
+
+  if (item->item_type != RVREPL_DATA_DELETE)
+    {
+      pageid = item->target_lsa.pageid;
+      pgptr = la_get_page (pageid);
+      if (pgptr == NULL)
+	{
+	  error = er_errid ();
+	  if (error == NO_ERROR)
+	    {
+	      error = ER_FAILED;
+	    }
+	  pageid = NULL_PAGEID;
+	  goto end;
+	}
+
+      recdes = la_assign_recdes_from_pool ();
+      error = la_get_recdes (&item->target_lsa, pgptr, recdes, &rcvindex, la_Info.rec_type);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      if (recdes->type == REC_ASSIGN_ADDRESS || recdes->type == REC_RELOCATION)
+	{
+	  er_log_debug (ARG_FILE_LINE, "par_pack_item : rectype.type = %d\n", recdes->type);
+	  error = ER_FAILED;
+	  goto end;
+	}
+
+      if ((item->item_type == RVREPL_DATA_INSERT && rcvindex != RVHF_INSERT && rcvindex != RVHF_MVCC_INSERT)
+	  || (item->item_type != RVREPL_DATA_INSERT && rcvindex != RVHF_UPDATE && rcvindex != RVOVF_CHANGE_LINK
+	      && rcvindex != RVHF_MVCC_INSERT && rcvindex != RVHF_UPDATE_NOTIFY_VACUUM
+	      && rcvindex != RVHF_INSERT_NEWHOME))
+	{
+	  er_log_debug (ARG_FILE_LINE, "par_pack_item : rcvindex = %d\n", rcvindex);
+	  error = ER_FAILED;
+	  goto end;
+	}
+
+      request.rec_type = recdes->type;
+      request.rec_length = recdes->length;
+    }
+
+  request.body_length = DB_ALIGN (request.key_length + request.class_name_length + request.rec_length, MAX_ALIGNMENT);
+
+  buffer = la_par_reserve_buffer (*offset + sizeof (request) + request.body_length);
+  if (buffer == NULL)
+    {
+      error = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto end;
+    }
+
+  ptr = buffer + *offset;
+  memcpy (ptr, &request, sizeof (request));
+  ptr += sizeof (request);
+  (void) or_pack_value (ptr, &item->key);
+  memcpy (ptr + request.key_length, item->class_name, request.class_name_length);
+  if (recdes != NULL)
+    {
+      memcpy (ptr + request.key_length + request.class_name_length, recdes->data, recdes->length);
+    }
+  *offset += sizeof (request) + request.body_length;
+
+  trans->num_rows++;
+
+end:
+  if (error != NO_ERROR && error != ER_OUT_OF_VIRTUAL_MEMORY)
+    {
+      help_sprint_value (&item->key, buf, 255);
+      er_stack_push ();
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE,
+	      (item->item_type == RVREPL_DATA_INSERT) ? ER_HA_LA_FAILED_TO_APPLY_INSERT : ER_HA_LA_FAILED_TO_APPLY_UPDATE,
+	      4, item->class_name, buf, error, "internal client error.");
+      er_stack_pop ();
+
+      la_Info.fail_counter++;
+      error = NO_ERROR;
+    }
+
+  if (pageid != NULL_PAGEID)
+    {
+      la_release_page_buffer (pageid);
+    }
+
+  return error;
+}
+
+/*
+ * la_par_new_trans() - take the slot of a new transaction
+ *   return: NO_ERROR or error code
+ *   trans(out):
+ */
+static int
+la_par_new_trans (LA_PAR_TRANS ** trans)
+{
+  int error;
+
+  /* the slot of the oldest transaction is reused once it is committed */
+  while (la_Par.tail_seq - la_Par.head_seq >= (unsigned int) la_Par.max_trans)
+    {
+      error = la_par_wait_reply (la_Par.trans[la_Par.head_seq % la_Par.max_trans].worker);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  *trans = &la_Par.trans[la_Par.tail_seq % la_Par.max_trans];
+  (*trans)->is_done = false;
+  (*trans)->num_rows = 0;
+  (*trans)->num_buckets = 0;
+  LSA_SET_NULL (&(*trans)->last_rep_lsa);
+
+  return NO_ERROR;
+}
+
+/*
+ * la_par_skip_applied() - account a transaction committed by a worker before
+ *                         the restart
+ *   return: NO_ERROR or error code
+ *   apply(in): the transaction
+ *   commit(in): its commit
+ *
+ * Note: it is retired in commit order like the dispatched ones, so that the
+ *       recorded position does not pass the transactions still pending.
+ */
+static int
+la_par_skip_applied (LA_APPLY * apply, LA_COMMIT * commit)
+{
+  LA_PAR_TRANS *trans;
+  int error;
+
+  error = la_par_new_trans (&trans);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  trans->worker = -1;
+  trans->is_done = true;
+  LSA_COPY (&trans->start_lsa, &apply->start_lsa);
+  LSA_COPY (&trans->commit_lsa, &commit->log_lsa);
+  trans->log_record_time = commit->log_record_time;
+  la_Par.tail_seq++;
+
+  la_par_retire_committed ();
+
+  return NO_ERROR;
+}
+
+/*
+ * la_par_dispatch() - send a committed transaction to a worker
+ *   return: NO_ERROR or error code
+ *   apply(in): the transaction
+ *   commit(in): its commit
+ */
+static int
+la_par_dispatch (LA_APPLY * apply, LA_COMMIT * commit)
+{
+  LA_PAR_TRANS *trans;
+  LA_PAR_REQUEST request;
+  LA_ITEM *item;
+  int *buckets;
+  int worker, offset, bucket, i;
+  int error;
+
+  error = la_par_collect_replies ();
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  error = la_par_new_trans (&trans);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  /* the write set */
+  for (item = apply->head; item != NULL; item = item->next)
+    {
+      if (la_par_need_apply (item) == false)
+	{
+	  continue;
+	}
+
+      bucket = la_par_key_bucket (item);
+      if (bucket < 0)
+	{
+	  return bucket;
+	}
+
+      if (trans->num_buckets >= trans->max_buckets)
+	{
+	  buckets = (int *) realloc (trans->buckets, MAX (16, trans->max_buckets * 2) * sizeof (int));
+	  if (buckets == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		      MAX (16, trans->max_buckets * 2) * sizeof (int));
+	      return ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	  trans->buckets = buckets;
+	  trans->max_buckets = MAX (16, trans->max_buckets * 2);
+	}
+      trans->buckets[trans->num_buckets++] = bucket;
+    }
+
+  error = la_par_choose_worker (trans, &worker);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  offset = 0;
+  for (item = apply->head; item != NULL; item = item->next)
+    {
+      if (la_par_need_apply (item) == false)
+	{
+	  continue;
+	}
+
+      error = la_par_pack_item (item, trans, &offset);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      LSA_COPY (&trans->last_rep_lsa, &item->lsa);
+    }
+
+  memset (&request, 0, sizeof (request));
+  request.type = LA_PAR_MSG_COMMIT;
+  request.seq = la_Par.tail_seq;
+  LSA_COPY (&request.commit_lsa, &commit->log_lsa);
+  if (la_par_reserve_buffer (offset + sizeof (request)) == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memcpy (la_Par.buffer + offset, &request, sizeof (request));
+  offset += sizeof (request);
+
+  if (la_par_write (la_Par.workers[worker].request_fd, la_Par.buffer, offset) != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, "cannot send a transaction to apply worker");
+      la_applier_need_shutdown = true;
+      return ER_HA_GENERIC_ERROR;
+    }
+
+  trans->worker = worker;
+  LSA_COPY (&trans->start_lsa, &apply->start_lsa);
+  LSA_COPY (&trans->commit_lsa, &commit->log_lsa);
+  trans->log_record_time = commit->log_record_time;
+  for (i = 0; i < trans->num_buckets; i++)
+    {
+      la_Par.workers[worker].key_refs[trans->buckets[i]]++;
+    }
+  la_Par.workers[worker].num_pending++;
+  la_Par.tail_seq++;
+
+  la_Info.total_rows += trans->num_rows;
+  if (!LSA_ISNULL (&trans->last_rep_lsa))
+    {
+      LSA_COPY (&la_Info.committed_rep_lsa, &trans->last_rep_lsa);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * la_par_apply_commit() - apply a commit of the commit list with the workers
+ *   return: NO_ERROR or error code
+ *   commit(in):
+ *   final_pageid(in):
+ *
+ * Note: what cannot be dispatched is applied by la_apply_repl_log () after
+ *       all the dispatched transactions, and committed at once so that the
+ *       workers never wait for the locks of the applier.
+ */
+static int
+la_par_apply_commit (LA_COMMIT * commit, LOG_PAGEID final_pageid)
+{
+  LA_APPLY *apply;
+  int error, commit_error;
+
+  apply = la_find_apply_list (commit->tranid);
+  if (apply == NULL || apply->head == NULL || commit->type == LOG_ABORT
+      || LSA_LE (&commit->log_lsa, &la_Info.last_committed_lsa))
+    {
+      return la_apply_repl_log (commit->tranid, commit->type, &commit->log_lsa, &la_Info.total_rows, final_pageid);
+    }
+
+  if (commit->type == LOG_COMMIT && la_par_was_applied (&commit->log_lsa))
+    {
+      error = la_par_skip_applied (apply, commit);
+      la_clear_applied_info (apply);
+      return error;
+    }
+
+  error = la_lock_dbname (&la_Info.db_lockf_vdes, la_slave_db_name, la_Info.log_path);
+  assert_release (error == NO_ERROR);
+
+  if (commit->type == LOG_COMMIT && la_par_can_dispatch (apply))
+    {
+      error = la_par_dispatch (apply, commit);
+      la_clear_applied_info (apply);
+      return error;
+    }
+
+  error = la_par_wait_workers ();
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  error = la_apply_repl_log (commit->tranid, commit->type, &commit->log_lsa, &la_Info.total_rows, final_pageid);
+  if (error == ER_NET_CANT_CONNECT_SERVER || error == ER_LC_PARTIALLY_FAILED_TO_FLUSH
+      || error == ER_LC_FAILED_TO_FLUSH_REPL_ITEMS)
+    {
+      return error;
+    }
+
+  commit_error = la_log_commit (false);
+  if (commit_error != NO_ERROR)
+    {
+      error = commit_error;
+    }
+
+  return error;
+}
+
+/*
+ * la_par_report_stats() - write the counters of the workers to the error log
+ *   return: none
+ *   force(in): write them regardless of the interval
+ */
+static void
+la_par_report_stats (bool force)
+{
+  LA_PAR_WORKER *w;
+  char buffer[LINE_MAX];
+  time_t now;
+  int elapsed, i;
+
+  now = time (NULL);
+  elapsed = (int) (now - la_Par.last_report_time);
+  if (force == false && elapsed < LA_PAR_STATS_INTERVAL_IN_SECS)
+    {
+      return;
+    }
+  elapsed = MAX (elapsed, 1);
+
+  for (i = 0; i < la_Par.num_workers; i++)
+    {
+      w = &la_Par.workers[i];
+      snprintf (buffer, sizeof (buffer),
+		"apply worker %d: %lld transactions, %lld rows, %lld rows/sec, delay %d sec (max %d sec), "
+		"%d pending transactions, %lld waits for overlapping write sets", i, (long long) w->trans_counter,
+		(long long) w->row_counter, (long long) ((w->row_counter - w->last_row_counter) / elapsed),
+		(w->num_pending > 0) ? w->delay : 0, w->max_delay, w->num_pending, (long long) w->wait_counter);
+      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buffer);
+
+      w->last_row_counter = w->row_counter;
+      w->max_delay = 0;
+    }
+
+  la_Par.last_report_time = now;
+}
+
+static LA_ITEM *
+la_get_next_repl_item (LA_ITEM * item, bool is_long_trans, LOG_LSA * last_lsa)
+{
+  if (is_long_trans)
+    {
+      return la_get_next_repl_item_from_log (item, last_lsa);
+    }
+  else
+    {
+      return la_get_next_repl_item_from_list (item);
+    }
+}
+
+static LA_ITEM *
+la_get_next_repl_item_from_list (LA_ITEM * item)
+{
+  return (item->next);
+}
+
+static LA_ITEM *
+la_get_next_repl_item_from_log (LA_ITEM * item, LOG_LSA * last_lsa)
+{
+  LOG_LSA prev_repl_lsa;
+  LOG_LSA curr_lsa;
+  LOG_PAGE *curr_log_page;
+  LOG_RECORD_HEADER *prev_repl_log_record = NULL;
+  LOG_RECORD_HEADER *curr_log_record;
+  LA_ITEM *next_item = NULL;
+
+  LSA_COPY (&prev_repl_lsa, &item->lsa);
+  LSA_COPY (&curr_lsa, &item->lsa);
+
+  while (!LSA_ISNULL (&curr_lsa))
+    {
+      curr_log_page = la_get_page (curr_lsa.pageid);
+      curr_log_record = LOG_GET_LOG_RECORD_HEADER (curr_log_page, &curr_lsa);
+
+      if (prev_repl_log_record == NULL)
+	{
+	  prev_repl_log_record = (LOG_RECORD_HEADER *) malloc (sizeof (LOG_RECORD_HEADER));
+	  if (prev_repl_log_record == NULL)
+	    {
+	      return NULL;
+	    }
+
+	  memcpy (prev_repl_log_record, curr_log_record, sizeof (LOG_RECORD_HEADER));
+	}
+      if (!LSA_EQ (&curr_lsa, &prev_repl_lsa) && prev_repl_log_record->trid == curr_log_record->trid)
+	{
+	  if (LSA_GT (&curr_lsa, last_lsa) || curr_log_record->type == LOG_COMMIT || curr_log_record->type == LOG_ABORT
+	      || LSA_GE (&curr_lsa, &la_Info.act_log.log_hdr->eof_lsa))
+	    {
+	      break;
+	    }
+
+	  if (curr_log_record->type == LOG_REPLICATION_DATA || curr_log_record->type == LOG_REPLICATION_STATEMENT)
+	    {
+	      next_item = la_make_repl_item (curr_log_page, curr_log_record->type, curr_log_record->trid, &curr_lsa);
+	      assert (next_item);
+
+	      break;
+	    }
+
+	}
+      la_release_page_buffer (curr_lsa.pageid);
+      LSA_COPY (&curr_lsa, &curr_log_record->forw_lsa);
+    }
+
+  if (prev_repl_log_record)
+    {
+      free_and_init (prev_repl_log_record);
+    }
+
+  return next_item;
+}
+
+
+static int
+la_log_record_process (LOG_RECORD_HEADER * lrec, LOG_LSA * final, LOG_PAGE * pg_ptr)
+{
+  LA_APPLY *apply = NULL;
+  int error = NO_ERROR;
+  LOG_LSA lsa_apply;
+  LOG_LSA required_lsa;
+  LOG_PAGEID final_pageid;
+  int commit_list_count;
+  LOG_REC_HA_SERVER_STATE *ha_server_state;
+  char buffer[256];
+  time_t eot_time;
+
+  if (lrec->trid == NULL_TRANID || LSA_GT (&lrec->prev_tranlsa, final) || LSA_GT (&lrec->back_lsa, final))
+    {
+      if (lrec->type != LOG_END_OF_LOG)
+	{
+	  la_applier_need_shutdown = true;
+
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_LA_INVALID_REPL_LOG_RECORD, 10, final->pageid, final->offset,
+		  lrec->forw_lsa.pageid, lrec->forw_lsa.offset, lrec->back_lsa.pageid, lrec->back_lsa.offset,
+		  lrec->trid, lrec->prev_tranlsa.pageid, lrec->prev_tranlsa.offset, lrec->type);
+	  return ER_LOG_PAGE_CORRUPTED;
+	}
+    }
+
+  if ((lrec->type != LOG_END_OF_LOG && lrec->type != LOG_DUMMY_HA_SERVER_STATE) && lrec->trid != LOG_SYSTEM_TRANID
+      && LSA_ISNULL (&lrec->prev_tranlsa))
+    {
+      apply = la_add_apply_list (lrec->trid);
+      if (apply == NULL)
+	{
+	  la_applier_need_shutdown = true;
+
+	  assert (er_errid () != NO_ERROR);
+	  error = er_errid ();
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	  else
+	    {
+	      return ER_FAILED;
+	    }
+	}
+      if (LSA_ISNULL (&apply->start_lsa))
+	{
+	  LSA_COPY (&apply->start_lsa, final);
+	}
+    }
+
+  la_Info.is_end_of_record = false;
+  switch (lrec->type)
+    {
+    case LOG_END_OF_LOG:
+      if (la_does_page_exist (final->pageid + 1) && la_does_page_exist (final->pageid) == LA_PAGE_EXST_IN_ARCHIVE_LOG)
+	{
+	  /* when we meet the END_OF_LOG of archive file, skip log page */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_LA_UNEXPECTED_EOF_IN_ARCHIVE_LOG, 2, final->pageid,
+		  final->offset);
+	  final->pageid++;
+	  final->offset = 0;
+	}
+      else
+	{
+	  /* we meet the END_OF_LOG */
+#if defined (LA_VERBOSE_DEBUG)
+	  er_log_debug (ARG_FILE_LINE, "reached END_OF_LOG in active log. LSA(%d|%d)", final->pageid, final->offset);
+#endif
+	  la_Info.is_end_of_record = true;
+	}
+      return ER_INTERRUPTED;
+
+    case LOG_REPLICATION_DATA:
+    case LOG_REPLICATION_STATEMENT:
+      /* add the replication log to the target transaction */
+      error = la_set_repl_log (pg_ptr, lrec->type, lrec->trid, final);
+      if (error != NO_ERROR)
+	{
+	  la_applier_need_shutdown = true;
+	  return error;
+	}
+      break;
+
+    case LOG_COMMIT_TOPOPE:
+    case LOG_COMMIT:
+      /* apply the replication log to the slave */
+      if (LSA_GT (final, &la_Info.committed_lsa))
+	{
+	  /* add the repl_list to the commit_list */
+	  if (lrec->type == LOG_COMMIT_TOPOPE)
+	    {
+	      eot_time = 0;
+	    }
+	  else
+	    {
+	      eot_time = la_retrieve_eot_time (pg_ptr, final);
+	    }
+
+	  error = la_add_node_into_la_commit_list (lrec->trid, final, lrec->type, eot_time);
+	  if (error != NO_ERROR)
+	    {
+	      la_applier_need_shutdown = true;
+	      return error;
+	    }
+
+	  /* in case of delayed/time-bound replication */
+	  if (eot_time != 0)
+	    {
+	      error = la_delay_replica (eot_time);
+	      if (error != NO_ERROR)
+		{
+		  return error;
+		}
+	    }
+
+	  /* make db_ha_apply_info.status busy */
+	  if (la_Info.status == LA_STATUS_IDLE)
+	    {
+	      la_Info.status = LA_STATUS_BUSY;
+	    }
+
+	  final_pageid = (pg_ptr) ? pg_ptr->hdr.logical_pageid : NULL_PAGEID;
+	  do
+	    {
 	      error = la_apply_commit_list (&lsa_apply, final_pageid);
 	      if (error == ER_NET_CANT_CONNECT_SERVER)
 		{
@@ -6370,6 +8306,11 @@ la_log_commit (bool update_commit_time)
 {
   int res;
   int error = NO_ERROR;
+  LOG_LSA dispatched_lsa, dispatched_rep_lsa;
+  time_t dispatched_log_record_time = 0;
+  LA_PAR_TRANS *trans;
+  unsigned int seq;
+  bool has_pending = false;
 
   (void) la_find_required_lsa (&la_Info.required_lsa);
 
@@ -6387,10 +8328,63 @@ la_log_commit (bool update_commit_time)
       return error;
     }
 
+  if (la_Par.num_workers > 0)
+    {
+      error = la_par_collect_replies ();
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      la_par_report_stats (false);
+
+      if (la_Par.head_seq != la_Par.tail_seq)
+	{
+	  /* record the position of what the workers have committed instead of what has been dispatched */
+	  has_pending = true;
+	  for (seq = la_Par.head_seq; seq != la_Par.tail_seq; seq++)
+	    {
+	      trans = &la_Par.trans[seq % la_Par.max_trans];
+	      if (LSA_LT (&trans->start_lsa, &la_Info.required_lsa))
+		{
+		  LSA_COPY (&la_Info.required_lsa, &trans->start_lsa);
+		}
+	    }
+
+	  LSA_COPY (&dispatched_lsa, &la_Info.committed_lsa);
+	  LSA_COPY (&dispatched_rep_lsa, &la_Info.committed_rep_lsa);
+	  dispatched_log_record_time = la_Info.log_record_time;
+
+	  LSA_COPY (&la_Info.committed_lsa, &la_Par.applied_lsa);
+	  LSA_COPY (&la_Info.committed_rep_lsa, &la_Par.applied_rep_lsa);
+	  la_Info.log_record_time = la_Par.applied_log_record_time;
+	}
+    }
+
   res = la_update_ha_last_applied_info ();
+  if (res > 0 && (la_Par.num_workers > 0 || la_Par.num_applied_marks > 0))
+    {
+      /* the marks up to the recorded position are not needed any more */
+      (void) la_par_delete_applied_marks (&la_Info.committed_lsa);
+    }
+
+  if (has_pending)
+    {
+      LSA_COPY (&la_Info.committed_lsa, &dispatched_lsa);
+      LSA_COPY (&la_Info.committed_rep_lsa, &dispatched_rep_lsa);
+      la_Info.log_record_time = dispatched_log_record_time;
+    }
+
   if (res > 0)
     {
       error = la_commit_transaction ();
+      if (error == NO_ERROR && la_Par.num_workers == 0 && la_Par.next_applied_mark >= la_Par.num_applied_marks
+	  && la_Par.applied_marks != NULL)
+	{
+	  /* all the marks have been passed and deleted */
+	  free_and_init (la_Par.applied_marks);
+	  la_Par.num_applied_marks = 0;
+	  la_Par.next_applied_mark = 0;
+	}
     }
   else
     {
@@ -6782,6 +8776,8 @@ la_shutdown (void)
 {
   int i;
 
+  la_par_stop_workers ();
+
   /* clean up */
   if (la_Info.arv_log.log_vdes != NULL_VOLDES)
     {
@@ -8631,6 +10627,18 @@ la_apply_log_file (const char *database_name, const char *log_path, const int ma
       la_print_repl_filter_info ();
     }
 
+  error = la_par_start_workers (database_name);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  error = la_par_load_applied_marks ();
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
   er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_LA_STARTED, 6, la_Info.required_lsa.pageid,
 	  la_Info.required_lsa.offset, la_Info.committed_lsa.pageid, la_Info.committed_lsa.offset,
 	  la_Info.committed_rep_lsa.pageid, la_Info.committed_rep_lsa.offset);
@@ -9047,6 +11055,12 @@ la_apply_log_file (const char *database_name, const char *log_path, const int ma
     }
   while (la_applier_need_shutdown == false);
 
+  if (la_Par.num_workers > 0 && la_Info.reinit_copylog == false && la_par_wait_workers () == NO_ERROR)
+    {
+      /* record the transactions committed by the workers */
+      (void) la_log_commit (false);
+    }
+
   if (la_Info.reinit_copylog == true)
     {
       char error_str[LINE_MAX];
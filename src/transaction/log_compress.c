@@ -30,6 +30,29 @@
 
 #include "log_compress.h"
 #include "error_manager.h"
+#include "system_parameter.h"
+
+/* indexed by LOG_COMPRESS_METHOD */
+static const LOG_ZIP_METHOD log_Zip_methods[] = {
+  {"lzo1x_1", lzo1x_1_compress, LZO1X_1_MEM_COMPRESS},
+  {"lzo1x_999", lzo1x_999_compress, LZO1X_999_MEM_COMPRESS}
+};
+
+/*
+ * log_zip_get_method - get a compression method
+ *   return: compression method
+ *   method_id(in): LOG_COMPRESS_METHOD; the fastest method if unknown
+ */
+const LOG_ZIP_METHOD *
+log_zip_get_method (int method_id)
+{
+  if (method_id < 0 || method_id >= (int) (sizeof (log_Zip_methods) / sizeof (log_Zip_methods[0])))
+    {
+      method_id = LOG_COMPRESS_LZO1X_1;
+    }
+
+  return &log_Zip_methods[method_id];
+}
 
 /*
  * log_zip - compress(zip) log data into LOG_ZIP
@@ -46,7 +69,7 @@ log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
   int rc;
 
   assert (length > 0 && data != NULL);
-  assert (log_zip != NULL);
+  assert (log_zip != NULL && log_zip->method != NULL);
 
   log_zip->data_length = 0;
 
@@ -77,8 +100,8 @@ log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
   memcpy (log_zip->log_data, &length, sizeof (LOG_ZIP_SIZE_T));
 
   rc =
-    lzo1x_1_compress ((lzo_bytep) data, (lzo_uint) length, log_zip->log_data + sizeof (LOG_ZIP_SIZE_T), &zip_len,
-		      log_zip->wrkmem);
+    (*log_zip->method->zip_func) ((lzo_bytep) data, (lzo_uint) length, log_zip->log_data + sizeof (LOG_ZIP_SIZE_T),
+				  &zip_len, log_zip->wrkmem);
   if (rc == LZO_E_OK)
     {
       log_zip->data_length = zip_len + sizeof (LOG_ZIP_SIZE_T);
@@ -192,7 +215,8 @@ log_diff (LOG_ZIP_SIZE_T undo_length, const void *undo_data, LOG_ZIP_SIZE_T redo
  *   length(in): log_zip data buffer to be allocated
  *   is_zip(in): to be used zip or not
  *
- * Note:
+ * Note: A structure used to zip compresses with the method given by the
+ *       log_compress_method parameter.
  */
 LOG_ZIP *
 log_zip_alloc (LOG_ZIP_SIZE_T size, bool is_zip)
@@ -221,18 +245,20 @@ log_zip_alloc (LOG_ZIP_SIZE_T size, bool is_zip)
 
   if (is_zip)
     {
-      /* lzo method is best speed : LZO1X_1_MEM_COMPRESS */
-      log_zip->wrkmem = (lzo_bytep) malloc (LZO1X_1_MEM_COMPRESS);
+      log_zip->method = log_zip_get_method (prm_get_integer_value (PRM_ID_LOG_COMPRESS_METHOD));
+      log_zip->wrkmem = (lzo_bytep) malloc (log_zip->method->wrkmem_size);
       if (log_zip->wrkmem == NULL)
 	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		  (size_t) log_zip->method->wrkmem_size);
 	  free_and_init (log_zip->log_data);
 	  free_and_init (log_zip);
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) LZO1X_1_MEM_COMPRESS);
 	  return NULL;
 	}
     }
   else
     {
+      log_zip->method = NULL;
       log_zip->wrkmem = NULL;
     }
 
@@ -48,6 +48,24 @@
 
 #define LOG_ZIP_SIZE_T int
 
+/*
+ * Compression method
+ *
+ * Note: Every method produces LZO1X data, so that log_unzip does not depend
+ *       on the method the log was compressed with.
+ */
+typedef int (*LOG_ZIP_FUNC) (const lzo_bytep src, lzo_uint src_len, lzo_bytep dst, lzo_uintp dst_len,
+			     lzo_voidp wrkmem);
+
+typedef struct log_zip_method LOG_ZIP_METHOD;
+
+struct log_zip_method
+{
+  const char *name;
+  LOG_ZIP_FUNC zip_func;	/* compression function */
+  lzo_uint32 wrkmem_size;	/* size of working memory of zip_func */
+};
+
 /*
  * Compressed(zipped) log structure
  */
@@ -59,10 +77,12 @@ struct log_zip
   LOG_ZIP_SIZE_T buf_size;	/* size of log_zip data buffer */
   lzo_bytep log_data;		/* compressed/uncompressed log_zip data (used as data buffer) */
   lzo_bytep wrkmem;		/* wokring memory for lzo function */
+  const LOG_ZIP_METHOD *method;	/* compression method, NULL if only used for unzip */
 };
 
 extern LOG_ZIP *log_zip_alloc (LOG_ZIP_SIZE_T size, bool is_zip);
 extern void log_zip_free (LOG_ZIP * log_zip);
+extern const LOG_ZIP_METHOD *log_zip_get_method (int method_id);
 
 extern bool log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data);
 extern bool log_unzip (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data);
@@ -529,10 +529,14 @@ struct log_group_commit_info
   /* group commit waiters count */
   pthread_mutex_t gc_mutex;
   pthread_cond_t gc_cond;
+  int num_waiters;		/* committers waiting for the next log flush */
+  int avg_waiters;		/* moving average of the committers served by a flush, in 1/16 */
 };
 
+#define LOG_GROUP_COMMIT_AVG_WAITERS_SCALE 16
+
 #define LOG_GROUP_COMMIT_INFO_INITIALIZER \
-  { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER }
+  { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0, LOG_GROUP_COMMIT_AVG_WAITERS_SCALE }
 
 typedef enum logwr_mode LOGWR_MODE;
 enum logwr_mode
@@ -934,6 +938,7 @@ struct log_tdes
   bool has_deadlock_priority;
 
   bool block_global_oldest_active_until_commit;
+  bool has_authorization_changes;	/* users or privileges were changed; see locator_check_authorization_change */
 };
 
 typedef struct log_addr_tdesarea LOG_ADDR_TDESAREA;
@@ -78,6 +78,7 @@
 #include "partition.h"
 #include "connection_support.h"
 #include "log_writer.h"
+#include "session.h"
 
 #include "fault_injection.h"
 
@@ -5317,6 +5318,9 @@ log_commit_local (THREAD_ENTRY * thread_p, LOG_TDES * tdes, bool retain_lock, bo
    * be rolled back. */
   logtb_complete_mvcc (thread_p, tdes, true);
 
+  /* the changes are visible now; clear the query results made before them */
+  qmgr_clear_committed_cache_entries (thread_p, tdes->tran_index);
+
   tdes->state = TRAN_UNACTIVE_WILL_COMMIT;
   /* undo_nxlsa is no longer required here and must be reset, in case checkpoint takes a snapshot of this transaction
    * during TRAN_UNACTIVE_WILL_COMMIT phase.
@@ -5353,6 +5357,12 @@ log_commit_local (THREAD_ENTRY * thread_p, LOG_TDES * tdes, bool retain_lock, bo
 
       log_cleanup_modified_class_list (thread_p, tdes, NULL, true, false);
 
+      if (tdes->has_authorization_changes)
+	{
+	  session_invalidate_shared_statements (thread_p);
+	  tdes->has_authorization_changes = false;
+	}
+
       if (is_local_tran)
 	{
 	  LOG_LSA commit_lsa;
@@ -5468,6 +5478,12 @@ log_abort_local (THREAD_ENTRY * thread_p, LOG_TDES * tdes, bool is_local_tran)
 
       log_cleanup_modified_class_list (thread_p, tdes, NULL, true, true);
 
+      if (tdes->has_authorization_changes)
+	{
+	  session_invalidate_shared_statements (thread_p);
+	  tdes->has_authorization_changes = false;
+	}
+
       if (tdes->first_save_entry != NULL)
 	{
 	  spage_free_saved_spaces (thread_p, tdes->first_save_entry);
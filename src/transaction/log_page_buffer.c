@@ -305,6 +305,19 @@ LOG_LOGGING_STAT log_Stat;
 static ARV_LOG_PAGE_INFO_TABLE logpb_Arv_page_info_table;
 
 static bool log_zip_support = false;
+
+/* compression statistics of a log record type (recovery index) */
+typedef struct logpb_zip_stat LOGPB_ZIP_STAT;
+struct logpb_zip_stat
+{
+  INT64 num_records;		/* records offered to compression */
+  INT64 num_zipped;		/* records stored with undo or redo data compressed */
+  INT64 data_length;		/* undo + redo length before compression */
+  INT64 zip_length;		/* undo + redo length as logged */
+  INT64 zip_usec;		/* time spent on diff and compression */
+};
+
+static LOGPB_ZIP_STAT logpb_Zip_stat[RV_LAST_LOGID + 1];
 #if !defined(SERVER_MODE)
 static LOG_ZIP *log_zip_undo = NULL;
 static LOG_ZIP *log_zip_redo = NULL;
@@ -366,6 +379,9 @@ static void logpb_finalize_writer_info (void);
 static void logpb_dump_log_header (FILE * outfp);
 static void logpb_dump_parameter (FILE * outfp);
 static void logpb_dump_runtime (FILE * outfp);
+static void logpb_dump_zip_stat (FILE * outfp);
+static void logpb_update_zip_stat (LOG_RCVINDEX rcvindex, int data_length, int zip_length, bool is_zipped,
+				   TSC_TICKS start_tick);
 static void logpb_reset_clock_hand (int buffer_index);
 static void logpb_move_next_clock_hand (void);
 static void logpb_unfix_page (LOG_BUFFER * bufptr);
@@ -763,6 +779,8 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
 
   pthread_cond_init (&group_commit_info->gc_cond, NULL);
   pthread_mutex_init (&group_commit_info->gc_mutex, NULL);
+  group_commit_info->num_waiters = 0;
+  group_commit_info->avg_waiters = LOG_GROUP_COMMIT_AVG_WAITERS_SCALE;
 
   pthread_mutex_init (&writer_info->wr_list_mutex, NULL);
 
@@ -3173,6 +3191,7 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY * thread_p, LOG_PRIOR_NO
   bool has_redo = false;
   bool is_undo_zip = false, is_redo_zip = false, is_diff = false;
   bool can_zip = false;
+  TSC_TICKS zip_start_tick;
 
   assert (node->log_header.type != LOG_DIFF_UNDOREDO_DATA && node->log_header.type != LOG_MVCC_DIFF_UNDOREDO_DATA);
   assert (num_ucrumbs == 0 || ucrumbs != NULL);
@@ -3269,6 +3288,8 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY * thread_p, LOG_PRIOR_NO
 
 	  assert (CAST_BUFLEN (tmp_ptr - data_ptr) == total_length);
 
+	  tsc_getticks (&zip_start_tick);
+
 	  if (ulength > 0 && rlength > 0)
 	    {
 	      (void) log_diff (ulength, undo_data, rlength, redo_data);
@@ -3292,6 +3313,11 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY * thread_p, LOG_PRIOR_NO
 		  is_redo_zip = log_zip (zip_redo, rlength, redo_data);
 		}
 	    }
+
+	  logpb_update_zip_stat (rcvindex, total_length,
+				 (is_undo_zip ? zip_undo->data_length : ulength)
+				 + (is_redo_zip ? zip_redo->data_length : rlength), is_undo_zip || is_redo_zip,
+				 zip_start_tick);
 	}
     }
 
@@ -4989,6 +5015,10 @@ logpb_flush_pages_direct (THREAD_ENTRY * thread_p)
  *                X           O         : group commit, wait
  *                O           X         : async commit, wakeup LFT and return
  *                O           O         : async & group commit, just return
+ *
+ *      With adaptive group commit, a waiting committer wakes up LFT without
+ *      waiting for the group commit interval when as many committers as a
+ *      flush has served on average are waiting.
  */
 void
 logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
@@ -5005,6 +5035,9 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
   int max_wait_time_in_msec = 1000;
   bool need_wakeup_LFT, need_wait;
   bool async_commit, group_commit;
+  bool is_waiter = false, is_perf_tracking;
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv_diff;
 
   LOG_LSA nxio_lsa;
 
@@ -5080,6 +5113,12 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 	  need_wakeup_LFT = true;
 	}
 
+      is_perf_tracking = mnt_is_perf_tracking (thread_p);
+      if (is_perf_tracking)
+	{
+	  tsc_getticks (&start_tick);
+	}
+
       while (LSA_LT (&nxio_lsa, flush_lsa))
 	{
 	  gettimeofday (&start_time, NULL);
@@ -5094,6 +5133,21 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 	      break;
 	    }
 
+	  if (is_waiter == false)
+	    {
+	      /* join the committers of the next flush; LFT counts and resets them */
+	      is_waiter = true;
+	      group_commit_info->num_waiters++;
+
+	      if (need_wakeup_LFT == false && prm_get_bool_value (PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE)
+		  && (group_commit_info->num_waiters * LOG_GROUP_COMMIT_AVG_WAITERS_SCALE
+		      + LOG_GROUP_COMMIT_AVG_WAITERS_SCALE / 2 > group_commit_info->avg_waiters))
+		{
+		  /* the group is complete */
+		  need_wakeup_LFT = true;
+		}
+	    }
+
 	  if (need_wakeup_LFT == true)
 	    {
 	      thread_wakeup_log_flush_thread ();
@@ -5104,6 +5158,13 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 	  need_wakeup_LFT = true;
 	  logpb_get_nxio_lsa (&nxio_lsa);
 	}
+
+      if (is_waiter && is_perf_tracking)
+	{
+	  tsc_getticks (&end_tick);
+	  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+	  mnt_log_commit_wait (thread_p, tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec);
+	}
     }
 #endif /* SERVER_MODE */
 }
@@ -11864,6 +11925,11 @@ logpb_dump_parameter (FILE * outfp)
 	   prm_get_integer_value (PRM_ID_LOG_GROUP_COMMIT_INTERVAL_MSECS));
 
   fprintf (outfp, "\tasync_commit : %s\n", prm_get_bool_value (PRM_ID_LOG_ASYNC_COMMIT) ? "on" : "off");
+
+  fprintf (outfp, "\tlog_compress : %s\n", log_zip_support ? "on" : "off");
+
+  fprintf (outfp, "\tlog_compress_method : %s\n",
+	   log_zip_get_method (prm_get_integer_value (PRM_ID_LOG_COMPRESS_METHOD))->name);
 }
 
 /*
@@ -11918,6 +11984,82 @@ logpb_dump_runtime (FILE * outfp)
   fprintf (outfp, "\tlog buffer flush count by replacement = %ld\n", log_Stat.log_buffer_flush_count_by_replacement);
 
   fprintf (outfp, "\tlog buffer expand count = %ld\n", log_Stat.log_buffer_expand_count);
+
+  logpb_dump_zip_stat (outfp);
+}
+
+/*
+ * logpb_update_zip_stat - account a compression attempt of a log record
+ *
+ * return: Nothing
+ *
+ *   rcvindex(in): recovery index of the log record
+ *   data_length(in): undo + redo length before compression
+ *   zip_length(in): undo + redo length as logged
+ *   is_zipped(in): true if undo or redo data is logged compressed
+ *   start_tick(in): when the compression started
+ */
+static void
+logpb_update_zip_stat (LOG_RCVINDEX rcvindex, int data_length, int zip_length, bool is_zipped,
+		       TSC_TICKS start_tick)
+{
+  LOGPB_ZIP_STAT *stat;
+  TSC_TICKS end_tick;
+  TSCTIMEVAL tv_diff;
+
+  if (rcvindex < 0 || rcvindex > RV_LAST_LOGID)
+    {
+      return;
+    }
+
+  tsc_getticks (&end_tick);
+  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+
+  stat = &logpb_Zip_stat[rcvindex];
+  ATOMIC_INC_64 (&stat->num_records, 1);
+  if (is_zipped)
+    {
+      ATOMIC_INC_64 (&stat->num_zipped, 1);
+    }
+  ATOMIC_INC_64 (&stat->data_length, data_length);
+  ATOMIC_INC_64 (&stat->zip_length, zip_length);
+  ATOMIC_INC_64 (&stat->zip_usec, tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec);
+}
+
+/*
+ * logpb_dump_zip_stat - dump compression statistics per log record type
+ *
+ * return: Nothing
+ *
+ *   outfp(in): file descriptor
+ *
+ * NOTE: Only record types that were offered to compression are printed.
+ *       Ratio is the logged length over the original length.
+ */
+static void
+logpb_dump_zip_stat (FILE * outfp)
+{
+  LOGPB_ZIP_STAT *stat;
+  int i;
+
+  fprintf (outfp, "Log Compression Statistics:\n");
+  fprintf (outfp, "\t%-40s %12s %12s %16s %16s %8s %12s\n", "record type", "records", "zipped", "data bytes",
+	   "logged bytes", "ratio", "usec/record");
+
+  for (i = 0; i <= RV_LAST_LOGID; i++)
+    {
+      stat = &logpb_Zip_stat[i];
+      if (stat->num_records == 0)
+	{
+	  continue;
+	}
+
+      fprintf (outfp, "\t%-40s %12lld %12lld %16lld %16lld %8.3f %12.3f\n", rv_rcvindex_string ((LOG_RCVINDEX) i),
+	       (long long) stat->num_records, (long long) stat->num_zipped, (long long) stat->data_length,
+	       (long long) stat->zip_length,
+	       stat->data_length > 0 ? (double) stat->zip_length / stat->data_length : 1.0,
+	       (double) stat->zip_usec / stat->num_records);
+    }
 }
 
 /*
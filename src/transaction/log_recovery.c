@@ -60,6 +60,8 @@ static void log_rv_undo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_
 static void log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv,
 				LOG_LSA * rcv_lsa_ptr, int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr);
+static int log_rv_get_redo_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCV * rcv,
+				 int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr, char **area_p);
 static bool log_rv_find_checkpoint (THREAD_ENTRY * thread_p, VOLID volid, LOG_LSA * rcv_lsa);
 static bool log_rv_get_unzip_log_data (THREAD_ENTRY * thread_p, int length, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				       LOG_ZIP * undo_unzip_ptr);
@@ -442,11 +444,84 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
 		    int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr)
 {
   char *area = NULL;
-  bool is_zip = false;
   int error_code;
 
   /* Note the the data page rcv->pgptr has been fetched by the caller */
 
+  if (log_rv_get_redo_data (thread_p, log_lsa, log_page_p, rcv, undo_length, undo_data, redo_unzip_ptr, &area)
+      != NO_ERROR)
+    {
+      return;
+    }
+
+  if (redofun != NULL)
+    {
+      error_code = (*redofun) (thread_p, rcv);
+      if (error_code != NO_ERROR)
+	{
+	  VPID vpid;
+	  if (rcv->pgptr != NULL)
+	    {
+	      pgbuf_get_vpid (rcv->pgptr, &vpid);
+	    }
+	  else
+	    {
+	      VPID_SET_NULL (&vpid);
+	    }
+
+	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE,
+			     "log_rvredo_rec: Error applying redo record at log_lsa=(%lld, %d), "
+			     "rcv = {mvccid=%llu, vpid=(%d, %d), offset = %d, data_length = %d}",
+			     (long long int) rcv_lsa_ptr->pageid, (int) rcv_lsa_ptr->offset,
+			     (long long int) rcv->mvcc_id, (int) vpid.pageid, (int) vpid.volid, (int) rcv->offset,
+			     (int) rcv->length);
+	}
+    }
+  else
+    {
+      er_log_debug (ARG_FILE_LINE,
+		    "log_rvredo_rec: WARNING.. There is not a"
+		    " REDO function to execute. May produce recovery problems.");
+    }
+
+  if (rcv->pgptr != NULL)
+    {
+      (void) pgbuf_set_lsa (thread_p, rcv->pgptr, rcv_lsa_ptr);
+    }
+
+  if (area != NULL)
+    {
+      free_and_init (area);
+    }
+}
+
+/*
+ * log_rv_get_redo_data - GET THE REDO DATA OF A LOG RECORD
+ *
+ * return: NO_ERROR or ER_FAILED
+ *
+ *   log_lsa(in/out): Log address identifier containing the log record
+ *   log_page_p(in/out): Pointer to page where data starts (Set as a side
+ *               effect to the page where data ends)
+ *   rcv(in/out): Recovery structure; data and length are set to the
+ *               redo data
+ *   undo_length(in):
+ *   undo_data(in):
+ *   redo_unzip_ptr(in):
+ *   area_p(out): Area allocated to hold the data, to be freed by the caller
+ *
+ * NOTE: The data may point into the log page or into redo_unzip_ptr, so it
+ *       is valid until they are reused.
+ */
+static int
+log_rv_get_redo_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCV * rcv,
+		      int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr, char **area_p)
+{
+  char *area = NULL;
+  bool is_zip = false;
+
+  *area_p = NULL;
+
   /* 
    * If data is contained in only one buffer, pass pointer directly.
    * Otherwise, allocate a contiguous area, copy the data and pass this area.
@@ -470,11 +545,12 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
       if (area == NULL)
 	{
 	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rvredo_rec");
-	  return;
+	  return ER_FAILED;
 	}
       /* Copy the data */
       logpb_copy_from_log (thread_p, area, rcv->length, log_lsa, log_page_p);
       rcv->data = area;
+      *area_p = area;
     }
 
   if (is_zip)
@@ -499,45 +575,7 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
 	}
     }
 
-  if (redofun != NULL)
-    {
-      error_code = (*redofun) (thread_p, rcv);
-      if (error_code != NO_ERROR)
-	{
-	  VPID vpid;
-	  if (rcv->pgptr != NULL)
-	    {
-	      pgbuf_get_vpid (rcv->pgptr, &vpid);
-	    }
-	  else
-	    {
-	      VPID_SET_NULL (&vpid);
-	    }
-
-	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE,
-			     "log_rvredo_rec: Error applying redo record at log_lsa=(%lld, %d), "
-			     "rcv = {mvccid=%llu, vpid=(%d, %d), offset = %d, data_length = %d}",
-			     (long long int) rcv_lsa_ptr->pageid, (int) rcv_lsa_ptr->offset,
-			     (long long int) rcv->mvcc_id, (int) vpid.pageid, (int) vpid.volid, (int) rcv->offset,
-			     (int) rcv->length);
-	}
-    }
-  else
-    {
-      er_log_debug (ARG_FILE_LINE,
-		    "log_rvredo_rec: WARNING.. There is not a"
-		    " REDO function to execute. May produce recovery problems.");
-    }
-
-  if (rcv->pgptr != NULL)
-    {
-      (void) pgbuf_set_lsa (thread_p, rcv->pgptr, rcv_lsa_ptr);
-    }
-
-  if (area != NULL)
-    {
-      free_and_init (area);
-    }
+  return NO_ERROR;
 }
 
 /*
@@ -2460,6 +2498,706 @@ log_recovery_analysis (THREAD_ENTRY * thread_p, LOG_LSA * start_lsa, LOG_LSA * s
   return;
 }
 
+#if defined(SERVER_MODE)
+/*
+ * Parallel redo
+ *
+ * The redo phase still reads the log with a single thread. Records of data
+ * pages are queued to workers hashed by VPID, so the records of a page are
+ * applied in log order by one worker while different pages are recovered
+ * concurrently. Records that are not bound to a page or that change the disk
+ * allocation maps are applied by the reading thread once every queued record
+ * has been applied. A prefetch thread reads the pages of queued records into
+ * the page buffer ahead of the workers.
+ *
+ * Workers run on the thread entries of the request workers, which are not
+ * started until the server finishes restarting.
+ */
+
+#define LOG_RV_REDO_MAX_QUEUED_JOBS 1024	/* per worker */
+#define LOG_RV_REDO_PREFETCH_SIZE 4096	/* pages waiting to be prefetched */
+
+typedef int (*LOG_RV_REDO_FUNC) (THREAD_ENTRY * thread_p, LOG_RCV * rcv);
+
+typedef struct log_rv_redo_job LOG_RV_REDO_JOB;
+struct log_rv_redo_job
+{
+  LOG_RV_REDO_JOB *next;
+  LOG_RV_REDO_FUNC redofun;
+  VPID vpid;
+  LOG_LSA rcv_lsa;
+  MVCCID mvcc_id;
+  PGLENGTH offset;
+  int length;
+  char *data;			/* redo data, allocated after the structure */
+};
+
+typedef struct log_rv_redo_px LOG_RV_REDO_PX;
+
+typedef struct log_rv_redo_worker LOG_RV_REDO_WORKER;
+struct log_rv_redo_worker
+{
+  LOG_RV_REDO_PX *px;
+  THREAD_ENTRY *thread_p;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;		/* signaled on new jobs, on free queue space and when idle */
+  LOG_RV_REDO_JOB *head;
+  LOG_RV_REDO_JOB *tail;
+  int num_jobs;
+  bool is_busy;			/* a job is being applied */
+  bool is_running;
+  bool is_closed;
+  INT64 num_applied;
+};
+
+struct log_rv_redo_px
+{
+  LOG_RV_REDO_WORKER *workers;
+  int num_workers;
+  const LOG_LSA *end_redo_lsa;
+
+  /* prefetch thread */
+  THREAD_ENTRY *prefetch_thread_p;
+  pthread_mutex_t prefetch_mutex;
+  pthread_cond_t prefetch_cond;
+  VPID prefetch_vpids[LOG_RV_REDO_PREFETCH_SIZE];
+  int prefetch_head;		/* next page to prefetch */
+  int prefetch_count;
+  bool prefetch_is_running;
+  bool prefetch_is_closed;
+  INT64 num_prefetched;
+};
+
+static LOG_RV_REDO_PX *log_rv_redo_px_start (THREAD_ENTRY * thread_p, const LOG_LSA * end_redo_lsa);
+static void log_rv_redo_px_end (THREAD_ENTRY * thread_p, LOG_RV_REDO_PX * px);
+static bool log_rv_redo_px_is_parallel (LOG_RV_REDO_PX * px, const VPID * rcv_vpid, LOG_RCVINDEX rcvindex);
+static void log_rv_redo_px_wait (LOG_RV_REDO_PX * px);
+static void log_rv_redo_px_add (THREAD_ENTRY * thread_p, LOG_RV_REDO_PX * px, LOG_LSA * log_lsa,
+				LOG_PAGE * log_page_p, LOG_RV_REDO_FUNC redofun, LOG_RCV * rcv, const VPID * rcv_vpid,
+				const LOG_LSA * rcv_lsa, int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr);
+static int log_rv_redo_px_create_thread (void *(*thread_fn) (void *), void *arg);
+static void *log_rv_redo_px_worker (void *arg);
+static void log_rv_redo_px_apply (THREAD_ENTRY * thread_p, LOG_RV_REDO_PX * px, LOG_RV_REDO_JOB * job);
+static void *log_rv_redo_px_prefetch (void *arg);
+static void log_rv_redo_px_attach_thread (THREAD_ENTRY * thread_p);
+static void log_rv_redo_px_detach_thread (THREAD_ENTRY * thread_p);
+
+/*
+ * log_rv_redo_px_start - start the parallel redo workers
+ *
+ * return: parallel redo context, or NULL to redo serially
+ *
+ *   end_redo_lsa(in): end of the redo phase
+ *
+ * NOTE: The number of workers is given by log_redo_parallel_threads and is
+ *       limited by the number of request worker entries. Failing to start
+ *       the workers falls back to the serial redo.
+ */
+static LOG_RV_REDO_PX *
+log_rv_redo_px_start (THREAD_ENTRY * thread_p, const LOG_LSA * end_redo_lsa)
+{
+  LOG_RV_REDO_PX *px = NULL;
+  LOG_RV_REDO_WORKER *worker;
+  THREAD_ENTRY *entry_p;
+  int num_workers;
+  int i;
+
+  num_workers = prm_get_integer_value (PRM_ID_LOG_REDO_PARALLEL_THREADS);
+  /* one more entry is needed by the prefetch thread */
+  num_workers = MIN (num_workers, thread_num_worker_threads () - 1);
+  if (num_workers < 2)
+    {
+      return NULL;
+    }
+
+  /* The entries are borrowed from request workers, which are started only after recovery. */
+  for (i = 1; i <= num_workers + 1; i++)
+    {
+      if (thread_find_entry_by_index (i)->status != TS_DEAD)
+	{
+	  return NULL;
+	}
+    }
+
+  px = (LOG_RV_REDO_PX *) malloc (sizeof (LOG_RV_REDO_PX));
+  if (px == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (LOG_RV_REDO_PX));
+      return NULL;
+    }
+  memset (px, 0, sizeof (LOG_RV_REDO_PX));
+
+  px->workers = (LOG_RV_REDO_WORKER *) malloc (num_workers * sizeof (LOG_RV_REDO_WORKER));
+  if (px->workers == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      num_workers * sizeof (LOG_RV_REDO_WORKER));
+      free_and_init (px);
+      return NULL;
+    }
+  memset (px->workers, 0, num_workers * sizeof (LOG_RV_REDO_WORKER));
+  px->end_redo_lsa = end_redo_lsa;
+
+  (void) pthread_mutex_init (&px->prefetch_mutex, NULL);
+  (void) pthread_cond_init (&px->prefetch_cond, NULL);
+  for (i = 0; i < num_workers; i++)
+    {
+      (void) pthread_mutex_init (&px->workers[i].mutex, NULL);
+      (void) pthread_cond_init (&px->workers[i].cond, NULL);
+    }
+
+  for (i = 0; i < num_workers; i++)
+    {
+      worker = &px->workers[i];
+      entry_p = thread_find_entry_by_index (i + 1);
+
+      worker->px = px;
+      worker->thread_p = entry_p;
+      worker->is_running = true;
+      if (log_rv_redo_px_create_thread (log_rv_redo_px_worker, worker) != NO_ERROR)
+	{
+	  worker->is_running = false;
+	  break;
+	}
+      px->num_workers++;
+    }
+
+  if (px->num_workers < 2)
+    {
+      log_rv_redo_px_end (thread_p, px);
+      er_clear ();
+      return NULL;
+    }
+
+  px->prefetch_thread_p = thread_find_entry_by_index (num_workers + 1);
+  px->prefetch_is_running = true;
+  if (log_rv_redo_px_create_thread (log_rv_redo_px_prefetch, px) != NO_ERROR)
+    {
+      /* redo without prefetch */
+      px->prefetch_is_running = false;
+      er_clear ();
+    }
+
+  er_log_debug (ARG_FILE_LINE, "log_recovery_redo: %d parallel redo workers are started.\n", px->num_workers);
+
+  return px;
+}
+
+/*
+ * log_rv_redo_px_end - apply all queued records and stop the parallel redo
+ *
+ * return: nothing
+ *
+ *   px(in): parallel redo context; freed
+ */
+static void
+log_rv_redo_px_end (THREAD_ENTRY * thread_p, LOG_RV_REDO_PX * px)
+{
+  LOG_RV_REDO_WORKER *worker;
+  int i;
+
+  log_rv_redo_px_wait (px);
+
+  for (i = 0; i < px->num_workers; i++)
+    {
+      worker = &px->workers[i];
+
+      pthread_mutex_lock (&worker->mutex);
+      worker->is_closed = true;
+      pthread_cond_broadcast (&worker->cond);
+      while (worker->is_running)
+	{
+	  pthread_cond_wait (&worker->cond, &worker->mutex);
+	}
+      pthread_mutex_unlock (&worker->mutex);
+
+      er_log_debug (ARG_FILE_LINE, "log_recovery_redo: parallel redo worker %d applied %lld records.\n", i,
+		    (long long int) worker->num_applied);
+    }
+
+  pthread_mutex_lock (&px->prefetch_mutex);
+  px->prefetch_is_closed = true;
+  pthread_cond_broadcast (&px->prefetch_cond);
+  while (px->prefetch_is_running)
+    {
+      pthread_cond_wait (&px->prefetch_cond, &px->prefetch_mutex);
+    }
+  pthread_mutex_unlock (&px->prefetch_mutex);
+
+  er_log_debug (ARG_FILE_LINE, "log_recovery_redo: %lld pages were prefetched.\n",
+		(long long int) px->num_prefetched);
+
+  for (i = 0; i < px->num_workers; i++)
+    {
+      pthread_mutex_destroy (&px->workers[i].mutex);
+      pthread_cond_destroy (&px->workers[i].cond);
+    }
+  pthread_mutex_destroy (&px->prefetch_mutex);
+  pthread_cond_destroy (&px->prefetch_cond);
+
+  free_and_init (px->workers);
+  free_and_init (px);
+}
+
+/*
+ * log_rv_redo_px_is_parallel - can a record be redone by the workers ?
+ *
+ * return: true if the record is to be queued to the workers
+ *
+ *   px(in): parallel redo context; NULL for serial redo
+ *   rcv_vpid(in): page of the record
+ *   rcvindex(in): recovery index of the record
+ *
+ * NOTE: A record that is not queued is redone by the caller, so this waits
+ *       until every queued record is applied.
+ */
+static bool
+log_rv_redo_px_is_parallel (LOG_RV_REDO_PX * px, const VPID * rcv_vpid, LOG_RCVINDEX rcvindex)
+{
+  if (px == NULL)
+    {
+      return false;
+    }
+
+  /* Logical records and disk manager records (which change the allocation maps checked before queueing any other
+   * record) are redone in log order by the reading thread. */
+  if (VPID_ISNULL (rcv_vpid) || rcv_vpid->volid == NULL_VOLID
+      || (rcvindex >= RVDK_NEWVOL && rcvindex <= RVDK_INIT_PAGES))
+    {
+      log_rv_redo_px_wait (px);
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * log_rv_redo_px_wait - wait until every queued record is applied
+ *
+ * return: nothing
+ *
+ *   px(in): parallel redo context; NULL for serial redo
+ */
+static void
+log_rv_redo_px_wait (LOG_RV_REDO_PX * px)
+{
+  LOG_RV_REDO_WORKER *worker;
+  int i;
+
+  if (px == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < px->num_workers; i++)
+    {
+      worker = &px->workers[i];
+
+      pthread_mutex_lock (&worker->mutex);
+      while (worker->num_jobs > 0 || worker->is_busy)
+	{
+	  pthread_cond_wait (&worker->cond, &worker->mutex);
+	}
+      pthread_mutex_unlock (&worker->mutex);
+    }
+}
+
+/*
+ * log_rv_redo_px_add - queue a redo record to the worker of its page
+ *
+ * return: nothing
+ *
+ *   log_lsa(in/out): Log address identifier containing the log record
+ *   log_page_p(in/out): Pointer to page where data starts (Set as a side
+ *               effect to the page where data ends)
+ *   redofun(in): Function to invoke to redo the data
+ *   rcv(in): Recovery structure (length, offset and mvcc_id are set)
+ *   rcv_vpid(in): Page of the record
+ *   rcv_lsa(in): Address of the log record
+ *   undo_length(in):
+ *   undo_data(in):
+ *   redo_unzip_ptr(in):
+ *
+ * NOTE: The redo data is copied, since the log page and unzip buffers are
+ *       reused for the next records.
+ */
+static void
+log_rv_redo_px_add (THREAD_ENTRY * thread_p, LOG_RV_REDO_PX * px, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
+		    LOG_RV_REDO_FUNC redofun, LOG_RCV * rcv, const VPID * rcv_vpid, const LOG_LSA * rcv_lsa,
+		    int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr)
+{
+  LOG_RV_REDO_WORKER *worker;
+  LOG_RV_REDO_JOB *job;
+  char *area = NULL;
+  int slot;
+
+  if (log_rv_get_redo_data (thread_p, log_lsa, log_page_p, rcv, undo_length, undo_data, redo_unzip_ptr, &area)
+      != NO_ERROR)
+    {
+      return;
+    }
+
+  job = (LOG_RV_REDO_JOB *) malloc (sizeof (LOG_RV_REDO_JOB) + rcv->length);
+  if (job == NULL)
+    {
+      if (area != NULL)
+	{
+	  free_and_init (area);
+	}
+      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rv_redo_px_add");
+      return;
+    }
+
+  job->next = NULL;
+  job->redofun = redofun;
+  job->vpid = *rcv_vpid;
+  LSA_COPY (&job->rcv_lsa, rcv_lsa);
+  job->mvcc_id = rcv->mvcc_id;
+  job->offset = rcv->offset;
+  job->length = rcv->length;
+  job->data = (char *) (job + 1);
+  if (rcv->length > 0)
+    {
+      memcpy (job->data, rcv->data, rcv->length);
+    }
+
+  if (area != NULL)
+    {
+      free_and_init (area);
+    }
+
+  /* read the page ahead of the worker; the page is dropped if the prefetch thread is too far behind */
+  pthread_mutex_lock (&px->prefetch_mutex);
+  if (px->prefetch_is_running && px->prefetch_count < LOG_RV_REDO_PREFETCH_SIZE)
+    {
+      slot = (px->prefetch_head + px->prefetch_count) % LOG_RV_REDO_PREFETCH_SIZE;
+      px->prefetch_vpids[slot] = job->vpid;
+      if (px->prefetch_count++ == 0)
+	{
+	  pthread_cond_signal (&px->prefetch_cond);
+	}
+    }
+  pthread_mutex_unlock (&px->prefetch_mutex);
+
+  worker = &px->workers[((unsigned int) job->vpid.pageid ^ ((unsigned int) job->vpid.volid << 24)) % px->num_workers];
+
+  pthread_mutex_lock (&worker->mutex);
+  while (worker->num_jobs >= LOG_RV_REDO_MAX_QUEUED_JOBS)
+    {
+      pthread_cond_wait (&worker->cond, &worker->mutex);
+    }
+
+  if (worker->tail == NULL)
+    {
+      worker->head = job;
+    }
+  else
+    {
+      worker->tail->next = job;
+    }
+  worker->tail = job;
+  worker->num_jobs++;
+
+  pthread_cond_broadcast (&worker->cond);
+  pthread_mutex_unlock (&worker->mutex);
+}
+
+/*
+ * log_rv_redo_px_create_thread - create a detached redo thread
+ *
+ * return: NO_ERROR or error code
+ *
+ *   thread_fn(in): thread function
+ *   arg(in): thread argument
+ */
+static int
+log_rv_redo_px_create_thread (void *(*thread_fn) (void *), void *arg)
+{
+  pthread_attr_t thread_attr;
+  pthread_t tid;
+#if defined(_POSIX_THREAD_ATTR_STACKSIZE)
+  size_t ts_size;
+#endif /* _POSIX_THREAD_ATTR_STACKSIZE */
+  int rv;
+
+  rv = pthread_attr_init (&thread_attr);
+  if (rv != 0)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_ATTR_INIT, 0);
+      return ER_CSS_PTHREAD_ATTR_INIT;
+    }
+
+  rv = pthread_attr_setdetachstate (&thread_attr, PTHREAD_CREATE_DETACHED);
+  if (rv != 0)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_ATTR_SETDETACHSTATE, 0);
+      pthread_attr_destroy (&thread_attr);
+      return ER_CSS_PTHREAD_ATTR_SETDETACHSTATE;
+    }
+
+#if defined(_POSIX_THREAD_ATTR_STACKSIZE)
+  /* redo functions run on the same stack size as the request workers */
+  rv = pthread_attr_getstacksize (&thread_attr, &ts_size);
+  if (ts_size != (size_t) prm_get_bigint_value (PRM_ID_THREAD_STACKSIZE))
+    {
+      rv = pthread_attr_setstacksize (&thread_attr, prm_get_bigint_value (PRM_ID_THREAD_STACKSIZE));
+      if (rv != 0)
+	{
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_ATTR_SETSTACKSIZE, 0);
+	  pthread_attr_destroy (&thread_attr);
+	  return ER_CSS_PTHREAD_ATTR_SETSTACKSIZE;
+	}
+    }
+#endif /* _POSIX_THREAD_ATTR_STACKSIZE */
+
+  rv = pthread_create (&tid, &thread_attr, thread_fn, arg);
+  pthread_attr_destroy (&thread_attr);
+  if (rv != 0)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_CREATE, 0);
+      return ER_CSS_PTHREAD_CREATE;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * log_rv_redo_px_attach_thread - prepare a borrowed thread entry for redo
+ *
+ * return: nothing
+ */
+static void
+log_rv_redo_px_attach_thread (THREAD_ENTRY * thread_p)
+{
+  thread_p->tid = pthread_self ();
+  thread_set_thread_entry_info (thread_p);
+  thread_p->type = TT_DAEMON;
+  thread_p->status = TS_RUN;
+  thread_set_current_tran_index (thread_p, LOG_SYSTEM_TRAN_INDEX);
+  er_clear ();
+}
+
+/*
+ * log_rv_redo_px_detach_thread - give a borrowed thread entry back
+ *
+ * return: nothing
+ */
+static void
+log_rv_redo_px_detach_thread (THREAD_ENTRY * thread_p)
+{
+  er_final (ER_THREAD_FINAL);
+
+  thread_p->tran_index = -1;
+  thread_p->type = TT_WORKER;
+  thread_p->status = TS_DEAD;
+  thread_p->tid = ((pthread_t) 0);
+}
+
+/*
+ * log_rv_redo_px_worker - apply the queued records of a worker
+ *
+ * return: NULL
+ *
+ *   arg(in): LOG_RV_REDO_WORKER
+ */
+static void *
+log_rv_redo_px_worker (void *arg)
+{
+  LOG_RV_REDO_WORKER *worker = (LOG_RV_REDO_WORKER *) arg;
+  THREAD_ENTRY *thread_p = worker->thread_p;
+  LOG_RV_REDO_JOB *job;
+
+  log_rv_redo_px_attach_thread (thread_p);
+
+  pthread_mutex_lock (&worker->mutex);
+  while (true)
+    {
+      while (worker->head == NULL && !worker->is_closed)
+	{
+	  pthread_cond_wait (&worker->cond, &worker->mutex);
+	}
+      if (worker->head == NULL)
+	{
+	  /* closed */
+	  break;
+	}
+
+      job = worker->head;
+      worker->head = job->next;
+      if (worker->head == NULL)
+	{
+	  worker->tail = NULL;
+	}
+      worker->num_jobs--;
+      worker->is_busy = true;
+      if (worker->num_jobs == LOG_RV_REDO_MAX_QUEUED_JOBS - 1)
+	{
+	  /* the reader may wait for queue space */
+	  pthread_cond_broadcast (&worker->cond);
+	}
+      pthread_mutex_unlock (&worker->mutex);
+
+      log_rv_redo_px_apply (thread_p, worker->px, job);
+      free_and_init (job);
+
+      pthread_mutex_lock (&worker->mutex);
+      worker->is_busy = false;
+      worker->num_applied++;
+      if (worker->num_jobs == 0)
+	{
+	  pthread_cond_broadcast (&worker->cond);
+	}
+    }
+  pthread_mutex_unlock (&worker->mutex);
+
+  log_rv_redo_px_detach_thread (thread_p);
+
+  /* worker may be freed as soon as is_running is reset */
+  pthread_mutex_lock (&worker->mutex);
+  worker->is_running = false;
+  pthread_cond_broadcast (&worker->cond);
+  pthread_mutex_unlock (&worker->mutex);
+
+  return NULL;
+}
+
+/*
+ * log_rv_redo_px_apply - redo a queued record
+ *
+ * return: nothing
+ *
+ *   px(in): parallel redo context
+ *   job(in): queued record
+ *
+ * NOTE: Same as the serial redo of a page record, except that the data was
+ *       already read from the log.
+ */
+static void
+log_rv_redo_px_apply (THREAD_ENTRY * thread_p, LOG_RV_REDO_PX * px, LOG_RV_REDO_JOB * job)
+{
+  LOG_RCV rcv;
+  LOG_LSA *rcv_page_lsaptr;
+  int error_code;
+
+  rcv.pgptr = pgbuf_fix (thread_p, &job->vpid, OLD_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
+  if (rcv.pgptr == NULL)
+    {
+      return;
+    }
+
+  /* If page_lsa >= rcv_lsa... already updated */
+  rcv_page_lsaptr = pgbuf_get_lsa (rcv.pgptr);
+  assert (px->end_redo_lsa == NULL || LSA_ISNULL (px->end_redo_lsa)
+	  || LSA_LE (rcv_page_lsaptr, px->end_redo_lsa));
+  if (LSA_LE (&job->rcv_lsa, rcv_page_lsaptr))
+    {
+      pgbuf_unfix (thread_p, rcv.pgptr);
+      return;
+    }
+
+  rcv.mvcc_id = job->mvcc_id;
+  rcv.offset = job->offset;
+  rcv.length = job->length;
+  rcv.data = job->data;
+  LSA_SET_NULL (&rcv.reference_lsa);
+
+  if (job->redofun != NULL)
+    {
+      error_code = (*job->redofun) (thread_p, &rcv);
+      if (error_code != NO_ERROR)
+	{
+	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE,
+			     "log_rv_redo_px_apply: Error applying redo record at log_lsa=(%lld, %d), "
+			     "rcv = {mvccid=%llu, vpid=(%d, %d), offset = %d, data_length = %d}",
+			     (long long int) job->rcv_lsa.pageid, (int) job->rcv_lsa.offset,
+			     (long long int) rcv.mvcc_id, (int) job->vpid.pageid, (int) job->vpid.volid,
+			     (int) rcv.offset, (int) rcv.length);
+	}
+    }
+  else
+    {
+      er_log_debug (ARG_FILE_LINE,
+		    "log_rv_redo_px_apply: WARNING.. There is not a"
+		    " REDO function to execute. May produce recovery problems.");
+    }
+
+  (void) pgbuf_set_lsa (thread_p, rcv.pgptr, &job->rcv_lsa);
+  pgbuf_unfix (thread_p, rcv.pgptr);
+}
+
+/*
+ * log_rv_redo_px_prefetch - read the pages of queued records ahead of the workers
+ *
+ * return: NULL
+ *
+ *   arg(in): LOG_RV_REDO_PX
+ *
+ * NOTE: Pages are only fixed and unfixed to have them in the page buffer;
+ *       pages latched by a worker are already there and are skipped.
+ */
+static void *
+log_rv_redo_px_prefetch (void *arg)
+{
+  LOG_RV_REDO_PX *px = (LOG_RV_REDO_PX *) arg;
+  THREAD_ENTRY *thread_p = px->prefetch_thread_p;
+  PAGE_PTR pgptr;
+  VPID vpid;
+
+  log_rv_redo_px_attach_thread (thread_p);
+
+  pthread_mutex_lock (&px->prefetch_mutex);
+  while (true)
+    {
+      while (px->prefetch_count == 0 && !px->prefetch_is_closed)
+	{
+	  pthread_cond_wait (&px->prefetch_cond, &px->prefetch_mutex);
+	}
+      if (px->prefetch_is_closed)
+	{
+	  break;
+	}
+
+      vpid = px->prefetch_vpids[px->prefetch_head];
+      px->prefetch_head = (px->prefetch_head + 1) % LOG_RV_REDO_PREFETCH_SIZE;
+      px->prefetch_count--;
+      pthread_mutex_unlock (&px->prefetch_mutex);
+
+      pgptr = pgbuf_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+      if (pgptr != NULL)
+	{
+	  pgbuf_unfix (thread_p, pgptr);
+	}
+      else
+	{
+	  er_clear ();
+	}
+
+      pthread_mutex_lock (&px->prefetch_mutex);
+      px->num_prefetched++;
+    }
+  pthread_mutex_unlock (&px->prefetch_mutex);
+
+  log_rv_redo_px_detach_thread (thread_p);
+
+  /* px may be freed as soon as prefetch_is_running is reset */
+  pthread_mutex_lock (&px->prefetch_mutex);
+  px->prefetch_is_running = false;
+  pthread_cond_broadcast (&px->prefetch_cond);
+  pthread_mutex_unlock (&px->prefetch_mutex);
+
+  return NULL;
+}
+#else /* SERVER_MODE */
+/* the stand-alone mode has a single thread entry, so the redo is serial */
+typedef struct log_rv_redo_px LOG_RV_REDO_PX;
+#define log_rv_redo_px_start(thread_p, end_redo_lsa) ((LOG_RV_REDO_PX *) NULL)
+#define log_rv_redo_px_end(thread_p, px)
+#define log_rv_redo_px_is_parallel(px, rcv_vpid, rcvindex) false
+#define log_rv_redo_px_wait(px)
+#define log_rv_redo_px_add(thread_p, px, log_lsa, log_page_p, redofun, rcv, rcv_vpid, rcv_lsa, undo_length, \
+			   undo_data, redo_unzip_ptr)
+#endif /* SERVER_MODE */
+
 /*
  * log_recovery_redo - SCAN FORWARD REDOING DATA
  *
@@ -2529,6 +3267,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   LOG_ZIP *redo_unzip_ptr = NULL;
   bool is_diff_rec;
   bool is_mvcc_op = false;
+  LOG_RV_REDO_PX *px = NULL;
+  bool is_px_redo = false;
 
   aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
 
@@ -2570,6 +3310,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
       return;
     }
 
+  px = log_rv_redo_px_start (thread_p, end_redo_lsa);
+
   while (!LSA_ISNULL (&lsa))
     {
       /* Fetch the page where the LSA record to undo is located */
@@ -2740,6 +3482,7 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	      rcv_vpid.pageid = undoredo->data.pageid;
 
 	      rcv.pgptr = NULL;
+	      is_px_redo = log_rv_redo_px_is_parallel (px, &rcv_vpid, undoredo->data.rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
 	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
@@ -2747,10 +3490,15 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		    {
 		      break;
 		    }
-		  rcv.pgptr = pgbuf_fix (thread_p, &rcv_vpid, OLD_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
-		  if (rcv.pgptr == NULL)
+		  /* a parallel redo fixes the page in the worker */
+		  if (!is_px_redo)
 		    {
-		      break;
+		      rcv.pgptr = pgbuf_fix (thread_p, &rcv_vpid, OLD_PAGE, PGBUF_LATCH_WRITE,
+					     PGBUF_UNCONDITIONAL_LATCH);
+		      if (rcv.pgptr == NULL)
+			{
+			  break;
+			}
 		    }
 		}
 
@@ -2850,7 +3598,22 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      if (is_diff_rec)
+	      if (is_px_redo)
+		{
+		  if (is_diff_rec)
+		    {
+		      /* XOR Process */
+		      log_rv_redo_px_add (thread_p, px, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_vpid,
+					  &rcv_lsa, (int) undo_unzip_ptr->data_length,
+					  (char *) undo_unzip_ptr->log_data, redo_unzip_ptr);
+		    }
+		  else
+		    {
+		      log_rv_redo_px_add (thread_p, px, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_vpid,
+					  &rcv_lsa, 0, NULL, redo_unzip_ptr);
+		    }
+		}
+	      else if (is_diff_rec)
 		{
 		  /* XOR Process */
 		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa,
@@ -2927,6 +3690,7 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	      rcv_vpid.pageid = redo->data.pageid;
 
 	      rcv.pgptr = NULL;
+	      is_px_redo = log_rv_redo_px_is_parallel (px, &rcv_vpid, redo->data.rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
 	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
@@ -2934,10 +3698,15 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		    {
 		      break;
 		    }
-		  rcv.pgptr = pgbuf_fix (thread_p, &rcv_vpid, OLD_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
-		  if (rcv.pgptr == NULL)
+		  /* a parallel redo fixes the page in the worker */
+		  if (!is_px_redo)
 		    {
-		      break;
+		      rcv.pgptr = pgbuf_fix (thread_p, &rcv_vpid, OLD_PAGE, PGBUF_LATCH_WRITE,
+					     PGBUF_UNCONDITIONAL_LATCH);
+		      if (rcv.pgptr == NULL)
+			{
+			  break;
+			}
 		    }
 		}
 
@@ -2990,8 +3759,16 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
-				  redo_unzip_ptr);
+	      if (is_px_redo)
+		{
+		  log_rv_redo_px_add (thread_p, px, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_vpid,
+				      &rcv_lsa, 0, NULL, redo_unzip_ptr);
+		}
+	      else
+		{
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
+				      redo_unzip_ptr);
+		}
 
 	      if (rcv.pgptr != NULL)
 		{
@@ -3012,6 +3789,9 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	      rcv.offset = -1;
 	      rcv.pgptr = NULL;
 
+	      /* redone in log order after the queued records */
+	      log_rv_redo_px_wait (px);
+
 	      rcvindex = dbout_redo->rcvindex;
 	      rcv.length = dbout_redo->length;
 
@@ -3050,6 +3830,7 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	      rcv_vpid.pageid = run_posp->data.pageid;
 
 	      rcv.pgptr = NULL;
+	      is_px_redo = log_rv_redo_px_is_parallel (px, &rcv_vpid, run_posp->data.rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
 	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
@@ -3057,10 +3838,15 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		    {
 		      break;
 		    }
-		  rcv.pgptr = pgbuf_fix (thread_p, &rcv_vpid, OLD_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
-		  if (rcv.pgptr == NULL)
+		  /* a parallel redo fixes the page in the worker */
+		  if (!is_px_redo)
 		    {
-		      break;
+		      rcv.pgptr = pgbuf_fix (thread_p, &rcv_vpid, OLD_PAGE, PGBUF_LATCH_WRITE,
+					     PGBUF_UNCONDITIONAL_LATCH);
+		      if (rcv.pgptr == NULL)
+			{
+			  break;
+			}
 		    }
 		}
 
@@ -3114,8 +3900,16 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
-				  NULL);
+	      if (is_px_redo)
+		{
+		  log_rv_redo_px_add (thread_p, px, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_vpid,
+				      &rcv_lsa, 0, NULL, NULL);
+		}
+	      else
+		{
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
+				      NULL);
+		}
 
 	      if (rcv.pgptr != NULL)
 		{
@@ -3142,6 +3936,7 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	      rcv_vpid.pageid = compensate->data.pageid;
 
 	      rcv.pgptr = NULL;
+	      is_px_redo = log_rv_redo_px_is_parallel (px, &rcv_vpid, compensate->data.rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
 	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
@@ -3149,10 +3944,15 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		    {
 		      break;
 		    }
-		  rcv.pgptr = pgbuf_fix (thread_p, &rcv_vpid, OLD_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
-		  if (rcv.pgptr == NULL)
+		  /* a parallel redo fixes the page in the worker */
+		  if (!is_px_redo)
 		    {
-		      break;
+		      rcv.pgptr = pgbuf_fix (thread_p, &rcv_vpid, OLD_PAGE, PGBUF_LATCH_WRITE,
+					     PGBUF_UNCONDITIONAL_LATCH);
+		      if (rcv.pgptr == NULL)
+			{
+			  break;
+			}
 		    }
 		}
 
@@ -3205,8 +4005,16 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv, &rcv_lsa, 0, NULL,
-				  NULL);
+	      if (is_px_redo)
+		{
+		  log_rv_redo_px_add (thread_p, px, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv, &rcv_vpid,
+				      &rcv_lsa, 0, NULL, NULL);
+		}
+	      else
+		{
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv, &rcv_lsa, 0, NULL,
+				      NULL);
+		}
 	      if (rcv.pgptr != NULL)
 		{
 		  pgbuf_unfix (thread_p, rcv.pgptr);
@@ -3472,6 +4280,12 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	}
     }
 
+  if (px != NULL)
+    {
+      log_rv_redo_px_end (thread_p, px);
+      px = NULL;
+    }
+
   log_zip_free (undo_unzip_ptr);
   log_zip_free (redo_unzip_ptr);
 
@@ -3487,6 +4301,11 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   (void) pgbuf_flush_all (thread_p, NULL_VOLID);
 
 exit:
+  if (px != NULL)
+    {
+      log_rv_redo_px_end (thread_p, px);
+    }
+
   LSA_SET_NULL (&log_Gl.unique_stats_table.curr_rcv_rec_lsa);
 
   return;
@@ -1958,6 +1958,7 @@ logtb_clear_tdes (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
       tdes->disable_modifications = db_Disable_modifications;
     }
   tdes->has_deadlock_priority = false;
+  tdes->has_authorization_changes = false;
 
   tdes->num_log_records_written = 0;
 }
@@ -2041,6 +2042,7 @@ logtb_initialize_tdes (LOG_TDES * tdes, int tran_index)
       tdes->bind_history[i].vals = NULL;
     }
   tdes->has_deadlock_priority = false;
+  tdes->has_authorization_changes = false;
 
   tdes->num_log_records_written = 0;
 